@@ -29,10 +29,16 @@
 #ifndef HYPERTABLE_COMMBUF_H
 #define HYPERTABLE_COMMBUF_H
 
+#include <algorithm>
 #include <string>
+#include <vector>
 
 #include <boost/shared_array.hpp>
 
+extern "C" {
+#include <sys/uio.h>
+}
+
 #include "Common/ByteString.h"
 #include "Common/InetAddr.h"
 #include "Common/Logger.h"
@@ -86,7 +92,8 @@ namespace Hypertable {
      * @param hdr Comm header
      * @param len Length of the primary buffer to allocate
      */
-    CommBuf(CommHeader &hdr, uint32_t len=0) : header(hdr), ext_ptr(0) {
+    CommBuf(CommHeader &hdr, uint32_t len=0)
+      : header(hdr), ext_ptr(0), segment_index(0), segment_offset(0) {
       len += header.encoded_length();
       data.set(new uint8_t [len], len, true);
       data_ptr = data.base + header.encoded_length();
@@ -104,7 +111,7 @@ namespace Hypertable {
      * @param buffer Extended buffer
      */
     CommBuf(CommHeader &hdr, uint32_t len, StaticBuffer &buffer)
-      : ext(buffer), header(hdr) {
+      : ext(buffer), header(hdr), segment_index(0), segment_offset(0) {
       len += header.encoded_length();
       data.set(new uint8_t [len], len, true);
       data_ptr = data.base + header.encoded_length();
@@ -126,7 +133,8 @@ namespace Hypertable {
      */
     CommBuf(CommHeader &hdr, uint32_t len,
 	    boost::shared_array<uint8_t> &ext_buffer, uint32_t ext_len) :
-      header(hdr), ext_shared_array(ext_buffer) {
+      header(hdr), segment_index(0), segment_offset(0),
+      ext_shared_array(ext_buffer) {
       len += header.encoded_length();
       data.set(new uint8_t [len], len, true);
       data_ptr = data.base + header.encoded_length();
@@ -149,6 +157,103 @@ namespace Hypertable {
       header.encode(&buf);
       data_ptr = data.base;
       ext_ptr = ext.base;
+      segment_index = 0;
+      segment_offset = 0;
+    }
+
+    /** Appends a segment to the scatter/gather list.  Segments are sent in
+     * place, in the order in which they were appended, after the extended
+     * buffer.  The segment memory is not copied and must remain valid until
+     * the CommBuf is destroyed (see add_holder()).  The total length in the
+     * header is increased by <code>len</code>.
+     * @param base Starting address of segment
+     * @param len Length of segment
+     */
+    void append_segment(const void *base, size_t len) {
+      struct iovec segment;
+      segment.iov_base = (void *)base;
+      segment.iov_len = len;
+      segments.push_back(segment);
+      header.set_total_length(header.total_len + len);
+    }
+
+    /** Adds an object to be kept alive for the lifetime of the CommBuf.
+     * This is used to pin memory referenced by segments.
+     * @param holder Object to hold
+     */
+    void add_holder(intrusive_ptr<ReferenceCount> holder) {
+      holders.push_back(holder);
+    }
+
+    /** Fills an iovec array with the unsent portions of the primary buffer,
+     * the extended buffer and the segments.
+     * @param vec iovec array to fill
+     * @param max Number of elements in <code>vec</code>
+     * @param lenp Address of variable to hold total length of filled
+     * entries
+     * @return Number of entries filled
+     */
+    int get_unsent(struct iovec *vec, int max, size_t *lenp) {
+      int count = 0;
+      size_t remaining = data.size - (data_ptr - data.base);
+      *lenp = 0;
+      if (remaining > 0 && count < max) {
+        vec[count].iov_base = (void *)data_ptr;
+        vec[count++].iov_len = remaining;
+        *lenp += remaining;
+      }
+      if (ext.base != 0) {
+        remaining = ext.size - (ext_ptr - ext.base);
+        if (remaining > 0 && count < max) {
+          vec[count].iov_base = (void *)ext_ptr;
+          vec[count++].iov_len = remaining;
+          *lenp += remaining;
+        }
+      }
+      for (size_t i=segment_index; i<segments.size() && count < max; i++) {
+        size_t offset = (i == segment_index) ? segment_offset : 0;
+        vec[count].iov_base = (uint8_t *)segments[i].iov_base + offset;
+        vec[count++].iov_len = segments[i].iov_len - offset;
+        *lenp += segments[i].iov_len - offset;
+      }
+      return count;
+    }
+
+    /** Advances the send position past <code>len</code> bytes of unsent
+     * data.  Empty segments at the new send position are skipped, so that
+     * all_sent() becomes true once the last byte has been sent.
+     * @param len Number of bytes sent
+     */
+    void advance_sent(size_t len) {
+      size_t remaining = data.size - (data_ptr - data.base);
+      size_t amount = std::min(len, remaining);
+      data_ptr += amount;
+      len -= amount;
+      if (len && ext.base != 0) {
+        amount = std::min(len, (size_t)(ext.size - (ext_ptr - ext.base)));
+        ext_ptr += amount;
+        len -= amount;
+      }
+      while (segment_index < segments.size()) {
+        amount = std::min(len, segments[segment_index].iov_len - segment_offset);
+        segment_offset += amount;
+        len -= amount;
+        if (segment_offset == segments[segment_index].iov_len) {
+          segment_index++;
+          segment_offset = 0;
+        }
+        else
+          break;
+      }
+    }
+
+    /** Checks if all data has been sent.
+     * @return <i>true</i> if there is no unsent data, <i>false</i> otherwise
+     */
+    bool all_sent() {
+      return data_ptr == data.base + data.size &&
+        (ext.base == 0 || ext_ptr == ext.base + ext.size) &&
+        segment_index == segments.size();
     }
 
     /** Returns the primary buffer internal data pointer
@@ -297,6 +402,18 @@ namespace Hypertable {
     /// Write pointer into #ext buffer
     const uint8_t *ext_ptr;
 
+    /// Scatter/gather segments sent after #ext
+    std::vector<struct iovec> segments;
+
+    /// Index of first unsent segment
+    size_t segment_index;
+
+    /// Number of bytes sent from segment at #segment_index
+    size_t segment_offset;
+
+    /// Objects keeping segment memory valid
+    std::vector<intrusive_ptr<ReferenceCount> > holders;
+
     /// Smart pointer to extended buffer memory
     boost::shared_array<uint8_t> ext_shared_array;
   };
@@ -27,6 +27,7 @@
 
 #include "Common/Compat.h"
 
+#include <algorithm>
 #include <cassert>
 #include <iostream>
 
@@ -56,6 +57,10 @@ using namespace std;
 
 namespace {
 
+  /// Maximum number of buffers passed to a single writev call
+  const int MAX_SEND_IOVECS = 64;
+
+#if defined(__sun__)
   /**
    * Used to read data off a socket that is monotored with edge-triggered epoll.
    * When this function returns with *errnop set to EAGAIN, it is safe to call
@@ -90,6 +95,7 @@ namespace {
     }
     return n - nleft;
   }
+#endif
 
   ssize_t
   et_socket_writev(int fd, const iovec *vector, int count, int *errnop) {
@@ -110,7 +116,6 @@ namespace {
 
 bool
 IOHandlerData::handle_event(struct pollfd *event, time_t arrival_time) {
-  int error = 0;
   bool eof = false;
 
   //DisplayEvent(event);
@@ -124,59 +129,9 @@ IOHandlerData::handle_event(struct pollfd *event, time_t arrival_time) {
     }
 
     if (event->revents & POLLIN) {
-      size_t nread;
-      while (true) {
-        if (!m_got_header) {
-          nread = et_socket_read(m_sd, m_message_header_ptr,
-                                 m_message_header_remaining, &error, &eof);
-          if (nread == (size_t)-1) {
-            if (errno != ECONNREFUSED) {
-              HT_INFOF("socket read(%d, len=%d) failure : %s", m_sd,
-                        (int)m_message_header_remaining, strerror(errno));
-            }
-            else
-              test_and_set_error(Error::COMM_CONNECT_ERROR);
-
-            handle_disconnect();
-            return true;
-          }
-          else if (nread < m_message_header_remaining) {
-            m_message_header_remaining -= nread;
-            m_message_header_ptr += nread;
-            if (error == EAGAIN)
-              break;
-            error = 0;
-          }
-          else {
-            m_message_header_ptr += nread;
-            handle_message_header(arrival_time);
-          }
-
-          if (eof)
-            break;
-        }
-        else { // got header
-          nread = et_socket_read(m_sd, m_message_ptr, m_message_remaining,
-                                 &error, &eof);
-          if (nread == (size_t)-1) {
-            HT_INFOF("socket read(%d, len=%d) failure : %s", m_sd,
-                      (int)m_message_header_remaining, strerror(errno));
-            handle_disconnect();
-            return true;
-          }
-          else if (nread < m_message_remaining) {
-            m_message_ptr += nread;
-            m_message_remaining -= nread;
-            if (error == EAGAIN)
-              break;
-            error = 0;
-          }
-          else
-            handle_message_body();
-
-          if (eof)
-            break;
-        }
+      if (handle_read_readiness(arrival_time, &eof)) {
+        handle_disconnect();
+        return true;
       }
     }
 
@@ -217,7 +172,6 @@ IOHandlerData::handle_event(struct pollfd *event, time_t arrival_time) {
 
 bool
 IOHandlerData::handle_event(struct epoll_event *event, time_t arrival_time) {
-  int error = 0;
   bool eof = false;
 
   //DisplayEvent(event);
@@ -231,59 +185,9 @@ IOHandlerData::handle_event(struct epoll_event *event, time_t arrival_time) {
     }
 
     if (event->events & EPOLLIN) {
-      size_t nread;
-      while (true) {
-        if (!m_got_header) {
-          nread = et_socket_read(m_sd, m_message_header_ptr,
-                                 m_message_header_remaining, &error, &eof);
-          if (nread == (size_t)-1) {
-            if (errno != ECONNREFUSED) {
-              HT_INFOF("socket read(%d, len=%d) failure : %s", m_sd,
-                       (int)m_message_header_remaining, strerror(errno));
-            }
-            else
-              test_and_set_error(Error::COMM_CONNECT_ERROR);
-
-            handle_disconnect();
-            return true;
-          }
-          else if (nread < m_message_header_remaining) {
-            m_message_header_remaining -= nread;
-            m_message_header_ptr += nread;
-            if (error == EAGAIN)
-              break;
-            error = 0;
-          }
-          else {
-            m_message_header_ptr += nread;
-            handle_message_header(arrival_time);
-          }
-
-          if (eof)
-            break;
-        }
-        else { // got header
-          nread = et_socket_read(m_sd, m_message_ptr, m_message_remaining,
-                                 &error, &eof);
-          if (nread == (size_t)-1) {
-            HT_INFOF("socket read(%d, len=%d) failure : %s", m_sd,
-                     (int)m_message_header_remaining, strerror(errno));
-            handle_disconnect();
-            return true;
-          }
-          else if (nread < m_message_remaining) {
-            m_message_ptr += nread;
-            m_message_remaining -= nread;
-            if (error == EAGAIN)
-              break;
-            error = 0;
-          }
-          else
-            handle_message_body();
-
-          if (eof)
-            break;
-        }
+      if (handle_read_readiness(arrival_time, &eof)) {
+        handle_disconnect();
+        return true;
       }
     }
 
@@ -543,6 +447,89 @@ bool IOHandlerData::handle_event(struct kevent *event, time_t arrival_time) {
 #endif
 
 
+bool IOHandlerData::handle_read_readiness(time_t arrival_time, bool *eofp) {
+  ssize_t nread;
+  uint8_t *dst;
+  size_t len;
+
+  while (true) {
+
+    if (m_got_header && m_message_remaining >= READ_BUFFER_SIZE) {
+      dst = m_message_ptr;
+      len = m_message_remaining;
+    }
+    else {
+      if (m_read_buffer == 0)
+        m_read_buffer = new uint8_t [READ_BUFFER_SIZE];
+      dst = m_read_buffer;
+      len = READ_BUFFER_SIZE;
+    }
+
+    if ((nread = ::read(m_sd, dst, len)) < 0) {
+      if (errno == EINTR)
+        continue;
+      if (errno == EAGAIN)
+        return false;
+      if (errno != ECONNREFUSED)
+        HT_INFOF("socket read(%d, len=%d) failure : %s", m_sd, (int)len,
+                 strerror(errno));
+      else
+        test_and_set_error(Error::COMM_CONNECT_ERROR);
+      return true;
+    }
+    else if (nread == 0) {
+      *eofp = true;
+      return false;
+    }
+
+    if (dst == m_read_buffer)
+      handle_message_data(m_read_buffer, nread, arrival_time);
+    else {
+      m_message_ptr += nread;
+      m_message_remaining -= nread;
+      if (m_message_remaining == 0)
+        handle_message_body();
+    }
+
+    // A short read means the socket receive buffer has been drained
+    if ((size_t)nread < len)
+      return false;
+  }
+}
+
+
+void IOHandlerData::handle_message_data(const uint8_t *data, size_t len,
+                                        time_t arrival_time) {
+  size_t n;
+
+  while (true) {
+    if (!m_got_header) {
+      if (len == 0)
+        return;
+      n = std::min(len, m_message_header_remaining);
+      memcpy(m_message_header_ptr, data, n);
+      m_message_header_ptr += n;
+      m_message_header_remaining -= n;
+      data += n;
+      len -= n;
+      if (m_message_header_remaining == 0)
+        handle_message_header(arrival_time);
+    }
+    else {
+      n = std::min(len, m_message_remaining);
+      memcpy(m_message_ptr, data, n);
+      m_message_ptr += n;
+      m_message_remaining -= n;
+      data += n;
+      len -= n;
+      if (m_message_remaining > 0)
+        return;
+      handle_message_body();
+    }
+  }
+}
+
+
 void IOHandlerData::handle_message_header(time_t arrival_time) {
   size_t header_len = (size_t)m_message_header[1];
 
@@ -755,8 +742,9 @@ IOHandlerData::send_message(CommBufPtr &cbp, uint32_t timeout_ms,
 #if defined(__linux__)
 
 int IOHandlerData::flush_send_queue() {
-  ssize_t nwritten, towrite, remaining;
-  struct iovec vec[2];
+  ssize_t nwritten;
+  size_t towrite;
+  struct iovec vec[MAX_SEND_IOVECS];
   int count;
   int error = 0;
 
@@ -764,65 +752,38 @@ int IOHandlerData::flush_send_queue() {
 
     CommBufPtr &cbp = m_send_queue.front();
 
-    count = 0;
-    towrite = 0;
-    remaining = cbp->data.size - (cbp->data_ptr - cbp->data.base);
-    if (remaining > 0) {
-      vec[0].iov_base = (void *)cbp->data_ptr;
-      vec[0].iov_len = remaining;
-      towrite = remaining;
-      ++count;
-    }
-    if (cbp->ext.base != 0) {
-      remaining = cbp->ext.size - (cbp->ext_ptr - cbp->ext.base);
-      if (remaining > 0) {
-        vec[count].iov_base = (void *)cbp->ext_ptr;
-        vec[count].iov_len = remaining;
-        towrite += remaining;
-        ++count;
-      }
-    }
+    count = cbp->get_unsent(vec, MAX_SEND_IOVECS, &towrite);
 
-    nwritten = et_socket_writev(m_sd, vec, count, &error);
-    if (nwritten == (ssize_t)-1) {
-      if (error == EAGAIN)
-        return Error::OK;
-      HT_WARNF("FileUtils::writev(%d, len=%d) failed : %s", m_sd, (int)towrite,
-               strerror(errno));
-      return Error::COMM_BROKEN_CONNECTION;
-    }
-    else if (nwritten < towrite) {
-      if (nwritten == 0) {
+    if (count > 0) {
+      nwritten = et_socket_writev(m_sd, vec, count, &error);
+      if (nwritten == (ssize_t)-1) {
         if (error == EAGAIN)
-          break;
-        if (error) {
-          HT_WARNF("FileUtils::writev(%d, len=%d) failed : %s", m_sd,
-                   (int)towrite, strerror(error));
-          return Error::COMM_BROKEN_CONNECTION;
-        }
-        continue;
+          return Error::OK;
+        HT_WARNF("FileUtils::writev(%d, len=%d) failed : %s", m_sd,
+                 (int)towrite, strerror(errno));
+        return Error::COMM_BROKEN_CONNECTION;
       }
-      remaining = cbp->data.size - (cbp->data_ptr - cbp->data.base);
-      if (remaining > 0) {
-        if (nwritten < remaining) {
-          cbp->data_ptr += nwritten;
+      else if ((size_t)nwritten < towrite) {
+        if (nwritten == 0) {
           if (error == EAGAIN)
             break;
-          error = 0;
+          if (error) {
+            HT_WARNF("FileUtils::writev(%d, len=%d) failed : %s", m_sd,
+                     (int)towrite, strerror(error));
+            return Error::COMM_BROKEN_CONNECTION;
+          }
           continue;
         }
-        else {
-          nwritten -= remaining;
-          cbp->data_ptr += remaining;
-        }
-      }
-      if (cbp->ext.base != 0) {
-        cbp->ext_ptr += nwritten;
+        cbp->advance_sent(nwritten);
         if (error == EAGAIN)
           break;
         error = 0;
         continue;
       }
+      cbp->advance_sent(nwritten);
+      // more segments remain than fit in one writev
+      if (!cbp->all_sent())
+        continue;
     }
 
     // buffer written successfully, now remove from queue (destroys buffer)
@@ -835,57 +796,34 @@ int IOHandlerData::flush_send_queue() {
 #elif defined(__APPLE__) || defined (__sun__) || defined(__FreeBSD__)
 
 int IOHandlerData::flush_send_queue() {
-  ssize_t nwritten, towrite, remaining;
-  struct iovec vec[2];
+  ssize_t nwritten;
+  size_t towrite;
+  struct iovec vec[MAX_SEND_IOVECS];
   int count;
 
   while (!m_send_queue.empty()) {
 
     CommBufPtr &cbp = m_send_queue.front();
 
-    count = 0;
-    towrite = 0;
-    remaining = cbp->data.size - (cbp->data_ptr - cbp->data.base);
-    if (remaining > 0) {
-      vec[0].iov_base = (void *)cbp->data_ptr;
-      vec[0].iov_len = remaining;
-      towrite = remaining;
-      ++count;
-    }
-    if (cbp->ext.base != 0) {
-      remaining = cbp->ext.size - (cbp->ext_ptr - cbp->ext.base);
-      if (remaining > 0) {
-        vec[count].iov_base = (void *)cbp->ext_ptr;
-        vec[count].iov_len = remaining;
-        towrite += remaining;
-        ++count;
-      }
-    }
+    count = cbp->get_unsent(vec, MAX_SEND_IOVECS, &towrite);
 
-    nwritten = FileUtils::writev(m_sd, vec, count);
-    if (nwritten == (ssize_t)-1) {
-      HT_WARNF("FileUtils::writev(%d, len=%d) failed : %s", m_sd, (int)towrite,
-               strerror(errno));
-      return Error::COMM_BROKEN_CONNECTION;
-    }
-    else if (nwritten < towrite) {
-      if (nwritten == 0)
-        break;
-      remaining = cbp->data.size - (cbp->data_ptr - cbp->data.base);
-      if (remaining > 0) {
-        if (nwritten < remaining) {
-          cbp->data_ptr += nwritten;
-          break;
-        }
-        else {
-          nwritten -= remaining;
-          cbp->data_ptr += remaining;
-        }
+    if (count > 0) {
+      nwritten = FileUtils::writev(m_sd, vec, count);
+      if (nwritten == (ssize_t)-1) {
+        HT_WARNF("FileUtils::writev(%d, len=%d) failed : %s", m_sd,
+                 (int)towrite, strerror(errno));
+        return Error::COMM_BROKEN_CONNECTION;
       }
-      if (cbp->ext.base != 0) {
-        cbp->ext_ptr += nwritten;
+      else if ((size_t)nwritten < towrite) {
+        if (nwritten == 0)
+          break;
+        cbp->advance_sent(nwritten);
         break;
       }
+      cbp->advance_sent(nwritten);
+      // more segments remain than fit in one writev
+      if (!cbp->all_sent())
+        continue;
     }
 
     // buffer written successfully, now remove from queue (destroys buffer)
@@ -63,7 +63,7 @@ namespace Hypertable {
     IOHandlerData(int sd, const InetAddr &addr,
                   DispatchHandlerPtr &dhp, bool connected=false)
       : IOHandler(sd, dhp), m_message_aligned(false), m_event(0),
-      m_send_queue() {
+      m_send_queue(), m_read_buffer(0) {
       memcpy(&m_addr, &addr, sizeof(InetAddr));
       m_connected = connected;
       reset_incoming_message_state();
@@ -72,6 +72,7 @@ namespace Hypertable {
     /** Destructor */
     virtual ~IOHandlerData() {
       delete m_event;
+      delete [] m_read_buffer;
     }
 
     /** Disconnects handler by delivering Event::DISCONNECT via default dispatch
@@ -262,8 +263,35 @@ namespace Hypertable {
      */
     bool handle_write_readiness();
 
+    /// Size of the receive buffer (#m_read_buffer)
+    static const size_t READ_BUFFER_SIZE = 16384;
+
   private:
 
+    /** Reads available data off the socket and processes the messages it
+     * contains.  Data is read in chunks of up to READ_BUFFER_SIZE bytes
+     * into #m_read_buffer, so a burst of small messages costs a single
+     * <code>read()</code> instead of two or three per message.  Payload
+     * that is at least READ_BUFFER_SIZE bytes long is read directly into
+     * the message buffer.  Reading stops at EAGAIN, end-of-file, or when a
+     * read comes back short (meaning the socket receive buffer has been
+     * drained).
+     * @param arrival_time Arrival time of data
+     * @param eofp Set to <i>true</i> if end-of-file was encountered
+     * @return <i>true</i> if a read error occurred, <i>false</i> otherwise
+     */
+    bool handle_read_readiness(time_t arrival_time, bool *eofp);
+
+    /** Processes received data.  Copies <code>data</code> into the message
+     * header and payload buffers, calling #handle_message_header and
+     * #handle_message_body as each one is completed.
+     * @param data Pointer to received data
+     * @param len Length of received data
+     * @param arrival_time Arrival time of data
+     */
+    void handle_message_data(const uint8_t *data, size_t len,
+                             time_t arrival_time);
+
     /** Processes a message header.  This method is called when the fixed
      * length portion of a header has been completely received.  It first
      * checks to see if there is a variable portion of the header that has
@@ -327,6 +355,9 @@ namespace Hypertable {
 
     /// Send queue
     std::list<CommBufPtr> m_send_queue;
+
+    /// Receive buffer (allocated on first read)
+    uint8_t *m_read_buffer;
   };
   /** @}*/
 }
@@ -45,6 +45,9 @@ extern "C" {
 #if defined(__APPLE__) || defined(__FreeBSD__)
 #include <sys/event.h>
 #endif
+#if defined(__linux__)
+#include <sys/eventfd.h>
+#endif
 }
 
 #include "Common/Error.h"
@@ -63,7 +66,8 @@ using namespace std;
 /**
  *
  */
-Reactor::Reactor() : m_interrupt_in_progress(false) {
+Reactor::Reactor() : m_interrupt_sd(-1), m_interrupt_efd(-1),
+                     m_interrupt_in_progress(false) {
   struct sockaddr_in addr;
 
   if (!ReactorFactory::use_poll) {
@@ -82,6 +86,30 @@ Reactor::Reactor() : m_interrupt_in_progress(false) {
 #endif
   }
 
+#if defined(__linux__)
+  /**
+   * With epoll, a (level triggered) eventfd is used to interrupt
+   * epoll_wait, which takes one write() per interrupt instead of a
+   * send()/recv() pair on a socket
+   */
+  if (!ReactorFactory::use_poll) {
+    if ((m_interrupt_efd = eventfd(0, EFD_NONBLOCK)) >= 0) {
+      struct epoll_event event;
+      memset(&event, 0, sizeof(struct epoll_event));
+      event.events = EPOLLIN;
+      if (epoll_ctl(poll_fd, EPOLL_CTL_ADD, m_interrupt_efd, &event) < 0) {
+        HT_ERRORF("epoll_ctl(%d, EPOLL_CTL_ADD, %d, EPOLLIN) failed : %s",
+                  poll_fd, m_interrupt_efd, strerror(errno));
+        exit(1);
+      }
+      memset(&m_next_wakeup, 0, sizeof(m_next_wakeup));
+      return;
+    }
+    HT_INFOF("eventfd() failed, falling back to interrupt socket - %s",
+             strerror(errno));
+  }
+#endif
+
   while (true) {
 
     /**
@@ -275,7 +303,16 @@ int Reactor::poll_loop_interrupt() {
 
 #if defined(__linux__)
 
-  if (ReactorFactory::ms_epollet) {
+  if (m_interrupt_efd >= 0) {
+    uint64_t value = 1;
+    // EAGAIN means the counter is saturated, i.e. an interrupt is pending
+    if (::write(m_interrupt_efd, &value, sizeof(value)) < 0 &&
+        errno != EAGAIN) {
+      HT_ERRORF("write(interrupt_efd) failed - %s", strerror(errno));
+      return Error::COMM_SEND_ERROR;
+    }
+  }
+  else if (ReactorFactory::ms_epollet) {
 
     char buf[4];
     ssize_t n;
@@ -343,7 +380,7 @@ int Reactor::poll_loop_continue() {
 
 #if defined(__linux__)
 
-  if (!ReactorFactory::ms_epollet) {
+  if (m_interrupt_efd < 0 && !ReactorFactory::ms_epollet) {
     struct epoll_event event;
     char buf[8];
 
@@ -386,6 +423,16 @@ int Reactor::poll_loop_continue() {
 }
 
 
+void Reactor::drain_interrupt_efd() {
+#if defined(__linux__)
+  uint64_t value;
+  if (m_interrupt_efd >= 0 &&
+      ::read(m_interrupt_efd, &value, sizeof(value)) < 0 && errno != EAGAIN)
+    HT_ERRORF("read(interrupt_efd) failed - %s", strerror(errno));
+#endif
+}
+
+
 int Reactor::add_poll_interest(int sd, short events, IOHandler *handler) {
   ScopedLock lock(m_polldata_mutex);
   int error;
@@ -81,10 +81,13 @@ namespace Hypertable {
      * If ReactorFactory::use_poll is set to <i>true</i>, then the reactor will
      * use the POSIX <code>poll()</code> interface, otherwise <code>epoll</code>
      * is used on Linux, <code>kqueue</code> on OSX and FreeBSD, and
-     * <code>port_associate</code> on Solaris.  For polling mechanisms that
-     * do not provide an interface for breaking out of the poll wait, a UDP
-     * socket #m_interrupt_sd is created (and connected to itself) and
-     * added to the poll set.
+     * <code>port_associate</code> on Solaris.  With <code>epoll</code>, an
+     * <code>eventfd</code> (#m_interrupt_efd) is added to the poll set and
+     * written to break out of the poll wait.  For other polling mechanisms
+     * that do not provide an interface for breaking out of the poll wait,
+     * or if <code>eventfd()</code> is not available, a UDP socket
+     * #m_interrupt_sd is created (and connected to itself) and added to the
+     * poll set.
      */
     Reactor();
 
@@ -264,6 +267,13 @@ namespace Hypertable {
      */
     int interrupt_sd() { return m_interrupt_sd; }
 
+    /** Consumes pending interrupt notifications (<code>eventfd</code> only).
+     * The <code>eventfd</code> is registered level triggered, so this
+     * method must be called by the ReactorRunner whenever the poll wait
+     * reports it readable.
+     */
+    void drain_interrupt_efd();
+
   protected:
 
     /** Priority queue for timers.
@@ -276,6 +286,7 @@ namespace Hypertable {
     RequestCache m_request_cache; //!< Request cache
     TimerHeap m_timer_heap;       //!< ExpireTimer heap
     int m_interrupt_sd;           //!< Interrupt socket
+    int m_interrupt_efd;          //!< Interrupt eventfd (-1 if not used)
 
     /// Set to <i>true</i> if poll loop interrupt in progress
     bool m_interrupt_in_progress;
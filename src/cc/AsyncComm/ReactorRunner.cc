@@ -153,7 +153,11 @@ void ReactorRunner::operator()() {
       HT_DEBUGF("epoll_wait returned %d events", n);
     for (int i=0; i<n; i++) {
       handler = (IOHandler *)events[i].data.ptr;
-      if (handler && removed_handlers.count(handler) == 0) {
+      if (handler == 0) {
+        m_reactor->drain_interrupt_efd();
+        continue;
+      }
+      if (removed_handlers.count(handler) == 0) {
         // dispatch delay for testing
         if (dispatch_delay && !did_delay && (events[i].events & EPOLLIN)) {
           poll(0, 0, (int)dispatch_delay);
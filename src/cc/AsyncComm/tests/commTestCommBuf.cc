@@ -0,0 +1,162 @@
+/**
+ * Copyright (C) 2007-2013 Hypertable, Inc.
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+#include "Common/Compat.h"
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+extern "C" {
+#include <sys/uio.h>
+}
+
+#include "Common/Logger.h"
+#include "Common/StaticBuffer.h"
+
+#include "AsyncComm/CommBuf.h"
+
+using namespace std;
+using namespace Hypertable;
+
+namespace {
+
+  /// Number of segments, more than IOHandlerData passes to one writev
+  const size_t SEGMENTS = 100;
+
+  /// Maximum number of iovecs per simulated write
+  const int MAX_IOVECS = 64;
+
+  /** Builds a CommBuf with a primary buffer, an extended buffer and
+   * segments of varying length (including empty ones), followed by
+   * <code>trailing_empty</code> empty segments, and returns the bytes it is
+   * expected to send.
+   */
+  CommBuf *create_buffer(string &segment_data, string &expected,
+                         size_t segments=SEGMENTS, size_t trailing_empty=0) {
+    CommHeader header(42);
+    StaticBuffer ext(300);
+
+    for (size_t i=0; i<ext.size; i++)
+      ext.base[i] = 'e';
+    CommBuf *cbuf = new CommBuf(header, 8, ext);
+    cbuf->append_i32(1234);
+    cbuf->append_i32(5678);
+
+    segment_data.clear();
+    for (size_t i=0; i<segments; i++)
+      segment_data.append(i % 7, (char)('a' + i % 26));
+    const char *ptr = segment_data.data();
+    for (size_t i=0; i<segments; i++) {
+      cbuf->append_segment(ptr, i % 7);
+      ptr += i % 7;
+    }
+    for (size_t i=0; i<trailing_empty; i++)
+      cbuf->append_segment(ptr, 0);
+    cbuf->write_header_and_reset();
+
+    expected.assign((const char *)cbuf->data.base, cbuf->data.size);
+    expected.append((const char *)cbuf->ext.base, cbuf->ext.size);
+    expected.append(segment_data);
+    HT_ASSERT(cbuf->header.total_len == expected.size());
+    return cbuf;
+  }
+
+  /** Sends the buffer the way IOHandlerData::flush_send_queue() does,
+   * accepting at most <code>limit</code> bytes per write (0 picks a random
+   * amount), and returns what was written.
+   */
+  string send(CommBuf *cbuf, size_t limit) {
+    struct iovec vec[MAX_IOVECS];
+    size_t towrite;
+    string output;
+
+    while (!cbuf->all_sent()) {
+      int count = cbuf->get_unsent(vec, MAX_IOVECS, &towrite);
+      HT_ASSERT(count > 0 && count <= MAX_IOVECS);
+      // Unsent data must remain while all_sent() is false, otherwise
+      // the writer would spin without making progress
+      HT_ASSERT(towrite > 0);
+      size_t amount = limit ? limit : 1 + random() % 97;
+      amount = std::min(amount, towrite);
+      size_t written = 0;
+      for (int i=0; i<count && written < amount; i++) {
+        size_t len = std::min(vec[i].iov_len, amount - written);
+        output.append((const char *)vec[i].iov_base, len);
+        written += len;
+      }
+      cbuf->advance_sent(written);
+    }
+    return output;
+  }
+
+}
+
+int main(int argc, char **argv) {
+  string segment_data, expected;
+  size_t limits[] = { 1, 2, 3, 13, 64, 300, 1000000, 0 };
+
+  srandom(4321);
+
+  // Partial writes that stop anywhere inside the primary buffer, the
+  // extended buffer or a segment resume at the right byte
+  for (size_t i=0; i<sizeof(limits)/sizeof(size_t); i++) {
+    CommBuf *cbuf = create_buffer(segment_data, expected);
+    string output = send(cbuf, limits[i]);
+    if (output != expected) {
+      HT_ERRORF("Output mismatch with write limit %u", (unsigned)limits[i]);
+      return 1;
+    }
+    delete cbuf;
+  }
+
+  // Random partial writes
+  for (size_t i=0; i<100; i++) {
+    CommBuf *cbuf = create_buffer(segment_data, expected);
+    HT_ASSERT(send(cbuf, 0) == expected);
+    delete cbuf;
+  }
+
+  // Empty segments at the end, or no segment with any data, do not keep
+  // the buffer from being completely sent
+  for (size_t i=0; i<sizeof(limits)/sizeof(size_t); i++) {
+    CommBuf *cbuf = create_buffer(segment_data, expected, 13, 3);
+    HT_ASSERT(send(cbuf, limits[i]) == expected);
+    HT_ASSERT(cbuf->all_sent());
+    delete cbuf;
+    cbuf = create_buffer(segment_data, expected, 1, 2);
+    HT_ASSERT(segment_data.empty());
+    HT_ASSERT(send(cbuf, limits[i]) == expected);
+    HT_ASSERT(cbuf->all_sent());
+    delete cbuf;
+  }
+
+  // Resetting the buffer rewinds all send positions
+  {
+    CommBuf *cbuf = create_buffer(segment_data, expected);
+    send(cbuf, 0);
+    cbuf->write_header_and_reset();
+    HT_ASSERT(!cbuf->all_sent());
+    HT_ASSERT(send(cbuf, 5) == expected);
+    delete cbuf;
+  }
+
+  return 0;
+}
@@ -0,0 +1,303 @@
+/**
+ * Copyright (C) 2007-2013 Hypertable, Inc.
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+#include "Common/Compat.h"
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+extern "C" {
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/types.h>
+#include <unistd.h>
+}
+
+#include <boost/thread/condition.hpp>
+#include <boost/thread/xtime.hpp>
+
+#include "Common/Init.h"
+#include "Common/Error.h"
+#include "Common/InetAddr.h"
+#include "Common/Logger.h"
+#include "Common/Mutex.h"
+#include "Common/Time.h"
+
+#include "AsyncComm/Comm.h"
+#include "AsyncComm/CommHeader.h"
+#include "AsyncComm/ConnectionHandlerFactory.h"
+#include "AsyncComm/DispatchHandler.h"
+#include "AsyncComm/Event.h"
+#include "AsyncComm/ReactorFactory.h"
+
+using namespace Hypertable;
+using namespace std;
+
+/**
+ * Writes hand-encoded request messages to a raw socket connected to an
+ * AsyncComm listener, in chunks of various sizes, and checks that every
+ * message is delivered intact and in order.  This exercises both read paths
+ * of IOHandlerData: buffered reads that may hold several messages or only
+ * part of a header, and direct reads into the message buffer for payloads of
+ * at least IOHandlerData::READ_BUFFER_SIZE bytes.
+ */
+
+namespace {
+
+  const int DEFAULT_PORT = 32997;
+
+  struct Message {
+    Message(uint64_t cmd, size_t hlen, size_t plen)
+      : command(cmd), header_len(hlen), payload_len(plen) { }
+    uint64_t command;
+    size_t header_len;
+    size_t payload_len;
+  };
+
+  uint8_t payload_byte(uint64_t command, size_t i) {
+    return (uint8_t)((command * 31 + i) % 251);
+  }
+
+  /** Appends the wire encoding of a request message.  Header bytes beyond
+   * CommHeader::FIXED_LENGTH are filled with padding.
+   */
+  void encode_message(const Message &msg, std::string &stream) {
+    CommHeader header(msg.command);
+    uint8_t buf[256];
+    uint8_t *ptr = buf;
+
+    header.flags |= CommHeader::FLAGS_BIT_REQUEST;
+    header.header_len = msg.header_len;
+    header.total_len = msg.header_len + msg.payload_len;
+    header.encode(&ptr);
+    memset(ptr, 0xee, msg.header_len - CommHeader::FIXED_LENGTH);
+    stream.append((const char *)buf, msg.header_len);
+    for (size_t i=0; i<msg.payload_len; i++)
+      stream.append(1, (char)payload_byte(msg.command, i));
+  }
+
+  /** Records the messages received on the server side of the connection.
+   */
+  class Collector : public DispatchHandler {
+  public:
+    Collector() : m_corrupt(false), m_checked(0) { }
+
+    virtual void handle(EventPtr &event) {
+      ScopedLock lock(m_mutex);
+      if (event->type == Event::MESSAGE) {
+        Message msg(event->header.command, event->header.header_len,
+                    event->payload_len);
+        m_received.push_back(msg);
+        HT_ASSERT(event->payload_len == 0 || event->payload);
+        for (size_t i=0; i<event->payload_len; i++) {
+          if (event->payload[i] != payload_byte(msg.command, i)) {
+            HT_ERRORF("Payload of message %llu differs at offset %d",
+                      (Llu)msg.command, (int)i);
+            m_corrupt = true;
+            break;
+          }
+        }
+      }
+      else
+        HT_INFOF("%s", event->to_str().c_str());
+      m_cond.notify_all();
+    }
+
+    /** Waits up to 30 seconds for <code>count</code> messages in total and
+     * checks the ones received since the previous call.
+     */
+    void check(const std::vector<Message> &sent, size_t count) {
+      ScopedLock lock(m_mutex);
+      boost::xtime deadline;
+      boost::xtime_get(&deadline, boost::TIME_UTC_);
+      xtime_add_millis(deadline, 30000);
+      while (m_received.size() < count) {
+        if (!m_cond.timed_wait(lock, deadline)) {
+          HT_ERRORF("Received %d of %d messages", (int)m_received.size(),
+                    (int)count);
+          HT_ASSERT(!"timed out waiting for messages");
+        }
+      }
+      HT_ASSERT(!m_corrupt);
+      HT_ASSERT(m_received.size() == count);
+      for (size_t i=m_checked; i<count; i++) {
+        HT_ASSERT(m_received[i].command == sent[i].command);
+        HT_ASSERT(m_received[i].header_len == sent[i].header_len);
+        HT_ASSERT(m_received[i].payload_len == sent[i].payload_len);
+      }
+      m_checked = count;
+    }
+
+  private:
+    Mutex m_mutex;
+    boost::condition m_cond;
+    bool m_corrupt;
+    std::vector<Message> m_received;
+    size_t m_checked;
+  };
+
+  class HandlerFactory : public ConnectionHandlerFactory {
+  public:
+    HandlerFactory(DispatchHandlerPtr &dhp) : m_dispatch_handler(dhp) { }
+    virtual void get_instance(DispatchHandlerPtr &dhp) {
+      dhp = m_dispatch_handler;
+    }
+  private:
+    DispatchHandlerPtr m_dispatch_handler;
+  };
+
+  /** Writes <code>stream</code> to <code>sd</code> in chunks of at most
+   * <code>max_chunk</code> bytes (random sizes if <code>randomize</code> is
+   * set), pausing <code>pause_ms</code> milliseconds after each one so that
+   * the chunks are seen by separate reads.
+   */
+  void send_stream(int sd, const std::string &stream, size_t max_chunk,
+                   bool randomize, int pause_ms) {
+    size_t offset = 0;
+    while (offset < stream.length()) {
+      size_t len = randomize ? 1 + (random() % max_chunk) : max_chunk;
+      len = std::min(len, stream.length() - offset);
+      while (len > 0) {
+        ssize_t nwritten = ::write(sd, stream.data() + offset, len);
+        if (nwritten < 0) {
+          HT_ASSERT(errno == EINTR);
+          continue;
+        }
+        offset += nwritten;
+        len -= nwritten;
+      }
+      if (pause_ms)
+        poll(0, 0, pause_ms);
+    }
+  }
+
+  void add(std::vector<Message> &sent, std::string &stream, size_t header_len,
+           size_t payload_len) {
+    sent.push_back(Message(sent.size() + 1, header_len, payload_len));
+    encode_message(sent.back(), stream);
+  }
+
+}
+
+
+int main(int argc, char **argv) {
+  struct sockaddr_in addr;
+  Collector *collector = new Collector();
+  DispatchHandlerPtr dhp(collector);
+  ConnectionHandlerFactoryPtr chfp(new HandlerFactory(dhp));
+  std::vector<Message> sent;
+  std::string stream;
+  const size_t FIXED = CommHeader::FIXED_LENGTH;
+
+  Config::init(0, 0);
+
+  srandom(8876);
+
+  ReactorFactory::initialize(1);
+
+  InetAddr::initialize(&addr, "localhost", DEFAULT_PORT);
+
+  Comm *comm = Comm::instance();
+
+  try {
+    comm->listen(CommAddress(addr), chfp);
+  }
+  catch (Exception &e) {
+    HT_ERROR_OUT << e << HT_END;
+    return 1;
+  }
+
+  int sd = socket(AF_INET, SOCK_STREAM, 0);
+  HT_ASSERT(sd >= 0);
+  int one = 1;
+  setsockopt(sd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+  if (::connect(sd, (struct sockaddr *)&addr, sizeof(addr)) < 0) {
+    HT_ERRORF("connect() failure : %s", strerror(errno));
+    return 1;
+  }
+
+  // Many small messages, including empty ones, arriving in one read
+  for (size_t i=0; i<200; i++)
+    add(sent, stream, FIXED, (i % 10) == 0 ? 0 : (i * 37) % 300);
+  send_stream(sd, stream, stream.length(), false, 0);
+  collector->check(sent, sent.size());
+
+  // Messages split across reads at arbitrary points, in the middle of the
+  // header as well as the payload
+  stream.clear();
+  for (size_t i=0; i<60; i++)
+    add(sent, stream, FIXED, (i % 7) == 0 ? 0 : (i * 53) % 400);
+  send_stream(sd, stream, 40, true, 1);
+  collector->check(sent, sent.size());
+
+  // One byte per read
+  stream.clear();
+  add(sent, stream, FIXED, 5);
+  add(sent, stream, FIXED, 0);
+  add(sent, stream, FIXED + 10, 3);
+  send_stream(sd, stream, 1, false, 1);
+  collector->check(sent, sent.size());
+
+  // Variable length header, with the fixed portion, the rest of the header
+  // and the payload arriving separately, followed by an empty message with
+  // a variable length header and an ordinary one in the same read
+  stream.clear();
+  add(sent, stream, FIXED + 10, 100);
+  send_stream(sd, stream.substr(0, FIXED), FIXED, false, 20);
+  send_stream(sd, stream.substr(FIXED, 4), 4, false, 20);
+  send_stream(sd, stream.substr(FIXED + 4), stream.length(), false, 20);
+  stream.clear();
+  add(sent, stream, FIXED + 26, 0);
+  add(sent, stream, FIXED, 10);
+  send_stream(sd, stream, stream.length(), false, 0);
+  collector->check(sent, sent.size());
+
+  // Payloads at and above the direct read threshold.  The header and the
+  // start of the payload arrive in one read and the rest is read directly
+  // into the message buffer; small messages queued behind a large one are
+  // picked up by buffered reads again.
+  size_t large[] = { 16383, 16384, 16385, 100000, 1048576, 3000000 };
+  for (size_t i=0; i<sizeof(large)/sizeof(size_t); i++) {
+    stream.clear();
+    add(sent, stream, (i % 2) ? FIXED : FIXED + 8, large[i]);
+    add(sent, stream, FIXED, 0);
+    add(sent, stream, FIXED, 17);
+    send_stream(sd, stream.substr(0, FIXED + 100), FIXED + 100, false, 20);
+    send_stream(sd, stream.substr(FIXED + 100), 65536, false, 0);
+    collector->check(sent, sent.size());
+  }
+
+  // Several large messages back to back, written in random sized chunks
+  stream.clear();
+  for (size_t i=0; i<20; i++)
+    add(sent, stream, FIXED, (i % 3) ? 20000 + i * 4099 : i);
+  send_stream(sd, stream, 50000, true, 1);
+  collector->check(sent, sent.size());
+
+  ::close(sd);
+
+  ReactorFactory::destroy();
+
+  return 0;
+}
@@ -49,6 +49,17 @@ namespace Hypertable {
 /**
  * A space-efficent probabilistic set for membership test, false postives
  * are possible, but false negatives are not.
+ *
+ * The filter can be built in <i>blocked</i> layout.  In this layout the bit
+ * array is divided into 64-byte (cache line sized) blocks; an item is mapped
+ * to a single block and all of its bits are set within that block, so a
+ * lookup touches one cache line instead of one per hash function.  The bit
+ * positions are derived from two hash values, and the probe builds a mask
+ * of eight 64-bit words that is compared against the block in one pass
+ * (which the compiler turns into SSE/AVX instructions where available).
+ * Blocked filters need slightly more bits for the same false positive rate.
+ * In serialized form the bit array of a blocked filter starts 64 bytes
+ * after the checksum so that blocks stay cache line aligned when loaded.
  */
 template <class HasherT = MurmurHash2>
 class BasicBloomFilterWithChecksum {
@@ -58,9 +69,11 @@ public:
    *
    * @param items_estimate An estimated number of items that will be inserted
    * @param false_positive_prob The probability for false positives
+   * @param blocked Use blocked layout
    */
   BasicBloomFilterWithChecksum(size_t items_estimate,
-          float false_positive_prob) {
+          float false_positive_prob, bool blocked = false) {
+    m_blocked = blocked;
     m_items_actual = 0;
     m_items_estimate = items_estimate;
     m_false_positive_prob = false_positive_prob;
@@ -72,10 +85,7 @@ public:
               "Num elements=%lu false_positive_prob=%.3f",
               (Lu)items_estimate, false_positive_prob);
     }
-    m_num_bytes = (m_num_bits / CHAR_BIT) + (m_num_bits % CHAR_BIT ? 1 : 0);
-    m_bloom_base = new uint8_t[total_size()];
-    m_bloom_bits = m_bloom_base + 4;
-    memset(m_bloom_base, 0, total_size());
+    allocate();
 
     HT_DEBUG_OUT << "num funcs=" << m_num_hash_functions << " num bits="
         << m_num_bits << " num bytes= " << m_num_bytes << " bits per element="
@@ -88,9 +98,11 @@ public:
    * @param items_estimate An estimated number of items that will be inserted
    * @param bits_per_item Average bits per item
    * @param num_hashes Number of hash functions for the filter
+   * @param blocked Use blocked layout
    */
   BasicBloomFilterWithChecksum(size_t items_estimate, float bits_per_item,
-          size_t num_hashes) {
+          size_t num_hashes, bool blocked = false) {
+    m_blocked = blocked;
     m_items_actual = 0;
     m_items_estimate = items_estimate;
     m_false_positive_prob = 0.0;
@@ -100,10 +112,7 @@ public:
       HT_THROWF(Error::EMPTY_BLOOMFILTER, "Num elements=%lu bits_per_item=%.3f",
               (Lu)items_estimate, bits_per_item);
     }
-    m_num_bytes = (m_num_bits / CHAR_BIT) + (m_num_bits % CHAR_BIT ? 1 : 0);
-    m_bloom_base = new uint8_t[total_size()];
-    m_bloom_bits = m_bloom_base + 4;
-    memset(m_bloom_base, 0, total_size());
+    allocate();
 
     HT_DEBUG_OUT << "num funcs=" << m_num_hash_functions << " num bits="
         << m_num_bits << " num bytes=" << m_num_bytes << " bits per element="
@@ -117,9 +126,11 @@ public:
    * @param items_actual Actual number of items
    * @param length Number of bits
    * @param num_hashes Number of hash functions for the filter
+   * @param blocked Filter has blocked layout
    */
   BasicBloomFilterWithChecksum(size_t items_estimate, size_t items_actual,
-          int64_t length, size_t num_hashes) {
+          int64_t length, size_t num_hashes, bool blocked = false) {
+    m_blocked = blocked;
     m_items_actual = items_actual;
     m_items_estimate = items_estimate;
     m_false_positive_prob = 0.0;
@@ -130,10 +141,7 @@ public:
               "Estimated items=%lu actual items=%lu length=%lld num hashes=%lu",
               (Lu)items_estimate, (Lu)items_actual, (Lld)length, (Lu)num_hashes);
     }
-    m_num_bytes = (m_num_bits / CHAR_BIT) + (m_num_bits % CHAR_BIT ? 1 : 0);
-    m_bloom_base = new uint8_t[total_size()];
-    m_bloom_bits = m_bloom_base + 4;
-    memset(m_bloom_base, 0, total_size());
+    allocate();
 
     HT_DEBUG_OUT << "num funcs=" << m_num_hash_functions << " num bits="
         << m_num_bits << " num bytes=" << m_num_bytes << " bits per element="
@@ -142,7 +150,7 @@ public:
 
   /** Destructor; releases resources */
   ~BasicBloomFilterWithChecksum() {
-    delete[] m_bloom_base;
+    delete[] m_alloc;
   }
 
   /* XXX/review static functions to expose the bloom filter parameters, given
@@ -162,6 +170,18 @@ public:
   void insert(const void *key, size_t len) {
     uint32_t hash = len;
 
+    if (m_blocked) {
+      uint32_t h2;
+      uint64_t *block = find_block(key, len, &h2);
+      uint32_t delta = (h2 >> 17) | (h2 << 15);
+      for (size_t i = 0; i < m_num_hash_functions; ++i) {
+        block[(h2 & 511) >> 6] |= (uint64_t)1 << (h2 & 63);
+        h2 += delta;
+      }
+      m_items_actual++;
+      return;
+    }
+
     for (size_t i = 0; i < m_num_hash_functions; ++i) {
       hash = m_hasher(key, len, hash) % m_num_bits;
       m_bloom_bits[hash / CHAR_BIT] |= (1 << (hash % CHAR_BIT));
@@ -193,6 +213,21 @@ public:
     uint8_t byte_mask;
     uint8_t byte;
 
+    if (m_blocked) {
+      uint32_t h2;
+      const uint64_t *block = find_block(key, len, &h2);
+      uint32_t delta = (h2 >> 17) | (h2 << 15);
+      uint64_t mask[8] = { 0, 0, 0, 0, 0, 0, 0, 0 };
+      uint64_t missing = 0;
+      for (size_t i = 0; i < m_num_hash_functions; ++i) {
+        mask[(h2 & 511) >> 6] |= (uint64_t)1 << (h2 & 63);
+        h2 += delta;
+      }
+      for (size_t i = 0; i < 8; ++i)
+        missing |= mask[i] & ~block[i];
+      return missing == 0;
+    }
+
     for (size_t i = 0; i < m_num_hash_functions; ++i) {
       hash = m_hasher(key, len, hash) % m_num_bits;
       byte = m_bloom_bits[hash / CHAR_BIT];
@@ -259,7 +294,8 @@ public:
    *        checksum and metadata, in bytes)
    */
   size_t total_size() {
-    return 4 + m_num_bytes + HT_IO_ALIGNMENT_PADDING(4 + m_num_bytes);
+    return header_size() + m_num_bytes +
+      HT_IO_ALIGNMENT_PADDING(header_size() + m_num_bytes);
   }
 
   /** Getter for the number of hash functions
@@ -286,7 +322,54 @@ public:
    */
   size_t get_items_actual() { return m_items_actual; }
 
+  /** Checks if filter has blocked layout
+   *
+   * @return <i>true</i> if filter is blocked, <i>false</i> otherwise
+   */
+  bool blocked() { return m_blocked; }
+
+  /** Size of a block (in bits) in blocked layout */
+  static const size_t BLOCK_BITS = 512;
+
 private:
+
+  /** Size of the serialized header (checksum plus alignment padding) */
+  size_t header_size() { return m_blocked ? BLOCK_BITS / CHAR_BIT : 4; }
+
+  /** Allocates and clears the bit array; for a blocked filter the number of
+   * bits is rounded up to a whole number of blocks and the bit array is
+   * aligned on a block boundary
+   */
+  void allocate() {
+    size_t alignment = 1;
+    if (m_blocked) {
+      alignment = BLOCK_BITS / CHAR_BIT;
+      m_num_bits = ((m_num_bits + BLOCK_BITS - 1) / BLOCK_BITS) * BLOCK_BITS;
+      m_num_blocks = m_num_bits / BLOCK_BITS;
+    }
+    m_num_bytes = (m_num_bits / CHAR_BIT) + (m_num_bits % CHAR_BIT ? 1 : 0);
+    m_alloc = new uint8_t[total_size() + alignment - 1];
+    m_bloom_base = (uint8_t *)(((uintptr_t)m_alloc + alignment - 1)
+                               & ~(uintptr_t)(alignment - 1));
+    m_bloom_bits = m_bloom_base + header_size();
+    memset(m_bloom_base, 0, total_size());
+  }
+
+  /** Returns the block an item maps to in blocked layout
+   *
+   * @param key Pointer to the key's data
+   * @param len Size of the data (in bytes)
+   * @param h2p Address of variable to receive the hash value from which
+   *        the bit positions within the block are derived
+   * @return Pointer to the first word of the block
+   */
+  uint64_t *find_block(const void *key, size_t len, uint32_t *h2p) const {
+    uint32_t hash = m_hasher(key, len, len);
+    *h2p = m_hasher(key, len, hash);
+    size_t index = (size_t)(((uint64_t)hash * m_num_blocks) >> 32);
+    return (uint64_t *)(m_bloom_bits + index * (BLOCK_BITS / CHAR_BIT));
+  }
+
   /** The hash function implementation */
   HasherT    m_hasher;
 
@@ -313,6 +396,15 @@ private:
 
   /** The serialized bloom filter data, including metadata and checksums */
   uint8_t   *m_bloom_base;
+
+  /** Allocated memory (m_bloom_base is aligned within it) */
+  uint8_t   *m_alloc;
+
+  /** Number of blocks (blocked layout only) */
+  size_t     m_num_blocks;
+
+  /** Filter has blocked layout */
+  bool       m_blocked;
 };
 
 typedef BasicBloomFilterWithChecksum<> BloomFilterWithChecksum;
@@ -254,6 +254,9 @@ void DefaultPolicy::init_options() {
         "log files after this much time")
     ("Hyperspace.LogGc.MaxUnusedLogs", i32()->default_value(200), "Number of unused BerkeleyDB "
         " to keep around in case of lagging replicas")
+    ("Hyperspace.ReadCache.MaxEntries", i32()->default_value(100000),
+        "Maximum number of nodes kept in the master's in-memory namespace "
+        "cache used to answer attr_get, exists and readdir (0 disables)")
     ("Hyperspace.Replica.Host", strs(), "Hostname of Hyperspace replica")
     ("Hyperspace.Replica.Port", i16()->default_value(38040),
         "Port number on which Hyperspace is or should be listening for requests")
@@ -312,8 +315,26 @@ void DefaultPolicy::init_options() {
     ("Hypertable.Mutator.ScatterBuffer.FlushLimit.Aggregate",
      i64()->default_value(50*M), "Amount of updates (bytes) accumulated for "
         "all servers to trigger a scatter buffer flush")
+    ("Hypertable.Mutator.ScatterBuffer.FlushLatency", i32()->default_value(0),
+        "Age (milliseconds) of the oldest buffered update that triggers a "
+        "scatter buffer flush, whichever comes first with the flush limits; "
+        "mutators without a flush interval flush on a timer with this "
+        "period, so idle mutators flush too (0 disables)")
+    ("Hypertable.Mutator.ScatterBuffer.CompressionThreshold",
+     i32()->default_value(0), "Compress the updates sent to a single server "
+        "if they are at least this many bytes (0 disables; all RangeServers "
+        "must support compressed updates)")
+    ("Hypertable.Mutator.ScatterBuffer.Compressor",
+     str()->default_value("snappy"), "Compressor used for update payloads "
+        "(zlib, lzo, quicklz, snappy, zstd, bmz)")
     ("Hypertable.Scanner.QueueSize",
      i32()->default_value(5), "Size of Scanner ScanBlock queue")
+    ("Hypertable.Scanner.Readahead.MaxDepth", i32()->default_value(4),
+        "Maximum number of fetch_scanblock requests kept outstanding for a "
+        "single RangeServer scanner (1 disables pipelining)")
+    ("Hypertable.Scanner.Readahead.MemoryLimit", i64()->default_value(16*M),
+        "Upper bound on the number of bytes of scan blocks in flight for a "
+        "single RangeServer scanner")
     ("Hypertable.LocationCache.MaxEntries", i64()->default_value(1*M),
         "Size of range location cache in number of entries")
     ("Hypertable.Master.Host", str(),
@@ -370,6 +391,9 @@ void DefaultPolicy::init_options() {
      i32()->default_value(512*KiB), "Page size for CellCache pool allocator")
     ("Hypertable.RangeServer.AccessGroup.CellCache.ScannerCacheSize",
      i32()->default_value(1024), "CellCache scanner cache size")
+    ("Hypertable.RangeServer.AccessGroup.CellCache.Type",
+     str()->default_value("map"), "Default CellCache cell map type for "
+     "access groups that do not specify one (map or skiplist)")
     ("Hypertable.RangeServer.AccessGroup.ShadowCache",
      boo()->default_value(false), "Enable CellStore shadow caching")
     ("Hypertable.RangeServer.AccessGroup.MaxMemory", i64()->default_value(1*G),
@@ -385,8 +409,37 @@ void DefaultPolicy::init_options() {
         "CellStores in which merges will be considered")
     ("Hypertable.RangeServer.CellStore.Merge.RunLengthThreshold", i32()->default_value(5),
         "Trigger a merge if an adjacent run of merge candidate CellStores exceeds this length")
+    ("Hypertable.RangeServer.Compaction.Policy", str()->default_value("default"),
+        "CellStore merge policy for tables that do not specify COMPACTION_POLICY "
+        "(default, tiered or leveled)")
+    ("Hypertable.RangeServer.Compaction.Tiered.SizeRatio", f64()->default_value(2.0),
+        "Tiered policy: CellStores within this factor of a tier's average size "
+        "belong to the tier")
+    ("Hypertable.RangeServer.Compaction.Tiered.MinRunLength", i32()->default_value(4),
+        "Tiered policy: merge a tier once it holds this many CellStores")
+    ("Hypertable.RangeServer.Compaction.Tiered.MaxWriteAmplification",
+        f64()->default_value(4.0), "Tiered policy: below this write "
+        "amplification, also merge tiers of two or more CellStores during "
+        "the low activity window")
+    ("Hypertable.RangeServer.Compaction.Leveled.Fanout", i32()->default_value(10),
+        "Leveled policy: size ratio kept between a CellStore and all newer ones")
+    ("Hypertable.RangeServer.Compaction.Leveled.MaxWriteAmplification",
+        f64()->default_value(30.0), "Leveled policy: at or above this write "
+        "amplification, only merge new CellStores once RunLengthThreshold of "
+        "them have accumulated or during the low activity window")
     ("Hypertable.RangeServer.CellStore.DefaultBlockSize",
         i32()->default_value(64*KiB), "Default block size for cell stores")
+    ("Hypertable.RangeServer.CellStore.CompressionThreads",
+        i32()->default_value(2), "Number of threads used to compress blocks "
+        "while writing a cell store (0 compresses inline)")
+    ("Hypertable.RangeServer.CellStore.MaxCompressionThreads",
+        i32()->default_value(0), "Maximum number of cell store compression "
+        "threads across all concurrent writers; writers that find none free "
+        "compress inline (0 means the number of cores)")
+    ("Hypertable.RangeServer.CellStore.RestartInterval",
+        i32()->default_value(0), "Number of entries between the restart "
+        "points that cell store blocks carry for binary search by scanners "
+        "(0 writes no restart points; 16 is a good value when enabled)")
     ("Hypertable.RangeServer.Data.DefaultReplication",
         i32()->default_value(-1), "Default replication for data")
     ("Hypertable.RangeServer.CellStore.DefaultCompressor",
@@ -407,8 +460,17 @@ void DefaultPolicy::init_options() {
         "Minimum size of block cache")
     ("Hypertable.RangeServer.BlockCache.MaxMemory", i64()->default_value(-1),
         "Maximum (target) size of block cache")
+    ("Hypertable.RangeServer.BlockCache.Shards", i32()->default_value(16),
+        "Number of independently locked shards the block cache is split into")
+    ("Hypertable.RangeServer.BlockCache.Policy", str()->default_value("SLRU"),
+        "Block cache replacement policy (LRU or SLRU)")
     ("Hypertable.RangeServer.QueryCache.MaxMemory", i64()->default_value(50*M),
         "Maximum size of query cache")
+    ("Hypertable.RangeServer.QueryCache.Shards", i32()->default_value(16),
+        "Number of independently locked shards the query cache is split into")
+    ("Hypertable.RangeServer.QueryCache.AdmissionControl", boo()->default_value(true),
+        "Only cache the result of a query once it has missed the cache twice, "
+        "so rows that are read only once do not displace frequently read rows")
     ("Hypertable.RangeServer.Range.RowSize.Unlimited", boo()->default_value(false),
      "Marks range active and unsplittable upon encountering row overflow condition. "
      "Can cause ranges to grow extremely large.  Use with caution!")
@@ -438,15 +500,24 @@ void DefaultPolicy::init_options() {
     ("Hypertable.RangeServer.CommitLog.PruneThreshold.Max.MemoryPercentage",
         i32()->default_value(50), "Upper threshold in terms of % RAM for "
         "amount of outstanding commit log before pruning")
+    ("Hypertable.RangeServer.CommitLog.Pipeline.Workers", i32()->default_value(0),
+        "Number of threads compressing USER commit log blocks in parallel "
+        "ahead of asynchronous appends (0 disables the write pipeline)")
     ("Hypertable.RangeServer.CommitLog.RollLimit", i64()->default_value(100*M),
         "Roll commit log after this many bytes")
     ("Hypertable.RangeServer.CommitLog.Compressor",
         str()->default_value("quicklz"),
-       "Commit log compressor to use (zlib, lzo, quicklz, snappy, bmz, none)")
+       "Commit log compressor to use (zlib, lzo, quicklz, snappy, zstd, bmz, none)")
     ("Hypertable.RangeServer.Testing.MaintenanceNeeded.PauseInterval", i32()->default_value(0),
         "TESTING:  After update, if range needs maintenance, pause for this number of milliseconds")
     ("Hypertable.RangeServer.UpdateCoalesceLimit", i64()->default_value(5*M),
         "Amount of update data to coalesce into single commit log sync")
+    ("Hypertable.RangeServer.UpdateQualifyThreads", i32()->default_value(1),
+        "Number of threads qualifying and transforming updates; updates are "
+        "partitioned among them by table")
+    ("Hypertable.RangeServer.UpdateQueueLimit", i32()->default_value(1000),
+        "Maximum number of pending update batches held in each queue of the "
+        "update pipeline before further updates block")
     ("Hypertable.RangeServer.Failover.FlushLimit.PerRange",
      i32()->default_value(10*M), "Amount of updates (bytes) accumulated for a "
         "single range to trigger a replay buffer flush")
@@ -458,13 +529,16 @@ void DefaultPolicy::init_options() {
     ("Hypertable.CommitLog.RollLimit", i64()->default_value(100*M),
         "Roll commit log after this many bytes")
     ("Hypertable.CommitLog.Compressor", str()->default_value("quicklz"),
-        "Commit log compressor to use (zlib, lzo, quicklz, snappy, bmz, none)")
+        "Commit log compressor to use (zlib, lzo, quicklz, snappy, zstd, bmz, none)")
     ("Hypertable.CommitLog.SkipErrors", boo()->default_value(false),
         "Skip over any corruption encountered in the commit log")
     ("Hypertable.RangeServer.Scanner.Ttl", i32()->default_value(1800*K),
         "Number of milliseconds of inactivity before destroying scanners")
     ("Hypertable.RangeServer.Scanner.BufferSize", i64()->default_value(1*M),
         "Size of transfer buffer for scan results")
+    ("Hypertable.RangeServer.Scanner.ZeroCopy", boo()->default_value(false),
+        "Send cached CellStore blocks referenced by scan results in place "
+        "instead of copying them into the transfer buffer (experimental)")
     ("Hypertable.RangeServer.Timer.Interval", i32()->default_value(20000),
         "Timer interval in milliseconds (reaping scanners, purging commit logs, etc.)")
     ("Hypertable.RangeServer.Maintenance.Interval", i32()->default_value(30000),
@@ -479,6 +553,13 @@ void DefaultPolicy::init_options() {
         "Millisecond delay before scheduling merging compactions in non-low memory mode")
     ("Hypertable.RangeServer.Maintenance.MoveCompactionsPerInterval", i32()->default_value(2),
         "Limit on number of major compactions due to move per maintenance interval")
+    ("Hypertable.RangeServer.Maintenance.Subcompaction.Threads", i32()->default_value(4),
+        "Maximum number of threads (and key-range partitions) used by one major "
+        "compaction; helper threads are shared server-wide and capped by the "
+        "number of maintenance threads (1 disables splitting)")
+    ("Hypertable.RangeServer.Maintenance.Subcompaction.MinimumSize", i64()->default_value(64*MiB),
+        "Minimum amount of stored data per partition when splitting a major "
+        "compaction into subcompactions")
     ("Hypertable.RangeServer.Monitoring.DataDirectories", str()->default_value("/"),
         "Comma-separated list of directory mount points of disk volumes to monitor")
     ("Hypertable.RangeServer.Workers", i32()->default_value(50),
@@ -504,6 +585,11 @@ void DefaultPolicy::init_options() {
         "Maximum flush interval in milliseconds")
     ("ThriftBroker.Workers", i32()->default_value(50), "Number of "
         "worker threads for thrift broker")
+    ("ThriftBroker.NonBlocking", boo()->default_value(false), "Serve "
+        "requests with a non-blocking server and a pool of "
+        "ThriftBroker.Workers threads instead of a thread per connection")
+    ("ThriftBroker.ObjectMap.Shards", i32()->default_value(16), "Number of "
+        "independently locked shards in each client object map")
     ("ThriftBroker.Hyperspace.Session.Reconnect", boo()->default_value(true),
         "ThriftBroker will reconnect to Hyperspace on session expiry")
     ;
@@ -118,11 +118,22 @@ struct BloomFilterTest {
     cout << "  false positive rate: expected "<< fp_prob <<", got "
          << false_positives / nfalses << endl;
 
+    test_with_checksum<HashT>(label, false);
+    test_with_checksum<HashT>(label, true);
+  }
+
+  template <class HashT>
+  void test_with_checksum(const String &label, bool blocked) {
+    size_t nitems = items.size() / 2;
+    double false_positives = 0.;
+    size_t nfalses = items.size() - nitems;
+    String suffix = blocked ? ", blocked" : "";
+
     /*** With Checksum ***/
 
-    BasicBloomFilterWithChecksum<HashT> *filter_with_checksum = new BasicBloomFilterWithChecksum<HashT>(nitems, fp_prob);
+    BasicBloomFilterWithChecksum<HashT> *filter_with_checksum = new BasicBloomFilterWithChecksum<HashT>(nitems, fp_prob, blocked);
 
-    cout << label << " (with checksum)" << endl;
+    cout << label << " (with checksum" << suffix << ")" << endl;
 
     MEASURE("  insert", for (size_t i = 0; i < nitems; ++i)
       filter_with_checksum->insert(items[i].data), nitems);
@@ -153,11 +164,14 @@ struct BloomFilterTest {
 
     /*** With Checksum after Deserialization ***/
 
-    filter_with_checksum = new BasicBloomFilterWithChecksum<HashT>(items_estimate, items_actual, length, num_hashes);
+    filter_with_checksum = new BasicBloomFilterWithChecksum<HashT>(items_estimate, items_actual, length, num_hashes, blocked);
 
     memcpy(filter_with_checksum->base(), serialized_buf.base, serialized_buf.size);
 
-    cout << label << " (with checksum deserialized)" << endl;
+    String filename = "bloom_filter_test";
+    filter_with_checksum->validate(filename);
+
+    cout << label << " (with checksum deserialized" << suffix << ")" << endl;
 
     MEASURE("  true positives", for (size_t i = 0; i < nitems; ++i)
       HT_ASSERT(filter_with_checksum->may_contain(items[i].data)), nitems);
@@ -0,0 +1,252 @@
+/* -*- c++ -*-
+ * Copyright (C) 2007-2013 Hypertable, Inc.
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+/** @file
+ * Definitions for Batch.
+ * This file contains definitions for Batch, a sequence of name based
+ * Hyperspace operations that is sent to the master in a single request
+ * and executed there in a single BerkeleyDB transaction.
+ */
+
+#include "Common/Compat.h"
+#include "Common/Logger.h"
+#include "Common/Serialization.h"
+
+#include "Batch.h"
+
+using namespace Hyperspace;
+using namespace Hypertable;
+using namespace Serialization;
+
+
+size_t Batch::exists(const String &name) {
+  m_ops.push_back(Op());
+  m_ops.back().type = EXISTS;
+  m_ops.back().name = name;
+  return m_ops.size() - 1;
+}
+
+
+size_t Batch::attr_exists(const String &name, const String &attr) {
+  m_ops.push_back(Op());
+  m_ops.back().type = ATTR_EXISTS;
+  m_ops.back().name = name;
+  m_ops.back().attrs.push_back(attr);
+  return m_ops.size() - 1;
+}
+
+
+size_t Batch::attrs_get(const String &name, const std::vector<String> &attrs) {
+  m_ops.push_back(Op());
+  m_ops.back().type = ATTRS_GET;
+  m_ops.back().name = name;
+  m_ops.back().attrs = attrs;
+  return m_ops.size() - 1;
+}
+
+
+size_t Batch::attr_set(const String &name, uint32_t oflags,
+                       const std::vector<Attribute> &attrs) {
+  m_ops.push_back(Op());
+  Op &op = m_ops.back();
+  op.type = ATTR_SET;
+  op.name = name;
+  op.oflags = oflags;
+  foreach_ht (const Attribute &attr, attrs) {
+    op.attrs.push_back(attr.name);
+    op.values.push_back(String((const char *)attr.value, attr.value_len));
+  }
+  return m_ops.size() - 1;
+}
+
+
+/*
+ * Each operation is encoded as its type (i8) and node name (vstr) followed
+ * by the type specific arguments:
+ *
+ *   ATTR_EXISTS  vstr attribute name
+ *   ATTRS_GET    i32 count, vstr attribute names
+ *   ATTR_SET     i32 open flags, i32 count, (vstr name, vstr value) pairs
+ */
+size_t Batch::encoded_length_ops() const {
+  size_t len = 4;
+  foreach_ht (const Op &op, m_ops) {
+    len += 1 + encoded_length_vstr(op.name);
+    if (op.type == ATTR_SET)
+      len += 4;
+    if (op.type == ATTRS_GET || op.type == ATTR_SET)
+      len += 4;
+    foreach_ht (const String &attr, op.attrs)
+      len += encoded_length_vstr(attr);
+    foreach_ht (const String &value, op.values)
+      len += encoded_length_vstr(value);
+  }
+  return len;
+}
+
+
+void Batch::encode_ops(uint8_t **bufp) const {
+  encode_i32(bufp, m_ops.size());
+  foreach_ht (const Op &op, m_ops) {
+    encode_i8(bufp, op.type);
+    encode_vstr(bufp, op.name);
+    switch (op.type) {
+    case ATTR_EXISTS:
+      encode_vstr(bufp, op.attrs.front());
+      break;
+    case ATTRS_GET:
+      encode_i32(bufp, op.attrs.size());
+      foreach_ht (const String &attr, op.attrs)
+        encode_vstr(bufp, attr);
+      break;
+    case ATTR_SET:
+      encode_i32(bufp, op.oflags);
+      encode_i32(bufp, op.attrs.size());
+      for (size_t i=0; i<op.attrs.size(); i++) {
+        encode_vstr(bufp, op.attrs[i]);
+        encode_vstr(bufp, op.values[i]);
+      }
+      break;
+    }
+  }
+}
+
+
+void Batch::decode_ops(const uint8_t **bufp, size_t *remainp) {
+  m_ops.clear();
+  uint32_t count = decode_i32(bufp, remainp);
+  m_ops.reserve(count);
+  while (count-- > 0) {
+    m_ops.push_back(Op());
+    Op &op = m_ops.back();
+    op.type = decode_i8(bufp, remainp);
+    op.name = decode_vstr(bufp, remainp);
+    switch (op.type) {
+    case EXISTS:
+      break;
+    case ATTR_EXISTS:
+      op.attrs.push_back(decode_vstr(bufp, remainp));
+      break;
+    case ATTRS_GET:
+      {
+        uint32_t attr_count = decode_i32(bufp, remainp);
+        while (attr_count-- > 0)
+          op.attrs.push_back(decode_vstr(bufp, remainp));
+      }
+      break;
+    case ATTR_SET:
+      {
+        op.oflags = decode_i32(bufp, remainp);
+        uint32_t attr_count = decode_i32(bufp, remainp);
+        while (attr_count-- > 0) {
+          op.attrs.push_back(decode_vstr(bufp, remainp));
+          uint32_t value_len;
+          const char *value = decode_vstr(bufp, remainp, &value_len);
+          op.values.push_back(String(value, value_len));
+        }
+      }
+      break;
+    default:
+      HT_THROWF(Error::PROTOCOL_ERROR, "Invalid batch operation type %d",
+                (int)op.type);
+    }
+  }
+}
+
+
+/*
+ * The outcome is encoded as the error code (i32), error message (vstr) and
+ * number of completed operations (i32), followed by the results of the
+ * completed operations:
+ *
+ *   EXISTS, ATTR_EXISTS  bool
+ *   ATTRS_GET            i32 count, (bool present, bytes32 value) pairs
+ */
+size_t Batch::encoded_length_results() const {
+  size_t len = 8 + encoded_length_vstr(m_error_msg);
+  for (size_t i=0; i<m_completed; i++) {
+    const Op &op = m_ops[i];
+    if (op.type == EXISTS || op.type == ATTR_EXISTS)
+      len += 1;
+    else if (op.type == ATTRS_GET) {
+      len += 4;
+      foreach_ht (const DynamicBufferPtr &value, op.results)
+        len += 1 + encoded_length_bytes32(value ? value->fill() : 0);
+    }
+  }
+  return len;
+}
+
+
+void Batch::encode_results(uint8_t **bufp) const {
+  encode_i32(bufp, m_error);
+  encode_vstr(bufp, m_error_msg);
+  encode_i32(bufp, m_completed);
+  for (size_t i=0; i<m_completed; i++) {
+    const Op &op = m_ops[i];
+    if (op.type == EXISTS || op.type == ATTR_EXISTS)
+      encode_bool(bufp, op.exists);
+    else if (op.type == ATTRS_GET) {
+      encode_i32(bufp, op.results.size());
+      foreach_ht (const DynamicBufferPtr &value, op.results) {
+        encode_bool(bufp, value.get() != 0);
+        if (value)
+          encode_bytes32(bufp, value->base, value->fill());
+        else
+          encode_bytes32(bufp, 0, 0);
+      }
+    }
+  }
+}
+
+
+void Batch::decode_results(const uint8_t **bufp, size_t *remainp) {
+  m_error = decode_i32(bufp, remainp);
+  m_error_msg = decode_vstr(bufp, remainp);
+  m_completed = decode_i32(bufp, remainp);
+  if (m_completed > m_ops.size())
+    HT_THROWF(Error::PROTOCOL_ERROR, "Batch completed count %u exceeds "
+              "operation count %u", (unsigned)m_completed,
+              (unsigned)m_ops.size());
+  for (size_t i=0; i<m_completed; i++) {
+    Op &op = m_ops[i];
+    if (op.type == EXISTS || op.type == ATTR_EXISTS)
+      op.exists = decode_bool(bufp, remainp);
+    else if (op.type == ATTRS_GET) {
+      uint32_t count = decode_i32(bufp, remainp);
+      op.results.clear();
+      op.results.reserve(count);
+      while (count-- > 0) {
+        bool present = decode_bool(bufp, remainp);
+        uint32_t value_len;
+        void *value = decode_bytes32(bufp, remainp, &value_len);
+        DynamicBufferPtr result;
+        if (present) {
+          result = new DynamicBuffer(value_len+1);
+          result->add_unchecked(value, value_len);
+          // nul-terminate to make caller's lives easier
+          *result->ptr = 0;
+        }
+        op.results.push_back(result);
+      }
+    }
+  }
+}
@@ -0,0 +1,226 @@
+/* -*- c++ -*-
+ * Copyright (C) 2007-2013 Hypertable, Inc.
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+/** @file
+ * Declarations for Batch.
+ * This file contains declarations for Batch, a sequence of name based
+ * Hyperspace operations that is sent to the master in a single request
+ * and executed there in a single BerkeleyDB transaction.
+ */
+
+#ifndef HYPERSPACE_BATCH_H
+#define HYPERSPACE_BATCH_H
+
+#include <vector>
+
+#include "Common/DynamicBuffer.h"
+#include "Common/Error.h"
+#include "Common/String.h"
+
+#include "Protocol.h"
+
+namespace Hyperspace {
+
+  /** @addtogroup Hyperspace
+   * @{
+   */
+
+  /** Sequence of Hyperspace operations executed in one request.
+   * Operations are added with exists(), attr_exists(), attrs_get() and
+   * attr_set(), each of which returns the index of the operation, and the
+   * batch is then run with Session::execute().  The master executes the
+   * operations in order within a single BerkeleyDB transaction and stops at
+   * the first one that fails.  In that case the transaction is aborted, so
+   * none of the updates in the batch take effect, get_error() returns the
+   * error and completed() the index of the failed operation; the results of
+   * the operations preceding it are still available.
+   */
+  class Batch {
+  public:
+
+    /// Operation types
+    enum {
+      /// Check if a node exists
+      EXISTS      = 1,
+      /// Check if a node has an attribute
+      ATTR_EXISTS = 2,
+      /// Get one or more attributes of a node
+      ATTRS_GET   = 3,
+      /// Set one or more attributes of a node
+      ATTR_SET    = 4
+    };
+
+    /** A single operation and its result. */
+    struct Op {
+      Op() : type(0), oflags(0), exists(false) { }
+      /// Operation type
+      uint8_t type;
+      /// Absolute pathname of the node
+      String name;
+      /// Open flags for ATTR_SET (see \ref OpenFlags)
+      uint32_t oflags;
+      /// Attribute names
+      std::vector<String> attrs;
+      /// Attribute values for ATTR_SET
+      std::vector<String> values;
+      /// Result of EXISTS and ATTR_EXISTS
+      bool exists;
+      /// Result of ATTRS_GET, a null pointer for each missing attribute
+      std::vector<DynamicBufferPtr> results;
+    };
+
+    /** Constructor. */
+    Batch() : m_error(Hypertable::Error::OK), m_completed(0) { }
+
+    /** Adds an operation that checks if a node exists.
+     * @param name absolute pathname of the node
+     * @return Index of the operation
+     */
+    size_t exists(const String &name);
+
+    /** Adds an operation that checks if a node has an attribute.
+     * @param name absolute pathname of the node
+     * @param attr name of extended attribute
+     * @return Index of the operation
+     */
+    size_t attr_exists(const String &name, const String &attr);
+
+    /** Adds an operation that gets attributes of a node.
+     * @param name absolute pathname of the node
+     * @param attrs names of extended attributes
+     * @return Index of the operation
+     */
+    size_t attrs_get(const String &name, const std::vector<String> &attrs);
+
+    /** Adds an operation that sets attributes of a node.
+     * @param name absolute pathname of the node
+     * @param oflags OR'ed together set of open flags (see \ref OpenFlags)
+     * @param attrs attributes to set
+     * @return Index of the operation
+     */
+    size_t attr_set(const String &name, uint32_t oflags,
+                    const std::vector<Attribute> &attrs);
+
+    /** Returns the number of operations.
+     * @return Number of operations in the batch
+     */
+    size_t size() const { return m_ops.size(); }
+
+    /** Returns an operation.
+     * @param i Index of the operation
+     * @return Reference to operation <code>i</code>
+     */
+    Op &get_op(size_t i) { return m_ops[i]; }
+
+    /** Returns the result of an EXISTS or ATTR_EXISTS operation.
+     * @param i Index of the operation
+     * @return <i>true</i> if the node or attribute exists
+     */
+    bool get_exists(size_t i) const { return m_ops[i].exists; }
+
+    /** Returns the result of an ATTRS_GET operation.  Values are nul
+     * terminated, and missing attributes are returned as null pointers.
+     * @param i Index of the operation
+     * @return Attribute values, in the order they were requested
+     */
+    const std::vector<DynamicBufferPtr> &get_values(size_t i) const {
+      return m_ops[i].results;
+    }
+
+    /** Returns the number of operations executed successfully.  If the
+     * batch failed, this is the index of the failed operation.
+     * @return Number of completed operations
+     */
+    size_t completed() const { return m_completed; }
+
+    /** Returns the error of the failed operation.
+     * @return Error code, or Error::OK if all operations succeeded
+     */
+    int get_error() const { return m_error; }
+
+    /** Returns the error message of the failed operation.
+     * @return Error message
+     */
+    const String &get_error_msg() const { return m_error_msg; }
+
+    /** Records the outcome of executing the batch.
+     * @param completed number of operations executed successfully
+     * @param error error code of the failed operation
+     * @param error_msg error message of the failed operation
+     */
+    void set_outcome(size_t completed, int error, const String &error_msg) {
+      m_completed = completed;
+      m_error = error;
+      m_error_msg = error_msg;
+    }
+
+    /** Returns the encoded length of the operations.
+     * @return Number of bytes needed by encode_ops()
+     */
+    size_t encoded_length_ops() const;
+
+    /** Encodes the operations.
+     * @param bufp address of destination buffer pointer (advanced by call)
+     */
+    void encode_ops(uint8_t **bufp) const;
+
+    /** Decodes operations, replacing the current contents.
+     * @param bufp address of source buffer pointer (advanced by call)
+     * @param remainp address of remaining byte count (decremented by call)
+     */
+    void decode_ops(const uint8_t **bufp, size_t *remainp);
+
+    /** Returns the encoded length of the outcome and results.
+     * @return Number of bytes needed by encode_results()
+     */
+    size_t encoded_length_results() const;
+
+    /** Encodes the outcome and the results of the completed operations.
+     * @param bufp address of destination buffer pointer (advanced by call)
+     */
+    void encode_results(uint8_t **bufp) const;
+
+    /** Decodes the outcome and results into the operations.
+     * @param bufp address of source buffer pointer (advanced by call)
+     * @param remainp address of remaining byte count (decremented by call)
+     */
+    void decode_results(const uint8_t **bufp, size_t *remainp);
+
+  private:
+
+    /// Operations
+    std::vector<Op> m_ops;
+
+    /// Error code of the failed operation
+    int m_error;
+
+    /// Error message of the failed operation
+    String m_error_msg;
+
+    /// Number of operations executed successfully
+    size_t m_completed;
+  };
+
+  /** @} */
+
+} // namespace Hyperspace
+
+#endif // HYPERSPACE_BATCH_H
@@ -76,7 +76,8 @@ BerkeleyDbFilesystem::BerkeleyDbFilesystem(PropertiesPtr &props,
                                            const std::string &basedir,
                                            const std::vector<Thread::id> &thread_ids,
                                            bool force_recover)
-    : m_base_dir(basedir), m_env(0) {
+    : m_base_dir(basedir), m_env(0),
+      m_namespace_cache(props->get_i32("Hyperspace.ReadCache.MaxEntries")) {
 
   m_checkpoint_size_kb = props->get_i32("Hyperspace.Checkpoint.Size") / 1000;
   m_log_gc_interval = props->get_i32("Hyperspace.LogGc.Interval");
@@ -111,6 +112,7 @@ BerkeleyDbFilesystem::BerkeleyDbFilesystem(PropertiesPtr &props,
     HT_INFOF("localhost=%s localip=%s", localhost.c_str(), localip.c_str());
 
     m_env.set_lk_detect(DB_LOCK_DEFAULT);
+    m_replication_info.namespace_cache = &m_namespace_cache;
     m_env.set_app_private(&m_replication_info);
     m_env.set_event_notify(db_event_callback);
     m_env.set_msgcall(db_msg_callback);
@@ -405,10 +407,12 @@ void BerkeleyDbFilesystem::db_event_callback(DbEnv *dbenv, uint32_t which, void
   switch (which) {
   case DB_EVENT_REP_CLIENT:
     HT_INFO("Received DB_EVENT_REP_CLIENT event");
+   replication_info->namespace_cache->clear();
    break;
   case DB_EVENT_REP_MASTER:
     HT_INFO("Received DB_EVENT_REP_MASTER event");
     HT_INFOF("Local site elected master: %s", replication_info->localhost.c_str());
+   replication_info->namespace_cache->clear();
    replication_info->is_master = true;
    replication_info->finish_election();
    break;
@@ -420,6 +424,7 @@ void BerkeleyDbFilesystem::db_event_callback(DbEnv *dbenv, uint32_t which, void
    // exit if we lost mastership
    if (replication_info->is_master)
      HT_FATAL("Local site lost mastership");
+   replication_info->namespace_cache->clear();
    replication_info->master_eid = *((int*)info);
    {
      auto it = replication_info->replica_map.find(replication_info->master_eid);
@@ -595,6 +600,11 @@ void BerkeleyDbFilesystem::start_transaction(BDbTxn &txn) {
     txn.handle_namespace_db = db_handles->handle_namespace_db;
     txn.handle_state_db = db_handles->handle_state_db;
 
+    // cache fills from this txn are dropped if the namespace changes
+    // before they're made
+    txn.cache_revision = m_namespace_cache.revision();
+    txn.cache_handle_revision = m_namespace_cache.handle_revision();
+
     // open txn
     m_env.txn_begin(NULL, &txn.db_txn, 0);
   }
@@ -661,6 +671,7 @@ BerkeleyDbFilesystem::set_xattr_i32(BDbTxn &txn, const String &fname,
 
   try {
     ret = txn.handle_namespace_db->put(txn.db_txn, &key, &data, 0);
+    m_namespace_cache.invalidate_xattr(fname, aname);
     HT_DEBUG_ATTR(txn, fname, aname, key, value);
   }
   catch (DbException &e) {
@@ -728,6 +739,7 @@ BerkeleyDbFilesystem::set_xattr_i64(BDbTxn &txn, const String &fname,
 
   try {
     ret = txn.handle_namespace_db->put(txn.db_txn, &key, &data, 0);
+    m_namespace_cache.invalidate_xattr(fname, aname);
     HT_DEBUG_ATTR(txn, fname, aname, key, value);
   }
   catch (DbException &e) {
@@ -787,7 +799,9 @@ BerkeleyDbFilesystem::incr_attr(BDbTxn &txn, const String &fname, const String &
       data.set_data(numbuf);
       data.set_size(strlen(numbuf));
 
-      if ((ret = txn.handle_namespace_db->put(txn.db_txn, &key, &data, 0)) == 0) {
+      ret = txn.handle_namespace_db->put(txn.db_txn, &key, &data, 0);
+      m_namespace_cache.invalidate_xattr(fname, aname);
+      if (ret == 0) {
         HT_DEBUG_ATTR(txn, fname, aname, key, new_value);
         return true;
       }
@@ -820,6 +834,7 @@ BerkeleyDbFilesystem::set_xattr(BDbTxn &txn, const String &fname,
   try {
     HT_DEBUG_ATTR_(txn, fname, aname, key, value, value_len);
     ret = txn.handle_namespace_db->put(txn.db_txn, &key, &data, 0);
+    m_namespace_cache.invalidate_xattr(fname, aname);
   }
   catch (DbException &e) {
     if (e.get_errno() == DB_LOCK_DEADLOCK)
@@ -854,8 +869,14 @@ BerkeleyDbFilesystem::get_xattr(BDbTxn &txn, const String &fname,
       memcpy(vbuf.base, (uint8_t *)data.get_data(), data.get_size());
       vbuf.ptr += data.get_size();
       HT_DEBUG_ATTR_(txn, fname, aname, key, vbuf.base, data.get_size());
+      if (use_cache())
+        m_namespace_cache.insert_xattr(txn.cache_revision, fname, aname,
+                                       data.get_data(), data.get_size(), true);
       return true;
     }
+    if (ret == DB_NOTFOUND && use_cache())
+      m_namespace_cache.insert_xattr(txn.cache_revision, fname, aname,
+                                     0, 0, false);
   }
   catch (DbException &e) {
     if (e.get_errno() == DB_LOCK_DEADLOCK)
@@ -914,6 +935,7 @@ BerkeleyDbFilesystem::del_xattr(BDbTxn &txn, const String &fname,
   try {
     if ((ret = txn.handle_namespace_db->del(txn.db_txn, &key, 0)) == DB_NOTFOUND)
       HT_THROW(HYPERSPACE_ATTR_NOT_FOUND, aname);
+    m_namespace_cache.invalidate_xattr(fname, aname);
     HT_DEBUG_ATTR_(txn, fname, aname, key, "", 0);
   }
   catch (DbException &e) {
@@ -971,6 +993,7 @@ void BerkeleyDbFilesystem::mkdir(BDbTxn &txn, const String &name) {
     data.clear();
 
     ret = txn.handle_namespace_db->put(txn.db_txn, &key, &data, 0);
+    m_namespace_cache.invalidate_node(dirname);
 
   }
   catch (DbException &e) {
@@ -1037,6 +1060,7 @@ void BerkeleyDbFilesystem::unlink(BDbTxn &txn, const String &name) {
       HT_ASSERT(txn.handle_namespace_db->del(txn.db_txn, &key, 0) != DB_NOTFOUND);
       HT_DEBUG_ATTR_(txn, name, "", key, "", 0);
     }
+    m_namespace_cache.invalidate_node(name);
   }
   catch (DbException &e) {
     HT_ERRORF("Berkeley DB error: %s", e.what());
@@ -1069,11 +1093,19 @@ BerkeleyDbFilesystem::exists(BDbTxn &txn, String fname, bool *is_dir_p) {
 
       if ((ret = txn.handle_namespace_db->exists(txn.db_txn, &key, 0)) == DB_NOTFOUND) {
         HT_DEBUG_OUT <<"'"<< fname <<"' does NOT exist."<< HT_END;
+        if (use_cache())
+          m_namespace_cache.insert_exists(txn.cache_revision,
+              fname.substr(0, fname.length()-1), false, false);
         return false;
       }
       if (is_dir_p)
         *is_dir_p = true;
+      if (use_cache())
+        m_namespace_cache.insert_exists(txn.cache_revision,
+            fname.substr(0, fname.length()-1), true, true);
     }
+    else if (use_cache())
+      m_namespace_cache.insert_exists(txn.cache_revision, fname, true, false);
   }
   catch (DbException &e) {
     HT_ERRORF("Berkeley DB error: %s", e.what());
@@ -1128,6 +1160,7 @@ BerkeleyDbFilesystem::create(BDbTxn &txn, const String &fname, bool temp) {
       key.set_size(temp_key.length()+1);
       ret = txn.handle_namespace_db->put(txn.db_txn, &key, &data, 0);
     }
+    m_namespace_cache.invalidate_node(fname);
   }
   catch (DbException &e) {
     HT_ERRORF("Berkeley DB error: %s", e.what());
@@ -1151,6 +1184,7 @@ BerkeleyDbFilesystem::get_directory_listing(BDbTxn &txn, String fname,
   String str, last_str;
   DirEntry entry;
   size_t offset;
+  size_t listing_start = listing.size();
 
   try {
     txn.handle_namespace_db->cursor(txn.db_txn, &cursorp, 0);
@@ -1208,6 +1242,9 @@ BerkeleyDbFilesystem::get_directory_listing(BDbTxn &txn, String fname,
       } while (cursorp->get(&keym, &datam, DB_NEXT) != DB_NOTFOUND &&
                starts_with(keym.get_str(), fname.c_str()));
 
+      if (use_cache() && listing_start == 0)
+        m_namespace_cache.insert_directory_listing(txn.cache_revision, fname,
+                                                   listing);
     }
   }
   catch (DbException &e) {
@@ -1835,6 +1872,7 @@ BerkeleyDbFilesystem::delete_session(BDbTxn &txn, uint64_t id)
     ret = cursorp->get(&keym, &datam, DB_SET);
     while(ret != DB_NOTFOUND) {
       HT_ASSERT(ret==0);
+      m_namespace_cache.invalidate_handle(strtoul((const char *)datam.get_data(), 0, 0));
       cursorp->del(0);
       ret = cursorp->get(&keym, &datam, DB_NEXT_DUP);
     }
@@ -2345,6 +2383,7 @@ BerkeleyDbFilesystem::delete_handle(BDbTxn &txn, uint64_t id)
     ret = cursorp->del(0);
     HT_ASSERT(ret==0);
 
+    m_namespace_cache.invalidate_handle(id);
   }
   catch (DbException &e) {
     if (e.get_errno() == DB_LOCK_DEADLOCK)
@@ -2694,6 +2733,9 @@ BerkeleyDbFilesystem::get_handle_node(BDbTxn &txn, uint64_t id, String &node_nam
     ret = txn.handle_state_db->get(txn.db_txn, &keym, &datam, 0);
     HT_ASSERT(ret == 0);
     node_name = datam.get_str();
+    if (use_cache())
+      m_namespace_cache.insert_handle_node(txn.cache_handle_revision, id,
+                                           node_name);
 
   }
   catch (DbException &e) {
@@ -32,6 +32,7 @@
 
 #include <Hyperspace/DirEntry.h>
 #include <Hyperspace/DirEntryAttr.h>
+#include <Hyperspace/NamespaceCache.h>
 #include <Hyperspace/StateDbKeys.h>
 
 #include <Common/DynamicBuffer.h>
@@ -88,7 +89,8 @@ namespace Hyperspace {
   public:
     /** Constructor. */
     ReplicationInfo(): do_replication(true), is_master(false), master_eid(-1),
-                       num_replicas(0), m_election_done(false) {}
+                       num_replicas(0), namespace_cache(0),
+                       m_election_done(false) {}
 
     /** Waits for master election to finish. */
     void wait_for_election() {
@@ -120,6 +122,8 @@ namespace Hyperspace {
     uint32_t num_replicas;
     String localhost;
     std::unordered_map<int, String> replica_map;
+    /// Namespace cache, cleared whenever mastership changes
+    NamespaceCache *namespace_cache;
 
   private:
 
@@ -183,7 +187,8 @@ namespace Hyperspace {
   class BDbTxn {
   public:
     /** Constructor. */
-    BDbTxn(): handle_namespace_db(0), handle_state_db(0), db_txn(0) {}
+    BDbTxn(): handle_namespace_db(0), handle_state_db(0), db_txn(0),
+              cache_revision(0), cache_handle_revision(0) {}
 
     /** Commit transaction.
      * @param flag BerkeleyDB commit flags
@@ -207,6 +212,12 @@ namespace Hyperspace {
 
     /// BerkeleyDB transaction object
     DbTxn *db_txn;
+
+    /// NamespaceCache revision at the start of the transaction
+    uint64_t cache_revision;
+
+    /// NamespaceCache handle revision at the start of the transaction
+    uint64_t cache_handle_revision;
   };
 
   /** Writes human-readable version of <code>txn</code> to an ostream.
@@ -276,6 +287,67 @@ namespace Hyperspace {
      */
     void start_transaction(BDbTxn &txn);
 
+    /** Checks if the namespace cache can answer reads.
+     * The cache is only filled and consulted on the master, since replicas
+     * apply replicated updates underneath this class.
+     * @return <i>true</i> if the cache is enabled and we're the master
+     */
+    bool use_cache() {
+      return m_namespace_cache.enabled() && is_master();
+    }
+
+    /** Looks up whether a node exists, without a transaction.
+     * @param fname Node name
+     * @param existsp Address of variable to hold existence
+     * @param is_dir_p Address of variable to hold directory flag, may be 0
+     * @return <i>true</i> if the answer was found in the namespace cache
+     */
+    bool cached_exists(const String &fname, bool *existsp, bool *is_dir_p=0) {
+      return use_cache() && m_namespace_cache.exists(fname, existsp, is_dir_p);
+    }
+
+    /** Looks up an attribute, without a transaction.
+     * @param fname Node name
+     * @param aname Attribute name
+     * @param foundp Address of variable set to <i>true</i> if the attribute
+     * exists
+     * @param vbuf Buffer to hold the attribute value
+     * @return <i>true</i> if the answer was found in the namespace cache
+     */
+    bool cached_get_xattr(const String &fname, const String &aname,
+                          bool *foundp, Hypertable::DynamicBuffer &vbuf) {
+      return use_cache() &&
+        m_namespace_cache.get_xattr(fname, aname, foundp, vbuf);
+    }
+
+    /** Looks up a directory listing, without a transaction.
+     * @param fname Directory name
+     * @param listing Vector to hold the listing
+     * @return <i>true</i> if the listing was found in the namespace cache
+     */
+    bool cached_get_directory_listing(const String &fname,
+                                      std::vector<DirEntry> &listing) {
+      return use_cache() &&
+        m_namespace_cache.get_directory_listing(fname, listing);
+    }
+
+    /** Looks up the node of a handle, without a transaction.
+     * @param id Handle ID
+     * @param node_name String to hold the node name
+     * @return <i>true</i> if the handle was found in the namespace cache
+     */
+    bool cached_get_handle_node(uint64_t id, String &node_name) {
+      return use_cache() && m_namespace_cache.get_handle_node(id, node_name);
+    }
+
+    /** Returns namespace cache statistics.
+     * @param hitsp Address of variable to hold the number of cache hits
+     * @param missesp Address of variable to hold the number of cache misses
+     */
+    void get_cache_stats(uint64_t *hitsp, uint64_t *missesp) {
+      m_namespace_cache.get_stats(hitsp, missesp);
+    }
+
     bool get_xattr_i32(BDbTxn &txn, const String &fname,
                        const String &aname, uint32_t *valuep);
     void set_xattr_i32(BDbTxn &txn, const String &fname,
@@ -814,6 +886,9 @@ namespace Hyperspace {
     uint32_t  m_log_gc_interval;
     uint32_t m_max_unused_logs;
     boost::xtime m_last_log_gc_time;
+
+    /// In-memory copy of recently read namespace entries
+    NamespaceCache m_namespace_cache;
   };
 
   /** @} */
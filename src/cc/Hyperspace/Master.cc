@@ -859,6 +859,31 @@ Master::attr_get(ResponseCallbackAttrGet *cb, uint64_t session_id,
 
   std::vector<DynamicBufferPtr> dbufs;
   dbufs.reserve(attrs.size());
+
+  // answer from the namespace cache if all attributes are there
+  String node;
+  if (m_bdb_fs->use_cache() &&
+      get_cached_node(session_id, handle, name, node)) {
+    bool found;
+    foreach_ht (const String &attr, attrs) {
+      DynamicBufferPtr dbuf = new DynamicBuffer();
+      if (!m_bdb_fs->cached_get_xattr(node, attr, &found, *dbuf))
+        break;
+      dbufs.push_back(found ? dbuf : DynamicBufferPtr());
+    }
+    if (dbufs.size() == attrs.size()) {
+      int error;
+      if (attrs.size() == 1 && !dbufs.front()) {
+        HT_DEBUG_OUT << Error::get_text(Error::HYPERSPACE_ATTR_NOT_FOUND)
+                     << " - " << attrs.front() << HT_END;
+        cb->error(Error::HYPERSPACE_ATTR_NOT_FOUND, attrs.front());
+      }
+      else if ((error = cb->response(dbufs)) != Error::OK)
+        HT_ERRORF("Problem sending back response - %s", Error::get_text(error));
+      return;
+    }
+  }
+
   CommandContext ctx("attrget", session_id);
   HT_BDBTXN_BEGIN() {
     ctx.reset(&txn);
@@ -1038,6 +1063,14 @@ Master::exists(ResponseCallbackExists *cb, uint64_t session_id,
                const char *name) {
 
   bool file_exists = false;
+
+  if (m_bdb_fs->cached_exists(name, &file_exists)) {
+    int error;
+    if ((error = cb->response(file_exists)) != Error::OK)
+      HT_ERRORF("Problem sending back response - %s", Error::get_text(error));
+    return;
+  }
+
   CommandContext ctx("exists", session_id);
   HT_BDBTXN_BEGIN() {
     ctx.reset(&txn);
@@ -1059,6 +1092,96 @@ Master::exists(ResponseCallbackExists *cb, uint64_t session_id,
     HT_ERRORF("Problem sending back response - %s", Error::get_text(ctx.error));
 }
 
+/*
+ * batch does the following:
+ *
+ * > Start BDB txn
+ *   > Execute the operations in order, stopping at the first failure
+ * > Commit the txn, or abort it if an operation failed
+ * > Deliver event notifications and destroy the handles opened for attr_set
+ * > Send back the results of the completed operations
+ *
+ */
+void
+Master::batch(ResponseCallbackBatch *cb, uint64_t session_id, Batch &batch) {
+  bool commited = false;
+  size_t completed = 0;
+  std::vector<uint64_t> opened_handles;
+  CommandContext ctx("batch", session_id);
+
+  HT_BDBTXN_BEGIN() {
+    commited = false;
+    opened_handles.clear();
+    ctx.reset(&txn);
+
+    for (completed = 0; completed < batch.size(); completed++) {
+      Batch::Op &op = batch.get_op(completed);
+      const char *name = op.name.c_str();
+      switch (op.type) {
+      case Batch::EXISTS:
+        if (name[0] != '/' || (name[1] != '\0' && name[strlen(name)-1] == '/'))
+          ctx.set_error(Error::HYPERSPACE_BAD_PATHNAME, op.name);
+        else
+          exists(ctx, name, op.exists);
+        break;
+      case Batch::ATTR_EXISTS:
+        attr_exists(ctx, 0, name, op.attrs.front().c_str(), op.exists);
+        break;
+      case Batch::ATTRS_GET:
+        attr_get(ctx, 0, name, op.attrs, op.results);
+        break;
+      case Batch::ATTR_SET:
+        {
+          bool created;
+          uint64_t handle = 0, lock_generation;
+          std::vector<Attribute> none, attrs;
+          for (size_t i=0; i<op.attrs.size(); i++)
+            attrs.push_back(Attribute(op.attrs[i].c_str(), op.values[i].data(),
+                                      op.values[i].length()));
+          open(ctx, name, op.oflags, 0, none, handle, created, lock_generation);
+          if (!ctx.aborted) {
+            opened_handles.push_back(handle);
+            attr_set(ctx, handle, 0, attrs);
+            close(ctx, handle);
+          }
+        }
+        break;
+      }
+      if (ctx.aborted)
+        break;
+    }
+
+    if (ctx.aborted)
+      txn.abort();
+    else {
+      txn.commit();
+      commited = true;
+    }
+  }
+  HT_BDBTXN_END_CB(cb);
+
+  if (ctx.aborted)
+    HT_DEBUG_OUT << "batch stopped at operation " << completed << ": "
+                 << Error::get_text(ctx.error) << " - " << ctx.error_msg
+                 << HT_END;
+  batch.set_outcome(completed, ctx.error, ctx.error_msg);
+
+  if (commited) {
+    deliver_event_notifications(ctx);
+
+    // release locks, grant pending locks, delete ephemeral nodes etc.
+    foreach_ht (uint64_t handle, opened_handles) {
+      if (!destroy_handle(handle, ctx.error, ctx.error_msg)) {
+        cb->error(ctx.error, ctx.error_msg);
+        return;
+      }
+    }
+  }
+
+  if ((ctx.error = cb->response(batch)) != Error::OK)
+    HT_ERRORF("Problem sending back response - %s", Error::get_text(ctx.error));
+}
+
 /*
  * read_dir does the following:
  *
@@ -1073,6 +1196,17 @@ void
 Master::readdir(ResponseCallbackReaddir *cb, uint64_t session_id,
                 uint64_t handle) {
   std::vector<DirEntry> listing;
+
+  String node;
+  if (m_bdb_fs->use_cache() &&
+      get_cached_node(session_id, handle, 0, node) &&
+      m_bdb_fs->cached_get_directory_listing(node, listing)) {
+    int error;
+    if ((error = cb->response(listing)) != Error::OK)
+      HT_ERRORF("Problem sending back response - %s", Error::get_text(error));
+    return;
+  }
+
   CommandContext ctx("readdir", session_id);
   HT_BDBTXN_BEGIN() {
     ctx.reset(&txn);
@@ -1851,6 +1985,12 @@ void Master::do_maintenance() {
 
   m_bdb_fs->do_checkpoint();
 
+  if (m_verbose && m_bdb_fs->use_cache()) {
+    uint64_t hits, misses;
+    m_bdb_fs->get_cache_stats(&hits, &misses);
+    HT_INFOF("Namespace cache hits=%llu misses=%llu", (Llu)hits, (Llu)misses);
+  }
+
   {
     ScopedLock lock(m_maintenance_mutex);
     m_maintenance_outstanding = false;
@@ -2411,6 +2551,32 @@ bool Master::get_handle_node(CommandContext &ctx, uint64_t handle, const char* a
   return true;
 }
 
+/*
+ * Returns the node for a handle or name from the namespace cache
+ */
+bool Master::get_cached_node(uint64_t session_id, uint64_t handle,
+                             const char *name, String &node) {
+  SessionDataPtr session_data;
+  boost::xtime now;
+
+  // sessions leave the session map before they're removed from BDB
+  boost::xtime_get(&now, boost::TIME_UTC_);
+  if (!get_session(session_id, session_data) || session_data->is_expired(now))
+    return false;
+
+  if (name && *name) {
+    String parent_node, child_name;
+    bool exists;
+    node = name;
+    if (!find_parent_node(node, parent_node, child_name))
+      return false;
+    boost::trim_right_if(node, boost::is_any_of("/"));
+    return m_bdb_fs->cached_exists(node, &exists) && exists;
+  }
+
+  return m_bdb_fs->cached_get_handle_node(handle, node);
+}
+
 /*
  * Validates the session and returns the node for the name specified
  */
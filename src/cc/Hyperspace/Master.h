@@ -22,6 +22,7 @@
 #ifndef HYPERSPACE_MASTER_H
 #define HYPERSPACE_MASTER_H
 
+#include <Hyperspace/Batch.h>
 #include <Hyperspace/BerkeleyDbFilesystem.h>
 #include <Hyperspace/Protocol.h>
 #include <Hyperspace/ServerKeepaliveHandler.h>
@@ -29,6 +30,7 @@
 #include <Hyperspace/response/ResponseCallbackAttrGet.h>
 #include <Hyperspace/response/ResponseCallbackAttrIncr.h>
 #include <Hyperspace/response/ResponseCallbackAttrList.h>
+#include <Hyperspace/response/ResponseCallbackBatch.h>
 #include <Hyperspace/response/ResponseCallbackExists.h>
 #include <Hyperspace/response/ResponseCallbackLock.h>
 #include <Hyperspace/response/ResponseCallbackOpen.h>
@@ -106,6 +108,7 @@ namespace Hyperspace {
                    uint64_t session_id, uint64_t handle);
     void exists(ResponseCallbackExists *cb, uint64_t session_id,
                 const char *name);
+    void batch(ResponseCallbackBatch *cb, uint64_t session_id, Batch &batch);
     void readdir(ResponseCallbackReaddir *cb, uint64_t session_id,
                  uint64_t handle);
     void readdir_attr(ResponseCallbackReaddirAttr *cb, uint64_t session_id,
@@ -290,6 +293,19 @@ namespace Hyperspace {
      */
     bool find_parent_node(const std::string &normal_name,
                           std::string &parent_name, std::string &child_name);
+    /*
+     * Resolves the node of a read request from the namespace cache, without
+     * a BDB transaction.  Requires the session to be live.
+     *
+     * @param session_id session id
+     * @param handle handle to resolve if <code>name</code> is empty
+     * @param name node name, may be empty or 0
+     * @param node reference to string to hold the node name
+     * @return true if the node is cached and exists, false if the request
+     *         has to go through BDB
+     */
+    bool get_cached_node(uint64_t session_id, uint64_t handle,
+                         const char *name, String &node);
     bool destroy_handle(uint64_t handle, int &error, String &errmsg,
                         bool wait_for_notify=true);
     void release_lock(BDbTxn &txn, uint64_t handle, const String &node,
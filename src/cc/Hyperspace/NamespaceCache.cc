@@ -0,0 +1,205 @@
+/* -*- c++ -*-
+ * Copyright (C) 2007-2013 Hypertable, Inc.
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+/** @file
+ * Definitions for NamespaceCache.
+ * This file contains definitions for NamespaceCache, an in-memory copy of
+ * the parts of the Hyperspace namespace that have recently been read, used
+ * to answer read requests without a BerkeleyDB transaction.
+ */
+
+#include <Common/Compat.h>
+
+#include "NamespaceCache.h"
+
+using namespace Hyperspace;
+using namespace Hypertable;
+
+
+bool NamespaceCache::exists(const String &name, bool *existsp, bool *is_dirp) {
+  ScopedLock lock(m_mutex);
+  NodeMap::iterator iter = m_nodes.find(name);
+  if (iter == m_nodes.end() || !iter->second.exists_known) {
+    m_misses++;
+    return false;
+  }
+  *existsp = iter->second.exists;
+  if (is_dirp)
+    *is_dirp = iter->second.is_dir;
+  m_hits++;
+  return true;
+}
+
+
+bool NamespaceCache::get_xattr(const String &name, const String &attr,
+                               bool *foundp, DynamicBuffer &value) {
+  ScopedLock lock(m_mutex);
+  NodeMap::iterator iter = m_nodes.find(normalize(name));
+  if (iter != m_nodes.end()) {
+    std::map<String, Attr>::iterator aiter = iter->second.attrs.find(attr);
+    if (aiter != iter->second.attrs.end()) {
+      *foundp = aiter->second.found;
+      if (aiter->second.found)
+        value.set(aiter->second.value.data(), aiter->second.value.length());
+      m_hits++;
+      return true;
+    }
+  }
+  m_misses++;
+  return false;
+}
+
+
+bool NamespaceCache::get_directory_listing(const String &name,
+                                           std::vector<DirEntry> &listing) {
+  ScopedLock lock(m_mutex);
+  NodeMap::iterator iter = m_nodes.find(normalize(name));
+  if (iter == m_nodes.end() || !iter->second.listing_known) {
+    m_misses++;
+    return false;
+  }
+  listing = iter->second.listing;
+  m_hits++;
+  return true;
+}
+
+
+bool NamespaceCache::get_handle_node(uint64_t handle, String &node) {
+  ScopedLock lock(m_mutex);
+  HandleMap::iterator iter = m_handles.find(handle);
+  if (iter == m_handles.end()) {
+    m_misses++;
+    return false;
+  }
+  node = iter->second;
+  m_hits++;
+  return true;
+}
+
+
+void NamespaceCache::insert_exists(uint64_t revision, const String &name,
+                                   bool exists, bool is_dir) {
+  if (name.empty() || name[name.length()-1] == '/')
+    return;
+  ScopedLock lock(m_mutex);
+  if (revision != m_revision)
+    return;
+  Node &entry = node(name);
+  entry.exists_known = true;
+  entry.exists = exists;
+  entry.is_dir = is_dir;
+}
+
+
+void NamespaceCache::insert_xattr(uint64_t revision, const String &name,
+                                  const String &attr, const void *value,
+                                  size_t value_len, bool found) {
+  ScopedLock lock(m_mutex);
+  if (revision != m_revision)
+    return;
+  Attr &entry = node(normalize(name)).attrs[attr];
+  entry.found = found;
+  if (found)
+    entry.value.assign((const char *)value, value_len);
+  else
+    entry.value.clear();
+}
+
+
+void NamespaceCache::insert_directory_listing(uint64_t revision,
+    const String &name, const std::vector<DirEntry> &listing) {
+  ScopedLock lock(m_mutex);
+  if (revision != m_revision)
+    return;
+  Node &entry = node(normalize(name));
+  entry.listing_known = true;
+  entry.listing = listing;
+}
+
+
+void NamespaceCache::insert_handle_node(uint64_t revision, uint64_t handle,
+                                        const String &node) {
+  ScopedLock lock(m_mutex);
+  if (revision != m_handle_revision)
+    return;
+  if (m_handles.size() >= (size_t)m_max_entries)
+    m_handles.clear();
+  m_handles[handle] = node;
+}
+
+
+void NamespaceCache::invalidate_xattr(const String &name, const String &attr) {
+  ScopedLock lock(m_mutex);
+  m_revision++;
+  NodeMap::iterator iter = m_nodes.find(normalize(name));
+  if (iter != m_nodes.end())
+    iter->second.attrs.erase(attr);
+}
+
+
+void NamespaceCache::invalidate_node(const String &name) {
+  String normal_name = normalize(name);
+  ScopedLock lock(m_mutex);
+  m_revision++;
+  m_nodes.erase(normal_name);
+
+  size_t lastslash = normal_name.rfind('/');
+  if (lastslash == String::npos)
+    return;
+  NodeMap::iterator iter =
+    m_nodes.find(lastslash ? normal_name.substr(0, lastslash) : "/");
+  if (iter != m_nodes.end()) {
+    iter->second.listing_known = false;
+    iter->second.listing.clear();
+  }
+}
+
+
+void NamespaceCache::invalidate_handle(uint64_t handle) {
+  ScopedLock lock(m_mutex);
+  m_handle_revision++;
+  m_handles.erase(handle);
+}
+
+
+void NamespaceCache::clear() {
+  ScopedLock lock(m_mutex);
+  m_revision++;
+  m_handle_revision++;
+  m_nodes.clear();
+  m_handles.clear();
+}
+
+
+NamespaceCache::Node &NamespaceCache::node(const String &name) {
+  if (m_nodes.size() >= (size_t)m_max_entries &&
+      m_nodes.find(name) == m_nodes.end())
+    m_nodes.clear();
+  return m_nodes[name];
+}
+
+
+String NamespaceCache::normalize(const String &name) {
+  size_t length = name.length();
+  while (length > 1 && name[length-1] == '/')
+    length--;
+  return name.substr(0, length);
+}
@@ -0,0 +1,222 @@
+/* -*- c++ -*-
+ * Copyright (C) 2007-2013 Hypertable, Inc.
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+/** @file
+ * Declarations for NamespaceCache.
+ * This file contains declarations for NamespaceCache, an in-memory copy of
+ * the parts of the Hyperspace namespace that have recently been read, used
+ * to answer read requests without a BerkeleyDB transaction.
+ */
+
+#ifndef HYPERSPACE_NAMESPACECACHE_H
+#define HYPERSPACE_NAMESPACECACHE_H
+
+#include <Hyperspace/DirEntry.h>
+
+#include <Common/DynamicBuffer.h>
+#include <Common/Mutex.h>
+#include <Common/String.h>
+
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+namespace Hyperspace {
+
+  using namespace Hypertable;
+
+  /** @addtogroup Hyperspace
+   * @{
+   */
+
+  /** In-memory cache of node existence, attribute values, directory listings
+   * and handle nodes.
+   * Entries are filled in by the BerkeleyDB read path and dropped by the
+   * write path as soon as the corresponding key has been written, so the
+   * cache never holds a value that differs from the committed database.
+   * Fills are tagged with the revision obtained before the transaction that
+   * read them started (see revision()); a fill is discarded if any
+   * invalidation happened in the meantime, since the value read may
+   * predate it.  Existence is only cached for names without a trailing
+   * '/', which BerkeleyDbFilesystem::exists() treats differently.
+   */
+  class NamespaceCache {
+  public:
+
+    /** Constructor.
+     * @param max_entries Maximum number of cached nodes, the cache is
+     * cleared when it grows beyond this; 0 disables the cache
+     */
+    NamespaceCache(int32_t max_entries)
+      : m_max_entries(max_entries), m_revision(1), m_handle_revision(1),
+        m_hits(0), m_misses(0) { }
+
+    /** Checks if the cache is enabled.
+     * @return <i>true</i> if the cache is enabled
+     */
+    bool enabled() { return m_max_entries > 0; }
+
+    /** Returns the namespace revision.  Must be obtained before the
+     * transaction whose reads are passed to the insert methods starts.
+     * @return Current namespace revision
+     */
+    uint64_t revision() {
+      ScopedLock lock(m_mutex);
+      return m_revision;
+    }
+
+    /** Returns the handle revision (see revision()).
+     * @return Current handle revision
+     */
+    uint64_t handle_revision() {
+      ScopedLock lock(m_mutex);
+      return m_handle_revision;
+    }
+
+    /** Looks up whether a node exists.
+     * @param name Node name
+     * @param existsp Address of variable to hold existence
+     * @param is_dirp Address of variable to hold directory flag, may be 0
+     * @return <i>true</i> if the answer is cached
+     */
+    bool exists(const String &name, bool *existsp, bool *is_dirp);
+
+    /** Looks up an attribute.
+     * @param name Node name
+     * @param attr Attribute name
+     * @param foundp Address of variable set to <i>true</i> if the node has
+     * the attribute
+     * @param value Buffer to hold the attribute value if found
+     * @return <i>true</i> if the answer is cached
+     */
+    bool get_xattr(const String &name, const String &attr, bool *foundp,
+                   DynamicBuffer &value);
+
+    /** Looks up a directory listing.
+     * @param name Directory name
+     * @param listing Vector to hold the listing
+     * @return <i>true</i> if the listing is cached
+     */
+    bool get_directory_listing(const String &name,
+                               std::vector<DirEntry> &listing);
+
+    /** Looks up the node of an open handle.
+     * @param handle Handle ID
+     * @param node String to hold the node name
+     * @return <i>true</i> if the handle is cached
+     */
+    bool get_handle_node(uint64_t handle, String &node);
+
+    /** @name Fill methods
+     * Cache the result of a BerkeleyDB read.  Each takes the revision
+     * (or handle revision) obtained before the reading transaction started
+     * and drops the entry if it has changed since.
+     * @{
+     */
+    void insert_exists(uint64_t revision, const String &name, bool exists,
+                       bool is_dir);
+    void insert_xattr(uint64_t revision, const String &name,
+                      const String &attr, const void *value,
+                      size_t value_len, bool found);
+    void insert_directory_listing(uint64_t revision, const String &name,
+                                  const std::vector<DirEntry> &listing);
+    void insert_handle_node(uint64_t revision, uint64_t handle,
+                            const String &node);
+    /** @} */
+
+    /** Drops a cached attribute.  Called after the attribute is written.
+     * @param name Node name
+     * @param attr Attribute name
+     */
+    void invalidate_xattr(const String &name, const String &attr);
+
+    /** Drops a node, its attributes and the listing of its parent
+     * directory.  Called after a node is created or deleted.
+     * @param name Node name
+     */
+    void invalidate_node(const String &name);
+
+    /** Drops a handle.  Called after the handle is deleted.
+     * @param handle Handle ID
+     */
+    void invalidate_handle(uint64_t handle);
+
+    /** Drops all entries.  Called when mastership changes, since the
+     * database may have been changed by another master in the meantime.
+     */
+    void clear();
+
+    /** Returns lookup statistics.
+     * @param hitsp Address of variable to hold the number of cache hits
+     * @param missesp Address of variable to hold the number of cache misses
+     */
+    void get_stats(uint64_t *hitsp, uint64_t *missesp) {
+      ScopedLock lock(m_mutex);
+      *hitsp = m_hits;
+      *missesp = m_misses;
+    }
+
+  private:
+
+    /// Cached attribute value
+    struct Attr {
+      bool found;
+      String value;
+    };
+
+    /// Cached state of one node
+    struct Node {
+      Node() : exists_known(false), exists(false), is_dir(false),
+               listing_known(false) { }
+      bool exists_known;
+      bool exists;
+      bool is_dir;
+      bool listing_known;
+      std::vector<DirEntry> listing;
+      std::map<String, Attr> attrs;
+    };
+
+    typedef std::unordered_map<String, Node> NodeMap;
+    typedef std::unordered_map<uint64_t, String> HandleMap;
+
+    /** Returns the entry for a node, creating it if necessary.  Clears the
+     * cache first if it is full.
+     */
+    Node &node(const String &name);
+
+    /** Returns the cached form of a node name, without trailing '/'. */
+    static String normalize(const String &name);
+
+    Mutex m_mutex;
+    int32_t m_max_entries;
+    uint64_t m_revision;
+    uint64_t m_handle_revision;
+    uint64_t m_hits;
+    uint64_t m_misses;
+    NodeMap m_nodes;
+    HandleMap m_handles;
+  };
+
+  /** @} */
+
+} // namespace Hyperspace
+
+#endif // HYPERSPACE_NAMESPACECACHE_H
@@ -36,6 +36,7 @@
 
 #include "AsyncComm/CommHeader.h"
 
+#include "Batch.h"
 #include "Protocol.h"
 
 using namespace std;
@@ -69,7 +70,8 @@ const char *Hyperspace::Protocol::command_strs[COMMAND_MAX] = {
   "readdirattr",
   "attrincr",
   "readpathattr",
-  "shutdown"
+  "shutdown",
+  "batch"
 };
 
 
@@ -481,6 +483,14 @@ CommBuf *Hyperspace::Protocol::create_exists_request(const std::string &name) {
   return cbuf;
 }
 
+CommBuf *Hyperspace::Protocol::create_batch_request(const Batch &batch) {
+  // operations may name different files, so no gid is set
+  CommHeader header(COMMAND_BATCH);
+  CommBuf *cbuf = new CommBuf(header, batch.encoded_length_ops());
+  batch.encode_ops(cbuf->get_data_ptr_address());
+  return cbuf;
+}
+
 
 CommBuf *
 Hyperspace::Protocol::create_lock_request(uint64_t handle, uint32_t mode,
@@ -40,6 +40,8 @@
 
 namespace Hyperspace {
 
+  class Batch;
+
   /** @addtogroup Hyperspace
    * @{
    */
@@ -165,6 +167,7 @@ namespace Hyperspace {
     static CommBuf *create_readpath_attr_request(uint64_t handle, const std::string *name,
                                                  const std::string &attr);
     static CommBuf *create_exists_request(const std::string &name);
+    static CommBuf *create_batch_request(const Batch &batch);
 
     static CommBuf *
     create_lock_request(uint64_t handle, uint32_t mode, bool try_lock);
@@ -202,7 +205,8 @@ namespace Hyperspace {
     static const uint64_t COMMAND_ATTRINCR       = 22;
     static const uint64_t COMMAND_READPATHATTR   = 23;
     static const uint64_t COMMAND_SHUTDOWN       = 24;
-    static const uint64_t COMMAND_MAX            = 25;
+    static const uint64_t COMMAND_BATCH          = 25;
+    static const uint64_t COMMAND_MAX            = 26;
 
     static const char * command_strs[COMMAND_MAX];
 
@@ -38,6 +38,7 @@
 #include "request/RequestHandlerOpen.h"
 #include "request/RequestHandlerClose.h"
 #include "request/RequestHandlerExists.h"
+#include "request/RequestHandlerBatch.h"
 #include "request/RequestHandlerReaddir.h"
 #include "request/RequestHandlerReaddirAttr.h"
 #include "request/RequestHandlerReadpathAttr.h"
@@ -145,6 +146,10 @@ void ServerConnectionHandler::handle(EventPtr &event) {
         handler = new RequestHandlerExists(m_comm, m_master_ptr.get(),
                                            m_session_id, event);
         break;
+      case Protocol::COMMAND_BATCH:
+        handler = new RequestHandlerBatch(m_comm, m_master_ptr.get(),
+                                          m_session_id, event);
+        break;
       case Protocol::COMMAND_READDIR:
         handler = new RequestHandlerReaddir(m_comm, m_master_ptr.get(),
                                             m_session_id, event);
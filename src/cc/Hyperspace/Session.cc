@@ -654,6 +654,52 @@ Session::attrs_get(const std::string &name, const std::vector<std::string> &attr
   }
 }
 
+void Session::execute(Batch &batch, Timer *timer) {
+  DispatchHandlerSynchronizer sync_handler;
+  Hypertable::EventPtr event_ptr;
+
+  for (size_t i=0; i<batch.size(); i++) {
+    String normal_name;
+    normalize_name(batch.get_op(i).name, normal_name);
+    batch.get_op(i).name = normal_name;
+  }
+
+  CommBufPtr cbuf_ptr(Protocol::create_batch_request(batch));
+
+ try_again:
+  if (!wait_for_safe())
+    HT_THROW(Error::HYPERSPACE_EXPIRED_SESSION, "");
+
+  int error = send_message(cbuf_ptr, &sync_handler, timer);
+  if (error == Error::OK) {
+    if (!sync_handler.wait_for_reply(event_ptr)) {
+      int code = (int)Protocol::response_code(event_ptr.get());
+      // Masters that predate COMMAND_BATCH reject it as unimplemented
+      if (code == Error::PROTOCOL_ERROR &&
+          Protocol::string_format_message(event_ptr.get()).find(
+              "Unimplemented command") != String::npos)
+        HT_THROW(Error::NOT_IMPLEMENTED,
+                 "Hyperspace master does not support 'batch'");
+      HT_THROWF(code, "Hyperspace 'batch' error, %u operations",
+                (unsigned)batch.size());
+    }
+    else {
+      const uint8_t *decode_ptr = event_ptr->payload + 4;
+      size_t decode_remain = event_ptr->payload_len - 4;
+      try {
+        batch.decode_results(&decode_ptr, &decode_remain);
+      }
+      catch (Exception &e) {
+        HT_THROW2(Error::PROTOCOL_ERROR, e, "");
+      }
+    }
+  }
+  else {
+    state_transition(Session::STATE_JEOPARDY);
+    goto try_again;
+  }
+}
+
 bool
 Session::attr_exists(uint64_t handle, const std::string& attr, Timer *timer)
 {
@@ -22,6 +22,7 @@
 #ifndef HYPERSPACE_SESSION_H
 #define HYPERSPACE_SESSION_H
 
+#include <Hyperspace/Batch.h>
 #include <Hyperspace/ClientKeepaliveHandler.h>
 #include <Hyperspace/DirEntry.h>
 #include <Hyperspace/DirEntryAttr.h>
@@ -444,6 +445,18 @@ namespace Hyperspace {
     void attrs_get(const std::string &name, const std::vector<std::string> &attrs,
                   std::vector<DynamicBufferPtr> &values, Timer *timer=0);
 
+    /** Executes a batch of operations in a single request.  The operations
+     * are executed by the master in one transaction; if one of them fails,
+     * none of the batch's updates are applied and the failure is reported
+     * through Batch::get_error() rather than by throwing (see Batch).
+     * If the master is too old to support batches, Error::NOT_IMPLEMENTED
+     * is thrown and the operations have to be issued one at a time.
+     *
+     * @param batch operations to execute, receives the results
+     * @param timer maximum wait timer
+     */
+    void execute(Batch &batch, Timer *timer=0);
+
     /** Deletes an extended attribute of a file.
      *
      * @param handle file handle
@@ -0,0 +1,49 @@
+/* -*- c++ -*-
+ * Copyright (C) 2007-2013 Hypertable, Inc.
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+/** @file
+ * Definitions for ResponseCallbackBatch.
+ * This file contains definitions for ResponseCallbackBatch, a response
+ * callback class for sending the result of a Master::batch() call
+ * to the requesting client.
+ */
+
+#include "Common/Compat.h"
+#include "Common/Error.h"
+
+#include "AsyncComm/CommBuf.h"
+
+#include "ResponseCallbackBatch.h"
+
+using namespace Hyperspace;
+using namespace Hypertable;
+
+/*
+ *
+ */
+int ResponseCallbackBatch::response(const Batch &batch) {
+  CommHeader header;
+  header.initialize_from_request_header(m_event->header);
+  CommBufPtr cbp(new CommBuf(header, 4 + batch.encoded_length_results()));
+  cbp->append_i32(Error::OK);
+  batch.encode_results(cbp->get_data_ptr_address());
+  return m_comm->send_response(m_event->addr, cbp);
+}
@@ -0,0 +1,76 @@
+/* -*- c++ -*-
+ * Copyright (C) 2007-2013 Hypertable, Inc.
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+/** @file
+ * Declarations for ResponseCallbackBatch.
+ * This file contains declarations for ResponseCallbackBatch, a response
+ * callback class for sending the result of a Master::batch() call
+ * to the requesting client.
+ */
+
+#ifndef HYPERSPACE_RESPONSECALLBACKBATCH_H
+#define HYPERSPACE_RESPONSECALLBACKBATCH_H
+
+#include "Common/Error.h"
+
+#include "AsyncComm/CommBuf.h"
+#include "AsyncComm/ResponseCallback.h"
+
+#include "Hyperspace/Batch.h"
+
+namespace Hyperspace {
+
+  /** @addtogroup hyperspaceResponse
+   * @{
+   */
+
+  /** Sends back result of a <i>batch</i> request. */
+  class ResponseCallbackBatch : public Hypertable::ResponseCallback {
+  public:
+
+    /** Constructor.
+     * @param comm Comm instance
+     * @param event %Comm event that originated the request
+     */
+    ResponseCallbackBatch(Hypertable::Comm *comm,
+                          Hypertable::EventPtr &event)
+      : Hypertable::ResponseCallback(comm, event) { }
+
+    /** Sends back result of a <i>batch</i> request.
+     * The response message is encoded as follows:
+     * <table>
+     *   <tr><th>Encoding</th><th>Description</th></tr>
+     *   <tr><td>i32</td><td>Error::OK</td></tr>
+     *   <tr><td>variable</td><td>Outcome and results of the completed
+     *   operations, see Batch::encode_results()</td></tr>
+     * </table>
+     * A failed operation is reported in the outcome, not as an error
+     * response, so the client receives the results that precede it.
+     * @param batch Executed batch
+     * @return Error code returned from Comm::send_response()
+     */
+    int response(const Batch &batch);
+  };
+
+  /** @} */
+}
+
+#endif // HYPERSPACE_RESPONSECALLBACKBATCH_H
@@ -0,0 +1,104 @@
+/* -*- c++ -*-
+ * Copyright (C) 2007-2013 Hypertable, Inc.
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+#include "Common/Compat.h"
+#include "Common/Error.h"
+#include "Common/Logger.h"
+#include "Common/StaticBuffer.h"
+
+#include "Hyperspace/Batch.h"
+
+#include <iostream>
+
+using namespace Hyperspace;
+using namespace Hypertable;
+using namespace std;
+
+int main(int argc, char **argv) {
+  Batch batch;
+  std::vector<String> attrs;
+  std::vector<Attribute> set_attrs;
+
+  attrs.push_back("id");
+  attrs.push_back("schema");
+  set_attrs.push_back(Attribute("name", "foo\0bar", 7));
+
+  batch.exists("/hypertable/tables/1");
+  batch.attr_exists("/hypertable/tables/1", "x");
+  batch.attrs_get("/hypertable/namemap/names/foo", attrs);
+  batch.attr_set("/hypertable/namemap/ids/2", 0x1f, set_attrs);
+  batch.exists("/never/reached");
+
+  // client -> master
+  StaticBuffer request(batch.encoded_length_ops());
+  uint8_t *ptr = request.base;
+  batch.encode_ops(&ptr);
+  HT_ASSERT(ptr == request.base + request.size);
+
+  Batch server;
+  const uint8_t *decode_ptr = request.base;
+  size_t decode_remain = request.size;
+  server.decode_ops(&decode_ptr, &decode_remain);
+  HT_ASSERT(decode_remain == 0);
+  HT_ASSERT(server.size() == 5);
+  HT_ASSERT(server.get_op(1).attrs.front() == "x");
+  HT_ASSERT(server.get_op(2).attrs == attrs);
+  HT_ASSERT(server.get_op(3).oflags == 0x1f);
+  HT_ASSERT(server.get_op(3).values.front() == String("foo\0bar", 7));
+
+  // master executes the first four operations, the last one fails
+  server.get_op(0).exists = true;
+  server.get_op(1).exists = false;
+  server.get_op(2).results.push_back(new DynamicBuffer());
+  server.get_op(2).results.back()->add("42", 2);
+  server.get_op(2).results.push_back(0);
+  server.set_outcome(4, Error::HYPERSPACE_FILE_NOT_FOUND, "/never/reached");
+
+  // master -> client
+  StaticBuffer response(server.encoded_length_results());
+  ptr = response.base;
+  server.encode_results(&ptr);
+  HT_ASSERT(ptr == response.base + response.size);
+
+  decode_ptr = response.base;
+  decode_remain = response.size;
+  batch.decode_results(&decode_ptr, &decode_remain);
+  HT_ASSERT(decode_remain == 0);
+  HT_ASSERT(batch.completed() == 4);
+  HT_ASSERT(batch.get_error() == Error::HYPERSPACE_FILE_NOT_FOUND);
+  HT_ASSERT(batch.get_error_msg() == "/never/reached");
+  HT_ASSERT(batch.get_exists(0) && !batch.get_exists(1));
+  HT_ASSERT(batch.get_values(2).size() == 2);
+  HT_ASSERT(!strcmp((const char *)batch.get_values(2)[0]->base, "42"));
+  HT_ASSERT(!batch.get_values(2)[1]);
+
+  // an empty value is distinct from a missing attribute
+  server.get_op(2).results[0]->clear();
+  ptr = response.base;
+  server.encode_results(&ptr);
+  decode_ptr = response.base;
+  decode_remain = response.size;
+  batch.decode_results(&decode_ptr, &decode_remain);
+  HT_ASSERT(batch.get_values(2)[0] && batch.get_values(2)[0]->fill() == 0);
+
+  cout << "SUCCESS" << endl;
+  return 0;
+}
@@ -66,6 +66,7 @@ int main(int argc, char **argv) {
   props->set("Hyperspace.Checkpoint.Size", 1000000);
   props->set("Hyperspace.LogGc.Interval", 3600000);
   props->set("Hyperspace.LogGc.MaxUnusedLogs", 200);
+  props->set("Hyperspace.ReadCache.MaxEntries", 1000);
 
   bdb_fs = new BerkeleyDbFilesystem(props, filename, thread_ids);
 
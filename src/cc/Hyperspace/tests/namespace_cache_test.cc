@@ -0,0 +1,260 @@
+/* -*- c++ -*-
+ * Copyright (C) 2007-2013 Hypertable, Inc.
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+#include "Common/Compat.h"
+#include "Common/Config.h"
+#include "Common/Error.h"
+#include "Common/FileUtils.h"
+#include "Common/Init.h"
+#include "Common/Logger.h"
+#include "Common/Properties.h"
+#include "Common/String.h"
+#include "Common/System.h"
+#include "Common/Thread.h"
+
+#include "Hyperspace/BerkeleyDbFilesystem.h"
+#include "Hyperspace/NamespaceCache.h"
+
+#include <cstdlib>
+#include <vector>
+
+extern "C" {
+#include <unistd.h>
+}
+
+using namespace Hyperspace;
+using namespace Hypertable;
+using namespace Config;
+using namespace std;
+
+namespace {
+
+  void test_lookups() {
+    NamespaceCache cache(100);
+    DynamicBuffer value;
+    std::vector<DirEntry> listing;
+    String node;
+    bool exists, is_dir, found;
+    uint64_t hits, misses;
+
+    // misses until filled
+    HT_ASSERT(!cache.exists("/foo", &exists, &is_dir));
+    HT_ASSERT(!cache.get_xattr("/foo", "attr1", &found, value));
+
+    cache.insert_exists(cache.revision(), "/foo", true, true);
+    cache.insert_xattr(cache.revision(), "/foo", "attr1", "42", 2, true);
+    cache.insert_xattr(cache.revision(), "/foo", "attr2", 0, 0, false);
+    listing.push_back(DirEntry());
+    listing.back().name = "bar";
+    listing.back().is_dir = false;
+    cache.insert_directory_listing(cache.revision(), "/foo/", listing);
+    cache.insert_handle_node(cache.handle_revision(), 7, "/foo");
+
+    HT_ASSERT(cache.exists("/foo", &exists, &is_dir) && exists && is_dir);
+    HT_ASSERT(cache.get_xattr("/foo/", "attr1", &found, value) && found);
+    HT_ASSERT(value.fill() == 2 && !memcmp(value.base, "42", 2));
+    HT_ASSERT(cache.get_xattr("/foo", "attr2", &found, value) && !found);
+    listing.clear();
+    HT_ASSERT(cache.get_directory_listing("/foo", listing));
+    HT_ASSERT(listing.size() == 1 && listing[0].name == "bar");
+    HT_ASSERT(cache.get_handle_node(7, node) && node == "/foo");
+
+    // existence of names with a trailing '/' is never cached
+    cache.insert_exists(cache.revision(), "/bar/", true, true);
+    HT_ASSERT(!cache.exists("/bar/", &exists, &is_dir));
+
+    cache.get_stats(&hits, &misses);
+    HT_ASSERT(hits == 5 && misses == 3);
+  }
+
+  void test_invalidation() {
+    NamespaceCache cache(100);
+    DynamicBuffer value;
+    std::vector<DirEntry> listing;
+    String node;
+    bool exists, found;
+
+    cache.insert_xattr(cache.revision(), "/foo", "attr1", "1", 1, true);
+    cache.insert_xattr(cache.revision(), "/foo", "attr2", "2", 1, true);
+    cache.invalidate_xattr("/foo", "attr1");
+    HT_ASSERT(!cache.get_xattr("/foo", "attr1", &found, value));
+    HT_ASSERT(cache.get_xattr("/foo", "attr2", &found, value) && found);
+
+    // creating or deleting a node drops it and its parent's listing
+    cache.insert_exists(cache.revision(), "/foo/bar", false, false);
+    cache.insert_directory_listing(cache.revision(), "/foo", listing);
+    cache.invalidate_node("/foo/bar");
+    HT_ASSERT(!cache.exists("/foo/bar", &exists, 0));
+    HT_ASSERT(!cache.get_directory_listing("/foo", listing));
+    HT_ASSERT(cache.get_xattr("/foo", "attr2", &found, value) && found);
+
+    cache.insert_handle_node(cache.handle_revision(), 7, "/foo");
+    cache.insert_handle_node(cache.handle_revision(), 8, "/foo");
+    cache.invalidate_handle(7);
+    HT_ASSERT(!cache.get_handle_node(7, node));
+    HT_ASSERT(cache.get_handle_node(8, node));
+
+    cache.clear();
+    HT_ASSERT(!cache.get_xattr("/foo", "attr2", &found, value));
+    HT_ASSERT(!cache.get_handle_node(8, node));
+  }
+
+  void test_stale_fill() {
+    NamespaceCache cache(100);
+    DynamicBuffer value;
+    std::vector<DirEntry> listing;
+    String node;
+    bool exists, found;
+
+    // a read that started before a write must not be cached
+    uint64_t revision = cache.revision();
+    uint64_t handle_revision = cache.handle_revision();
+    cache.invalidate_xattr("/foo", "attr1");
+    cache.invalidate_handle(7);
+    cache.insert_xattr(revision, "/foo", "attr1", "old", 3, true);
+    cache.insert_exists(revision, "/foo", true, false);
+    cache.insert_directory_listing(revision, "/", listing);
+    cache.insert_handle_node(handle_revision, 7, "/foo");
+    HT_ASSERT(!cache.get_xattr("/foo", "attr1", &found, value));
+    HT_ASSERT(!cache.exists("/foo", &exists, 0));
+    HT_ASSERT(!cache.get_directory_listing("/", listing));
+    HT_ASSERT(!cache.get_handle_node(7, node));
+
+    // nor one that straddles a mastership change
+    revision = cache.revision();
+    handle_revision = cache.handle_revision();
+    cache.clear();
+    cache.insert_xattr(revision, "/foo", "attr1", "old", 3, true);
+    cache.insert_handle_node(handle_revision, 7, "/foo");
+    HT_ASSERT(!cache.get_xattr("/foo", "attr1", &found, value));
+    HT_ASSERT(!cache.get_handle_node(7, node));
+
+    // fills with the current revision are kept
+    cache.insert_xattr(cache.revision(), "/foo", "attr1", "new", 3, true);
+    HT_ASSERT(cache.get_xattr("/foo", "attr1", &found, value) && found);
+  }
+
+  /**
+   * Checks that BerkeleyDbFilesystem fills and invalidates the cache, in
+   * particular that closing a handle, or tearing down its session, drops
+   * it so that Master::attr_get() and Master::readdir() fall through to
+   * BerkeleyDB and fail with HYPERSPACE_INVALID_HANDLE.
+   */
+  void test_bdb_fs(const String &dir) {
+    PropertiesPtr props = new Properties();
+    vector<Thread::id> thread_ids;
+    DynamicBuffer value;
+    String node;
+    bool found;
+
+    thread_ids.push_back(ThisThread::get_id());
+    props->set("Hyperspace.Checkpoint.Size", 1000000);
+    props->set("Hyperspace.LogGc.Interval", 3600000);
+    props->set("Hyperspace.LogGc.MaxUnusedLogs", 200);
+    props->set("Hyperspace.ReadCache.MaxEntries", 1000);
+
+    BerkeleyDbFilesystem *bdb_fs =
+      new BerkeleyDbFilesystem(props, dir, thread_ids);
+    HT_ASSERT(bdb_fs->use_cache());
+
+    {
+      BDbTxn txn;
+      bdb_fs->start_transaction(txn);
+      bdb_fs->mkdir(txn, "/foo");
+      bdb_fs->set_xattr(txn, "/foo", "attr1", "1", 1);
+      bdb_fs->create_session(txn, 1, "127.0.0.1:38040");
+      bdb_fs->create_handle(txn, 7, "/foo", 0, 0, 1, false, 0);
+      bdb_fs->add_session_handle(txn, 1, 7);
+      bdb_fs->create_handle(txn, 8, "/foo", 0, 0, 1, false, 0);
+      bdb_fs->add_session_handle(txn, 1, 8);
+      txn.commit();
+    }
+
+    // reads fill the cache
+    {
+      BDbTxn txn;
+      bdb_fs->start_transaction(txn);
+      HT_ASSERT(bdb_fs->get_xattr(txn, "/foo", "attr1", value));
+      bdb_fs->get_handle_node(txn, 7, node);
+      bdb_fs->get_handle_node(txn, 8, node);
+      txn.commit();
+    }
+    HT_ASSERT(bdb_fs->cached_get_xattr("/foo", "attr1", &found, value));
+    HT_ASSERT(found && value.fill() == 1 && *value.base == '1');
+    HT_ASSERT(bdb_fs->cached_get_handle_node(7, node) && node == "/foo");
+    HT_ASSERT(bdb_fs->cached_get_handle_node(8, node));
+
+    // writes invalidate it
+    {
+      BDbTxn txn;
+      bdb_fs->start_transaction(txn);
+      bdb_fs->set_xattr(txn, "/foo", "attr1", "2", 1);
+      txn.commit();
+    }
+    HT_ASSERT(!bdb_fs->cached_get_xattr("/foo", "attr1", &found, value));
+
+    // closing a handle invalidates it
+    {
+      BDbTxn txn;
+      bdb_fs->start_transaction(txn);
+      bdb_fs->delete_handle(txn, 7);
+      bdb_fs->delete_session_handle(txn, 1, 7);
+      txn.commit();
+    }
+    HT_ASSERT(!bdb_fs->cached_get_handle_node(7, node));
+    {
+      BDbTxn txn;
+      bdb_fs->start_transaction(txn);
+      HT_ASSERT(!bdb_fs->handle_exists(txn, 7));
+      txn.commit();
+    }
+
+    // so does tearing down its session
+    {
+      BDbTxn txn;
+      bdb_fs->start_transaction(txn);
+      bdb_fs->delete_session(txn, 1);
+      txn.commit();
+    }
+    HT_ASSERT(!bdb_fs->cached_get_handle_node(8, node));
+
+    delete bdb_fs;
+  }
+
+}
+
+int main(int argc, char **argv) {
+  init_with_policy<DefaultPolicy>(argc, argv);
+
+  System::initialize(System::locate_install_dir(argv[0]));
+
+  test_lookups();
+  test_invalidation();
+  test_stale_fill();
+
+  String dir = format("/tmp/namespace_cache_test%d", (int)getpid());
+  FileUtils::mkdirs(dir);
+  test_bdb_fs(dir);
+  String command = String("/bin/rm -rf ") + dir;
+  HT_ASSERT(system(command.c_str()) == 0);
+
+  return 0;
+}
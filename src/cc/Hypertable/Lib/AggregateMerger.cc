@@ -0,0 +1,121 @@
+/* -*- c++ -*-
+ * Copyright (C) 2007-2013 Hypertable, Inc.
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 3 of the
+ * License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+#include "Common/Compat.h"
+
+#include <algorithm>
+#include <cstdlib>
+
+#include "Common/Logger.h"
+
+#include "AggregateMerger.h"
+#include "ScanSpec.h"
+
+using namespace Hypertable;
+
+
+void AggregateMerger::add(const Cell &cell) {
+  const char *group = cell.column_qualifier ? cell.column_qualifier : "";
+
+  HT_ASSERT(!m_finished);
+
+  if (m_next == m_ready.size()) {
+    m_ready.clear();
+    m_next = 0;
+  }
+
+  if (m_have_group && m_group != group)
+    flush();
+
+  if (!m_have_group) {
+    m_group = group;
+    m_have_group = true;
+  }
+
+  String value((const char *)cell.value, cell.value_len);
+  int64_t numeric = strtoll(value.c_str(), 0, 10);
+
+  foreach_ht (Result &partial, m_partials) {
+    if (partial.family != cell.column_family)
+      continue;
+    switch (m_function) {
+    case ScanSpec::AGGREGATE_MIN:
+      partial.numeric = std::min(partial.numeric, numeric);
+      break;
+    case ScanSpec::AGGREGATE_MAX:
+      partial.numeric = std::max(partial.numeric, numeric);
+      break;
+    default:
+      partial.numeric += numeric;
+      break;
+    }
+    partial.timestamp = std::max(partial.timestamp, cell.timestamp);
+    return;
+  }
+
+  Result partial;
+  partial.family = cell.column_family;
+  partial.numeric = numeric;
+  partial.timestamp = cell.timestamp;
+  m_partials.push_back(partial);
+}
+
+
+void AggregateMerger::finish() {
+  if (m_next == m_ready.size()) {
+    m_ready.clear();
+    m_next = 0;
+  }
+  flush();
+  m_finished = true;
+}
+
+
+bool AggregateMerger::next(Cell &cell) {
+  if (m_next == m_ready.size())
+    return false;
+
+  Result &result = m_ready[m_next++];
+  cell.row_key = result.row.c_str();
+  cell.column_family = result.family.c_str();
+  cell.column_qualifier = "";
+  cell.timestamp = result.timestamp;
+  cell.revision = AUTO_ASSIGN;
+  cell.value = (const uint8_t *)result.value.data();
+  cell.value_len = result.value.length();
+  cell.flag = FLAG_INSERT;
+  return true;
+}
+
+
+void AggregateMerger::flush() {
+  if (!m_have_group)
+    return;
+
+  foreach_ht (Result &partial, m_partials) {
+    partial.row = m_group;
+    partial.value = format("%lld", (Lld)partial.numeric);
+    m_ready.push_back(partial);
+  }
+
+  m_partials.clear();
+  m_have_group = false;
+}
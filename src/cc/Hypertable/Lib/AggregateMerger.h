@@ -0,0 +1,95 @@
+/* -*- c++ -*-
+ * Copyright (C) 2007-2013 Hypertable, Inc.
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 3 of the
+ * License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+#ifndef HYPERTABLE_AGGREGATEMERGER_H
+#define HYPERTABLE_AGGREGATEMERGER_H
+
+#include <vector>
+
+#include "Common/ReferenceCount.h"
+#include "Common/String.h"
+
+#include "Cell.h"
+
+namespace Hypertable {
+
+  /**
+   * Merges the partial aggregate cells returned by the RangeServers for a
+   * ScanSpec with an aggregate.  Each range returns one cell per column
+   * family and group, with the group key in the column qualifier; a group
+   * that spans several ranges arrives as consecutive partials, which are
+   * combined here.  The merged cells have the group key as row key, an
+   * empty column qualifier and the result as an ASCII decimal value.
+   */
+  class AggregateMerger : public ReferenceCount {
+  public:
+
+    /**
+     * @param function Aggregate function (one of ScanSpec::AGGREGATE_*)
+     */
+    AggregateMerger(int32_t function)
+      : m_function(function), m_have_group(false), m_finished(false),
+        m_next(0) { }
+
+    /** Adds a partial aggregate cell.  Completes the current group if the
+     * cell starts a new one.
+     * @param cell Partial aggregate cell returned by a RangeServer
+     */
+    void add(const Cell &cell);
+
+    /** Completes the last group; no cells may be added afterwards. */
+    void finish();
+
+    /** Returns the next merged cell.  The cell remains valid until the
+     * next call to add() or finish().
+     * @param cell Cell to hold the result
+     * @return true if a cell was returned, false if none is ready
+     */
+    bool next(Cell &cell);
+
+    /// Returns true when finish() was called and all cells were returned
+    bool done() { return m_finished && m_next == m_ready.size(); }
+
+  private:
+
+    struct Result {
+      String row;
+      String family;
+      String value;
+      int64_t numeric;
+      int64_t timestamp;
+    };
+
+    void flush();
+
+    int32_t m_function;
+    bool m_have_group;
+    bool m_finished;
+    String m_group;
+    std::vector<Result> m_partials;
+    std::vector<Result> m_ready;
+    size_t m_next;
+  };
+  typedef intrusive_ptr<AggregateMerger> AggregateMergerPtr;
+
+} // namespace Hypertable
+
+#endif // HYPERTABLE_AGGREGATEMERGER_H
@@ -31,7 +31,9 @@ namespace {
     "bmz",
     "zlib",
     "lzo",
-    "quicklz"
+    "quicklz",
+    "snappy",
+    "zstd"
   };
 }
 
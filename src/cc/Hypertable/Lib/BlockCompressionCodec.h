@@ -25,7 +25,9 @@
 #include <vector>
 #include "Common/Thread.h"
 #include "Common/Error.h"
+#include "Common/Mutex.h"
 #include "Common/ReferenceCount.h"
+#include "Common/StaticBuffer.h"
 
 #include "BlockCompressionHeader.h"
 
@@ -33,13 +35,42 @@ namespace Hypertable {
 
   class DynamicBuffer;
 
+  /**
+   * Compression dictionary shared by the codecs that compress or decompress
+   * one set of blocks (e.g. the data blocks of a CellStore).  Holds the raw
+   * dictionary bytes plus a slot in which a codec can cache a prepared
+   * (digested) form of the dictionary, so that the preparation is done once
+   * rather than once per codec instance.
+   */
+  class BlockCompressionDictionary : public ReferenceCount {
+  public:
+    BlockCompressionDictionary(const uint8_t *data, size_t len)
+      : buffer(len) {
+      memcpy(buffer.base, data, len);
+    }
+
+    const uint8_t *data() const { return buffer.base; }
+    size_t length() const { return buffer.size; }
+
+    /// Raw dictionary
+    StaticBuffer buffer;
+
+    /// Protects #prepared
+    Mutex mutex;
+
+    /// Codec-specific prepared form of the dictionary
+    intrusive_ptr<ReferenceCount> prepared;
+  };
+  typedef boost::intrusive_ptr<BlockCompressionDictionary>
+          BlockCompressionDictionaryPtr;
+
   /**
    * Abstract base class for block compression codecs.
    */
   class BlockCompressionCodec : public ReferenceCount {
   public:
     enum Type { UNKNOWN=-1, NONE=0, BMZ=1, ZLIB=2, LZO=3, QUICKLZ=4,
-                SNAPPY=5, COMPRESSION_TYPE_LIMIT=6 };
+                SNAPPY=5, ZSTD=6, COMPRESSION_TYPE_LIMIT=7 };
     typedef std::vector<String> Args;
 
     static const char *get_compressor_name(uint16_t algo);
@@ -55,6 +86,29 @@ namespace Hypertable {
 
     virtual void set_args(const Args &args) {}
 
+    /** Returns the size of the dictionary that should be trained for the
+     * blocks this codec compresses, or 0 if the codec does not use
+     * dictionaries.
+     */
+    virtual size_t get_dictionary_size() { return 0; }
+
+    /** Trains a dictionary from sample blocks.
+     * @param samples Concatenated sample blocks
+     * @param sample_sizes Length of each sample in <code>samples</code>
+     * @param dictionary Receives the dictionary
+     * @return <i>true</i> if a dictionary was trained, <i>false</i> if the
+     * codec does not use dictionaries or the samples were not suitable
+     */
+    virtual bool train_dictionary(const DynamicBuffer &samples,
+                                  const std::vector<size_t> &sample_sizes,
+                                  DynamicBuffer &dictionary) { return false; }
+
+    /** Sets the dictionary with which blocks are compressed and
+     * decompressed.  Codecs that do not use dictionaries ignore it.
+     * @param dictionary Dictionary
+     */
+    virtual void set_dictionary(BlockCompressionDictionaryPtr &dictionary) {}
+
     virtual int get_type() = 0;
 
     HT_THREAD_ID_DECL(m_creator_thread);
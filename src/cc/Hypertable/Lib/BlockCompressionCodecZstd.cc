@@ -0,0 +1,288 @@
+/** -*- c++ -*-
+ * Copyright (C) 2007-2013 Hypertable, Inc.
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 3 of the
+ * License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+#include "Common/Compat.h"
+
+#include <cstdlib>
+
+extern "C" {
+#include <zdict.h>
+}
+
+#include "Common/DynamicBuffer.h"
+#include "Common/Logger.h"
+#include "Common/Checksum.h"
+
+#include "BlockCompressionCodecZstd.h"
+
+using namespace Hypertable;
+
+namespace {
+
+  /** Prepared form of a dictionary, cached in
+   * BlockCompressionDictionary::prepared and shared by all codecs using
+   * the dictionary.  The compression dictionary is prepared for the level
+   * of the first codec that compresses with it.
+   */
+  class ZstdPreparedDictionary : public ReferenceCount {
+  public:
+    ZstdPreparedDictionary() : cdict(0), level(0), ddict(0) { }
+    virtual ~ZstdPreparedDictionary() {
+      if (cdict)
+        ZSTD_freeCDict(cdict);
+      if (ddict)
+        ZSTD_freeDDict(ddict);
+    }
+    ZSTD_CDict *cdict;
+    int level;
+    ZSTD_DDict *ddict;
+  };
+
+  ZstdPreparedDictionary *
+  get_prepared(BlockCompressionDictionaryPtr &dictionary) {
+    if (!dictionary->prepared)
+      dictionary->prepared = new ZstdPreparedDictionary();
+    return static_cast<ZstdPreparedDictionary *>(dictionary->prepared.get());
+  }
+
+  const int DEFAULT_LEVEL = 3;
+  const size_t DEFAULT_DICTIONARY_SIZE = 16384;
+
+}
+
+
+BlockCompressionCodecZstd::BlockCompressionCodecZstd(const Args &args)
+  : m_cctx(0), m_dctx(0), m_level(DEFAULT_LEVEL),
+    m_dictionary_size(DEFAULT_DICTIONARY_SIZE), m_cdict(0), m_ddict(0),
+    m_private_cdict(0) {
+  if (!args.empty())
+    set_args(args);
+}
+
+
+BlockCompressionCodecZstd::~BlockCompressionCodecZstd() {
+  if (m_private_cdict)
+    ZSTD_freeCDict(m_private_cdict);
+  if (m_cctx)
+    ZSTD_freeCCtx(m_cctx);
+  if (m_dctx)
+    ZSTD_freeDCtx(m_dctx);
+}
+
+
+void BlockCompressionCodecZstd::set_args(const Args &args) {
+  Args::const_iterator it = args.begin(), arg_end = args.end();
+
+  for (; it != arg_end; ++it) {
+    if (*it == "--level" || *it == "--dictionary-size") {
+      const String &name = *it;
+      if (++it == arg_end)
+        HT_THROWF(Error::BLOCK_COMPRESSOR_INVALID_ARG, "Missing value for "
+                  "Zstd codec argument '%s'", name.c_str());
+      char *end;
+      long value = strtol((*it).c_str(), &end, 10);
+      if (*end != 0 || value < 0)
+        HT_THROWF(Error::BLOCK_COMPRESSOR_INVALID_ARG, "Bad value for Zstd "
+                  "codec argument '%s': '%s'", name.c_str(), (*it).c_str());
+      if (name == "--level")
+        m_level = (int)value;
+      else
+        m_dictionary_size = (size_t)value;
+    }
+    else if ((*it).size() > 1 && (*it)[0] == '-' &&
+             (*it).find_first_not_of("0123456789", 1) == String::npos)
+      m_level = atoi((*it).c_str() + 1);
+    else {
+      HT_THROWF(Error::BLOCK_COMPRESSOR_INVALID_ARG, "Unrecognized argument "
+                "to Zstd codec: '%s'", (*it).c_str());
+    }
+  }
+
+  if (m_level < 1 || m_level > ZSTD_maxCLevel())
+    HT_THROWF(Error::BLOCK_COMPRESSOR_INVALID_ARG, "Zstd compression level "
+              "%d out of range [1..%d]", m_level, ZSTD_maxCLevel());
+}
+
+
+void
+BlockCompressionCodecZstd::deflate(const DynamicBuffer &input,
+    DynamicBuffer &output, BlockCompressionHeader &header, size_t reserve) {
+  size_t avail_out = ZSTD_compressBound(input.fill());
+
+  if (m_cctx == 0)
+    m_cctx = ZSTD_createCCtx();
+
+  output.clear();
+  output.reserve(header.length() + avail_out + reserve);
+
+  size_t zlen;
+  if (m_dictionary) {
+    if (m_cdict == 0) {
+      ScopedLock lock(m_dictionary->mutex);
+      ZstdPreparedDictionary *prepared = get_prepared(m_dictionary);
+      if (prepared->cdict == 0) {
+        prepared->cdict = ZSTD_createCDict(m_dictionary->data(),
+                                           m_dictionary->length(), m_level);
+        prepared->level = m_level;
+      }
+      if (prepared->level == m_level)
+        m_cdict = prepared->cdict;
+      else
+        m_cdict = m_private_cdict =
+          ZSTD_createCDict(m_dictionary->data(), m_dictionary->length(),
+                           m_level);
+    }
+    zlen = ZSTD_compress_usingCDict(m_cctx, output.base + header.length(),
+                                    avail_out, input.base, input.fill(),
+                                    m_cdict);
+  }
+  else
+    zlen = ZSTD_compressCCtx(m_cctx, output.base + header.length(),
+                             avail_out, input.base, input.fill(), m_level);
+
+  if (ZSTD_isError(zlen))
+    HT_THROWF(Error::BLOCK_COMPRESSOR_DEFLATE_ERROR, "Zstd compression "
+              "error - %s", ZSTD_getErrorName(zlen));
+
+  /* check for an incompressible block */
+  if (zlen >= input.fill()) {
+    header.set_compression_type(NONE);
+    memcpy(output.base+header.length(), input.base, input.fill());
+    header.set_data_length(input.fill());
+    header.set_data_zlength(input.fill());
+  }
+  else {
+    header.set_compression_type(ZSTD);
+    header.set_data_length(input.fill());
+    header.set_data_zlength(zlen);
+  }
+
+  header.set_data_checksum(fletcher32(output.base + header.length(),
+                           header.get_data_zlength()));
+
+  output.ptr = output.base;
+  header.encode(&output.ptr);
+  output.ptr += header.get_data_zlength();
+}
+
+
+void
+BlockCompressionCodecZstd::inflate(const DynamicBuffer &input,
+    DynamicBuffer &output, BlockCompressionHeader &header) {
+  const uint8_t *msg_ptr = input.base;
+  size_t remaining = input.fill();
+
+  header.decode(&msg_ptr, &remaining);
+
+  if (header.get_data_zlength() > remaining)
+    HT_THROWF(Error::BLOCK_COMPRESSOR_BAD_HEADER, "Block decompression error, "
+              "header zlength = %lu, actual = %lu",
+              (Lu)header.get_data_zlength(), (Lu)remaining);
+
+  uint32_t checksum = fletcher32(msg_ptr, header.get_data_zlength());
+
+  if (checksum != header.get_data_checksum())
+    HT_THROWF(Error::BLOCK_COMPRESSOR_CHECKSUM_MISMATCH, "Compressed block "
+              "checksum mismatch header=%lx, computed=%lx",
+              (Lu)header.get_data_checksum(), (Lu)checksum);
+
+  try {
+    output.reserve(header.get_data_length());
+
+    // check compress bit
+    if (header.get_compression_type() == NONE)
+      memcpy(output.base, msg_ptr, header.get_data_length());
+    else {
+      if (m_dctx == 0)
+        m_dctx = ZSTD_createDCtx();
+
+      size_t len;
+      if (m_dictionary) {
+        if (m_ddict == 0) {
+          ScopedLock lock(m_dictionary->mutex);
+          ZstdPreparedDictionary *prepared = get_prepared(m_dictionary);
+          if (prepared->ddict == 0)
+            prepared->ddict = ZSTD_createDDict(m_dictionary->data(),
+                                               m_dictionary->length());
+          m_ddict = prepared->ddict;
+        }
+        len = ZSTD_decompress_usingDDict(m_dctx, output.base,
+                                         header.get_data_length(), msg_ptr,
+                                         header.get_data_zlength(), m_ddict);
+      }
+      else
+        len = ZSTD_decompressDCtx(m_dctx, output.base,
+                                  header.get_data_length(), msg_ptr,
+                                  header.get_data_zlength());
+
+      if (ZSTD_isError(len))
+        HT_THROWF(Error::BLOCK_COMPRESSOR_INFLATE_ERROR, "Compressed block "
+                  "inflate error - %s", ZSTD_getErrorName(len));
+
+      if (len != header.get_data_length())
+        HT_THROWF(Error::BLOCK_COMPRESSOR_INFLATE_ERROR, "Compressed block "
+                  "inflate error, expected %lu but only inflated to %lu bytes",
+                  (Lu)header.get_data_length(), (Lu)len);
+    }
+
+    output.ptr = output.base + header.get_data_length();
+  }
+  catch (Exception &e) {
+    output.free();
+    throw;
+  }
+}
+
+
+bool
+BlockCompressionCodecZstd::train_dictionary(const DynamicBuffer &samples,
+    const std::vector<size_t> &sample_sizes, DynamicBuffer &dictionary) {
+  if (m_dictionary_size == 0 || sample_sizes.empty())
+    return false;
+
+  dictionary.clear();
+  dictionary.reserve(m_dictionary_size);
+
+  size_t len = ZDICT_trainFromBuffer(dictionary.base, m_dictionary_size,
+                                     samples.base, &sample_sizes[0],
+                                     (unsigned)sample_sizes.size());
+  if (ZDICT_isError(len)) {
+    HT_INFOF("Zstd dictionary training failed (%u samples, %lu bytes) - %s",
+             (unsigned)sample_sizes.size(), (Lu)samples.fill(),
+             ZDICT_getErrorName(len));
+    return false;
+  }
+
+  dictionary.ptr = dictionary.base + len;
+  return true;
+}
+
+
+void
+BlockCompressionCodecZstd::set_dictionary(BlockCompressionDictionaryPtr &dictionary) {
+  if (m_private_cdict) {
+    ZSTD_freeCDict(m_private_cdict);
+    m_private_cdict = 0;
+  }
+  m_cdict = 0;
+  m_ddict = 0;
+  m_dictionary = dictionary;
+}
@@ -0,0 +1,77 @@
+/** -*- c++ -*-
+ * Copyright (C) 2007-2013 Hypertable, Inc.
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 3 of the
+ * License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+#ifndef HYPERTABLE_BLOCKCOMPRESSIONCODECZSTD_H
+#define HYPERTABLE_BLOCKCOMPRESSIONCODECZSTD_H
+
+extern "C" {
+#include <zstd.h>
+}
+
+#include "BlockCompressionCodec.h"
+
+namespace Hypertable {
+
+  /**
+   * Zstandard block codec.  Accepts the arguments <code>--level N</code>
+   * (or <code>-N</code>) to select the compression level and
+   * <code>--dictionary-size N</code> to select the size of the dictionary
+   * trained by #train_dictionary (0 disables dictionaries).  Once a
+   * dictionary has been set with #set_dictionary, blocks are compressed
+   * with it and can only be decompressed by a codec that has been given
+   * the same dictionary.
+   */
+  class BlockCompressionCodecZstd : public BlockCompressionCodec {
+
+  public:
+    BlockCompressionCodecZstd(const Args &args);
+    virtual ~BlockCompressionCodecZstd();
+
+    virtual void set_args(const Args &args);
+    virtual void deflate(const DynamicBuffer &input, DynamicBuffer &output,
+                         BlockCompressionHeader &header, size_t reserve=0);
+    virtual void inflate(const DynamicBuffer &input, DynamicBuffer &output,
+                         BlockCompressionHeader &header);
+    virtual int get_type() { return ZSTD; }
+
+    virtual size_t get_dictionary_size() { return m_dictionary_size; }
+    virtual bool train_dictionary(const DynamicBuffer &samples,
+                                  const std::vector<size_t> &sample_sizes,
+                                  DynamicBuffer &dictionary);
+    virtual void set_dictionary(BlockCompressionDictionaryPtr &dictionary);
+
+  private:
+    ZSTD_CCtx *m_cctx;
+    ZSTD_DCtx *m_dctx;
+    int        m_level;
+    size_t     m_dictionary_size;
+    BlockCompressionDictionaryPtr m_dictionary;
+    /// Prepared compression dictionary (owned by #m_dictionary)
+    const ZSTD_CDict *m_cdict;
+    /// Prepared decompression dictionary (owned by #m_dictionary)
+    const ZSTD_DDict *m_ddict;
+    /// Compression dictionary prepared for a level other than the shared one
+    ZSTD_CDict *m_private_cdict;
+  };
+
+}
+
+#endif // HYPERTABLE_BLOCKCOMPRESSIONCODECZSTD_H
@@ -26,6 +26,7 @@
 #include "Common/Config.h"
 #include "Common/DynamicBuffer.h"
 #include "Common/Error.h"
+#include "Common/FailureInducer.h"
 #include "Common/FileUtils.h"
 #include "Common/Logger.h"
 #include "Common/StringExt.h"
@@ -55,6 +56,7 @@ CommitLog::CommitLog(FilesystemPtr &fs, const String &log_dir, bool is_meta)
 }
 
 CommitLog::~CommitLog() {
+  stop_pipeline();
   delete m_compressor;
   close();
 }
@@ -69,6 +71,12 @@ CommitLog::initialize(const String &log_dir, PropertiesPtr &props,
   m_cur_fragment_num = 0;
   m_needs_roll = false;
   m_replication = -1;
+  m_outstanding_appends = 0;
+  m_pipeline_workers = 0;
+  m_pipeline_max = 0;
+  m_pipeline_error = Error::OK;
+  m_pipeline_appending = false;
+  m_pipeline_shutdown = false;
 
   if (is_meta)
     m_replication = props->get_i32("Hypertable.Metadata.Replication");
@@ -82,6 +90,7 @@ CommitLog::initialize(const String &log_dir, PropertiesPtr &props,
     compressor = cfg.get_str("Compressor"));
 
   m_compressor = CompressorFactory::create_block_codec(compressor);
+  m_compressor_type = compressor;
 
   boost::trim_right_if(m_log_dir, boost::is_any_of("/"));
 
@@ -137,13 +146,20 @@ int64_t CommitLog::get_timestamp() {
 
 int
 CommitLog::sync() {
+  int error = wait_for_pipeline();
   ScopedLock lock(m_mutex);
-  int error = Error::OK;
 
   // Sync commit log update (protected by lock)
   try {
     if (m_fd == -1)
       return Error::CLOSED;
+    while (m_outstanding_appends > 0) {
+      int append_error = wait_for_append();
+      if (error == Error::OK)
+        error = append_error;
+    }
+    if (error != Error::OK)
+      return error;
     m_fs->flush(m_fd);
     HT_DEBUG_OUT << "synced commit log explicitly" << HT_END;
   }
@@ -160,6 +176,9 @@ int CommitLog::write(DynamicBuffer &buffer, int64_t revision, bool sync) {
   int error;
   BlockCompressionHeaderCommitLog header(MAGIC_DATA, revision);
 
+  if (m_pipeline_workers > 0)
+    return pipeline_write(buffer, revision, sync);
+
   if (m_needs_roll) {
     ScopedLock lock(m_mutex);
     if ((error = roll()) != Error::OK)
@@ -186,8 +205,12 @@ int CommitLog::write(DynamicBuffer &buffer, int64_t revision, bool sync) {
 
 
 int CommitLog::link_log(CommitLogBase *log_base) {
-  ScopedLock lock(m_mutex);
   int error;
+
+  if ((error = wait_for_pipeline()) != Error::OK)
+    return error;
+
+  ScopedLock lock(m_mutex);
   int64_t link_revision = log_base->get_latest_revision();
   BlockCompressionHeaderCommitLog header(MAGIC_LINK, link_revision);
 
@@ -265,10 +288,16 @@ int CommitLog::link_log(CommitLogBase *log_base) {
 
 
 int CommitLog::close() {
+  int error = wait_for_pipeline();
   ScopedLock lock(m_mutex);
 
   try {
     if (m_fd >= 0) {
+      while (m_outstanding_appends > 0) {
+        int append_error = wait_for_append();
+        if (error == Error::OK)
+          error = append_error;
+      }
       m_fs->close(m_fd);
       m_fd = -1;
     }
@@ -280,7 +309,7 @@ int CommitLog::close() {
     return e.code();
   }
 
-  return Error::OK;
+  return error;
 }
 
 
@@ -395,6 +424,11 @@ int CommitLog::roll(CommitLogFileInfo **clfip) {
     *clfip = 0;
 
   if (m_fd >= 0) {
+    int error;
+    while (m_outstanding_appends > 0) {
+      if ((error = wait_for_append()) != Error::OK)
+        return error;
+    }
     try {
       m_fs->close(m_fd);
     }
@@ -406,33 +440,51 @@ int CommitLog::roll(CommitLogFileInfo **clfip) {
 
     m_fd = -1;
 
-    file_info = new CommitLogFileInfo();
+    file_info = retire_fragment();
     if (clfip)
       *clfip = file_info;
-    file_info->log_dir = m_log_dir;
-    file_info->log_dir_hash = md5_hash(m_log_dir.c_str());
-    file_info->num = m_cur_fragment_num;
-    file_info->size = m_cur_fragment_length;
-    assert(m_latest_revision != TIMESTAMP_MIN);
-    file_info->revision = m_latest_revision;
-
-    if (m_fragment_queue.empty() || m_fragment_queue.back()->revision
-        < file_info->revision)
-      m_fragment_queue.push_back(file_info);
-    else {
-      m_fragment_queue.push_back(file_info);
-      struct LtClfip swo;
-      sort(m_fragment_queue.begin(), m_fragment_queue.end(), swo);
-    }
+  }
 
-    m_latest_revision = TIMESTAMP_MIN;
-    m_cur_fragment_length = 0;
+  return create_fragment();
+}
 
-    m_cur_fragment_num++;
-    m_cur_fragment_fname = m_log_dir + "/" + m_cur_fragment_num;
 
+/**
+ * Assumes mutex is locked and the current fragment has been closed
+ */
+CommitLogFileInfo *CommitLog::retire_fragment() {
+  CommitLogFileInfo *file_info = new CommitLogFileInfo();
+
+  file_info->log_dir = m_log_dir;
+  file_info->log_dir_hash = md5_hash(m_log_dir.c_str());
+  file_info->num = m_cur_fragment_num;
+  file_info->size = m_cur_fragment_length;
+  assert(m_latest_revision != TIMESTAMP_MIN);
+  file_info->revision = m_latest_revision;
+
+  if (m_fragment_queue.empty() || m_fragment_queue.back()->revision
+      < file_info->revision)
+    m_fragment_queue.push_back(file_info);
+  else {
+    m_fragment_queue.push_back(file_info);
+    struct LtClfip swo;
+    sort(m_fragment_queue.begin(), m_fragment_queue.end(), swo);
   }
 
+  m_latest_revision = TIMESTAMP_MIN;
+  m_cur_fragment_length = 0;
+
+  m_cur_fragment_num++;
+  m_cur_fragment_fname = m_log_dir + "/" + m_cur_fragment_num;
+
+  return file_info;
+}
+
+
+/**
+ * Assumes mutex is locked
+ */
+int CommitLog::create_fragment() {
   try {
     m_fd = m_fs->create(m_cur_fragment_fname, Filesystem::OPEN_FLAG_OVERWRITE,
                         -1, m_replication, -1);
@@ -483,6 +535,232 @@ CommitLog::compress_and_write(DynamicBuffer &input,
 }
 
 
+void CommitLog::start_pipeline(size_t worker_count) {
+  HT_ASSERT(m_pipeline_workers == 0 && worker_count > 0);
+  m_pipeline_workers = worker_count;
+  m_pipeline_max = worker_count * PIPELINE_DEPTH_PER_WORKER;
+  PipelineWorker worker(this);
+  for (size_t i=0; i<worker_count; i++)
+    m_pipeline_threads.create_thread(worker);
+  HT_INFOF("Started %d thread write pipeline for commit log '%s'",
+           (int)worker_count, m_log_dir.c_str());
+}
+
+
+void CommitLog::stop_pipeline() {
+  if (m_pipeline_workers == 0)
+    return;
+  wait_for_pipeline();
+  {
+    ScopedLock lock(m_pipeline_mutex);
+    m_pipeline_shutdown = true;
+    m_pipeline_cond.notify_all();
+  }
+  m_pipeline_threads.join_all();
+  m_pipeline_workers = 0;
+}
+
+
+int CommitLog::restart_pipeline() {
+  int error;
+
+  // Once the pipeline has stopped, writes are rejected and nothing is queued
+  if (wait_for_pipeline() == Error::OK)
+    return Error::OK;
+
+  {
+    ScopedLock lock(m_mutex);
+
+    // The appends still in flight were issued before the failed one; their
+    // errors, if any, have already been reported
+    while (m_outstanding_appends > 0)
+      wait_for_append();
+
+    if (m_fd >= 0) {
+      try {
+        m_fs->close(m_fd);
+      }
+      catch (Exception &e) {
+        HT_WARNF("Problem closing commit log fragment: %s: %s",
+                 m_cur_fragment_fname.c_str(), e.what());
+      }
+      m_fd = -1;
+      // A fragment with no appended blocks is overwritten
+      if (m_latest_revision != TIMESTAMP_MIN)
+        retire_fragment();
+    }
+
+    if ((error = create_fragment()) != Error::OK)
+      return error;
+  }
+
+  {
+    ScopedLock lock(m_pipeline_mutex);
+    m_pipeline_error = Error::OK;
+  }
+
+  HT_INFOF("Restarted write pipeline for commit log '%s' in fragment %s",
+           m_log_dir.c_str(), m_cur_fragment_fname.c_str());
+
+  return Error::OK;
+}
+
+
+int
+CommitLog::pipeline_write(DynamicBuffer &buffer, int64_t revision, bool sync) {
+  // The caller may reuse or free the buffer once we return, so copy it
+  PendingBlock *block = new PendingBlock(revision);
+  block->input.set(buffer.base, buffer.fill());
+
+  {
+    ScopedLock lock(m_pipeline_mutex);
+    while (m_pipeline.size() >= m_pipeline_max)
+      m_pipeline_cond.wait(lock);
+    if (m_pipeline_error != Error::OK) {
+      delete block;
+      return m_pipeline_error;
+    }
+    m_pipeline.push_back(block);
+    m_compress_queue.push_back(block);
+    m_pipeline_cond.notify_all();
+  }
+
+  return sync ? CommitLog::sync() : Error::OK;
+}
+
+
+void CommitLog::pipeline_compress() {
+  BlockCompressionCodec *compressor =
+    CompressorFactory::create_block_codec(m_compressor_type);
+  PendingBlock *block;
+  int error;
+
+  while (true) {
+
+    {
+      ScopedLock lock(m_pipeline_mutex);
+      while (m_compress_queue.empty() && !m_pipeline_shutdown)
+        m_pipeline_cond.wait(lock);
+      if (m_compress_queue.empty())
+        break;
+      block = m_compress_queue.front();
+      m_compress_queue.pop_front();
+    }
+
+    try {
+      compressor->deflate(block->input, block->zblock, block->header);
+    }
+    catch (Exception &e) {
+      HT_ERRORF("Problem compressing commit log block for '%s' - %s",
+                m_log_dir.c_str(), e.what());
+      block->error = e.code();
+    }
+    block->input.free();
+
+    /**
+     * Blocks must be appended in the order they were written, so whichever
+     * worker finds the head of the pipeline compressed appends every
+     * compressed block from the head on; the others go back to compressing.
+     * Once an append has failed, the blocks behind it are dropped so that
+     * nothing written after the failed block makes it into the log
+     */
+    ScopedLock lock(m_pipeline_mutex);
+    block->compressed = true;
+    if (m_pipeline_appending)
+      continue;
+    m_pipeline_appending = true;
+    while (!m_pipeline.empty() && m_pipeline.front()->compressed) {
+      block = m_pipeline.front();
+      m_pipeline.pop_front();
+      if (m_pipeline_error != Error::OK) {
+        delete block;
+        continue;
+      }
+      lock.unlock();
+      error = pipeline_append(block);
+      delete block;
+      lock.lock();
+      if (error != Error::OK && m_pipeline_error == Error::OK) {
+        HT_ERRORF("Commit log pipeline for '%s' stopped - %s",
+                  m_log_dir.c_str(), Error::get_text(error));
+        m_pipeline_error = error;
+      }
+    }
+    m_pipeline_appending = false;
+    m_pipeline_cond.notify_all();
+  }
+
+  delete compressor;
+}
+
+
+int CommitLog::pipeline_append(PendingBlock *block) {
+  ScopedLock lock(m_mutex);
+  int error;
+
+  if (block->error != Error::OK)
+    return block->error;
+
+  if (m_needs_roll) {
+    if ((error = roll()) != Error::OK)
+      return error;
+  }
+
+  if (m_fd == -1)
+    return Error::CLOSED;
+
+  if (m_outstanding_appends >= MAX_APPENDS_OUTSTANDING) {
+    if ((error = wait_for_append()) != Error::OK)
+      return error;
+  }
+
+  try {
+    HT_MAYBE_FAIL("commit-log-pipeline-append");
+    size_t amount = block->zblock.fill();
+    StaticBuffer send_buf(block->zblock);
+    m_fs->append(m_fd, send_buf, 0, &m_sync_handler);
+    m_outstanding_appends++;
+    assert(block->revision != 0);
+    if (block->revision > m_latest_revision)
+      m_latest_revision = block->revision;
+    m_cur_fragment_length += amount;
+  }
+  catch (Exception &e) {
+    HT_ERRORF("Problem writing commit log: %s: %s",
+              m_cur_fragment_fname.c_str(), e.what());
+    return e.code();
+  }
+
+  if (m_cur_fragment_length > m_max_fragment_size)
+    return roll();
+
+  return Error::OK;
+}
+
+
+int CommitLog::wait_for_pipeline() {
+  ScopedLock lock(m_pipeline_mutex);
+  while (!m_pipeline.empty() || m_pipeline_appending)
+    m_pipeline_cond.wait(lock);
+  return m_pipeline_error;
+}
+
+
+int CommitLog::wait_for_append() {
+  EventPtr event_ptr;
+  HT_ASSERT(m_outstanding_appends > 0);
+  m_outstanding_appends--;
+  if (!m_sync_handler.wait_for_reply(event_ptr)) {
+    int error = event_ptr->type == Event::MESSAGE ?
+      Protocol::response_code(event_ptr) : event_ptr->error;
+    HT_ERRORF("Problem appending to commit log fragment %s - %s",
+              m_cur_fragment_fname.c_str(), Error::get_text(error));
+    return error;
+  }
+  return Error::OK;
+}
+
+
 void CommitLog::load_cumulative_size_map(CumulativeSizeMap &cumulative_size_map) {
   ScopedLock lock(m_mutex);
   int64_t cumulative_total = 0;
@@ -26,15 +26,21 @@
 #include <map>
 #include <stack>
 
+#include <boost/thread/condition.hpp>
+#include <boost/thread/thread.hpp>
 #include <boost/thread/xtime.hpp>
 
+#include "AsyncComm/DispatchHandlerSynchronizer.h"
+
 #include "Common/DynamicBuffer.h"
+#include "Common/Error.h"
 #include "Common/ReferenceCount.h"
 #include "Common/String.h"
 #include "Common/Properties.h"
 #include "Common/Filesystem.h"
 
 #include "BlockCompressionCodec.h"
+#include "BlockCompressionHeaderCommitLog.h"
 #include "Types.h"
 
 #include "CommitLogBase.h"
@@ -62,6 +68,10 @@ namespace Hypertable {
    *<pre>
    * Hypertable.RangeServer.CommitLog.RollLimit
    *</pre>
+   * The log can optionally be put into pipelined mode (see start_pipeline()),
+   * in which blocks are compressed by a pool of worker threads and appended
+   * asynchronously so that the caller of write() is not held up by
+   * compression or by the round trip to the DFS broker.
    */
 
   class CommitLog : public CommitLogBase {
@@ -112,12 +122,48 @@ namespace Hypertable {
      */
     int write(DynamicBuffer &buffer, int64_t revision, bool sync=true);
 
-    /** Sync previous updates written to commit log.
+    /** Sync previous updates written to commit log.  In pipelined mode,
+     * this first waits for all queued blocks to be appended, so one call
+     * acts as the durability barrier for every write() issued before it.
      *
      * @return Error::OK on success or error code on failure
      */
     int sync();
 
+    /** Puts the log into pipelined mode.  Blocks passed to write() are
+     * copied and queued; <code>worker_count</code> threads compress them in
+     * parallel and the blocks are then appended to the current fragment,
+     * in the order in which they were written, without waiting for each
+     * append to complete.  A write() with <code>sync</code> set to
+     * <i>false</i> returns as soon as the block has been queued and errors
+     * encountered while compressing or appending it are returned by the
+     * next call to sync().  The first such error stops the pipeline: the
+     * blocks queued behind the failed one are discarded rather than
+     * appended, so the fragment never contains a hole, and the error is
+     * returned by every subsequent write(), sync() and close() until
+     * restart_pipeline() is called.
+     *
+     * @param worker_count Number of compression threads
+     */
+    void start_pipeline(size_t worker_count);
+
+    /** Restarts a pipeline that has been stopped by an error.  The fragment
+     * being written when the error occurred is closed and kept, with the
+     * blocks appended to it before the error, and writing continues in a
+     * new fragment.  If the new fragment can be created the error is
+     * cleared, otherwise the next call tries again.
+     *
+     * @return Error::OK on success or error code if the new fragment could
+     * not be created
+     */
+    int restart_pipeline();
+
+    /** Checks if log is in pipelined mode.
+     *
+     * @return <i>true</i> if start_pipeline() has been called
+     */
+    bool pipelined() { return m_pipeline_workers > 0; }
+
     /** Links an external log into this log.
      *
      * @param log_base pointer to commit log object to link in
@@ -188,13 +234,51 @@ namespace Hypertable {
     static const char MAGIC_LINK[10];
 
   private:
+
+    /// Block queued in the write pipeline
+    struct PendingBlock {
+      PendingBlock(int64_t revision)
+        : header(MAGIC_DATA, revision), revision(revision), error(Error::OK),
+          compressed(false) { }
+      DynamicBuffer input;
+      DynamicBuffer zblock;
+      BlockCompressionHeaderCommitLog header;
+      int64_t revision;
+      int error;
+      bool compressed;
+    };
+
+    /// Thread function object for pipeline compression workers
+    class PipelineWorker {
+    public:
+      PipelineWorker(CommitLog *log) : m_log(log) { }
+      void operator()() { m_log->pipeline_compress(); }
+    private:
+      CommitLog *m_log;
+    };
+
     void initialize(const String &log_dir,
                     PropertiesPtr &, CommitLogBase *init_log, bool is_meta);
     int roll(CommitLogFileInfo **clfip=0);
+    CommitLogFileInfo *retire_fragment();
+    int create_fragment();
     int compress_and_write(DynamicBuffer &input, BlockCompressionHeader *header,
                            int64_t revision, bool sync);
     void remove_file_info(CommitLogFileInfo *fi, StringSet &removed_logs);
 
+    int pipeline_write(DynamicBuffer &buffer, int64_t revision, bool sync);
+    void pipeline_compress();
+    int pipeline_append(PendingBlock *block);
+    int wait_for_pipeline();
+    void stop_pipeline();
+    int wait_for_append();
+
+    /// Maximum number of asynchronous appends in flight
+    static const size_t MAX_APPENDS_OUTSTANDING = 4;
+
+    /// Maximum number of queued blocks per pipeline worker
+    static const size_t PIPELINE_DEPTH_PER_WORKER = 4;
+
     FilesystemPtr           m_fs;
     std::set<CommitLogFileInfo *> m_reap_set;
     BlockCompressionCodec  *m_compressor;
@@ -205,6 +289,19 @@ namespace Hypertable {
     int32_t                 m_fd;
     int32_t                 m_replication;
     bool                    m_needs_roll;
+    String                  m_compressor_type;
+    DispatchHandlerSynchronizer m_sync_handler;
+    size_t                  m_outstanding_appends;
+    Mutex                   m_pipeline_mutex;
+    boost::condition        m_pipeline_cond;
+    boost::thread_group     m_pipeline_threads;
+    std::deque<PendingBlock *> m_pipeline;
+    std::deque<PendingBlock *> m_compress_queue;
+    size_t                  m_pipeline_workers;
+    size_t                  m_pipeline_max;
+    int                     m_pipeline_error;
+    bool                    m_pipeline_appending;
+    bool                    m_pipeline_shutdown;
   };
 
   typedef intrusive_ptr<CommitLog> CommitLogPtr;
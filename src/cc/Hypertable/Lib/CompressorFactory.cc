@@ -28,6 +28,9 @@
 #include "BlockCompressionCodecLzo.h"
 #include "BlockCompressionCodecQuicklz.h"
 #include "BlockCompressionCodecSnappy.h"
+#ifdef HT_WITH_ZSTD
+#include "BlockCompressionCodecZstd.h"
+#endif
 
 using namespace Hypertable;
 using namespace std;
@@ -63,6 +66,9 @@ CompressorFactory::parse_block_codec_spec(const std::string &spec,
   if (name == "snappy")
     return BlockCompressionCodec::SNAPPY;
 
+  if (name == "zstd")
+    return BlockCompressionCodec::ZSTD;
+
   HT_ERRORF("unknown codec type: %s", name.c_str());
   return BlockCompressionCodec::UNKNOWN;
 }
@@ -83,6 +89,13 @@ CompressorFactory::create_block_codec(BlockCompressionCodec::Type type,
     return new BlockCompressionCodecQuicklz(args);
   case BlockCompressionCodec::SNAPPY:
     return new BlockCompressionCodecSnappy(args);
+  case BlockCompressionCodec::ZSTD:
+#ifdef HT_WITH_ZSTD
+    return new BlockCompressionCodecZstd(args);
+#else
+    HT_THROW(Error::BLOCK_COMPRESSOR_UNSUPPORTED_TYPE,
+             "Zstd compression is not available in this build");
+#endif
   default:
     HT_THROWF(Error::BLOCK_COMPRESSOR_UNSUPPORTED_TYPE, "Invalid compression "
               "type: '%d'", (int)type);
@@ -356,6 +356,7 @@ namespace {
     "      | TIME_ORDER ASC|DESC",
     "      | TTL '=' duration",
     "      | COUNTER",
+    "      | VALUE_ENCODING '=' NONE|DELTA|FOR|RLE",
     "",
     "    duration:",
     "      num MONTHS",
@@ -371,6 +372,7 @@ namespace {
     "      | REPLICATION int",
     "      | COMPRESSOR compressor_spec",
     "      | BLOOMFILTER bloom_filter_spec",
+    "      | CELLCACHE cell_cache_type",
     "",
     "    compressor_spec:",
     "      bmz [ bmz_options ]",
@@ -378,6 +380,7 @@ namespace {
     "      | quicklz",
     "      | snappy",
     "      | zlib [ zlib_options ]",
+    "      | zstd [ zstd_options ]",
     "      | none",
     "",
     "    bmz_options:",
@@ -389,6 +392,10 @@ namespace {
     "      | --best",
     "      | --normal",
     "",
+    "    zstd_options:",
+    "      --level int",
+    "      | --dictionary-size int",
+    "",
     "    bloom_filter_spec:",
     "      rows [ bloom_filter_options ]",
     "      | rows+cols [ bloom_filter_options ]",
@@ -399,6 +406,7 @@ namespace {
     "      --bits-per-item float",
     "      --num-hashes int",
     "      --max-approx-items int",
+    "      --blocked",
     "",
     "Description",
     "-----------",
@@ -413,7 +421,7 @@ namespace {
     "The MODIFY option to ALTER TABLE allows you to *replace* column family",
     "definitions with new ones.  MODIFY currently cannot be used to modify",
     "access group definitions.  The currently supported column family",
-    "options which can be changed are MAX_VERSIONS and TTL.",
+    "options which can be changed are MAX_VERSIONS, TTL and VALUE_ENCODING.",
     "",
     "Example",
     "-------",
@@ -493,6 +501,7 @@ namespace {
     "      | TIME_ORDER ASC|DESC",
     "      | TTL duration",
     "      | COUNTER",
+    "      | VALUE_ENCODING NONE|DELTA|FOR|RLE",
     "",
     "    duration:",
     "      int MONTHS",
@@ -509,6 +518,7 @@ namespace {
     "      | REPLICATION int",
     "      | COMPRESSOR compressor_spec",
     "      | BLOOMFILTER bloom_filter_spec",
+    "      | CELLCACHE cell_cache_type",
     "",
     "    compressor_spec:",
     "      bmz [ bmz_options ]",
@@ -516,6 +526,7 @@ namespace {
     "      | quicklz",
     "      | snappy",
     "      | zlib [ zlib_options ]",
+    "      | zstd [ zstd_options ]",
     "      | none",
     "",
     "    bmz_options:",
@@ -527,6 +538,10 @@ namespace {
     "      | --best",
     "      | --normal",
     "",
+    "    zstd_options:",
+    "      --level int",
+    "      | --dictionary-size int",
+    "",
     "    bloom_filter_spec:",
     "      rows [ bloom_filter_options ]",
     "      | rows+cols [ bloom_filter_options ]",
@@ -537,6 +552,7 @@ namespace {
     "      --bits-per-item float",
     "      --num-hashes int",
     "      --max-approx-items int",
+    "      --blocked",
     "",
     "    table_option:",
     "      MAX_VERSIONS int",
@@ -546,6 +562,8 @@ namespace {
     "      | REPLICATION int",
     "      | COMPRESSOR compressor_spec",
     "      | GROUP_COMMIT_INTERVAL int",
+    "      | QUERY_CACHE boolean",
+    "      | COMPACTION_POLICY DEFAULT|TIERED|LEVELED",
     "",
     "Description",
     "-----------",
@@ -664,6 +682,8 @@ namespace {
     "  * REPLICATION int",
     "  * COMPRESSOR compressor_spec",
     "  * GROUP_COMMIT_INTERVAL int",
+    "  * QUERY_CACHE boolean",
+    "  * COMPACTION_POLICY DEFAULT|TIERED|LEVELED",
     "",
     "These are the same options as the ones in the column family and access group",
     "specification except that they act as defaults in the case where no",
@@ -682,6 +702,18 @@ namespace {
     "to 50ms.  The value specified for GROUP_COMMIT_INTERVAL will get rounded up to",
     "the nearest multiple of this property value.",
     "",
+    "The QUERY_CACHE option controls whether single-row query results for this",
+    "table are kept in the RangeServer query cache.  It defaults to true; setting",
+    "it to false is useful for tables whose rows are rarely read twice, since",
+    "caching their results only displaces entries of read-mostly tables.",
+    "",
+    "The COMPACTION_POLICY option selects how the RangeServer chooses CellStores",
+    "to merge for this table.  TIERED merges stores of similar size, rewriting",
+    "data fewer times, which suits ingest-heavy tables.  LEVELED keeps each store",
+    "much larger than all newer ones, so lookups touch fewer stores at the cost",
+    "of more rewriting, which suits read-heavy tables.  DEFAULT, or omitting the",
+    "option, uses Hypertable.RangeServer.Compaction.Policy.",
+    "",
     "Column Family Options",
     "---------------------",
     "",
@@ -691,6 +723,7 @@ namespace {
     "  * TIME_ORDER ASC|DESC",
     "  * TTL duration",
     "  * COUNTER",
+    "  * VALUE_ENCODING NONE|DELTA|FOR|RLE",
     "",
     "The MAX_VERSIONS option allows you to specify that you only want to keep",
     "n versions of each cell.  Cells are identified by a 3-tuple,",
@@ -739,6 +772,18 @@ namespace {
     "After these six values get written to a counter column, a subsequent read of that",
     "column would return the ASCII string \"10\".",
     "",
+    "The VALUE_ENCODING option stores the values of the column in a separate",
+    "stream within each CellStore block, encoded with one of the following",
+    "schemes:",
+    "",
+    "  DELTA  Each value is stored as the difference from the previous one",
+    "  FOR    Values are bit-packed as offsets from the block minimum",
+    "  RLE    Runs of equal values are stored once with a repeat count",
+    "",
+    "The encodings apply to 8-byte values, such as the values of COUNTER",
+    "columns; other values are stored as they are.  Scans that only return",
+    "keys do not decode the value streams.  The default is NONE.",
+    "",
     "Access Group Options",
     "--------------------",
     "",
@@ -750,6 +795,7 @@ namespace {
     "  * REPLICATION int",
     "  * COMPRESSOR compressor_spec",
     "  * BLOOMFILTER bloom_filter_spec",
+    "  * CELLCACHE cell_cache_type",
     "",
     "The COUNTER option makes all column families in the access group",
     "counter columns (see COUNTER description under Column Family Options",
@@ -825,6 +871,19 @@ namespace {
     "  --max-approx-items arg  Number of cell store items used to guess the number",
     "                          of actual bloom filter entries (default = 1000)",
     "",
+    "  --blocked               Confine the bits of each item to a single 64-byte",
+    "                          block so that a lookup touches one cache line.",
+    "                          Faster lookups at the cost of a slightly higher",
+    "                          false positive rate.  CellStores written with this",
+    "                          option cannot be read by older servers.",
+    "",
+    "The CELLCACHE option selects the in-memory data structure used for the",
+    "access group's cell cache.  It can be either \"map\" (a balanced tree,",
+    "the default) or \"skiplist\".  Scans of a skiplist cell cache proceed",
+    "without locking it, so they do not block concurrent updates.  The default",
+    "for access groups that do not specify this option is taken from the",
+    "Hypertable.RangeServer.AccessGroup.CellCache.Type property.",
+    "",
     "Compressors",
     "-----------",
     "",
@@ -837,6 +896,7 @@ namespace {
     "  * quicklz",
     "  * zlib",
     "  * snappy",
+    "  * zstd",
     "  * none",
     "",
     "The default code is snappy for cell store blocks.  The following list ",
@@ -846,6 +906,11 @@ namespace {
     "  bmz --offset arg    Starting fingerprint offset (default = 0)",
     "  zlib -9 [ --best ]  Highest compression ratio (at the cost of speed)",
     "  zlib --normal       Normal compression ratio",
+    "  zstd --level arg    Compression level, 1-22 (default = 3)",
+    "  zstd --dictionary-size arg",
+    "                      Size of the dictionary trained from the first",
+    "                      blocks of each cell store (default = 16384,",
+    "                      0 = no dictionary)",
     "",
     0
   };
@@ -855,11 +920,21 @@ namespace {
     "SELECT",
     "======",
     "",
-    "    SELECT ('*' | (column_predicate [',' column_predicate]*))",
+    "    SELECT (aggregate_selection | '*'",
+    "            | (column_predicate [',' column_predicate]*))",
     "      FROM table_name",
     "      [where_clause]",
+    "      [group_by_clause]",
     "      [options_spec]",
     "",
+    "    aggregate_selection:",
+    "      (COUNT | SUM | MIN | MAX)",
+    "        '(' ('*' | (column_predicate [',' column_predicate]*)) ')'",
+    "",
+    "    group_by_clause:",
+    "      GROUP BY ROW",
+    "      | GROUP BY ROW PREFIX prefix_length",
+    "",
     "    where_clause:",
     "        WHERE where_predicate [AND where_predicate ...]",
     "",
@@ -933,6 +1008,13 @@ namespace {
     "the operand. Use of the value_predicate without the \"CELLS\" modifier to the",
     "SELECT command is deprecated.",
     "",
+    "COUNT, SUM, MIN and MAX are evaluated by the RangeServers, per column family.",
+    "The result is one cell per column family and group, with the group key as the",
+    "row key.  SUM, MIN and MAX apply to counters and to decimal integer values.",
+    "Without GROUP BY the whole scan is one group; GROUP BY ROW groups by row and",
+    "GROUP BY ROW PREFIX n by the first n bytes of the row key.  Aggregates cannot",
+    "be combined with the limit, offset, KEYS_ONLY or RETURN_DELETES options.",
+    "",
     "If your query selects several independent ranges by specifying multiple row ",
     "predicates  (i.e. WHERE ROW < 'a' OR ROW > 'c') then the OFFSET, LIMIT,",
     "CELL_OFFSET, CELL_LIMIT, predicates are applied to each range independently.",
@@ -1101,6 +1183,7 @@ namespace {
     "    SELECT * FROM test WHERE ('a' <= ROW <= 'e') and",
     "                             '2008-07-28 00:00:02' < TIMESTAMP < '2008-07-28 00:00:07';",
     "    SELECT * FROM test WHERE ROW =^ 'b';",
+    "    SELECT COUNT(*) FROM test WHERE ROW =^ 'b' GROUP BY ROW;",
     "    SELECT * FROM test WHERE (ROW = 'a' or ROW = 'c' or ROW = 'g');",
     "    SELECT * FROM test WHERE ('a' < ROW <= 'c' or ROW = 'g' or ROW = 'c');",
     "    SELECT * FROM test WHERE (ROW < 'c' or ROW > 'd');",
@@ -186,6 +186,8 @@ cmd_create_table(NamespacePtr &ns, ParserState &state,
     schema->validate_compressor(state.table_compressor);
     schema->set_compressor(state.table_compressor);
     schema->set_group_commit_interval(state.group_commit_interval);
+    schema->set_query_cache(state.table_query_cache);
+    schema->set_compaction_policy(state.table_compaction_policy);
 
     foreach_ht(Schema::AccessGroup *ag, state.ag_list) {
       schema->validate_compressor(ag->compressor);
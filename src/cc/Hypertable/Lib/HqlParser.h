@@ -273,7 +273,8 @@ namespace Hypertable {
     class ParserState {
     public:
       ParserState() : command(0), group_commit_interval(0), table_blocksize(0),
-                      table_replication(-1), table_in_memory(false), 
+                      table_replication(-1), table_in_memory(false),
+                      table_query_cache(true), 
                       max_versions(0), time_order_desc(false), ttl(0), 
                       load_flags(0), flags(0), cf(0), ag(0), nanoseconds(0),
                       decimal_seconds(0), delete_all_columns(false),
@@ -303,6 +304,8 @@ namespace Hypertable {
       ::uint32_t table_blocksize;
       ::int32_t table_replication;
       bool table_in_memory;
+      bool table_query_cache;
+      String table_compaction_policy;
       ::uint32_t max_versions;
       bool time_order_desc;
       time_t   ttl;
@@ -711,6 +714,23 @@ namespace Hypertable {
       ParserState &state;
     };
 
+    struct set_value_encoding {
+      set_value_encoding(ParserState &state) : state(state) { }
+      void operator()(char const *str, char const *end) const {
+        String encoding(str, end-str);
+        to_lower(encoding);
+        if (!Schema::valid_value_encoding(encoding))
+          HT_THROWF(Error::HQL_PARSE_ERROR,
+                    "Invalid VALUE_ENCODING '%s' for column family '%s'",
+                    encoding.c_str(), state.cf->name.c_str());
+        if (encoding == "none")
+          state.cf->value_encoding.clear();
+        else
+          state.cf->value_encoding = encoding;
+      }
+      ParserState &state;
+    };
+
     struct clear_column_definition {
       clear_column_definition(ParserState &state) : state(state) { }
       void operator()(char c) const {
@@ -796,6 +816,20 @@ namespace Hypertable {
       ParserState &state;
     };
 
+    struct set_access_group_cell_cache {
+      set_access_group_cell_cache(ParserState &state) : state(state) { }
+      void operator()(char const * str, char const *end) const {
+        state.ag->cell_cache = String(str, end-str);
+        trim_if(state.ag->cell_cache, boost::is_any_of("'\""));
+        to_lower(state.ag->cell_cache);
+        if (!Schema::valid_cell_cache(state.ag->cell_cache))
+          HT_THROWF(Error::HQL_PARSE_ERROR,
+                    "Invalid CellCache type '%s' for access group '%s'",
+                    state.ag->cell_cache.c_str(), state.ag->name.c_str());
+      }
+      ParserState &state;
+    };
+
     struct access_group_add_column_family {
       access_group_add_column_family(ParserState &state) : state(state) { }
       void operator()(char const *str, char const *end) const {
@@ -868,6 +902,39 @@ namespace Hypertable {
       ParserState &state;
     };
 
+    struct scan_set_aggregate {
+      scan_set_aggregate(ParserState &state, int32_t function)
+        : state(state), function(function) { }
+      void operator()(char const *str, char const *end) const {
+        if (state.scan.builder.get().aggregate != ScanSpec::AGGREGATE_NONE)
+          HT_THROW(Error::HQL_PARSE_ERROR,
+                   "SELECT aggregate function multiply defined.");
+        state.scan.builder.set_aggregate(function);
+      }
+      ParserState &state;
+      int32_t function;
+    };
+
+    struct scan_set_group_by {
+      scan_set_group_by(ParserState &state, int32_t grouping)
+        : state(state), grouping(grouping) { }
+      void operator()(char const *str, char const *end) const {
+        set(0);
+      }
+      void operator()(int prefix_length) const {
+        set(prefix_length);
+      }
+      void set(int prefix_length) const {
+        int32_t function = state.scan.builder.get().aggregate;
+        if (function == ScanSpec::AGGREGATE_NONE)
+          HT_THROW(Error::HQL_PARSE_ERROR,
+                   "SELECT GROUP BY requires an aggregate function.");
+        state.scan.builder.set_aggregate(function, grouping, prefix_length);
+      }
+      ParserState &state;
+      int32_t grouping;
+    };
+
     struct scan_set_row_regexp {
       scan_set_row_regexp(ParserState &state) : state(state) { }
       void operator()(char const *str, char const *end) const {
@@ -940,6 +1007,32 @@ namespace Hypertable {
       ParserState &state;
     };
 
+    struct set_table_query_cache {
+      set_table_query_cache(ParserState &state) : state(state) { }
+      void operator()(char const *str, char const *end) const {
+        state.table_query_cache = !(*str == '0' || !strncasecmp(str, "no", 2) ||
+                                    !strncasecmp(str, "off", 3) ||
+                                    !strncasecmp(str, "false", 5));
+      }
+      ParserState &state;
+    };
+
+    struct set_table_compaction_policy {
+      set_table_compaction_policy(ParserState &state) : state(state) { }
+      void operator()(char const *str, char const *end) const {
+        String policy(str, end-str);
+        to_lower(policy);
+        if (!Schema::valid_compaction_policy(policy))
+          HT_THROWF(Error::HQL_PARSE_ERROR, "Invalid COMPACTION_POLICY '%s'",
+                    policy.c_str());
+        if (policy == "default")
+          state.table_compaction_policy.clear();
+        else
+          state.table_compaction_policy = policy;
+      }
+      ParserState &state;
+    };
+
     struct set_table_blocksize {
       set_table_blocksize(ParserState &state) : state(state) { }
       void operator()(size_t blocksize) const {
@@ -2003,6 +2096,7 @@ namespace Hypertable {
           Token TTL          = as_lower_d["ttl"];
           Token TYPE         = as_lower_d["type"];
           Token COUNTER      = as_lower_d["counter"];
+          Token VALUE_ENCODING = as_lower_d["value_encoding"];
           Token MONTHS       = as_lower_d["months"];
           Token MONTH        = as_lower_d["month"];
           Token WEEKS        = as_lower_d["weeks"];
@@ -2072,6 +2166,8 @@ namespace Hypertable {
           Token VALUES       = as_lower_d["values"];
           Token COMPRESSOR   = as_lower_d["compressor"];
           Token GROUP_COMMIT_INTERVAL   = as_lower_d["group_commit_interval"];
+          Token QUERY_CACHE  = as_lower_d["query_cache"];
+          Token COMPACTION_POLICY = as_lower_d["compaction_policy"];
           Token DUMP         = as_lower_d["dump"];
           Token PSEUDO       = as_lower_d["pseudo"];
           Token STATS        = as_lower_d["stats"];
@@ -2084,6 +2180,12 @@ namespace Hypertable {
           Token RETURN_DELETES = as_lower_d["return_deletes"];
           Token SCAN_AND_FILTER_ROWS = as_lower_d["scan_and_filter_rows"];
           Token KEYS_ONLY    = as_lower_d["keys_only"];
+          Token COUNT        = as_lower_d["count"];
+          Token SUM          = as_lower_d["sum"];
+          Token MIN          = as_lower_d["min"];
+          Token MAX          = as_lower_d["max"];
+          Token BY           = as_lower_d["by"];
+          Token PREFIX       = as_lower_d["prefix"];
           Token RANGE        = as_lower_d["range"];
           Token UPDATE       = as_lower_d["update"];
           Token SCANNER      = as_lower_d["scanner"];
@@ -2099,6 +2201,7 @@ namespace Hypertable {
           Token COMMIT       = as_lower_d["commit"];
           Token LOG          = as_lower_d["log"];
           Token BLOOMFILTER  = as_lower_d["bloomfilter"];
+          Token CELLCACHE    = as_lower_d["cellcache"];
           Token TRUE         = as_lower_d["true"];
           Token FALSE        = as_lower_d["false"];
           Token YES          = as_lower_d["yes"];
@@ -2519,6 +2622,10 @@ namespace Hypertable {
             = COMPRESSOR >> *EQUAL >> string_literal[
                 set_table_compressor(self.state)]
             | GROUP_COMMIT_INTERVAL >> *EQUAL >> uint_p[set_group_commit_interval(self.state)]
+            | QUERY_CACHE >> *EQUAL >> boolean_literal[
+                set_table_query_cache(self.state)]
+            | COMPACTION_POLICY >> *EQUAL
+              >> lexeme_d[(+alpha_p)[set_table_compaction_policy(self.state)]]
             | table_option_in_memory[set_table_in_memory(self.state)]
             | table_option_blocksize
             | table_option_replication
@@ -2604,6 +2711,7 @@ namespace Hypertable {
             | time_order_option
             | ttl_option
             | counter_option
+            | value_encoding_option
             ;
 
           max_versions_option
@@ -2624,6 +2732,11 @@ namespace Hypertable {
             = COUNTER[set_counter(self.state)]
             ;
 
+          value_encoding_option
+            = VALUE_ENCODING >> *EQUAL
+              >> lexeme_d[(+alpha_p)[set_value_encoding(self.state)]]
+            ;
+
           duration
             = ureal_p >> !(MONTHS | MONTH | WEEKS | WEEK | DAYS | DAY | HOURS |
                 HOUR | MINUTES | MINUTE | SECONDS | SECOND)
@@ -2653,6 +2766,12 @@ namespace Hypertable {
             | COMPRESSOR >> *EQUAL >> string_literal[
                 set_access_group_compressor(self.state)]
             | bloom_filter_option
+            | cell_cache_option
+            ;
+
+          cell_cache_option
+            = CELLCACHE >> *EQUAL
+              >> string_literal[set_access_group_cell_cache(self.state)]
             ;
 
           bloom_filter_option
@@ -2676,12 +2795,34 @@ namespace Hypertable {
 
           select_statement
             = SELECT >> !(CELLS)
-              >> ('*' | (column_selection >> *(COMMA >> column_selection)))
+              >> (aggregate_selection | '*'
+                  | (column_selection >> *(COMMA >> column_selection)))
               >> FROM >> user_identifier[set_table_name(self.state)]
               >> !where_clause
+              >> !group_by_clause
               >> *(option_spec)
             ;
 
+          aggregate_selection
+            = ((COUNT >> LPAREN)[scan_set_aggregate(self.state,
+                                     ScanSpec::AGGREGATE_COUNT)]
+               | (SUM >> LPAREN)[scan_set_aggregate(self.state,
+                                     ScanSpec::AGGREGATE_SUM)]
+               | (MIN >> LPAREN)[scan_set_aggregate(self.state,
+                                     ScanSpec::AGGREGATE_MIN)]
+               | (MAX >> LPAREN)[scan_set_aggregate(self.state,
+                                     ScanSpec::AGGREGATE_MAX)])
+              >> ('*' | (column_selection >> *(COMMA >> column_selection)))
+              >> RPAREN
+            ;
+
+          group_by_clause
+            = GROUP >> BY >> ROW >> PREFIX >> uint_p[scan_set_group_by(
+                self.state, ScanSpec::GROUP_BY_ROW_PREFIX)]
+            | GROUP >> BY >> ROW[scan_set_group_by(self.state,
+                                     ScanSpec::GROUP_BY_ROW)]
+            ;
+
           column_selection
             = (identifier[scan_add_column_family(self.state, 
                         EXACT_QUALIFIER)] >> QUALPREFIX >>
@@ -2913,10 +3054,12 @@ namespace Hypertable {
           BOOST_SPIRIT_DEBUG_RULE(regexp_literal);
           BOOST_SPIRIT_DEBUG_RULE(ttl_option);
           BOOST_SPIRIT_DEBUG_RULE(counter_option);
+          BOOST_SPIRIT_DEBUG_RULE(value_encoding_option);
           BOOST_SPIRIT_DEBUG_RULE(access_group_definition);
           BOOST_SPIRIT_DEBUG_RULE(index_definition);
           BOOST_SPIRIT_DEBUG_RULE(access_group_option);
           BOOST_SPIRIT_DEBUG_RULE(bloom_filter_option);
+          BOOST_SPIRIT_DEBUG_RULE(cell_cache_option);
           BOOST_SPIRIT_DEBUG_RULE(in_memory_option);
           BOOST_SPIRIT_DEBUG_RULE(blocksize_option);
           BOOST_SPIRIT_DEBUG_RULE(replication_option);
@@ -2924,6 +3067,8 @@ namespace Hypertable {
           BOOST_SPIRIT_DEBUG_RULE(describe_table_statement);
           BOOST_SPIRIT_DEBUG_RULE(show_statement);
           BOOST_SPIRIT_DEBUG_RULE(select_statement);
+          BOOST_SPIRIT_DEBUG_RULE(aggregate_selection);
+          BOOST_SPIRIT_DEBUG_RULE(group_by_clause);
           BOOST_SPIRIT_DEBUG_RULE(where_clause);
           BOOST_SPIRIT_DEBUG_RULE(where_predicate);
           BOOST_SPIRIT_DEBUG_RULE(time_predicate);
@@ -3009,11 +3154,12 @@ namespace Hypertable {
           max_versions_option, time_order_option, statement,
           single_string_literal, double_string_literal, string_literal, 
           parameter_list, regexp_literal, ttl_option, counter_option, 
+          value_encoding_option,
           access_group_definition, index_definition, access_group_option,
-          bloom_filter_option, in_memory_option,
+          bloom_filter_option, cell_cache_option, in_memory_option,
           blocksize_option, replication_option, help_statement,
           describe_table_statement, show_statement, select_statement,
-          where_clause, where_predicate,
+          aggregate_selection, group_by_clause, where_clause, where_predicate,
           time_predicate, relop, row_interval, row_predicate, column_predicate,
           value_predicate, column_selection,
           option_spec, unused_tokens, datetime, date, time, year,
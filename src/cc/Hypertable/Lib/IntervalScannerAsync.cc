@@ -20,9 +20,11 @@
  */
 
 #include "Common/Compat.h"
+#include <algorithm>
 #include <cassert>
 #include <vector>
 
+#include "Common/Config.h"
 #include "Common/Error.h"
 #include "Common/String.h"
 
@@ -49,16 +51,28 @@ IntervalScannerAsync::IntervalScannerAsync(Comm *comm, ApplicationQueueInterface
   : m_table(table), m_range_locator(range_locator),
     m_loc_cache(range_locator->location_cache()),
     m_scan_limit_state(scan_spec), m_range_server(comm, timeout_ms), m_eos(false),
-    m_fetch_outstanding(false), m_create_outstanding(false),
+    m_fetch_outstanding(0), m_fetch_orphans(0), m_create_outstanding(false),
     m_end_inclusive(false), m_timeout_ms(timeout_ms),
     m_current(current), m_bytes_scanned(0),
     m_create_handler(app_queue, scanner, id, true),
     m_fetch_handler(app_queue, scanner, id, false),
     m_create_timer(timeout_ms), m_fetch_timer(timeout_ms),
     m_cur_scanner_finished(false), m_cur_scanner_id(0), m_state(0),
-    m_create_event_saved(false), m_invalid_scanner_id_ok(false) {
+    m_create_event_saved(false), m_invalid_scanner_id_ok(false),
+    m_readahead_depth(1), m_block_bytes(0) {
 
   HT_ASSERT(m_timeout_ms);
+  HT_ASSERT(Config::properties);
+
+  // Pipelined fetches would only produce cells past the limit (or skew the
+  // OFFSET accounting), so only pipeline unlimited scans
+  m_readahead_max = Config::properties->get_i32(
+      "Hypertable.Scanner.Readahead.MaxDepth");
+  m_readahead_memory = Config::properties->get_i64(
+      "Hypertable.Scanner.Readahead.MemoryLimit");
+  if (m_readahead_max < 1 || scan_spec.row_limit || scan_spec.cell_limit ||
+      scan_spec.row_offset || scan_spec.cell_offset)
+    m_readahead_max = 1;
 
   table->get(m_table_identifier, m_schema);
   init(scan_spec);
@@ -75,6 +89,14 @@ void IntervalScannerAsync::init(const ScanSpec &scan_spec) {
     HT_THROW(Error::BAD_SCAN_SPEC,
              "ROW predicates and CELL predicates can't be combined");
 
+  if (scan_spec.aggregate != ScanSpec::AGGREGATE_NONE &&
+      (scan_spec.row_limit || scan_spec.cell_limit ||
+       scan_spec.cell_limit_per_family || scan_spec.row_offset ||
+       scan_spec.cell_offset || scan_spec.keys_only ||
+       scan_spec.return_deletes))
+    HT_THROW(Error::BAD_SCAN_SPEC, "Aggregates can't be combined with "
+             "limits, offsets, KEYS_ONLY or RETURN_DELETES");
+
   m_range_server.set_default_timeout(m_timeout_ms);
   m_rowset.clear();
 
@@ -88,6 +110,8 @@ void IntervalScannerAsync::init(const ScanSpec &scan_spec) {
   m_scan_spec_builder.set_row_offset(scan_spec.row_offset);
   m_scan_spec_builder.set_cell_offset(scan_spec.cell_offset);
   m_scan_spec_builder.set_do_not_cache(scan_spec.do_not_cache);
+  m_scan_spec_builder.set_aggregate(scan_spec.aggregate, scan_spec.group_by,
+                                    scan_spec.group_by_prefix_length);
 
   foreach_ht (const ColumnPredicate &cp, scan_spec.column_predicates)
     m_scan_spec_builder.add_column_predicate(cp.column_family,
@@ -292,9 +316,14 @@ void IntervalScannerAsync::reset_outstanding_status(bool is_create, bool reset_t
       m_create_timer.reset();
   }
   else {
-    HT_ASSERT(m_fetch_outstanding && (m_current || m_invalid_scanner_id_ok));
-    m_fetch_outstanding = false;
-    if (reset_timer)
+    HT_ASSERT(m_fetch_outstanding || m_fetch_orphans);
+    if (m_fetch_outstanding) {
+      HT_ASSERT(m_current || m_invalid_scanner_id_ok);
+      m_fetch_outstanding--;
+    }
+    else
+      m_fetch_orphans--;
+    if (reset_timer && !m_fetch_outstanding)
       m_fetch_timer.reset();
   }
 }
@@ -309,17 +338,27 @@ bool IntervalScannerAsync::abort(bool is_create) {
   return move_to_next;
 }
 
-bool IntervalScannerAsync::is_destroyed_scanner(bool is_create) {
-  // handle case where row limit was hit and scanner was cancelled but fetch request is
-  // still outstanding
-  reset_outstanding_status(is_create, true);
-  if (m_invalid_scanner_id_ok) {
+bool IntervalScannerAsync::is_destroyed_scanner(bool is_create, bool *move_to_next) {
+  // fetch requests pipelined past the last block of a scanner come back
+  // with an invalid scanner id once the RangeServer has destroyed it
+  if (!is_create && m_fetch_orphans)
+    m_fetch_orphans--;
+  else {
+    // handle case where row limit was hit and scanner was cancelled but fetch
+    // request is still outstanding
+    reset_outstanding_status(is_create, true);
+    if (!m_invalid_scanner_id_ok) {
+      *move_to_next = !has_outstanding_requests();
+      return false;
+    }
     HT_ASSERT(!is_create);
-    HT_ASSERT(!has_outstanding_requests());
-    m_invalid_scanner_id_ok = false;
-    return true;
+    if (!m_fetch_outstanding)
+      m_invalid_scanner_id_ok = false;
   }
-  return false;
+  *move_to_next = m_eos && !has_outstanding_requests();
+  if (*move_to_next)
+    m_current = false;
+  return true;
 }
 
 bool IntervalScannerAsync::retry_or_abort(bool refresh, bool hard, bool is_create,
@@ -428,8 +467,8 @@ bool IntervalScannerAsync::handle_result(bool *show_results, ScanCellsPtr &cells
       *show_results = false;
     else {
       // scan is over but there was a create/fetch outstanding, send a ScanCells with 0 cells
-      // and just the eos bit set
-      *show_results = true;
+      // and just the eos bit set once the last one has come back
+      *show_results = !has_outstanding_requests();
       cells = new ScanCells;
     }
     return !has_outstanding_requests();
@@ -494,8 +533,10 @@ bool IntervalScannerAsync::handle_result(bool *show_results, ScanCellsPtr &cells
 
 void IntervalScannerAsync::set_result(EventPtr &event, ScanCellsPtr &cells,
         bool is_create) {
+  int last_scanner_id = m_cur_scanner_id;
   cells = new ScanCells;
   m_cur_scanner_finished = cells->add(event, &m_cur_scanner_id);
+  adjust_readahead(m_cur_scanner_id != last_scanner_id, event->payload_len);
 
   // if there was an OFFSET (or CELL_OFFSET) predicate in the query and the
   // RangeServer actually skipped rows (or cells) because of this predicate
@@ -517,14 +558,38 @@ void IntervalScannerAsync::set_result(EventPtr &event, ScanCellsPtr &cells,
     }
   }
 
+  // fetches pipelined past the last block of the current scanner will come
+  // back with an invalid scanner id, stop counting them against the scan
+  if (m_cur_scanner_finished && m_fetch_outstanding) {
+    m_fetch_orphans += m_fetch_outstanding;
+    m_fetch_outstanding = 0;
+  }
+
   // current scanner is finished but we have results saved from the next scanner
   if (m_cur_scanner_finished && m_create_event_saved) {
     HT_ASSERT(skipped_rows == 0 && skipped_cells == 0);
-    HT_ASSERT(!has_outstanding_requests());
+    HT_ASSERT(!m_create_outstanding && !m_fetch_outstanding);
     m_create_event_saved = false;
     m_range_info = m_next_range_info;
     m_cur_scanner_finished = cells->add(m_create_event, &m_cur_scanner_id);
+    adjust_readahead(true, m_create_event->payload_len);
+  }
+}
+
+void IntervalScannerAsync::adjust_readahead(bool new_scanner, size_t block_bytes) {
+  // Start every RangeServer scanner with a single outstanding fetch and
+  // double the depth with each block it returns (short ranges then don't
+  // waste requests), bounded by the memory limit for blocks in flight
+  m_block_bytes = m_block_bytes ? (3*m_block_bytes + block_bytes) / 4 : block_bytes;
+  if (new_scanner) {
+    m_readahead_depth = 1;
+    return;
   }
+  int64_t limit = m_readahead_max;
+  if (m_block_bytes)
+    limit = std::min(limit, std::max((int64_t)1,
+                                     m_readahead_memory / (int64_t)m_block_bytes));
+  m_readahead_depth = (int32_t)std::min(limit, (int64_t)m_readahead_depth * 2);
 }
 
 void IntervalScannerAsync::load_result(ScanCellsPtr &cells) {
@@ -609,17 +674,21 @@ void IntervalScannerAsync::do_readahead() {
 
   // if the current scanner is not finished
   if (!m_cur_scanner_finished) {
-    HT_ASSERT(!m_fetch_outstanding && !m_eos && m_current);
-    // request next scanblock and block
+    HT_ASSERT(!m_eos && m_current);
+    // request next scanblocks; the RangeServer serializes fetches for a
+    // scanner (request group) so the blocks come back in order
     try {
-      m_fetch_timer.start();
-      m_fetch_outstanding = true;
-      m_range_server.fetch_scanblock(m_range_info.addr, m_cur_scanner_id,
-                                     &m_fetch_handler, m_fetch_timer);
+      while (m_fetch_outstanding < m_readahead_depth) {
+        m_fetch_timer.reset(true);
+        m_fetch_outstanding++;
+        m_range_server.fetch_scanblock(m_range_info.addr, m_cur_scanner_id,
+                                       &m_fetch_handler, m_fetch_timer);
+      }
     }
     catch (Exception &e) {
-      m_fetch_outstanding = false;
-      m_fetch_timer.reset();
+      m_fetch_outstanding--;
+      if (!m_fetch_outstanding)
+        m_fetch_timer.reset();
       if (e.code() == Error::COMM_NOT_CONNECTED ||
           e.code() == Error::COMM_BROKEN_CONNECTION ||
           e.code() == Error::COMM_INVALID_PROXY) {
@@ -68,13 +68,16 @@ namespace Hypertable {
             bool *move_to_next, int last_error);
     bool handle_result(bool *show_results, ScanCellsPtr &cells, EventPtr &event, bool is_create);
     bool set_current(bool *show_results, ScanCellsPtr &cells, bool abort);
-    inline bool has_outstanding_requests() { return m_create_outstanding || m_fetch_outstanding; }
+    inline bool has_outstanding_requests() {
+      return m_create_outstanding || m_fetch_outstanding || m_fetch_orphans;
+    }
     int64_t bytes_scanned() { return m_bytes_scanned; }
-    bool is_destroyed_scanner(bool is_create);
+    bool is_destroyed_scanner(bool is_create, bool *move_to_next);
 
   private:
     void reset_outstanding_status(bool is_create, bool reset_timer);
     void do_readahead();
+    void adjust_readahead(bool new_scanner, size_t block_bytes);
     void init(const ScanSpec &);
     void find_range_and_start_scan(const char *row_key, bool hard=false);
     void set_result(EventPtr &event, ScanCellsPtr &cells, bool is_create=false);
@@ -94,7 +97,8 @@ namespace Hypertable {
     String              m_create_scanner_row;
     RangeLocationInfo   m_range_info;
     RangeLocationInfo   m_next_range_info;
-    bool                m_fetch_outstanding;
+    int32_t             m_fetch_outstanding;
+    int32_t             m_fetch_orphans;
     bool                m_create_outstanding;
     EventPtr            m_create_event;
     String              m_start_row;
@@ -115,6 +119,10 @@ namespace Hypertable {
     DynamicBuffer       m_last_key_buf;
     bool                m_create_event_saved;
     bool                m_invalid_scanner_id_ok;
+    int32_t             m_readahead_depth;
+    int32_t             m_readahead_max;
+    int64_t             m_readahead_memory;
+    size_t              m_block_bytes;
   };
 
   typedef intrusive_ptr<IntervalScannerAsync> IntervalScannerAsyncPtr;
@@ -38,7 +38,8 @@ using namespace Hyperspace;
 
 
 NameIdMapper::NameIdMapper(Hyperspace::SessionPtr &hyperspace, const String &toplevel_dir)
-  : m_hyperspace(hyperspace), m_toplevel_dir(toplevel_dir) {
+  : m_hyperspace(hyperspace), m_toplevel_dir(toplevel_dir),
+    m_batch_unsupported(false) {
 
   /*
    * Prefix looks like this:  "/" <toplevel_dir> "namemap" "names"
@@ -104,6 +105,10 @@ void NameIdMapper::add_entry(const String &names_parent, const String &names_ent
   attrs.push_back(Attribute("name", names_entry.c_str(), names_entry.length()));
   attrs.push_back(Attribute("nid", "0", 1));
 
+  // For tables, the id and names files are created in one request
+  Hyperspace::Batch batch;
+  uint32_t oflags = OPEN_FLAG_READ|OPEN_FLAG_WRITE|OPEN_FLAG_CREATE|OPEN_FLAG_EXCL;
+
   if (m_hyperspace->exists(ids_file)) {
     if (is_namespace) {
       if (!m_hyperspace->attr_exists(ids_file, "nid")) {
@@ -121,13 +126,17 @@ void NameIdMapper::add_entry(const String &names_parent, const String &names_ent
         throw;
       }
     }
-    else
-      m_hyperspace->attr_set(ids_file, OPEN_FLAG_READ|OPEN_FLAG_WRITE|OPEN_FLAG_CREATE|OPEN_FLAG_EXCL,
-                             "name", names_entry.c_str(), names_entry.length());
+    else {
+      std::vector<Attribute> name_attr;
+      name_attr.push_back(Attribute("name", names_entry.c_str(),
+                                    names_entry.length()));
+      batch.attr_set(ids_file, oflags, name_attr);
+    }
   }
 
-  // At this point the ID file exists, we now need to
-  // create the names file/dir and update the "id" attribute
+  // At this point the ID file exists (for a table, its creation is queued
+  // in batch), we now need to create the names file/dir and update the
+  // "id" attribute
 
   char buf[16];
   sprintf(buf, "%llu", (Llu)id);
@@ -139,8 +148,12 @@ void NameIdMapper::add_entry(const String &names_parent, const String &names_ent
   }
   else {
     // Set the "id" attribute of the names file
-    m_hyperspace->attr_set(names_file, OPEN_FLAG_READ|OPEN_FLAG_WRITE|OPEN_FLAG_CREATE|OPEN_FLAG_EXCL,
-                           "id", buf, strlen(buf));
+    std::vector<Attribute> id_attr;
+    id_attr.push_back(Attribute("id", buf, strlen(buf)));
+    batch.attr_set(names_file, oflags, id_attr);
+    execute(batch);
+    if (batch.get_error() != Error::OK)
+      HT_THROW(batch.get_error(), batch.get_error_msg());
   }
   ids.push_back(id);
 }
@@ -163,14 +176,36 @@ void NameIdMapper::add_mapping(const String &name, String &id, int flags, bool i
   String names_parent = "";
   String names_child = "";
 
+  // Fetch the ids of the intermediate namespaces in one round trip; the
+  // lookups stop at the first one that doesn't exist
+  Hyperspace::Batch lookup;
+  std::vector<String> id_attr(1, "id");
+  for (size_t i=0; i<name_components.size()-1; i++) {
+    names_child += String("/") + name_components[i];
+    lookup.attrs_get(m_names_dir + names_child, id_attr);
+  }
+  if (lookup.size())
+    execute(lookup);
+  names_child = "";
+
   for (size_t i=0; i<name_components.size()-1; i++) {
 
     names_child += String("/") + name_components[i];
 
     try {
-      String names_file = m_names_dir + names_child;
-      m_hyperspace->attr_get(names_file, "id", value_buf);
-      id_components.push_back( strtoll((const char *)value_buf.base, 0, 0) );
+      if (i < lookup.completed()) {
+        const DynamicBufferPtr &value = lookup.get_values(i).front();
+        if (!value)
+          HT_THROW(Error::HYPERSPACE_ATTR_NOT_FOUND, "id");
+        id_components.push_back( strtoll((const char *)value->base, 0, 0) );
+      }
+      else if (i == lookup.completed())
+        HT_THROW(lookup.get_error(), lookup.get_error_msg());
+      else {
+        String names_file = m_names_dir + names_child;
+        m_hyperspace->attr_get(names_file, "id", value_buf);
+        id_components.push_back( strtoll((const char *)value_buf.base, 0, 0) );
+      }
     }
     catch (Exception &e) {
 
@@ -204,6 +239,57 @@ void NameIdMapper::add_mapping(const String &name, String &id, int flags, bool i
     id += String("/") + id_components[i];
 }
 
+void NameIdMapper::execute(Hyperspace::Batch &batch) {
+  if (!m_batch_unsupported) {
+    try {
+      m_hyperspace->execute(batch);
+      return;
+    }
+    catch (Exception &e) {
+      if (e.code() != Error::NOT_IMPLEMENTED)
+        throw;
+      HT_INFO("Hyperspace master does not support batches, issuing "
+              "operations one at a time");
+      m_batch_unsupported = true;
+    }
+  }
+  execute_unbatched(batch);
+}
+
+void NameIdMapper::execute_unbatched(Hyperspace::Batch &batch) {
+  size_t i = 0;
+  try {
+    for (; i<batch.size(); i++) {
+      Hyperspace::Batch::Op &op = batch.get_op(i);
+      switch (op.type) {
+      case Hyperspace::Batch::EXISTS:
+        op.exists = m_hyperspace->exists(op.name);
+        break;
+      case Hyperspace::Batch::ATTR_EXISTS:
+        op.exists = m_hyperspace->attr_exists(op.name, op.attrs.front());
+        break;
+      case Hyperspace::Batch::ATTRS_GET:
+        m_hyperspace->attrs_get(op.name, op.attrs, op.results);
+        break;
+      case Hyperspace::Batch::ATTR_SET:
+        {
+          std::vector<Attribute> attrs;
+          for (size_t j=0; j<op.attrs.size(); j++)
+            attrs.push_back(Attribute(op.attrs[j].c_str(), op.values[j].data(),
+                                      op.values[j].length()));
+          m_hyperspace->attr_set(op.name, op.oflags, attrs);
+        }
+        break;
+      }
+    }
+  }
+  catch (Exception &e) {
+    batch.set_outcome(i, e.code(), e.what());
+    return;
+  }
+  batch.set_outcome(i, Error::OK, "");
+}
+
 void NameIdMapper::rename(const String &curr_name, const String &next_name) {
   ScopedLock lock(m_mutex);
   String id;
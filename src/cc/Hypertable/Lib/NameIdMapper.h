@@ -107,12 +107,28 @@ namespace Hypertable {
     bool do_mapping(const String &input, bool id_in, String &output, bool *is_namespacep);
     static void get_namespace_listing(const std::vector<Hyperspace::DirEntryAttr> &dir_listing, std::vector<NamespaceListing> &listing);
 
+    /** Executes a batch of Hyperspace operations.  If the master does not
+     * support batches, falls back to execute_unbatched() for this and all
+     * subsequent batches.
+     * @param batch operations to execute, receives the results
+     */
+    void execute(Hyperspace::Batch &batch);
+
+    /** Executes the operations of a batch one request at a time, stopping
+     * at the first one that fails.  Unlike a batch, the updates preceding a
+     * failed operation are not undone.
+     * @param batch operations to execute, receives the results
+     */
+    void execute_unbatched(Hyperspace::Batch &batch);
+
     Mutex m_mutex;
     Hyperspace::SessionPtr m_hyperspace;
     String m_toplevel_dir;
     String m_names_dir;
     String m_ids_dir;
     size_t m_prefix_components;
+    /// Set when the Hyperspace master turns out not to support batches
+    bool m_batch_unsupported;
   };
 
   typedef intrusive_ptr<NameIdMapper> NameIdMapperPtr;
@@ -204,6 +204,9 @@ void Namespace::alter_table(const String &table_name, SchemaPtr &alter_schema) {
 
         existing_cf->max_versions = alter_cf->max_versions;
         existing_cf->ttl = alter_cf->ttl;
+        // Columnar blocks are self-describing, so existing CellStores stay
+        // readable when the value encoding changes
+        existing_cf->value_encoding = alter_cf->value_encoding;
         existing_cf->generation = final_schema->get_generation();
       }
       else {
@@ -628,6 +628,25 @@ RangeServerClient::do_relinquish_range(const CommAddress &addr, const TableIdent
              + Protocol::string_format_message(event));
 }
 
+void
+RangeServerClient::attach_cellstores(const CommAddress &addr,
+                                     const TableIdentifier &table,
+                                     const RangeSpec &range,
+                                     const std::vector<String> &ag_names,
+                                     const std::vector<String> &files,
+                                     Timer &timer) {
+  DispatchHandlerSynchronizer sync_handler;
+  EventPtr event;
+  CommBufPtr cbp(RangeServerProtocol::create_request_attach_cellstores(table,
+                                                 range, ag_names, files));
+  send_message(addr, cbp, &sync_handler, timer.remaining());
+
+  if (!sync_handler.wait_for_reply(event))
+    HT_THROW((int)Protocol::response_code(event),
+             String("RangeServer attach_cellstores() failure : ")
+             + Protocol::string_format_message(event));
+}
+
 void RangeServerClient::heapcheck(const CommAddress &addr, String &outfile) {
   DispatchHandlerSynchronizer sync_handler;
   EventPtr event;
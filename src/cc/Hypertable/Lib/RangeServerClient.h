@@ -507,6 +507,19 @@ namespace Hypertable {
     void relinquish_range(const CommAddress &addr, const TableIdentifier &table,
                           const RangeSpec &range, Timer &timer);
 
+    /** Issues an "attach cellstores" request synchronously, with timer.
+     * @param addr address of RangeServer
+     * @param table table identifier
+     * @param range range specification
+     * @param ag_names access group of each CellStore
+     * @param files staged CellStore files, parallel to <code>ag_names</code>
+     * @param timer timer
+     */
+    void attach_cellstores(const CommAddress &addr, const TableIdentifier &table,
+                           const RangeSpec &range,
+                           const std::vector<String> &ag_names,
+                           const std::vector<String> &files, Timer &timer);
+
     /** Issues a "heapcheck" request.  This call blocks until it receives a
      * response from the server.
      * @param addr address of RangeServer
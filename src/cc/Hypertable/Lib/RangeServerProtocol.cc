@@ -29,12 +29,18 @@
 #include "AsyncComm/CommBuf.h"
 #include "AsyncComm/CommHeader.h"
 
+#include "Common/Error.h"
+
+#include "BlockCompressionHeader.h"
+#include "CompressorFactory.h"
 #include "RangeServerProtocol.h"
 
 namespace Hypertable {
 
   using namespace Serialization;
 
+  const char RangeServerProtocol::UPDATE_BLOCK_MAGIC[11] = "Update----";
+
   const char *RangeServerProtocol::m_command_strings[] = {
     "load range",
     "update",
@@ -67,6 +73,7 @@ namespace Hypertable {
     "phantom commit ranges",
     "dump pseudo table",
     "set state",
+    "attach cellstores",
     (const char *)0
   };
 
@@ -191,6 +198,47 @@ namespace Hypertable {
     return cbuf;
   }
 
+  bool RangeServerProtocol::compress_updates(BlockCompressionCodec *codec,
+      const StaticBuffer &updates, StaticBuffer &output) {
+    BlockCompressionHeader header(UPDATE_BLOCK_MAGIC);
+    DynamicBuffer input(0, false);
+    DynamicBuffer zbuf;
+
+    input.base = updates.base;
+    input.ptr = input.base + updates.size;
+    input.size = updates.size;
+    codec->deflate(input, zbuf, header);
+
+    // incompressible payload, send it as is
+    if (header.get_compression_type() == BlockCompressionCodec::NONE)
+      return false;
+
+    output = zbuf;
+    return true;
+  }
+
+  void RangeServerProtocol::decompress_updates(const uint8_t *data,
+      size_t len, StaticBuffer &updates) {
+    BlockCompressionHeader header;
+    const uint8_t *ptr = data;
+    size_t remain = len;
+
+    header.decode(&ptr, &remain);
+    if (!header.check_magic(UPDATE_BLOCK_MAGIC))
+      HT_THROW(Error::BLOCK_COMPRESSOR_BAD_MAGIC,
+               "Bad magic string in compressed update");
+
+    BlockCompressionCodecPtr codec(CompressorFactory::create_block_codec(
+        (BlockCompressionCodec::Type)header.get_compression_type()));
+    DynamicBuffer input(0, false);
+    DynamicBuffer output;
+    input.base = (uint8_t *)data;
+    input.ptr = input.base + len;
+    input.size = len;
+    codec->inflate(input, output, header);
+    updates = output;
+  }
+
   CommBuf *
   RangeServerProtocol::create_request_update_schema(
       const TableIdentifier &table, const String &schema) {
@@ -369,6 +417,27 @@ namespace Hypertable {
     return cbuf;
   }
 
+  CommBuf *
+  RangeServerProtocol::create_request_attach_cellstores(const TableIdentifier &table,
+                                                        const RangeSpec &range,
+                                                        const std::vector<String> &ag_names,
+                                                        const std::vector<String> &files) {
+    CommHeader header(COMMAND_ATTACH_CELLSTORES);
+    size_t len = table.encoded_length() + range.encoded_length() + 4;
+    HT_ASSERT(ag_names.size() == files.size());
+    for (size_t i=0; i<files.size(); i++)
+      len += encoded_length_vstr(ag_names[i]) + encoded_length_vstr(files[i]);
+    CommBuf *cbuf = new CommBuf(header, len);
+    table.encode(cbuf->get_data_ptr_address());
+    range.encode(cbuf->get_data_ptr_address());
+    cbuf->append_i32(files.size());
+    for (size_t i=0; i<files.size(); i++) {
+      cbuf->append_vstr(ag_names[i]);
+      cbuf->append_vstr(files[i]);
+    }
+    return cbuf;
+  }
+
   CommBuf *RangeServerProtocol::create_request_heapcheck(const String &outfile) {
     CommHeader header(COMMAND_HEAPCHECK);
     header.flags |= CommHeader::FLAGS_BIT_URGENT;
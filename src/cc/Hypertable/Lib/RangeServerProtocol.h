@@ -32,6 +32,7 @@
 
 #include "Common/StaticBuffer.h"
 
+#include "BlockCompressionCodec.h"
 #include "RangeState.h"
 #include "ScanSpec.h"
 #include "Types.h"
@@ -81,7 +82,8 @@ namespace Hypertable {
     static const uint64_t COMMAND_PHANTOM_COMMIT_RANGES    = 29;
     static const uint64_t COMMAND_DUMP_PSEUDO_TABLE        = 30;
     static const uint64_t COMMAND_SET_STATE                = 31;
-    static const uint64_t COMMAND_MAX                      = 32;
+    static const uint64_t COMMAND_ATTACH_CELLSTORES        = 32;
+    static const uint64_t COMMAND_MAX                      = 33;
 
     static const char *m_command_strings[];
 
@@ -95,9 +97,15 @@ namespace Hypertable {
     // The flags shd be the same as in Hypertable::TableMutator.
     enum {
       /* Don't force a commit log sync on update */
-      UPDATE_FLAG_NO_LOG_SYNC        = 0x0001
+      UPDATE_FLAG_NO_LOG_SYNC        = 0x0001,
+      /* Update payload is a compressed block (wire only, set by the
+       * scatter buffer) */
+      UPDATE_FLAG_COMPRESSED         = 0x0002
     };
 
+    /// Magic string of the block header of a compressed update payload
+    static const char UPDATE_BLOCK_MAGIC[11];
+
     // Compaction flags
     enum CompactionFlags {
       COMPACT_FLAG_ROOT     = 0x0001,
@@ -155,6 +163,30 @@ namespace Hypertable {
     static CommBuf *create_request_update(const TableIdentifier &table,
                                           uint32_t count, StaticBuffer &buffer, uint32_t flags);
 
+    /** Compresses the payload of an "update" request into a block with an
+     * #UPDATE_BLOCK_MAGIC header.  A request carrying the block is sent with
+     * UPDATE_FLAG_COMPRESSED set.
+     * @param codec block compression codec
+     * @param updates buffer holding key/value pairs
+     * @param output receives the compressed block
+     * @return <i>false</i> if the payload does not compress, in which case
+     * it should be sent uncompressed
+     */
+    static bool compress_updates(BlockCompressionCodec *codec,
+                                 const StaticBuffer &updates,
+                                 StaticBuffer &output);
+
+    /** Inflates the payload of an "update" request sent with
+     * UPDATE_FLAG_COMPRESSED.
+     * @param data compressed block
+     * @param len length of compressed block
+     * @param updates receives the key/value pairs, in a buffer it owns
+     * @throws Exception with code Error::BLOCK_COMPRESSOR_BAD_MAGIC if the
+     * block is not an update block, or the inflate error of the codec
+     */
+    static void decompress_updates(const uint8_t *data, size_t len,
+                                   StaticBuffer &updates);
+
     /** Creates an "update schema" message. Used to update schema for a
      * table
      * @param table table identifier
@@ -284,6 +316,18 @@ namespace Hypertable {
     static CommBuf *create_request_relinquish_range(const TableIdentifier &table,
                                                     const RangeSpec &range);
 
+    /** Creates an "attach cellstores" request message.
+     * @param table table identifier
+     * @param range range specification
+     * @param ag_names access group of each CellStore
+     * @param files staged CellStore files, parallel to <code>ag_names</code>
+     * @return protocol message
+     */
+    static CommBuf *create_request_attach_cellstores(const TableIdentifier &table,
+                                                     const RangeSpec &range,
+                                                     const std::vector<String> &ag_names,
+                                                     const std::vector<String> &files);
+
     /** Creates a "heapcheck" request message.
      * @param outfile name of file to dump heap stats to
      * @return protocol message
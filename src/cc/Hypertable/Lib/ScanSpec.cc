@@ -111,7 +111,10 @@ size_t ScanSpec::encoded_length() const {
                encoded_length_vstr(row_regexp) +
                encoded_length_vstr(value_regexp) +
                encoded_length_vi32(row_offset) +
-               encoded_length_vi32(cell_offset);
+               encoded_length_vi32(cell_offset) +
+               encoded_length_vi32(aggregate) +
+               encoded_length_vi32(group_by) +
+               encoded_length_vi32(group_by_prefix_length);
 
   foreach_ht(const char *c, columns) len += encoded_length_vstr(c);
   foreach_ht(const RowInterval &ri, row_intervals) len += ri.encoded_length();
@@ -144,6 +147,9 @@ void ScanSpec::encode(uint8_t **bufp) const {
   encode_bool(bufp, do_not_cache);
   encode_vi32(bufp, row_offset);
   encode_vi32(bufp, cell_offset);
+  encode_vi32(bufp, aggregate);
+  encode_vi32(bufp, group_by);
+  encode_vi32(bufp, group_by_prefix_length);
 }
 
 void ScanSpec::decode(const uint8_t **bufp, size_t *remainp) {
@@ -178,7 +184,22 @@ void ScanSpec::decode(const uint8_t **bufp, size_t *remainp) {
     scan_and_filter_rows = decode_bool(bufp, remainp);
     do_not_cache = decode_bool(bufp, remainp);
     row_offset = decode_vi32(bufp, remainp);
-    cell_offset = decode_vi32(bufp, remainp));
+    cell_offset = decode_vi32(bufp, remainp);
+    aggregate = decode_vi32(bufp, remainp);
+    group_by = decode_vi32(bufp, remainp);
+    group_by_prefix_length = decode_vi32(bufp, remainp));
+}
+
+
+const char *ScanSpec::aggregate_name(int32_t function) {
+  switch (function) {
+  case AGGREGATE_NONE:  return "none";
+  case AGGREGATE_COUNT: return "count";
+  case AGGREGATE_SUM:   return "sum";
+  case AGGREGATE_MIN:   return "min";
+  case AGGREGATE_MAX:   return "max";
+  }
+  return "unknown";
 }
 
 
@@ -243,6 +264,12 @@ ostream &Hypertable::operator<<(ostream &os, const ScanSpec &scan_spec) {
   os <<" do_not_cache=" << scan_spec.do_not_cache;
   os <<" row_offset=" << scan_spec.row_offset;
   os <<" cell_offset=" << scan_spec.cell_offset;
+  if (scan_spec.aggregate != ScanSpec::AGGREGATE_NONE) {
+    os <<" aggregate=" << ScanSpec::aggregate_name(scan_spec.aggregate);
+    os <<" group_by=" << scan_spec.group_by;
+    if (scan_spec.group_by == ScanSpec::GROUP_BY_ROW_PREFIX)
+      os <<" group_by_prefix_length=" << scan_spec.group_by_prefix_length;
+  }
 
   if (!scan_spec.row_intervals.empty()) {
     os << "\n rows=";
@@ -285,7 +312,8 @@ ScanSpec::ScanSpec(CharArena &arena, const ScanSpec &ss)
     return_deletes(ss.return_deletes), keys_only(ss.keys_only),
     row_regexp(arena.dup(ss.row_regexp)), value_regexp(arena.dup(ss.value_regexp)),
     scan_and_filter_rows(ss.scan_and_filter_rows),
-    do_not_cache(ss.do_not_cache) {
+    do_not_cache(ss.do_not_cache), aggregate(ss.aggregate),
+    group_by(ss.group_by), group_by_prefix_length(ss.group_by_prefix_length) {
   columns.reserve(ss.columns.size());
   row_intervals.reserve(ss.row_intervals.size());
   cell_intervals.reserve(ss.cell_intervals.size());
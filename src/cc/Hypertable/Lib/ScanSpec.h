@@ -143,13 +143,34 @@ typedef std::vector<ColumnPredicate, ColumnPredicateAlloc> ColumnPredicates;
  */
 class ScanSpec {
 public:
+
+  /** Aggregate functions (see #aggregate).  Evaluated per column family
+   * by the RangeServer; integer cell values and counters are aggregated,
+   * other values are only counted.
+   */
+  enum {
+    AGGREGATE_NONE  = 0,
+    AGGREGATE_COUNT = 1,
+    AGGREGATE_SUM   = 2,
+    AGGREGATE_MIN   = 3,
+    AGGREGATE_MAX   = 4
+  };
+
+  /// Aggregate groupings (see #group_by)
+  enum {
+    GROUP_BY_NONE       = 0,
+    GROUP_BY_ROW        = 1,
+    GROUP_BY_ROW_PREFIX = 2
+  };
+
   ScanSpec()
     : row_limit(0), cell_limit(0), cell_limit_per_family(0), 
       row_offset(0), cell_offset(0), max_versions(0),
       time_interval(TIMESTAMP_MIN, TIMESTAMP_MAX),
       return_deletes(false), keys_only(false),
       row_regexp(0), value_regexp(0), scan_and_filter_rows(false),
-      do_not_cache(false) { }
+      do_not_cache(false), aggregate(AGGREGATE_NONE),
+      group_by(GROUP_BY_NONE), group_by_prefix_length(0) { }
   ScanSpec(CharArena &arena)
     : row_limit(0), cell_limit(0), cell_limit_per_family(0), 
       row_offset(0), cell_offset(0), max_versions(0), columns(CstrAlloc(arena)),
@@ -159,7 +180,8 @@ public:
       time_interval(TIMESTAMP_MIN, TIMESTAMP_MAX),
       return_deletes(false), keys_only(false),
       row_regexp(0), value_regexp(0), scan_and_filter_rows(false),
-      do_not_cache(false) { }
+      do_not_cache(false), aggregate(AGGREGATE_NONE),
+      group_by(GROUP_BY_NONE), group_by_prefix_length(0) { }
   ScanSpec(CharArena &arena, const ScanSpec &);
   ScanSpec(const uint8_t **bufp, size_t *remainp) { decode(bufp, remainp); }
 
@@ -186,6 +208,9 @@ public:
     value_regexp = 0;
     scan_and_filter_rows = false;
     do_not_cache = false;
+    aggregate = AGGREGATE_NONE;
+    group_by = GROUP_BY_NONE;
+    group_by_prefix_length = 0;
   }
 
   /** 
@@ -215,10 +240,14 @@ public:
     other.scan_and_filter_rows = scan_and_filter_rows;
     other.do_not_cache = do_not_cache;
     other.column_predicates = column_predicates;
+    other.aggregate = aggregate;
+    other.group_by = group_by;
+    other.group_by_prefix_length = group_by_prefix_length;
   }
 
   bool cacheable() {
-    if (do_not_cache)
+    // aggregate results would be served to plain lookups of the same row
+    if (do_not_cache || aggregate != AGGREGATE_NONE)
       return false;
     else if (row_intervals.size() == 1) {
       HT_ASSERT(row_intervals[0].start && row_intervals[0].end);
@@ -351,6 +380,29 @@ public:
     time_interval.second = end;
   }
 
+  /** Sets the aggregate to evaluate instead of returning cells.
+   * @param function One of the AGGREGATE_ constants
+   * @param grouping One of the GROUP_BY_ constants
+   * @param prefix_length Length of row prefix for GROUP_BY_ROW_PREFIX
+   */
+  void set_aggregate(int32_t function, int32_t grouping = GROUP_BY_NONE,
+                     int32_t prefix_length = 0) {
+    if (function < AGGREGATE_NONE || function > AGGREGATE_MAX)
+      HT_THROWF(Error::BAD_SCAN_SPEC, "Invalid aggregate function %d",
+                (int)function);
+    if (grouping < GROUP_BY_NONE || grouping > GROUP_BY_ROW_PREFIX ||
+        (grouping == GROUP_BY_ROW_PREFIX && prefix_length <= 0))
+      HT_THROWF(Error::BAD_SCAN_SPEC, "Invalid aggregate grouping %d/%d",
+                (int)grouping, (int)prefix_length);
+    aggregate = function;
+    group_by = grouping;
+    group_by_prefix_length =
+      (grouping == GROUP_BY_ROW_PREFIX) ? prefix_length : 0;
+  }
+
+  /// Returns the name of an aggregate function
+  static const char *aggregate_name(int32_t function);
+
   int32_t row_limit;
   int32_t cell_limit;
   int32_t cell_limit_per_family;
@@ -368,6 +420,15 @@ public:
   const char *value_regexp;
   bool scan_and_filter_rows;
   bool do_not_cache;
+
+  /** Aggregate function.  If set, the scan returns one cell per group and
+   * column family holding the aggregate, instead of the cells themselves.
+   * RangeServers return partial aggregates per range, with the group key
+   * (see #group_by) as column qualifier; TableScanner merges them.
+   */
+  int32_t aggregate;
+  int32_t group_by;
+  int32_t group_by_prefix_length;
 };
 
 /**
@@ -581,6 +642,19 @@ public:
     m_scan_spec.do_not_cache = val;
   }
 
+  /**
+   * Evaluate an aggregate function instead of returning cells
+   *
+   * @param function one of the ScanSpec::AGGREGATE_ constants
+   * @param grouping one of the ScanSpec::GROUP_BY_ constants
+   * @param prefix_length row prefix length for ScanSpec::GROUP_BY_ROW_PREFIX
+   */
+  void set_aggregate(int32_t function,
+                     int32_t grouping = ScanSpec::GROUP_BY_NONE,
+                     int32_t prefix_length = 0) {
+    m_scan_spec.set_aggregate(function, grouping, prefix_length);
+  }
+
   /**
    * Clears the state.
    */
@@ -72,7 +72,7 @@ Mutex desc_mutex;
 bool desc_inited = false;
 
 PropertiesDesc
-  compressor_desc("  bmz|lzo|quicklz|zlib|snappy|none [compressor_options]\n\n"
+  compressor_desc("  bmz|lzo|quicklz|zlib|snappy|zstd|none [compressor_options]\n\n"
       "compressor_options"),
   bloom_filter_desc("  rows|rows+cols|none [bloom_filter_options]\n\n"
       "  Default bloom filter is defined by the config property:\n"
@@ -93,10 +93,13 @@ void init_schema_options_desc() {
     ("normal", "Normal setting for zlib")
     ("fp-len", i16()->default_value(19), "Minimum fingerprint length for bmz")
     ("offset", i16()->default_value(0), "Starting fingerprint offset for bmz")
+    ("level", i32()->default_value(3), "Compression level (1-22) for zstd")
+    ("dictionary-size", i32()->default_value(16384), "Size of the "
+        "dictionary trained for each cell store for zstd (0 disables)")
     ;
   compressor_hidden_desc.add_options()
     ("compressor-type", str(), 
-        "Compressor type (bmz|lzo|quicklz|zlib|snappy|none)")
+        "Compressor type (bmz|lzo|quicklz|zlib|snappy|zstd|none)")
     ;
   compressor_pos_desc.add("compressor-type", 1);
 
@@ -109,6 +112,9 @@ void init_schema_options_desc() {
      "probability for the Bloom filter")
     ("max-approx-items", i32()->default_value(1000), "Number of cell store "
         "items used to guess the number of actual Bloom filter entries")
+    ("blocked", boo()->zero_tokens()->default_value(false), "Use cache line "
+        "blocked Bloom filter (faster lookups, slightly higher false "
+        "positive rate)")
     ;
   bloom_filter_hidden_desc.add_options()
     ("bloom-filter-mode", str(), "Bloom filter mode (rows|rows+cols|none)")
@@ -125,7 +131,7 @@ Schema::Schema()
     m_column_family_map(), m_generation(0), m_access_groups(),
     m_open_access_group(0), m_open_column_family(0), m_need_id_assignment(false),
     m_output_ids(false), m_max_column_family_id(0), m_counter_flags(0),
-    m_group_commit_interval(0) {
+    m_group_commit_interval(0), m_query_cache(true) {
 }
 /**
  * Assumes src_schema has been checked for validity
@@ -139,6 +145,8 @@ Schema::Schema(const Schema &src_schema)
   m_generation = src_schema.m_generation;
   m_compressor = src_schema.m_compressor;
   m_group_commit_interval = src_schema.m_group_commit_interval;
+  m_query_cache = src_schema.m_query_cache;
+  m_compaction_policy = src_schema.m_compaction_policy;
   m_next_column_id = src_schema.m_next_column_id;
   m_max_column_family_id = src_schema.m_max_column_family_id;
   m_need_id_assignment = src_schema.m_need_id_assignment;
@@ -155,6 +163,7 @@ Schema::Schema(const Schema &src_schema)
     ag->blocksize = src_ag->blocksize;
     ag->compressor = src_ag->compressor;
     ag->bloom_filter = src_ag->bloom_filter;
+    ag->cell_cache = src_ag->cell_cache;
 
     m_access_group_map.insert(make_pair(ag->name, ag));
     m_access_groups.push_back(ag);
@@ -308,6 +317,15 @@ void Schema::start_element_handler(void *userdata,
         ms_schema->set_compressor((String)atts[i+1]);
       else if (!strcasecmp(atts[i], "group_commit_interval"))
         ms_schema->set_group_commit_interval(atoi(atts[i+1]));
+      else if (!strcasecmp(atts[i], "query_cache"))
+        ms_schema->set_query_cache(strcasecmp(atts[i+1], "false") != 0);
+      else if (!strcasecmp(atts[i], "compaction_policy")) {
+        if (!valid_compaction_policy(atts[i+1]))
+          ms_schema->set_error_string((String)"Invalid compaction policy : "
+                                      + atts[i+1]);
+        else if (strcasecmp(atts[i+1], "default"))
+          ms_schema->set_compaction_policy(boost::to_lower_copy(String(atts[i+1])));
+      }
       else
         ms_schema->set_error_string((String)"Unrecognized 'Schema' attribute : "
                                      + atts[i]);
@@ -334,7 +352,8 @@ void Schema::start_element_handler(void *userdata,
            || !strcasecmp(name, "deleted") || !strcasecmp(name, "renamed")
            || !strcasecmp(name, "NewName") || !strcasecmp(name, "Counter")
            || !strcasecmp(name, "TimeOrder") || !strcasecmp(name, "Index")
-           || !strcasecmp(name, "QualifierIndex"))
+           || !strcasecmp(name, "QualifierIndex")
+           || !strcasecmp(name, "ValueEncoding"))
     ms_collected_text = "";
   else
     ms_schema->set_error_string(format("Unrecognized element - '%s'", name));
@@ -353,7 +372,8 @@ void Schema::end_element_handler(void *userdata, const XML_Char *name) {
            || !strcasecmp(name, "deleted") || !strcasecmp(name, "renamed")
            || !strcasecmp(name, "NewName") || !strcasecmp(name, "Counter")
            || !strcasecmp(name, "TimeOrder") || !strcasecmp(name, "Index")
-           || !strcasecmp(name, "QualifierIndex")) {
+           || !strcasecmp(name, "QualifierIndex")
+           || !strcasecmp(name, "ValueEncoding")) {
     boost::trim(ms_collected_text);
     ms_schema->set_column_family_parameter(name, ms_collected_text.c_str());
   }
@@ -513,6 +533,14 @@ void Schema::set_access_group_parameter(const char *param, const char *value) {
       boost::trim(m_open_access_group->bloom_filter);
       validate_bloom_filter(m_open_access_group->bloom_filter);
     }
+    else if (!strcasecmp(param, "cellCache")) {
+      m_open_access_group->cell_cache = value;
+      boost::trim(m_open_access_group->cell_cache);
+      boost::to_lower(m_open_access_group->cell_cache);
+      if (!valid_cell_cache(m_open_access_group->cell_cache))
+        set_error_string((String)"Invalid value (" + value
+                          + ") for AccessGroup attribute '" + param + "'");
+    }
     else
       set_error_string((string)"Invalid AccessGroup attribute '" + param + "'");
   }
@@ -578,6 +606,14 @@ void Schema::set_column_family_parameter(const char *param, const char *value) {
     else
       m_open_column_family->counter = false;
   }
+  else if (!strcasecmp(param, "ValueEncoding")) {
+    if (!valid_value_encoding(value))
+      set_error_string(format("Invalid value (%s) for ValueEncoding", value));
+    else if (!strcasecmp(value, "none"))
+      m_open_column_family->value_encoding.clear();
+    else
+      m_open_column_family->value_encoding = boost::to_lower_copy(String(value));
+  }
   else if (!strcasecmp(param, "id")) {
     m_open_column_family->id = atoi(value);
     if (m_open_column_family->id == 0)
@@ -677,6 +713,12 @@ void Schema::render(String &output, bool with_ids) {
   if (m_group_commit_interval > 0)
     output += format(" group_commit_interval=\"%u\"", m_group_commit_interval);
 
+  if (!m_query_cache)
+    output += " query_cache=\"false\"";
+
+  if (!m_compaction_policy.empty())
+    output += format(" compaction_policy=\"%s\"", m_compaction_policy.c_str());
+
   output += ">\n";
 
   foreach_ht(const AccessGroup *ag, m_access_groups) {
@@ -700,6 +742,9 @@ void Schema::render(String &output, bool with_ids) {
     if (ag->bloom_filter != "")
       output += (String)" bloomFilter=\"" + ag->bloom_filter + "\"";
 
+    if (ag->cell_cache != "")
+      output += format(" cellCache=\"%s\"", ag->cell_cache.c_str());
+
     output += ">\n";
 
     foreach_ht(const ColumnFamily *cf, ag->columns) {
@@ -740,6 +785,9 @@ void Schema::render(String &output, bool with_ids) {
         output += format("      <Index>true</Index>\n");
       if (cf->has_qualifier_index)
         output += format("      <QualifierIndex>true</QualifierIndex>\n");
+      if (!cf->value_encoding.empty())
+        output += format("      <ValueEncoding>%s</ValueEncoding>\n",
+                         cf->value_encoding.c_str());
 
       output += "    </ColumnFamily>\n";
     }
@@ -783,6 +831,9 @@ void Schema::render_hql_create_table(const String &table_name, String &output) {
     if (cf->ttl != 0)
       output += format(" TTL %d", (int)cf->ttl);
 
+    if (!cf->value_encoding.empty())
+      output += format(" VALUE_ENCODING %s", cf->value_encoding.c_str());
+
     if (cf->has_index) {
       if (hql_needs_quotes(cf->name.c_str()))
         output += format(", INDEX '%s'", cf->name.c_str());
@@ -828,6 +879,9 @@ void Schema::render_hql_create_table(const String &table_name, String &output) {
       ag_string += format(" BLOOMFILTER \"%s\"",
           ag->bloom_filter.c_str());
 
+    if (ag->cell_cache != "")
+      ag_string += format(" CELLCACHE \"%s\"", ag->cell_cache.c_str());
+
     if (!ag->columns.empty()) {
       bool display_comma = false;
       ag_string += " (";
@@ -862,6 +916,12 @@ void Schema::render_hql_create_table(const String &table_name, String &output) {
   if (m_group_commit_interval > 0)
     output += format(" GROUP_COMMIT_INTERVAL %u", m_group_commit_interval);
 
+  if (!m_query_cache)
+    output += " QUERY_CACHE=false";
+
+  if (!m_compaction_policy.empty())
+    output += format(" COMPACTION_POLICY %s", m_compaction_policy.c_str());
+
   output += "\n";
 }
 
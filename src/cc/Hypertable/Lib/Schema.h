@@ -64,6 +64,7 @@ namespace Hypertable {
       bool renamed;
       bool counter;
       bool modification;
+      String value_encoding;
     };
 
     typedef std::vector<ColumnFamily *> ColumnFamilies;
@@ -77,6 +78,7 @@ namespace Hypertable {
       uint32_t blocksize;
       String compressor;
       String bloom_filter;
+      String cell_cache;
       ColumnFamilies columns;
       bool in_memory;
       bool counter;
@@ -99,6 +101,27 @@ namespace Hypertable {
     void validate_bloom_filter(const String &spec);
     static const PropertiesDesc &bloom_filter_spec_desc();
 
+    /** Checks if a CellCache type specification is valid.
+     * @param spec CellCache type (<code>map</code> or <code>skiplist</code>)
+     * @return <i>true</i> if <code>spec</code> is a valid CellCache type
+     */
+    static bool valid_cell_cache(const String &spec) {
+      return !strcasecmp(spec.c_str(), "map") ||
+        !strcasecmp(spec.c_str(), "skiplist");
+    }
+
+    /** Checks if a column family value encoding is valid.
+     * @param spec Value encoding (<code>none</code>, <code>delta</code>,
+     * <code>for</code> or <code>rle</code>)
+     * @return <i>true</i> if <code>spec</code> is a valid value encoding
+     */
+    static bool valid_value_encoding(const String &spec) {
+      return !strcasecmp(spec.c_str(), "none") ||
+        !strcasecmp(spec.c_str(), "delta") ||
+        !strcasecmp(spec.c_str(), "for") ||
+        !strcasecmp(spec.c_str(), "rle");
+    }
+
     void open_access_group();
     void close_access_group();
     void open_column_family();
@@ -181,6 +204,28 @@ namespace Hypertable {
     }
     uint32_t get_group_commit_interval() { return m_group_commit_interval; }
 
+    void set_query_cache(bool enabled) { m_query_cache = enabled; }
+    bool get_query_cache() { return m_query_cache; }
+
+    /** Sets the CellStore merge policy.
+     * @param policy Policy name, empty for the RangeServer default
+     */
+    void set_compaction_policy(const String &policy) {
+      m_compaction_policy = policy;
+    }
+    const String &get_compaction_policy() { return m_compaction_policy; }
+
+    /** Checks if a compaction policy name is valid.
+     * @param spec Policy (<code>default</code>, <code>tiered</code> or
+     * <code>leveled</code>)
+     * @return <i>true</i> if <code>spec</code> is a valid policy
+     */
+    static bool valid_compaction_policy(const String &spec) {
+      return !strcasecmp(spec.c_str(), "default") ||
+        !strcasecmp(spec.c_str(), "tiered") ||
+        !strcasecmp(spec.c_str(), "leveled");
+    }
+
     typedef std::unordered_map<String, ColumnFamily *> ColumnFamilyMap;
     typedef std::unordered_map<String, AccessGroup *> AccessGroupMap;
 
@@ -205,6 +250,8 @@ namespace Hypertable {
     String         m_compressor;
     std::vector<int>  m_counter_flags;
     uint32_t       m_group_commit_interval;
+    bool           m_query_cache;
+    String         m_compaction_policy;
 
     static void
     start_element_handler(void *userdata, const XML_Char *name,
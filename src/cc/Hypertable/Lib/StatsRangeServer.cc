@@ -28,16 +28,18 @@ using namespace Hypertable;
 
 namespace {
   enum Group {
-    PRIMARY_GROUP = 0
+    PRIMARY_GROUP = 0,
+    BLOCK_CACHE_GROUP = 1
   };
 }
 
-StatsRangeServer::StatsRangeServer() : StatsSerializable(RANGE_SERVER, 1), timestamp(TIMESTAMP_MIN) {
+StatsRangeServer::StatsRangeServer() : StatsSerializable(RANGE_SERVER, 2), timestamp(TIMESTAMP_MIN) {
   group_ids[0] = PRIMARY_GROUP;
+  group_ids[1] = BLOCK_CACHE_GROUP;
 }
 
 
-StatsRangeServer::StatsRangeServer(PropertiesPtr &props) : StatsSerializable(RANGE_SERVER, 1), timestamp(TIMESTAMP_MIN) {
+StatsRangeServer::StatsRangeServer(PropertiesPtr &props) : StatsSerializable(RANGE_SERVER, 2), timestamp(TIMESTAMP_MIN) {
   const char *base, *ptr;
   String datadirs = props->get_str("Hypertable.RangeServer.Monitoring.DataDirectories");
   String dir;
@@ -60,6 +62,7 @@ StatsRangeServer::StatsRangeServer(PropertiesPtr &props) : StatsSerializable(RAN
                         StatsSystem::DISK|StatsSystem::SWAP|StatsSystem::NET|
                         StatsSystem::PROC | StatsSystem::FS, dirs);
   group_ids[0] = PRIMARY_GROUP;
+  group_ids[1] = BLOCK_CACHE_GROUP;
 }
 
 StatsRangeServer::StatsRangeServer(const StatsRangeServer &other) : StatsSerializable(other.id, other.group_count) {
@@ -85,6 +88,7 @@ StatsRangeServer::StatsRangeServer(const StatsRangeServer &other) : StatsSeriali
   block_cache_available_memory = other.block_cache_available_memory;
   block_cache_accesses = other.block_cache_accesses;
   block_cache_hits = other.block_cache_hits;
+  block_cache_shards = other.block_cache_shards;
   tracked_memory = other.tracked_memory;
   cpu_user = other.cpu_user;
   cpu_sys = other.cpu_sys;
@@ -115,6 +119,7 @@ bool StatsRangeServer::operator==(const StatsRangeServer &other) const {
       block_cache_available_memory != other.block_cache_available_memory ||
       block_cache_accesses != other.block_cache_accesses ||
       block_cache_hits != other.block_cache_hits ||
+      block_cache_shards != other.block_cache_shards ||
       tracked_memory != other.tracked_memory ||
       !Serialization::equal(cpu_user, other.cpu_user) ||
       !Serialization::equal(cpu_sys, other.cpu_sys) ||
@@ -143,6 +148,10 @@ size_t StatsRangeServer::encoded_length_group(int group) const {
       len += tables[i].encoded_length();
     return len;
   }
+  else if (group == BLOCK_CACHE_GROUP) {
+    return Serialization::encoded_length_vi32(block_cache_shards.size()) +
+      block_cache_shards.size() * 8*5;
+  }
   else
     HT_FATALF("Invalid group number (%d)", group);
   return 0;
@@ -180,6 +189,16 @@ void StatsRangeServer::encode_group(int group, uint8_t **bufp) const {
     for (size_t i=0; i<tables.size(); i++)
       tables[i].encode(bufp);
   }
+  else if (group == BLOCK_CACHE_GROUP) {
+    Serialization::encode_vi32(bufp, block_cache_shards.size());
+    for (size_t i=0; i<block_cache_shards.size(); i++) {
+      Serialization::encode_i64(bufp, block_cache_shards[i].max_memory);
+      Serialization::encode_i64(bufp, block_cache_shards[i].available_memory);
+      Serialization::encode_i64(bufp, block_cache_shards[i].accesses);
+      Serialization::encode_i64(bufp, block_cache_shards[i].hits);
+      Serialization::encode_i64(bufp, block_cache_shards[i].evictions);
+    }
+  }
   else
     HT_FATALF("Invalid group number (%d)", group);
 }
@@ -220,6 +239,17 @@ void StatsRangeServer::decode_group(int group, uint16_t len, const uint8_t **buf
       tables.push_back(table);
     }
   }
+  else if (group == BLOCK_CACHE_GROUP) {
+    size_t shard_count = Serialization::decode_vi32(bufp, remainp);
+    block_cache_shards.resize(shard_count);
+    for (size_t i=0; i<shard_count; i++) {
+      block_cache_shards[i].max_memory = Serialization::decode_i64(bufp, remainp);
+      block_cache_shards[i].available_memory = Serialization::decode_i64(bufp, remainp);
+      block_cache_shards[i].accesses = Serialization::decode_i64(bufp, remainp);
+      block_cache_shards[i].hits = Serialization::decode_i64(bufp, remainp);
+      block_cache_shards[i].evictions = Serialization::decode_i64(bufp, remainp);
+    }
+  }
   else {
     HT_WARNF("Unrecognized StatsRangeServer group %d, skipping...", group);
     (*bufp) += len;
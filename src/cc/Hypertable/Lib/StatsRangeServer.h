@@ -43,6 +43,26 @@ namespace Hypertable {
     
   public:
 
+    /** Statistics for one shard of the block cache */
+    struct BlockCacheShard {
+      BlockCacheShard() : max_memory(0), available_memory(0), accesses(0),
+                          hits(0), evictions(0) { }
+      bool operator==(const BlockCacheShard &other) const {
+        return max_memory == other.max_memory &&
+          available_memory == other.available_memory &&
+          accesses == other.accesses && hits == other.hits &&
+          evictions == other.evictions;
+      }
+      bool operator!=(const BlockCacheShard &other) const {
+        return !(*this == other);
+      }
+      uint64_t max_memory;
+      uint64_t available_memory;
+      uint64_t accesses;
+      uint64_t hits;
+      uint64_t evictions;
+    };
+
     StatsRangeServer();
 
     StatsRangeServer(PropertiesPtr &props);
@@ -83,6 +103,7 @@ namespace Hypertable {
     uint64_t block_cache_available_memory;
     uint64_t block_cache_accesses;
     uint64_t block_cache_hits;
+    std::vector<BlockCacheShard> block_cache_shards;
     uint64_t tracked_memory;
     double   cpu_user;
     double   cpu_sys;
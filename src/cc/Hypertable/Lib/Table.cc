@@ -179,6 +179,12 @@ Table::create_mutator(uint32_t timeout_ms, uint32_t flags,
     refresh_if_required();
   }
 
+  // a flush latency is enforced from a timer, so that updates don't wait
+  // for the next update to notice that they are due
+  if (flush_interval_ms == 0)
+    flush_interval_ms =
+      m_props->get_i32("Hypertable.Mutator.ScatterBuffer.FlushLatency");
+
   if (flush_interval_ms) {
     return new TableMutatorShared(m_props, m_comm, this, m_range_locator,
                                   m_app_queue, timeout, flush_interval_ms, flags);
@@ -83,7 +83,8 @@ namespace Hypertable {
      *        mutator methods to execute before throwing an exception
      * @param flags mutator flags
      * @param flush_interval_ms time interval in milliseconds to flush
-     *        data. 0 disables it.
+     *        data. 0 uses Hypertable.Mutator.ScatterBuffer.FlushLatency,
+     *        which disables it by default.
      * @return newly constructed mutator object
      */
     TableMutator *create_mutator(uint32_t timeout_ms = 0,
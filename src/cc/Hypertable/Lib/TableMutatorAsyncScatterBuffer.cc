@@ -23,6 +23,7 @@
 #include "Common/Config.h"
 #include "Common/Timer.h"
 
+#include "CompressorFactory.h"
 #include "Key.h"
 #include "KeySpec.h"
 #include "Table.h"
@@ -53,6 +54,13 @@ TableMutatorAsyncScatterBuffer::TableMutatorAsyncScatterBuffer(Comm *comm,
 
   m_server_flush_limit = Config::properties->get_i32(
       "Hypertable.Mutator.ScatterBuffer.FlushLimit.PerServer");
+  m_flush_latency = Config::properties->get_i32(
+      "Hypertable.Mutator.ScatterBuffer.FlushLatency");
+  m_compression_threshold = Config::properties->get_i32(
+      "Hypertable.Mutator.ScatterBuffer.CompressionThreshold");
+  if (m_compression_threshold)
+    m_update_codec = CompressorFactory::create_block_codec(
+        Config::properties->get_str("Hypertable.Mutator.ScatterBuffer.Compressor"));
 }
 
 TableMutatorAsyncScatterBuffer::~TableMutatorAsyncScatterBuffer() {
@@ -129,25 +137,28 @@ TableMutatorAsyncScatterBuffer::set(const Key &key, const void *value, uint32_t
 
     if ((*iter).second->accum.fill() > m_server_flush_limit)
       m_full = true;
-    m_memory_used += incr_mem;
+    note_update(incr_mem);
   }
 }
 
 
 void TableMutatorAsyncScatterBuffer::set_delete(const Key &key, size_t incr_mem) {
-  ScopedLock lock(m_mutex);
-
   RangeLocationInfo range_info;
   TableMutatorAsyncSendBufferMap::const_iterator iter;
 
   if (key.flag == FLAG_INSERT)
     HT_THROW(Error::BAD_KEY, "Key flag is FLAG_INSERT, expected delete");
 
+  // locate the range before locking so that a METADATA lookup doesn't stall
+  // other threads adding to this buffer
   if (!m_location_cache->lookup(m_table_identifier.id, key.row, &range_info)) {
     Timer timer(m_timeout_ms, true);
     m_range_locator->find_loop(&m_table_identifier, key.row, &range_info,
                                timer, false);
   }
+
+  ScopedLock lock(m_mutex);
+
   iter = m_buffer_map.find(range_info.addr);
 
   if (iter == m_buffer_map.end()) {
@@ -174,14 +185,12 @@ void TableMutatorAsyncScatterBuffer::set_delete(const Key &key, size_t incr_mem)
   append_as_byte_string((*iter).second->accum, 0, 0);
   if ((*iter).second->accum.fill() > m_server_flush_limit)
     m_full = true;
-  m_memory_used += incr_mem;
+  note_update(incr_mem);
 }
 
 
 void
 TableMutatorAsyncScatterBuffer::set(SerializedKey key, ByteString value, size_t incr_mem) {
-  ScopedLock lock(m_mutex);
-
   RangeLocationInfo range_info;
   TableMutatorAsyncSendBufferMap::const_iterator iter;
   const uint8_t *ptr = key.ptr;
@@ -194,6 +203,8 @@ TableMutatorAsyncScatterBuffer::set(SerializedKey key, ByteString value, size_t
                                &range_info, timer, false);
   }
 
+  ScopedLock lock(m_mutex);
+
   iter = m_buffer_map.find(range_info.addr);
 
   if (iter == m_buffer_map.end()) {
@@ -209,6 +220,34 @@ TableMutatorAsyncScatterBuffer::set(SerializedKey key, ByteString value, size_t
 
   if ((*iter).second->accum.fill() > m_server_flush_limit)
     m_full = true;
+  note_update(incr_mem);
+}
+
+
+bool TableMutatorAsyncScatterBuffer::full() {
+  ScopedLock lock(m_mutex);
+  if (m_full)
+    return true;
+  // flush by age if the per-server/aggregate limits aren't reached in time
+  if (!m_flush_latency)
+    return false;
+  HiResTime now;
+  return flush_latency_reached(m_flush_latency, m_memory_used, m_first_update,
+                               now);
+}
+
+
+bool TableMutatorAsyncScatterBuffer::flush_latency_reached(
+    uint32_t flush_latency, size_t memory_used, HiResTime &first_update,
+    HiResTime &now) {
+  return flush_latency && memory_used &&
+    xtime_diff_millis(first_update, now) >= (int64_t)flush_latency;
+}
+
+
+void TableMutatorAsyncScatterBuffer::note_update(size_t incr_mem) {
+  if (m_memory_used == 0 && m_flush_latency)
+    m_first_update.reset();
   m_memory_used += incr_mem;
 }
 
@@ -297,11 +336,18 @@ void TableMutatorAsyncScatterBuffer::send(uint32_t flags) {
      * Send update
      */
     try {
+      StaticBuffer compressed;
       m_send_flags = flags;
       send_buffer->pending_updates.own = false;
-      m_range_server.update(send_buffer->addr, m_table_identifier,
-                            send_buffer->send_count, send_buffer->pending_updates, flags,
-                            send_buffer->dispatch_handler.get());
+      if (compress_updates(send_buffer->pending_updates, compressed))
+        m_range_server.update(send_buffer->addr, m_table_identifier,
+                              send_buffer->send_count, compressed,
+                              flags | RangeServerProtocol::UPDATE_FLAG_COMPRESSED,
+                              send_buffer->dispatch_handler.get());
+      else
+        m_range_server.update(send_buffer->addr, m_table_identifier,
+                              send_buffer->send_count, send_buffer->pending_updates, flags,
+                              send_buffer->dispatch_handler.get());
 
       outstanding = true;
 
@@ -340,6 +386,20 @@ void TableMutatorAsyncScatterBuffer::send(uint32_t flags) {
 }
 
 
+/**
+ * Compresses a per-server update payload into a block with an
+ * UPDATE_BLOCK_MAGIC header.  The uncompressed payload is kept in the send
+ * buffer since retries and failed regions are computed from it.
+ */
+bool TableMutatorAsyncScatterBuffer::compress_updates(StaticBuffer &updates,
+                                                      StaticBuffer &output) {
+  if (!m_update_codec || updates.size < m_compression_threshold)
+    return false;
+  return RangeServerProtocol::compress_updates(m_update_codec.get(), updates,
+                                               output);
+}
+
+
 void TableMutatorAsyncScatterBuffer::wait_for_completion() {
   ScopedLock lock(m_mutex);
 
@@ -38,9 +38,11 @@
 #include "Common/FlyweightString.h"
 #include "Common/ReferenceCount.h"
 #include "Common/StringExt.h"
+#include "Common/Time.h"
 #include "Common/Timer.h"
 #include "Common/InetAddr.h"
 
+#include "BlockCompressionCodec.h"
 #include "Cell.h"
 #include "Cells.h"
 #include "Key.h"
@@ -65,7 +67,7 @@ namespace Hypertable {
     void set(const Key &, const void *value, uint32_t value_len, size_t incr_mem);
     void set_delete(const Key &key, size_t incr_mem);
     void set(SerializedKey key, ByteString value, size_t incr_mem);
-    bool full() { ScopedLock lock(m_mutex); return m_full; }
+    bool full();
     void send(uint32_t flags);
     void wait_for_completion();
     TableMutatorAsyncScatterBuffer *create_redo_buffer(uint32_t id);
@@ -93,8 +95,26 @@ namespace Hypertable {
     void finish();
     void set_retries_to_fail(int error);
 
+    /**
+     * Checks if buffered updates have been held for the flush latency.
+     *
+     * @param flush_latency Hypertable.Mutator.ScatterBuffer.FlushLatency in
+     * milliseconds, 0 disables the check
+     * @param memory_used amount of memory used by the buffered updates
+     * @param first_update time the oldest buffered update was added
+     * @param now current time
+     * @return true if there are buffered updates and the oldest one is at
+     * least <code>flush_latency</code> milliseconds old
+     */
+    static bool flush_latency_reached(uint32_t flush_latency,
+                                      size_t memory_used,
+                                      HiResTime &first_update,
+                                      HiResTime &now);
+
   private:
     int set_failed_mutations();
+    void note_update(size_t incr_mem);
+    bool compress_updates(StaticBuffer &updates, StaticBuffer &output);
     typedef CommAddressMap<TableMutatorAsyncSendBufferPtr> TableMutatorAsyncSendBufferMap;
 
     Comm                *m_comm;
@@ -115,6 +135,10 @@ namespace Hypertable {
     bool                 m_auto_refresh;
     uint32_t             m_timeout_ms;
     uint32_t             m_server_flush_limit;
+    uint32_t             m_flush_latency;
+    uint32_t             m_compression_threshold;
+    BlockCompressionCodecPtr m_update_codec;
+    HiResTime            m_first_update;
     DynamicBuffer        m_counter_value;
     Timer                m_timer;
     uint32_t             m_id;
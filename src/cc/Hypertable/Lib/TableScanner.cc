@@ -46,6 +46,8 @@ TableScanner::TableScanner(Comm *comm, Table *table,
   ApplicationQueueInterfacePtr app_queue = (ApplicationQueueInterface *)m_queue.get();
   m_scanner = new TableScannerAsync(comm, app_queue, table, range_locator, 
                                     scan_spec, timeout_ms, &m_callback);
+  if (scan_spec.aggregate != ScanSpec::AGGREGATE_NONE)
+    m_aggregate = new AggregateMerger(scan_spec.aggregate);
 }
 
 
@@ -57,6 +59,24 @@ bool TableScanner::next(Cell &cell) {
     return true;
   }
 
+  if (!m_aggregate)
+    return next_cell(cell);
+
+  while (!m_aggregate->next(cell)) {
+    Cell partial;
+    if (m_aggregate->done())
+      return false;
+    if (next_cell(partial))
+      m_aggregate->add(partial);
+    else
+      m_aggregate->finish();
+  }
+  return true;
+}
+
+
+bool TableScanner::next_cell(Cell &cell) {
+
   if (m_eos)
     return false;
 
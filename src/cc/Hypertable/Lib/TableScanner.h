@@ -26,6 +26,7 @@
 
 #include "Common/ReferenceCount.h"
 
+#include "AggregateMerger.h"
 #include "ClientObject.h"
 #include "TableScannerQueue.h"
 #include "TableScannerAsync.h"
@@ -74,7 +75,8 @@ namespace Hypertable {
     }
 
     /**
-     * Get the next cell.
+     * Get the next cell.  If the scan spec has an aggregate, the cells are
+     * the merged aggregate results, one per column family and group.
      *
      * @param cell The cell object to contain the result
      * @return true for success
@@ -96,6 +98,10 @@ namespace Hypertable {
   private:
 
     friend class TableCallback;
+
+    /// Returns the next cell received from the RangeServers
+    bool next_cell(Cell &cell);
+
     /**
      * Callback method for successful scan
      *
@@ -121,6 +127,7 @@ namespace Hypertable {
     String m_error_msg;
     bool m_eos;
     Cell m_ungot;
+    AggregateMergerPtr m_aggregate;
   };
   typedef intrusive_ptr<TableScanner> TableScannerPtr;
 
@@ -415,8 +415,16 @@ void TableScannerAsync::handle_error(int scanner_id, int error, const String &er
         }
         break;
       case(Error::RANGESERVER_INVALID_SCANNER_ID):
-        abort = !(m_interval_scanners[scanner_id]->is_destroyed_scanner(is_create));
-        next = !m_interval_scanners[scanner_id]->has_outstanding_requests();
+        abort = !(m_interval_scanners[scanner_id]->is_destroyed_scanner(is_create,
+                    &next));
+        if (!abort && next) {
+          // last outstanding request of a finished interval scanner
+          ScanCellsPtr cells = new ScanCells;
+          maybe_callback_ok(scanner_id, next, m_outstanding == 1, cells);
+          if (scanner_id == m_current_scanner)
+            move_to_next_interval_scanner(scanner_id);
+          return;
+        }
         break;
       case(Error::RANGESERVER_RANGE_NOT_FOUND):
       case(Error::COMM_NOT_CONNECTED):
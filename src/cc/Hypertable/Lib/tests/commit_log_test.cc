@@ -25,6 +25,7 @@
 
 #include "AsyncComm/Comm.h"
 
+#include "Common/FailureInducer.h"
 #include "Common/Init.h"
 #include "Common/Logger.h"
 #include "Common/System.h"
@@ -55,6 +56,7 @@ namespace {
 
   void test1(DfsBroker::Client *dfs_client);
   void test_link(DfsBroker::Client *dfs_client);
+  void test_pipeline_failure(DfsBroker::Client *dfs_client);
   void write_entries(CommitLog *log, int num_entries, uint64_t *sump,
                      CommitLogBase *link_log);
   void read_entries(DfsBroker::Client *dfs_client, CommitLogReader *log_reader,
@@ -85,6 +87,7 @@ int main(int argc, char **argv) {
 
     //test1(dfs);
     test_link(dfs.get());
+    test_pipeline_failure(dfs.get());
   }
   catch (Exception &e) {
     HT_ERROR_OUT << e << HT_END;
@@ -205,6 +208,83 @@ namespace {
     HT_ASSERT(sum_read == sum_written);
   }
 
+  /**
+   * Fails the sixth pipelined append and checks that the blocks queued
+   * behind it are dropped and that the error is returned by every
+   * subsequent sync() and write() until the pipeline is restarted.  After
+   * the restart, writes succeed again and the log holds exactly the first
+   * five blocks and the blocks written after the restart.
+   */
+  void test_pipeline_failure(DfsBroker::Client *dfs_client) {
+    String fname = "/hypertable/test_log/pipeline";
+    CommitLog *log;
+    CommitLogReaderPtr log_reader_ptr;
+    uint64_t sum_written = 0;
+    uint64_t sum_read = 0;
+    uint32_t payload[101];
+    DynamicBuffer dbuf;
+    FilesystemPtr fs = dfs_client;
+    int error;
+
+    dfs_client->rmdir(fname);
+    dfs_client->mkdirs(fname);
+
+    FailureInducer::instance = new FailureInducer();
+    FailureInducer::instance->parse_option("commit-log-pipeline-append:throw:5");
+
+    log = new CommitLog(fs, fname, properties);
+    log->start_pipeline(2);
+
+    for (size_t i=0; i<20; i++) {
+      uint32_t limit = (random() % 100) + 1;
+      for (size_t j=0; j<limit; j++) {
+        payload[j] = random();
+        if (i < 5)
+          sum_written += payload[j];
+      }
+      dbuf.base = (uint8_t *)payload;
+      dbuf.ptr = dbuf.base + (4*limit);
+      dbuf.own = false;
+      error = log->write(dbuf, log->get_timestamp(), false);
+      HT_ASSERT(error == Error::OK || error == Error::INDUCED_FAILURE);
+    }
+
+    // The error is sticky
+    HT_ASSERT(log->sync() == Error::INDUCED_FAILURE);
+    HT_ASSERT(log->sync() == Error::INDUCED_FAILURE);
+    HT_ASSERT(log->write(dbuf, log->get_timestamp(), false)
+              == Error::INDUCED_FAILURE);
+
+    // Restarting clears the error and continues in a new fragment
+    String failed_fragment = log->get_current_fragment_file();
+    HT_ASSERT(log->restart_pipeline() == Error::OK);
+    HT_ASSERT(log->get_current_fragment_file() != failed_fragment);
+    HT_ASSERT(log->restart_pipeline() == Error::OK);
+
+    for (size_t i=0; i<10; i++) {
+      uint32_t limit = (random() % 100) + 1;
+      for (size_t j=0; j<limit; j++) {
+        payload[j] = random();
+        sum_written += payload[j];
+      }
+      dbuf.base = (uint8_t *)payload;
+      dbuf.ptr = dbuf.base + (4*limit);
+      dbuf.own = false;
+      HT_ASSERT(log->write(dbuf, log->get_timestamp(), i == 9) == Error::OK);
+    }
+    HT_ASSERT(log->sync() == Error::OK);
+    HT_ASSERT(log->close() == Error::OK);
+    delete log;
+
+    delete FailureInducer::instance;
+    FailureInducer::instance = 0;
+
+    log_reader_ptr = new CommitLogReader(fs, fname);
+    read_entries(dfs_client, log_reader_ptr.get(), &sum_read);
+
+    HT_ASSERT(sum_read == sum_written);
+  }
+
   void
   write_entries(CommitLog *log, int num_entries, uint64_t *sump,
                 CommitLogBase *link_log) {
@@ -151,6 +151,51 @@ void test_mapper(NameIdMapper &mapper) {
 
 }
 
+/**
+ * A failing operation aborts the whole batch, including the ATTR_SETs that
+ * precede it
+ */
+void test_batch_abort(Hyperspace::SessionPtr &session, const String &toplevel_dir) {
+  String existing = toplevel_dir + "/batch_existing";
+  String created = toplevel_dir + "/batch_created";
+  uint32_t oflags = OPEN_FLAG_READ|OPEN_FLAG_WRITE|OPEN_FLAG_CREATE;
+  std::vector<Attribute> attrs;
+
+  attrs.push_back(Attribute("a", "1", 1));
+  session->attr_set(existing, oflags, attrs);
+
+  Hyperspace::Batch batch;
+  attrs.clear();
+  attrs.push_back(Attribute("b", "2", 1));
+  batch.attr_set(existing, oflags, attrs);
+  batch.attr_set(created, oflags|OPEN_FLAG_EXCL, attrs);
+  batch.attr_set(created, oflags|OPEN_FLAG_EXCL, attrs);
+  batch.exists(existing);
+  session->execute(batch);
+
+  HT_ASSERT(batch.completed() == 2);
+  HT_ASSERT(batch.get_error() == Error::HYPERSPACE_FILE_EXISTS);
+  HT_ASSERT(!session->attr_exists(existing, "b"));
+  HT_ASSERT(!session->exists(created));
+  HT_ASSERT(session->attr_exists(existing, "a"));
+
+  // The same operations without the failing one are applied
+  Hyperspace::Batch retry;
+  retry.attr_set(existing, oflags, attrs);
+  retry.attr_set(created, oflags|OPEN_FLAG_EXCL, attrs);
+  retry.exists(existing);
+  session->execute(retry);
+
+  HT_ASSERT(retry.completed() == 3);
+  HT_ASSERT(retry.get_error() == Error::OK);
+  HT_ASSERT(retry.get_exists(2));
+  HT_ASSERT(session->attr_exists(existing, "b"));
+  HT_ASSERT(session->attr_exists(created, "b"));
+
+  session->unlink(existing);
+  session->unlink(created);
+}
+
 void cleanup(Hyperspace::SessionPtr &session, const String &toplevel_dir) {
   struct LengthDescending swo;
 
@@ -215,6 +260,7 @@ int main(int argc, char *argv[]) {
 
           init(mapper);
           test_mapper(mapper);
+          test_batch_abort(session, "/ht");
           cleanup(session, "/ht");
         }
 
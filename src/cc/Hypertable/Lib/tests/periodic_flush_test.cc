@@ -32,7 +32,7 @@ using namespace std;
 
 namespace {
 
-void check_results(Table *table) {
+void check_results(Table *table, const char *expected = "value") {
   ScanSpec ss;
   TableScannerPtr scanner = table->create_scanner(ss);
   CellsBuilder cb;
@@ -40,8 +40,8 @@ void check_results(Table *table) {
   copy(scanner, cb);
 
   HT_ASSERT(cb.get().size() == 1);
-  HT_ASSERT(cb.get().front().value_len == 5);
-  HT_ASSERT(memcmp(cb.get().front().value, "value", 5) == 0);
+  HT_ASSERT(cb.get().front().value_len == strlen(expected));
+  HT_ASSERT(memcmp(cb.get().front().value, expected, strlen(expected)) == 0);
 }
 
 void default_test(Table *table)  {
@@ -59,6 +59,20 @@ void no_log_sync_test(Table *table) {
   check_results(table);
 }
 
+/// An idle mutator without a flush interval flushes once the oldest update
+/// is older than the scatter buffer flush latency
+void flush_latency_test(Table *table) {
+  properties->set("Hypertable.Mutator.ScatterBuffer.FlushLatency",
+                  (int32_t)500);
+  TableMutatorPtr mutator = table->create_mutator();
+  properties->set("Hypertable.Mutator.ScatterBuffer.FlushLatency",
+                  (int32_t)0);
+  mutator->set_delete(KeySpec("rowkey", "col", AUTO_ASSIGN, FLAG_DELETE_COLUMN_FAMILY));
+  mutator->set(KeySpec("rowkey", "col", "cq"), "latency");
+  sleep(2);
+  check_results(table, "latency");
+}
+
 } // local namesapce
 
 
@@ -78,6 +92,7 @@ int main(int argc, char *argv[]) {
 
     default_test(table.get());
     no_log_sync_test(table.get());
+    flush_latency_test(table.get());
   }
   catch (Exception &e) {
     HT_ERROR_OUT << e << HT_END;
@@ -83,5 +83,42 @@ int main(int argc, char **argv) {
   HT_ASSERT(fired==true);
   fired=false;
 
+  // not allowed: grouping by an empty row prefix
+  try {
+    ScanSpecBuilder ssb;
+    ssb.set_aggregate(ScanSpec::AGGREGATE_COUNT, ScanSpec::GROUP_BY_ROW_PREFIX);
+  }
+  catch (Exception &e) {
+    if (e.code()!=Error::BAD_SCAN_SPEC) {
+      std::cout << e << std::endl;
+      _exit(1);
+    }
+    fired=true;
+  }
+
+  HT_ASSERT(fired==true);
+  fired=false;
+
+  // aggregate survives serialization and disables the query cache
+  {
+    ScanSpecBuilder ssb;
+    ssb.add_column("a");
+    ssb.set_aggregate(ScanSpec::AGGREGATE_SUM, ScanSpec::GROUP_BY_ROW_PREFIX, 4);
+    HT_ASSERT(!ssb.get().cacheable());
+
+    DynamicBuffer buf(ssb.get().encoded_length());
+    ssb.get().encode(&buf.ptr);
+    HT_ASSERT(buf.fill() == ssb.get().encoded_length());
+
+    ScanSpec decoded;
+    const uint8_t *ptr = buf.base;
+    size_t remaining = buf.fill();
+    decoded.decode(&ptr, &remaining);
+    HT_ASSERT(remaining == 0);
+    HT_ASSERT(decoded.aggregate == ScanSpec::AGGREGATE_SUM);
+    HT_ASSERT(decoded.group_by == ScanSpec::GROUP_BY_ROW_PREFIX);
+    HT_ASSERT(decoded.group_by_prefix_length == 4);
+  }
+
   _exit(0);
 }
@@ -0,0 +1,252 @@
+/* -*- c++ -*-
+ * Copyright (C) 2007-2013 Hypertable, Inc.
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 3 of the
+ * License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+#include "Common/Compat.h"
+#include "Common/ByteString.h"
+#include "Common/DynamicBuffer.h"
+#include "Common/Error.h"
+#include "Common/Logger.h"
+#include "Common/Serialization.h"
+#include "Common/String.h"
+#include "Common/Time.h"
+
+#include "AsyncComm/CommBuf.h"
+#include "AsyncComm/CommHeader.h"
+
+#include "Hypertable/Lib/BlockCompressionHeader.h"
+#include "Hypertable/Lib/CompressorFactory.h"
+#include "Hypertable/Lib/Key.h"
+#include "Hypertable/Lib/RangeServerProtocol.h"
+#include "Hypertable/Lib/TableMutatorAsyncScatterBuffer.h"
+
+#include <cstdlib>
+#include <cstring>
+
+using namespace Hypertable;
+
+namespace {
+
+  const char *CODECS[] = { "zlib", "lzo", "quicklz", "snappy", "bmz", 0 };
+
+  /// Builds a per-server update payload the way the scatter buffer does
+  void make_updates(DynamicBuffer &accum, uint32_t count) {
+    accum.clear();
+    for (uint32_t i=0; i<count; i++) {
+      String row = format("com.example.www/page/%06u", i / 4);
+      String qualifier = format("q%u", i % 4);
+      String value = format("value of cell %u, mostly repetitive text", i);
+      create_key_and_append(accum, FLAG_INSERT, row.c_str(), 1 + (i % 3),
+                            qualifier.c_str(), 1000000 + i);
+      append_as_byte_string(accum, value.c_str(), value.length());
+    }
+  }
+
+  /** Decodes an "update" request the way RequestHandlerUpdate::run does and
+   * returns the key/value pairs it carries in <code>mods</code>.
+   */
+  void decode_update(CommBuf *cbuf, TableIdentifier &table, uint32_t *countp,
+                     uint32_t *flagsp, StaticBuffer &mods,
+                     DynamicBuffer &message) {
+    CommHeader header;
+    const uint8_t *ptr;
+    size_t remain;
+
+    // Reassemble the message as it arrives at the RangeServer
+    cbuf->write_header_and_reset();
+    message.clear();
+    message.add(cbuf->data.base, cbuf->data.size);
+    message.add(cbuf->ext.base, cbuf->ext.size);
+    ptr = message.base;
+    remain = message.fill();
+    header.decode(&ptr, &remain);
+    HT_ASSERT(header.command == RangeServerProtocol::COMMAND_UPDATE);
+    HT_ASSERT(header.total_len == message.fill());
+
+    table.decode(&ptr, &remain);
+    *countp = Serialization::decode_i32(&ptr, &remain);
+    *flagsp = Serialization::decode_i32(&ptr, &remain);
+    if (*flagsp & RangeServerProtocol::UPDATE_FLAG_COMPRESSED) {
+      RangeServerProtocol::decompress_updates(ptr, remain, mods);
+      *flagsp &= ~RangeServerProtocol::UPDATE_FLAG_COMPRESSED;
+    }
+    else {
+      mods.base = (uint8_t *)ptr;
+      mods.size = remain;
+      mods.own = false;
+    }
+  }
+
+  void round_trip(const char *codec_name, DynamicBuffer &accum,
+                  uint32_t count) {
+    BlockCompressionCodecPtr codec(
+        CompressorFactory::create_block_codec(codec_name));
+    StaticBuffer updates(accum.base, accum.fill(), false);
+    StaticBuffer compressed;
+
+    HT_ASSERT(RangeServerProtocol::compress_updates(codec.get(), updates,
+                                                    compressed));
+    HT_ASSERT(compressed.size < updates.size);
+    HT_ASSERT(compressed.own);
+
+    TableIdentifier table("3");
+    uint32_t flags = RangeServerProtocol::UPDATE_FLAG_NO_LOG_SYNC |
+      RangeServerProtocol::UPDATE_FLAG_COMPRESSED;
+    CommBufPtr cbuf(RangeServerProtocol::create_request_update(table, count,
+                                                               compressed,
+                                                               flags));
+
+    TableIdentifier decoded_table;
+    uint32_t decoded_count, decoded_flags;
+    StaticBuffer mods;
+    DynamicBuffer message(0);
+    decode_update(cbuf.get(), decoded_table, &decoded_count, &decoded_flags,
+                  mods, message);
+
+    HT_ASSERT(!strcmp(decoded_table.id, "3"));
+    HT_ASSERT(decoded_count == count);
+    HT_ASSERT(decoded_flags == RangeServerProtocol::UPDATE_FLAG_NO_LOG_SYNC);
+    HT_ASSERT(mods.own);
+    HT_ASSERT(mods.size == accum.fill());
+    HT_ASSERT(!memcmp(mods.base, accum.base, accum.fill()));
+  }
+
+}
+
+
+int main(int argc, char **argv) {
+
+  try {
+    DynamicBuffer accum(0);
+    uint32_t count = 5000;
+    make_updates(accum, count);
+
+    // Compressed updates reach the RangeServer unchanged, with the
+    // compression flag cleared and the other flags intact
+    for (size_t i=0; CODECS[i]; i++)
+      round_trip(CODECS[i], accum, count);
+
+    // Uncompressed updates are passed through in place
+    {
+      StaticBuffer updates(accum.base, accum.fill(), false);
+      TableIdentifier table("3");
+      CommBufPtr cbuf(RangeServerProtocol::create_request_update(table, count,
+                                                                 updates, 0));
+      TableIdentifier decoded_table;
+      uint32_t decoded_count, decoded_flags;
+      StaticBuffer mods;
+      DynamicBuffer message(0);
+      decode_update(cbuf.get(), decoded_table, &decoded_count,
+                    &decoded_flags, mods, message);
+      HT_ASSERT(decoded_flags == 0);
+      HT_ASSERT(!mods.own);
+      HT_ASSERT(mods.size == accum.fill());
+      HT_ASSERT(!memcmp(mods.base, accum.base, accum.fill()));
+    }
+
+    // An incompressible payload is left for sending as is
+    {
+      BlockCompressionCodecPtr codec(
+          CompressorFactory::create_block_codec("zlib"));
+      DynamicBuffer noise(0);
+      srandom(1);
+      for (size_t i=0; i<65536; i++) {
+        uint8_t byte = (uint8_t)random();
+        noise.add(&byte, 1);
+      }
+      StaticBuffer updates(noise.base, noise.fill(), false);
+      StaticBuffer compressed;
+      HT_ASSERT(!RangeServerProtocol::compress_updates(codec.get(), updates,
+                                                       compressed));
+      HT_ASSERT(compressed.base == 0);
+    }
+
+    // A block that isn't an update block is rejected
+    {
+      const char MAGIC[11] = "Data------";
+      BlockCompressionCodecPtr codec(
+          CompressorFactory::create_block_codec("zlib"));
+      BlockCompressionHeader header(MAGIC);
+      DynamicBuffer zbuf;
+      codec->deflate(accum, zbuf, header);
+      StaticBuffer mods;
+      bool rejected = false;
+      try {
+        RangeServerProtocol::decompress_updates(zbuf.base, zbuf.fill(), mods);
+      }
+      catch (Exception &e) {
+        HT_ASSERT(e.code() == Error::BLOCK_COMPRESSOR_BAD_MAGIC);
+        rejected = true;
+      }
+      HT_ASSERT(rejected);
+    }
+
+    // A corrupted update block is rejected
+    {
+      BlockCompressionCodecPtr codec(
+          CompressorFactory::create_block_codec("zlib"));
+      StaticBuffer updates(accum.base, accum.fill(), false);
+      StaticBuffer compressed;
+      HT_ASSERT(RangeServerProtocol::compress_updates(codec.get(), updates,
+                                                      compressed));
+      compressed.base[compressed.size - 10] ^= 0x55;
+      StaticBuffer mods;
+      bool rejected = false;
+      try {
+        RangeServerProtocol::decompress_updates(compressed.base,
+                                                compressed.size, mods);
+      }
+      catch (Exception &e) {
+        rejected = true;
+      }
+      HT_ASSERT(rejected);
+    }
+
+    // Flush by age: only buffered updates at least FlushLatency
+    // milliseconds old make the scatter buffer full
+    {
+      HiResTime first_update;
+      HiResTime now = first_update;
+      HT_ASSERT(!TableMutatorAsyncScatterBuffer::flush_latency_reached(
+                    100, 1024, first_update, now));
+      now += 99;
+      HT_ASSERT(!TableMutatorAsyncScatterBuffer::flush_latency_reached(
+                    100, 1024, first_update, now));
+      now += 1;
+      HT_ASSERT(TableMutatorAsyncScatterBuffer::flush_latency_reached(
+                    100, 1024, first_update, now));
+      now += 5000;
+      HT_ASSERT(TableMutatorAsyncScatterBuffer::flush_latency_reached(
+                    100, 1024, first_update, now));
+      // Nothing buffered
+      HT_ASSERT(!TableMutatorAsyncScatterBuffer::flush_latency_reached(
+                    100, 0, first_update, now));
+      // FlushLatency of 0 disables the check
+      HT_ASSERT(!TableMutatorAsyncScatterBuffer::flush_latency_reached(
+                    0, 1024, first_update, now));
+    }
+  }
+  catch (Exception &e) {
+    HT_ERROR_OUT << e << HT_END;
+    return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,162 @@
+/* -*- c++ -*-
+ * Copyright (C) 2007-2013 Hypertable, Inc.
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 3 of the
+ * License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+#include "Common/Compat.h"
+#include "Common/DynamicBuffer.h"
+#include "Common/Error.h"
+#include "Common/Logger.h"
+#include "Common/String.h"
+
+#include "Hypertable/Lib/BlockCompressionCodecZstd.h"
+#include "Hypertable/Lib/BlockCompressionHeaderCommitLog.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+using namespace Hypertable;
+
+namespace {
+
+  const char MAGIC[12] = { '-','-','-','-','-','-','-','-','-','-','-','-' };
+
+  /** Builds a block of key/value records sharing most of their bytes, the
+   * way cells of one access group do.
+   */
+  void make_block(DynamicBuffer &block, int seed, int records) {
+    block.clear();
+    for (int i=0; i<records; i++) {
+      String record = format("com.example.www/products/item-%06d\tcolumn:"
+                             "description\t%d\tA widget of the ordinary "
+                             "kind, shipped in a brown box.\n",
+                             seed * records + i, (seed * 7 + i) % 13);
+      block.add(record.c_str(), record.length());
+    }
+  }
+
+  size_t compress(BlockCompressionCodecZstd &codec, DynamicBuffer &input,
+                  DynamicBuffer &output) {
+    BlockCompressionHeaderCommitLog header(MAGIC, 0);
+    codec.deflate(input, output, header);
+    return output.fill();
+  }
+
+  void check_inflate(BlockCompressionCodecZstd &codec, DynamicBuffer &input,
+                     DynamicBuffer &compressed) {
+    BlockCompressionHeaderCommitLog header;
+    DynamicBuffer output(0);
+    codec.inflate(compressed, output, header);
+    HT_ASSERT(output.fill() == input.fill());
+    HT_ASSERT(memcmp(output.base, input.base, input.fill()) == 0);
+  }
+
+}
+
+
+int main(int argc, char **argv) {
+
+  try {
+    BlockCompressionCodec::Args args;
+    args.push_back("--dictionary-size");
+    args.push_back("4096");
+
+    DynamicBuffer samples(0);
+    std::vector<size_t> sample_sizes;
+    DynamicBuffer block(0);
+    for (int i=0; i<64; i++) {
+      make_block(block, i, 4);
+      samples.add(block.base, block.fill());
+      sample_sizes.push_back(block.fill());
+    }
+
+    // Training needs a non-zero dictionary size and at least one sample
+    {
+      BlockCompressionCodec::Args no_dict_args;
+      no_dict_args.push_back("--dictionary-size");
+      no_dict_args.push_back("0");
+      BlockCompressionCodecZstd no_dict(no_dict_args);
+      DynamicBuffer dictionary(0);
+      HT_ASSERT(no_dict.get_dictionary_size() == 0);
+      HT_ASSERT(!no_dict.train_dictionary(samples, sample_sizes, dictionary));
+      BlockCompressionCodecZstd codec(args);
+      std::vector<size_t> no_samples;
+      HT_ASSERT(!codec.train_dictionary(samples, no_samples, dictionary));
+    }
+
+    BlockCompressionCodecZstd trainer(args);
+    HT_ASSERT(trainer.get_dictionary_size() == 4096);
+    DynamicBuffer dictionary_buf(0);
+    HT_ASSERT(trainer.train_dictionary(samples, sample_sizes, dictionary_buf));
+    HT_ASSERT(dictionary_buf.fill() > 0 && dictionary_buf.fill() <= 4096);
+
+    BlockCompressionDictionaryPtr dictionary =
+      new BlockCompressionDictionary(dictionary_buf.base,
+                                     dictionary_buf.fill());
+
+    // A small block not among the samples compresses better with the
+    // dictionary than without it
+    DynamicBuffer input(0);
+    make_block(input, 1000, 4);
+
+    BlockCompressionCodecZstd plain(args);
+    DynamicBuffer plain_output(0);
+    size_t plain_len = compress(plain, input, plain_output);
+    check_inflate(plain, input, plain_output);
+
+    BlockCompressionCodecZstd writer(args);
+    writer.set_dictionary(dictionary);
+    DynamicBuffer dict_output(0);
+    size_t dict_len = compress(writer, input, dict_output);
+    HT_ASSERT(dict_len < plain_len);
+
+    // A second codec sharing the dictionary object inflates the block
+    BlockCompressionCodecZstd reader(args);
+    reader.set_dictionary(dictionary);
+    check_inflate(reader, input, dict_output);
+
+    // The dictionary is prepared once and shared by both codecs
+    HT_ASSERT(dictionary->prepared);
+
+    // Without the dictionary the block can not be inflated
+    bool failed = false;
+    try {
+      check_inflate(plain, input, dict_output);
+    }
+    catch (Exception &e) {
+      HT_ASSERT(e.code() == Error::BLOCK_COMPRESSOR_INFLATE_ERROR);
+      failed = true;
+    }
+    HT_ASSERT(failed);
+
+    // Swapping in a different dictionary drops the prepared one
+    BlockCompressionDictionaryPtr empty_dictionary;
+    writer.set_dictionary(empty_dictionary);
+    DynamicBuffer output(0);
+    compress(writer, input, output);
+    check_inflate(plain, input, output);
+  }
+  catch (Exception &e) {
+    HT_ERROR_OUT << e << HT_END;
+    return 1;
+  }
+
+  return 0;
+}
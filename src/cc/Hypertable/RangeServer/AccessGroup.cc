@@ -34,11 +34,18 @@
 #include <Hypertable/RangeServer/MetadataNormal.h>
 #include <Hypertable/RangeServer/MetadataRoot.h>
 
+#include <Hypertable/Lib/ScanSpec.h>
+
 #include <Common/DynamicBuffer.h>
 #include <Common/Error.h>
 #include <Common/FailureInducer.h>
+#include <Common/ReferenceCount.h>
+#include <Common/Thread.h>
 #include <Common/md5.h>
 
+#include <boost/algorithm/string/join.hpp>
+#include <boost/bind.hpp>
+
 #include <algorithm>
 #include <cstdlib>
 #include <cstring>
@@ -47,6 +54,35 @@
 
 using namespace Hypertable;
 
+namespace {
+
+  /** Creates the merge policy named by a table's schema, falling back to
+   * <code>Hypertable.RangeServer.Compaction.Policy</code> when the table
+   * does not name one.
+   */
+  CompactionPolicy *create_compaction_policy(const String &spec) {
+    String name = spec.empty() ?
+      Config::get_str("Hypertable.RangeServer.Compaction.Policy") : spec;
+    if (!strcasecmp(name.c_str(), "tiered"))
+      return new CompactionPolicyTiered(Global::cellstore_target_size_min,
+          Config::get_f64("Hypertable.RangeServer.Compaction.Tiered.SizeRatio"),
+          Config::get_i32("Hypertable.RangeServer.Compaction.Tiered.MinRunLength"),
+          Config::get_f64("Hypertable.RangeServer.Compaction.Tiered.MaxWriteAmplification"));
+    else if (!strcasecmp(name.c_str(), "leveled"))
+      return new CompactionPolicyLeveled(Global::cellstore_target_size_min,
+          Config::get_i32("Hypertable.RangeServer.Compaction.Leveled.Fanout"),
+          Global::merge_cellstore_run_length_threshold,
+          Config::get_f64("Hypertable.RangeServer.Compaction.Leveled.MaxWriteAmplification"));
+    else if (strcasecmp(name.c_str(), "default"))
+      HT_WARNF("Unrecognized compaction policy '%s', using default",
+               name.c_str());
+    return new CompactionPolicyDefault(Global::cellstore_target_size_min,
+                                       Global::cellstore_target_size_max,
+                                       Global::merge_cellstore_run_length_threshold);
+  }
+
+}
+
 AccessGroup::AccessGroup(const TableIdentifier *identifier,
                          SchemaPtr &schema, Schema::AccessGroup *ag,
                          const RangeSpec *range, const Hints *hints)
@@ -56,7 +92,8 @@ AccessGroup::AccessGroup(const TableIdentifier *identifier,
     m_earliest_cached_revision_saved(TIMESTAMP_MAX),
     m_latest_stored_revision(TIMESTAMP_MIN),
     m_latest_stored_revision_hint(TIMESTAMP_MIN),
-    m_file_tracker(identifier, schema, range, ag->name), m_is_root(false),
+    m_file_tracker(identifier, schema, range, ag->name),
+    m_bytes_flushed(0), m_bytes_written(0), m_is_root(false),
     m_recovering(false), m_needs_merging(false), m_end_merge(false),
     m_dirty(false), m_cellcache_needs_compaction(false) {
 
@@ -66,7 +103,12 @@ AccessGroup::AccessGroup(const TableIdentifier *identifier,
   m_range_name = m_table_name + "[" + m_start_row + ".." + m_end_row + "]";
   m_full_name = m_range_name + "(" + m_name + ")";
 
-  m_cell_cache_manager = new CellCacheManager();
+  {
+    String cell_cache_type = ag->cell_cache.size() ? ag->cell_cache :
+      Config::get_str("Hypertable.RangeServer.AccessGroup.CellCache.Type");
+    m_cell_cache_manager =
+      new CellCacheManager(!strcasecmp(cell_cache_type.c_str(), "skiplist"));
+  }
 
   range_dir_initialize();
 
@@ -75,6 +117,8 @@ AccessGroup::AccessGroup(const TableIdentifier *identifier,
 
   m_garbage_tracker.set_schema(schema, ag);
 
+  m_compaction_policy = create_compaction_policy(schema->get_compaction_policy());
+
   m_is_root = (m_identifier.is_metadata() && *range->start_row == 0
                && !strcmp(range->end_row, Key::END_ROOT_ROW));
   m_in_memory = ag->in_memory;
@@ -140,6 +184,7 @@ void AccessGroup::update_schema(SchemaPtr &schema,
     // Update schema ptr
     ScopedLock lock(m_mutex);
     m_schema = schema;
+    m_compaction_policy = create_compaction_policy(schema->get_compaction_policy());
   }
 }
 
@@ -415,6 +460,11 @@ AccessGroup::get_maintenance_data(ByteArena &arena, time_t now, int flags) {
     mdata->shadow_cache_memory += (*tailp)->shadow_cache_size;
   }
   mdata->file_count = m_stores.size();
+  std::vector<bool> continues;
+  get_logical_stores(continues);
+  mdata->read_amplification = CompactionPolicy::logical_store_count(continues) +
+    (m_cell_cache_manager->empty() ? 0 : 1);
+  mdata->write_amplification = write_amplification();
 
   mdata->gc_needed = m_garbage_tracker.check_needed(mdata->deletes, mdata->mem_used, now);
   mdata->needs_merging = m_needs_merging;
@@ -452,6 +502,85 @@ void AccessGroup::load_cellstore(CellStorePtr &cellstore) {
   m_file_tracker.add_live_noupdate(cellstore->get_filename(), total_index_entries);
 }
 
+int64_t AccessGroup::check_attachable(const String &fname) {
+
+  if (m_in_memory)
+    HT_THROWF(Error::NOT_IMPLEMENTED, "Unable to attach '%s' to in-memory "
+              "access group %s", fname.c_str(), m_full_name.c_str());
+
+  CellStorePtr cellstore = CellStoreFactory::open(fname, m_start_row.c_str(),
+                                                  m_end_row.c_str());
+  int64_t revision = boost::any_cast<int64_t>
+    (cellstore->get_trailer()->get("revision"));
+
+  if (revision > get_ts64())
+    HT_THROWF(Error::RANGESERVER_CLOCK_SKEW, "Revision %lld of '%s' is in "
+              "the future", (Lld)revision, fname.c_str());
+
+  return revision;
+}
+
+String AccessGroup::reserve_attach(const String &fname, int64_t revision) {
+  ScopedLock lock(m_mutex);
+  /** The commit log is replayed from m_latest_stored_revision, so the
+   * attached store must not claim a revision at or beyond data that is
+   * still only in the cell cache. */
+  if (revision >= m_earliest_cached_revision)
+    HT_THROWF(Error::RANGESERVER_REVISION_ORDER_ERROR, "Revision %lld of "
+              "'%s' is not older than cached data of %s (%lld), compact "
+              "the range first", (Lld)revision, fname.c_str(),
+              m_full_name.c_str(), (Lld)m_earliest_cached_revision);
+  return format("%s/tables/%s/%s/%s/cs%d", Global::toplevel_dir.c_str(),
+                m_identifier.id, m_name.c_str(), m_range_dir.c_str(),
+                m_next_cs_id++);
+}
+
+void AccessGroup::attach_cellstore(const String &fname, const String &cs_file) {
+  std::vector<String> added_files, removed_files;
+  int64_t total_index_entries = 0;
+
+  {
+    ScopedLock lock(m_mutex);
+    foreach_ht (CellStoreInfo &csinfo, m_stores) {
+      if (csinfo.cs->get_filename() == cs_file)
+        return;
+    }
+  }
+
+  // When finishing an attach interrupted by a crash, the file may have
+  // been moved already
+  if (Global::dfs->exists(fname))
+    Global::dfs->rename(fname, cs_file);
+  CellStorePtr cellstore = CellStoreFactory::open(cs_file, m_start_row.c_str(),
+                                                  m_end_row.c_str());
+  int64_t revision = boost::any_cast<int64_t>
+    (cellstore->get_trailer()->get("revision"));
+
+  {
+    ScopedLock lock(m_mutex);
+    uint32_t id = atoi(cs_file.c_str() + cs_file.rfind('/') + 3);
+    if (id >= m_next_cs_id)
+      m_next_cs_id = id+1;
+    if (revision > m_latest_stored_revision)
+      m_latest_stored_revision = revision;
+    m_stores.push_back(cellstore);
+    m_garbage_tracker.accumulate_expirable( m_stores.back().expirable_data );
+    m_bytes_flushed += cellstore->disk_usage();
+    m_bytes_written += cellstore->disk_usage();
+    sort_cellstores_by_timestamp();
+    get_merge_info(m_needs_merging, m_end_merge);
+    recompute_compression_ratio(&total_index_entries);
+  }
+
+  added_files.push_back(cs_file);
+  m_file_tracker.update_live(added_files, removed_files, m_next_cs_id,
+                             total_index_entries);
+  m_file_tracker.update_files_column();
+
+  HT_INFOF("Attached %s to %s (revision=%lld)", cs_file.c_str(),
+           m_full_name.c_str(), (Lld)revision);
+}
+
 void AccessGroup::compute_garbage_stats(uint64_t *input_bytesp,
                                         uint64_t *output_bytesp) {
   ScanContextPtr scan_context = new ScanContext(m_schema);
@@ -482,13 +611,119 @@ void AccessGroup::compute_garbage_stats(uint64_t *input_bytesp,
 
 
 
+namespace {
+
+  /** One key-range partition of a compaction.  A compaction is carried out
+   * as a single partition covering the whole access group unless it is a
+   * major compaction large enough to be split into subcompactions, in which
+   * case each partition covers a disjoint row interval and is merged and
+   * written to its own cell store.
+   */
+  class CompactionPartition : public ReferenceCount {
+  public:
+    CompactionPartition()
+      : mscanner(0), max_entries(0), trailer_flags(0), error(Error::OK) { }
+    String cs_file;
+    ScanSpecBuilder scan_spec;
+    ScanContextPtr scan_context;
+    MergeScanner *mscanner;
+    CellListScannerPtr scanner;
+    CellStorePtr cellstore;
+    int64_t max_entries;
+    uint32_t trailer_flags;
+    int error;
+    String error_msg;
+  };
+  typedef intrusive_ptr<CompactionPartition> CompactionPartitionPtr;
+
+  /** Merges a partition's scanner into its cell store.  If
+   * <code>filtered_cache</code> is non-null, the cells written are also
+   * added to it (in-memory access groups).
+   */
+  void write_partition(CompactionPartition *partition, PropertiesPtr &props,
+                       TableIdentifier *identifier, CellCache *filtered_cache) {
+    Key key;
+    ByteString value;
+
+    partition->cellstore->create(partition->cs_file.c_str(),
+                                 partition->max_entries, props, identifier);
+
+    while (partition->scanner->get(key, value)) {
+      partition->cellstore->add(key, value);
+      if (filtered_cache)
+        filtered_cache->add(key, value);
+      partition->scanner->forward();
+    }
+
+    CellStoreTrailerV6 *trailer =
+      dynamic_cast<CellStoreTrailerV6 *>(partition->cellstore->get_trailer());
+    trailer->flags |= partition->trailer_flags;
+
+    partition->cellstore->finalize(identifier);
+  }
+
+  /** Shared state for threads writing the partitions of a subcompaction.
+   * Each thread repeatedly takes the next unwritten partition until there
+   * are none left.
+   */
+  struct SubcompactionState {
+    SubcompactionState(std::vector<CompactionPartitionPtr> &p,
+                       PropertiesPtr &pr, TableIdentifier *id)
+      : partitions(p), props(pr), identifier(id), next(0) { }
+    std::vector<CompactionPartitionPtr> &partitions;
+    PropertiesPtr &props;
+    TableIdentifier *identifier;
+    Mutex mutex;
+    size_t next;
+  };
+
+  void subcompaction_worker(SubcompactionState *state) {
+    CompactionPartition *partition;
+    while (true) {
+      {
+        ScopedLock lock(state->mutex);
+        if (state->next == state->partitions.size())
+          break;
+        partition = state->partitions[state->next++].get();
+      }
+      try {
+        write_partition(partition, state->props, state->identifier, 0);
+      }
+      catch (Exception &e) {
+        partition->error = e.code();
+        partition->error_msg = e.what();
+      }
+    }
+  }
+
+  /// Protects #subcompaction_helpers
+  Mutex subcompaction_mutex;
+
+  /// Number of helper threads currently running subcompactions server-wide
+  int32_t subcompaction_helpers = 0;
+
+  /** Reserves up to <code>wanted</code> helper threads from the
+   * server-wide subcompaction budget, which is one less than
+   * Global::subcompaction_threads since each compaction also writes
+   * partitions on its own maintenance thread.
+   */
+  int32_t acquire_subcompaction_helpers(int32_t wanted) {
+    ScopedLock lock(subcompaction_mutex);
+    int32_t available = (Global::subcompaction_threads - 1) - subcompaction_helpers;
+    int32_t granted = std::max(std::min(wanted, available), (int32_t)0);
+    subcompaction_helpers += granted;
+    return granted;
+  }
+
+  void release_subcompaction_helpers(int32_t count) {
+    ScopedLock lock(subcompaction_mutex);
+    subcompaction_helpers -= count;
+  }
+
+}
+
+
 void AccessGroup::run_compaction(int maintenance_flags, Hints *hints) {
-  ByteString bskey;
-  ByteString value;
-  Key key;
-  CellListScannerPtr scanner;
-  MergeScanner *mscanner = 0;
-  CellStorePtr cellstore;
   CellCachePtr filtered_cache, shadow_cache;
   String metadata_key_str;
   bool abort_loop = true;
@@ -499,7 +734,8 @@ void AccessGroup::run_compaction(int maintenance_flags, Hints *hints) {
   bool garbage_check_performed = false;
   bool cellstore_created = false;
   size_t merge_offset=0, merge_length=0;
-  String added_file;
+  std::vector<String> added_files;
+  std::vector<CompactionPartitionPtr> partitions;
 
   hints->ag_name = m_name;
   m_file_tracker.get_file_list(hints->files);
@@ -555,21 +791,10 @@ void AccessGroup::run_compaction(int maintenance_flags, Hints *hints) {
     return;
   }
 
-  String cs_file;
-
   try {
 
-    int64_t max_num_entries = 0;
-
     {
       ScopedLock lock(m_mutex);
-      ScanContextPtr scan_context = new ScanContext(m_schema);
-
-      cs_file = format("%s/tables/%s/%s/%s/cs%d",
-                       Global::toplevel_dir.c_str(),
-                       m_identifier.id, m_name.c_str(),
-                       m_range_dir.c_str(),
-                       m_next_cs_id++);
 
       /**
        * Check for garbage and if threshold reached, change minor to major
@@ -598,79 +823,124 @@ void AccessGroup::run_compaction(int maintenance_flags, Hints *hints) {
         }
       }
 
-      cellstore = new CellStoreV6(Global::dfs.get(), m_schema.get());
+      std::vector<String> split_rows;
+      if (major && !m_in_memory)
+        get_subcompaction_split_rows(split_rows);
 
-      max_num_entries = m_cell_cache_manager->immutable_items();
+      if (!split_rows.empty())
+        HT_INFOF("Splitting compaction of %s into %d subcompactions",
+                 m_full_name.c_str(), (int)split_rows.size()+1);
 
-      if (m_in_memory) {
-        mscanner = new MergeScannerAccessGroup(m_table_name, scan_context,
-                                               MergeScanner::IS_COMPACTION |
-                                             MergeScanner::ACCUMULATE_COUNTERS);
-        scanner = mscanner;
-        m_cell_cache_manager->add_immutable_scanner(mscanner, scan_context);
-        filtered_cache = new CellCache();
-      }
-      else if (merging) {
-        mscanner = new MergeScannerAccessGroup(m_table_name, scan_context,
-                                               MergeScanner::IS_COMPACTION |
-                                               MergeScanner::RETURN_DELETES);
-        scanner = mscanner;
-        // If we're merging up to the end of the vector of stores, add in the cell cache
-        if (m_end_merge) {
-          HT_ASSERT((merge_offset + merge_length) == m_stores.size());
-          m_cell_cache_manager->add_immutable_scanner(mscanner, scan_context);
+      for (size_t i=0; i<=split_rows.size(); i++) {
+        CompactionPartitionPtr partition = new CompactionPartition();
+        ScanContextPtr &scan_context = partition->scan_context;
+        int64_t max_num_entries = 0;
+
+        partition->cs_file = format("%s/tables/%s/%s/%s/cs%d",
+                                    Global::toplevel_dir.c_str(),
+                                    m_identifier.id, m_name.c_str(),
+                                    m_range_dir.c_str(),
+                                    m_next_cs_id++);
+        partitions.push_back(partition);
+
+        if (split_rows.empty())
+          scan_context = new ScanContext(m_schema);
+        else {
+          // Partitions are (split_rows[i-1], split_rows[i]], open at the ends
+          partition->scan_spec.add_row_interval(i == 0 ? "" : split_rows[i-1].c_str(), false,
+                                                i == split_rows.size() ? "" : split_rows[i].c_str(), true);
+          scan_context = new ScanContext(TIMESTAMP_MAX, &partition->scan_spec.get(),
+                                         0, m_schema);
         }
-        else
-          max_num_entries = 0;
-        for (size_t i=merge_offset; i<merge_offset+merge_length; i++) {
-          HT_ASSERT(m_stores[i].cs);
-          mscanner->add_scanner(m_stores[i].cs->create_scanner(scan_context));
-          int divisor = (boost::any_cast<uint32_t>(m_stores[i].cs->get_trailer()->get("flags")) & CellStoreTrailerV6::SPLIT) ? 2: 1;
-          max_num_entries += (boost::any_cast<int64_t>
-              (m_stores[i].cs->get_trailer()->get("total_entries")))/divisor;
+
+        partition->cellstore = new CellStoreV6(Global::dfs.get(), m_schema.get());
+
+        max_num_entries = m_cell_cache_manager->immutable_items();
+
+        if (m_in_memory) {
+          partition->mscanner = new MergeScannerAccessGroup(m_table_name, scan_context,
+                                                 MergeScanner::IS_COMPACTION |
+                                               MergeScanner::ACCUMULATE_COUNTERS);
+          partition->scanner = partition->mscanner;
+          m_cell_cache_manager->add_immutable_scanner(partition->mscanner, scan_context);
+          filtered_cache = m_cell_cache_manager->create_cell_cache();
         }
-      }
-      else if (major) {
-        mscanner = new MergeScannerAccessGroup(m_table_name, scan_context, 
-                                               MergeScanner::IS_COMPACTION |
-                                             MergeScanner::ACCUMULATE_COUNTERS);
-        scanner = mscanner;
-        m_cell_cache_manager->add_immutable_scanner(mscanner, scan_context);
-        for (size_t i=0; i<m_stores.size(); i++) {
-          HT_ASSERT(m_stores[i].cs);
-          mscanner->add_scanner(m_stores[i].cs->create_scanner(scan_context));
-          int divisor = (boost::any_cast<uint32_t>(m_stores[i].cs->get_trailer()->get("flags")) & CellStoreTrailerV6::SPLIT) ? 2: 1;
-          max_num_entries += (boost::any_cast<int64_t>
-              (m_stores[i].cs->get_trailer()->get("total_entries")))/divisor;
+        else if (merging) {
+          partition->mscanner = new MergeScannerAccessGroup(m_table_name, scan_context,
+                                                 MergeScanner::IS_COMPACTION |
+                                                 MergeScanner::RETURN_DELETES);
+          partition->scanner = partition->mscanner;
+          // If we're merging up to the end of the vector of stores, add in the cell cache
+          if (m_end_merge) {
+            HT_ASSERT((merge_offset + merge_length) == m_stores.size());
+            m_cell_cache_manager->add_immutable_scanner(partition->mscanner, scan_context);
+          }
+          else
+            max_num_entries = 0;
+          for (size_t i=merge_offset; i<merge_offset+merge_length; i++) {
+            HT_ASSERT(m_stores[i].cs);
+            partition->mscanner->add_scanner(m_stores[i].cs->create_scanner(scan_context));
+            int divisor = (boost::any_cast<uint32_t>(m_stores[i].cs->get_trailer()->get("flags")) & CellStoreTrailerV6::SPLIT) ? 2: 1;
+            max_num_entries += (boost::any_cast<int64_t>
+                (m_stores[i].cs->get_trailer()->get("total_entries")))/divisor;
+          }
+        }
+        else if (major) {
+          partition->mscanner = new MergeScannerAccessGroup(m_table_name, scan_context, 
+                                                 MergeScanner::IS_COMPACTION |
+                                               MergeScanner::ACCUMULATE_COUNTERS);
+          partition->scanner = partition->mscanner;
+          m_cell_cache_manager->add_immutable_scanner(partition->mscanner, scan_context);
+          for (size_t i=0; i<m_stores.size(); i++) {
+            HT_ASSERT(m_stores[i].cs);
+            partition->mscanner->add_scanner(m_stores[i].cs->create_scanner(scan_context));
+            int divisor = (boost::any_cast<uint32_t>(m_stores[i].cs->get_trailer()->get("flags")) & CellStoreTrailerV6::SPLIT) ? 2: 1;
+            max_num_entries += (boost::any_cast<int64_t>
+                (m_stores[i].cs->get_trailer()->get("total_entries")))/divisor;
+          }
+        }
+        else {
+          partition->scanner = m_cell_cache_manager->create_immutable_scanner(scan_context);
+          HT_ASSERT(partition->scanner);
         }
-      }
-      else {
-        scanner = m_cell_cache_manager->create_immutable_scanner(scan_context);
-        HT_ASSERT(scanner);
-      }
-    }
-
-    cellstore->create(cs_file.c_str(), max_num_entries, m_cellstore_props, &m_identifier);
 
-    while (scanner->get(key, value)) {
-      cellstore->add(key, value);
-      if (m_in_memory)
-        filtered_cache->add(key, value);
-      scanner->forward();
-    }
+        partition->max_entries = max_num_entries / (split_rows.size() + 1);
 
-    CellStoreTrailerV6 *trailer = dynamic_cast<CellStoreTrailerV6 *>(cellstore->get_trailer());
+        if (major)
+          partition->trailer_flags |= CellStoreTrailerV6::MAJOR_COMPACTION;
 
-    if (major)
-      HT_ASSERT(mscanner);
+        if (maintenance_flags & MaintenanceFlag::SPLIT)
+          partition->trailer_flags |= CellStoreTrailerV6::SPLIT;
 
-    if (major)
-      trailer->flags |= CellStoreTrailerV6::MAJOR_COMPACTION;
+        // Mark the partitions after the first so that the stores written
+        // by this compaction are seen as a single store from now on
+        if (i > 0)
+          partition->trailer_flags |= CellStoreTrailerV6::SUBCOMPACTION_CONTINUATION;
+      }
+    }
 
-    if (maintenance_flags & MaintenanceFlag::SPLIT)
-      trailer->flags |= CellStoreTrailerV6::SPLIT;
+    if (partitions.size() == 1)
+      write_partition(partitions[0].get(), m_cellstore_props, &m_identifier,
+                      filtered_cache.get());
+    else {
+      SubcompactionState state(partitions, m_cellstore_props, &m_identifier);
+      int32_t helpers = acquire_subcompaction_helpers(partitions.size() - 1);
+      ThreadGroup threads;
+      for (int32_t i=0; i<helpers; i++)
+        threads.create_thread(boost::bind(subcompaction_worker, &state));
+      subcompaction_worker(&state);
+      threads.join_all();
+      release_subcompaction_helpers(helpers);
+      foreach_ht (CompactionPartitionPtr &partition, partitions) {
+        if (partition->error != Error::OK)
+          HT_THROW(partition->error, partition->error_msg);
+      }
+    }
 
-    cellstore->finalize(&m_identifier);
+    if (major) {
+      foreach_ht (CompactionPartitionPtr &partition, partitions)
+        HT_ASSERT(partition->mscanner);
+    }
 
     if (FailureInducer::enabled()) {
       if (MaintenanceFlag::split(maintenance_flags))
@@ -699,9 +969,11 @@ void AccessGroup::run_compaction(int maintenance_flags, Hints *hints) {
           new_stores.push_back(m_stores[i]);
         for (size_t i=merge_offset; i<merge_offset+merge_length; i++)
           removed_files.push_back(m_stores[i].cs->get_filename());
-        if (cellstore->get_total_entries() > 0) {
-          new_stores.push_back(cellstore);
-          added_file = cellstore->get_filename();
+        foreach_ht (CompactionPartitionPtr &partition, partitions) {
+          if (partition->cellstore->get_total_entries() > 0) {
+            new_stores.push_back(partition->cellstore);
+            added_files.push_back(partition->cellstore->get_filename());
+          }
         }
         for (size_t i=merge_offset+merge_length; i<m_stores.size(); i++)
           new_stores.push_back(m_stores[i]);
@@ -725,8 +997,14 @@ void AccessGroup::run_compaction(int maintenance_flags, Hints *hints) {
          */
         if (major) {
           if (!garbage_check_performed) {
-            uint64_t input_bytes, output_bytes;
-            mscanner->get_io_accounting_data(&input_bytes, &output_bytes);
+            uint64_t input_bytes = 0, output_bytes = 0;
+            foreach_ht (CompactionPartitionPtr &partition, partitions) {
+              uint64_t partition_input_bytes, partition_output_bytes;
+              partition->mscanner->get_io_accounting_data(&partition_input_bytes,
+                                                          &partition_output_bytes);
+              input_bytes += partition_input_bytes;
+              output_bytes += partition_output_bytes;
+            }
             m_garbage_tracker.set_garbage_stats(input_bytes, output_bytes);
           }
           m_garbage_tracker.clear();
@@ -757,23 +1035,39 @@ void AccessGroup::run_compaction(int maintenance_flags, Hints *hints) {
           }
         }
 
-        /** Add the new cell store to the table vector, or delete it if
-         * it contains no entries
+        /** Add the new cell stores to the table vector, or delete them if
+         * they contain no entries
          */
-        if (cellstore->get_total_entries() > 0) {
-          if (shadow_cache)
-            m_stores.push_back( CellStoreInfo(cellstore, shadow_cache, m_earliest_cached_revision_saved) );
-          else
-            m_stores.push_back(cellstore);
-          m_garbage_tracker.accumulate_expirable( m_stores.back().expirable_data );
-          added_file = cellstore->get_filename();
+        foreach_ht (CompactionPartitionPtr &partition, partitions) {
+          if (partition->cellstore->get_total_entries() > 0) {
+            if (shadow_cache)
+              m_stores.push_back( CellStoreInfo(partition->cellstore, shadow_cache, m_earliest_cached_revision_saved) );
+            else
+              m_stores.push_back(partition->cellstore);
+            m_garbage_tracker.accumulate_expirable( m_stores.back().expirable_data );
+            added_files.push_back(partition->cellstore->get_filename());
+          }
+        }
+      }
+
+      foreach_ht (CompactionPartitionPtr &partition, partitions) {
+        if (partition->cellstore->get_total_entries() > 0) {
+          int64_t bytes = partition->cellstore->disk_usage();
+          m_bytes_written += bytes;
+          if (minor)
+            m_bytes_flushed += bytes;
         }
       }
 
       // If compaction included CellCache, recompute latest stored revision
       if (!merging || m_end_merge) {
-        m_latest_stored_revision = boost::any_cast<int64_t>
-          (cellstore->get_trailer()->get("revision"));
+        m_latest_stored_revision = TIMESTAMP_MIN;
+        foreach_ht (CompactionPartitionPtr &partition, partitions) {
+          int64_t revision = boost::any_cast<int64_t>
+            (partition->cellstore->get_trailer()->get("revision"));
+          if (revision > m_latest_stored_revision)
+            m_latest_stored_revision = revision;
+        }
         if (m_latest_stored_revision >= m_earliest_cached_revision)
           HT_ERROR("Revision (clock) skew detected! May result in data loss.");
         m_cellcache_needs_compaction = false;
@@ -786,18 +1080,20 @@ void AccessGroup::run_compaction(int maintenance_flags, Hints *hints) {
       hints->disk_usage = m_disk_usage;
     }
 
-    if (cellstore->get_total_entries() == 0) {
-      String fname = cellstore->get_filename();
-      cellstore = 0;
-      try {
-        Global::dfs->remove(fname);
-      }
-      catch (Hypertable::Exception &e) {
-        HT_WARN_OUT << "Problem removing empty CellStore '" << fname << "' " << e << HT_END;
+    foreach_ht (CompactionPartitionPtr &partition, partitions) {
+      if (partition->cellstore->get_total_entries() == 0) {
+        String fname = partition->cellstore->get_filename();
+        partition->cellstore = 0;
+        try {
+          Global::dfs->remove(fname);
+        }
+        catch (Hypertable::Exception &e) {
+          HT_WARN_OUT << "Problem removing empty CellStore '" << fname << "' " << e << HT_END;
+        }
       }
     }
 
-    m_file_tracker.update_live(added_file, removed_files, m_next_cs_id, total_index_entries);
+    m_file_tracker.update_live(added_files, removed_files, m_next_cs_id, total_index_entries);
     m_file_tracker.update_files_column();
     m_file_tracker.get_file_list(hints->files);
 
@@ -812,15 +1108,15 @@ void AccessGroup::run_compaction(int maintenance_flags, Hints *hints) {
     }
 
     HT_INFOF("Finished Compaction of %s(%s) to %s", m_range_name.c_str(),
-             m_name.c_str(), added_file.c_str());
+             m_name.c_str(), boost::algorithm::join(added_files, ",").c_str());
 
   }
   catch (Exception &e) {
-    // Remove newly created file
+    // Remove newly created files
     if (!cellstore_created) {
-      if (!cs_file.empty()) {
+      foreach_ht (CompactionPartitionPtr &partition, partitions) {
         try {
-          Global::dfs->remove(cs_file);
+          Global::dfs->remove(partition->cs_file);
         }
         catch (Hypertable::Exception &e) {
         }
@@ -833,6 +1129,43 @@ void AccessGroup::run_compaction(int maintenance_flags, Hints *hints) {
   }
 }
 
+void AccessGroup::get_subcompaction_split_rows(std::vector<String> &split_rows) {
+
+  if (Global::subcompaction_threads < 2 || Global::subcompaction_min_size <= 0)
+    return;
+
+  int64_t count = std::min((int64_t)Global::subcompaction_threads,
+                           (int64_t)m_disk_usage / Global::subcompaction_min_size);
+  if (count < 2)
+    return;
+
+  StlArena arena(128000);
+  SplitRowDataMapT split_row_data =
+    SplitRowDataMapT(LtCstr(), SplitRowDataAlloc(arena));
+
+  foreach_ht (CellStoreInfo &csinfo, m_stores)
+    csinfo.cs->split_row_estimate_data(split_row_data);
+
+  int64_t total = 0;
+  for (SplitRowDataMapT::iterator iter=split_row_data.begin();
+       iter != split_row_data.end(); ++iter)
+    total += iter->second;
+
+  // Choose the rows at which the cumulative key count crosses each
+  // 1/count fraction of the total
+  int64_t cumulative = 0;
+  int64_t next = 1;
+  for (SplitRowDataMapT::iterator iter=split_row_data.begin();
+       iter != split_row_data.end() && next < count; ++iter) {
+    cumulative += iter->second;
+    if (cumulative >= (total * next) / count && cumulative < total) {
+      split_rows.push_back(iter->first);
+      next++;
+    }
+  }
+}
+
+
 void AccessGroup::load_hints(Hints *hints) {
   hints->ag_name = m_name;
   m_file_tracker.get_file_list(hints->files);
@@ -866,7 +1199,7 @@ void AccessGroup::purge_stored_cells_from_cache() {
 
   m_cell_cache_manager->get_read_cache(old_cell_cache);
 
-  CellCachePtr new_cell_cache = new CellCache();
+  CellCachePtr new_cell_cache = m_cell_cache_manager->create_cell_cache();
   new_cell_cache->lock();
   m_cell_cache_manager->install_new_cell_cache(new_cell_cache);
   
@@ -924,7 +1257,7 @@ AccessGroup::shrink(String &split_row, bool drop_high, Hints *hints) {
 
     m_file_tracker.change_range(m_start_row, m_end_row);
 
-    CellCachePtr new_cell_cache = new CellCache();
+    CellCachePtr new_cell_cache = m_cell_cache_manager->create_cell_cache();
     new_cell_cache->lock();
     m_cell_cache_manager->install_new_cell_cache(new_cell_cache);
 
@@ -1135,84 +1468,41 @@ void AccessGroup::recompute_compression_ratio(int64_t *total_index_entriesp) {
 
 bool AccessGroup::find_merge_run(size_t *indexp, size_t *lenp) {
   size_t index = 0;
-  size_t i = 0;
-  size_t count;
-  int64_t running_total = 0;
+  size_t length = 0;
 
   if (m_in_memory || m_stores.size() <= 1)
     return false;
 
   std::vector<int64_t> disk_usage(m_stores.size());
+  for (size_t i=0; i<m_stores.size(); i++)
+    disk_usage[i] = m_stores[i].cs->disk_usage();
 
-  // If in "low activity" window, first try to be more aggresive
-  if (Global::low_activity_time.within_window()) {
-    bool run_found = false;
-    for (int64_t target = Global::cellstore_target_size_min*2;
-         target <= Global::cellstore_target_size_max;
-         target += Global::cellstore_target_size_min) {
-      index = 0;
-      i = 0;
-      running_total = 0;
-
-      do {
-        disk_usage[i] = m_stores[i].cs->disk_usage();
-        running_total += disk_usage[i];
-
-        if (running_total >= target) {
-          count = (i - index) + 1;
-          if (count >= (size_t)2) {
-            if (indexp)
-              *indexp = index;
-            if (lenp)
-              *lenp = count;
-            run_found = true;
-            break;
-          }
-          // Otherwise, move the index forward by one and try again
-          running_total -= disk_usage[index];
-          index++;
-        }
-        i++;
-      } while (i < m_stores.size());
-      if (i == m_stores.size())
-        break;
-    }
-    if (run_found)
-      return true;
-  }
+  std::vector<bool> continues;
+  get_logical_stores(continues);
 
-  index = 0;
-  i = 0;
-  running_total = 0;
-  do {
-    disk_usage[i] = m_stores[i].cs->disk_usage();
-    running_total += disk_usage[i];
-
-    if (running_total >= Global::cellstore_target_size_min) {
-      count = (i - index) + 1;
-      if (count >= (size_t)Global::merge_cellstore_run_length_threshold) {
-        if (indexp)
-          *indexp = index;
-        if (lenp)
-          *lenp = count;
-        return true;
-      }
-      // Otherwise, move the index forward by one and try again
-      running_total -= disk_usage[index];
-      index++;
-    }
-    i++;
-  } while (i < m_stores.size());
-
-  if ((i-index) >= (size_t)Global::merge_cellstore_run_length_threshold) {
-    if (indexp)
-      *indexp = index;
-    if (lenp)
-      *lenp = i-index;
-    return true;
-  }
+  if (!m_compaction_policy->find_grouped_merge_run(disk_usage, continues,
+               Global::low_activity_time.within_window(),
+               write_amplification(), &index, &length))
+    return false;
 
-  return false;
+  if (indexp)
+    *indexp = index;
+  if (lenp)
+    *lenp = length;
+  return true;
+}
+
+void AccessGroup::get_logical_stores(std::vector<bool> &continues) {
+  continues.resize(m_stores.size());
+  for (size_t i=0; i<m_stores.size(); i++) {
+    uint32_t flags =
+      boost::any_cast<uint32_t>(m_stores[i].cs->get_trailer()->get("flags"));
+    uint32_t prev_flags = i == 0 ? 0 :
+      boost::any_cast<uint32_t>(m_stores[i-1].cs->get_trailer()->get("flags"));
+    continues[i] =
+      (flags & CellStoreTrailerV6::SUBCOMPACTION_CONTINUATION) &&
+      (prev_flags & CellStoreTrailerV6::MAJOR_COMPACTION);
+  }
 }
 
 namespace {
@@ -1273,6 +1563,8 @@ std::ostream &Hypertable::operator<<(std::ostream &os, const AccessGroup::Mainte
   os << "deletes=" << mdata.deletes << "\n";
   os << "outstanding_scanners=" << mdata.outstanding_scanners << "\n";
   os << "compression_ratio=" << mdata.compression_ratio << "\n";
+  os << "write_amplification=" << mdata.write_amplification << "\n";
+  os << "read_amplification=" << mdata.read_amplification << "\n";
   os << "maintenance_flags=" << mdata.maintenance_flags << "\n";
   os << "block_index_memory=" << mdata.block_index_memory << "\n";
   os << "bloom_filter_memory=" << mdata.bloom_filter_memory << "\n";
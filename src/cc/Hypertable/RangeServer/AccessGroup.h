@@ -27,6 +27,7 @@
 #include <Hypertable/RangeServer/CellStore.h>
 #include <Hypertable/RangeServer/CellStoreInfo.h>
 #include <Hypertable/RangeServer/CellStoreTrailerV6.h>
+#include <Hypertable/RangeServer/CompactionPolicy.h>
 #include <Hypertable/RangeServer/LiveFileTracker.h>
 #include <Hypertable/RangeServer/MaintenanceFlag.h>
 
@@ -89,6 +90,8 @@ namespace Hypertable {
       int32_t deletes;
       int32_t outstanding_scanners;
       float    compression_ratio;
+      float    write_amplification;
+      uint32_t read_amplification;
       int16_t  maintenance_flags;
       uint64_t block_index_memory;
       uint64_t bloom_filter_memory;
@@ -173,6 +176,35 @@ namespace Hypertable {
 
     void load_cellstore(CellStorePtr &cellstore);
 
+    /** Checks that an externally built CellStore can be attached to the
+     * access group.  Makes no changes.
+     * @param fname Path of the staged CellStore file
+     * @return Revision of the CellStore
+     * @throws Exception if the file can't be opened, its revision is in the
+     * future, or the access group is in-memory
+     */
+    int64_t check_attachable(const String &fname);
+
+    /** Reserves the name under which a staged CellStore will be attached.
+     * @param fname Path of the staged CellStore file
+     * @param revision Revision returned by check_attachable()
+     * @return Path of the CellStore in the access group's directory
+     * @throws Exception if <code>revision</code> is not older than the
+     * oldest cached cell
+     */
+    String reserve_attach(const String &fname, int64_t revision);
+
+    /** Adds an externally built CellStore to the access group.  The file is
+     * moved to <code>cs_file</code>, appended to the store vector and
+     * recorded in the <i>Files</i> column of METADATA.  Does nothing if
+     * <code>cs_file</code> is attached already, and skips the move if
+     * <code>fname</code> no longer exists, so that an attach interrupted
+     * by a crash can be finished by calling it again.
+     * @param fname Path of the staged CellStore file
+     * @param cs_file Path returned by reserve_attach()
+     */
+    void attach_cellstore(const String &fname, const String &cs_file);
+
     void pre_load_cellstores() {
       ScopedLock lock(m_mutex);
       m_latest_stored_revision = TIMESTAMP_MIN;
@@ -236,6 +268,43 @@ namespace Hypertable {
 
     bool find_merge_run(size_t *indexp=0, size_t *lenp=0);
 
+    /** Groups the cell stores into logical stores.  The cell stores written
+     * by one split major compaction form a single logical store, which
+     * merging compactions and the read amplification estimate treat as one
+     * store; every other cell store is a logical store of its own.  A
+     * store continues the logical store of the one before it if it is
+     * flagged CellStoreTrailerV6::SUBCOMPACTION_CONTINUATION and that one
+     * was written by a major compaction.  This method must be called with
+     * #m_mutex locked.
+     * @param continues Receives, for each store in #m_stores, <i>true</i>
+     * if it continues the logical store of the store before it
+     */
+    void get_logical_stores(std::vector<bool> &continues);
+
+    /** Returns the bytes written to cell stores by this access group since
+     * it was loaded, divided by the bytes flushed to it from the cell cache
+     * or attached, or 0 if nothing has been flushed yet.
+     */
+    double write_amplification() {
+      return m_bytes_flushed ?
+        (double)m_bytes_written / (double)m_bytes_flushed : 0.0;
+    }
+
+    /** Computes row boundaries for splitting a major compaction into
+     * subcompactions.  Boundaries are chosen from the cell store block
+     * indexes so that each of the resulting row intervals holds about the
+     * same number of keys.  The number of intervals is limited by
+     * Global::subcompaction_threads and by requiring each interval to hold
+     * at least Global::subcompaction_min_size bytes of stored data.  Each
+     * partition is written to its own cell store; all but the first are
+     * flagged CellStoreTrailerV6::SUBCOMPACTION_CONTINUATION so that
+     * get_logical_stores() groups them back together.  This method must be
+     * called with #m_mutex locked.
+     * @param split_rows Receives the boundary rows in ascending order (left
+     * empty if the compaction should not be split)
+     */
+    void get_subcompaction_split_rows(std::vector<String> &split_rows);
+
     /** Gets merging compaction information.
      * Determines whether or not a merging compaction is needed, and if so,
      * whether or not the "merge run" includes the end cell store (the one
@@ -280,6 +349,9 @@ namespace Hypertable {
     int64_t              m_latest_stored_revision_hint;
     LiveFileTracker      m_file_tracker;
     AccessGroupGarbageTracker m_garbage_tracker;
+    CompactionPolicyPtr  m_compaction_policy;
+    int64_t              m_bytes_flushed;
+    int64_t              m_bytes_written;
     bool                 m_is_root;
     bool                 m_in_memory;
     bool                 m_recovering;
@@ -37,19 +37,66 @@ using namespace Hypertable;
 using namespace std;
 
 
-CellCache::CellCache()
+namespace {
+
+  template <class CellMapT>
+  void split_row_estimate(CellMapT &cell_map,
+                          CellList::SplitRowDataMapT &split_row_data) {
+    const char *row, *last_row = 0;
+    int64_t last_count = 0;
+    for (typename CellMapT::iterator iter = cell_map.begin();
+         iter != cell_map.end(); ++iter) {
+      row = iter->first.row();
+      if (last_row == 0)
+        last_row = row;
+      if (strcmp(row, last_row) != 0) {
+        CstrToInt64MapT::iterator iter = split_row_data.find(last_row);
+        if (iter == split_row_data.end())
+          split_row_data[last_row] = last_count;
+        else
+          iter->second += last_count;
+        last_row = row;
+        last_count = 0;
+      }
+      last_count++;
+    }
+    if (last_count > 0) {
+      CstrToInt64MapT::iterator iter = split_row_data.find(last_row);
+      if (iter == split_row_data.end())
+        split_row_data[last_row] = last_count;
+      else
+        iter->second += last_count;
+    }
+  }
+
+  template <class CellMapT>
+  void populate_keys(CellMapT &cell_map, KeySet &keys) {
+    Key key;
+    for (typename CellMapT::iterator iter = cell_map.begin();
+         iter != cell_map.end(); ++iter) {
+      key.load((*iter).first);
+      keys.insert(key);
+    }
+  }
+
+}
+
+
+CellCache::CellCache(bool skip_list)
   : m_arena_base(), m_arena(m_arena_base), m_cell_map(std::less<const SerializedKey>(), Alloc(m_arena)),
-    m_deletes(0), m_collisions(0), m_key_bytes(0), m_value_bytes(0),
-    m_frozen(false), m_have_counter_deletes(false) {
+    m_skip_list(m_arena), m_deletes(0), m_collisions(0), m_key_bytes(0),
+    m_value_bytes(0), m_frozen(false), m_have_counter_deletes(false),
+    m_use_skip_list(skip_list) {
   assert(Config::properties); // requires Config::init* first
   m_arena.set_page_size((size_t)
       Config::get_i32("Hypertable.RangeServer.AccessGroup.CellCache.PageSize"));
 }
 
-CellCache::CellCache(CellCacheArena &arena)
+CellCache::CellCache(CellCacheArena &arena, bool skip_list)
   : m_arena(arena), m_cell_map(std::less<const SerializedKey>(), Alloc(m_arena)),
-    m_deletes(0), m_collisions(0), m_key_bytes(0), m_value_bytes(0),
-    m_frozen(false), m_have_counter_deletes(false) {
+    m_skip_list(m_arena), m_deletes(0), m_collisions(0), m_key_bytes(0),
+    m_value_bytes(0), m_frozen(false), m_have_counter_deletes(false),
+    m_use_skip_list(skip_list) {
   assert(Config::properties); // requires Config::init* first
   m_arena.set_page_size((size_t)
       Config::get_i32("Hypertable.RangeServer.AccessGroup.CellCache.PageSize"));
@@ -75,6 +122,16 @@ void CellCache::add(const Key &key, const ByteString value) {
 
   value.write(ptr);
 
+  if (m_use_skip_list) {
+    if (!m_skip_list.insert(new_key)) {
+      m_collisions++;
+      HT_WARNF("Collision detected key insert (row = %s)", new_key.row());
+    }
+    else if (key.flag <= FLAG_DELETE_CELL_VERSION)
+      m_deletes++;
+    return;
+  }
+
   CellMap::value_type v(new_key, key.length);
   std::pair<CellMap::iterator, bool> r = m_cell_map.insert(v);
   if (!r.second) {
@@ -108,19 +165,36 @@ void CellCache::add_counter(const Key &key, const ByteString value) {
 
   HT_ASSERT(*value.ptr == 8);
 
-  CellMap::iterator iter = m_cell_map.lower_bound(key.serial);
+  SerializedKey existing_key;
+  uint32_t existing_offset;
+  CellMap::iterator iter;
+  CellCacheSkipList::iterator skip_iter;
 
-  if (iter == m_cell_map.end()) {
-    add(key, value);
-    return;
+  if (m_use_skip_list) {
+    skip_iter = m_skip_list.lower_bound(key.serial);
+    if (skip_iter == m_skip_list.end()) {
+      add(key, value);
+      return;
+    }
+    existing_key = skip_iter->first;
+    existing_offset = skip_iter->second;
+  }
+  else {
+    iter = m_cell_map.lower_bound(key.serial);
+    if (iter == m_cell_map.end()) {
+      add(key, value);
+      return;
+    }
+    existing_key = iter->first;
+    existing_offset = iter->second;
   }
 
   const uint8_t *ptr;
 
-  size_t len = (*iter).first.decode_length(&ptr);
+  size_t len = existing_key.decode_length(&ptr);
 
   // If the lengths differ, assume they're different keys and do a normal add
-  if (len + (ptr-(*iter).first.ptr) != key.length) {
+  if (len + (ptr-existing_key.ptr) != key.length) {
     add(key, value);
     return;
   }
@@ -131,7 +205,7 @@ void CellCache::add_counter(const Key &key, const ByteString value) {
   }
 
   ByteString old_value;
-  old_value.ptr = (*iter).first.ptr + (*iter).second;
+  old_value.ptr = existing_key.ptr + existing_offset;
 
   HT_ASSERT(*old_value.ptr == 8 || *old_value.ptr == 9);
 
@@ -143,12 +217,23 @@ void CellCache::add_counter(const Key &key, const ByteString value) {
     return;
   }
 
+  /*
+   * Skiplist readers do not lock, so rather than updating the entry in
+   * place, build an updated copy of it and publish that
+   */
+  if (m_use_skip_list) {
+    uint8_t *copy = m_arena.alloc(existing_offset + 9);
+    memcpy(copy, existing_key.ptr, existing_offset + 9);
+    existing_key.ptr = copy;
+    old_value.ptr = copy + existing_offset;
+  }
+
   /*
    * copy timestamp/revision info from insert key to the one in the map
    */
   size_t offset = (key.flag_ptr-((const uint8_t *)key.serial.ptr)) + 1;
-  len = (*iter).second - offset;
-  memcpy(((uint8_t *)(*iter).first.ptr) + offset, key.flag_ptr+1, len);
+  len = existing_offset - offset;
+  memcpy(((uint8_t *)existing_key.ptr) + offset, key.flag_ptr+1, len);
 
   // read old value
   ptr = old_value.ptr+1;
@@ -163,50 +248,52 @@ void CellCache::add_counter(const Key &key, const ByteString value) {
   uint8_t *write_ptr = (uint8_t *)old_value.ptr+1;
 
   Serialization::encode_i64(&write_ptr, old_count+new_count);
+
+  if (m_use_skip_list)
+    m_skip_list.replace(skip_iter, existing_key);
 }
 
 
 void CellCache::split_row_estimate_data(SplitRowDataMapT &split_row_data) {
   ScopedLock lock(m_mutex);
-  const char *row, *last_row = 0;
-  int64_t last_count = 0;
-  for (CellMap::iterator iter = m_cell_map.begin();
-       iter != m_cell_map.end(); ++iter) {
-    row = iter->first.row();
-    if (last_row == 0)
-      last_row = row;
-    if (strcmp(row, last_row) != 0) {
-      CstrToInt64MapT::iterator iter = split_row_data.find(last_row);
-      if (iter == split_row_data.end())
-        split_row_data[last_row] = last_count;
-      else
-        iter->second += last_count;
-      last_row = row;
-      last_count = 0;
-    }
-    last_count++;
-  }
-  if (last_count > 0) {
-    CstrToInt64MapT::iterator iter = split_row_data.find(last_row);
-    if (iter == split_row_data.end())
-      split_row_data[last_row] = last_count;
-    else
-      iter->second += last_count;
-  }
+  if (m_use_skip_list)
+    split_row_estimate(m_skip_list, split_row_data);
+  else
+    split_row_estimate(m_cell_map, split_row_data);
 }
 
 
+void CellCache::populate_key_set(KeySet &keys) {
+  if (m_use_skip_list)
+    populate_keys(m_skip_list, keys);
+  else
+    populate_keys(m_cell_map, keys);
+}
+
 
 CellListScanner *CellCache::create_scanner(ScanContextPtr &scan_ctx) {
   CellCachePtr cellcache(this);
-  return new CellCacheScanner(cellcache, scan_ctx);
+  if (m_use_skip_list)
+    return new CellCacheSkipListScanner(cellcache, m_skip_list, scan_ctx);
+  return new CellCacheScanner(cellcache, m_cell_map, scan_ctx);
 }
 
 void CellCache::merge(CellCache *other) {
   ScopedLock lock(m_mutex);
   HT_ASSERT(&m_arena == &(other->m_arena));
   Locker<CellCache> write_lock(*other);
-  if (m_cell_map.empty())
+  if (m_use_skip_list) {
+    HT_ASSERT(other->m_use_skip_list);
+    for (CellCacheSkipList::iterator iter = other->m_skip_list.begin();
+         iter != other->m_skip_list.end(); ++iter) {
+      if (!m_skip_list.insert(iter->first)) {
+        m_collisions++;
+        HT_WARNF("Collision detected merge (row = %s)", iter->first.row());
+      }
+    }
+    other->m_skip_list.clear();
+  }
+  else if (m_cell_map.empty())
     m_cell_map.swap(other->m_cell_map);
   else {
     for (CellMap::const_iterator iter = other->m_cell_map.begin();
@@ -33,6 +33,7 @@
 #include "Hypertable/Lib/SerializedKey.h"
 
 #include "CellCacheAllocator.h"
+#include "CellCacheSkipList.h"
 
 namespace Hypertable {
 
@@ -48,13 +49,16 @@ namespace Hypertable {
   /**
    * Represents  a sorted list of key/value pairs in memory.
    * All updates get written to the CellCache and later get "compacted"
-   * into a CellStore on disk.
+   * into a CellStore on disk.  The cells are either kept in a std::map
+   * (default) or in a CellCacheSkipList.  The skiplist variant allows
+   * scanners to read the cache without acquiring the CellCache mutex,
+   * which is then only used to serialize writers.
    */
   class CellCache : public CellList {
 
   public:
-    CellCache();
-    CellCache(CellCacheArena &arena);
+    CellCache(bool skip_list=false);
+    CellCache(CellCacheArena &arena, bool skip_list=false);
     virtual ~CellCache() { m_cell_map.clear(); }
     /**
      * Adds a key/value pair to the CellCache.  This method assumes that
@@ -70,7 +74,7 @@ namespace Hypertable {
 
     virtual void split_row_estimate_data(SplitRowDataMapT &split_row_data);
 
-    virtual int64_t get_total_entries() { return m_cell_map.size(); }
+    virtual int64_t get_total_entries() { return size(); }
 
     /** Creates a CellCacheScanner object that contains an shared pointer
      * (intrusive_ptr) to this CellCache.
@@ -80,9 +84,21 @@ namespace Hypertable {
     void lock()   { if (!m_frozen) m_mutex.lock(); }
     void unlock() { if (!m_frozen) m_mutex.unlock(); }
 
-    size_t size() { return m_cell_map.size(); }
+    size_t size() {
+      return m_use_skip_list ? m_skip_list.size() : m_cell_map.size();
+    }
+
+    bool empty() {
+      if (m_use_skip_list)
+        return m_skip_list.empty();
+      ScopedLock lock(m_mutex);
+      return m_cell_map.empty();
+    }
 
-    bool empty() {ScopedLock lock(m_mutex); return m_cell_map.empty(); }
+    /** Checks if cells are stored in a CellCacheSkipList.
+     * @return <i>true</i> if this cache is skiplist backed
+     */
+    bool is_skip_list() const { return m_use_skip_list; }
 
     /** Returns the amount of memory used by the CellCache.  This is the
      * summation of the lengths of all the keys and values in the map.
@@ -105,7 +121,7 @@ namespace Hypertable {
 
     void add_counts(size_t *cellsp, int64_t *key_bytesp, int64_t *value_bytesp) {
       ScopedLock lock(m_mutex);
-      *cellsp += m_cell_map.size();
+      *cellsp += size();
       *key_bytesp += m_key_bytes;
       *value_bytesp += m_value_bytes;
     }
@@ -117,18 +133,11 @@ namespace Hypertable {
 
     void merge(CellCache *other);
 
-    void populate_key_set(KeySet &keys) {
-      Key key;
-      for (CellMap::const_iterator iter = m_cell_map.begin();
-	   iter != m_cell_map.end(); ++iter) {
-	key.load((*iter).first);
-	keys.insert(key);
-      }
-    }
+    void populate_key_set(KeySet &keys);
 
     CellCacheArena &arena() { return m_arena; }
 
-    friend class CellCacheScanner;
+    template <class CellMapT> friend class CellCacheScannerT;
 
     typedef std::pair<const SerializedKey, uint32_t> Value;
     typedef CellCacheAllocator<Value> Alloc;
@@ -141,12 +150,14 @@ namespace Hypertable {
     CellCacheArena     m_arena_base;
     CellCacheArena    &m_arena;
     CellMap            m_cell_map;
+    CellCacheSkipList  m_skip_list;
     int32_t            m_deletes;
     int32_t            m_collisions;
     int64_t            m_key_bytes;
     int64_t            m_value_bytes;
     bool               m_frozen;
     bool               m_have_counter_deletes;
+    bool               m_use_skip_list;
 
   };
 
@@ -28,19 +28,34 @@
 using namespace Hypertable;
 using namespace std;
 
-CellCacheManager::CellCacheManager() {
-  m_read_cache = new CellCache();
-  m_write_cache = new CellCache(m_read_cache->arena());
+CellCacheManager::CellCacheManager(bool skip_list) : m_skip_list(skip_list) {
+  m_read_cache = create_cell_cache();
+  install_write_cache();
   m_immutable_cache = 0;
 }
 
 void CellCacheManager::install_new_cell_cache(CellCachePtr &cell_cache) {
   // 1st set write cache and free previous write cell cache
-  m_write_cache = new CellCache(cell_cache->arena());
+  if (cell_cache->is_skip_list())
+    m_write_cache = cell_cache;
+  else
+    m_write_cache = new CellCache(cell_cache->arena());
   // 2nd assign new read cache and free previous read cell cache including the shared arena
   m_read_cache = cell_cache;
 }
 
+void CellCacheManager::install_write_cache() {
+  if (m_read_cache->is_skip_list())
+    m_write_cache = m_read_cache;
+  else
+    m_write_cache = new CellCache(m_read_cache->arena());
+}
+
+void CellCacheManager::merge_write_cache() {
+  if (separate_write_cache())
+    m_read_cache->merge(m_write_cache.get());
+}
+
 void CellCacheManager::install_new_immutable_cache(CellCachePtr &cell_cache) {
   m_immutable_cache = cell_cache;
 }
@@ -55,7 +70,7 @@ void CellCacheManager::merge_caches(SchemaPtr &schema) {
     return;
   }
 
-  m_read_cache->merge(m_write_cache.get());
+  merge_write_cache();
 
   if (m_read_cache->size() == 0) {
     install_new_cell_cache(m_immutable_cache);
@@ -66,7 +81,7 @@ void CellCacheManager::merge_caches(SchemaPtr &schema) {
 
   Key key;
   ByteString value;
-  CellCachePtr merged_cache = new CellCache();
+  CellCachePtr merged_cache = create_cell_cache();
   ScanContextPtr scan_context = new ScanContext(schema);
   CellListScannerPtr scanner = m_immutable_cache->create_scanner(scan_context);
   while (scanner->get(key, value)) {
@@ -107,7 +122,7 @@ void CellCacheManager::add_immutable_scanner(MergeScanner *scanner, ScanContextP
 }
 
 void CellCacheManager::add_scanners(MergeScanner *scanner, ScanContextPtr &scan_context) {
-  m_read_cache->merge(m_write_cache.get());
+  merge_write_cache();
   if (!m_read_cache->empty())
     scanner->add_scanner(m_read_cache->create_scanner(scan_context));
   add_immutable_scanner(scanner, scan_context);
@@ -119,12 +134,14 @@ CellCacheManager::split_row_estimate_data(CellList::SplitRowDataMapT &split_row_
   if (m_immutable_cache)
     m_immutable_cache->split_row_estimate_data(split_row_data);
   m_read_cache->split_row_estimate_data(split_row_data);
-  m_write_cache->split_row_estimate_data(split_row_data);
+  if (separate_write_cache())
+    m_write_cache->split_row_estimate_data(split_row_data);
 }
 
 
 int64_t CellCacheManager::get_total_entries() {
-  return m_read_cache->get_total_entries() + m_write_cache->get_total_entries() +
+  return m_read_cache->get_total_entries() +
+    (separate_write_cache() ? m_write_cache->get_total_entries() : 0) +
     (m_immutable_cache ? m_immutable_cache->get_total_entries() : 0);
 }
 
@@ -141,7 +158,7 @@ void CellCacheManager::unlock_write_cache() {
 }
 
 void CellCacheManager::get_read_cache(CellCachePtr &read_cache) {
-  m_read_cache->merge(m_write_cache.get());
+  merge_write_cache();
   read_cache = m_read_cache;
 }
 
@@ -177,7 +194,8 @@ uint64_t CellCacheManager::memory_allocated() {
 }
 
 int32_t CellCacheManager::get_delete_count() {
-  return m_read_cache->get_delete_count() + m_write_cache->get_delete_count() +
+  return m_read_cache->get_delete_count() +
+    (separate_write_cache() ? m_write_cache->get_delete_count() : 0) +
     (m_immutable_cache ? m_immutable_cache->get_delete_count() : 0);
 }
 
@@ -185,22 +203,24 @@ void CellCacheManager::get_counts(size_t *cellsp, int64_t *key_bytesp, int64_t *
   *cellsp = 0;
   *key_bytesp = *value_bytesp = 0;
   m_read_cache->add_counts(cellsp, key_bytesp, value_bytesp);
-  m_write_cache->add_counts(cellsp, key_bytesp, value_bytesp);
+  if (separate_write_cache())
+    m_write_cache->add_counts(cellsp, key_bytesp, value_bytesp);
   if (m_immutable_cache)
     m_immutable_cache->add_counts(cellsp, key_bytesp, value_bytesp);
 }
 
 void CellCacheManager::freeze() {
-  m_read_cache->merge(m_write_cache.get());
+  merge_write_cache();
   m_immutable_cache = m_read_cache;
   m_immutable_cache->freeze();
-  m_read_cache = new CellCache();
-  m_write_cache = new CellCache(m_read_cache->arena());
+  m_read_cache = create_cell_cache();
+  install_write_cache();
 }
 
 void CellCacheManager::populate_key_set(KeySet &keys) {
   if (m_immutable_cache)
     m_immutable_cache->populate_key_set(keys);
   m_read_cache->populate_key_set(keys);
-  m_write_cache->populate_key_set(keys);
+  if (separate_write_cache())
+    m_write_cache->populate_key_set(keys);
 }
@@ -32,12 +32,27 @@
 
 namespace Hypertable {
 
+  /**
+   * Manages the read, write and immutable CellCaches of an access group.
+   * For map based caches, updates go to a separate write cache that is
+   * merged into the read cache before it is scanned.  Skiplist based caches
+   * can be scanned while being written to, so for those the write cache and
+   * the read cache are the same object.
+   */
   class CellCacheManager : public ReferenceCount {
 
   public:
-    CellCacheManager();
+    /** Constructor.
+     * @param skip_list Create skiplist based CellCaches
+     */
+    CellCacheManager(bool skip_list=false);
     virtual ~CellCacheManager() { }
 
+    /** Creates a new CellCache of the type used by this manager.
+     * @return Newly allocated CellCache
+     */
+    CellCache *create_cell_cache() { return new CellCache(m_skip_list); }
+
     void install_new_cell_cache(CellCachePtr &cell_cache);
 
     void install_new_immutable_cache(CellCachePtr &cell_cache);
@@ -104,6 +119,19 @@ namespace Hypertable {
     void populate_key_set(KeySet &keys);
 
   private:
+
+    /// Sets up the write cache for the current read cache
+    void install_write_cache();
+
+    /// Merges the write cache into the read cache if they differ
+    void merge_write_cache();
+
+    /// Checks if the write cache is distinct from the read cache
+    bool separate_write_cache() {
+      return m_write_cache.get() != m_read_cache.get();
+    }
+
+    bool m_skip_list;
     CellCachePtr m_read_cache;
     CellCachePtr m_write_cache;
     CellCachePtr m_immutable_cache;
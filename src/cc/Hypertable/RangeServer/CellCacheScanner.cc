@@ -35,12 +35,17 @@ using namespace Hypertable;
 /**
  *
  */
-CellCacheScanner::CellCacheScanner(CellCachePtr &cellcache,
-                                   ScanContextPtr &scan_ctx)
-  : CellListScanner(scan_ctx), m_cell_cache_ptr(cellcache),
-    m_cell_cache_mutex(cellcache->m_mutex), m_entry_cache_next(0),
-    m_in_deletes(false), m_eos(false), m_keys_only(false) {
-  ScopedLock lock(m_cell_cache_mutex);
+template <class CellMapT>
+CellCacheScannerT<CellMapT>::CellCacheScannerT(CellCachePtr &cellcache,
+                                               CellMapT &cell_map,
+                                               ScanContextPtr &scan_ctx)
+  : CellListScanner(scan_ctx), m_cell_map(cell_map),
+    m_cell_cache_ptr(cellcache), m_cell_cache_mutex(cellcache->m_mutex),
+    m_entry_cache_next(0), m_in_deletes(false), m_eos(false),
+    m_keys_only(false), m_lock_free(cellcache->is_skip_list()) {
+  ScopedLock lock(m_cell_cache_mutex, boost::defer_lock);
+  if (!m_lock_free)
+    lock.lock();
   DynamicBuffer current_buf;
   Key current;
   String tmp_str;
@@ -61,7 +66,7 @@ CellCacheScanner::CellCacheScanner(CellCachePtr &cellcache,
    * ie, the scan contains a qualified column.
    */
   if (scan_ctx->has_cell_interval) {
-    CellCache::CellMap::iterator iter;
+    CellMapIterator iter;
 
     /**
      * Look for any DELETE_ROW records for this row and add them
@@ -73,13 +78,13 @@ CellCacheScanner::CellCacheScanner(CellCachePtr &cellcache,
 
     current.serial.ptr = current_buf.base;
 
-    for (iter = m_cell_cache_ptr->m_cell_map.lower_bound(current.serial);
-         iter != m_cell_cache_ptr->m_cell_map.end(); ++iter) {
+    for (iter = m_cell_map.lower_bound(current.serial);
+         iter != m_cell_map.end(); ++iter) {
       current.load(iter->first);
       if (current.flag != FLAG_DELETE_ROW ||
           strcmp(current.row, scan_ctx->start_key.row))
         break;
-      m_deletes.insert(CellCache::CellMap::value_type(iter->first, iter->second));
+      m_deletes.insert(CellCacheMap::value_type(iter->first, iter->second));
     }
 
     if (scan_ctx->has_start_cf_qualifier) {
@@ -92,23 +97,23 @@ CellCacheScanner::CellCacheScanner(CellCachePtr &cellcache,
 
       current.serial.ptr = current_buf.base;
 
-      for (iter = m_cell_cache_ptr->m_cell_map.lower_bound(current.serial);
-           iter != m_cell_cache_ptr->m_cell_map.end(); ++iter) {
+      for (iter = m_cell_map.lower_bound(current.serial);
+           iter != m_cell_map.end(); ++iter) {
         current.load(iter->first);
         if (current.flag != FLAG_DELETE_COLUMN_FAMILY ||
             current.column_family_code != scan_ctx->start_key.column_family_code ||
             strcmp(current.row, scan_ctx->start_key.row))
           break;
-        m_deletes.insert(CellCache::CellMap::value_type(iter->first, iter->second));
+        m_deletes.insert(CellCacheMap::value_type(iter->first, iter->second));
       }
     }
   }
 
-  m_start_iter = m_cell_cache_ptr->m_cell_map.lower_bound(scan_ctx->start_serkey);
-  if (m_start_iter != m_cell_cache_ptr->m_cell_map.end())
-    m_end_iter = m_cell_cache_ptr->m_cell_map.lower_bound(scan_ctx->end_serkey);
+  m_start_iter = m_cell_map.lower_bound(scan_ctx->start_serkey);
+  if (m_start_iter != m_cell_map.end())
+    m_end_iter = m_cell_map.lower_bound(scan_ctx->end_serkey);
   else
-    m_end_iter = m_cell_cache_ptr->m_cell_map.end();
+    m_end_iter = m_cell_map.end();
   m_cur_iter = m_start_iter;
 
   if (!m_deletes.empty()) {
@@ -129,7 +134,8 @@ CellCacheScanner::CellCacheScanner(CellCachePtr &cellcache,
   return;
 }
 
-bool CellCacheScanner::get(Key &key, ByteString &value) {
+template <class CellMapT>
+bool CellCacheScannerT<CellMapT>::get(Key &key, ByteString &value) {
 
  try_again:
 
@@ -147,12 +153,14 @@ bool CellCacheScanner::get(Key &key, ByteString &value) {
 
 }
 
-void CellCacheScanner::forward() {
+template <class CellMapT>
+void CellCacheScannerT<CellMapT>::forward() {
   m_entry_cache_next++;
 }
 
 
-bool CellCacheScanner::internal_get() {
+template <class CellMapT>
+bool CellCacheScannerT<CellMapT>::internal_get() {
 
   if (m_in_deletes) {
     m_cur_entry.key.load( (*m_delete_iter).first );
@@ -171,7 +179,8 @@ bool CellCacheScanner::internal_get() {
 
 
 
-void CellCacheScanner::internal_forward() {
+template <class CellMapT>
+void CellCacheScannerT<CellMapT>::internal_forward() {
 
   if (m_in_deletes) {
     ++m_delete_iter;
@@ -203,8 +212,11 @@ void CellCacheScanner::internal_forward() {
  * std::vector<CellCacheEntry>    m_entry_cache;
  * size_t                         m_entry_cache_next;
  */
-void CellCacheScanner::load_entry_cache() {
-  ScopedLock lock(m_cell_cache_mutex);
+template <class CellMapT>
+void CellCacheScannerT<CellMapT>::load_entry_cache() {
+  ScopedLock lock(m_cell_cache_mutex, boost::defer_lock);
+  if (!m_lock_free)
+    lock.lock();
 
   m_entry_cache_next = 0;
   m_entry_cache.clear();
@@ -225,3 +237,8 @@ void CellCacheScanner::load_entry_cache() {
 
 
 }
+
+namespace Hypertable {
+  template class CellCacheScannerT<CellCache::CellMap>;
+  template class CellCacheScannerT<CellCacheSkipList>;
+}
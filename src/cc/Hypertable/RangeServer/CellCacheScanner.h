@@ -30,12 +30,17 @@
 namespace Hypertable {
 
   /**
-   * Provides a scanning interface to a CellCache.
+   * Provides a scanning interface to a CellCache.  The template parameter
+   * is the type of the underlying cell map (CellCache::CellMap or
+   * CellCacheSkipList).  Scanners over a skiplist backed CellCache never
+   * take the CellCache mutex.
    */
-  class CellCacheScanner : public CellListScanner {
+  template <class CellMapT>
+  class CellCacheScannerT : public CellListScanner {
   public:
-    CellCacheScanner(CellCachePtr &cellcache, ScanContextPtr &scan_ctx);
-    virtual ~CellCacheScanner() { return; }
+    CellCacheScannerT(CellCachePtr &cellcache, CellMapT &cell_map,
+                      ScanContextPtr &scan_ctx);
+    virtual ~CellCacheScannerT() { return; }
     virtual void forward();
     virtual bool get(Key &key, ByteString &value);
 
@@ -56,9 +61,12 @@ namespace Hypertable {
       ByteString  value;
     };
 
-    CellCache::CellMap::iterator   m_start_iter;
-    CellCache::CellMap::iterator   m_end_iter;
-    CellCache::CellMap::iterator   m_cur_iter;
+    typedef typename CellMapT::iterator CellMapIterator;
+
+    CellMapT                      &m_cell_map;
+    CellMapIterator                m_start_iter;
+    CellMapIterator                m_end_iter;
+    CellMapIterator                m_cur_iter;
     CellCacheMap::iterator         m_delete_iter;
     CellCachePtr                   m_cell_cache_ptr;
     Mutex                         &m_cell_cache_mutex;
@@ -69,7 +77,11 @@ namespace Hypertable {
     bool                           m_in_deletes;
     bool                           m_eos;
     bool                           m_keys_only;
+    bool                           m_lock_free;
   };
+
+  typedef CellCacheScannerT<CellCache::CellMap> CellCacheScanner;
+  typedef CellCacheScannerT<CellCacheSkipList> CellCacheSkipListScanner;
 }
 
 #endif // HYPERTABLE_CELLCACHESCANNER_H
@@ -0,0 +1,125 @@
+/** -*- c++ -*-
+ * Copyright (C) 2007-2013 Hypertable, Inc.
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 3 of the
+ * License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+/** @file
+ * Definitions for CellCacheSkipList.
+ * This file contains the definitions for CellCacheSkipList, an arena backed
+ * skiplist that supports a single writer and any number of concurrent,
+ * lock-free readers.
+ */
+
+#include "Common/Compat.h"
+
+#include "CellCacheSkipList.h"
+
+using namespace Hypertable;
+
+CellCacheSkipList::CellCacheSkipList(CellCacheArena &arena)
+  : m_arena(arena), m_height(1), m_size(0), m_rnd(0xdeadbeef) {
+  memset(&m_head_storage, 0, sizeof(m_head_storage));
+  m_head = reinterpret_cast<Node *>(&m_head_storage);
+}
+
+
+bool CellCacheSkipList::insert(const SerializedKey key) {
+  Node *prev[MAX_HEIGHT];
+  Node *node = find_greater_or_equal(key, prev);
+
+  // Key already present, publish the new key (and value) in place
+  if (node && SerializedKey(node->key) == key) {
+    __atomic_store_n(&node->key, key.ptr, __ATOMIC_RELEASE);
+    return false;
+  }
+
+  int height = random_height();
+  if (height > m_height) {
+    for (int i=m_height; i<height; i++)
+      prev[i] = m_head;
+    // Readers that see the old height simply start lower in the head node
+    __atomic_store_n(&m_height, height, __ATOMIC_RELAXED);
+  }
+
+  node = new_node(key.ptr, height);
+  for (int i=0; i<height; i++) {
+    // Link the new node in before it becomes reachable
+    node->next[i] = prev[i]->next[i];
+    store_next(prev[i], i, node);
+  }
+  __atomic_store_n(&m_size, m_size+1, __ATOMIC_RELAXED);
+  return true;
+}
+
+
+void CellCacheSkipList::clear() {
+  for (int i=0; i<MAX_HEIGHT; i++)
+    store_next(m_head, i, 0);
+  __atomic_store_n(&m_height, 1, __ATOMIC_RELAXED);
+  __atomic_store_n(&m_size, 0, __ATOMIC_RELAXED);
+}
+
+
+CellCacheSkipList::Node *
+CellCacheSkipList::new_node(const uint8_t *key, int height) {
+  size_t len = sizeof(Node) + (height-1)*sizeof(Node *);
+  // Arena allocations are not aligned, so over-allocate and align manually
+  uint8_t *base = m_arena.alloc(len + sizeof(Node *) - 1);
+  uintptr_t addr = ((uintptr_t)base + sizeof(Node *) - 1) &
+    ~(uintptr_t)(sizeof(Node *) - 1);
+  Node *node = reinterpret_cast<Node *>(addr);
+  node->key = key;
+  return node;
+}
+
+
+int CellCacheSkipList::random_height() {
+  int height = 1;
+  // xorshift32, increase height with probability 1/4
+  do {
+    m_rnd ^= m_rnd << 13;
+    m_rnd ^= m_rnd >> 17;
+    m_rnd ^= m_rnd << 5;
+    if ((m_rnd & 3) != 0)
+      break;
+  } while (++height < MAX_HEIGHT);
+  return height;
+}
+
+
+CellCacheSkipList::Node *
+CellCacheSkipList::find_greater_or_equal(const SerializedKey key,
+                                         Node **prev) const {
+  Node *node = m_head;
+  Node *next;
+  int level = __atomic_load_n(&m_height, __ATOMIC_RELAXED) - 1;
+
+  while (true) {
+    next = load_next(node, level);
+    if (next && SerializedKey(load_key(next)) < key)
+      node = next;
+    else {
+      if (prev)
+        prev[level] = node;
+      if (level == 0)
+        return next;
+      level--;
+    }
+  }
+}
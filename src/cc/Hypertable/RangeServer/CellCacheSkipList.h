@@ -0,0 +1,209 @@
+/** -*- c++ -*-
+ * Copyright (C) 2007-2013 Hypertable, Inc.
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 3 of the
+ * License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+/** @file
+ * Declarations for CellCacheSkipList.
+ * This file contains the declarations for CellCacheSkipList, an arena backed
+ * skiplist that supports a single writer and any number of concurrent,
+ * lock-free readers.
+ */
+
+#ifndef HYPERTABLE_CELLCACHESKIPLIST_H
+#define HYPERTABLE_CELLCACHESKIPLIST_H
+
+#include <utility>
+
+#include <boost/noncopyable.hpp>
+
+#include "Hypertable/Lib/SerializedKey.h"
+
+#include "CellCacheAllocator.h"
+
+namespace Hypertable {
+
+  /** @addtogroup RangeServer
+   * @{
+   */
+
+  /** Sorted map of serialized keys to value offsets, organized as a skiplist.
+   * All nodes are carved out of a CellCacheArena and are never freed
+   * individually, so a reader that has obtained a node pointer can follow it
+   * for as long as the arena is alive.  Writers must be serialized by the
+   * caller (CellCache does this with its mutex); readers take no lock.  A
+   * node's key pointer and successor pointers are published with release
+   * semantics and read with acquire semantics, so a reader always sees a
+   * fully initialized node.  Entries are never unlinked; an insert of a key
+   * that compares equal to an existing one swaps the key pointer of the
+   * existing node.
+   */
+  class CellCacheSkipList : boost::noncopyable {
+
+    /// Skiplist node, variable length (<code>next</code> has one slot per
+    /// level)
+    struct Node {
+      const uint8_t *key;
+      Node *next[1];
+    };
+
+    static Node *load_next(const Node *node, int level) {
+      return __atomic_load_n(&node->next[level], __ATOMIC_ACQUIRE);
+    }
+
+    static void store_next(Node *node, int level, Node *next) {
+      __atomic_store_n(&node->next[level], next, __ATOMIC_RELEASE);
+    }
+
+    static const uint8_t *load_key(const Node *node) {
+      return __atomic_load_n(&node->key, __ATOMIC_ACQUIRE);
+    }
+
+  public:
+
+    /// Maximum node height
+    enum { MAX_HEIGHT = 16 };
+
+    /// Entry type, mirrors the <code>value_type</code> of CellCache::CellMap
+    typedef std::pair<SerializedKey, uint32_t> value_type;
+
+    /** Forward iterator over the skiplist.
+     * The entry is materialized when the iterator is positioned, so the key
+     * and value offset returned are always consistent with each other even
+     * if the node is concurrently overwritten.
+     */
+    class iterator {
+    public:
+      iterator() : m_node(0) { }
+      explicit iterator(Node *node) : m_node(node) { load(); }
+      const value_type &operator*() const { return m_value; }
+      const value_type *operator->() const { return &m_value; }
+      iterator &operator++() {
+        m_node = load_next(m_node, 0);
+        load();
+        return *this;
+      }
+      bool operator==(const iterator &other) const {
+        return m_node == other.m_node;
+      }
+      bool operator!=(const iterator &other) const {
+        return m_node != other.m_node;
+      }
+    private:
+      friend class CellCacheSkipList;
+      void load() {
+        if (m_node) {
+          m_value.first.ptr = load_key(m_node);
+          m_value.second = m_value.first.length();
+        }
+      }
+      Node *m_node;
+      value_type m_value;
+    };
+
+    typedef iterator const_iterator;
+
+    /** Constructor.
+     * @param arena Arena from which nodes are allocated
+     */
+    CellCacheSkipList(CellCacheArena &arena);
+
+    /** Returns iterator positioned at the first entry. */
+    iterator begin() const { return iterator(load_next(m_head, 0)); }
+
+    /** Returns the past-the-end iterator. */
+    iterator end() const { return iterator(); }
+
+    /** Returns iterator positioned at first entry not less than
+     * <code>key</code>.
+     * @param key Key to search for
+     * @return Iterator positioned at first entry >= <code>key</code>
+     */
+    iterator lower_bound(const SerializedKey key) const {
+      return iterator(find_greater_or_equal(key, 0));
+    }
+
+    /** Inserts a serialized key.  The value is expected to directly follow
+     * the key in memory.  If an entry comparing equal to <code>key</code>
+     * already exists, its key pointer is replaced.  Must be called by one
+     * writer at a time.
+     * @param key Serialized key (followed by value) to insert
+     * @return <i>true</i> if a new entry was added, <i>false</i> if an
+     * existing entry was replaced
+     */
+    bool insert(const SerializedKey key);
+
+    /** Replaces the key of the entry at <code>iter</code>.  Used to
+     * publish a modified copy of an entry (e.g. an updated counter) without
+     * modifying memory that readers may be looking at.  Must be called by
+     * one writer at a time.
+     * @param iter Iterator positioned at entry to replace
+     * @param key Serialized key (followed by value) to install
+     */
+    void replace(const iterator &iter, const SerializedKey key) {
+      __atomic_store_n(&iter.m_node->key, key.ptr, __ATOMIC_RELEASE);
+    }
+
+    /** Returns number of entries. */
+    size_t size() const { return __atomic_load_n(&m_size, __ATOMIC_RELAXED); }
+
+    /** Checks if skiplist is empty. */
+    bool empty() const { return load_next(m_head, 0) == 0; }
+
+    /** Removes all entries.  Node memory is reclaimed with the arena;
+     * readers positioned inside the list may continue to iterate over the
+     * old entries.
+     */
+    void clear();
+
+  private:
+
+    Node *new_node(const uint8_t *key, int height);
+
+    int random_height();
+
+    Node *find_greater_or_equal(const SerializedKey key, Node **prev) const;
+
+    /// Arena from which nodes are allocated
+    CellCacheArena &m_arena;
+
+    /// Head node, points to <code>m_head_storage</code>
+    Node *m_head;
+
+    /// Current height of the list
+    int m_height;
+
+    /// Number of entries
+    size_t m_size;
+
+    /// Random number state used for choosing node heights
+    uint32_t m_rnd;
+
+    /// Storage for the head node (same layout as a Node of MAX_HEIGHT)
+    struct HeadStorage {
+      const uint8_t *key;
+      Node *next[MAX_HEIGHT];
+    } m_head_storage;
+  };
+
+  /** @}*/
+
+} // namespace Hypertable
+
+#endif // HYPERTABLE_CELLCACHESKIPLIST_H
@@ -31,6 +31,30 @@
 
 namespace Hypertable {
 
+  /** Keeps a region of memory holding cells returned by a scanner valid.
+   * The memory in the region is not modified for as long as the pin is
+   * referenced, so it can be handed to an outgoing message (see
+   * FillScanBlock) after the scanner has moved past it.
+   */
+  class CellMemoryPin : public ReferenceCount {
+  public:
+    CellMemoryPin(const uint8_t *base_, const uint8_t *end_)
+      : base(base_), end(end_) { }
+
+    /** Checks if a memory range lies within the pinned region.
+     * @param ptr Start of range
+     * @param len Length of range
+     * @return <i>true</i> if range is pinned, <i>false</i> otherwise
+     */
+    bool contains(const uint8_t *ptr, size_t len) const {
+      return ptr >= base && ptr + len <= end;
+    }
+
+    const uint8_t *base;
+    const uint8_t *end;
+  };
+  typedef boost::intrusive_ptr<CellMemoryPin> CellMemoryPinPtr;
+
   class CellListScanner : public ReferenceCount {
   public:
     CellListScanner() : m_disk_read(0) { return; }
@@ -40,6 +64,14 @@ namespace Hypertable {
     virtual void forward() = 0;
     virtual bool get(Key &key, ByteString &value) = 0;
 
+    /** Returns pin for the memory holding the current cell.  The key and
+     * value returned by get() may lie (in part) outside of the pinned region
+     * so callers must check with CellMemoryPin::contains().  The returned
+     * pointer is valid until the next call to forward().
+     * @return Pin for current cell or 0 if not supported
+     */
+    virtual CellMemoryPin *get_pin() { return 0; }
+
     ScanContext *scan_context() { return m_scan_context_ptr.get(); }
 
     virtual uint64_t get_disk_read() = 0;
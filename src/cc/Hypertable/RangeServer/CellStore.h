@@ -220,6 +220,14 @@ namespace Hypertable {
      */
     virtual KeyDecompressor *create_key_decompressor();
 
+    /**
+     * Checks if the data blocks of this cell store end with restart points
+     * (see CellStoreBlockRestarts)
+     *
+     * @return <i>true</i> if the data blocks have restart points
+     */
+    virtual bool has_block_restarts() { return false; }
+
     /**
      * Sets the cell store files replaced by this CellStore
      */
@@ -322,6 +330,8 @@ namespace Hypertable {
     static const char DATA_BLOCK_MAGIC[10];
     static const char INDEX_FIXED_BLOCK_MAGIC[10];
     static const char INDEX_VARIABLE_BLOCK_MAGIC[10];
+    static const char DICTIONARY_BLOCK_MAGIC[10];
+    static const char COLUMNAR_DATA_BLOCK_MAGIC[10];
 
   protected:
 
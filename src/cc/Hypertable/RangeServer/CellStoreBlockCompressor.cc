@@ -0,0 +1,218 @@
+/*
+ * Copyright (C) 2007-2013 Hypertable, Inc.
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 3 of the
+ * License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+/** @file
+ * Definitions for CellStoreBlockCompressor.
+ * This file contains the method definitions for CellStoreBlockCompressor, a
+ * class that compresses cell store blocks on a pool of worker threads and
+ * hands them back in submission order.
+ */
+
+#include "Common/Compat.h"
+
+#include <algorithm>
+
+#include <boost/bind.hpp>
+
+#include "Common/Error.h"
+#include "Common/FailureInducer.h"
+#include "Common/Filesystem.h"
+#include "Common/Logger.h"
+
+#include "Hypertable/Lib/BlockCompressionHeader.h"
+#include "Hypertable/Lib/CompressorFactory.h"
+
+#include "CellStoreBlockCompressor.h"
+
+using namespace Hypertable;
+
+Mutex CellStoreBlockCompressor::ms_mutex;
+size_t CellStoreBlockCompressor::ms_thread_limit = (size_t)-1;
+size_t CellStoreBlockCompressor::ms_threads_in_use = 0;
+
+CellStoreBlockCompressor::CellStoreBlockCompressor(
+    BlockCompressionCodec::Type type, const BlockCompressionCodec::Args &args,
+    size_t thread_count, size_t max_in_flight,
+    BlockCompressionDictionaryPtr dictionary)
+  : m_max_in_flight(std::max(max_in_flight, (size_t)1)), m_shutdown(false),
+    m_thread_count(0), m_inline_codec(0) {
+  HT_ASSERT(thread_count > 0);
+
+  {
+    ScopedLock lock(ms_mutex);
+    if (ms_threads_in_use < ms_thread_limit)
+      m_thread_count = std::min(thread_count,
+                                ms_thread_limit - ms_threads_in_use);
+    ms_threads_in_use += m_thread_count;
+  }
+
+  if (m_thread_count == 0) {
+    m_inline_codec = CompressorFactory::create_block_codec(type, args);
+    if (dictionary)
+      m_inline_codec->set_dictionary(dictionary);
+  }
+
+  for (size_t i=0; i<m_thread_count; i++) {
+    BlockCompressionCodec *codec =
+      CompressorFactory::create_block_codec(type, args);
+    if (dictionary)
+      codec->set_dictionary(dictionary);
+    m_threads.create_thread(boost::bind(&CellStoreBlockCompressor::worker,
+                                        this, codec));
+  }
+}
+
+
+CellStoreBlockCompressor::~CellStoreBlockCompressor() {
+  {
+    ScopedLock lock(m_mutex);
+    m_shutdown = true;
+    m_work_cond.notify_all();
+  }
+  m_threads.join_all();
+  foreach_ht (Job *job, m_jobs)
+    delete job;
+  delete m_inline_codec;
+
+  ScopedLock lock(ms_mutex);
+  ms_threads_in_use -= m_thread_count;
+}
+
+
+void CellStoreBlockCompressor::set_thread_limit(size_t limit) {
+  ScopedLock lock(ms_mutex);
+  ms_thread_limit = limit;
+}
+
+
+size_t CellStoreBlockCompressor::threads_in_use() {
+  ScopedLock lock(ms_mutex);
+  return ms_threads_in_use;
+}
+
+
+bool CellStoreBlockCompressor::full() {
+  ScopedLock lock(m_mutex);
+  return m_jobs.size() >= m_max_in_flight;
+}
+
+
+void CellStoreBlockCompressor::submit(DynamicBuffer &block,
+                                      const char *magic) {
+  Job *job = new Job();
+  swap(job->input, block);
+  job->magic = magic;
+
+  if (m_inline_codec) {
+    compress(m_inline_codec, job);
+    job->done = true;
+  }
+
+  ScopedLock lock(m_mutex);
+  while (m_jobs.size() >= m_max_in_flight)
+    m_done_cond.wait(lock);
+  m_jobs.push_back(job);
+  if (!job->done) {
+    m_pending.push_back(job);
+    m_work_cond.notify_one();
+  }
+}
+
+
+bool CellStoreBlockCompressor::next(DynamicBuffer &zblock,
+                                    size_t *uncompressed_length, bool wait) {
+  Job *job;
+  {
+    ScopedLock lock(m_mutex);
+    if (m_jobs.empty())
+      return false;
+    while (!m_jobs.front()->done) {
+      if (!wait)
+        return false;
+      m_done_cond.wait(lock);
+    }
+    job = m_jobs.front();
+    m_jobs.pop_front();
+    m_done_cond.notify_all();
+  }
+
+  if (job->error != Error::OK) {
+    int error = job->error;
+    String msg = job->error_msg;
+    delete job;
+    HT_THROW(error, msg);
+  }
+
+  *uncompressed_length = job->input.fill();
+  swap(zblock, job->output);
+  delete job;
+  return true;
+}
+
+
+void CellStoreBlockCompressor::worker(BlockCompressionCodec *codec) {
+  Job *job;
+
+  while (true) {
+    {
+      ScopedLock lock(m_mutex);
+      while (m_pending.empty() && !m_shutdown)
+        m_work_cond.wait(lock);
+      if (m_shutdown)
+        break;
+      job = m_pending.front();
+      m_pending.pop_front();
+    }
+
+    compress(codec, job);
+
+    {
+      ScopedLock lock(m_mutex);
+      job->done = true;
+      m_done_cond.notify_all();
+    }
+  }
+
+  delete codec;
+}
+
+
+void CellStoreBlockCompressor::compress(BlockCompressionCodec *codec,
+                                        Job *job) {
+  try {
+    HT_MAYBE_FAIL("cellstore-block-compress");
+    BlockCompressionHeader header(job->magic);
+    codec->deflate(job->input, job->output, header, HT_DIRECT_IO_ALIGNMENT);
+  }
+  catch (Exception &e) {
+    job->error = e.code();
+    job->error_msg = e.what();
+  }
+}
+
+
+void CellStoreBlockCompressor::swap(DynamicBuffer &a, DynamicBuffer &b) {
+  std::swap(a.base, b.base);
+  std::swap(a.ptr, b.ptr);
+  std::swap(a.mark, b.mark);
+  std::swap(a.size, b.size);
+  std::swap(a.own, b.own);
+}
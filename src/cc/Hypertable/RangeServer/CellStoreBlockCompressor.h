@@ -0,0 +1,173 @@
+/*
+ * Copyright (C) 2007-2013 Hypertable, Inc.
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 3 of the
+ * License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+/** @file
+ * Declarations for CellStoreBlockCompressor.
+ * This file contains the type declarations for CellStoreBlockCompressor, a
+ * class that compresses cell store blocks on a pool of worker threads and
+ * hands them back in submission order.
+ */
+
+#ifndef HYPERTABLE_CELLSTOREBLOCKCOMPRESSOR_H
+#define HYPERTABLE_CELLSTOREBLOCKCOMPRESSOR_H
+
+#include <deque>
+
+#include <boost/noncopyable.hpp>
+#include <boost/thread/condition.hpp>
+
+#include "Common/DynamicBuffer.h"
+#include "Common/Mutex.h"
+#include "Common/Thread.h"
+
+#include "Hypertable/Lib/BlockCompressionCodec.h"
+
+namespace Hypertable {
+
+  /** @addtogroup RangeServer
+   * @{
+   */
+
+  /** Compresses cell store blocks in parallel.  Blocks are submitted by a
+   * single writer thread with #submit and compressed by a private pool of
+   * worker threads, each with its own codec.  The writer collects the
+   * compressed blocks with #next in the order they were submitted, so the
+   * file layout and block index are identical to those produced by
+   * compressing inline.  The number of blocks in flight (submitted but not
+   * yet collected) is bounded; #submit waits for the oldest block to be
+   * collected when the limit is reached.
+   *
+   * Worker threads are drawn from a budget shared by all compressors in the
+   * process (see #set_thread_limit), so that many concurrent compactions
+   * don't each start their own pool.  A compressor that gets fewer threads
+   * than requested runs with what it gets; one that gets none compresses
+   * each block inline in #submit.
+   */
+  class CellStoreBlockCompressor : boost::noncopyable {
+  public:
+
+    /** Constructor.  Reserves up to <code>thread_count</code> threads
+     * from the process-wide budget and starts them.
+     * @param type Compression type
+     * @param args Compression codec arguments
+     * @param thread_count Number of worker threads wanted
+     * @param max_in_flight Maximum number of blocks in flight
+     * @param dictionary Compression dictionary, if any
+     */
+    CellStoreBlockCompressor(BlockCompressionCodec::Type type,
+                             const BlockCompressionCodec::Args &args,
+                             size_t thread_count, size_t max_in_flight,
+                             BlockCompressionDictionaryPtr dictionary = 0);
+
+    /** Destructor.  Stops and joins the worker threads, returns them to
+     * the process-wide budget and discards any uncollected blocks.
+     */
+    ~CellStoreBlockCompressor();
+
+    /** Sets the maximum number of worker threads that all compressors in
+     * the process may run at once.  Compressors already running keep
+     * their threads.
+     * @param limit Maximum number of compression threads
+     */
+    static void set_thread_limit(size_t limit);
+
+    /** Returns the number of worker threads currently running across all
+     * compressors.
+     */
+    static size_t threads_in_use();
+
+    /** Returns the number of worker threads this compressor runs.
+     */
+    size_t thread_count() const { return m_thread_count; }
+
+    /** Returns <i>true</i> if the in-flight limit has been reached, in
+     * which case the next call to #submit would block.  The writer should
+     * collect a block with #next first.
+     */
+    bool full();
+
+    /** Submits a block for compression.  Ownership of the block's memory
+     * is taken over; <code>block</code> is left empty.
+     * @param block Uncompressed block
+     * @param magic Block magic string for the compression header
+     */
+    void submit(DynamicBuffer &block, const char *magic);
+
+    /** Collects the next compressed block in submission order.
+     * @param zblock Receives the compressed block
+     * @param uncompressed_length Receives the uncompressed block length
+     * @param wait If <i>true</i>, waits for the block to be compressed,
+     * otherwise returns <i>false</i> if it has not been compressed yet
+     * @return <i>true</i> if a block was returned, <i>false</i> if no
+     * block is in flight (or, with <code>wait</code> false, none is ready)
+     * @throws Exception if compression of the block failed
+     */
+    bool next(DynamicBuffer &zblock, size_t *uncompressed_length, bool wait);
+
+  private:
+
+    /// One block being compressed
+    struct Job {
+      Job() : magic(0), done(false), error(0) { }
+      DynamicBuffer input;
+      DynamicBuffer output;
+      const char *magic;
+      bool done;
+      int error;
+      String error_msg;
+    };
+
+    /// Worker thread function
+    void worker(BlockCompressionCodec *codec);
+
+    /// Compresses a job's input into its output
+    static void compress(BlockCompressionCodec *codec, Job *job);
+
+    static void swap(DynamicBuffer &a, DynamicBuffer &b);
+
+    /// Protects #ms_thread_limit and #ms_threads_in_use
+    static Mutex ms_mutex;
+    /// Maximum number of worker threads across all compressors
+    static size_t ms_thread_limit;
+    /// Number of worker threads running across all compressors
+    static size_t ms_threads_in_use;
+
+    Mutex m_mutex;
+    boost::condition m_work_cond;
+    boost::condition m_done_cond;
+    /// Jobs in submission order (collected from the front)
+    std::deque<Job *> m_jobs;
+    /// Jobs waiting for a worker
+    std::deque<Job *> m_pending;
+    size_t m_max_in_flight;
+    bool m_shutdown;
+    /// Number of worker threads reserved from the process-wide budget
+    size_t m_thread_count;
+    /// Codec for inline compression when no worker thread was reserved
+    BlockCompressionCodec *m_inline_codec;
+    ThreadGroup m_threads;
+  };
+
+  /** @}*/
+
+} // namespace Hypertable
+
+#endif // HYPERTABLE_CELLSTOREBLOCKCOMPRESSOR_H
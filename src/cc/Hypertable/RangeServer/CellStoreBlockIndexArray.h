@@ -29,9 +29,11 @@
 #ifndef HYPERTABLE_CELLSTOREBLOCKINDEXARRAY_H
 #define HYPERTABLE_CELLSTOREBLOCKINDEXARRAY_H
 
+#include <algorithm>
 #include <cassert>
 #include <iostream>
 #include <map>
+#include <vector>
 
 #include "Common/StaticBuffer.h"
 
@@ -94,8 +96,20 @@ namespace Hypertable {
     ArrayIteratorT m_iter;
   };
 
-  /**
+  /** Block index for a CellStore, held in a sorted array.
+   * To speed up lookups, the leading bytes of every key are kept inline in a
+   * contiguous array of 64-bit <i>prefixes</i>, alongside a small summary
+   * array holding every <code>SUMMARY_FANOUT</code>th prefix.  Searches first
+   * locate the right group of entries in the summary (which is small
+   * enough to stay in cache) and then binary search the prefixes of that
+   * group.  A comparison only dereferences the key data when the prefixes
+   * cannot decide it.
    *
+   * A prefix holds up to seven bytes of key data in its upper bytes (most
+   * significant first, so that integer order matches <code>memcmp</code>
+   * order) and the number of bytes held in its lowest byte.  Only bytes
+   * that take part in every comparison of the key (i.e. excluding the
+   * timestamp and revision; see SerializedKey::compare) are copied.
    */
   template <typename OffsetT>
   class CellStoreBlockIndexArray {
@@ -186,6 +200,8 @@ namespace Hypertable {
         m_middle_key = m_array[mid_point].key;
       }
 
+      build_prefixes();
+
       // Free variable buf here to maintain original semantics
       variable.free();
 
@@ -373,7 +389,8 @@ namespace Hypertable {
     }
 
     size_t memory_used() {
-      return m_keydata.size + (m_array.size() * (sizeof(ElementT)));
+      return m_keydata.size + (m_array.size() * (sizeof(ElementT))) +
+        ((m_prefixes.size() + m_summary.size()) * sizeof(uint64_t));
     }
 
     int64_t disk_used() { return m_disk_used; }
@@ -396,24 +413,137 @@ namespace Hypertable {
     }
 
     iterator lower_bound(const SerializedKey& k) {
-      ElementT ee(k);
-      return iterator(std::lower_bound(m_array.begin(), m_array.end(), ee, LtT()));
+      return iterator(m_array.begin() + search<false>(k));
     }
 
     iterator upper_bound(const SerializedKey& k) {
-      ElementT ee(k);
-      return iterator(std::upper_bound(m_array.begin(), m_array.end(), ee, LtT()));
+      return iterator(m_array.begin() + search<true>(k));
     }
 
     void clear() {
       m_array.clear();
+      m_prefixes.clear();
+      m_summary.clear();
       m_keydata.free();
       m_middle_key.ptr = 0;
       m_maximum_entries = (OffsetT)-1;
     }
 
+    /// Number of index entries covered by each summary prefix
+    static const size_t SUMMARY_FANOUT = 32;
+
+    /** Computes the inline prefix of a key.
+     * @param key Serialized key
+     * @return Prefix of <code>key</code>
+     */
+    static uint64_t key_prefix(const SerializedKey &key) {
+      const uint8_t *ptr;
+      int len = key.decode_length(&ptr);
+      uint8_t control = *ptr++;
+      // Trailing timestamp may be skipped when compared (see SerializedKey)
+      if (control >= 0x80 && control != 0xD0)
+        len -= 8;
+      size_t n = (len > 1) ? std::min((size_t)len - 1, (size_t)7) : 0;
+      uint64_t prefix = 0;
+      for (size_t i=0; i<n; ++i)
+        prefix |= (uint64_t)ptr[i] << (56 - (i * 8));
+      return prefix | n;
+    }
+
+    /** Compares two key prefixes.
+     * @param p1 First prefix
+     * @param p2 Second prefix
+     * @return Negative if key of <code>p1</code> is less than key of
+     * <code>p2</code>, positive if it is greater, and 0 if the prefixes
+     * are not sufficient to decide
+     */
+    static int compare_prefix(uint64_t p1, uint64_t p2) {
+      uint64_t diff = (p1 ^ p2) >> 8;
+      if (diff == 0)
+        return 0;
+      // Index of first differing byte
+      size_t i = (__builtin_clzll(diff) - 8) / 8;
+      if (i >= (p1 & 0xFF) || i >= (p2 & 0xFF))
+        return 0;
+      return (p1 < p2) ? -1 : 1;
+    }
+
   private:
+
+    /** Checks if an entry precedes the search position.
+     * For a lower bound search an entry precedes the position if it is less
+     * than <code>key</code>, for an upper bound search if it is less than or
+     * equal to <code>key</code>.
+     * @param i Index of entry
+     * @param prefix Prefix of entry
+     * @param key Search key
+     * @param key_prefix Prefix of search key
+     */
+    template <bool UpperBound>
+    bool precedes(size_t i, uint64_t prefix, const SerializedKey &key,
+                  uint64_t key_prefix) {
+      int cmp = compare_prefix(prefix, key_prefix);
+      if (cmp == 0)
+        cmp = m_array[i].key.compare(key);
+      return UpperBound ? cmp <= 0 : cmp < 0;
+    }
+
+    /** Finds the index of the first entry that does not precede
+     * <code>key</code>.  The summary array is searched first to narrow the
+     * range down to one group of entries, which is then searched.
+     * @param key Search key
+     * @return Index of first entry not preceding <code>key</code>, or the
+     * number of entries if there is none
+     */
+    template <bool UpperBound>
+    size_t search(const SerializedKey &key) {
+      uint64_t kp = key_prefix(key);
+      size_t lo = 0, hi = m_summary.size(), mid;
+
+      while (lo < hi) {
+        mid = (lo + hi) / 2;
+        if (precedes<UpperBound>(mid*SUMMARY_FANOUT, m_summary[mid], key, kp))
+          lo = mid + 1;
+        else
+          hi = mid;
+      }
+
+      // Entry lo*SUMMARY_FANOUT does not precede key, entry
+      // (lo-1)*SUMMARY_FANOUT does
+      hi = std::min(lo * SUMMARY_FANOUT, m_prefixes.size());
+      lo = lo ? ((lo - 1) * SUMMARY_FANOUT) + 1 : 0;
+
+      while (lo < hi) {
+        mid = (lo + hi) / 2;
+        if (precedes<UpperBound>(mid, m_prefixes[mid], key, kp))
+          lo = mid + 1;
+        else
+          hi = mid;
+      }
+      return lo;
+    }
+
+    /// Rebuilds prefix and summary arrays from <code>m_array</code>
+    void build_prefixes() {
+      m_prefixes.clear();
+      m_summary.clear();
+      m_prefixes.reserve(m_array.size());
+      m_summary.reserve((m_array.size() + SUMMARY_FANOUT - 1) / SUMMARY_FANOUT);
+      for (size_t i=0; i<m_array.size(); ++i) {
+        m_prefixes.push_back(key_prefix(m_array[i].key));
+        if ((i % SUMMARY_FANOUT) == 0)
+          m_summary.push_back(m_prefixes.back());
+      }
+    }
+
     ArrayT m_array;
+
+    /// Inline key prefixes, one per entry of <code>m_array</code>
+    std::vector<uint64_t> m_prefixes;
+
+    /// Every <code>SUMMARY_FANOUT</code>th element of <code>m_prefixes</code>
+    std::vector<uint64_t> m_summary;
+
     StaticBuffer m_keydata;
     SerializedKey m_middle_key;
     OffsetT m_end_of_last_block;
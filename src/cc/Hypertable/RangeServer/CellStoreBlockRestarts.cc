@@ -0,0 +1,102 @@
+/*
+ * Copyright (C) 2007-2013 Hypertable, Inc.
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 3 of the
+ * License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+/** @file
+ * Definitions for CellStoreBlockRestarts.
+ * This file contains the method definitions for CellStoreBlockRestarts, a
+ * class for writing and searching the restart points of prefix compressed
+ * CellStore data blocks.
+ */
+
+#include "Common/Compat.h"
+#include "Common/Error.h"
+#include "Common/Logger.h"
+#include "Common/Serialization.h"
+
+#include "CellStoreBlockRestarts.h"
+
+using namespace Hypertable;
+using namespace Hypertable::Serialization;
+
+
+void CellStoreBlockRestarts::append(DynamicBuffer &block,
+                                    const std::vector<uint32_t> &offsets) {
+  block.ensure(4 * (offsets.size() + 1));
+  foreach_ht (uint32_t offset, offsets)
+    encode_i32(&block.ptr, offset);
+  encode_i32(&block.ptr, (uint32_t)offsets.size());
+}
+
+
+const uint8_t *CellStoreBlockRestarts::load(const uint8_t *base,
+                                            const uint8_t *end) {
+  const uint8_t *ptr;
+  size_t remaining = 4;
+
+  if (end - base < 4)
+    HT_THROW(Error::RANGESERVER_CORRUPT_CELLSTORE,
+             "Block too small for restart points");
+
+  ptr = end - 4;
+  m_count = decode_i32(&ptr, &remaining);
+  if ((size_t)(end - base) < 4 * ((size_t)m_count + 1))
+    HT_THROWF(Error::RANGESERVER_CORRUPT_CELLSTORE,
+              "Bad block restart point count %u", (unsigned)m_count);
+
+  m_base = base;
+  m_offsets = end - 4 * ((size_t)m_count + 1);
+
+  for (uint32_t i=0; i<m_count; i++) {
+    if (offset(i) >= (uint32_t)(m_offsets - m_base))
+      HT_THROWF(Error::RANGESERVER_CORRUPT_CELLSTORE,
+                "Bad block restart point offset %u", (unsigned)offset(i));
+  }
+
+  return m_offsets;
+}
+
+
+const uint8_t *CellStoreBlockRestarts::seek(KeyDecompressor *key_decompressor,
+                                            SerializedKey key) {
+  uint32_t lo = 0, hi = m_count;
+
+  // Restart point lo is always a valid starting point; find the last one
+  // whose key is less than the one being sought
+  while (hi - lo > 1) {
+    uint32_t mid = lo + (hi - lo) / 2;
+    key_decompressor->reset();
+    key_decompressor->add(m_base + offset(mid));
+    if (key_decompressor->less_than(key))
+      lo = mid;
+    else
+      hi = mid;
+  }
+
+  key_decompressor->reset();
+  return key_decompressor->add(m_base + (m_count ? offset(lo) : 0));
+}
+
+
+uint32_t CellStoreBlockRestarts::offset(uint32_t i) {
+  const uint8_t *ptr = m_offsets + 4*i;
+  size_t remaining = 4;
+  return decode_i32(&ptr, &remaining);
+}
@@ -0,0 +1,112 @@
+/*
+ * Copyright (C) 2007-2013 Hypertable, Inc.
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 3 of the
+ * License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+/** @file
+ * Declarations for CellStoreBlockRestarts.
+ * This file contains the type declarations for CellStoreBlockRestarts, a
+ * class for writing and searching the restart points of prefix compressed
+ * CellStore data blocks.
+ */
+
+#ifndef HYPERTABLE_CELLSTOREBLOCKRESTARTS_H
+#define HYPERTABLE_CELLSTOREBLOCKRESTARTS_H
+
+#include <vector>
+
+#include "Common/DynamicBuffer.h"
+
+#include "Hypertable/Lib/SerializedKey.h"
+
+#include "KeyDecompressor.h"
+
+namespace Hypertable {
+
+  /** @addtogroup RangeServer
+   * @{
+   */
+
+  /** Restart points of a prefix compressed data block.
+   * A restart point is a key that is stored without a prefix shared with
+   * the previous key, so decompression can begin there.  The writer emits
+   * one every <code>Hypertable.RangeServer.CellStore.RestartInterval</code>
+   * entries and appends their offsets to the block:
+   * <pre>
+   *   entries
+   *   i32 offset[count]   (offset of each restart point from block start)
+   *   i32 count
+   * </pre>
+   * Scanners binary search the restart points to find where to start
+   * decompressing instead of decompressing every key in front of the one
+   * they are looking for.  The key region of a columnar block carries the
+   * entry numbers of its restart points in the same layout, since their
+   * offsets are only known once the block has been expanded.
+   */
+  class CellStoreBlockRestarts {
+  public:
+
+    CellStoreBlockRestarts() : m_base(0), m_offsets(0), m_count(0) { }
+
+    /** Appends restart point offsets to a block.
+     * @param block Block entries
+     * @param offsets Offsets of the restart points within <code>block</code>
+     */
+    static void append(DynamicBuffer &block,
+                       const std::vector<uint32_t> &offsets);
+
+    /** Loads the restart points of a block.
+     * @param base Pointer to beginning of block
+     * @param end Pointer to end of block, including the restart points
+     * @return Pointer to end of the block entries
+     */
+    const uint8_t *load(const uint8_t *base, const uint8_t *end);
+
+    /** Positions a key decompressor at the last restart point whose key is
+     * less than <code>key</code>, or at the first entry of the block if
+     * there is none.
+     * @param key_decompressor Key decompressor
+     * @param key Key to search for
+     * @return Pointer to the value of the entry the decompressor is on
+     */
+    const uint8_t *seek(KeyDecompressor *key_decompressor, SerializedKey key);
+
+    /// Returns the number of restart points
+    uint32_t count() { return m_count; }
+
+    /// Returns the offset of restart point <code>i</code>
+    uint32_t offset(uint32_t i);
+
+  private:
+
+    /// Beginning of block
+    const uint8_t *m_base;
+
+    /// Restart point offset array
+    const uint8_t *m_offsets;
+
+    /// Number of restart points
+    uint32_t m_count;
+  };
+
+  /** @}*/
+
+}
+
+#endif // HYPERTABLE_CELLSTOREBLOCKRESTARTS_H
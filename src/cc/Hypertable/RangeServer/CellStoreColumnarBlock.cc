@@ -0,0 +1,463 @@
+/*
+ * Copyright (C) 2007-2013 Hypertable, Inc.
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 3 of the
+ * License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+/** @file
+ * Definitions for CellStoreColumnarBlock.
+ * This file contains the method definitions for the classes that encode
+ * and decode the columnar data blocks of CellStoreV6.
+ */
+
+#include "Common/Compat.h"
+
+#include <algorithm>
+
+#include <strings.h>
+
+#include "Common/Error.h"
+#include "Common/Logger.h"
+#include "Common/Serialization.h"
+
+#include "Hypertable/Lib/Key.h"
+
+#include "CellStoreBlockRestarts.h"
+#include "CellStoreColumnarBlock.h"
+
+using namespace Hypertable;
+using namespace Hypertable::Serialization;
+
+namespace {
+
+  enum { ALL_FIXED = 1 };
+
+  inline uint64_t zigzag_encode(int64_t value) {
+    return ((uint64_t)value << 1) ^ (uint64_t)(value >> 63);
+  }
+
+  inline int64_t zigzag_decode(uint64_t value) {
+    return (int64_t)(value >> 1) ^ -(int64_t)(value & 1);
+  }
+
+  /// Writes the low <code>bits</code> bits of <code>value</code> into a
+  /// zeroed buffer at bit position <code>offset</code>
+  inline void write_bits(uint8_t *base, uint64_t offset, uint64_t value,
+                         uint32_t bits) {
+    while (bits) {
+      uint32_t shift = offset & 7;
+      uint32_t n = std::min(8 - shift, bits);
+      base[offset >> 3] |= (uint8_t)((value & ((1u << n) - 1)) << shift);
+      value >>= n;
+      bits -= n;
+      offset += n;
+    }
+  }
+
+  inline uint64_t read_bits(const uint8_t *base, uint64_t offset,
+                            uint32_t bits) {
+    uint64_t value = 0;
+    uint32_t done = 0;
+    while (done < bits) {
+      uint32_t shift = offset & 7;
+      uint32_t n = std::min(8 - shift, bits - done);
+      value |= (uint64_t)((base[offset >> 3] >> shift) & ((1u << n) - 1))
+        << done;
+      done += n;
+      offset += n;
+    }
+    return value;
+  }
+
+}
+
+
+ValueEncoding::Type ValueEncoding::parse(const String &name) {
+  if (name.empty() || !strcasecmp(name.c_str(), "none"))
+    return NONE;
+  if (!strcasecmp(name.c_str(), "delta"))
+    return DELTA;
+  if (!strcasecmp(name.c_str(), "for"))
+    return FRAME_OF_REFERENCE;
+  if (!strcasecmp(name.c_str(), "rle"))
+    return RUN_LENGTH;
+  HT_THROWF(Error::SCHEMA_PARSE_ERROR, "Unknown value encoding '%s'",
+            name.c_str());
+}
+
+
+const char *ValueEncoding::to_string(Type type) {
+  switch (type) {
+  case NONE:               return "none";
+  case DELTA:              return "delta";
+  case FRAME_OF_REFERENCE: return "for";
+  case RUN_LENGTH:         return "rle";
+  }
+  return "unknown";
+}
+
+
+void ValueStreamEncoder::add(const ByteString value) {
+  const uint8_t *ptr;
+  size_t len = value.decode_length(&ptr);
+  size_t total = (ptr - value.ptr) + len;
+
+  m_raw_length += total;
+
+  if (len == 8) {
+    size_t remaining = 8;
+    m_fixed_flags.push_back(true);
+    m_fixed.push_back((int64_t)decode_i64(&ptr, &remaining));
+  }
+  else {
+    m_fixed_flags.push_back(false);
+    m_exceptions.ensure(total);
+    m_exceptions.add_unchecked(value.ptr, total);
+  }
+}
+
+
+void ValueStreamEncoder::encode(DynamicBuffer &dst) {
+  uint32_t count = (uint32_t)m_fixed_flags.size();
+  size_t nfixed = m_fixed.size();
+  bool all_fixed = nfixed == count;
+  size_t bitmap_len = all_fixed ? 0 : (count + 7) / 8;
+
+  // Worst case for each encoding
+  dst.ensure(1 + 5 + 1 + bitmap_len + 5 + m_exceptions.fill() +
+             9 + nfixed * 13);
+
+  encode_i8(&dst.ptr, (uint8_t)m_type);
+  encode_vi32(&dst.ptr, count);
+  encode_i8(&dst.ptr, all_fixed ? ALL_FIXED : 0);
+
+  if (!all_fixed) {
+    memset(dst.ptr, 0, bitmap_len);
+    for (uint32_t i=0; i<count; i++) {
+      if (m_fixed_flags[i])
+        dst.ptr[i >> 3] |= (uint8_t)(1 << (i & 7));
+    }
+    dst.ptr += bitmap_len;
+  }
+
+  encode_vi32(&dst.ptr, (uint32_t)m_exceptions.fill());
+  dst.add_unchecked(m_exceptions.base, m_exceptions.fill());
+
+  switch (m_type) {
+
+  case ValueEncoding::DELTA:
+    {
+      int64_t prev = 0;
+      foreach_ht (int64_t value, m_fixed) {
+        encode_vi64(&dst.ptr, zigzag_encode((int64_t)((uint64_t)value -
+                                                      (uint64_t)prev)));
+        prev = value;
+      }
+    }
+    break;
+
+  case ValueEncoding::FRAME_OF_REFERENCE:
+    {
+      int64_t base = nfixed ? *std::min_element(m_fixed.begin(), m_fixed.end())
+                            : 0;
+      uint64_t max_offset = 0;
+      foreach_ht (int64_t value, m_fixed)
+        max_offset = std::max(max_offset, (uint64_t)value - (uint64_t)base);
+      uint32_t bits = 0;
+      while (bits < 64 && (max_offset >> bits) != 0)
+        bits++;
+      encode_i64(&dst.ptr, (uint64_t)base);
+      encode_i8(&dst.ptr, (uint8_t)bits);
+      size_t packed_len = (nfixed * bits + 7) / 8;
+      memset(dst.ptr, 0, packed_len);
+      uint64_t offset = 0;
+      foreach_ht (int64_t value, m_fixed) {
+        write_bits(dst.ptr, offset, (uint64_t)value - (uint64_t)base, bits);
+        offset += bits;
+      }
+      dst.ptr += packed_len;
+    }
+    break;
+
+  case ValueEncoding::RUN_LENGTH:
+    for (size_t i=0; i<nfixed; ) {
+      size_t j = i + 1;
+      while (j < nfixed && m_fixed[j] == m_fixed[i])
+        j++;
+      encode_vi32(&dst.ptr, (uint32_t)(j - i));
+      encode_i64(&dst.ptr, (uint64_t)m_fixed[i]);
+      i = j;
+    }
+    break;
+
+  default:
+    HT_FATALF("Bad value encoding %d", (int)m_type);
+  }
+}
+
+
+void ValueStreamEncoder::clear() {
+  m_fixed_flags.clear();
+  m_fixed.clear();
+  m_exceptions.clear();
+  m_raw_length = 0;
+}
+
+
+void ValueStreamDecoder::load(const uint8_t *base, size_t len) {
+  const uint8_t *ptr = base;
+  size_t remaining = len;
+
+  m_type = (ValueEncoding::Type)decode_i8(&ptr, &remaining);
+  m_count = decode_vi32(&ptr, &remaining);
+  uint8_t flags = decode_i8(&ptr, &remaining);
+  m_index = 0;
+
+  if (flags & ALL_FIXED)
+    m_bitmap = 0;
+  else {
+    size_t bitmap_len = (m_count + 7) / 8;
+    if (bitmap_len > remaining)
+      HT_THROW(Error::RANGESERVER_CORRUPT_CELLSTORE,
+               "Truncated value stream bitmap");
+    m_bitmap = ptr;
+    ptr += bitmap_len;
+    remaining -= bitmap_len;
+  }
+
+  uint32_t exceptions_len = decode_vi32(&ptr, &remaining);
+  if (exceptions_len > remaining)
+    HT_THROW(Error::RANGESERVER_CORRUPT_CELLSTORE,
+             "Truncated value stream exceptions");
+  m_exception_ptr = ptr;
+  m_exception_end = ptr + exceptions_len;
+  ptr += exceptions_len;
+  remaining -= exceptions_len;
+
+  m_value = 0;
+  m_bits = 0;
+  m_bit_offset = 0;
+  m_run = 0;
+
+  switch (m_type) {
+  case ValueEncoding::DELTA:
+  case ValueEncoding::RUN_LENGTH:
+    break;
+  case ValueEncoding::FRAME_OF_REFERENCE:
+    m_value = (int64_t)decode_i64(&ptr, &remaining);
+    m_bits = decode_i8(&ptr, &remaining);
+    if (m_bits > 64)
+      HT_THROWF(Error::RANGESERVER_CORRUPT_CELLSTORE,
+                "Bad value stream bit width %u", (unsigned)m_bits);
+    break;
+  default:
+    HT_THROWF(Error::RANGESERVER_CORRUPT_CELLSTORE,
+              "Unknown value stream encoding %d", (int)m_type);
+  }
+
+  m_ptr = ptr;
+  m_end = ptr + remaining;
+}
+
+
+void ValueStreamDecoder::next(DynamicBuffer &dst) {
+  if (m_index >= m_count)
+    HT_THROW(Error::RANGESERVER_CORRUPT_CELLSTORE,
+             "Value stream exhausted");
+
+  bool fixed = m_bitmap == 0 || (m_bitmap[m_index >> 3] & (1 << (m_index & 7)));
+  m_index++;
+
+  if (fixed) {
+    int64_t value = next_fixed();
+    dst.ensure(9);
+    *dst.ptr++ = 8;
+    encode_i64(&dst.ptr, (uint64_t)value);
+  }
+  else {
+    const uint8_t *ptr;
+    ByteString exception(m_exception_ptr);
+    if (m_exception_ptr >= m_exception_end)
+      HT_THROW(Error::RANGESERVER_CORRUPT_CELLSTORE,
+               "Value stream exceptions exhausted");
+    size_t len = exception.decode_length(&ptr);
+    len += ptr - m_exception_ptr;
+    if (m_exception_ptr + len > m_exception_end)
+      HT_THROW(Error::RANGESERVER_CORRUPT_CELLSTORE,
+               "Truncated value stream exception");
+    dst.ensure(len);
+    dst.add_unchecked(m_exception_ptr, len);
+    m_exception_ptr += len;
+  }
+}
+
+
+int64_t ValueStreamDecoder::next_fixed() {
+  size_t remaining = m_end - m_ptr;
+
+  switch (m_type) {
+
+  case ValueEncoding::DELTA:
+    m_value = (int64_t)((uint64_t)m_value +
+                        (uint64_t)zigzag_decode(decode_vi64(&m_ptr, &remaining)));
+    return m_value;
+
+  case ValueEncoding::FRAME_OF_REFERENCE:
+    {
+      if (((m_bit_offset + m_bits + 7) >> 3) > remaining)
+        HT_THROW(Error::RANGESERVER_CORRUPT_CELLSTORE,
+                 "Truncated value stream");
+      uint64_t offset = read_bits(m_ptr, m_bit_offset, m_bits);
+      m_bit_offset += m_bits;
+      return (int64_t)((uint64_t)m_value + offset);
+    }
+
+  case ValueEncoding::RUN_LENGTH:
+    if (m_run == 0) {
+      m_run = decode_vi32(&m_ptr, &remaining);
+      m_value = (int64_t)decode_i64(&m_ptr, &remaining);
+      if (m_run == 0)
+        HT_THROW(Error::RANGESERVER_CORRUPT_CELLSTORE,
+                 "Empty run in value stream");
+    }
+    m_run--;
+    return m_value;
+
+  default:
+    break;
+  }
+  HT_THROWF(Error::RANGESERVER_CORRUPT_CELLSTORE,
+            "Unknown value stream encoding %d", (int)m_type);
+}
+
+
+void
+CellStoreColumnarBlock::assemble(DynamicBuffer &keys,
+                                 std::vector<ValueStreamEncoder *> &encoders,
+                                 DynamicBuffer &dst) {
+  DynamicBuffer streams;
+  std::vector<std::pair<uint8_t, size_t> > directory;
+
+  for (size_t family=0; family<encoders.size(); family++) {
+    if (encoders[family] == 0 || encoders[family]->count() == 0)
+      continue;
+    size_t start = streams.fill();
+    encoders[family]->encode(streams);
+    encoders[family]->clear();
+    directory.push_back(std::make_pair((uint8_t)family,
+                                       streams.fill() - start));
+  }
+
+  dst.clear();
+  dst.ensure(5 + 1 + directory.size()*6 + keys.fill() + streams.fill());
+
+  encode_vi32(&dst.ptr, (uint32_t)keys.fill());
+  encode_i8(&dst.ptr, (uint8_t)directory.size());
+  for (size_t i=0; i<directory.size(); i++) {
+    encode_i8(&dst.ptr, directory[i].first);
+    encode_vi32(&dst.ptr, (uint32_t)directory[i].second);
+  }
+  dst.add_unchecked(keys.base, keys.fill());
+  dst.add_unchecked(streams.base, streams.fill());
+}
+
+
+void
+CellStoreColumnarBlock::expand(const DynamicBuffer &block,
+                               KeyDecompressor *key_decompressor,
+                               DynamicBuffer &dst, bool keys_only,
+                               bool restarts) {
+  const uint8_t *ptr = block.base;
+  size_t remaining = block.fill();
+  int16_t stream_index[256];
+
+  uint32_t keys_len = decode_vi32(&ptr, &remaining);
+  size_t stream_count = decode_i8(&ptr, &remaining);
+  std::vector<size_t> stream_lengths(stream_count);
+
+  memset(stream_index, 0xff, sizeof(stream_index));
+  for (size_t i=0; i<stream_count; i++) {
+    stream_index[decode_i8(&ptr, &remaining)] = (int16_t)i;
+    stream_lengths[i] = decode_vi32(&ptr, &remaining);
+  }
+
+  if (keys_len > remaining)
+    HT_THROW(Error::RANGESERVER_CORRUPT_CELLSTORE,
+             "Truncated columnar block key region");
+
+  const uint8_t *keys_end = ptr + keys_len;
+  std::vector<ValueStreamDecoder> decoders(stream_count);
+
+  if (!keys_only) {
+    const uint8_t *stream = keys_end;
+    size_t stream_remaining = remaining - keys_len;
+    for (size_t i=0; i<stream_count; i++) {
+      if (stream_lengths[i] > stream_remaining)
+        HT_THROW(Error::RANGESERVER_CORRUPT_CELLSTORE,
+                 "Truncated columnar block value stream");
+      decoders[i].load(stream, stream_lengths[i]);
+      stream += stream_lengths[i];
+      stream_remaining -= stream_lengths[i];
+    }
+  }
+
+  dst.clear();
+  dst.reserve(block.fill() * 2);
+
+  Key key;
+  const uint8_t *next;
+  CellStoreBlockRestarts restart_entries;
+  std::vector<uint32_t> restart_offsets;
+  uint32_t entry = 0;
+
+  if (restarts)
+    keys_end = restart_entries.load(ptr, keys_end);
+
+  key_decompressor->reset();
+  while (ptr < keys_end) {
+    if (restart_offsets.size() < restart_entries.count() &&
+        restart_entries.offset(restart_offsets.size()) == entry)
+      restart_offsets.push_back((uint32_t)dst.fill());
+    entry++;
+    next = key_decompressor->add(ptr);
+    dst.ensure(next - ptr);
+    dst.add_unchecked(ptr, next - ptr);
+    key_decompressor->load(key);
+    int16_t index = stream_index[key.column_family_code];
+    if (index >= 0 && key.flag == FLAG_INSERT) {
+      if (keys_only) {
+        dst.ensure(1);
+        *dst.ptr++ = 0;
+      }
+      else
+        decoders[index].next(dst);
+      ptr = next;
+    }
+    else {
+      ByteString value(next);
+      size_t len = value.length();
+      dst.ensure(len);
+      dst.add_unchecked(next, len);
+      ptr = next + len;
+    }
+  }
+  key_decompressor->reset();
+
+  if (restarts)
+    CellStoreBlockRestarts::append(dst, restart_offsets);
+}
@@ -0,0 +1,202 @@
+/*
+ * Copyright (C) 2007-2013 Hypertable, Inc.
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 3 of the
+ * License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+/** @file
+ * Declarations for CellStoreColumnarBlock.
+ * This file contains the type declarations for the classes that encode
+ * and decode the columnar data blocks of CellStoreV6, in which the values
+ * of selected column families are stored as separate, encoded streams.
+ */
+
+#ifndef HYPERTABLE_CELLSTORECOLUMNARBLOCK_H
+#define HYPERTABLE_CELLSTORECOLUMNARBLOCK_H
+
+#include <vector>
+
+#include "Common/ByteString.h"
+#include "Common/DynamicBuffer.h"
+#include "Common/String.h"
+
+#include "KeyDecompressor.h"
+
+namespace Hypertable {
+
+  /** @addtogroup RangeServer
+   * @{
+   */
+
+  /// Value stream encodings
+  namespace ValueEncoding {
+    enum Type {
+      /// Values stored inline with their keys
+      NONE = 0,
+      /// Zigzag varint deltas between consecutive values
+      DELTA = 1,
+      /// Bit-packed offsets from the minimum value of the block
+      FRAME_OF_REFERENCE = 2,
+      /// Runs of equal values
+      RUN_LENGTH = 3
+    };
+
+    /** Returns the encoding named by a schema <code>ValueEncoding</code>
+     * option ("none", "delta", "for" or "rle", case insensitive).
+     * @throws Exception if the name is not recognized
+     */
+    Type parse(const String &name);
+
+    /// Returns the schema name of an encoding
+    const char *to_string(Type type);
+  }
+
+  /** Accumulates the values of one column family within a block and
+   * encodes them as a value stream.  The encodings apply to 8-byte values
+   * (counters and other fixed-width integers), which are interpreted as
+   * little-endian 64-bit integers, the format counter values are stored
+   * in.  Values of any other length (e.g. deletes or counter resets) are
+   * stored verbatim as exceptions.
+   *
+   * Stream layout:
+   * <pre>
+   *   encoding        u8
+   *   count           vi32
+   *   flags           u8   (ALL_FIXED: every value is 8 bytes)
+   *   fixed bitmap    ceil(count/8) bytes, omitted if ALL_FIXED
+   *   exceptions      vi32 length + concatenated serialized values
+   *   fixed values    encoding specific
+   * </pre>
+   */
+  class ValueStreamEncoder {
+  public:
+    /// Constructor.
+    ValueStreamEncoder(ValueEncoding::Type type)
+      : m_type(type), m_exceptions(0), m_raw_length(0) { }
+
+    /// Adds a serialized value
+    void add(const ByteString value);
+
+    /// Returns the number of values added since the last #clear
+    size_t count() const { return m_fixed_flags.size(); }
+
+    /// Returns the serialized length of the values added
+    size_t raw_length() const { return m_raw_length; }
+
+    /// Appends the encoded stream to <code>dst</code>
+    void encode(DynamicBuffer &dst);
+
+    /// Removes all values
+    void clear();
+
+  private:
+    ValueEncoding::Type m_type;
+    std::vector<bool> m_fixed_flags;
+    std::vector<int64_t> m_fixed;
+    DynamicBuffer m_exceptions;
+    size_t m_raw_length;
+  };
+
+  /** Decodes a value stream written by ValueStreamEncoder, one value at
+   * a time.
+   */
+  class ValueStreamDecoder {
+  public:
+    /** Loads a stream.
+     * @param base Start of stream
+     * @param len Length of stream
+     * @throws Exception if the stream is malformed
+     */
+    void load(const uint8_t *base, size_t len);
+
+    /** Appends the next value, serialized, to <code>dst</code>.
+     * @throws Exception if the stream has no more values
+     */
+    void next(DynamicBuffer &dst);
+
+  private:
+    int64_t next_fixed();
+
+    ValueEncoding::Type m_type;
+    uint32_t m_count;
+    uint32_t m_index;
+    const uint8_t *m_bitmap;
+    const uint8_t *m_exception_ptr;
+    const uint8_t *m_exception_end;
+    const uint8_t *m_ptr;
+    const uint8_t *m_end;
+    /// Previous value (DELTA), frame base (FRAME_OF_REFERENCE) or run
+    /// value (RUN_LENGTH)
+    int64_t m_value;
+    /// Bit width (FRAME_OF_REFERENCE)
+    uint32_t m_bits;
+    /// Bit position (FRAME_OF_REFERENCE)
+    uint64_t m_bit_offset;
+    /// Values left in the current run (RUN_LENGTH)
+    uint32_t m_run;
+  };
+
+  /** Assembles and expands columnar data blocks.  A columnar block
+   * consists of the block's keys, prefix compressed as in a regular data
+   * block but without the values of encoded column families, followed by
+   * one value stream per encoded column family:
+   * <pre>
+   *   key region length   vi32
+   *   stream count        u8
+   *   per stream          column family (u8), stream length (vi32)
+   *   key region
+   *   streams
+   * </pre>
+   * Readers expand a columnar block into the regular block layout right
+   * after decompressing it, so the scanners and the block cache are
+   * unaware of the format.
+   */
+  class CellStoreColumnarBlock {
+  public:
+
+    /** Builds a columnar block.
+     * @param keys Key region (keys, and values of families not encoded)
+     * @param encoders Value stream encoders indexed by column family;
+     * families without values in the block are skipped
+     * @param dst Receives the block
+     */
+    static void assemble(DynamicBuffer &keys,
+                         std::vector<ValueStreamEncoder *> &encoders,
+                         DynamicBuffer &dst);
+
+    /** Expands a columnar block into the regular block layout.
+     * @param block Columnar block
+     * @param key_decompressor Key decompressor (reset on return)
+     * @param dst Receives the expanded block
+     * @param keys_only If <i>true</i>, the value streams are not decoded
+     * and the values of encoded families are left empty
+     * @param restarts If <i>true</i>, the key region ends with the entry
+     * numbers of the restart points, and their offsets in the expanded
+     * block are appended to it (see CellStoreBlockRestarts)
+     */
+    static void expand(const DynamicBuffer &block,
+                       KeyDecompressor *key_decompressor,
+                       DynamicBuffer &dst, bool keys_only=false,
+                       bool restarts=false);
+  };
+
+  /** @}*/
+
+} // namespace Hypertable
+
+#endif // HYPERTABLE_CELLSTORECOLUMNARBLOCK_H
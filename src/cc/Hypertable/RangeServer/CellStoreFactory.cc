@@ -92,10 +92,13 @@ CellStore *CellStoreFactory::open(const String &name,
     fd = Global::dfs->open(name, 0);
   }
 
-  if (version == 6) {
+  if (version >= 6 && version <= 10) {
     CellStoreTrailerV6 trailer_v6;
     CellStoreV6 *cellstore_v6;
 
+    // Trailer length depends on version
+    trailer_v6.version = version;
+
     if (amount < trailer_v6.size())
       HT_THROWF(Error::RANGESERVER_CORRUPT_CELLSTORE,
                 "Bad length of CellStoreV6 file '%s' - %llu",
@@ -184,6 +184,13 @@ bool CellStoreScanner<IndexT>::get(Key &key, ByteString &value) {
   return false;
 }
 
+template <typename IndexT>
+CellMemoryPin *CellStoreScanner<IndexT>::get_pin() {
+  if (m_eos || m_keys_only)
+    return 0;
+  return m_interval_scanners[m_interval_index]->get_pin();
+}
+
 template <typename IndexT>
 uint64_t CellStoreScanner<IndexT>::get_disk_read() {
   uint64_t amount = 0;
@@ -41,6 +41,7 @@ namespace Hypertable {
     virtual ~CellStoreScanner();
     virtual void forward();
     virtual bool get(Key &key, ByteString &value);
+    virtual CellMemoryPin *get_pin();
 
     virtual uint64_t get_disk_read();
 
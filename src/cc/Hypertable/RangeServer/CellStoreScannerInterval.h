@@ -27,11 +27,14 @@
 
 namespace Hypertable {
 
+  class CellMemoryPin;
+
   class CellStoreScannerInterval {
   public:
     CellStoreScannerInterval() : m_disk_read(0) { }
     virtual void forward() = 0;
     virtual bool get(Key &key, ByteString &value) = 0;
+    virtual CellMemoryPin *get_pin() { return 0; }
     virtual ~CellStoreScannerInterval() { }
     uint64_t get_disk_read() { return m_disk_read; }
 
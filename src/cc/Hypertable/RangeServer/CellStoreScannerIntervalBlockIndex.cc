@@ -28,11 +28,37 @@
 #include "Hypertable/Lib/BlockCompressionHeader.h"
 #include "Global.h"
 #include "CellStoreBlockIndexArray.h"
+#include "CellStoreColumnarBlock.h"
 
 #include "CellStoreScannerIntervalBlockIndex.h"
 
 using namespace Hypertable;
 
+namespace {
+
+  /// Pin for a block fetched by a block index scanner.  The block is
+  /// checked back into the block cache, or freed if it was not cached,
+  /// when the last reference goes away.
+  class BlockPin : public CellMemoryPin {
+  public:
+    BlockPin(int file_id, int64_t offset, const uint8_t *base,
+             const uint8_t *end, bool cached)
+      : CellMemoryPin(base, end), m_file_id(file_id), m_offset(offset),
+        m_cached(cached) { }
+    virtual ~BlockPin() {
+      if (m_cached)
+        Global::block_cache->checkin(m_file_id, m_offset);
+      else
+        delete [] base;
+    }
+  private:
+    int m_file_id;
+    int64_t m_offset;
+    bool m_cached;
+  };
+
+}
+
 
 template <typename IndexT>
 CellStoreScannerIntervalBlockIndex<IndexT>::CellStoreScannerIntervalBlockIndex(CellStore *cellstore,
@@ -45,6 +71,7 @@ CellStoreScannerIntervalBlockIndex<IndexT>::CellStoreScannerIntervalBlockIndex(C
   m_file_id = m_cellstore->get_file_id();
   m_zcodec = m_cellstore->create_block_compression_codec();
   m_key_decompressor = m_cellstore->create_key_decompressor();
+  m_has_restarts = m_cellstore->has_block_restarts();
 
   m_end_row = (m_end_key) ? m_end_key.row() : Key::END_ROW_MARKER;
   m_fd = m_cellstore->get_fd();
@@ -59,6 +86,8 @@ CellStoreScannerIntervalBlockIndex<IndexT>::CellStoreScannerIntervalBlockIndex(C
 
   if (m_start_key) {
     const uint8_t *ptr;
+    if (m_has_restarts)
+      m_cur_value.ptr = m_restarts.seek(m_key_decompressor, m_start_key);
     while (m_key_decompressor->less_than(m_start_key)) {
       ptr = m_cur_value.ptr + m_cur_value.length();
       if (ptr >= m_block.end) {
@@ -93,12 +122,7 @@ CellStoreScannerIntervalBlockIndex<IndexT>::CellStoreScannerIntervalBlockIndex(C
 
 template <typename IndexT>
 CellStoreScannerIntervalBlockIndex<IndexT>::~CellStoreScannerIntervalBlockIndex() {
-  if (m_block.base != 0) {
-    if (m_cached)
-      Global::block_cache->checkin(m_file_id, m_block.offset);
-    else
-      delete [] m_block.base;
-  }
+  m_block_pin = 0;
   delete m_zcodec;
   delete m_key_decompressor;
 }
@@ -177,10 +201,7 @@ bool CellStoreScannerIntervalBlockIndex<IndexT>::fetch_next_block(bool eob) {
 
   // If we're at the end of the current block, deallocate and move to next
   if (m_block.base != 0 && eob) {
-    if (m_cached)
-      Global::block_cache->checkin(m_file_id, m_block.offset);
-    else
-      delete [] m_block.base;
+    m_block_pin = 0;
     memset(&m_block, 0, sizeof(m_block));
     ++m_iter;
 
@@ -193,6 +214,9 @@ bool CellStoreScannerIntervalBlockIndex<IndexT>::fetch_next_block(bool eob) {
 
   if (m_block.base == 0 && m_iter != m_index->end()) {
     DynamicBuffer expand_buf;
+    DynamicBuffer columnar_buf;
+    DynamicBuffer *block_buf = &expand_buf;
+    bool keys_only_block = false;
     uint32_t len;
 
     m_block.offset = m_iter.value();
@@ -249,7 +273,15 @@ bool CellStoreScannerIntervalBlockIndex<IndexT>::fetch_next_block(bool eob) {
         if (!checked_out)
           m_disk_read += expand_buf.fill();
 
-        if (!header.check_magic(CellStore::DATA_BLOCK_MAGIC))
+        if (header.check_magic(CellStore::COLUMNAR_DATA_BLOCK_MAGIC)) {
+          // Keys-only scans skip decoding the value streams
+          keys_only_block = m_scan_ctx->spec && m_scan_ctx->spec->keys_only;
+          CellStoreColumnarBlock::expand(expand_buf, m_key_decompressor,
+                                         columnar_buf, keys_only_block,
+                                         m_has_restarts);
+          block_buf = &columnar_buf;
+        }
+        else if (!header.check_magic(CellStore::DATA_BLOCK_MAGIC))
           HT_THROW(Error::BLOCK_COMPRESSOR_BAD_MAGIC,
                    "Error inflating cell store block - magic string mismatch");
 
@@ -279,11 +311,12 @@ bool CellStoreScannerIntervalBlockIndex<IndexT>::fetch_next_block(bool eob) {
 
       /** take ownership of inflate buffer **/
       size_t fill;
-      m_block.base = expand_buf.release(&fill);
+      m_block.base = block_buf->release(&fill);
       len = fill;
 
       /** Insert uncompressed block into cache  **/
-      m_cached = Global::block_cache && !Global::block_cache->compressed() &&
+      m_cached = !keys_only_block &&
+          Global::block_cache && !Global::block_cache->compressed() &&
           Global::block_cache->insert(m_file_id, m_block.offset,
 				      (uint8_t *)m_block.base, len, true);
     }
@@ -292,6 +325,10 @@ bool CellStoreScannerIntervalBlockIndex<IndexT>::fetch_next_block(bool eob) {
 
     m_key_decompressor->reset();
     m_block.end = m_block.base + len;
+    m_block_pin = new BlockPin(m_file_id, m_block.offset, m_block.base,
+                               m_block.end, m_cached);
+    if (m_has_restarts)
+      m_block.end = m_restarts.load(m_block.base, m_block.end);
     m_cur_value.ptr = m_key_decompressor->add(m_block.base);
 
     return true;
@@ -24,7 +24,9 @@
 
 #include "Common/DynamicBuffer.h"
 
+#include "CellListScanner.h"
 #include "CellStore.h"
+#include "CellStoreBlockRestarts.h"
 #include "CellStoreScannerInterval.h"
 #include "ScanContext.h"
 
@@ -44,6 +46,7 @@ namespace Hypertable {
     virtual ~CellStoreScannerIntervalBlockIndex();
     virtual void forward();
     virtual bool get(Key &key, ByteString &value);
+    virtual CellMemoryPin *get_pin() { return m_block_pin.get(); }
 
   private:
 
@@ -53,6 +56,8 @@ namespace Hypertable {
     IndexT               *m_index;
     IndexIteratorT        m_iter;
     BlockInfo             m_block;
+    /// Owns m_block; checks it in (or frees it) when last reference drops
+    CellMemoryPinPtr      m_block_pin;
     Key                   m_key;
     SerializedKey         m_cur_key;
     ByteString            m_cur_value;
@@ -62,6 +67,9 @@ namespace Hypertable {
     DynamicBuffer         m_key_buf;
     BlockCompressionCodec *m_zcodec;
     KeyDecompressor      *m_key_decompressor;
+    /// Restart points of m_block, if the cell store has them
+    CellStoreBlockRestarts m_restarts;
+    bool                  m_has_restarts;
     int32_t               m_fd;
     bool                  m_cached;
     bool                  m_check_for_range_end;
@@ -29,6 +29,7 @@
 #include "Hypertable/Lib/BlockCompressionHeader.h"
 #include "Global.h"
 #include "CellStoreBlockIndexArray.h"
+#include "CellStoreColumnarBlock.h"
 
 #include "CellStoreScannerIntervalReadahead.h"
 
@@ -51,6 +52,7 @@ CellStoreScannerIntervalReadahead<IndexT>::CellStoreScannerIntervalReadahead(Cel
   memset(&m_block, 0, sizeof(m_block));
   m_zcodec = m_cellstore->create_block_compression_codec();
   m_key_decompressor = m_cellstore->create_key_decompressor();
+  m_has_restarts = m_cellstore->has_block_restarts();
 
   uint16_t csversion = boost::any_cast<uint16_t>(cellstore->get_trailer()->get("version"));
   if (csversion >= 4)
@@ -109,6 +111,8 @@ CellStoreScannerIntervalReadahead<IndexT>::CellStoreScannerIntervalReadahead(Cel
 
   if (start_key) {
     const uint8_t *ptr;
+    if (m_has_restarts)
+      m_cur_value.ptr = m_restarts.seek(m_key_decompressor, start_key);
     while (m_key_decompressor->less_than(start_key)) {
       ptr = m_cur_value.ptr + m_cur_value.length();
       if (ptr >= m_block.end) {
@@ -243,6 +247,8 @@ bool CellStoreScannerIntervalReadahead<IndexT>::fetch_next_block_readahead(bool
 
   if (m_block.base == 0 && !m_eos) {
     DynamicBuffer expand_buf(0);
+    DynamicBuffer columnar_buf(0);
+    DynamicBuffer *block_buf = &expand_buf;
     uint32_t len;
     uint32_t nread;
 
@@ -279,7 +285,15 @@ bool CellStoreScannerIntervalReadahead<IndexT>::fetch_next_block_readahead(bool
 
       m_disk_read += expand_buf.fill();
 
-      if (!header.check_magic(CellStore::DATA_BLOCK_MAGIC))
+      if (header.check_magic(CellStore::COLUMNAR_DATA_BLOCK_MAGIC)) {
+        // Keys-only scans skip decoding the value streams
+        CellStoreColumnarBlock::expand(expand_buf, m_key_decompressor,
+                                       columnar_buf, m_scan_ctx->spec &&
+                                       m_scan_ctx->spec->keys_only,
+                                       m_has_restarts);
+        block_buf = &columnar_buf;
+      }
+      else if (!header.check_magic(CellStore::DATA_BLOCK_MAGIC))
         HT_THROW(Error::BLOCK_COMPRESSOR_BAD_MAGIC,
                  "Error inflating cell store block - magic string mismatch");
     }
@@ -292,11 +306,13 @@ bool CellStoreScannerIntervalReadahead<IndexT>::fetch_next_block_readahead(bool
 
     /** take ownership of inflate buffer **/
     size_t fill;
-    m_block.base = expand_buf.release(&fill);
+    m_block.base = block_buf->release(&fill);
     len = fill;
 
     m_key_decompressor->reset();
     m_block.end = m_block.base + len;
+    if (m_has_restarts)
+      m_block.end = m_restarts.load(m_block.base, m_block.end);
     m_cur_value.ptr = m_key_decompressor->add(m_block.base);
 
     return true;
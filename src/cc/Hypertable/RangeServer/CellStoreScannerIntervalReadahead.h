@@ -25,6 +25,7 @@
 #include "Common/DynamicBuffer.h"
 
 #include "CellStore.h"
+#include "CellStoreBlockRestarts.h"
 #include "CellStoreScannerInterval.h"
 #include "ScanContext.h"
 
@@ -56,6 +57,9 @@ namespace Hypertable {
     ByteString             m_cur_value;
     BlockCompressionCodec *m_zcodec;
     KeyDecompressor       *m_key_decompressor;
+    /// Restart points of m_block, if the cell store has them
+    CellStoreBlockRestarts m_restarts;
+    bool                   m_has_restarts;
     int32_t                m_fd;
     int64_t                m_offset;
     int64_t                m_end_offset;
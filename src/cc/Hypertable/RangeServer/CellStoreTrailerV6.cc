@@ -81,6 +81,8 @@ void CellStoreTrailerV6::clear() {
   key_compression_scheme = 0;
   bloom_filter_mode = BLOOM_FILTER_DISABLED;
   bloom_filter_hash_count = 0;
+  dictionary_offset = 0;
+  dictionary_length = 0;
   version = 6;
 }
 
@@ -121,13 +123,17 @@ void CellStoreTrailerV6::serialize(uint8_t *buf) {
   encode_i16(&buf, key_compression_scheme);
   encode_i8(&buf, bloom_filter_mode);
   encode_i8(&buf, bloom_filter_hash_count);
+  if (version >= 8) {
+    encode_i64(&buf, dictionary_offset);
+    encode_i64(&buf, dictionary_length);
+  }
   encode_i16(&buf, version);
   // compute trailer checksum
   trailer_checksum = (int32_t)fletcher32(base+4, buf-(base+4));
   encode_i32(&base, trailer_checksum);
   base -= 4;
 
-  assert(version == 6);
+  assert(version >= 6 && version <= 10);
   assert((buf-base) == (int)CellStoreTrailerV6::size());
   (void)base;
 }
@@ -171,6 +177,14 @@ void CellStoreTrailerV6::deserialize(const uint8_t *buf) {
     key_compression_scheme = decode_i16(&buf, &remaining);
     bloom_filter_mode = decode_i8(&buf, &remaining);
     bloom_filter_hash_count = decode_i8(&buf, &remaining);
+    if (version >= 8) {
+      dictionary_offset = decode_i64(&buf, &remaining);
+      dictionary_length = decode_i64(&buf, &remaining);
+    }
+    else {
+      dictionary_offset = 0;
+      dictionary_length = 0;
+    }
     version = decode_i16(&buf, &remaining));
   int32_t checksum = (int32_t)fletcher32(base, buf-base);
   if (checksum != trailer_checksum)
@@ -213,6 +227,12 @@ void CellStoreTrailerV6::display(std::ostream &os) {
     os << " 64BIT_INDEX";
   if (flags & MAJOR_COMPACTION)
     os << " MAJOR_COMPACTION";
+  if (flags & BLOOM_FILTER_BLOCKED)
+    os << " BLOOM_FILTER_BLOCKED";
+  if (flags & BLOCK_RESTARTS)
+    os << " BLOCK_RESTARTS";
+  if (flags & SUBCOMPACTION_CONTINUATION)
+    os << " SUBCOMPACTION_CONTINUATION";
   os << " )";
   os << ", alignment=" << alignment;
   os << ", compression_ratio=" << compression_ratio;
@@ -227,6 +247,10 @@ void CellStoreTrailerV6::display(std::ostream &os) {
   else
     os << ", bloom_filter_mode=?(" << bloom_filter_mode << ")";
   os << ", bloom_filter_hash_count=" << bloom_filter_hash_count;
+  if (version >= 8) {
+    os << ", dictionary_offset=" << dictionary_offset;
+    os << ", dictionary_length=" << dictionary_length;
+  }
   os << ", version=" << version << "}";
 }
 
@@ -275,6 +299,10 @@ void CellStoreTrailerV6::display_multiline(std::ostream &os) {
   else
     os << "  bloom_filter_mode=?(" << bloom_filter_mode << ")\n";
   os << "  bloom_filter_hash_count=" << (int)bloom_filter_hash_count << "\n";
+  if (version >= 8) {
+    os << "  dictionary_offset: " << dictionary_offset << "\n";
+    os << "  dictionary_length: " << dictionary_length << "\n";
+  }
   os << "  version: " << version << std::endl;
 }
 
@@ -28,12 +28,25 @@
 
 namespace Hypertable {
 
+  /** Trailer for CellStoreV6.
+   * Version 7 uses the same layout as version 6; it is written when the
+   * Bloom filter has blocked layout (see BLOOM_FILTER_BLOCKED), so that
+   * servers that do not know about blocked filters refuse to open the file
+   * rather than misinterpreting the filter.  Version 8 adds the location
+   * of a compression dictionary (see #dictionary_offset); its layout is
+   * that of version 6 with two extra fields before #version, so #size
+   * depends on #version, which must be set before calling #deserialize.
+   * Version 9 has the layout of version 8; it is written when the file
+   * contains columnar data blocks (see COLUMNAR_DATA_BLOCK_MAGIC).
+   * Version 10 also has the layout of version 8; it is written when the
+   * data blocks end with restart points (see BLOCK_RESTARTS).
+   */
   class CellStoreTrailerV6 : public CellStoreTrailer {
   public:
     CellStoreTrailerV6();
     virtual ~CellStoreTrailerV6() { return; }
     virtual void clear();
-    virtual size_t size() { return 196; }
+    virtual size_t size() { return version >= 8 ? 212 : 196; }
     virtual void serialize(uint8_t *buf);
     virtual void deserialize(const uint8_t *buf);
     virtual void display(std::ostream &os);
@@ -73,11 +86,21 @@ namespace Hypertable {
     uint16_t  key_compression_scheme;
     uint8_t   bloom_filter_mode;
     uint8_t   bloom_filter_hash_count;
+    /// Offset of the compression dictionary block (version 8)
+    int64_t   dictionary_offset;
+    /// Length of the compression dictionary block, 0 if none (version 8)
+    int64_t   dictionary_length;
     uint16_t  version;
 
     enum Flags { INDEX_64BIT = 1,
                  MAJOR_COMPACTION = 2,
-                 SPLIT = 4
+                 SPLIT = 4,
+                 BLOOM_FILTER_BLOCKED = 8,
+                 BLOCK_RESTARTS = 16,
+                 /// Key-range partition of a split major compaction that
+                 /// continues the cell store written for the preceding
+                 /// partition
+                 SUBCOMPACTION_CONTINUATION = 32
     };
 
     boost::any get(const String& prop) {
@@ -112,6 +135,8 @@ namespace Hypertable {
       else if (prop == "compression_type")      return compression_type;
       else if (prop == "bloom_filter_mode")     return bloom_filter_mode;
       else if (prop == "bloom_filter_hash_count") return bloom_filter_hash_count;
+      else if (prop == "dictionary_offset")     return dictionary_offset;
+      else if (prop == "dictionary_length")     return dictionary_length;
       else                                      return boost::any();
     }
 
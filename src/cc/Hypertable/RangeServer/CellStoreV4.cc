@@ -224,7 +224,7 @@ void CellStoreV4::create_bloom_filter(bool is_approx) {
     else
       m_bloom_filter = new BloomFilterWithChecksum(m_trailer.filter_items_estimate,
                                                    m_bloom_bits_per_item,
-                                                   m_trailer.bloom_filter_hash_count);
+                                                   (size_t)m_trailer.bloom_filter_hash_count);
   }
   catch(Exception &e) {
     HT_FATAL_OUT << "Error creating new BloomFilter for CellStore '"
@@ -46,6 +46,7 @@
 #include "Hypertable/Lib/Schema.h"
 
 #include "CellStoreV6.h"
+#include "CellStoreBlockRestarts.h"
 #include "CellStoreInfo.h"
 #include "CellStoreTrailerV6.h"
 #include "CellStoreScanner.h"
@@ -61,17 +62,30 @@ using namespace Hypertable;
 
 namespace {
   const uint32_t MAX_APPENDS_OUTSTANDING = 3;
+
+  /// Sample data gathered to train a dictionary, as a multiple of its size
+  const size_t DICTIONARY_SAMPLE_MULTIPLE = 100;
+
+  /// Minimum sample data needed to train a dictionary, as a multiple of its
+  /// size; smaller files are compressed without a dictionary
+  const size_t DICTIONARY_SAMPLE_MINIMUM_MULTIPLE = 10;
 }
 
 
 CellStoreV6::CellStoreV6(Filesystem *filesys, Schema *schema)
   : m_filesys(filesys), m_schema(schema), m_fd(-1), m_filename(),
-    m_64bit_index(false), m_compressor(0), m_buffer(0),
+    m_64bit_index(false), m_compressor(0), m_block_compressor(0),
+    m_compression_threads(0), m_buffer(0),
     m_outstanding_appends(0), m_offset(0), m_file_length(0),
     m_disk_usage(0), m_file_id(0), m_uncompressed_blocksize(0),
     m_bloom_filter_mode(BLOOM_FILTER_DISABLED), m_bloom_filter_items(0),
-    m_filter_false_positive_prob(0.0), m_restricted_range(false),
-    m_column_ttl(0), m_replaced_files_loaded(false), m_bloom_filter(0) {
+    m_filter_false_positive_prob(0.0), m_bloom_filter_blocked(false),
+    m_restricted_range(false),
+    m_column_ttl(0), m_replaced_files_loaded(false), m_dictionary_memory(0),
+    m_dictionary_sampling(false), m_dictionary_samples(0),
+    m_dictionary_sample_target(0), m_encoded_value_bytes(0),
+    m_columnar_blocks(0), m_restart_interval(0), m_block_entries(0),
+    m_bloom_filter(0) {
   m_file_id = FileBlockCache::get_next_file_id();
   assert(sizeof(float) == 4);
 }
@@ -79,25 +93,31 @@ CellStoreV6::CellStoreV6(Filesystem *filesys, Schema *schema)
 
 CellStoreV6::~CellStoreV6() {
   try {
+    delete m_block_compressor;
     delete m_compressor;
     delete m_bloom_filter;
     delete m_bloom_filter_items;
     if (m_fd != -1)
       m_filesys->close(m_fd);
     delete [] m_column_ttl;
+    foreach_ht (ValueStreamEncoder *encoder, m_value_encoders)
+      delete encoder;
   }
   catch (Exception &e) {
     HT_ERROR_OUT << e << HT_END;
   }
 
-  Global::memory_tracker->subtract( sizeof(CellStoreV6) + sizeof(CellStoreInfo) + m_index_stats.bloom_filter_memory + m_index_stats.block_index_memory );
+  Global::memory_tracker->subtract( sizeof(CellStoreV6) + sizeof(CellStoreInfo) + m_index_stats.bloom_filter_memory + m_index_stats.block_index_memory + m_dictionary_memory );
 
 }
 
 
 BlockCompressionCodec *CellStoreV6::create_block_compression_codec() {
-  return CompressorFactory::create_block_codec(
+  BlockCompressionCodec *codec = CompressorFactory::create_block_codec(
       (BlockCompressionCodec::Type)m_trailer.compression_type);
+  if (m_dictionary)
+    codec->set_dictionary(m_dictionary);
+  return codec;
 }
 
 KeyDecompressor *CellStoreV6::create_key_decompressor() {
@@ -227,6 +247,17 @@ CellStoreV6::create(const char *fname, size_t max_entries,
     }
   }
 
+  // set up value stream encoders for column families with a value encoding
+  for (size_t i=0; i<column_families.size(); i++) {
+    ValueEncoding::Type encoding =
+      ValueEncoding::parse(column_families[i]->value_encoding);
+    if (encoding == ValueEncoding::NONE || column_families[i]->deleted)
+      continue;
+    if (m_value_encoders.empty())
+      m_value_encoders.resize(256, 0);
+    m_value_encoders[ column_families[i]->id ] = new ValueStreamEncoder(encoding);
+  }
+
   m_filename = fname;
 
   m_start_row = "";
@@ -239,6 +270,37 @@ CellStoreV6::create(const char *fname, size_t max_entries,
       (BlockCompressionCodec::Type)m_trailer.compression_type,
       m_compressor_args);
 
+  // Compress data blocks on a worker pool so that the merge loop isn't
+  // serialized behind the codec
+  m_compression_threads = 0;
+  if (Config::has("Hypertable.RangeServer.CellStore.CompressionThreads"))
+    m_compression_threads = Config::get_i32("Hypertable.RangeServer.CellStore"
+                                            ".CompressionThreads");
+  if (m_trailer.compression_type == BlockCompressionCodec::NONE)
+    m_compression_threads = 0;
+
+  // Codecs that use a dictionary get one trained from the first data blocks
+  // of the file, which are held back until it has been trained.  The worker
+  // pool is started once the dictionary is known.
+  if (m_compressor->get_dictionary_size() > 0) {
+    m_dictionary_sampling = true;
+    m_dictionary_sample_target =
+      DICTIONARY_SAMPLE_MULTIPLE * m_compressor->get_dictionary_size();
+  }
+  else if (m_compression_threads > 0)
+    m_block_compressor = new CellStoreBlockCompressor(
+        (BlockCompressionCodec::Type)m_trailer.compression_type,
+        m_compressor_args, m_compression_threads, 2*m_compression_threads);
+
+  // Periodic restart points let scanners binary search a block for their
+  // start key rather than decompressing every key in front of it
+  m_restart_interval = 0;
+  if (Config::has("Hypertable.RangeServer.CellStore.RestartInterval"))
+    m_restart_interval = Config::get_i32("Hypertable.RangeServer.CellStore"
+                                         ".RestartInterval");
+  if (m_restart_interval > 0)
+    m_trailer.flags |= CellStoreTrailerV6::BLOCK_RESTARTS;
+
   uint32_t oflags = Filesystem::OPEN_FLAG_DIRECTIO|Filesystem::OPEN_FLAG_OVERWRITE;
   m_fd = m_filesys->create(m_filename, oflags, -1, replication, -1);
 
@@ -262,6 +324,7 @@ CellStoreV6::create(const char *fname, size_t max_entries,
     }
     else
       m_filter_false_positive_prob = props->get_f64("false-positive");
+    m_bloom_filter_blocked = props->get_bool("blocked", false);
     m_bloom_filter_items = new BloomFilterItems(); // aproximator items
   }
   HT_DEBUG_OUT <<"bloom-filter-mode="<< m_bloom_filter_mode
@@ -279,11 +342,13 @@ void CellStoreV6::create_bloom_filter(bool is_approx) {
   try {
     if (m_filter_false_positive_prob != 0.0)
       m_bloom_filter = new BloomFilterWithChecksum(m_trailer.filter_items_estimate,
-                                                   m_filter_false_positive_prob);
+                                                   m_filter_false_positive_prob,
+                                                   m_bloom_filter_blocked);
     else
       m_bloom_filter = new BloomFilterWithChecksum(m_trailer.filter_items_estimate,
                                                    m_bloom_bits_per_item,
-                                                   m_trailer.bloom_filter_hash_count);
+                                                   m_trailer.bloom_filter_hash_count,
+                                                   m_bloom_filter_blocked);
   }
   catch(Exception &e) {
     HT_FATAL_OUT << "Error creating new BloomFilter for CellStore '"
@@ -355,6 +420,53 @@ void CellStoreV6::load_replaced_files() {
   m_replaced_files_loaded = true;
 }
 
+void CellStoreV6::load_dictionary() {
+  bool second_try = false;
+  int64_t amount = m_trailer.dictionary_length;
+  int64_t len = 0;
+
+ try_again:
+
+  try {
+    DynamicBuffer buf(amount);
+    DynamicBuffer dictionary;
+    BlockCompressionHeader header;
+    BlockCompressionCodecPtr codec =
+      CompressorFactory::create_block_codec(BlockCompressionCodec::NONE);
+
+    len = m_filesys->pread(m_fd, buf.ptr, amount, m_trailer.dictionary_offset,
+                           second_try);
+
+    if (len != amount)
+      HT_THROWF(Error::DFSBROKER_IO_ERROR, "Error loading dictionary for "
+                "CellStore '%s' : tried to read %lld but only got %lld",
+                m_filename.c_str(), (Lld)amount, (Lld)len);
+    buf.ptr += amount;
+
+    codec->inflate(buf, dictionary, header);
+
+    if (!header.check_magic(DICTIONARY_BLOCK_MAGIC))
+      HT_THROWF(Error::BLOCK_COMPRESSOR_BAD_MAGIC, "Bad dictionary block "
+                "magic in CellStore '%s'", m_filename.c_str());
+
+    m_bytes_read += amount;
+
+    m_dictionary = new BlockCompressionDictionary(dictionary.base,
+                                                  dictionary.fill());
+    m_dictionary_memory = m_dictionary->length();
+  }
+  catch (Exception &e) {
+    HT_ERROR_OUT << "pread(fd=" << m_fd << ", len=" << len << ", amount="
+        << amount << ")\n" << HT_END;
+    HT_ERROR_OUT << m_trailer << HT_END;
+    if (second_try)
+      HT_THROW2(e.code(), e, "Problem loading CellStore dictionary");
+    second_try = true;
+    goto try_again;
+  }
+}
+
+
 void CellStoreV6::load_bloom_filter() {
   size_t len;
 
@@ -367,7 +479,8 @@ void CellStoreV6::load_bloom_filter() {
     m_bloom_filter = new BloomFilterWithChecksum(m_trailer.filter_items_actual,
                                                  m_trailer.filter_items_actual,
                                                  m_trailer.filter_length,
-                                                 m_trailer.bloom_filter_hash_count);
+                                                 m_trailer.bloom_filter_hash_count,
+                                                 (m_trailer.flags & CellStoreTrailerV6::BLOOM_FILTER_BLOCKED) != 0);
   }
   catch(Exception &e) {
     HT_FATAL_OUT << "Error loading BloomFilter for CellStore '"
@@ -442,64 +555,185 @@ uint64_t CellStoreV6::purge_indexes() {
 
 
 
-void CellStoreV6::add(const Key &key, const ByteString value) {
-  EventPtr event_ptr;
-  DynamicBuffer zbuf;
+void CellStoreV6::add_block() {
+  const char *magic = DATA_BLOCK_MAGIC;
 
-  if (key.revision > m_trailer.revision)
-    m_trailer.revision = key.revision;
+  m_index_builder.add_key(m_key_compressor);
 
-  if (key.timestamp != TIMESTAMP_NULL) {
-    if (key.timestamp < m_trailer.timestamp_min)
-      m_trailer.timestamp_min = key.timestamp;
-    if (key.timestamp > m_trailer.timestamp_max)
-      m_trailer.timestamp_max = key.timestamp;
+  // Values of encoded column families were diverted to the encoders, so
+  // m_buffer only holds the key region of a columnar block
+  if (m_encoded_value_bytes) {
+    DynamicBuffer block;
+    if (m_restart_interval > 0) {
+      // Offsets in the expanded block are not known yet, so record the
+      // entry number of each restart point instead
+      std::vector<uint32_t> restart_entries;
+      for (size_t i=0; i<m_restart_offsets.size(); i++)
+        restart_entries.push_back(i * m_restart_interval);
+      CellStoreBlockRestarts::append(m_buffer, restart_entries);
+    }
+    CellStoreColumnarBlock::assemble(m_buffer, m_value_encoders, block);
+    m_buffer.clear();
+    m_buffer.ensure(block.fill());
+    m_buffer.add_unchecked(block.base, block.fill());
+    m_encoded_value_bytes = 0;
+    m_columnar_blocks++;
+    magic = COLUMNAR_DATA_BLOCK_MAGIC;
+  }
+  else if (m_restart_interval > 0)
+    CellStoreBlockRestarts::append(m_buffer, m_restart_offsets);
+
+  m_restart_offsets.clear();
+  m_block_entries = 0;
+
+  if (m_dictionary_sampling) {
+    m_dictionary_samples.ensure(m_buffer.fill());
+    m_dictionary_samples.add_unchecked(m_buffer.base, m_buffer.fill());
+    m_dictionary_sample_sizes.push_back(m_buffer.fill());
+    m_dictionary_sample_magic.push_back(magic);
+    m_buffer.clear();
+    if (m_dictionary_samples.fill() >= m_dictionary_sample_target)
+      train_dictionary();
+    return;
   }
 
-  if (m_buffer.fill() > (size_t)m_uncompressed_blocksize) {
-    BlockCompressionHeader header(DATA_BLOCK_MAGIC);
+  compress_block(magic);
+}
 
-    m_index_builder.add_entry(m_key_compressor, m_offset);
 
-    m_uncompressed_data += (float)m_buffer.fill();
+void CellStoreV6::compress_block(const char *magic) {
+
+  if (m_block_compressor) {
+    DynamicBuffer zbuf;
+    size_t uncompressed_length;
+    // Write out blocks that have finished compressing, waiting for the
+    // oldest one if the in-flight limit has been reached
+    while (m_block_compressor->next(zbuf, &uncompressed_length,
+                                    m_block_compressor->full()))
+      write_block(zbuf, uncompressed_length);
+    m_block_compressor->submit(m_buffer, magic);
+    m_buffer.reserve(m_trailer.blocksize*4);
+  }
+  else {
+    BlockCompressionHeader header(magic);
+    DynamicBuffer zbuf;
     m_compressor->deflate(m_buffer, zbuf, header, HT_DIRECT_IO_ALIGNMENT);
-    m_compressed_data += (float)zbuf.fill();
+    size_t uncompressed_length = m_buffer.fill();
     m_buffer.clear();
+    write_block(zbuf, uncompressed_length);
+  }
+}
 
-    uint64_t llval = ((uint64_t)m_trailer.blocksize
-        * (uint64_t)m_uncompressed_data) / (uint64_t)m_compressed_data;
-    m_uncompressed_blocksize = (int64_t)llval;
-
-    if (m_outstanding_appends >= MAX_APPENDS_OUTSTANDING) {
-      if (!m_sync_handler.wait_for_reply(event_ptr)) {
-        if (event_ptr->type == Event::MESSAGE)
-          HT_THROWF(Hypertable::Protocol::response_code(event_ptr),
-             "Problem writing to DFS file '%s' : %s", m_filename.c_str(),
-             Hypertable::Protocol::string_format_message(event_ptr).c_str());
-        HT_THROWF(event_ptr->error,
-                  "Problem writing to DFS file '%s'", m_filename.c_str());
-      }
-      m_outstanding_appends--;
-    }
 
-    if (!HT_IO_ALIGNED(zbuf.fill())) {
-      memset(zbuf.ptr, 0, HT_IO_ALIGNMENT_PADDING(zbuf.fill()));
-      zbuf.ptr += HT_IO_ALIGNMENT_PADDING(zbuf.fill());
-    }
+void CellStoreV6::train_dictionary() {
+  size_t dictionary_size = m_compressor->get_dictionary_size();
+  DynamicBuffer dictionary;
+
+  m_dictionary_sampling = false;
 
-    size_t zlen = zbuf.fill();
-    StaticBuffer send_buf(zbuf);
+  if (m_dictionary_samples.fill() >=
+      DICTIONARY_SAMPLE_MINIMUM_MULTIPLE * dictionary_size &&
+      m_compressor->train_dictionary(m_dictionary_samples,
+                                     m_dictionary_sample_sizes, dictionary)) {
+    m_dictionary = new BlockCompressionDictionary(dictionary.base,
+                                                  dictionary.fill());
+    m_compressor->set_dictionary(m_dictionary);
+    HT_DEBUGF("Trained %lu byte compression dictionary for %s from %lu "
+              "blocks", (Lu)dictionary.fill(), m_filename.c_str(),
+              (Lu)m_dictionary_sample_sizes.size());
+  }
+
+  if (m_compression_threads > 0)
+    m_block_compressor = new CellStoreBlockCompressor(
+        (BlockCompressionCodec::Type)m_trailer.compression_type,
+        m_compressor_args, m_compression_threads, 2*m_compression_threads,
+        m_dictionary);
+
+  // Compress the blocks that were held back
+  const uint8_t *ptr = m_dictionary_samples.base;
+  for (size_t i=0; i<m_dictionary_sample_sizes.size(); i++) {
+    size_t len = m_dictionary_sample_sizes[i];
+    m_buffer.clear();
+    m_buffer.ensure(len);
+    m_buffer.add_unchecked(ptr, len);
+    ptr += len;
+    compress_block(m_dictionary_sample_magic[i]);
+  }
 
-    try { m_filesys->append(m_fd, send_buf, 0, &m_sync_handler); }
-    catch (Exception &e) {
-      HT_THROW2F(e.code(), e, "Problem writing to DFS file '%s'",
-                 m_filename.c_str());
+  m_dictionary_samples.free();
+  m_dictionary_sample_sizes.clear();
+  m_dictionary_sample_magic.clear();
+}
+
+
+void CellStoreV6::write_block(DynamicBuffer &zbuf,
+                              size_t uncompressed_length) {
+  EventPtr event_ptr;
+
+  m_index_builder.add_offset(m_offset);
+
+  m_uncompressed_data += (float)uncompressed_length;
+  m_compressed_data += (float)zbuf.fill();
+
+  uint64_t llval = ((uint64_t)m_trailer.blocksize
+      * (uint64_t)m_uncompressed_data) / (uint64_t)m_compressed_data;
+  m_uncompressed_blocksize = (int64_t)llval;
+
+  if (m_outstanding_appends >= MAX_APPENDS_OUTSTANDING) {
+    if (!m_sync_handler.wait_for_reply(event_ptr)) {
+      if (event_ptr->type == Event::MESSAGE)
+        HT_THROWF(Hypertable::Protocol::response_code(event_ptr),
+           "Problem writing to DFS file '%s' : %s", m_filename.c_str(),
+           Hypertable::Protocol::string_format_message(event_ptr).c_str());
+      HT_THROWF(event_ptr->error,
+                "Problem writing to DFS file '%s'", m_filename.c_str());
     }
-    m_outstanding_appends++;
-    m_offset += zlen;
+    m_outstanding_appends--;
+  }
+
+  if (!HT_IO_ALIGNED(zbuf.fill())) {
+    memset(zbuf.ptr, 0, HT_IO_ALIGNMENT_PADDING(zbuf.fill()));
+    zbuf.ptr += HT_IO_ALIGNMENT_PADDING(zbuf.fill());
+  }
+
+  size_t zlen = zbuf.fill();
+  StaticBuffer send_buf(zbuf);
+
+  try { m_filesys->append(m_fd, send_buf, 0, &m_sync_handler); }
+  catch (Exception &e) {
+    HT_THROW2F(e.code(), e, "Problem writing to DFS file '%s'",
+               m_filename.c_str());
+  }
+  m_outstanding_appends++;
+  m_offset += zlen;
+}
+
+
+void CellStoreV6::add(const Key &key, const ByteString value) {
+
+  if (key.revision > m_trailer.revision)
+    m_trailer.revision = key.revision;
+
+  if (key.timestamp != TIMESTAMP_NULL) {
+    if (key.timestamp < m_trailer.timestamp_min)
+      m_trailer.timestamp_min = key.timestamp;
+    if (key.timestamp > m_trailer.timestamp_max)
+      m_trailer.timestamp_max = key.timestamp;
+  }
+
+  if (m_buffer.fill() + m_encoded_value_bytes >
+      (size_t)m_uncompressed_blocksize) {
+    add_block();
     m_key_compressor->reset();
   }
 
+  if (m_restart_interval > 0 &&
+      m_block_entries % m_restart_interval == 0) {
+    m_key_compressor->reset();
+    m_restart_offsets.push_back(m_buffer.fill());
+  }
+  m_block_entries++;
+
   m_key_compressor->add(key);
 
   size_t key_len = m_key_compressor->length();
@@ -522,7 +756,13 @@ void CellStoreV6::add(const Key &key, const ByteString value) {
   m_key_compressor->write(m_buffer.ptr);
   m_buffer.ptr += key_len;
 
-  m_buffer.add_unchecked(value.ptr, value_len);
+  if (!m_value_encoders.empty() && key.flag == FLAG_INSERT &&
+      m_value_encoders[key.column_family_code]) {
+    m_value_encoders[key.column_family_code]->add(value);
+    m_encoded_value_bytes += value_len;
+  }
+  else
+    m_buffer.add_unchecked(value.ptr, value_len);
 
   if (m_bloom_filter_mode != BLOOM_FILTER_DISABLED) {
     if (m_trailer.total_entries < m_max_approx_items) {
@@ -554,42 +794,24 @@ void CellStoreV6::add(const Key &key, const ByteString value) {
 
 
 void CellStoreV6::finalize(TableIdentifier *table_identifier) {
-  EventPtr event_ptr;
   size_t zlen;
   DynamicBuffer zbuf(0);
   SerializedKey key;
   StaticBuffer send_buf;
   int64_t index_memory = 0;
 
-  if (m_buffer.fill() > 0) {
-    BlockCompressionHeader header(DATA_BLOCK_MAGIC);
+  if (m_buffer.fill() + m_encoded_value_bytes > 0)
+    add_block();
 
-    m_index_builder.add_entry(m_key_compressor, m_offset);
+  if (m_dictionary_sampling)
+    train_dictionary();
 
-    m_uncompressed_data += (float)m_buffer.fill();
-    m_compressor->deflate(m_buffer, zbuf, header, HT_DIRECT_IO_ALIGNMENT);
-    m_compressed_data += (float)zbuf.fill();
-
-    if (!HT_IO_ALIGNED(zbuf.fill())) {
-      memset(zbuf.ptr, 0, HT_IO_ALIGNMENT_PADDING(zbuf.fill()));
-      zbuf.ptr += HT_IO_ALIGNMENT_PADDING(zbuf.fill());
-    }
-    zlen = zbuf.fill();
-    send_buf = zbuf;
-
-    if (m_outstanding_appends >= MAX_APPENDS_OUTSTANDING) {
-      if (!m_sync_handler.wait_for_reply(event_ptr))
-        HT_THROWF(Protocol::response_code(event_ptr),
-                  "Problem finalizing CellStore file '%s' : %s",
-                  m_filename.c_str(),
-                  Protocol::string_format_message(event_ptr).c_str());
-      m_outstanding_appends--;
-    }
-
-    m_filesys->append(m_fd, send_buf, 0, &m_sync_handler);
-
-    m_outstanding_appends++;
-    m_offset += zlen;
+  if (m_block_compressor) {
+    size_t uncompressed_length;
+    while (m_block_compressor->next(zbuf, &uncompressed_length, true))
+      write_block(zbuf, uncompressed_length);
+    delete m_block_compressor;
+    m_block_compressor = 0;
   }
 
   m_key_compressor = 0;
@@ -670,6 +892,11 @@ void CellStoreV6::finalize(TableIdentifier *table_identifier) {
       m_trailer.filter_items_actual = m_bloom_filter->get_items_actual();
       m_trailer.bloom_filter_mode = m_bloom_filter_mode;
       m_trailer.bloom_filter_hash_count = m_bloom_filter->get_num_hashes();
+      // Blocked filters are not understood by older versions
+      if (m_bloom_filter->blocked()) {
+        m_trailer.flags |= CellStoreTrailerV6::BLOOM_FILTER_BLOCKED;
+        m_trailer.version = 7;
+      }
       m_bloom_filter->serialize(send_buf);
       m_filesys->append(m_fd, send_buf, 0, &m_sync_handler);
       m_outstanding_appends++;
@@ -677,6 +904,36 @@ void CellStoreV6::finalize(TableIdentifier *table_identifier) {
     }
   }
 
+  // Write compression dictionary
+  if (m_dictionary) {
+    BlockCompressionCodecPtr codec =
+      CompressorFactory::create_block_codec(BlockCompressionCodec::NONE);
+    BlockCompressionHeader header(DICTIONARY_BLOCK_MAGIC);
+    DynamicBuffer dictionary(m_dictionary->length());
+    dictionary.add_unchecked(m_dictionary->data(), m_dictionary->length());
+    zbuf.clear();
+    codec->deflate(dictionary, zbuf, header, HT_DIRECT_IO_ALIGNMENT);
+    m_trailer.dictionary_offset = m_offset;
+    m_trailer.dictionary_length = zbuf.fill();
+    m_trailer.version = 8;
+    if (!HT_IO_ALIGNED(zbuf.fill())) {
+      memset(zbuf.ptr, 0, HT_IO_ALIGNMENT_PADDING(zbuf.fill()));
+      zbuf.ptr += HT_IO_ALIGNMENT_PADDING(zbuf.fill());
+    }
+    zlen = zbuf.fill();
+    send_buf = zbuf;
+    m_filesys->append(m_fd, send_buf, 0, &m_sync_handler);
+    m_outstanding_appends++;
+    m_offset += zlen;
+  }
+
+  // Columnar data blocks and block restart points are not understood by
+  // older versions
+  if (m_trailer.flags & CellStoreTrailerV6::BLOCK_RESTARTS)
+    m_trailer.version = 10;
+  else if (m_columnar_blocks)
+    m_trailer.version = 9;
+
   // Write compressed replaced_file lists
   // Coalesce with trailer block if possible
   zbuf.clear();
@@ -800,12 +1057,22 @@ void CellStoreV6::finalize(TableIdentifier *table_identifier) {
   delete [] m_column_ttl;
   m_column_ttl = 0;
 
-  Global::memory_tracker->add( sizeof(CellStoreV6) + sizeof(CellStoreInfo) + m_index_stats.block_index_memory + m_index_stats.bloom_filter_memory );
+  if (m_dictionary)
+    m_dictionary_memory = m_dictionary->length();
+
+  Global::memory_tracker->add( sizeof(CellStoreV6) + sizeof(CellStoreInfo) + m_index_stats.block_index_memory + m_index_stats.bloom_filter_memory + m_dictionary_memory );
 }
 
 
-void CellStoreV6::IndexBuilder::add_entry(KeyCompressorPtr &key_compressor,
-                                          int64_t offset) {
+void CellStoreV6::IndexBuilder::add_key(KeyCompressorPtr &key_compressor) {
+  size_t key_len = key_compressor->length_uncompressed();
+  m_variable.ensure(key_len);
+  key_compressor->write_uncompressed(m_variable.ptr);
+  m_variable.ptr += key_len;
+}
+
+
+void CellStoreV6::IndexBuilder::add_offset(int64_t offset) {
 
   // switch to 64-bit offsets if offset being added is >= 2^32
   if (!m_bigint && offset >= 4294967296LL) {
@@ -824,13 +1091,7 @@ void CellStoreV6::IndexBuilder::add_entry(KeyCompressorPtr &key_compressor,
     m_bigint = true;
   }
 
-  // Add key to variable buffer
-  size_t key_len = key_compressor->length_uncompressed();
-  m_variable.ensure(key_len);
-  key_compressor->write_uncompressed(m_variable.ptr);
-  m_variable.ptr += key_len;
-
-    // Serialize offset into fix index buffer
+  // Serialize offset into fix index buffer
   if (m_bigint) {
     m_fixed.ensure(8);
     memcpy(m_fixed.ptr, &offset, 8);
@@ -878,7 +1139,7 @@ CellStoreV6::open(const String &fname, const String &start_row,
   m_bloom_filter_mode = (BloomFilterMode)m_trailer.bloom_filter_mode;
 
   /** Sanity check trailer **/
-  HT_ASSERT(m_trailer.version == 6);
+  HT_ASSERT(m_trailer.version >= 6 && m_trailer.version <= 10);
 
   if (m_trailer.flags & CellStoreTrailerV6::INDEX_64BIT)
     m_64bit_index = true;
@@ -890,10 +1151,14 @@ CellStoreV6::open(const String &fname, const String &start_row,
               "length=%llu, file='%s'", (unsigned)m_fd, (Lld)m_trailer.fix_index_offset,
            (Lld)m_trailer.var_index_offset, (Llu)m_file_length, fname.c_str());
 
+  // The dictionary is needed to decompress any block, including the index
+  if (m_trailer.version >= 8 && m_trailer.dictionary_length > 0)
+    load_dictionary();
+
   // This is necessary to get m_disk_usage and m_block_count set properly
   load_block_index();
 
-  Global::memory_tracker->add( sizeof(CellStoreV6) + sizeof(CellStoreInfo) );
+  Global::memory_tracker->add( sizeof(CellStoreV6) + sizeof(CellStoreInfo) + m_dictionary_memory );
 
 }
 
@@ -43,6 +43,8 @@
 #include "Hypertable/Lib/SerializedKey.h"
 
 #include "CellStore.h"
+#include "CellStoreBlockCompressor.h"
+#include "CellStoreColumnarBlock.h"
 #include "CellStoreTrailerV6.h"
 #include "KeyCompressor.h"
 
@@ -67,7 +69,12 @@ namespace Hypertable {
     class IndexBuilder {
     public:
       IndexBuilder() : m_bigint(false) { }
-      void add_entry(KeyCompressorPtr &key_compressor, int64_t offset);
+      void add_entry(KeyCompressorPtr &key_compressor, int64_t offset) {
+        add_key(key_compressor);
+        add_offset(offset);
+      }
+      void add_key(KeyCompressorPtr &key_compressor);
+      void add_offset(int64_t offset);
       DynamicBuffer &fixed_buf() { return m_fixed; }
       DynamicBuffer &variable_buf() { return m_variable; }
       bool big_int() { return m_bigint; }
@@ -115,6 +122,9 @@ namespace Hypertable {
     virtual CellListScanner *create_scanner(ScanContextPtr &scan_ctx);
     virtual BlockCompressionCodec *create_block_compression_codec();
     virtual KeyDecompressor *create_key_decompressor();
+    virtual bool has_block_restarts() {
+      return (m_trailer.flags & CellStoreTrailerV6::BLOCK_RESTARTS) != 0;
+    }
     virtual void display_block_info();
     virtual int64_t end_of_last_block() { return m_trailer.fix_index_offset; }
 
@@ -157,6 +167,11 @@ namespace Hypertable {
     void load_bloom_filter();
     void load_block_index();
     void load_replaced_files();
+    void load_dictionary();
+    void add_block();
+    void compress_block(const char *magic);
+    void train_dictionary();
+    void write_block(DynamicBuffer &zbuf, size_t uncompressed_length);
 
     typedef BlobHashSet<> BloomFilterItems;
 
@@ -167,6 +182,8 @@ namespace Hypertable {
     bool                   m_64bit_index;
     CellStoreTrailerV6     m_trailer;
     BlockCompressionCodec *m_compressor;
+    CellStoreBlockCompressor *m_block_compressor;
+    int32_t                m_compression_threads;
     DynamicBuffer          m_buffer;
     IndexBuilder           m_index_builder;
     DispatchHandlerSynchronizer  m_sync_handler;
@@ -186,11 +203,42 @@ namespace Hypertable {
     int64_t                m_max_approx_items;
     float                  m_bloom_bits_per_item;
     float                  m_filter_false_positive_prob;
+    bool                   m_bloom_filter_blocked;
     KeyCompressorPtr       m_key_compressor;
     bool                   m_restricted_range;
     int64_t               *m_column_ttl;
     bool                   m_replaced_files_loaded;
 
+    /// Compression dictionary for data blocks, if any
+    BlockCompressionDictionaryPtr m_dictionary;
+    /// Memory accounted for #m_dictionary
+    int64_t                m_dictionary_memory;
+    /// Data blocks are being held back to train the dictionary
+    bool                   m_dictionary_sampling;
+    /// Data blocks held back for dictionary training
+    DynamicBuffer          m_dictionary_samples;
+    /// Lengths of the blocks in #m_dictionary_samples
+    std::vector<size_t>    m_dictionary_sample_sizes;
+    /// Amount of sample data at which the dictionary is trained
+    size_t                 m_dictionary_sample_target;
+    /// Block magic of each block in #m_dictionary_samples
+    std::vector<const char *> m_dictionary_sample_magic;
+
+    /// Value stream encoders indexed by column family code, empty if no
+    /// column family has a value encoding
+    std::vector<ValueStreamEncoder *> m_value_encoders;
+    /// Bytes of values in the current block held by #m_value_encoders
+    size_t                 m_encoded_value_bytes;
+    /// Number of columnar data blocks written
+    uint32_t               m_columnar_blocks;
+
+    /// Entries between restart points in data blocks, 0 for none
+    int32_t                m_restart_interval;
+    /// Number of entries in the current block
+    size_t                 m_block_entries;
+    /// Offsets of the restart points in the current block
+    std::vector<uint32_t>  m_restart_offsets;
+
     // Member that require mutex protection
 
     /// Bloom filter
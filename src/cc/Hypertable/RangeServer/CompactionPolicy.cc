@@ -0,0 +1,223 @@
+/*
+ * Copyright (C) 2007-2013 Hypertable, Inc.
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 3 of the
+ * License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+/** @file
+ * Definitions for CompactionPolicy.
+ * This file contains the method definitions for the default, size-tiered
+ * and leveled CellStore merge policies.
+ */
+
+#include "Common/Compat.h"
+#include "Common/Logger.h"
+
+#include "CompactionPolicy.h"
+
+using namespace Hypertable;
+
+bool
+CompactionPolicy::find_grouped_merge_run(const std::vector<int64_t> &sizes,
+                                         const std::vector<bool> &continues,
+                                         bool low_activity,
+                                         double write_amplification,
+                                         size_t *indexp, size_t *lenp) {
+  std::vector<int64_t> logical_sizes;
+  std::vector<size_t> starts;
+  size_t index, length;
+
+  HT_ASSERT(sizes.size() == continues.size());
+
+  for (size_t i=0; i<sizes.size(); i++) {
+    if (i > 0 && continues[i])
+      logical_sizes.back() += sizes[i];
+    else {
+      logical_sizes.push_back(sizes[i]);
+      starts.push_back(i);
+    }
+  }
+  starts.push_back(sizes.size());
+
+  if (!find_merge_run(logical_sizes, low_activity, write_amplification,
+                      &index, &length))
+    return false;
+
+  *indexp = starts[index];
+  *lenp = starts[index+length] - starts[index];
+  return true;
+}
+
+
+size_t CompactionPolicy::logical_store_count(const std::vector<bool> &continues) {
+  size_t count = 0;
+  for (size_t i=0; i<continues.size(); i++) {
+    if (i == 0 || !continues[i])
+      count++;
+  }
+  return count;
+}
+
+
+bool
+CompactionPolicyDefault::find_merge_run(const std::vector<int64_t> &sizes,
+                                        bool low_activity,
+                                        double write_amplification,
+                                        size_t *indexp, size_t *lenp) {
+  size_t index = 0;
+  size_t i = 0;
+  size_t count;
+  int64_t running_total = 0;
+
+  if (sizes.size() <= 1)
+    return false;
+
+  // If in "low activity" window, first try to be more aggresive
+  if (low_activity) {
+    bool run_found = false;
+    for (int64_t target = m_target_min*2; target <= m_target_max;
+         target += m_target_min) {
+      index = 0;
+      i = 0;
+      running_total = 0;
+
+      do {
+        running_total += sizes[i];
+
+        if (running_total >= target) {
+          count = (i - index) + 1;
+          if (count >= (size_t)2) {
+            *indexp = index;
+            *lenp = count;
+            run_found = true;
+            break;
+          }
+          // Otherwise, move the index forward by one and try again
+          running_total -= sizes[index];
+          index++;
+        }
+        i++;
+      } while (i < sizes.size());
+      if (i == sizes.size())
+        break;
+    }
+    if (run_found)
+      return true;
+  }
+
+  index = 0;
+  i = 0;
+  running_total = 0;
+  do {
+    running_total += sizes[i];
+
+    if (running_total >= m_target_min) {
+      count = (i - index) + 1;
+      if (count >= m_run_length) {
+        *indexp = index;
+        *lenp = count;
+        return true;
+      }
+      // Otherwise, move the index forward by one and try again
+      running_total -= sizes[index];
+      index++;
+    }
+    i++;
+  } while (i < sizes.size());
+
+  if ((i-index) >= m_run_length) {
+    *indexp = index;
+    *lenp = i-index;
+    return true;
+  }
+
+  return false;
+}
+
+
+bool CompactionPolicyTiered::same_tier(int64_t size, int64_t total,
+                                       size_t count) {
+  double average = (double)total / (double)count;
+  if (size < m_target_min && average < (double)m_target_min)
+    return true;
+  return (double)size <= average * m_size_ratio &&
+    (double)size * m_size_ratio >= average;
+}
+
+
+bool
+CompactionPolicyTiered::find_merge_run(const std::vector<int64_t> &sizes,
+                                       bool low_activity,
+                                       double write_amplification,
+                                       size_t *indexp, size_t *lenp) {
+  size_t end = sizes.size();
+  size_t min_run = m_min_run;
+
+  if (low_activity && write_amplification < m_max_write_amplification)
+    min_run = 2;
+
+  // Walk back from the newest store, growing each tier while the next
+  // older store is of similar size
+  while (end > 0) {
+    size_t start = end - 1;
+    int64_t total = sizes[start];
+    while (start > 0 && same_tier(sizes[start-1], total, end-start)) {
+      start--;
+      total += sizes[start];
+    }
+    if (end - start >= min_run) {
+      *indexp = start;
+      *lenp = end - start;
+      return true;
+    }
+    end = start;
+  }
+  return false;
+}
+
+
+bool
+CompactionPolicyLeveled::find_merge_run(const std::vector<int64_t> &sizes,
+                                        bool low_activity,
+                                        double write_amplification,
+                                        size_t *indexp, size_t *lenp) {
+  bool eager = write_amplification < m_max_write_amplification;
+
+  if (sizes.size() <= 1)
+    return false;
+
+  std::vector<int64_t> newer(sizes.size(), 0);
+  for (size_t i=sizes.size()-1; i>0; i--)
+    newer[i-1] = newer[i] + sizes[i];
+
+  for (size_t i=0; i+1<sizes.size(); i++) {
+    if (newer[i] * m_fanout < sizes[i])
+      continue;
+    // Store i has been outgrown.  Newer stores are a subset of what
+    // follows it, so if they are not yet worth rewriting it, nothing is.
+    size_t count = sizes.size() - i;
+    if (low_activity || (eager && newer[i] >= m_target_min) ||
+        count - 1 >= m_run_length) {
+      *indexp = i;
+      *lenp = count;
+      return true;
+    }
+    break;
+  }
+  return false;
+}
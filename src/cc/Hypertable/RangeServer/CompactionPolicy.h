@@ -0,0 +1,196 @@
+/*
+ * Copyright (C) 2007-2013 Hypertable, Inc.
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 3 of the
+ * License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+/** @file
+ * Declarations for CompactionPolicy.
+ * This file contains the type declarations for CompactionPolicy, the
+ * interface that decides which CellStores of an access group are merged,
+ * and its default, size-tiered and leveled implementations.
+ */
+
+#ifndef HYPERTABLE_COMPACTIONPOLICY_H
+#define HYPERTABLE_COMPACTIONPOLICY_H
+
+#include <vector>
+
+#include "Common/ReferenceCount.h"
+#include "Common/String.h"
+
+namespace Hypertable {
+
+  /** @addtogroup RangeServer
+   * @{
+   */
+
+  /** Chooses the run of adjacent CellStores a merging compaction combines.
+   * Access groups keep their stores ordered oldest first and only merge
+   * adjacent ones, so a policy picks a contiguous run.  The policy is
+   * selected per table with the <code>COMPACTION_POLICY</code> schema
+   * option.
+   */
+  class CompactionPolicy : public ReferenceCount {
+  public:
+
+    /** Destructor. */
+    virtual ~CompactionPolicy() { }
+
+    /** Finds a run of stores to merge.
+     * @param sizes Disk usage of each store, oldest first
+     * @param low_activity <i>true</i> if inside the low activity window
+     * @param write_amplification Bytes written to stores by the access
+     * group divided by bytes flushed to it, 0 if nothing has been flushed
+     * @param indexp Address of variable to hold index of first store in run
+     * @param lenp Address of variable to hold length of run
+     * @return <i>true</i> if a run was found, <i>false</i> otherwise
+     */
+    virtual bool find_merge_run(const std::vector<int64_t> &sizes,
+                                bool low_activity, double write_amplification,
+                                size_t *indexp, size_t *lenp) = 0;
+
+    /** Returns the policy name as given in the schema. */
+    virtual const char *name() = 0;
+
+    /** Finds a run of stores to merge when consecutive stores may be
+     * partitions of one logical store, such as the key-range partitions
+     * written by a split major compaction.  Each logical store is passed to
+     * find_merge_run() as a single store whose size is the sum of its
+     * partitions, so a run always covers whole logical stores.
+     * @param sizes Disk usage of each store, oldest first
+     * @param continues For each store, <i>true</i> if it belongs to the same
+     * logical store as the store before it
+     * @param low_activity <i>true</i> if inside the low activity window
+     * @param write_amplification Write amplification of the access group
+     * @param indexp Address of variable to hold index of first store in run
+     * @param lenp Address of variable to hold number of stores in run
+     * @return <i>true</i> if a run was found, <i>false</i> otherwise
+     */
+    bool find_grouped_merge_run(const std::vector<int64_t> &sizes,
+                                const std::vector<bool> &continues,
+                                bool low_activity, double write_amplification,
+                                size_t *indexp, size_t *lenp);
+
+    /** Returns the number of logical stores.
+     * @param continues For each store, <i>true</i> if it belongs to the same
+     * logical store as the store before it
+     * @return Number of logical stores
+     */
+    static size_t logical_store_count(const std::vector<bool> &continues);
+  };
+
+  /// Smart pointer to CompactionPolicy
+  typedef intrusive_ptr<CompactionPolicy> CompactionPolicyPtr;
+
+  /** Original merge heuristic.  Merges the first run whose combined size
+   * reaches the minimum target size once it is at least
+   * <code>run_length</code> stores long, or any such run of two or more
+   * stores, growing up to the maximum target size, during the low activity
+   * window.
+   */
+  class CompactionPolicyDefault : public CompactionPolicy {
+  public:
+    CompactionPolicyDefault(int64_t target_min, int64_t target_max,
+                            size_t run_length)
+      : m_target_min(target_min), m_target_max(target_max),
+        m_run_length(run_length) { }
+
+    virtual bool find_merge_run(const std::vector<int64_t> &sizes,
+                                bool low_activity, double write_amplification,
+                                size_t *indexp, size_t *lenp);
+
+    virtual const char *name() { return "default"; }
+
+  private:
+    int64_t m_target_min;
+    int64_t m_target_max;
+    size_t m_run_length;
+  };
+
+  /** Size-tiered policy, optimized for ingest.  Stores smaller than the
+   * minimum target size share the lowest tier; larger ones share a tier
+   * with neighbours within <code>size_ratio</code> of the tier's average.
+   * A tier is merged once it holds <code>min_run</code> stores, so each
+   * cell is rewritten roughly once per tier (low write amplification) at
+   * the cost of more stores per lookup.  While the access group's write
+   * amplification is below <code>max_write_amplification</code>, tiers of
+   * two or more stores are also merged during the low activity window,
+   * spending the spare write budget on fewer stores per lookup.
+   */
+  class CompactionPolicyTiered : public CompactionPolicy {
+  public:
+    CompactionPolicyTiered(int64_t target_min, double size_ratio,
+                           size_t min_run, double max_write_amplification)
+      : m_target_min(target_min), m_size_ratio(size_ratio),
+        m_min_run(min_run < 2 ? 2 : min_run),
+        m_max_write_amplification(max_write_amplification) { }
+
+    virtual bool find_merge_run(const std::vector<int64_t> &sizes,
+                                bool low_activity, double write_amplification,
+                                size_t *indexp, size_t *lenp);
+
+    virtual const char *name() { return "tiered"; }
+
+  private:
+    bool same_tier(int64_t size, int64_t total, size_t count);
+
+    int64_t m_target_min;
+    double m_size_ratio;
+    size_t m_min_run;
+    double m_max_write_amplification;
+  };
+
+  /** Leveled policy, optimized for reads.  Each store is kept at least
+   * <code>fanout</code> times larger than all newer stores combined.  Newly
+   * flushed stores collect until they reach the minimum target size or
+   * <code>run_length</code> stores, and are then merged into the oldest
+   * store they have outgrown.  This bounds stores per lookup to about
+   * log<sub>fanout</sub>(data size) at the cost of rewriting each level
+   * up to <code>fanout</code> times.  Once the access group's write
+   * amplification reaches <code>max_write_amplification</code>, new stores
+   * are no longer merged as soon as they reach the minimum target size,
+   * only when there are <code>run_length</code> of them or during the low
+   * activity window.
+   */
+  class CompactionPolicyLeveled : public CompactionPolicy {
+  public:
+    CompactionPolicyLeveled(int64_t target_min, int32_t fanout,
+                            size_t run_length, double max_write_amplification)
+      : m_target_min(target_min), m_fanout(fanout < 2 ? 2 : fanout),
+        m_run_length(run_length),
+        m_max_write_amplification(max_write_amplification) { }
+
+    virtual bool find_merge_run(const std::vector<int64_t> &sizes,
+                                bool low_activity, double write_amplification,
+                                size_t *indexp, size_t *lenp);
+
+    virtual const char *name() { return "leveled"; }
+
+  private:
+    int64_t m_target_min;
+    int64_t m_fanout;
+    size_t m_run_length;
+    double m_max_write_amplification;
+  };
+
+  /** @}*/
+
+}
+
+#endif // HYPERTABLE_COMPACTIONPOLICY_H
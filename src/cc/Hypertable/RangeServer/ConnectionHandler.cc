@@ -36,6 +36,7 @@ extern "C" {
 #include "Hypertable/Lib/RangeServerProtocol.h"
 
 #include "RequestHandlerAcknowledgeLoad.h"
+#include "RequestHandlerAttachCellStores.h"
 #include "RequestHandlerCompact.h"
 #include "RequestHandlerDestroyScanner.h"
 #include "RequestHandlerDump.h"
@@ -143,6 +144,10 @@ void ConnectionHandler::handle(EventPtr &event) {
                                               event);
         break;
 
+      case RangeServerProtocol::COMMAND_ATTACH_CELLSTORES:
+        handler = new RequestHandlerAttachCellStores(m_comm, m_range_server_ptr.get(),
+                                                     event);
+        break;
       case RangeServerProtocol::COMMAND_RELINQUISH_RANGE:
         handler = new RequestHandlerRelinquishRange(m_comm, m_range_server_ptr.get(),
                                                     event);
@@ -30,71 +30,148 @@ using std::pair;
 
 atomic_t FileBlockCache::ms_next_file_id = ATOMIC_INIT(0);
 
+namespace {
+
+  /// Fraction of a shard's limit that the SLRU protected segment may occupy
+  const double PROTECTED_FRACTION = 0.8;
+
+  struct IncrementRefCount {
+    template <typename EntryT>
+    void operator()(EntryT &entry) {
+      entry.ref_count++;
+    }
+  };
+
+}
+
+FileBlockCache::FileBlockCache(int64_t min_memory, int64_t max_memory,
+                               bool compressed, size_t shard_count,
+                               Policy policy)
+  : m_policy(policy), m_compressed(compressed) {
+  HT_ASSERT(min_memory <= max_memory);
+  if (shard_count == 0)
+    shard_count = 1;
+  while (shard_count > 1 &&
+         max_memory / (int64_t)shard_count < MIN_SHARD_MEMORY)
+    shard_count--;
+  m_shards.resize(shard_count, 0);
+  for (size_t i=0; i<shard_count; i++)
+    m_shards[i] = new Shard(shard_share(min_memory, i),
+                            shard_share(max_memory, i));
+}
+
 FileBlockCache::~FileBlockCache() {
-  ScopedLock lock(m_mutex);
-  for (BlockCache::const_iterator iter = m_cache.begin();
-       iter != m_cache.end(); ++iter)
-    delete [] (*iter).block;
-  m_cache.clear();
+  foreach_ht (Shard *shard, m_shards) {
+    {
+      ScopedLock lock(shard->mutex);
+      for (BlockCache::const_iterator iter = shard->probation.begin();
+           iter != shard->probation.end(); ++iter)
+        delete [] (*iter).block;
+      shard->probation.clear();
+      for (BlockCache::const_iterator iter = shard->protect.begin();
+           iter != shard->protect.end(); ++iter)
+        delete [] (*iter).block;
+      shard->protect.clear();
+    }
+    delete shard;
+  }
 }
 
 bool
 FileBlockCache::checkout(int file_id, uint64_t file_offset, uint8_t **blockp,
                          uint32_t *lengthp) {
-  ScopedLock lock(m_mutex);
-  HashIndex &hash_index = m_cache.get<1>();
+  int64_t key = make_key(file_id, file_offset);
+  Shard *shard = get_shard(key);
+  ScopedLock lock(shard->mutex);
+  HashIndex &protect_index = shard->protect.get<1>();
+  HashIndex &probation_index = shard->probation.get<1>();
   HashIndex::iterator iter;
 
-  m_accesses++;
+  shard->accesses++;
 
-  if ((iter = hash_index.find(make_key(file_id, file_offset))) == hash_index.end())
+  if ((iter = protect_index.find(key)) != protect_index.end()) {
+    // Move to most recently used end of protected segment
+    Sequence &sequence = shard->protect.get<0>();
+    sequence.relocate(sequence.end(), shard->protect.project<0>(iter));
+    protect_index.modify(iter, IncrementRefCount());
+    *blockp = (*iter).block;
+    *lengthp = (*iter).length;
+  }
+  else if ((iter = probation_index.find(key)) != probation_index.end()) {
+    if (m_policy == SLRU) {
+      // Second access, promote to protected segment.  A block larger than
+      // the protected segment's share of the limit gets demoted right away
+      // by shrink_protected(), so it is returned from the copy.
+      BlockCacheEntry entry = *iter;
+      entry.ref_count++;
+      probation_index.erase(iter);
+      pair<Sequence::iterator, bool> insert_result =
+        shard->protect.push_back(entry);
+      assert(insert_result.second);
+      (void)insert_result;
+      shard->protected_used += entry.length;
+      shrink_protected(shard);
+      *blockp = entry.block;
+      *lengthp = entry.length;
+    }
+    else {
+      Sequence &sequence = shard->probation.get<0>();
+      sequence.relocate(sequence.end(), shard->probation.project<0>(iter));
+      probation_index.modify(iter, IncrementRefCount());
+      *blockp = (*iter).block;
+      *lengthp = (*iter).length;
+    }
+  }
+  else
     return false;
 
-  BlockCacheEntry entry = *iter;
-  entry.ref_count++;
-
-  hash_index.erase(iter);
-
-  pair<Sequence::iterator, bool> insert_result = m_cache.push_back(entry);
-  assert(insert_result.second);
-
-  *blockp = (*insert_result.first).block;
-  *lengthp = (*insert_result.first).length;
-
-  m_hits++;
+  shard->hits++;
   return true;
 }
 
 
 void FileBlockCache::checkin(int file_id, uint64_t file_offset) {
-  ScopedLock lock(m_mutex);
-  HashIndex &hash_index = m_cache.get<1>();
+  int64_t key = make_key(file_id, file_offset);
+  Shard *shard = get_shard(key);
+  ScopedLock lock(shard->mutex);
+  HashIndex &protect_index = shard->protect.get<1>();
+  HashIndex &probation_index = shard->probation.get<1>();
   HashIndex::iterator iter;
 
-  iter = hash_index.find(make_key(file_id, file_offset));
+  if ((iter = protect_index.find(key)) != protect_index.end()) {
+    assert((*iter).ref_count > 0);
+    protect_index.modify(iter, DecrementRefCount());
+    return;
+  }
+
+  iter = probation_index.find(key);
 
-  assert(iter != hash_index.end() && (*iter).ref_count > 0);
+  assert(iter != probation_index.end() && (*iter).ref_count > 0);
 
-  hash_index.modify(iter, DecrementRefCount());
+  probation_index.modify(iter, DecrementRefCount());
 }
 
 
 bool
 FileBlockCache::insert(int file_id, uint64_t file_offset,
 		       uint8_t *block, uint32_t length, bool checkout) {
-  ScopedLock lock(m_mutex);
-  HashIndex &hash_index = m_cache.get<1>();
-
-  if (hash_index.find(make_key(file_id, file_offset)) != hash_index.end())
+  int64_t key = make_key(file_id, file_offset);
+  Shard *shard = get_shard(key);
+  ScopedLock lock(shard->mutex);
+  HashIndex &protect_index = shard->protect.get<1>();
+  HashIndex &probation_index = shard->probation.get<1>();
+
+  if (protect_index.find(key) != protect_index.end() ||
+      probation_index.find(key) != probation_index.end())
     return false;
 
-  if (m_available < length)
-    make_room(length);
+  if (shard->available < length)
+    shard->make_room(length);
 
-  if (m_available < length) {
-    if ((length-m_available) <= (m_max_memory-m_limit)) {
-      m_limit += (length-m_available);
-      m_available += (length-m_available);
+  if (shard->available < length) {
+    if ((length-shard->available) <= (shard->max_memory-shard->limit)) {
+      shard->limit += (length-shard->available);
+      shard->available += (length-shard->available);
     }
     else
       return false;
@@ -105,23 +182,28 @@ FileBlockCache::insert(int file_id, uint64_t file_offset,
   entry.length = length;
   entry.ref_count = checkout ? 1 : 0;
 
-  pair<Sequence::iterator, bool> insert_result = m_cache.push_back(entry);
+  pair<Sequence::iterator, bool> insert_result =
+    shard->probation.push_back(entry);
   assert(insert_result.second);
   (void)insert_result;
 
-  m_available -= length;
+  shard->available -= length;
 
   return true;
 }
 
 
 bool FileBlockCache::contains(int file_id, uint64_t file_offset) {
-  ScopedLock lock(m_mutex);
-  HashIndex &hash_index = m_cache.get<1>();
-  m_accesses++;
-
-  if (hash_index.find(make_key(file_id, file_offset)) != hash_index.end()) {
-    m_hits++;
+  int64_t key = make_key(file_id, file_offset);
+  Shard *shard = get_shard(key);
+  ScopedLock lock(shard->mutex);
+  HashIndex &protect_index = shard->protect.get<1>();
+  HashIndex &probation_index = shard->probation.get<1>();
+  shard->accesses++;
+
+  if (protect_index.find(key) != protect_index.end() ||
+      probation_index.find(key) != probation_index.end()) {
+    shard->hits++;
     return true;
   }
   else
@@ -130,54 +212,146 @@ bool FileBlockCache::contains(int file_id, uint64_t file_offset) {
 
 
 void FileBlockCache::increase_limit(int64_t amount) {
-  ScopedLock lock(m_mutex);
-  int64_t adjusted_amount = amount;
-  if ((m_max_memory-m_limit) < amount)
-    adjusted_amount = m_max_memory - m_limit;
-  m_limit += adjusted_amount;
-  m_available += adjusted_amount;
+  for (size_t i=0; i<m_shards.size(); i++) {
+    Shard *shard = m_shards[i];
+    ScopedLock lock(shard->mutex);
+    int64_t adjusted_amount = shard_share(amount, i);
+    if ((shard->max_memory-shard->limit) < adjusted_amount)
+      adjusted_amount = shard->max_memory - shard->limit;
+    shard->limit += adjusted_amount;
+    shard->available += adjusted_amount;
+  }
 }
 
 
 int64_t FileBlockCache::decrease_limit(int64_t amount) {
-  ScopedLock lock(m_mutex);
   int64_t memory_freed = 0;
-  if (m_available < amount) {
-    if (amount > (m_limit - m_min_memory))
-      amount = m_limit - m_min_memory;
-    memory_freed = make_room(amount);
-    if (m_available < amount)
-      amount = m_available;
-  }
-  m_available -= amount;
-  m_limit -= amount;
+  for (size_t i=0; i<m_shards.size(); i++) {
+    Shard *shard = m_shards[i];
+    ScopedLock lock(shard->mutex);
+    int64_t shard_amount = shard_share(amount, i);
+    if (shard->available < shard_amount) {
+      if (shard_amount > (shard->limit - shard->min_memory))
+        shard_amount = shard->limit - shard->min_memory;
+      memory_freed += shard->make_room(shard_amount);
+      if (shard->available < shard_amount)
+        shard_amount = shard->available;
+    }
+    shard->available -= shard_amount;
+    shard->limit -= shard_amount;
+    shrink_protected(shard);
+  }
   return memory_freed;
 }
 
 
-int64_t FileBlockCache::make_room(int64_t amount) {
-  BlockCache::iterator iter = m_cache.begin();
+int64_t FileBlockCache::get_limit() {
+  int64_t limit = 0;
+  foreach_ht (Shard *shard, m_shards) {
+    ScopedLock lock(shard->mutex);
+    limit += shard->limit;
+  }
+  return limit;
+}
+
+
+void FileBlockCache::cap_memory_use() {
+  foreach_ht (Shard *shard, m_shards) {
+    ScopedLock lock(shard->mutex);
+    int64_t memory_used = shard->limit - shard->available;
+    if (memory_used > shard->min_memory) {
+      shard->limit -= shard->available;
+      shard->available = 0;
+    }
+    else {
+      shard->limit = shard->min_memory;
+      shard->available = shard->limit - memory_used;
+    }
+  }
+}
+
+
+int64_t FileBlockCache::memory_used() {
+  int64_t used = 0;
+  foreach_ht (Shard *shard, m_shards) {
+    ScopedLock lock(shard->mutex);
+    used += shard->limit - shard->available;
+  }
+  return used;
+}
+
+
+int64_t FileBlockCache::available() {
+  int64_t available = 0;
+  foreach_ht (Shard *shard, m_shards) {
+    ScopedLock lock(shard->mutex);
+    available += shard->available;
+  }
+  return available;
+}
+
+
+void FileBlockCache::shrink_protected(Shard *shard) {
+  int64_t protected_limit = (int64_t)(shard->limit * PROTECTED_FRACTION);
+  while (shard->protected_used > protected_limit && !shard->protect.empty()) {
+    BlockCacheEntry entry = shard->protect.front();
+    shard->protect.pop_front();
+    shard->protected_used -= entry.length;
+    shard->probation.push_back(entry);
+  }
+}
+
+
+int64_t FileBlockCache::Shard::make_room(int64_t amount) {
   int64_t amount_freed = 0;
-  while (iter != m_cache.end()) {
+  evict_from(probation, amount, &amount_freed);
+  if (available < amount)
+    evict_from(protect, amount, &amount_freed);
+  return amount_freed;
+}
+
+
+void FileBlockCache::Shard::evict_from(BlockCache &cache, int64_t amount,
+                                       int64_t *amount_freed) {
+  BlockCache::iterator iter = cache.begin();
+  while (iter != cache.end() && available < amount) {
     if ((*iter).ref_count == 0) {
-      m_available += (*iter).length;
-      amount_freed += (*iter).length;
+      available += (*iter).length;
+      *amount_freed += (*iter).length;
+      if (&cache == &protect)
+        protected_used -= (*iter).length;
+      evictions++;
       delete [] (*iter).block;
-      iter = m_cache.erase(iter);
-      if (m_available >= amount)
-	break;
+      iter = cache.erase(iter);
     }
     else
       ++iter;
   }
-  return amount_freed;
 }
 
 void FileBlockCache::get_stats(uint64_t *max_memoryp, uint64_t *available_memoryp,
                                uint64_t *accessesp, uint64_t *hitsp) {
-  ScopedLock lock(m_mutex);
-  *max_memoryp = m_limit;
-  *available_memoryp = m_available;
-  *accessesp = m_accesses;
-  *hitsp = m_hits;
+  *max_memoryp = *available_memoryp = *accessesp = *hitsp = 0;
+  foreach_ht (Shard *shard, m_shards) {
+    ScopedLock lock(shard->mutex);
+    *max_memoryp += shard->limit;
+    *available_memoryp += shard->available;
+    *accessesp += shard->accesses;
+    *hitsp += shard->hits;
+  }
+}
+
+void FileBlockCache::get_shard_stats(std::vector<ShardStats> &stats) {
+  ShardStats shard_stats;
+  stats.clear();
+  stats.reserve(m_shards.size());
+  foreach_ht (Shard *shard, m_shards) {
+    ScopedLock lock(shard->mutex);
+    shard_stats.limit = shard->limit;
+    shard_stats.available = shard->available;
+    shard_stats.accesses = shard->accesses;
+    shard_stats.hits = shard->hits;
+    shard_stats.evictions = shard->evictions;
+    stats.push_back(shard_stats);
+  }
 }
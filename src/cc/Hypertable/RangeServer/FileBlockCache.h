@@ -22,10 +22,13 @@
 #ifndef HYPERTABLE_FILEBLOCKCACHE_H
 #define HYPERTABLE_FILEBLOCKCACHE_H
 
+#include <vector>
+
 #include <boost/multi_index_container.hpp>
 #include <boost/multi_index/hashed_index.hpp>
 #include <boost/multi_index/mem_fun.hpp>
 #include <boost/multi_index/sequenced_index.hpp>
+#include <boost/noncopyable.hpp>
 
 #include "Common/Mutex.h"
 #include "Common/atomic.h"
@@ -33,15 +36,50 @@
 namespace Hypertable {
   using namespace boost::multi_index;
 
+  /**
+   * Cache of CellStore blocks keyed by (file id, file offset).  The cache is
+   * split into a number of shards, each with its own lock, memory limit and
+   * replacement state, so concurrent scanners touching different blocks do
+   * not contend with each other.  The memory limit is divided evenly among
+   * the shards.  Each shard uses either plain LRU replacement or segmented
+   * LRU (SLRU).  With SLRU, newly inserted blocks go into a probationary
+   * segment and are only promoted into the protected segment when they are
+   * accessed again, so a single large scan can only flush the probationary
+   * segment and not the working set of blocks that are read repeatedly.
+   */
   class FileBlockCache {
 
     static atomic_t ms_next_file_id;
 
   public:
-    FileBlockCache(int64_t min_memory, int64_t max_memory, bool compressed)
-      : m_min_memory(min_memory), m_max_memory(max_memory), m_limit(max_memory),
-	m_available(max_memory), m_accesses(0), m_hits(0), m_compressed(compressed)
-    { HT_ASSERT(min_memory <= max_memory); }
+
+    /** Replacement policy */
+    enum Policy {
+      /// Least recently used
+      LRU = 0,
+      /// Segmented LRU (scan resistant)
+      SLRU = 1
+    };
+
+    /** Per-shard statistics */
+    struct ShardStats {
+      uint64_t limit;
+      uint64_t available;
+      uint64_t accesses;
+      uint64_t hits;
+      uint64_t evictions;
+    };
+
+    /** Constructor.
+     * @param min_memory Minimum memory limit
+     * @param max_memory Maximum memory limit
+     * @param compressed Cache compressed blocks
+     * @param shard_count Number of shards (reduced if the shards would end
+     * up smaller than MIN_SHARD_MEMORY)
+     * @param policy Replacement policy
+     */
+    FileBlockCache(int64_t min_memory, int64_t max_memory, bool compressed,
+                   size_t shard_count=1, Policy policy=LRU);
     ~FileBlockCache();
 
     bool compressed() { return m_compressed; }
@@ -65,46 +103,36 @@ namespace Hypertable {
      */
     int64_t decrease_limit(int64_t amount);
 
-    int64_t get_limit() {
-      ScopedLock lock(m_mutex);
-      return m_limit;
-    }
+    int64_t get_limit();
 
     /**
      * Sets limit to memory currently used, it will not reduce the limit
      * below min_memory
      */
-    void cap_memory_use() {
-      ScopedLock lock(m_mutex);
-      int64_t memory_used = m_limit - m_available;
-      if (memory_used > m_min_memory) {
-        m_limit -= m_available;
-        m_available = 0;
-      }
-      else {
-        m_limit = m_min_memory;
-        m_available = m_limit - memory_used;
-      }
-    }
+    void cap_memory_use();
 
-    int64_t memory_used() {
-      ScopedLock lock(m_mutex);
-      return (int64_t)(m_limit - m_available);
-    }
+    int64_t memory_used();
 
-    int64_t available() {
-      ScopedLock lock(m_mutex);
-      return m_available;
-    }
+    int64_t available();
 
     static int get_next_file_id() {
       return atomic_inc_return(&ms_next_file_id);
     }
     void get_stats(uint64_t *max_memoryp, uint64_t *available_memoryp,
                    uint64_t *accessesp, uint64_t *hitsp);
-  private:
 
-    int64_t make_room(int64_t amount);
+    /** Gathers statistics for each shard.
+     * @param stats Vector to be filled with one entry per shard
+     */
+    void get_shard_stats(std::vector<ShardStats> &stats);
+
+    /// Returns the number of shards
+    size_t shard_count() const { return m_shards.size(); }
+
+    /// Smallest memory limit a shard is allowed to have
+    static const int64_t MIN_SHARD_MEMORY = 8LL * 1024LL * 1024LL;
+
+  private:
 
     inline static int64_t make_key(int file_id, uint64_t file_offset) {
       HT_ASSERT(file_id < 268435456LL);        // Can't be larger than 2^28
@@ -151,14 +179,59 @@ namespace Hypertable {
     typedef BlockCache::nth_index<0>::type Sequence;
     typedef BlockCache::nth_index<1>::type HashIndex;
 
-    Mutex         m_mutex;
-    BlockCache    m_cache;
-    int64_t      m_min_memory;
-    int64_t      m_max_memory;
-    int64_t      m_limit;
-    int64_t      m_available;
-    uint64_t     m_accesses;
-    uint64_t     m_hits;
+    /** One independently locked partition of the cache.  With the SLRU
+     * policy, <code>probation</code> holds blocks that have been accessed
+     * once and <code>protect</code> holds blocks that have been accessed
+     * at least twice.  With the LRU policy only <code>probation</code> is
+     * used.
+     */
+    class Shard : boost::noncopyable {
+    public:
+      Shard(int64_t min_memory, int64_t max_memory)
+        : min_memory(min_memory), max_memory(max_memory), limit(max_memory),
+          available(max_memory), protected_used(0), accesses(0), hits(0),
+          evictions(0) { }
+      int64_t make_room(int64_t amount);
+      void evict_from(BlockCache &cache, int64_t amount,
+                      int64_t *amount_freed);
+      Mutex    mutex;
+      BlockCache probation;
+      BlockCache protect;
+      int64_t  min_memory;
+      int64_t  max_memory;
+      int64_t  limit;
+      int64_t  available;
+      int64_t  protected_used;
+      uint64_t accesses;
+      uint64_t hits;
+      uint64_t evictions;
+    };
+
+    Shard *get_shard(int64_t key) {
+      uint64_t hash = (uint64_t)key * 0x9E3779B97F4A7C15ULL;
+      return m_shards[(hash >> 32) % m_shards.size()];
+    }
+
+    /** Moves the LRU entries of the protected segment back to the
+     * probationary segment until the protected segment is within its
+     * share of the shard limit.
+     */
+    void shrink_protected(Shard *shard);
+
+    /** Splits <code>amount</code> evenly among the shards.
+     * @param amount Amount to split
+     * @param i Shard index
+     * @return Share of shard <code>i</code>
+     */
+    int64_t shard_share(int64_t amount, size_t i) {
+      int64_t share = amount / (int64_t)m_shards.size();
+      if (i == 0)
+        share += amount % (int64_t)m_shards.size();
+      return share;
+    }
+
+    std::vector<Shard *> m_shards;
+    Policy       m_policy;
     bool         m_compressed;
   };
 
@@ -24,62 +24,146 @@
 
 namespace Hypertable {
 
+  namespace {
+
+    /// Minimum length of a run of pinned memory that is sent in place
+    /// rather than copied
+    const size_t MIN_REFERENCE_RUN = 1024;
+
+    /** Determines the serialized value to return for a cell.  Counters are
+     * converted to ASCII (into <code>counter_value</code>) and keys-only
+     * scans as well as missing values yield an empty value.
+     * @param scan_context Scan context
+     * @param key Key of cell
+     * @param value Value of cell
+     * @param counter_value Buffer to hold converted counter value
+     * @param value_lenp Address of variable to hold length of returned value
+     * @return Pointer to serialized value
+     */
+    const uint8_t *cell_value(ScanContext *scan_context, Key &key,
+                              ByteString &value, DynamicBuffer &counter_value,
+                              size_t *value_lenp) {
+      static const uint8_t empty_value = 0;
+      char numbuf[24];
+
+      if (scan_context->spec->keys_only)
+        value.ptr = 0;
+      else if (scan_context->family_info[key.column_family_code].counter &&
+               key.flag == FLAG_INSERT) {
+        const uint8_t *decode;
+        int64_t count;
+        size_t remain = value.decode_length(&decode);
+        // value must be encoded 64 bit int followed by '=' character
+        if (remain != 9)
+          HT_FATAL_OUT << "Expected counter to be encoded 64 bit int but remain=" << remain
+            << " ,key=" << key << " ,value="<< value.str() << HT_END;
+
+        count = Serialization::decode_i64(&decode, &remain);
+        HT_ASSERT(*decode == '=');
+        //convert counter to ascii
+        sprintf(numbuf, "%lld", (Lld) count);
+        counter_value.clear();
+        append_as_byte_string(counter_value, numbuf, strlen(numbuf));
+        *value_lenp = counter_value.fill();
+        return counter_value.base;
+      }
+
+      if (value.ptr == 0) {
+        *value_lenp = 1;
+        return &empty_value;
+      }
+      *value_lenp = value.length();
+      return value.ptr;
+    }
+
+    /** Assembles a ScanBlockSegments object.  Consecutive pieces of pinned
+     * memory that are adjacent are merged into runs; runs of at least
+     * MIN_REFERENCE_RUN bytes are referenced, shorter ones are copied.
+     */
+    class SegmentBuilder {
+    public:
+      SegmentBuilder(ScanBlockSegments *block)
+        : m_block(block), m_run_base(0), m_run_end(0) { }
+
+      /** Adds a piece of the scan block.
+       * @param ptr Start of piece
+       * @param len Length of piece
+       * @param pin Pin containing the piece, or 0 if piece is to be copied
+       */
+      void add(const uint8_t *ptr, size_t len, CellMemoryPin *pin) {
+        if (m_run_base && ptr == m_run_end && pin == m_run_pin.get()) {
+          m_run_end += len;
+          return;
+        }
+        flush_run();
+        if (pin) {
+          m_run_pin = pin;
+          m_run_base = ptr;
+          m_run_end = ptr + len;
+        }
+        else
+          copy(ptr, len);
+      }
+
+      /// Completes the current run
+      void flush_run() {
+        if (m_run_base == 0)
+          return;
+        size_t len = m_run_end - m_run_base;
+        if (len >= MIN_REFERENCE_RUN) {
+          if (m_block->pins.empty() || m_block->pins.back() != m_run_pin)
+            m_block->pins.push_back(m_run_pin);
+          m_block->segments.push_back(std::make_pair(m_run_base, len));
+          m_block->size += len;
+        }
+        else
+          copy(m_run_base, len);
+        m_run_pin = 0;
+        m_run_base = m_run_end = 0;
+      }
+
+    private:
+
+      void copy(const uint8_t *ptr, size_t len) {
+        DynamicBuffer &buf = m_block->copy_buf;
+        std::vector<std::pair<const uint8_t *, size_t> > &segments =
+          m_block->segments;
+        if (!segments.empty() &&
+            segments.back().first + segments.back().second == buf.ptr)
+          segments.back().second += len;
+        else
+          segments.push_back(std::make_pair(buf.ptr, len));
+        buf.add_unchecked(ptr, len);
+        m_block->size += len;
+      }
+
+      ScanBlockSegments *m_block;
+      CellMemoryPinPtr m_run_pin;
+      const uint8_t *m_run_base;
+      const uint8_t *m_run_end;
+    };
+
+  }
+
   bool
   FillScanBlock(CellListScannerPtr &scanner, DynamicBuffer &dbuf, int64_t buffer_size) {
     Key key;
     ByteString value;
+    const uint8_t *value_ptr;
     size_t value_len;
     bool more = true;
     size_t limit = buffer_size;
     size_t remaining = buffer_size;
     uint8_t *ptr;
     ScanContext *scan_context = scanner->scan_context();
-    bool keys_only = scan_context->spec->keys_only;
-    char numbuf[24];
     DynamicBuffer counter_value;
-    bool counter;
-    String empty_value("");
 
     assert(dbuf.base == 0);
 
     while ((more = scanner->get(key, value))) {
-      counter = false;
 
-      if (keys_only) {
-        value.ptr = 0;
-        counter_value.clear();
-        value_len = 0;
-      }
-      else {
-        counter = scan_context->family_info[key.column_family_code].counter &&
-          (key.flag == FLAG_INSERT);
-
-        if (counter) {
-          const uint8_t *decode;
-          int64_t count;
-          size_t remain = value.decode_length(&decode);
-          // value must be encoded 64 bit int followed by '=' character
-          if (remain != 9)
-            HT_FATAL_OUT << "Expected counter to be encoded 64 bit int but remain=" << remain
-              << " ,key=" << key << " ,value="<< value.str() << HT_END;
-
-          count = Serialization::decode_i64(&decode, &remain);
-          HT_ASSERT(*decode == '=');
-          //convert counter to ascii
-          sprintf(numbuf, "%lld", (Lld) count);
-          value_len = strlen(numbuf);
-          counter_value.clear();
-          append_as_byte_string(counter_value, numbuf, value_len);
-          value_len = counter_value.fill();
-        }
-        else
-          value_len = value.length();
-      }
-
-      if (value.ptr == 0) {
-        value.ptr = (const uint8_t *)empty_value.c_str();
-        value_len = 1;
-      }
+      value_ptr = cell_value(scan_context, key, value, counter_value,
+                             &value_len);
 
       if (dbuf.base == 0) {
         if (key.length + value_len > limit) {
@@ -91,14 +175,8 @@ namespace Hypertable {
         dbuf.ptr = dbuf.base + 4;
       }
       if (key.length + value_len <= remaining) {
-
         dbuf.add_unchecked(key.serial.ptr, key.length);
-
-        if (counter)
-          dbuf.add_unchecked(counter_value.base, value_len);
-        else
-          dbuf.add_unchecked(value.ptr, value_len);
-
+        dbuf.add_unchecked(value_ptr, value_len);
         remaining -= (key.length + value_len);
         scanner->forward();
       }
@@ -117,4 +195,67 @@ namespace Hypertable {
     return more;
   }
 
+  bool
+  FillScanBlock(CellListScannerPtr &scanner, ScanBlockSegments *block,
+                int64_t buffer_size) {
+    Key key;
+    ByteString value;
+    const uint8_t *value_ptr;
+    size_t value_len;
+    bool more = true;
+    size_t limit = buffer_size;
+    size_t remaining = buffer_size;
+    uint8_t *ptr;
+    ScanContext *scan_context = scanner->scan_context();
+    DynamicBuffer counter_value;
+    DynamicBuffer &copy_buf = block->copy_buf;
+    SegmentBuilder builder(block);
+    CellMemoryPin *pin;
+
+    assert(copy_buf.base == 0 && block->segments.empty());
+
+    while ((more = scanner->get(key, value))) {
+
+      value_ptr = cell_value(scan_context, key, value, counter_value,
+                             &value_len);
+
+      if (copy_buf.base == 0) {
+        if (key.length + value_len > limit) {
+          limit = key.length + value_len;
+          remaining = limit;
+        }
+        // The copy buffer must not move once segments point into it
+        copy_buf.reserve(4 + limit);
+        copy_buf.ptr = copy_buf.base + 4;
+        block->segments.push_back(std::make_pair(copy_buf.base, (size_t)4));
+        block->size = 4;
+      }
+      if (key.length + value_len <= remaining) {
+        pin = scanner->get_pin();
+        builder.add(key.serial.ptr, key.length,
+                    (pin && pin->contains(key.serial.ptr, key.length)) ? pin : 0);
+        builder.add(value_ptr, value_len,
+                    (pin && pin->contains(value_ptr, value_len)) ? pin : 0);
+        remaining -= (key.length + value_len);
+        scanner->forward();
+      }
+      else
+        break;
+    }
+
+    builder.flush_run();
+
+    if (copy_buf.base == 0) {
+      copy_buf.reserve(4);
+      copy_buf.ptr = copy_buf.base + 4;
+      block->segments.push_back(std::make_pair(copy_buf.base, (size_t)4));
+      block->size = 4;
+    }
+
+    ptr = copy_buf.base;
+    Serialization::encode_i32(&ptr, block->size - 4);
+
+    return more;
+  }
+
 }
@@ -22,15 +22,67 @@
 #ifndef HYPERTABLE_FILLSCANBLOCK_H
 #define HYPERTABLE_FILLSCANBLOCK_H
 
+#include <utility>
+#include <vector>
+
 #include "Common/DynamicBuffer.h"
+#include "Common/ReferenceCount.h"
+
+#include "AsyncComm/CommBuf.h"
 
 #include "CellListScanner.h"
 
 namespace Hypertable {
 
+  /** Scan block held as a list of segments.  Runs of cells that lie in
+   * memory pinned by the scanner (see CellListScanner::get_pin) are
+   * referenced in place, everything else (including the leading encoded
+   * length) is copied into #copy_buf.  The segments, in order, make up the
+   * same byte sequence that FillScanBlock produces into a DynamicBuffer.
+   */
+  class ScanBlockSegments : public ReferenceCount {
+  public:
+    ScanBlockSegments() : size(0) { }
+
+    /** Appends segments to a CommBuf as scatter/gather segments.  The
+     * CommBuf holds a reference to this object, which keeps the copy buffer
+     * and the pinned memory valid until it has been sent.
+     * @param cbuf CommBuf to add segments to
+     */
+    void add_to(CommBuf *cbuf) {
+      for (size_t i=0; i<segments.size(); i++)
+        cbuf->append_segment(segments[i].first, segments[i].second);
+      cbuf->add_holder(this);
+    }
+
+    /// Buffer holding encoded length and copied cells
+    DynamicBuffer copy_buf;
+
+    /// Segments (start address, length)
+    std::vector<std::pair<const uint8_t *, size_t> > segments;
+
+    /// Pins of memory referenced by #segments
+    std::vector<CellMemoryPinPtr> pins;
+
+    /// Total size of all segments
+    size_t size;
+  };
+  typedef intrusive_ptr<ScanBlockSegments> ScanBlockSegmentsPtr;
+
   bool FillScanBlock(CellListScannerPtr &scanner, DynamicBuffer &dbuf,
                      int64_t buffer_size);
 
+  /** Fills a scan block without copying cells that lie in pinned memory.
+   * Behaves like the DynamicBuffer variant, but leaves the result in
+   * <code>block</code>.
+   * @param scanner Scanner from which to read cells
+   * @param block Scan block to fill (must be empty)
+   * @param buffer_size Maximum size of scan block
+   * @return <i>true</i> if there are more cells, <i>false</i> otherwise
+   */
+  bool FillScanBlock(CellListScannerPtr &scanner, ScanBlockSegments *block,
+                     int64_t buffer_size);
+
 }
 
 #endif // HYPERTABLE_FILLSCANBLOCK_H
@@ -77,6 +77,8 @@ namespace Hypertable {
   std::string            Global::toplevel_dir;
   int32_t                Global::metrics_interval = 0;
   int32_t                Global::merge_cellstore_run_length_threshold = 0;
+  int32_t                Global::subcompaction_threads = 1;
+  int64_t                Global::subcompaction_min_size = 0;
   bool                   Global::ignore_clock_skew_errors = false;
   ConnectionManagerPtr   Global::conn_manager;
   std::vector<MetaLog::EntityTaskPtr>  Global::work_queue;
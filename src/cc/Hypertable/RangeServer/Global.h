@@ -109,6 +109,8 @@ namespace Hypertable {
     static std::string    toplevel_dir;
     static int32_t        metrics_interval;
     static int32_t        merge_cellstore_run_length_threshold;
+    static int32_t        subcompaction_threads;
+    static int64_t        subcompaction_min_size;
     static bool           ignore_clock_skew_errors;
     static ConnectionManagerPtr conn_manager;
     static std::vector<MetaLog::EntityTaskPtr> work_queue;
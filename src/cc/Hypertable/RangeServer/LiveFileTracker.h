@@ -56,12 +56,12 @@ namespace Hypertable {
     /**
      * Updates the live file set
      *
-     * @param add filename to add
+     * @param adds vector of filenames to add
      * @param deletes vector of filenames to delete
      * @param nextcsid Next available CellStore ID
      * @param total_blocks Total number of cell store blocks in access group
      */
-    void update_live(const String &add, std::vector<String> &deletes, uint32_t nextcsid, int64_t total_blocks);
+    void update_live(const std::vector<String> &adds, std::vector<String> &deletes, uint32_t nextcsid, int64_t total_blocks);
 
     /**
      * Adds a file to the live file set without seting the 'need_update' bit
@@ -53,6 +53,14 @@ namespace {
     }
   };
 
+  /// Orders merging compactions so that the access groups a read has to
+  /// look at the most stores in come first
+  struct ReadAmplificationOrderingDescending {
+    bool operator()(const StatsRec &x, const StatsRec &y) const {
+      return x.agdata->read_amplification > y.agdata->read_amplification;
+    }
+  };
+
   struct ShadowCacheSortOrdering {
     bool operator()(const AccessGroup::CellStoreMaintenanceData *x,
 		    const AccessGroup::CellStoreMaintenanceData *y) const {
@@ -299,6 +307,8 @@ MaintenancePrioritizer::schedule_necessary_compactions(std::vector<RangeData> &r
 
   // Other compactions
 
+  std::vector<StatsRec> merges;
+
   for (size_t i=0; i<range_data.size(); i++) {
 
     if (range_data[i].data->busy)
@@ -353,26 +363,36 @@ MaintenancePrioritizer::schedule_necessary_compactions(std::vector<RangeData> &r
                            (Lld)ag_data->mem_used, range_data[i].data->priority,
                            (Lld)memory_state.needed);
       }
-      // Merging compactions
-      else if (ag_data->needs_merging) {
-        if (range_data[i].data->priority == 0)
-          range_data[i].data->priority = priority++;
-        range_data[i].data->maintenance_flags |= MaintenanceFlag::COMPACT;
-        ag_data->maintenance_flags |= MaintenanceFlag::COMPACT_MERGING;
-        // If it's an "end merge" then the cell cache will be included so
-        // decrement the memory occupied by the cell cache
-        if (ag_data->end_merge && memory_state.need_more())
-          memory_state.decrement_needed(ag_data->mem_allocated);
-        if (trace)
-          *trace += format("%d needs merging %s (priority=%d, "
-                           "mem_needed=%lld)\n", __LINE__,
-                           ag_data->ag->get_full_name(),
-                           range_data[i].data->priority,
-                           (Lld)memory_state.needed);
-      }
+      // Merging compactions, scheduled below
+      else if (ag_data->needs_merging)
+        merges.push_back(StatsRec(ag_data, range_data[i].data));
     }
   }
 
+  // Merging compactions, highest read amplification first
+  std::stable_sort(merges.begin(), merges.end(),
+                   ReadAmplificationOrderingDescending());
+
+  foreach_ht (StatsRec &rec, merges) {
+    if (rec.rangedata->priority == 0)
+      rec.rangedata->priority = priority++;
+    rec.rangedata->maintenance_flags |= MaintenanceFlag::COMPACT;
+    rec.agdata->maintenance_flags |= MaintenanceFlag::COMPACT_MERGING;
+    // If it's an "end merge" then the cell cache will be included so
+    // decrement the memory occupied by the cell cache
+    if (rec.agdata->end_merge && memory_state.need_more())
+      memory_state.decrement_needed(rec.agdata->mem_allocated);
+    if (trace)
+      *trace += format("%d needs merging %s (read_amplification=%u, "
+                       "write_amplification=%.2f, priority=%d, "
+                       "mem_needed=%lld)\n", __LINE__,
+                       rec.agdata->ag->get_full_name(),
+                       (unsigned)rec.agdata->read_amplification,
+                       (double)rec.agdata->write_amplification,
+                       rec.rangedata->priority,
+                       (Lld)memory_state.needed);
+  }
+
   return memory_state.need_more();
 }
 
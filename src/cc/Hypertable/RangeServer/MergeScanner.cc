@@ -71,6 +71,13 @@ MergeScanner::get(Key &key, ByteString &value) {
   return do_get(key, value);
 }
 
+CellMemoryPin *
+MergeScanner::get_pin() {
+  if (!m_initialized || m_done || m_queue.empty())
+    return 0;
+  return m_queue.top().scanner->get_pin();
+}
+
 uint64_t 
 MergeScanner::get_disk_read() {
   uint64_t amount = m_disk_read;
@@ -85,8 +92,7 @@ MergeScanner::initialize() {
 
   assert(m_initialized==false);
 
-  while (!m_queue.empty())
-    m_queue.pop();
+  m_queue.clear();
 
   for (size_t i=0; i<m_scanners.size(); i++) {
     if (m_scanners[i]->get(sstate.key, sstate.value)) {
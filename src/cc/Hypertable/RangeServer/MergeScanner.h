@@ -22,7 +22,6 @@
 #ifndef HYPERTABLE_MERGESCANNER_H
 #define HYPERTABLE_MERGESCANNER_H
 
-#include <queue>
 #include <string>
 #include <vector>
 #include <set>
@@ -32,6 +31,7 @@
 
 #include "CellListScanner.h"
 #include "CellStoreReleaseCallback.h"
+#include "MergeScannerLoserTree.h"
 
 
 namespace Hypertable {
@@ -46,17 +46,7 @@ namespace Hypertable {
       ACCUMULATE_COUNTERS = 0x00000004
     };
 
-    struct ScannerState {
-      CellListScanner *scanner;
-      Key key;
-      ByteString value;
-    };
-
-    struct LtScannerState {
-      bool operator()(const ScannerState &ss1, const ScannerState &ss2) const {
-        return ss1.key.serial > ss2.key.serial;
-      }
-    };
+    typedef MergeScannerLoserTree::ScannerState ScannerState;
 
     MergeScanner(ScanContextPtr &scan_ctx);
 
@@ -66,6 +56,8 @@ namespace Hypertable {
 
     virtual bool get(Key &key, ByteString &value);
 
+    virtual CellMemoryPin *get_pin();
+
     void add_scanner(CellListScanner *scanner);
 
     void install_release_callback(CellStoreReleaseCallback &cb) {
@@ -103,8 +95,7 @@ namespace Hypertable {
     bool          m_done;
     bool          m_initialized;
     std::vector<CellListScanner *>  m_scanners;
-    std::priority_queue<ScannerState, std::vector<ScannerState>,
-        LtScannerState> m_queue;
+    MergeScannerLoserTree m_queue;
 
     CellStoreReleaseCallback m_release_callback;
 
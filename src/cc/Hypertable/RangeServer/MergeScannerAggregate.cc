@@ -0,0 +1,239 @@
+/* -*- c++ -*-
+ * Copyright (C) 2007-2013 Hypertable, Inc.
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 3 of the
+ * License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+/** @file
+ * Definitions for MergeScannerAggregate.
+ * This file contains the method definitions for MergeScannerAggregate, a
+ * range scanner that evaluates a ScanSpec aggregate instead of returning
+ * cells.
+ */
+
+#include "Common/Compat.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
+
+#include "Common/Logger.h"
+#include "Common/Serialization.h"
+
+#include "Hypertable/Lib/Key.h"
+
+#include "MergeScannerAggregate.h"
+
+using namespace Hypertable;
+
+namespace {
+
+  /** Parses a cell value as a 64-bit integer.  Counter values are the
+   * encoded integer followed by '='; other values must be entirely
+   * decimal digits with an optional sign.
+   */
+  bool parse_value(bool counter, const ByteString &value, int64_t *valuep) {
+    const uint8_t *ptr;
+    size_t remain = value.decode_length(&ptr);
+
+    if (counter) {
+      if (remain != 9)
+        return false;
+      *valuep = Serialization::decode_i64(&ptr, &remain);
+      return true;
+    }
+
+    char buf[32];
+    if (remain == 0 || remain >= sizeof(buf))
+      return false;
+    memcpy(buf, ptr, remain);
+    buf[remain] = 0;
+    char *end;
+    errno = 0;
+    *valuep = strtoll(buf, &end, 10);
+    return errno == 0 && *end == 0;
+  }
+
+}
+
+
+MergeScannerAggregate::MergeScannerAggregate(ScanContextPtr &scan_ctx)
+  : MergeScannerRange(scan_ctx), m_function(ScanSpec::AGGREGATE_COUNT),
+    m_group_by(ScanSpec::GROUP_BY_NONE), m_prefix_length(0),
+    m_input_done(false), m_have_group(false), m_group(0), m_last_row(0),
+    m_output(0), m_output_pos(0) {
+  if (scan_ctx->spec != 0) {
+    m_function = scan_ctx->spec->aggregate;
+    m_group_by = scan_ctx->spec->group_by;
+    m_prefix_length = scan_ctx->spec->group_by_prefix_length;
+  }
+  HT_ASSERT(m_function != ScanSpec::AGGREGATE_NONE);
+}
+
+
+bool MergeScannerAggregate::get(Key &key, ByteString &value) {
+  if (m_output_pos == m_output_offsets.size())
+    load_output();
+
+  if (m_output_pos == m_output_offsets.size())
+    return false;
+
+  const uint8_t *ptr = m_output.base + m_output_offsets[m_output_pos];
+  key.load(SerializedKey(ptr));
+  value.ptr = ptr + key.length;
+  return true;
+}
+
+
+void MergeScannerAggregate::forward() {
+  if (m_output_pos < m_output_offsets.size())
+    m_output_pos++;
+}
+
+
+void MergeScannerAggregate::load_output() {
+  Key key;
+  ByteString value;
+
+  m_output.clear();
+  m_output_offsets.clear();
+  m_output_pos = 0;
+
+  while (m_output_offsets.empty() && !m_input_done) {
+    if (!MergeScannerRange::get(key, value)) {
+      m_input_done = true;
+      emit_group();
+      break;
+    }
+    if (key.flag == FLAG_INSERT) {
+      if (!m_have_group || !same_group(key.row)) {
+        emit_group();
+        size_t len = strlen(key.row);
+        if (m_group_by == ScanSpec::GROUP_BY_ROW_PREFIX)
+          len = std::min(len, m_prefix_length);
+        else if (m_group_by == ScanSpec::GROUP_BY_NONE)
+          len = 0;
+        m_group.clear();
+        m_group.reserve(len + 1);
+        m_group.add_unchecked(key.row, len);
+        *m_group.ptr++ = 0;
+        m_have_group = true;
+      }
+      add_cell(key, value);
+    }
+    MergeScannerRange::forward();
+  }
+}
+
+
+bool MergeScannerAggregate::same_group(const char *row) {
+  size_t len = m_group.fill() - 1;
+  switch (m_group_by) {
+  case ScanSpec::GROUP_BY_ROW:
+    return !strcmp(row, (const char *)m_group.base);
+  case ScanSpec::GROUP_BY_ROW_PREFIX:
+    return !strncmp(row, (const char *)m_group.base, len) &&
+      (len == m_prefix_length || row[len] == 0);
+  default:
+    return true;
+  }
+}
+
+
+void MergeScannerAggregate::add_cell(const Key &key, const ByteString &value) {
+  uint8_t cf = key.column_family_code;
+  Accumulator &acc = m_accumulators[cf];
+  int64_t v;
+
+  if (!acc.active) {
+    acc.active = true;
+    acc.count = acc.numeric = acc.value = 0;
+    acc.timestamp = key.timestamp;
+    acc.revision = key.revision;
+    m_active.push_back(cf);
+  }
+  else {
+    acc.timestamp = std::max(acc.timestamp, key.timestamp);
+    acc.revision = std::max(acc.revision, key.revision);
+  }
+
+  acc.count++;
+  m_last_row.set(key.row, strlen(key.row) + 1);
+
+  if (m_function == ScanSpec::AGGREGATE_COUNT ||
+      !parse_value(m_scan_context_ptr->family_info[cf].counter, value, &v))
+    return;
+
+  if (acc.numeric == 0)
+    acc.value = (m_function == ScanSpec::AGGREGATE_SUM) ? 0 : v;
+  switch (m_function) {
+  case ScanSpec::AGGREGATE_SUM:
+    acc.value += v;
+    break;
+  case ScanSpec::AGGREGATE_MIN:
+    acc.value = std::min(acc.value, v);
+    break;
+  case ScanSpec::AGGREGATE_MAX:
+    acc.value = std::max(acc.value, v);
+    break;
+  }
+  acc.numeric++;
+}
+
+
+void MergeScannerAggregate::emit_group() {
+  char numbuf[24];
+
+  if (!m_have_group)
+    return;
+
+  std::sort(m_active.begin(), m_active.end());
+
+  foreach_ht (uint8_t cf, m_active) {
+    Accumulator &acc = m_accumulators[cf];
+    acc.active = false;
+
+    int64_t result = acc.count;
+    if (m_function != ScanSpec::AGGREGATE_COUNT) {
+      // MIN and MAX are undefined without numeric values
+      if (acc.numeric == 0 && m_function != ScanSpec::AGGREGATE_SUM)
+        continue;
+      result = acc.value;
+    }
+
+    m_output_offsets.push_back(m_output.fill());
+    create_key_and_append(m_output, FLAG_INSERT,
+                          (const char *)m_last_row.base, cf,
+                          (const char *)m_group.base, acc.timestamp,
+                          acc.revision);
+    if (m_scan_context_ptr->family_info[cf].counter) {
+      // FillScanBlock converts counter values to ASCII
+      uint8_t *ptr = (uint8_t *)numbuf;
+      Serialization::encode_i64(&ptr, result);
+      *ptr++ = '=';
+      append_as_byte_string(m_output, numbuf, 9);
+    }
+    else {
+      sprintf(numbuf, "%lld", (Lld)result);
+      append_as_byte_string(m_output, numbuf, strlen(numbuf));
+    }
+  }
+
+  m_active.clear();
+  m_have_group = false;
+}
@@ -0,0 +1,107 @@
+/* -*- c++ -*-
+ * Copyright (C) 2007-2013 Hypertable, Inc.
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 3 of the
+ * License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+/** @file
+ * Declarations for MergeScannerAggregate.
+ * This file contains the type declarations for MergeScannerAggregate, a
+ * range scanner that evaluates a ScanSpec aggregate instead of returning
+ * cells.
+ */
+
+#ifndef HYPERTABLE_MERGESCANNERAGGREGATE_H
+#define HYPERTABLE_MERGESCANNERAGGREGATE_H
+
+#include <vector>
+
+#include "Common/DynamicBuffer.h"
+
+#include "MergeScannerRange.h"
+
+namespace Hypertable {
+
+  /** @addtogroup RangeServer
+   * @{
+   */
+
+  /** Range scanner that folds the cells of each group into one aggregate
+   * cell per column family.  The output cell of a group has the last row
+   * of the group within the range as its row key, so the client's end row
+   * checks and its restart-after-last-key logic keep working, and the group
+   * key (row, row prefix or empty) as its column qualifier.  Groups that
+   * straddle a range boundary produce one partial cell per range; the
+   * client merges them (see AggregateMerger).
+   */
+  class MergeScannerAggregate : public MergeScannerRange {
+
+  public:
+    MergeScannerAggregate(ScanContextPtr &scan_ctx);
+
+    virtual void forward();
+
+    virtual bool get(Key &key, ByteString &value);
+
+    /// Output cells are built in a private buffer, so nothing is pinned
+    virtual CellMemoryPin *get_pin() { return 0; }
+
+  private:
+
+    /// Running aggregate of one column family within the current group
+    struct Accumulator {
+      Accumulator() : active(false) { }
+      bool active;
+      int64_t count;
+      int64_t numeric;
+      int64_t value;
+      int64_t timestamp;
+      int64_t revision;
+    };
+
+    /** Consumes input cells until at least one group is complete or the
+     * input is exhausted, leaving the completed groups' cells in
+     * #m_output.
+     */
+    void load_output();
+
+    void add_cell(const Key &key, const ByteString &value);
+
+    void emit_group();
+
+    bool same_group(const char *row);
+
+    int32_t m_function;
+    int32_t m_group_by;
+    size_t m_prefix_length;
+    bool m_input_done;
+    bool m_have_group;
+    DynamicBuffer m_group;
+    DynamicBuffer m_last_row;
+    Accumulator m_accumulators[256];
+    std::vector<uint8_t> m_active;
+    DynamicBuffer m_output;
+    std::vector<size_t> m_output_offsets;
+    size_t m_output_pos;
+  };
+
+  /** @}*/
+
+} // namespace Hypertable
+
+#endif // HYPERTABLE_MERGESCANNERAGGREGATE_H
@@ -0,0 +1,153 @@
+/* -*- c++ -*-
+ * Copyright (C) 2007-2013 Hypertable, Inc.
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 3 of the
+ * License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+/** @file
+ * Definitions for MergeScannerLoserTree.
+ * This file contains the method definitions for MergeScannerLoserTree, the
+ * tournament tree used by MergeScanner to merge the cells of its input
+ * scanners.
+ */
+
+#include "Common/Compat.h"
+
+#include <algorithm>
+
+#include "MergeScannerLoserTree.h"
+
+using namespace Hypertable;
+
+void MergeScannerLoserTree::push(const ScannerState &state) {
+
+  if (m_pending_pop) {
+    int32_t winner = m_tree[0];
+
+    // Scanner that was just popped is being pushed back with its next cell
+    if (m_leaves[winner].state.scanner == state.scanner) {
+      m_pending_pop = false;
+      load(winner, state);
+      if (m_runner_up >= 0 && less(winner, m_runner_up))
+        return;
+      replay(winner);
+      m_runner_up = (m_tree[0] == winner) ? runner_up(winner) : -1;
+      return;
+    }
+
+    settle();
+  }
+
+  size_t i;
+  for (i=0; i<m_leaves.size(); i++) {
+    if (!m_leaves[i].active && m_leaves[i].state.scanner == state.scanner)
+      break;
+  }
+  if (i == m_leaves.size())
+    m_leaves.push_back(Leaf());
+
+  load(i, state);
+  m_leaves[i].active = true;
+  m_active++;
+  m_needs_build = true;
+}
+
+
+void MergeScannerLoserTree::clear() {
+  m_leaves.clear();
+  m_tree.clear();
+  m_active = 0;
+  m_runner_up = -1;
+  m_pending_pop = false;
+  m_needs_build = false;
+}
+
+
+void MergeScannerLoserTree::load(int32_t i, const ScannerState &state) {
+  Leaf &leaf = m_leaves[i];
+  const uint8_t *ptr;
+
+  leaf.state = state;
+
+  // The prefix covers the eight bytes after the control byte, which
+  // SerializedKey::compare always examines as long as they precede the
+  // revision (which it skips when the control bytes differ)
+  size_t len = state.key.serial.decode_length(&ptr);
+  if (*ptr >= 0x80 && *ptr != 0xD0)
+    len -= 8;
+  if (len >= 9) {
+    uint64_t prefix = 0;
+    for (size_t j=1; j<=8; j++)
+      prefix = (prefix << 8) | ptr[j];
+    leaf.prefix = prefix;
+    leaf.prefix_valid = true;
+  }
+  else
+    leaf.prefix_valid = false;
+}
+
+
+void MergeScannerLoserTree::build() {
+  size_t k = m_leaves.size();
+
+  m_needs_build = false;
+  m_runner_up = -1;
+  m_tree.resize(std::max(k, (size_t)1));
+  m_tree[0] = 0;
+
+  if (k <= 1)
+    return;
+
+  // Leaf i is node k+i; internal node n has children 2n and 2n+1
+  std::vector<int32_t> winners(2*k);
+  for (size_t i=0; i<k; i++)
+    winners[k+i] = i;
+  for (size_t n=k-1; n>0; n--) {
+    int32_t a = winners[2*n];
+    int32_t b = winners[2*n+1];
+    if (less(b, a)) {
+      winners[n] = b;
+      m_tree[n] = a;
+    }
+    else {
+      winners[n] = a;
+      m_tree[n] = b;
+    }
+  }
+  m_tree[0] = winners[1];
+}
+
+
+void MergeScannerLoserTree::replay(int32_t i) {
+  int32_t winner = i;
+  for (size_t n=(m_leaves.size()+i) >> 1; n>0; n >>= 1) {
+    if (less(m_tree[n], winner))
+      std::swap(winner, m_tree[n]);
+  }
+  m_tree[0] = winner;
+}
+
+
+int32_t MergeScannerLoserTree::runner_up(int32_t i) {
+  int32_t best = -1;
+  for (size_t n=(m_leaves.size()+i) >> 1; n>0; n >>= 1) {
+    if (best < 0 || less(m_tree[n], best))
+      best = m_tree[n];
+  }
+  return best;
+}
@@ -0,0 +1,193 @@
+/* -*- c++ -*-
+ * Copyright (C) 2007-2013 Hypertable, Inc.
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 3 of the
+ * License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+/** @file
+ * Declarations for MergeScannerLoserTree.
+ * This file contains the type declarations for MergeScannerLoserTree, the
+ * tournament tree used by MergeScanner to merge the cells of its input
+ * scanners.
+ */
+
+#ifndef HYPERTABLE_MERGESCANNERLOSERTREE_H
+#define HYPERTABLE_MERGESCANNERLOSERTREE_H
+
+#include <vector>
+
+#include "Common/ByteString.h"
+
+#include "Hypertable/Lib/Key.h"
+
+#include "CellListScanner.h"
+
+namespace Hypertable {
+
+  /** @addtogroup RangeServer
+   * @{
+   */
+
+  /** Loser tree over the current cells of a set of scanners.
+   * This class replaces the <code>std::priority_queue</code> previously
+   * used by MergeScanner and keeps its interface (#empty, #top, #pop and
+   * #push) so that merge loops written as "pop the top, forward its scanner,
+   * push it back" work unchanged.  A #pop followed by a #push of the same
+   * scanner is folded into a single replacement of the winning leaf, which
+   * costs one comparison per tree level instead of the two sift operations
+   * of a binary heap.
+   *
+   * Each leaf caches the first eight key bytes that follow the control byte
+   * as a big-endian integer, so most comparisons are a single integer
+   * compare; only equal prefixes fall back to SerializedKey::compare.
+   *
+   * When the same scanner wins twice in a row, the smallest key among the
+   * losers on its path (the runner-up) is computed.  While that scanner's
+   * next key stays below the runner-up, the tree can't change and the
+   * replacement is a single comparison, so long runs of consecutive cells
+   * from one input stream through without any tree operations.
+   */
+  class MergeScannerLoserTree {
+  public:
+
+    /// Current cell of an input scanner
+    struct ScannerState {
+      CellListScanner *scanner;
+      Key key;
+      ByteString value;
+    };
+
+    /// Constructor.
+    MergeScannerLoserTree()
+      : m_active(0), m_runner_up(-1), m_pending_pop(false),
+        m_needs_build(false), m_comparisons(0) { }
+
+    /// Returns <i>true</i> if there are no scanner states in the tree.
+    bool empty() {
+      settle();
+      return m_active == 0;
+    }
+
+    /// Returns the scanner state with the smallest key.
+    const ScannerState &top() {
+      settle();
+      return m_leaves[m_tree[0]].state;
+    }
+
+    /** Removes the scanner state with the smallest key.  The removal is
+     * deferred so that it can be combined with a following #push of the
+     * same scanner.
+     */
+    void pop() {
+      settle();
+      m_pending_pop = true;
+    }
+
+    /// Adds a scanner state.
+    void push(const ScannerState &state);
+
+    /// Removes all scanner states.
+    void clear();
+
+    /// Returns the number of key comparisons performed (for testing).
+    uint64_t comparisons() const { return m_comparisons; }
+
+  private:
+
+    /// Leaf of the tree holding the current cell of one scanner
+    struct Leaf {
+      ScannerState state;
+      uint64_t prefix;
+      bool prefix_valid;
+      bool active;
+    };
+
+    /// Loads <code>state</code> into leaf <code>i</code>
+    void load(int32_t i, const ScannerState &state);
+
+    /** Returns <i>true</i> if leaf <code>a</code> orders before leaf
+     * <code>b</code>.  Inactive leaves order after everything else and ties
+     * are broken by leaf index.
+     */
+    bool less(int32_t a, int32_t b) {
+      const Leaf &la = m_leaves[a];
+      const Leaf &lb = m_leaves[b];
+      if (!la.active)
+        return false;
+      if (!lb.active)
+        return true;
+      m_comparisons++;
+      if (la.prefix_valid && lb.prefix_valid && la.prefix != lb.prefix)
+        return la.prefix < lb.prefix;
+      int cmp = la.state.key.serial.compare(lb.state.key.serial);
+      if (cmp != 0)
+        return cmp < 0;
+      return a < b;
+    }
+
+    /// Applies a deferred #pop and rebuilds the tree if necessary
+    void settle() {
+      if (m_pending_pop) {
+        m_pending_pop = false;
+        m_leaves[m_tree[0]].active = false;
+        m_active--;
+        replay(m_tree[0]);
+        m_runner_up = -1;
+      }
+      if (m_needs_build)
+        build();
+    }
+
+    /// Rebuilds the tree from the leaves
+    void build();
+
+    /** Replays the matches on the path from leaf <code>i</code> to the root.
+     * Leaf <code>i</code> must be the current winner.
+     */
+    void replay(int32_t i);
+
+    /// Returns the smallest loser on the path from leaf <code>i</code>
+    int32_t runner_up(int32_t i);
+
+    /// Leaves, one per scanner
+    std::vector<Leaf> m_leaves;
+
+    /// Loser at each internal node; <code>m_tree[0]</code> is the winner
+    std::vector<int32_t> m_tree;
+
+    /// Number of active leaves
+    size_t m_active;
+
+    /// Runner-up to the current winner, or -1 if not known
+    int32_t m_runner_up;
+
+    /// A #pop has been deferred
+    bool m_pending_pop;
+
+    /// Leaves were added since the tree was last built
+    bool m_needs_build;
+
+    /// Comparison count
+    uint64_t m_comparisons;
+  };
+
+  /** @}*/
+
+} // namespace Hypertable
+
+#endif // HYPERTABLE_MERGESCANNERLOSERTREE_H
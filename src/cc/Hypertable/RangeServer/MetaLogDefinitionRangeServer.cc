@@ -22,6 +22,7 @@
 
 #include "MetaLogDefinitionRangeServer.h"
 
+#include "MetaLogEntityAttachCellStores.h"
 #include "MetaLogEntityRange.h"
 #include "MetaLogEntityRemoveOkLogs.h"
 #include "MetaLogEntityTaskAcknowledgeRelinquish.h"
@@ -49,6 +50,8 @@ Entity *DefinitionRangeServer::create(const EntityHeader &header) {
     return new EntityTaskAcknowledgeRelinquish(header);
   else if (header.type == EntityType::REMOVE_OK_LOGS)
     return new MetaLogEntityRemoveOkLogs(header);
+  else if (header.type == EntityType::ATTACH_CELLSTORES)
+    return new MetaLogEntityAttachCellStores(header);
 
   HT_THROWF(Error::METALOG_ENTRY_BAD_TYPE,
             "Unrecognized type (%d) encountered in rsml",
@@ -0,0 +1,92 @@
+/*
+ * Copyright (C) 2007-2013 Hypertable, Inc.
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 3 of the
+ * License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+/** @file
+ * Definitions for MetaLogEntityAttachCellStores.
+ * This file contains the type definitions for MetaLogEntityAttachCellStores,
+ * a %MetaLog entity class that records the intent to attach externally built
+ * CellStores to a range.
+ */
+
+#include "Common/Compat.h"
+#include "Common/Serialization.h"
+
+#include "MetaLogEntityAttachCellStores.h"
+
+using namespace Hypertable;
+using namespace Hypertable::MetaLog;
+
+MetaLogEntityAttachCellStores::MetaLogEntityAttachCellStores(const EntityHeader &header_)
+  : Entity(header_) {
+}
+
+MetaLogEntityAttachCellStores::MetaLogEntityAttachCellStores(const TableIdentifier &t,
+                                                             const RangeSpec &rs)
+  : Entity(EntityType::ATTACH_CELLSTORES), table(t), range_spec(rs) {
+}
+
+size_t MetaLogEntityAttachCellStores::encoded_length() const {
+  size_t length = table.encoded_length() + range_spec.encoded_length() + 4;
+  for (size_t i=0; i<files.size(); i++)
+    length += Serialization::encoded_length_vstr(ag_names[i]) +
+      Serialization::encoded_length_vstr(files[i]) +
+      Serialization::encoded_length_vstr(cs_files[i]);
+  return length;
+}
+
+void MetaLogEntityAttachCellStores::encode(uint8_t **bufp) const {
+  table.encode(bufp);
+  range_spec.encode(bufp);
+  Serialization::encode_i32(bufp, files.size());
+  for (size_t i=0; i<files.size(); i++) {
+    Serialization::encode_vstr(bufp, ag_names[i]);
+    Serialization::encode_vstr(bufp, files[i]);
+    Serialization::encode_vstr(bufp, cs_files[i]);
+  }
+}
+
+void
+MetaLogEntityAttachCellStores::decode(const uint8_t **bufp, size_t *remainp,
+                                      uint16_t definition_version) {
+  (void)definition_version;
+  table.decode(bufp, remainp);
+  range_spec.decode(bufp, remainp);
+  uint32_t count = Serialization::decode_i32(bufp, remainp);
+  ag_names.clear();
+  files.clear();
+  cs_files.clear();
+  for (uint32_t i=0; i<count; i++) {
+    ag_names.push_back(Serialization::decode_vstr(bufp, remainp));
+    files.push_back(Serialization::decode_vstr(bufp, remainp));
+    cs_files.push_back(Serialization::decode_vstr(bufp, remainp));
+  }
+}
+
+const String MetaLogEntityAttachCellStores::name() {
+  return "AttachCellStores";
+}
+
+void MetaLogEntityAttachCellStores::display(std::ostream &os) {
+  os << " " << table << " " << range_spec;
+  for (size_t i=0; i<files.size(); i++)
+    os << " " << ag_names[i] << ":" << files[i] << "->" << cs_files[i];
+  os << " ";
+}
@@ -0,0 +1,147 @@
+/*
+ * Copyright (C) 2007-2013 Hypertable, Inc.
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 3 of the
+ * License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+/** @file
+ * Declarations for MetaLogEntityAttachCellStores.
+ * This file contains the type declarations for MetaLogEntityAttachCellStores,
+ * a %MetaLog entity class that records the intent to attach externally built
+ * CellStores to a range.
+ */
+
+#ifndef HYPERTABLE_METALOGENTITYATTACHCELLSTORES_H
+#define HYPERTABLE_METALOGENTITYATTACHCELLSTORES_H
+
+#include "Hypertable/Lib/MetaLogEntity.h"
+#include "Hypertable/Lib/Types.h"
+
+#include "MetaLogEntityTypes.h"
+
+#include <vector>
+
+namespace Hypertable {
+
+  /** @addtogroup RangeServer
+   * @{
+   */
+
+  /** %MetaLog entity recording CellStores being attached to a range.
+   * Range::attach_cellstores() persists this entity after validating the
+   * staged files and before moving any of them, and removes it once every
+   * file has been recorded in METADATA.  If the entity is found in the RSML
+   * on restart, the attach was interrupted and is finished by
+   * Range::finish_attach_cellstores().
+   */
+  class MetaLogEntityAttachCellStores : public MetaLog::Entity {
+  public:
+
+    /** Constructor initialized from %Metalog entity header.
+     * @param header_ %Metalog entity header
+     */
+    MetaLogEntityAttachCellStores(const MetaLog::EntityHeader &header_);
+
+    /** Constructor.
+     * @param t %Table identifier
+     * @param rs %Range spec
+     */
+    MetaLogEntityAttachCellStores(const TableIdentifier &t,
+                                  const RangeSpec &rs);
+
+    /** Destructor */
+    virtual ~MetaLogEntityAttachCellStores() { }
+
+    /** Gets serialized length
+     * @see encode() for serialization %format
+     * @return Serialized length
+     */
+    virtual size_t encoded_length() const;
+
+    /** Writes serialized encoding of entity.
+     * This method writes a serialized encoding of the entity state to the
+     * memory location pointed to by <code>*bufp</code>.  The encoding has the
+     * following format:
+     * <table style="font-family:monospace; ">
+     *   <tr>
+     *   <td>[variable]</td>
+     *   <td>- %Table identifier</td>
+     *   </tr>
+     *   <tr>
+     *   <td>[variable]</td>
+     *   <td>- %Range spec</td>
+     *   </tr>
+     *   <tr>
+     *   <td>[4-bytes]</td>
+     *   <td>- Number of CellStores to follow</td>
+     *   </tr>
+     *   <tr>
+     *   <td>[variable]</td>
+     *   <td>- Access group name, staged path and destination path of each
+     *   CellStore, each encoded as a vstr</td>
+     *   </tr>
+     * </table>
+     * @param bufp Address of destination buffer pointer (advanced by call)
+     */
+    virtual void encode(uint8_t **bufp) const;
+
+    /** Reads serialized encoding of the entity.
+     * @param bufp Address of source buffer pointer (advanced by call)
+     * @param remainp Amount of remaining buffer pointed to by
+     * <code>*bufp</code> (decremented by call).
+     * @param definition_version Version of DefinitionMaster
+     * @see encode() for serialization format
+     */
+    virtual void decode(const uint8_t **bufp, size_t *remainp,
+                        uint16_t definition_version);
+
+    /** Returns the entity name ("AttachCellStores")
+     * @return %Entity name
+     */
+    virtual const String name();
+
+    /** Writes a human readable representation of the object state to
+     * an output stream.
+     * @param os Output stream
+     */
+    virtual void display(std::ostream &os);
+
+    /// %Table identifier
+    TableIdentifierManaged table;
+
+    /// %Range spec
+    RangeSpecManaged range_spec;
+
+    /// Access group name of each CellStore
+    std::vector<String> ag_names;
+
+    /// Staged path of each CellStore
+    std::vector<String> files;
+
+    /// Path of each CellStore in its access group directory
+    std::vector<String> cs_files;
+  };
+
+  /// Smart pointer to MetaLogEntityAttachCellStores
+  typedef intrusive_ptr<MetaLogEntityAttachCellStores> MetaLogEntityAttachCellStoresPtr;
+
+  /* @}*/
+
+} // namespace Hypertable
+
+#endif // HYPERTABLE_METALOGENTITYATTACHCELLSTORES_H
@@ -44,7 +44,8 @@ namespace Hypertable {
         RANGE2                      = 0x00010002,
         TASK_REMOVE_TRANSFER_LOG    = 0x00010003,
         TASK_ACKNOWLEDGE_RELINQUISH = 0x00010004,
-        REMOVE_OK_LOGS              = 0x00010005
+        REMOVE_OK_LOGS              = 0x00010005,
+        ATTACH_CELLSTORES           = 0x00010006
       };
     }
   }
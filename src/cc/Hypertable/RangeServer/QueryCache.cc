@@ -23,111 +23,173 @@
 #include <cassert>
 #include <iostream>
 
+#include "Common/Logger.h"
+
 #include "QueryCache.h"
 
 using namespace Hypertable;
 using std::pair;
 
-#define OVERHEAD 64
+QueryCache::QueryCache(uint64_t max_memory, size_t shard_count,
+                       bool admission_control)
+  : m_admission_control(admission_control) {
+  if (shard_count == 0)
+    shard_count = 1;
+  while (shard_count > 1 && max_memory / shard_count < MIN_SHARD_MEMORY)
+    shard_count--;
+
+  // Size the sighting table for roughly one slot per KB of cache
+  size_t sighting_slots = 1;
+  if (m_admission_control) {
+    sighting_slots = 1024;
+    while (sighting_slots < max_memory / shard_count / 1024)
+      sighting_slots <<= 1;
+  }
+
+  m_shards.resize(shard_count, 0);
+  for (size_t i=0; i<shard_count; i++) {
+    uint64_t share = max_memory / shard_count;
+    if (i == 0)
+      share += max_memory % shard_count;
+    m_shards[i] = new Shard(share, sighting_slots);
+  }
+}
+
+QueryCache::~QueryCache() {
+  foreach_ht (Shard *shard, m_shards)
+    delete shard;
+}
 
 bool QueryCache::insert(Key *key, const char *tablename, const char *row,
 			boost::shared_array<uint8_t> &result,
 			uint32_t result_length) {
-  ScopedLock lock(m_mutex);
-  LookupHashIndex &hash_index = m_cache.get<1>();
+  QueryCacheEntry entry(*key, tablename, row, result, result_length);
+  Shard *shard = get_shard(entry.row_key);
+  ScopedLock lock(shard->mutex);
+  LookupHashIndex &hash_index = shard->cache.get<1>();
   LookupHashIndex::iterator lookup_iter;
-  uint64_t length = result_length + OVERHEAD + strlen(row);
 
-  if (length > m_max_memory)
+  if (entry.memory > shard->max_memory)
     return false;
 
+  if (m_admission_control) {
+    Sighting &sighting = shard->sighting(key);
+    if (sighting.fingerprint != key->digest[0] || sighting.count < 2)
+      return false;
+  }
+
   if ((lookup_iter = hash_index.find(*key)) != hash_index.end()) {
-    m_avail_memory += (*lookup_iter).result_length + OVERHEAD + strlen((*lookup_iter).row_key.row);
+    shard->avail_memory += (*lookup_iter).memory;
     hash_index.erase(lookup_iter);
   }
 
   // make room
-  if (m_avail_memory < length) {
-    Cache::iterator iter = m_cache.begin();
-    while (iter != m_cache.end()) {
-      m_avail_memory += (*iter).result_length + OVERHEAD + strlen((*iter).row_key.row);
-      iter = m_cache.erase(iter);
-      if (m_avail_memory >= length)
+  if (shard->avail_memory < entry.memory) {
+    Cache::iterator iter = shard->cache.begin();
+    while (iter != shard->cache.end()) {
+      shard->avail_memory += (*iter).memory;
+      iter = shard->cache.erase(iter);
+      if (shard->avail_memory >= entry.memory)
 	break;
     }
   }
 
-  if (m_avail_memory < length)
+  if (shard->avail_memory < entry.memory)
     return false;
 
-  QueryCacheEntry entry(*key, tablename, row, result, result_length);
-
-  auto insert_result = m_cache.push_back(entry);
+  auto insert_result = shard->cache.push_back(entry);
   assert(insert_result.second);
   (void)insert_result;
 
-  m_avail_memory -= length;
+  shard->avail_memory -= entry.memory;
 
   return true;
 }
 
 
-bool QueryCache::lookup(Key *key, boost::shared_array<uint8_t> &result,
-			uint32_t *lenp) {
-  ScopedLock lock(m_mutex);
-  LookupHashIndex &hash_index = m_cache.get<1>();
-  LookupHashIndex::iterator iter;
+bool QueryCache::lookup(Key *key, const char *tablename, const char *row,
+                        boost::shared_array<uint8_t> &result, uint32_t *lenp) {
+  Shard *shard = get_shard(RowKey(tablename, row));
+  ScopedLock lock(shard->mutex);
 
-  if (m_total_lookup_count > 0 && (m_total_lookup_count % 1000) == 0) {
-    HT_INFOF("QueryCache hit rate over last 1000 lookups, cumulative = %f, %f",
-             ((double)m_recent_hit_count / (double)1000)*100.0,
-             ((double)m_total_hit_count / (double)m_total_lookup_count)*100.0);
-    m_recent_hit_count = 0;
+  if ((++shard->lookup_count % 1000) == 0) {
+    HT_INFOF("QueryCache shard hit rate over last 1000 lookups, "
+             "cumulative = %f, %f",
+             ((double)(shard->hit_count - shard->logged_hit_count) /
+              (double)1000)*100.0,
+             ((double)shard->hit_count / (double)shard->lookup_count)*100.0);
+    shard->logged_hit_count = shard->hit_count;
   }
+  LookupHashIndex &hash_index = shard->cache.get<1>();
+  LookupHashIndex::iterator iter;
 
-  m_total_lookup_count++;
-
-  if ((iter = hash_index.find(*key)) == hash_index.end())
+  if ((iter = hash_index.find(*key)) == hash_index.end()) {
+    if (m_admission_control) {
+      Sighting &sighting = shard->sighting(key);
+      if (sighting.fingerprint != key->digest[0]) {
+        sighting.fingerprint = key->digest[0];
+        sighting.count = 1;
+      }
+      else if (sighting.count < 2)
+        sighting.count++;
+    }
     return false;
+  }
 
-  QueryCacheEntry entry = *iter;
+  // move to most recently used position
+  Sequence &sequence = shard->cache.get<0>();
+  sequence.relocate(sequence.end(), shard->cache.project<0>(iter));
 
-  hash_index.erase(iter);
+  result = (*iter).result;
+  *lenp = (*iter).result_length;
 
-  pair<Sequence::iterator, bool> insert_result = m_cache.push_back(entry);
-  assert(insert_result.second);
+  shard->hit_count++;
+  return true;
+}
 
-  result = (*insert_result.first).result;
-  *lenp = (*insert_result.first).result_length;
+uint64_t QueryCache::available_memory() {
+  uint64_t available = 0;
+  foreach_ht (Shard *shard, m_shards) {
+    ScopedLock lock(shard->mutex);
+    available += shard->avail_memory;
+  }
+  return available;
+}
 
-  m_total_hit_count++;
-  m_recent_hit_count++;
-  return true;
+uint64_t QueryCache::memory_used() {
+  uint64_t used = 0;
+  foreach_ht (Shard *shard, m_shards) {
+    ScopedLock lock(shard->mutex);
+    used += shard->max_memory - shard->avail_memory;
+  }
+  return used;
 }
 
 void QueryCache::get_stats(uint64_t *max_memoryp, uint64_t *available_memoryp,
                            uint64_t *total_lookupsp, uint64_t *total_hitsp)
 {
-  ScopedLock lock(m_mutex);
-  *total_lookupsp = m_total_lookup_count;
-  *total_hitsp = m_total_hit_count;
-  *max_memoryp = m_max_memory;
-  *available_memoryp = m_avail_memory;
+  *max_memoryp = 0;
+  *available_memoryp = 0;
+  *total_lookupsp = 0;
+  *total_hitsp = 0;
+  foreach_ht (Shard *shard, m_shards) {
+    ScopedLock lock(shard->mutex);
+    *max_memoryp += shard->max_memory;
+    *available_memoryp += shard->avail_memory;
+    *total_lookupsp += shard->lookup_count;
+    *total_hitsp += shard->hit_count;
+  }
 }
 
 void QueryCache::invalidate(const char *tablename, const char *row) {
-  ScopedLock lock(m_mutex);
-  InvalidateHashIndex &hash_index = m_cache.get<2>();
-  InvalidateHashIndex::iterator iter;
   RowKey row_key(tablename, row);
+  Shard *shard = get_shard(row_key);
+  ScopedLock lock(shard->mutex);
+  InvalidateHashIndex &hash_index = shard->cache.get<2>();
   pair<InvalidateHashIndex::iterator, InvalidateHashIndex::iterator> p = hash_index.equal_range(row_key);
-  uint64_t length;
 
   while (p.first != p.second) {
-    length = (*p.first).result_length + OVERHEAD + strlen((*p.first).row_key.row);
-    /** HT_ASSERT(strcmp((*p.first).row_key.tablename, tablename) == 0 &&
-        strcmp((*p.first).row_key.row.c_str(), row) == 0); **/
-    m_avail_memory += length;
+    shard->avail_memory += (*p.first).memory;
     p.first = hash_index.erase(p.first);
   }
 
@@ -135,26 +197,30 @@ void QueryCache::invalidate(const char *tablename, const char *row) {
 
 
 void QueryCache::dump() {
-  ScopedLock lock(m_mutex);
-  Sequence &index0 = m_cache.get<0>();
-  LookupHashIndex &index1 = m_cache.get<1>();
-  InvalidateHashIndex &index2 = m_cache.get<2>();
-
-  std::cout << "index0:" << std::endl;
-  for (Sequence::iterator iter = index0.begin(); iter != index0.end(); ++iter) {
-    QueryCacheEntry entry(*iter);
-    entry.dump();
-  }
+  for (size_t i=0; i<m_shards.size(); i++) {
+    ScopedLock lock(m_shards[i]->mutex);
+    Sequence &index0 = m_shards[i]->cache.get<0>();
+    LookupHashIndex &index1 = m_shards[i]->cache.get<1>();
+    InvalidateHashIndex &index2 = m_shards[i]->cache.get<2>();
+
+    std::cout << "shard " << i << std::endl;
+
+    std::cout << "index0:" << std::endl;
+    for (Sequence::iterator iter = index0.begin(); iter != index0.end(); ++iter) {
+      QueryCacheEntry entry(*iter);
+      entry.dump();
+    }
 
-  std::cout << "index1:" << std::endl;
-  for (LookupHashIndex::iterator iter = index1.begin(); iter != index1.end(); ++iter) {
-    QueryCacheEntry entry(*iter);
-    entry.dump();
-  }
+    std::cout << "index1:" << std::endl;
+    for (LookupHashIndex::iterator iter = index1.begin(); iter != index1.end(); ++iter) {
+      QueryCacheEntry entry(*iter);
+      entry.dump();
+    }
 
-  std::cout << "index2:" << std::endl;
-  for (InvalidateHashIndex::iterator iter = index2.begin(); iter != index2.end(); ++iter) {
-    QueryCacheEntry entry(*iter);
-    entry.dump();
+    std::cout << "index2:" << std::endl;
+    for (InvalidateHashIndex::iterator iter = index2.begin(); iter != index2.end(); ++iter) {
+      QueryCacheEntry entry(*iter);
+      entry.dump();
+    }
   }
 }
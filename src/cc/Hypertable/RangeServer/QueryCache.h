@@ -23,22 +23,33 @@
 #define HYPERTABLE_QUERYCACHE_H
 
 #include <cstring>
+#include <vector>
 
 #include <boost/multi_index_container.hpp>
 #include <boost/multi_index/hashed_index.hpp>
 #include <boost/multi_index/mem_fun.hpp>
 #include <boost/multi_index/sequenced_index.hpp>
 #include <boost/multi_index/member.hpp>
+#include <boost/noncopyable.hpp>
 
 #include <boost/shared_array.hpp>
 
 #include "Common/Mutex.h"
-#include "Common/atomic.h"
-#include "Common/Checksum.h"
+#include "Common/MurmurHash.h"
 
 namespace Hypertable {
   using namespace boost::multi_index;
 
+  /** Cache of single-row query results.  Results are looked up by the MD5
+   * digest of the scan request and invalidated by (table, row) whenever the
+   * row is updated.  The cache is split into a number of shards, each with
+   * its own lock and memory limit, and an entry lives in the shard selected
+   * by a hash of its (table, row), so lookups, inserts and invalidations of
+   * different rows do not contend with each other.  With admission control
+   * enabled, a result is only inserted once its request has missed the
+   * cache at least twice, so rows that are only ever read once do not
+   * displace the results of rows that are read repeatedly.
+   */
   class QueryCache {
 
   public:
@@ -54,7 +65,7 @@ namespace Hypertable {
     class RowKey {
     public:
       RowKey(const char *tname, const char *r) : tablename(tname), row(r) {
-	hash = fletcher32(tname, strlen(tname)) ^ fletcher32(row, strlen(row));
+	hash = murmurhash2(row, strlen(row), murmurhash2(tname, strlen(tname), 0));
       }
       bool operator==(const RowKey &other) const {
 	return !strcmp(tablename, other.tablename) && !strcmp(row, other.row);
@@ -64,33 +75,49 @@ namespace Hypertable {
       uint32_t hash;
     };
 
-    QueryCache(uint64_t max_memory)
-      : m_max_memory(max_memory), m_avail_memory(max_memory),
-        m_total_lookup_count(0), m_total_hit_count(0), m_recent_hit_count(0) { }
+    /** Constructor.
+     * @param max_memory Maximum amount of memory used by the cache
+     * @param shard_count Number of shards (reduced if the shards would end
+     * up smaller than MIN_SHARD_MEMORY)
+     * @param admission_control Only insert results of requests that have
+     * missed the cache before
+     */
+    QueryCache(uint64_t max_memory, size_t shard_count=1,
+               bool admission_control=false);
+    ~QueryCache();
 
     bool insert(Key *key, const char *tablename, const char *row,
                 boost::shared_array<uint8_t> &result, uint32_t result_length);
 
-    bool lookup(Key *key, boost::shared_array<uint8_t> &result, uint32_t *lenp);
+    bool lookup(Key *key, const char *tablename, const char *row,
+                boost::shared_array<uint8_t> &result, uint32_t *lenp);
 
     void invalidate(const char * tablename, const char *row);
 
     void dump();
 
-    uint64_t available_memory() { ScopedLock lock(m_mutex); return m_avail_memory; }
+    uint64_t available_memory();
 
-    uint64_t memory_used() { ScopedLock lock(m_mutex); return m_max_memory-m_avail_memory; }
+    uint64_t memory_used();
 
     void get_stats(uint64_t *max_memoryp, uint64_t *available_memoryp,
                    uint64_t *total_lookupsp, uint64_t *total_hitsp);
 
+    /// Returns the number of shards
+    size_t shard_count() const { return m_shards.size(); }
+
+    /// Smallest memory limit a shard is allowed to have
+    static const uint64_t MIN_SHARD_MEMORY = 1024 * 1024;
+
   private:
 
     class QueryCacheEntry {
     public:
       QueryCacheEntry(Key &k, const char *tname, const char *rw,
 		      boost::shared_array<uint8_t> &res, uint32_t rlen) :
-	key(k), row_key(tname, rw), result(res), result_length(rlen) { }
+	key(k), row_key(tname, rw), result(res), result_length(rlen) {
+        memory = rlen + strlen(tname) + strlen(rw) + 2 + ENTRY_OVERHEAD;
+      }
       Key lookup_key() const { return key; }
       RowKey invalidate_key() const { return row_key; }
       void dump() { std::cout << row_key.tablename << ":" << row_key.row << "\n"; }
@@ -98,11 +125,20 @@ namespace Hypertable {
       RowKey row_key;
       boost::shared_array<uint8_t> result;
       uint32_t result_length;
+      /// Memory charged to the cache for this entry
+      uint32_t memory;
     };
 
+    /// Memory charged per entry on top of the result buffer: the entry
+    /// itself, the container node (two sequence links, two hash chain links
+    /// and the non-unique index's group links), one bucket slot in each
+    /// hashed index and the shared_array reference count block.
+    static const uint32_t ENTRY_OVERHEAD = sizeof(QueryCacheEntry) +
+      8 * sizeof(void *) + 32;
+
     struct KeyHash {
       std::size_t operator()(const Key k) const {
-	return (std::size_t)k.digest[0];
+	return (std::size_t)(k.digest[0] ^ k.digest[1]);
       }
     };
 
@@ -127,13 +163,46 @@ namespace Hypertable {
     typedef Cache::nth_index<1>::type LookupHashIndex;
     typedef Cache::nth_index<2>::type InvalidateHashIndex;
 
-    Mutex     m_mutex;
-    Cache     m_cache;
-    uint64_t  m_max_memory;
-    uint64_t  m_avail_memory;
-    uint64_t  m_total_lookup_count;
-    uint64_t  m_total_hit_count;
-    uint32_t  m_recent_hit_count;
+    /** Record of recent cache misses, used for admission control.  This is
+     * a direct mapped table of request digests with a saturating miss count
+     * per slot; a colliding request simply takes over the slot.
+     */
+    struct Sighting {
+      Sighting() : fingerprint(0), count(0) { }
+      uint64_t fingerprint;
+      uint32_t count;
+    };
+
+    /** One independently locked partition of the cache.  Lookup and hit
+     * counts are kept per shard so that they are updated and read under
+     * the shard mutex that lookups take anyway.
+     */
+    class Shard : boost::noncopyable {
+    public:
+      Shard(uint64_t max_memory, size_t sighting_slots)
+        : max_memory(max_memory), avail_memory(max_memory),
+          sightings(sighting_slots), lookup_count(0), hit_count(0),
+          logged_hit_count(0) { }
+      Sighting &sighting(const Key *key) {
+        return sightings[key->digest[1] & (sightings.size() - 1)];
+      }
+      Mutex     mutex;
+      Cache     cache;
+      uint64_t  max_memory;
+      uint64_t  avail_memory;
+      std::vector<Sighting> sightings;
+      uint64_t  lookup_count;
+      uint64_t  hit_count;
+      /// Value of #hit_count when the hit rate was last logged
+      uint64_t  logged_hit_count;
+    };
+
+    Shard *get_shard(const RowKey &row_key) {
+      return m_shards[row_key.hash % m_shards.size()];
+    }
+
+    std::vector<Shard *> m_shards;
+    bool      m_admission_control;
   };
 
 }
@@ -55,6 +55,7 @@ extern "C" {
 
 #include "CellStoreFactory.h"
 #include "Global.h"
+#include "MergeScannerAggregate.h"
 #include "MergeScannerRange.h"
 #include "MetadataNormal.h"
 #include "MetadataRoot.h"
@@ -488,12 +489,17 @@ void Range::add(const Key &key, const ByteString value) {
 
 
 CellListScanner *Range::create_scanner(ScanContextPtr &scan_ctx) {
-  MergeScanner *mscanner = new MergeScannerRange(scan_ctx);
+  MergeScanner *mscanner;
   AccessGroupVector  ag_vector(0);
 
 
   HT_ASSERT(m_initialized);
 
+  if (scan_ctx->spec && scan_ctx->spec->aggregate != ScanSpec::AGGREGATE_NONE)
+    mscanner = new MergeScannerAggregate(scan_ctx);
+  else
+    mscanner = new MergeScannerRange(scan_ctx);
+
   {
     ScopedLock lock(m_schema_mutex);
     ag_vector = m_access_group_vector;
@@ -1487,6 +1493,136 @@ void Range::split_notify_master() {
 }
 
 
+void Range::attach_cellstores(const std::vector<String> &ag_names,
+                              const std::vector<String> &files) {
+
+  if (!m_initialized)
+    deferred_initialization();
+
+  HT_ASSERT(ag_names.size() == files.size());
+
+  RangeMaintenanceGuard::Activator activator(m_maintenance_guard);
+  std::vector<AccessGroup *> targets;
+  std::vector<int64_t> revisions;
+  int state = m_metalog_entity->get_state();
+
+  if (state != RangeState::STEADY)
+    HT_THROWF(Error::RANGESERVER_RANGE_BUSY, "Unable to attach CellStores "
+              "to %s, range is in state %s", m_name.c_str(),
+              RangeState::get_text(state).c_str());
+
+  get_access_groups(ag_names, targets);
+
+  // Check every file before changing anything, so that a bad file leaves
+  // the range as it was
+  for (size_t i=0; i<targets.size(); i++)
+    revisions.push_back(targets[i]->check_attachable(files[i]));
+
+  // Store the cached cells first so that the attached files, whose revision
+  // predates anything written since the load began, do not cause commit
+  // log replay to skip them
+  {
+    Barrier::ScopedActivator block_updates(m_update_barrier);
+    ScopedLock lock(m_mutex);
+    foreach_ht (AccessGroup *ag, targets)
+      ag->stage_compaction();
+  }
+  for (size_t i=0; i<targets.size(); i++) {
+    AccessGroup::Hints hint;
+    try {
+      targets[i]->run_compaction(MaintenanceFlag::COMPACT_MINOR, &hint);
+    }
+    catch (Exception &e) {
+      // Unfreeze this and the remaining staged caches, as compact() does
+      for (size_t j=i; j<targets.size(); j++)
+        targets[j]->unstage_compaction();
+      throw;
+    }
+  }
+
+  RangeSpecManaged range_spec;
+  m_metalog_entity->get_range_spec(range_spec);
+  MetaLogEntityAttachCellStoresPtr attach_entity =
+    new MetaLogEntityAttachCellStores(m_table, range_spec);
+  attach_entity->ag_names = ag_names;
+  attach_entity->files = files;
+  for (size_t i=0; i<targets.size(); i++)
+    attach_entity->cs_files.push_back(targets[i]->reserve_attach(files[i],
+                                                                 revisions[i]));
+
+  // Record the intent before moving anything so that an attach interrupted
+  // by a crash is finished on restart instead of orphaning the moved files
+  Global::rsml_writer->record_state(attach_entity.get());
+
+  attach_staged_cellstores(targets, attach_entity->files,
+                           attach_entity->cs_files);
+
+  Global::rsml_writer->record_removal(attach_entity.get());
+}
+
+
+void Range::finish_attach_cellstores(MetaLogEntityAttachCellStores *entity) {
+
+  if (!m_initialized)
+    deferred_initialization();
+
+  RangeMaintenanceGuard::Activator activator(m_maintenance_guard);
+  std::vector<AccessGroup *> targets;
+
+  HT_INFOF("Finishing interrupted attach of %d CellStores to %s",
+           (int)entity->files.size(), m_name.c_str());
+
+  get_access_groups(entity->ag_names, targets);
+  attach_staged_cellstores(targets, entity->files, entity->cs_files);
+}
+
+
+void Range::get_access_groups(const std::vector<String> &ag_names,
+                              std::vector<AccessGroup *> &targets) {
+  ScopedLock lock(m_schema_mutex);
+  foreach_ht (const String &ag_name, ag_names) {
+    AccessGroupMap::iterator iter = m_access_group_map.find(ag_name);
+    if (iter == m_access_group_map.end())
+      HT_THROWF(Error::RANGESERVER_INVALID_COLUMNFAMILY, "Access group "
+                "'%s' not found in range %s", ag_name.c_str(),
+                m_name.c_str());
+    if (std::find(targets.begin(), targets.end(), iter->second) != targets.end())
+      HT_THROWF(Error::BAD_KEY, "Access group '%s' given more than once",
+                ag_name.c_str());
+    targets.push_back(iter->second);
+  }
+}
+
+
+void Range::attach_staged_cellstores(std::vector<AccessGroup *> &targets,
+                                     const std::vector<String> &files,
+                                     const std::vector<String> &cs_files) {
+  AccessGroupVector ag_vector(0);
+
+  {
+    ScopedLock lock(m_schema_mutex);
+    ag_vector = m_access_group_vector;
+  }
+
+  for (size_t i=0; i<targets.size(); i++)
+    targets[i]->attach_cellstore(files[i], cs_files[i]);
+
+  std::vector<AccessGroup::Hints> hints(ag_vector.size());
+  for (size_t i=0; i<ag_vector.size(); i++)
+    ag_vector[i]->load_hints(&hints[i]);
+
+  {
+    ScopedLock lock(m_mutex);
+    for (size_t i=0; i<hints.size(); i++) {
+      if (hints[i].latest_stored_revision > m_latest_revision)
+        m_latest_revision = hints[i].latest_stored_revision;
+    }
+  }
+  m_hints_file.set(hints);
+  m_hints_file.write(Global::location_initializer->get());
+}
+
+
 void Range::compact(MaintenanceFlag::Map &subtask_map) {
 
   if (!m_initialized)
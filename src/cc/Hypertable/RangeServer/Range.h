@@ -49,6 +49,7 @@
 #include "LoadFactors.h"
 #include "LoadMetricsRange.h"
 #include "MaintenanceFlag.h"
+#include "MetaLogEntityAttachCellStores.h"
 #include "MetaLogEntityRange.h"
 #include "MetaLogEntityTask.h"
 #include "Metadata.h"
@@ -194,6 +195,23 @@ namespace Hypertable {
 
     void compact(MaintenanceFlag::Map &subtask_map);
 
+    /** Attaches externally built CellStores to access groups of this range.
+     * Each file is moved into its access group and recorded in METADATA.
+     * Fails with Error::RANGESERVER_RANGE_BUSY if the range is being
+     * split, relinquished or compacted.
+     * @param ag_names Access group name for each file
+     * @param files Staged CellStore files, parallel to <code>ag_names</code>
+     */
+    void attach_cellstores(const std::vector<String> &ag_names,
+                           const std::vector<String> &files);
+
+    /** Finishes an attach_cellstores() call interrupted by a crash.  Moves
+     * and records in METADATA each CellStore of <code>entity</code> that is
+     * not attached yet.
+     * @param entity Attach intent found in the RSML on restart
+     */
+    void finish_attach_cellstores(MetaLogEntityAttachCellStores *entity);
+
     void purge_memory(MaintenanceFlag::Map &subtask_map);
 
     void schedule_relinquish() { m_relinquish = true; }
@@ -356,6 +374,12 @@ namespace Hypertable {
     void split_compact_and_shrink();
     void split_notify_master();
 
+    void get_access_groups(const std::vector<String> &ag_names,
+                           std::vector<AccessGroup *> &targets);
+    void attach_staged_cellstores(std::vector<AccessGroup *> &targets,
+                                  const std::vector<String> &files,
+                                  const std::vector<String> &cs_files);
+
     // these need to be aligned
     uint64_t         m_scans;
     uint64_t         m_cells_scanned;
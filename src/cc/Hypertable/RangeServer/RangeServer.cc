@@ -27,6 +27,7 @@
 #include <Common/Compat.h>
 #include "RangeServer.h"
 
+#include <Hypertable/RangeServer/CellStoreBlockCompressor.h>
 #include <Hypertable/RangeServer/FillScanBlock.h>
 #include <Hypertable/RangeServer/Global.h>
 #include <Hypertable/RangeServer/GroupCommit.h>
@@ -41,6 +42,7 @@
 #include <Hypertable/RangeServer/MergeScannerRange.h>
 #include <Hypertable/RangeServer/MetaLogDefinitionRangeServer.h>
 #include <Hypertable/RangeServer/MetaLogEntityRange.h>
+#include <Hypertable/RangeServer/MetaLogEntityAttachCellStores.h>
 #include <Hypertable/RangeServer/MetaLogEntityRemoveOkLogs.h>
 #include <Hypertable/RangeServer/MetaLogEntityTask.h>
 #include <Hypertable/RangeServer/ReplayBuffer.h>
@@ -105,7 +107,7 @@ RangeServer::RangeServer(PropertiesPtr &props, ConnectionManagerPtr &conn_mgr,
     m_shutdown(false), m_comm(conn_mgr->get_comm()), m_conn_manager(conn_mgr),
     m_app_queue(app_queue), m_hyperspace(hyperspace), 
     m_get_statistics_outstanding(false), m_timer_handler(0),
-    m_query_cache(0), m_last_revision(TIMESTAMP_MIN), m_last_metrics_update(0),
+    m_query_cache(0), m_last_metrics_update(0),
     m_loadavg_accum(0.0), m_page_in_accum(0), m_page_out_accum(0),
     m_metric_samples(0), m_maintenance_pause_interval(0),
     m_pending_metrics_updates(0), m_profile_query(false)
@@ -131,10 +133,18 @@ RangeServer::RangeServer(PropertiesPtr &props, ConnectionManagerPtr &conn_mgr,
   Global::enable_shadow_cache = cfg.get_bool("AccessGroup.ShadowCache");
   Global::cellstore_target_size_min = cfg.get_i64("CellStore.TargetSize.Minimum");
   Global::cellstore_target_size_max = cfg.get_i64("CellStore.TargetSize.Maximum");
+  {
+    int32_t compression_threads = cfg.get_i32("CellStore.MaxCompressionThreads");
+    if (compression_threads <= 0)
+      compression_threads = m_cores;
+    CellStoreBlockCompressor::set_thread_limit(compression_threads);
+  }
   Global::pseudo_tables = PseudoTables::instance();
   m_scanner_buffer_size = cfg.get_i64("Scanner.BufferSize");
+  m_scanner_zero_copy = cfg.get_bool("Scanner.ZeroCopy");
   port = cfg.get_i16("Port");
   m_update_coalesce_limit = cfg.get_i64("UpdateCoalesceLimit");
+  m_update_queue_limit = cfg.get_i32("UpdateQueueLimit");
   m_maintenance_pause_interval = cfg.get_i32("Testing.MaintenanceNeeded.PauseInterval");
 
   m_control_file_check_interval = cfg.get_i32("ControlFile.CheckInterval");
@@ -167,6 +177,9 @@ RangeServer::RangeServer(PropertiesPtr &props, ConnectionManagerPtr &conn_mgr,
   Global::toplevel_dir = String("/") + Global::toplevel_dir;
 
   Global::merge_cellstore_run_length_threshold = cfg.get_i32("CellStore.Merge.RunLengthThreshold");
+  Global::subcompaction_threads = std::min(cfg.get_i32("Maintenance.Subcompaction.Threads"),
+                                           (int32_t)maintenance_threads);
+  Global::subcompaction_min_size = cfg.get_i64("Maintenance.Subcompaction.MinimumSize");
   Global::ignore_clock_skew_errors = cfg.get_bool("IgnoreClockSkewErrors");
 
   int64_t interval = (int64_t)cfg.get_i32("Maintenance.Interval");
@@ -236,9 +249,20 @@ RangeServer::RangeServer(PropertiesPtr &props, ConnectionManagerPtr &conn_mgr,
   if (block_cache_min > block_cache_max)
     block_cache_min = block_cache_max;
 
-  if (block_cache_max > 0)
+  if (block_cache_max > 0) {
+    FileBlockCache::Policy policy = FileBlockCache::SLRU;
+    String policy_str = cfg.get_str("BlockCache.Policy");
+    if (!strcasecmp(policy_str.c_str(), "LRU"))
+      policy = FileBlockCache::LRU;
+    else if (strcasecmp(policy_str.c_str(), "SLRU"))
+      HT_THROWF(Error::CONFIG_BAD_VALUE,
+                "Invalid value for Hypertable.RangeServer.BlockCache.Policy "
+                "(%s), must be LRU or SLRU", policy_str.c_str());
     Global::block_cache = new FileBlockCache(block_cache_min, block_cache_max,
-					     cfg.get_bool("BlockCache.Compressed"));
+					     cfg.get_bool("BlockCache.Compressed"),
+                                             cfg.get_i32("BlockCache.Shards"),
+                                             policy);
+  }
 
   int64_t query_cache_memory = cfg.get_i64("QueryCache.MaxMemory");
   if (query_cache_memory > 0) {
@@ -248,7 +272,9 @@ RangeServer::RangeServer(PropertiesPtr &props, ConnectionManagerPtr &conn_mgr,
       props->set("Hypertable.RangeServer.QueryCache.MaxMemory", query_cache_memory);
       HT_INFOF("Maximum size of query cache has been reduced to %.2fMB", (double)query_cache_memory / Property::MiB);
     }
-    m_query_cache = new QueryCache(query_cache_memory);
+    m_query_cache = new QueryCache(query_cache_memory,
+                                   cfg.get_i32("QueryCache.Shards"),
+                                   cfg.get_bool("QueryCache.AdmissionControl"));
   }
 
   Global::memory_tracker = new MemoryTracker(Global::block_cache, m_query_cache);
@@ -356,7 +382,12 @@ RangeServer::RangeServer(PropertiesPtr &props, ConnectionManagerPtr &conn_mgr,
   m_timer_handler = new TimerHandler(m_comm, this);
 
   // Create "update" threads
-  for (int i=0; i<3; i++)
+  int32_t qualify_threads = cfg.get_i32("UpdateQualifyThreads");
+  if (qualify_threads < 1)
+    qualify_threads = 1;
+  for (int i=0; i<qualify_threads; i++)
+    m_update_qualify_queues.push_back(new QualifyQueue(m_update_queue_limit));
+  for (int i=0; i<2+qualify_threads; i++)
     m_update_threads.push_back( new Thread(UpdateThread(this, i)) );
 
   local_recover();
@@ -396,7 +427,8 @@ void RangeServer::shutdown() {
 
     // Kill update threads
     m_shutdown = true;
-    m_update_qualify_queue_cond.notify_all();
+    foreach_ht (QualifyQueue *qq, m_update_qualify_queues)
+      qq->shutdown();
     m_update_commit_queue_cond.notify_all();
     m_update_response_queue_cond.notify_all();
     foreach_ht (Thread *thread, m_update_threads)
@@ -601,6 +633,7 @@ void RangeServer::local_recover() {
   CommitLogReaderPtr user_log_reader;
   Ranges ranges;
   std::vector<MetaLog::EntityPtr> entities, stripped_entities;
+  std::vector<MetaLogEntityAttachCellStoresPtr> attach_entities;
   MetaLogEntityRange *range_entity;
   StringSet transfer_logs;
   TableInfoMap replay_map(new TableSchemaCache(m_hyperspace, Global::toplevel_dir));
@@ -668,6 +701,8 @@ void RangeServer::local_recover() {
             else
               continue;
           }
+          else if (dynamic_cast<MetaLogEntityAttachCellStores *>(entity.get()))
+            attach_entities.push_back(dynamic_cast<MetaLogEntityAttachCellStores *>(entity.get()));
           stripped_entities.push_back(entity);
         }
       }
@@ -877,8 +912,31 @@ void RangeServer::local_recover() {
 
       m_live_map->merge(&replay_map);
 
+      // Finish CellStore attachments interrupted by a crash; entities that
+      // fail are left in the RSML and retried on the next restart
+      foreach_ht (MetaLogEntityAttachCellStoresPtr &attach_entity, attach_entities) {
+        TableInfoPtr table_info;
+        RangePtr range;
+        try {
+          if (m_live_map->lookup(attach_entity->table.id, table_info) &&
+              table_info->get_range(&attach_entity->range_spec, range))
+            range->finish_attach_cellstores(attach_entity.get());
+          else
+            HT_WARN_OUT << "Range of interrupted attach no longer loaded,"
+                        << " dropping" << *attach_entity << HT_END;
+          Global::rsml_writer->record_removal(attach_entity.get());
+        }
+        catch (Exception &e) {
+          HT_ERROR_OUT << "Problem finishing attach" << *attach_entity
+                       << " - " << e << HT_END;
+        }
+      }
+
       Global::user_log = new CommitLog(Global::log_dfs, Global::log_dir
                                        + "/user", m_props, user_log_reader.get(), false);
+      if (m_props->get_i32("Hypertable.RangeServer.CommitLog.Pipeline.Workers") > 0)
+        Global::user_log->start_pipeline(
+            m_props->get_i32("Hypertable.RangeServer.CommitLog.Pipeline.Workers"));
 
       {
         ScopedLock lock(m_mutex);
@@ -917,6 +975,9 @@ void RangeServer::local_recover() {
 
       Global::user_log = new CommitLog(Global::log_dfs, Global::log_dir
           + "/user", m_props, user_log_reader.get(), false);
+      if (m_props->get_i32("Hypertable.RangeServer.CommitLog.Pipeline.Workers") > 0)
+        Global::user_log->start_pipeline(
+            m_props->get_i32("Hypertable.RangeServer.CommitLog.Pipeline.Workers"));
 
       Global::rsml_writer = new MetaLog::Writer(Global::log_dfs, rsml_definition,
                                                 Global::log_dir + "/" + rsml_definition->name(),
@@ -1428,6 +1489,15 @@ RangeServer::create_scanner(ResponseCallbackCreateScanner *cb,
       HT_THROW(Error::RANGESERVER_BAD_SCAN_SPEC,
                "can only scan one cell interval");
 
+    if (scan_spec->aggregate != ScanSpec::AGGREGATE_NONE &&
+        (scan_spec->row_limit || scan_spec->cell_limit ||
+         scan_spec->cell_limit_per_family || scan_spec->row_offset ||
+         scan_spec->cell_offset || scan_spec->keys_only ||
+         scan_spec->return_deletes))
+      HT_THROW(Error::RANGESERVER_BAD_SCAN_SPEC,
+               "aggregate combined with limit, offset, keys_only or "
+               "return_deletes");
+
     if (!m_live_map->lookup(table->id, table_info))
       HT_THROW(Error::TABLE_NOT_FOUND, table->id);
 
@@ -1465,10 +1535,12 @@ RangeServer::create_scanner(ResponseCallbackCreateScanner *cb,
                 table->id, range_spec->start_row, range_spec->end_row);
 
     // check query cache
-    if (cache_key && m_query_cache && !table->is_metadata()) {
+    if (cache_key && m_query_cache && !table->is_metadata() &&
+        schema->get_query_cache()) {
       boost::shared_array<uint8_t> ext_buffer;
       uint32_t ext_len;
-      if (m_query_cache->lookup(cache_key, ext_buffer, &ext_len)) {
+      if (m_query_cache->lookup(cache_key, table->id, scan_spec->cache_key(),
+                                ext_buffer, &ext_len)) {
         // The first argument to the response method is flags and the
         // 0th bit is the EOS (end-of-scan) bit, hence the 1
         if ((error = cb->response(1, id, ext_buffer, ext_len, 0, 0))
@@ -1525,7 +1597,8 @@ RangeServer::create_scanner(ResponseCallbackCreateScanner *cb,
     /**
      *  Send back data
      */
-    if (cache_key && m_query_cache && !table->is_metadata() && !more) {
+    if (cache_key && m_query_cache && !table->is_metadata() && !more &&
+        schema->get_query_cache()) {
       const char *cache_row_key = scan_spec->cache_key();
       char *row_key_ptr, *tablename_ptr;
       uint8_t *buffer = new uint8_t [ rbuf.fill() + strlen(cache_row_key) + strlen(table->id) + 2 ];
@@ -1580,6 +1653,7 @@ RangeServer::fetch_scanblock(ResponseCallbackFetchScanblock *cb,
   RangePtr range;
   bool more = true;
   DynamicBuffer rbuf;
+  ScanBlockSegmentsPtr block;
   TableInfoPtr table_info;
   TableIdentifierManaged scanner_table;
   SchemaPtr schema;
@@ -1588,9 +1662,21 @@ RangeServer::fetch_scanblock(ResponseCallbackFetchScanblock *cb,
 
   try {
 
-    if (!Global::scanner_map.get(scanner_id, scanner, range, scanner_table))
+    if (!Global::scanner_map.get(scanner_id, scanner, range, scanner_table)) {
+      // fetches pipelined past the last block of a scanner are expected,
+      // answer them without logging an error
+      if (Global::scanner_map.is_closed(scanner_id)) {
+        HT_DEBUGF("Fetch for closed scanner id=%u", scanner_id);
+        if ((error = cb->error(Error::RANGESERVER_INVALID_SCANNER_ID,
+                               format("scanner ID %d already closed",
+                                      scanner_id))) != Error::OK)
+          HT_ERRORF("Problem sending error response - %s",
+                    Error::get_text(error));
+        return;
+      }
       HT_THROW(Error::RANGESERVER_INVALID_SCANNER_ID,
                format("scanner ID %d", scanner_id));
+    }
 
     HT_MAYBE_FAIL_X("fetch-scanblock-user-1", !scanner_table.is_system());
 
@@ -1610,7 +1696,12 @@ RangeServer::fetch_scanblock(ResponseCallbackFetchScanblock *cb,
 
     uint64_t cells_scanned, cells_returned, bytes_scanned, bytes_returned;
 
-    more = FillScanBlock(scanner, rbuf, m_scanner_buffer_size);
+    if (m_scanner_zero_copy) {
+      block = new ScanBlockSegments();
+      more = FillScanBlock(scanner, block.get(), m_scanner_buffer_size);
+    }
+    else
+      more = FillScanBlock(scanner, rbuf, m_scanner_buffer_size);
 
     MergeScanner *mscanner = dynamic_cast<MergeScanner*>(scanner.get());
 
@@ -1634,14 +1725,22 @@ RangeServer::fetch_scanblock(ResponseCallbackFetchScanblock *cb,
      */
     {
       short moreflag = more ? 0 : 1;
-      StaticBuffer ext(rbuf);
+      size_t size;
 
-      error = cb->response(moreflag, scanner_id, ext);
+      if (block) {
+        size = block->size;
+        error = cb->response(moreflag, scanner_id, block);
+      }
+      else {
+        StaticBuffer ext(rbuf);
+        size = ext.size;
+        error = cb->response(moreflag, scanner_id, ext);
+      }
       if (error != Error::OK)
         HT_ERRORF("Problem sending OK response - %s", Error::get_text(error));
 
       HT_DEBUGF("Successfully fetched %u bytes (%lld k/v pairs) of scan data",
-                ext.size-4, (Lld)cells_returned);
+                (unsigned)size-4, (Lld)cells_returned);
     }
 
   }
@@ -2128,18 +2227,26 @@ RangeServer::update(ResponseCallbackUpdate *cb, const TableIdentifier *table,
 
 void
 RangeServer::batch_update(std::vector<TableUpdate *> &updates, boost::xtime expire_time) {
-  UpdateContext *uc = new UpdateContext(updates, expire_time);
+  HT_ASSERT(!updates.empty());
 
-  // Enqueue update
-  {
-    ScopedLock lock(m_update_qualify_queue_mutex);
-    HT_ASSERT(!updates.empty());
-    if (m_profile_query)
-      boost::xtime_get(&uc->start_time, TIME_UTC_);
-    m_update_qualify_queue.push_back(uc);
-    m_update_qualify_queue_cond.notify_all();
+  if (m_update_qualify_queues.size() == 1) {
+    update_qualify_enqueue(0, new UpdateContext(updates, expire_time));
+    return;
   }
 
+  // Split the batch so that each table goes to its own partition
+  std::map<size_t, std::vector<TableUpdate *> > partition_map;
+  QualifyQueue::split(updates, m_update_qualify_queues.size(), partition_map);
+
+  for (std::map<size_t, std::vector<TableUpdate *> >::iterator iter = partition_map.begin();
+       iter != partition_map.end(); ++iter)
+    update_qualify_enqueue(iter->first, new UpdateContext(iter->second, expire_time));
+}
+
+void RangeServer::update_qualify_enqueue(size_t partition, UpdateContext *uc) {
+  if (m_profile_query)
+    boost::xtime_get(&uc->start_time, TIME_UTC_);
+  m_update_qualify_queues[partition]->push(uc);
 }
 
 namespace {
@@ -2152,7 +2259,7 @@ namespace {
 
 }
 
-void RangeServer::update_qualify_and_transform() {
+void RangeServer::update_qualify_and_transform(size_t partition) {
   UpdateContext *uc;
   SerializedKey key;
   const uint8_t *mod, *mod_end;
@@ -2170,21 +2277,13 @@ void RangeServer::update_qualify_and_transform() {
   CommitLogPtr transfer_log;
   RangeUpdate range_update;
   RangePtr range;
-  Mutex &mutex = m_update_qualify_queue_mutex;
-  boost::condition &cond = m_update_qualify_queue_cond;
-  std::list<UpdateContext *> &queue = m_update_qualify_queue;
+  QualifyQueue *qq = m_update_qualify_queues[partition];
+  int64_t &last_revision = qq->last_revision;
 
   while (true) {
 
-    {
-      ScopedLock lock(mutex);
-      while (queue.empty() && !m_shutdown)
-        cond.wait(lock);
-      if (m_shutdown)
-        return;
-      uc = queue.front();
-      queue.pop_front();
-    }
+    if ((uc = qq->pop()) == 0)
+      return;
 
     rulist = 0;
     transfer_bufp = 0;
@@ -2202,8 +2301,8 @@ void RangeServer::update_qualify_and_transform() {
     // TODO: Sanity check mod data (checksum validation)
 
     // hack to workaround xen timestamp issue
-    if (uc->auto_revision < m_last_revision)
-      uc->auto_revision = m_last_revision;
+    if (uc->auto_revision < last_revision)
+      uc->auto_revision = last_revision;
 
     foreach_ht (TableUpdate *table_update, uc->updates) {
 
@@ -2509,15 +2608,15 @@ void RangeServer::update_qualify_and_transform() {
               // timestamp and/or revision number by re-writing the key
               // with the added timestamp and/or revision tacked on to the end
               transform_key(key, cur_bufp, ++uc->auto_revision,
-                      &m_last_revision, cf ? cf->time_order_desc : false);
+                      &last_revision, cf ? cf->time_order_desc : false);
 
               // Validate revision number
-              if (m_last_revision < latest_range_revision) {
-                if (m_last_revision != uc->auto_revision) {
+              if (last_revision < latest_range_revision) {
+                if (last_revision != uc->auto_revision) {
                   HT_THROWF(Error::RANGESERVER_REVISION_ORDER_ERROR,
                           "Supplied revision (%lld) is less than most recently "
                           "seen revision (%lld) for range %s",
-                          (Lld)m_last_revision, (Lld)latest_range_revision,
+                          (Lld)last_revision, (Lld)latest_range_revision,
                           rulist->range->get_name().c_str());
                 }
               }
@@ -2548,8 +2647,8 @@ void RangeServer::update_qualify_and_transform() {
 
             // if there were transferring updates, record the latest revision
             if (transfer_pending && rulist->transfer_buf_reset_offset < rulist->transfer_buf.fill()) {
-              if (rulist->latest_transfer_revision < m_last_revision)
-                rulist->latest_transfer_revision = m_last_revision;
+              if (rulist->latest_transfer_revision < last_revision)
+                rulist->latest_transfer_revision = last_revision;
             }
           }
           else {
@@ -2586,11 +2685,14 @@ void RangeServer::update_qualify_and_transform() {
         uc->total_added += table_update->total_added;
     }
 
-    uc->last_revision = m_last_revision;
+    uc->last_revision = last_revision;
 
     // Enqueue update
     {
       ScopedLock lock(m_update_commit_queue_mutex);
+      while (m_update_commit_queue_count >= (int32_t)m_update_queue_limit &&
+             !m_shutdown)
+        m_update_commit_queue_cond.wait(lock);
       if (m_profile_query) {
         boost::xtime now;
         boost::xtime_get(&now, TIME_UTC_);
@@ -2625,6 +2727,7 @@ void RangeServer::update_commit() {
       uc = m_update_commit_queue.front();
       m_update_commit_queue.pop_front();
       m_update_commit_queue_count--;
+      m_update_commit_queue_cond.notify_all();
     }
 
     committed_transfer_data = 0;
@@ -2712,15 +2815,43 @@ void RangeServer::update_commit() {
     // Now sync the USER commit log if needed
     if (do_sync) {
       size_t retry_count = 0;
+      int sync_error = Error::OK;
       uc->total_syncs++;
       while ((error = Global::user_log->sync()) != Error::OK) {
         HT_ERRORF("Problem sync'ing user log fragment (%s) - %s",
                   Global::user_log->get_current_fragment_file().c_str(),
                   Error::get_text(error));
-        if (++retry_count == 6)
+        if (sync_error == Error::OK)
+          sync_error = error;
+        // A pipelined log keeps returning the error until it is restarted,
+        // so retrying the sync would only hold up the batch
+        if (Global::user_log->pipelined() || ++retry_count == 6)
           break;
         poll(0, 0, 10000);
       }
+      // A pipelined log reports append failures on sync, at which point
+      // there is no telling which of the coalesced blocks made it to disk.
+      // The batch is failed and the log continues in a new fragment.
+      if (sync_error != Error::OK && Global::user_log->pipelined()) {
+        if ((error = Global::user_log->restart_pipeline()) != Error::OK)
+          HT_ERRORF("Problem restarting user log pipeline (%s) - %s",
+                    Global::user_log->get_log_dir().c_str(),
+                    Error::get_text(error));
+        coalesce_queue.push_back(uc);
+        foreach_ht (UpdateContext *failed_uc, coalesce_queue) {
+          foreach_ht (TableUpdate *table_update, failed_uc->updates) {
+            if (table_update->id.is_user() && table_update->error == Error::OK &&
+                table_update->go_buf.ptr > table_update->go_buf.mark) {
+              table_update->error = sync_error;
+              table_update->error_msg = format("Problem writing %d bytes to commit log (%s) - %s",
+                                               (int)table_update->go_buf.fill(),
+                                               Global::user_log->get_log_dir().c_str(),
+                                               Error::get_text(sync_error));
+            }
+          }
+        }
+        coalesce_queue.pop_back();
+      }
     }
 
     // Enqueue update
@@ -3150,6 +3281,23 @@ void RangeServer::set_state(ResponseCallback *cb,
 }
 
 
+namespace {
+
+  void get_block_cache_shard_stats(std::vector<StatsRangeServer::BlockCacheShard> &shards) {
+    std::vector<FileBlockCache::ShardStats> stats;
+    Global::block_cache->get_shard_stats(stats);
+    shards.resize(stats.size());
+    for (size_t i=0; i<stats.size(); i++) {
+      shards[i].max_memory = stats[i].limit;
+      shards[i].available_memory = stats[i].available;
+      shards[i].accesses = stats[i].accesses;
+      shards[i].hits = stats[i].hits;
+      shards[i].evictions = stats[i].evictions;
+    }
+  }
+
+}
+
 void RangeServer::get_statistics(ResponseCallbackGetStatistics *cb,
                                  std::vector<SystemVariable::Spec> &specs,
                                  uint64_t generation) {
@@ -3218,12 +3366,14 @@ void RangeServer::get_statistics(ResponseCallbackGetStatistics *cb,
                                    &m_stats->block_cache_available_memory,
                                    &m_stats->block_cache_accesses,
                                    &m_stats->block_cache_hits);
+    get_block_cache_shard_stats(m_stats->block_cache_shards);
   }
   else {
     m_stats->block_cache_max_memory = 0;
     m_stats->block_cache_available_memory = 0;
     m_stats->block_cache_accesses = 0;
     m_stats->block_cache_hits = 0;
+    m_stats->block_cache_shards.clear();
   }
 
 
@@ -3375,12 +3525,14 @@ void RangeServer::get_statistics(ResponseCallbackGetStatistics *cb,
                                    &m_stats->block_cache_available_memory,
                                    &m_stats->block_cache_accesses,
                                    &m_stats->block_cache_hits);
+    get_block_cache_shard_stats(m_stats->block_cache_shards);
   }
   else {
     m_stats->block_cache_max_memory = 0;
     m_stats->block_cache_available_memory = 0;
     m_stats->block_cache_accesses = 0;
     m_stats->block_cache_hits = 0;
+    m_stats->block_cache_shards.clear();
   }
 
   /**
@@ -3626,6 +3778,53 @@ RangeServer::relinquish_range(ResponseCallback *cb,
   }
 }
 
+void
+RangeServer::attach_cellstores(ResponseCallback *cb,
+        const TableIdentifier *table, const RangeSpec *range_spec,
+        const std::vector<String> &ag_names, const std::vector<String> &files) {
+  TableInfoPtr table_info;
+  RangePtr range;
+  std::stringstream sout;
+
+  sout << "attach_cellstores\n" << *table << *range_spec;
+  for (size_t i=0; i<files.size(); i++)
+    sout << ag_names[i] << " <- " << files[i] << "\n";
+  HT_INFOF("%s", sout.str().c_str());
+
+  if (!m_replay_finished) {
+    if (!wait_for_recovery_finish(cb->get_event()->expiration_time()))
+      return;
+  }
+
+  try {
+    if (table->is_system())
+      HT_THROW(Error::NOT_ALLOWED, "Unable to attach CellStores to system table");
+
+    if (m_server_state->readonly())
+      HT_THROW(Error::RANGESERVER_SERVER_IN_READONLY_MODE, table->id);
+
+    if (!m_live_map->lookup(table->id, table_info)) {
+      cb->error(Error::TABLE_NOT_FOUND, table->id);
+      return;
+    }
+
+    if (!table_info->get_range(range_spec, range))
+      HT_THROW(Error::RANGESERVER_RANGE_NOT_FOUND,
+              format("%s[%s..%s]", table->id, range_spec->start_row,
+                  range_spec->end_row));
+
+    range->attach_cellstores(ag_names, files);
+
+    cb->response_ok();
+  }
+  catch (Hypertable::Exception &e) {
+    int error = 0;
+    HT_INFOF("%s - %s", Error::get_text(e.code()), e.what());
+    if (cb && (error = cb->error(e.code(), e.what())) != Error::OK)
+      HT_ERRORF("Problem sending error response - %s", Error::get_text(error));
+  }
+}
+
 void RangeServer::replay_fragments(ResponseCallback *cb, int64_t op_id,
         const String &location, int plan_generation, 
         int type, const vector<uint32_t> &fragments,
@@ -45,6 +45,7 @@
 #include <Hypertable/RangeServer/TableInfo.h>
 #include <Hypertable/RangeServer/TableInfoMap.h>
 #include <Hypertable/RangeServer/TimerHandler.h>
+#include <Hypertable/RangeServer/UpdateQualifyQueue.h>
 
 #include <Hypertable/Lib/Cells.h>
 #include <Hypertable/Lib/MasterClient.h>
@@ -130,6 +131,11 @@ namespace Hypertable {
 
     void relinquish_range(ResponseCallback *, const TableIdentifier *,
                           const RangeSpec *);
+
+    void attach_cellstores(ResponseCallback *, const TableIdentifier *,
+                           const RangeSpec *,
+                           const std::vector<String> &ag_names,
+                           const std::vector<String> &files);
     void heapcheck(ResponseCallback *, const char *);
 
     void metadata_sync(ResponseCallback *, const char *, uint32_t flags, std::vector<const char *> columns);
@@ -201,7 +207,7 @@ namespace Hypertable {
 
     friend class UpdateThread;
 
-    void update_qualify_and_transform();
+    void update_qualify_and_transform(size_t partition);
     void update_commit();
     void update_add_and_respond();
 
@@ -264,9 +270,12 @@ namespace Hypertable {
       uint32_t add_time;
     };
 
-    Mutex                      m_update_qualify_queue_mutex;
-    boost::condition           m_update_qualify_queue_cond;
-    std::list<UpdateContext *> m_update_qualify_queue;
+    typedef UpdateQualifyQueue<UpdateContext> QualifyQueue;
+
+    void update_qualify_enqueue(size_t partition, UpdateContext *uc);
+
+    std::vector<QualifyQueue *> m_update_qualify_queues;
+    size_t                     m_update_queue_limit;
     Mutex                      m_update_commit_queue_mutex;
     boost::condition           m_update_commit_queue_cond;
     int32_t                    m_update_commit_queue_count;
@@ -325,8 +334,8 @@ namespace Hypertable {
     GroupCommitTimerHandlerPtr m_group_commit_timer_handler;
     uint32_t               m_update_delay;
     QueryCache            *m_query_cache;
-    int64_t                m_last_revision;
     int64_t                m_scanner_buffer_size;
+    bool                   m_scanner_zero_copy;
     time_t                 m_last_metrics_update;
     time_t                 m_next_metrics_update;
     double                 m_loadavg_accum;
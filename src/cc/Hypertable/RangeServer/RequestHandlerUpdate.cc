@@ -26,6 +26,7 @@
 #include "AsyncComm/ResponseCallback.h"
 #include "Common/Serialization.h"
 
+#include "Hypertable/Lib/RangeServerProtocol.h"
 #include "Hypertable/Lib/Types.h"
 
 #include "RangeServer.h"
@@ -48,9 +49,16 @@ void RequestHandlerUpdate::run() {
     uint32_t count = Serialization::decode_i32(&decode_ptr, &decode_remain);
     uint32_t flags = Serialization::decode_i32(&decode_ptr, &decode_remain);
 
-    mods.base = (uint8_t *)decode_ptr;
-    mods.size = decode_remain;
-    mods.own = false;
+    if (flags & RangeServerProtocol::UPDATE_FLAG_COMPRESSED) {
+      // the update request takes ownership of the inflated buffer
+      RangeServerProtocol::decompress_updates(decode_ptr, decode_remain, mods);
+      flags &= ~RangeServerProtocol::UPDATE_FLAG_COMPRESSED;
+    }
+    else {
+      mods.base = (uint8_t *)decode_ptr;
+      mods.size = decode_remain;
+      mods.own = false;
+    }
 
     m_range_server->update(&cb, &table, count, mods, flags);
   }
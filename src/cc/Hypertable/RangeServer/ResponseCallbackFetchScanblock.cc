@@ -38,3 +38,18 @@ ResponseCallbackFetchScanblock::response(short moreflag, int32_t id,
   return m_comm->send_response(m_event->addr, cbp);
 }
 
+int
+ResponseCallbackFetchScanblock::response(short moreflag, int32_t id,
+        ScanBlockSegmentsPtr &block) {
+  CommHeader header;
+  header.initialize_from_request_header(m_event->header);
+  CommBufPtr cbp(new CommBuf( header, 18));
+  cbp->append_i32(Error::OK);
+  cbp->append_i16(moreflag);
+  cbp->append_i32(id);              // scanner ID
+  cbp->append_i32(0);               // skipped_rows
+  cbp->append_i32(0);               // skipped_cells
+  block->add_to(cbp.get());
+  return m_comm->send_response(m_event->addr, cbp);
+}
+
@@ -27,6 +27,8 @@
 #include "AsyncComm/CommBuf.h"
 #include "AsyncComm/ResponseCallback.h"
 
+#include "FillScanBlock.h"
+
 namespace Hypertable {
 
   class ResponseCallbackFetchScanblock : public ResponseCallback {
@@ -35,6 +37,13 @@ namespace Hypertable {
       : ResponseCallback(comm, event_ptr) { }
 
     int response(short moreflag, int32_t id, StaticBuffer &ext);
+
+    /** Sends scan block without copying it.
+     * @param moreflag End-of-scan flag
+     * @param id Scanner ID
+     * @param block Scan block segments
+     */
+    int response(short moreflag, int32_t id, ScanBlockSegmentsPtr &block);
   };
 
 }
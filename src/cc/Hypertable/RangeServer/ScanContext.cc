@@ -39,14 +39,11 @@ const uint8_t* CellFilterInfo::memfind(
   const uint8_t* block,        // Block containing data
   size_t         block_size,   // Size of block in bytes
   const uint8_t* pattern,      // Pattern to search for
-  size_t         pattern_size, // Size of pattern block
-  size_t*        shift,        // Shift table (search buffer)
-  bool*          repeat_find)  // true: search buffer already init
+  size_t         pattern_size) // Size of pattern block
 {
   assert(block);
   assert(pattern);
-  assert(shift);
-  if (block == 0 || pattern == 0 || shift == 0)
+  if (block == 0 || pattern == 0)
     return 0;
 
   // Pattern must be smaller or equal in size to string
@@ -56,42 +53,75 @@ const uint8_t* CellFilterInfo::memfind(
   if (pattern_size == 0)
     return block;
 
-  // Build the shift table unless we're continuing a previous search.
-  // The shift table determines how far to shift before trying to match
-  // again, if a match at this point fails.  If the byte after where the
-  // end of our pattern falls is not in our pattern, then we start to
-  // match again after that byte; otherwise we line up the last occurence 
-  // of that byte in our pattern under that byte, and try match again.
-  if (!repeat_find || !*repeat_find) {
-    for (size_t byte_nbr = 0; byte_nbr < 256; byte_nbr++)
-      shift[byte_nbr] = pattern_size + 1;
-    for (size_t byte_nbr = 0; byte_nbr < pattern_size; byte_nbr++)
-      shift[(uint8_t) pattern[byte_nbr]] = pattern_size - byte_nbr;
-
-    if (repeat_find)
-      *repeat_find = true;
+  // Let memchr(), which is vectorized in the C library, skip ahead to each
+  // candidate position of the first pattern byte and verify the remainder
+  // with memcmp()
+  const uint8_t* limit = block + (block_size - pattern_size + 1);
+  const uint8_t* match_base = block;
+  while (match_base < limit) {
+    match_base = (const uint8_t *)memchr(match_base, *pattern,
+                                         limit - match_base);
+    if (match_base == 0)
+      return 0;
+    if (memcmp(match_base + 1, pattern + 1, pattern_size - 1) == 0)
+      return match_base;
+    ++match_base;
   }
+  return 0;
+}
 
-  // Search for the block, each time jumping up by the amount
-  // computed in the shift table
-  const uint8_t* limit = block + (block_size - pattern_size + 1);
-  assert(limit > block);
-
-  for (const uint8_t* match_base = block;
-    match_base < limit;
-    match_base += shift[*(match_base + pattern_size)]) {
-    const uint8_t* match_ptr  = match_base;
-    size_t match_size = 0;
-    // Compare pattern until it all matches, or we find a difference
-    while (*match_ptr++ == pattern[match_size++]) {
-      assert(match_size <= pattern_size && match_ptr == (match_base + match_size));
-
-      // If we found a match, return the start address
-      if (match_size >= pattern_size)
-        return match_base;
+void CellFilterInfo::compile() {
+
+  // Exact qualifiers: open addressing hash table, at most half full
+  exact_qualifier_table.clear();
+  if (!exact_qualifiers.empty()) {
+    size_t slots = 4;
+    while (slots < exact_qualifiers.size() * 2)
+      slots <<= 1;
+    exact_qualifier_table.resize(slots, 0);
+    foreach_ht (const String &qualifier, exact_qualifiers) {
+      size_t i = murmurhash2(qualifier.c_str(), qualifier.length(), 0)
+        & (slots - 1);
+      while (exact_qualifier_table[i])
+        i = (i + 1) & (slots - 1);
+      exact_qualifier_table[i] = &qualifier;
     }
   }
-  return 0;
+
+  // Prefix qualifiers: StringSet is sorted, so a prefix that is covered by
+  // a shorter one is always directly preceded by a covering prefix
+  minimal_prefixes.clear();
+  foreach_ht (const String &prefix, prefix_qualifiers) {
+    if (!minimal_prefixes.empty()) {
+      const String *last = minimal_prefixes.back();
+      if (last->length() <= prefix.length() &&
+          memcmp(last->c_str(), prefix.c_str(), last->length()) == 0)
+        continue;
+    }
+    minimal_prefixes.push_back(&prefix);
+  }
+
+  // Regular expressions: match them all in a single pass
+  delete regexp_set;
+  regexp_set = 0;
+  if (regexp_qualifiers.size() > 1) {
+    regexp_set = new RE2::Set(RE2::DefaultOptions, RE2::UNANCHORED);
+    foreach_ht (RE2 *regexp, regexp_qualifiers) {
+      if (regexp_set->Add(regexp->pattern(), 0) < 0) {
+        delete regexp_set;
+        regexp_set = 0;
+        break;
+      }
+    }
+    if (regexp_set && !regexp_set->Compile()) {
+      HT_INFO("Unable to compile qualifier regexp set, falling back to "
+              "individual matching");
+      delete regexp_set;
+      regexp_set = 0;
+    }
+  }
+
+  compiled = true;
 }
 
 void
@@ -167,6 +197,12 @@ ScanContext::initialize(int64_t rev, const ScanSpec *ss,
         if (cf->counter)
           family_info[cf->id].counter = true;
       }
+
+      // build the qualifier filters before any cell is matched
+      for (size_t id=0; id<family_info.size(); id++) {
+        if (family_info[id].has_qualifier_filter())
+          family_info[id].compile();
+      }
     }
     else {
       Schema::AccessGroups &aglist = schema->get_access_groups();
@@ -22,7 +22,8 @@
 #ifndef HYPERTABLE_SCANCONTEXT_H
 #define HYPERTABLE_SCANCONTEXT_H
 
-#include<re2/re2.h>
+#include <re2/re2.h>
+#include <re2/set.h>
 
 #include <cassert>
 #include <utility>
@@ -30,6 +31,7 @@
 
 #include "Common/ByteString.h"
 #include "Common/Error.h"
+#include "Common/MurmurHash.h"
 #include "Common/ReferenceCount.h"
 #include "Common/StringExt.h"
 
@@ -47,7 +49,8 @@ namespace Hypertable {
     CellFilterInfo(): cutoff_time(0), max_versions(0), counter(false),
         has_index(false), has_qualifier_index(false),
         accept_empty_qualifier(false), filter_by_exact_qualifier(false), 
-        filter_by_regexp_qualifier(false), filter_by_prefix_qualifier(false) {}
+        filter_by_regexp_qualifier(false), filter_by_prefix_qualifier(false),
+        compiled(false), regexp_set(0) {}
 
     CellFilterInfo(const CellFilterInfo& other) {
       cutoff_time = other.cutoff_time;
@@ -58,23 +61,24 @@ namespace Hypertable {
         regexp_qualifiers.push_back(new RE2(other.regexp_qualifiers[ii]->pattern()));
       }
       exact_qualifiers = other.exact_qualifiers;
-      foreach_ht (const String& qualifier, exact_qualifiers) {
-        exact_qualifiers_set.insert(qualifier.c_str());
-      }
       prefix_qualifiers = other.prefix_qualifiers;
       column_predicates = other.column_predicates;
-      search_buf_column_predicates = other.search_buf_column_predicates;
       filter_by_exact_qualifier = other.filter_by_exact_qualifier;
       filter_by_prefix_qualifier = other.filter_by_prefix_qualifier;
       filter_by_regexp_qualifier = other.filter_by_regexp_qualifier;
       has_index = other.has_index;
       has_qualifier_index = other.has_qualifier_index;
       accept_empty_qualifier = other.accept_empty_qualifier;
+      compiled = false;
+      regexp_set = 0;
+      if (other.compiled)
+        compile();
     }
 
     ~CellFilterInfo() {
       for (size_t ii=0; ii<regexp_qualifiers.size(); ++ii)
         delete regexp_qualifiers[ii];
+      delete regexp_set;
     }
 
     bool qualifier_matches(const char *qualifier, size_t qualifier_len) {
@@ -83,29 +87,25 @@ namespace Hypertable {
               !filter_by_prefix_qualifier))
         return true;
 
+      assert(compiled);
+
       // check exact match first
-      if (filter_by_exact_qualifier) {
-        if (exact_qualifiers_set.find(qualifier) != exact_qualifiers_set.end())
-          return true;
-      }
+      if (filter_by_exact_qualifier &&
+          exact_qualifier_matches(qualifier, qualifier_len))
+        return true;
 
       // check prefix filters
-      if (filter_by_prefix_qualifier) {
-	int cmp;
-        foreach_ht (const String& qstr, prefix_qualifiers) {
-          if (qstr.size() > qualifier_len)
-            continue;
-          if (0 == (cmp = memcmp(qstr.c_str(), qualifier, qstr.size())))
-            return true;
-	  else if (cmp > 0)
-	    break;
-        }
-      }
+      if (filter_by_prefix_qualifier &&
+          prefix_qualifier_matches(qualifier, qualifier_len))
+        return true;
 
       // check for regexp match
       if (filter_by_regexp_qualifier) {
+        re2::StringPiece input(qualifier, qualifier_len);
+        if (regexp_set)
+          return regexp_set->Match(input, 0);
         for (size_t ii=0; ii<regexp_qualifiers.size(); ++ii)
-          if (RE2::PartialMatch(qualifier, *regexp_qualifiers[ii]))
+          if (RE2::PartialMatch(input, *regexp_qualifiers[ii]))
             return true;
         return false;
       }
@@ -113,6 +113,9 @@ namespace Hypertable {
       return false;
     }
 
+    /** Adds a qualifier filter.  compile() must be called after the last
+     * one was added and before qualifier_matches() is used.
+     */
     void add_qualifier(const char *qualifier, bool is_regexp, bool is_prefix) {
       if (is_regexp) {
         RE2 *regexp = new RE2(qualifier);
@@ -127,11 +130,10 @@ namespace Hypertable {
         filter_by_prefix_qualifier = true;
       }
       else {
-        pair<StringSet::iterator, bool> r = exact_qualifiers.insert(qualifier);
-        if (r.second)
-          exact_qualifiers_set.insert(r.first->c_str());
+        exact_qualifiers.insert(qualifier);
         filter_by_exact_qualifier = true;
       }
+      compiled = false;
     }
 
     bool has_qualifier_filter() const {
@@ -141,7 +143,6 @@ namespace Hypertable {
     bool has_qualifier_regexp_filter() const { return filter_by_regexp_qualifier;}
 
     bool column_predicate_matches(const char* value, uint32_t value_len) {
-      int ncp = 0;
       foreach_ht (const ColumnPredicate& cp, column_predicates) {
         if (cp.value && value) {
           switch (cp.operation) {
@@ -156,15 +157,10 @@ namespace Hypertable {
                 return true;
               break;
             case Hypertable::ColumnPredicate::CONTAINS:
-              if (cp.value_len <= value_len) {
-                while (search_buf_column_predicates.size() < column_predicates.size()) {
-                  search_buf_column_predicates.push_back(search_buf_t());
-                }
-                search_buf_t& buf = search_buf_column_predicates[ncp];
-                if (memfind((const uint8_t*)value, value_len, (const uint8_t*)cp.value,
-                      cp.value_len, buf.shift, &buf.repeat) != 0)
-                  return true;
-              }
+              if (cp.value_len <= value_len &&
+                  memfind((const uint8_t*)value, value_len,
+                          (const uint8_t*)cp.value, cp.value_len) != 0)
+                return true;
               break;
             default:
               break;
@@ -172,7 +168,6 @@ namespace Hypertable {
         }
         else if (!cp.value && !value)
           return true;
-        ++ncp;
       }
       return false;
     }
@@ -192,33 +187,77 @@ namespace Hypertable {
     bool has_qualifier_index;
     bool accept_empty_qualifier;
 
+    /** Builds the lookup structures for the qualifier filters: an open
+     * addressing hash table for the exact qualifiers, a sorted, prefix-free
+     * list of the prefix qualifiers and, if there is more than one regular
+     * expression, an RE2::Set matching all of them in one pass.  Called by
+     * ScanContext::initialize() once all qualifiers are added, so the
+     * filters are read-only while cells are matched.
+     */
+    void compile();
+
   private:
     // disable assignment -- if needed then implement with deep copy of
     // qualifier_regexp
     CellFilterInfo& operator = (const CellFilterInfo&);
+
+    bool exact_qualifier_matches(const char *qualifier, size_t len) const {
+      size_t mask = exact_qualifier_table.size() - 1;
+      size_t i = murmurhash2(qualifier, len, 0) & mask;
+      for (const String *q; (q = exact_qualifier_table[i]) != 0;
+           i = (i + 1) & mask) {
+        if (q->length() == len && memcmp(q->c_str(), qualifier, len) == 0)
+          return true;
+      }
+      return false;
+    }
+
+    /// In a prefix-free sorted list, the only candidate that can be a
+    /// prefix of <code>qualifier</code> is the greatest one not greater
+    /// than <code>qualifier</code>
+    bool prefix_qualifier_matches(const char *qualifier, size_t len) const {
+      size_t lo = 0, hi = minimal_prefixes.size(), mid;
+      while (lo < hi) {
+        mid = (lo + hi) / 2;
+        if (compare(*minimal_prefixes[mid], qualifier, len) <= 0)
+          lo = mid + 1;
+        else
+          hi = mid;
+      }
+      if (lo == 0)
+        return false;
+      const String *prefix = minimal_prefixes[lo-1];
+      return prefix->length() <= len &&
+        memcmp(prefix->c_str(), qualifier, prefix->length()) == 0;
+    }
+
+    static int compare(const String &str, const char *buf, size_t len) {
+      int cmp = memcmp(str.c_str(), buf, std::min(str.length(), len));
+      if (cmp == 0)
+        return (str.length() < len) ? -1 : (str.length() > len ? 1 : 0);
+      return cmp;
+    }
+
     vector<RE2 *> regexp_qualifiers;
     StringSet exact_qualifiers;
-    CstrSet exact_qualifiers_set;
     StringSet prefix_qualifiers;
     std::vector<ColumnPredicate> column_predicates;
-    struct search_buf_t {
-      size_t shift[256];
-      bool repeat;
-      search_buf_t() : repeat( false ) { }
-    };
-    std::vector<search_buf_t> search_buf_column_predicates;
     bool filter_by_exact_qualifier;
     bool filter_by_regexp_qualifier;
     bool filter_by_prefix_qualifier;
 
-    // Searches for a pattern in a block of memory using the Boyer- Moore-Horspool-Sunday algorithm
+    // Compiled qualifier filters (see compile())
+    bool compiled;
+    std::vector<const String *> exact_qualifier_table;
+    std::vector<const String *> minimal_prefixes;
+    RE2::Set *regexp_set;
+
+    // Searches for a pattern in a block of memory
     static const uint8_t* memfind(
       const uint8_t* block,        // Block containing data
       size_t         block_size,   // Size of block in bytes
       const uint8_t* pattern,      // Pattern to search for
-      size_t         pattern_size, // Size of pattern block
-      size_t*        shift,        // Shift table (search buffer)
-      bool*          repeat_find); // true, search buffer already initialized
+      size_t         pattern_size); // Size of pattern block
   };
 
   /**
@@ -66,7 +66,37 @@ ScannerMap::get(uint32_t id, CellListScannerPtr &scanner_ptr,
  */
 bool ScannerMap::remove(uint32_t id) {
   ScopedLock lock(m_mutex);
-  return (m_scanner_map.erase(id) == 0) ? false : true;
+  if (m_scanner_map.erase(id) == 0)
+    return false;
+  add_closed(id);
+  return true;
+}
+
+
+bool ScannerMap::is_closed(uint32_t id) {
+  ScopedLock lock(m_mutex);
+  return m_closed_set.count(id) > 0;
+}
+
+
+void ScannerMap::set_closed_limit(size_t limit) {
+  ScopedLock lock(m_mutex);
+  m_closed_limit = limit;
+  while (m_closed_ids.size() > m_closed_limit) {
+    m_closed_set.erase(m_closed_ids.front());
+    m_closed_ids.pop_front();
+  }
+}
+
+
+void ScannerMap::add_closed(uint32_t id) {
+  if (m_closed_limit == 0 || !m_closed_set.insert(id).second)
+    return;
+  m_closed_ids.push_back(id);
+  if (m_closed_ids.size() > m_closed_limit) {
+    m_closed_set.erase(m_closed_ids.front());
+    m_closed_ids.pop_front();
+  }
 }
 
 
@@ -83,6 +113,7 @@ void ScannerMap::purge_expired(uint32_t max_idle_millis) {
       ++iter;
       (*tmp_iter).second.scanner_ptr = 0;
       (*tmp_iter).second.range_ptr = 0;
+      add_closed((*tmp_iter).first);
       m_scanner_map.erase(tmp_iter);
     }
     else
@@ -33,14 +33,16 @@ extern "C" {
 #include <time.h>
 }
 
+#include <deque>
 #include <unordered_map>
+#include <unordered_set>
 
 namespace Hypertable {
 
   class ScannerMap {
 
   public:
-    ScannerMap() : m_mutex() { return; }
+    ScannerMap() : m_mutex(), m_closed_limit(CLOSED_LIMIT) { return; }
 
     /**
      * This method computes a unique scanner ID and puts the given scanner
@@ -69,13 +71,33 @@ namespace Hypertable {
 
     /**
      * This method removes the entry in the scanner map corresponding to the
-     * given id
+     * given id.  The id is remembered as closed (see is_closed()).
      *
      * @param id scanner id
      * @return true if removed, false if no mapping found
      */
     bool remove(uint32_t id);
 
+    /**
+     * This method checks if the given scanner id belongs to a scanner that
+     * was recently removed from the map, either because it returned its last
+     * block or because it was destroyed.  Clients pipeline fetches, so some
+     * of them arrive after the last block was sent; these are expected and
+     * should not be reported as errors.  Only the last few thousand removed
+     * ids are remembered.
+     *
+     * @param id scanner id
+     * @return true if the scanner was recently closed, false otherwise
+     */
+    bool is_closed(uint32_t id);
+
+    /**
+     * Sets the number of closed scanner ids that are remembered.
+     *
+     * @param limit maximum number of closed ids to remember
+     */
+    void set_closed_limit(size_t limit);
+
     /**
      * This method iterates through the scanner map purging mappings that have
      * not been referenced for max_idle_ms or greater milliseconds.
@@ -103,6 +125,15 @@ namespace Hypertable {
      */
     int64_t get_timestamp_millis();
 
+    /**
+     * Records id as closed, forgetting the oldest closed id if the limit
+     * is exceeded.  Must be called with m_mutex locked.
+     */
+    void add_closed(uint32_t id);
+
+    /// Default number of closed scanner ids that are remembered
+    static const size_t CLOSED_LIMIT = 4096;
+
     static atomic_t ms_next_id;
 
     Mutex          m_mutex;
@@ -117,6 +148,15 @@ namespace Hypertable {
 
     CellListScannerMap m_scanner_map;
 
+    /// Recently closed scanner ids, oldest first
+    std::deque<uint32_t> m_closed_ids;
+
+    /// Set of the ids in m_closed_ids
+    std::unordered_set<uint32_t> m_closed_set;
+
+    /// Maximum number of closed scanner ids that are remembered
+    size_t m_closed_limit;
+
   };
 
 }
@@ -0,0 +1,149 @@
+/* -*- c++ -*-
+ * Copyright (C) 2007-2013 Hypertable, Inc.
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+/** @file
+ * Declarations for UpdateQualifyQueue.
+ * This file contains the declaration of UpdateQualifyQueue, the bounded
+ * input queue of one RangeServer update qualify/transform thread, and of
+ * the function that routes table updates to these queues.
+ */
+
+#ifndef HYPERTABLE_UPDATEQUALIFYQUEUE_H
+#define HYPERTABLE_UPDATEQUALIFYQUEUE_H
+
+#include <list>
+#include <map>
+#include <vector>
+
+#include <boost/noncopyable.hpp>
+#include <boost/thread/condition.hpp>
+
+#include "Common/Mutex.h"
+#include "Common/TclHash.h"
+
+#include "Hypertable/Lib/KeySpec.h"
+
+namespace Hypertable {
+
+  /** @addtogroup RangeServer
+   * @{
+   */
+
+  /** Input queue and revision state of one update qualify/transform
+   * thread.  All updates for a given table are routed to the same queue
+   * (see #partition), so updates to a range are always assigned revisions by
+   * the same thread and reach the commit queue in the order they arrived.
+   * The queue holds at most a fixed number of entries; #push blocks the
+   * producer while it is full, without affecting the other queues.
+   * @tparam ContextT Type of the queued update contexts
+   */
+  template <typename ContextT>
+  class UpdateQualifyQueue : boost::noncopyable {
+  public:
+
+    /** Constructor.
+     * @param limit Maximum number of queued contexts
+     */
+    UpdateQualifyQueue(size_t limit)
+      : last_revision(TIMESTAMP_MIN), m_limit(limit), m_shutdown(false) { }
+
+    /** Appends a context, waiting while the queue is full.  After
+     * #shutdown the context is queued without waiting.
+     * @param uc Update context
+     */
+    void push(ContextT *uc) {
+      ScopedLock lock(m_mutex);
+      while (m_queue.size() >= m_limit && !m_shutdown)
+        m_cond.wait(lock);
+      m_queue.push_back(uc);
+      m_cond.notify_all();
+    }
+
+    /** Removes the oldest context, waiting while the queue is empty.
+     * @return Oldest context, or 0 once #shutdown has been called
+     */
+    ContextT *pop() {
+      ScopedLock lock(m_mutex);
+      while (m_queue.empty() && !m_shutdown)
+        m_cond.wait(lock);
+      if (m_shutdown)
+        return 0;
+      ContextT *uc = m_queue.front();
+      m_queue.pop_front();
+      m_cond.notify_all();
+      return uc;
+    }
+
+    /** Wakes up all waiting producers and consumers; #pop returns 0 from
+     * then on.
+     */
+    void shutdown() {
+      ScopedLock lock(m_mutex);
+      m_shutdown = true;
+      m_cond.notify_all();
+    }
+
+    /** Returns the number of queued contexts.
+     */
+    size_t size() {
+      ScopedLock lock(m_mutex);
+      return m_queue.size();
+    }
+
+    /** Returns the queue to which updates of a table are routed.
+     * @param table_id Table identifier string
+     * @param count Number of queues
+     * @return Queue index in the range [0..<code>count</code>)
+     */
+    static size_t partition(const char *table_id, size_t count) {
+      return tcl_hash(table_id) % count;
+    }
+
+    /** Splits a batch of table updates by queue, preserving their order.
+     * @tparam UpdateT Table update type, with a TableIdentifier member
+     * <code>id</code>
+     * @param updates Table updates
+     * @param count Number of queues
+     * @param partitions Receives the updates for each queue that gets any
+     */
+    template <typename UpdateT>
+    static void split(const std::vector<UpdateT *> &updates, size_t count,
+                      std::map<size_t, std::vector<UpdateT *> > &partitions) {
+      for (size_t i=0; i<updates.size(); i++)
+        partitions[partition(updates[i]->id.id, count)].push_back(updates[i]);
+    }
+
+    /// Most recent revision assigned by the thread consuming this queue
+    int64_t last_revision;
+
+  private:
+    Mutex m_mutex;
+    boost::condition m_cond;
+    std::list<ContextT *> m_queue;
+    size_t m_limit;
+    bool m_shutdown;
+  };
+
+  /** @}*/
+
+} // namespace Hypertable
+
+#endif // HYPERTABLE_UPDATEQUALIFYQUEUE_H
@@ -31,13 +31,13 @@ void UpdateThread::operator()() {
   try {
     switch (m_sequence_number) {
     case 0:
-      m_range_server->update_qualify_and_transform();
+      m_range_server->update_commit();
       break;
     case 1:
       m_range_server->update_add_and_respond();
       break;
     default:
-      m_range_server->update_commit();
+      m_range_server->update_qualify_and_transform(m_sequence_number - 2);
     }
   }
   catch (Exception &e) {
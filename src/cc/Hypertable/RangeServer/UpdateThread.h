@@ -28,7 +28,10 @@
 
 namespace Hypertable {
 
-  /**
+  /** Thread function object for the RangeServer update pipeline.
+   * Sequence number 0 runs the commit stage, 1 runs the add and respond
+   * stage and every number from 2 on runs the qualify and transform stage
+   * for partition <code>seqnum - 2</code>.
    */
   class UpdateThread {
   public:
@@ -0,0 +1,515 @@
+/* -*- c++ -*-
+ * Copyright (C) 2007-2013 Hypertable, Inc.
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 3 of the
+ * License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+#include <Common/Compat.h>
+
+#include <Hypertable/RangeServer/CellStoreV6.h>
+#include <Hypertable/RangeServer/Config.h>
+#include <Hypertable/RangeServer/Global.h>
+
+#include <DfsBroker/Lib/Client.h>
+
+#include <Hypertable/Lib/Client.h>
+#include <Hypertable/Lib/Key.h>
+#include <Hypertable/Lib/KeySpec.h>
+#include <Hypertable/Lib/LoadDataEscape.h>
+#include <Hypertable/Lib/LoadDataSourceFactory.h>
+#include <Hypertable/Lib/RangeLocator.h>
+#include <Hypertable/Lib/RangeServerClient.h>
+#include <Hypertable/Lib/SerializedKey.h>
+
+#include <AsyncComm/Comm.h>
+#include <AsyncComm/ConnectionManager.h>
+
+#include <Common/ByteString.h>
+#include <Common/DynamicBuffer.h>
+#include <Common/Init.h>
+#include <Common/Logger.h>
+#include <Common/PageArena.h>
+#include <Common/System.h>
+#include <Common/Time.h>
+#include <Common/Timer.h>
+
+#include <boost/bind.hpp>
+#include <boost/thread/thread.hpp>
+
+#include <algorithm>
+#include <iostream>
+#include <map>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+using namespace Hypertable;
+using namespace Config;
+using namespace std;
+
+namespace {
+
+  struct AppPolicy : Config::Policy {
+    static void init_options() {
+      cmdline_desc("Usage: %s [options] <table> <filename>\n\n"
+        "Bulk loads the TSV file <filename> into <table>.  Cells are sorted\n"
+        "in parallel, partitioned by the current range boundaries, written\n"
+        "directly as CellStores and then attached to their ranges.  The\n"
+        "parsed input is held in memory, so very large loads should be split\n"
+        "across several input files.\n\nOptions").add_options()
+        ("namespace", str()->default_value("/"), "Namespace of <table>")
+        ("sort-threads", i32()->default_value(0),
+         "Number of threads used to sort and write, 0 = one per core")
+        ("timestamp-column", str()->default_value(""),
+         "Name of the input column holding cell timestamps")
+        ("no-escape", "Do not unescape row, qualifier and value fields")
+        ;
+      cmdline_hidden_desc().add_options()
+        ("table", str(), "")
+        ("filename", str(), "");
+      cmdline_positional_desc().add("table", 1).add("filename", 1);
+    }
+    static void init() {
+      if (!has("table") || !has("filename")) {
+        HT_ERROR_OUT <<"table and filename required" << HT_END;
+        cout << cmdline_desc() << endl;
+        exit(1);
+      }
+    }
+  };
+
+  typedef Meta::list<AppPolicy, DfsClientPolicy, ClientPolicy,
+                     HyperspaceClientPolicy, MasterClientPolicy,
+                     RangeServerClientPolicy, DefaultCommPolicy> Policies;
+
+  typedef std::vector<SerializedKey> CellVector;
+
+  /** Cells of one access group, each a serialized key immediately followed
+   * by its value as a byte string.
+   */
+  struct AccessGroupCells {
+    AccessGroupCells() : ag(0) { }
+    Schema::AccessGroup *ag;
+    CellVector cells;
+  };
+
+  /** Slice of an access group's sorted cells belonging to one range. */
+  struct Partition {
+    Schema::AccessGroup *ag;
+    String ag_name;
+    CellVector::iterator begin;
+    CellVector::iterator end;
+    String fname;
+  };
+
+  /** All partitions destined for one range. */
+  struct RangeBatch {
+    RangeLocationInfo location;
+    /// A row inside the range, used to check it is still where it was
+    String row;
+    std::vector<Partition> partitions;
+  };
+
+  typedef std::map<String, RangeBatch> RangeBatchMap;
+
+  void sort_chunk(CellVector::iterator begin, CellVector::iterator end) {
+    std::sort(begin, end);
+  }
+
+  void merge_chunks(CellVector::iterator begin, CellVector::iterator middle,
+                    CellVector::iterator end) {
+    std::inplace_merge(begin, middle, end);
+  }
+
+  /** Sorts <code>cells</code> by splitting it into <code>nthreads</code>
+   * chunks that are sorted concurrently and then merged pairwise, each
+   * merge level also running concurrently.
+   */
+  void parallel_sort(CellVector &cells, size_t nthreads) {
+    std::vector<size_t> bounds;
+
+    if (nthreads > cells.size())
+      nthreads = std::max(cells.size(), (size_t)1);
+
+    for (size_t i=0; i<=nthreads; i++)
+      bounds.push_back((cells.size() * i) / nthreads);
+
+    {
+      boost::thread_group threads;
+      for (size_t i=0; i<nthreads; i++)
+        threads.create_thread(boost::bind(sort_chunk, cells.begin()+bounds[i],
+                                          cells.begin()+bounds[i+1]));
+      threads.join_all();
+    }
+
+    for (size_t width=1; width<nthreads; width*=2) {
+      boost::thread_group threads;
+      for (size_t i=0; i+width<nthreads; i+=2*width) {
+        size_t hi = std::min(i+2*width, nthreads);
+        threads.create_thread(boost::bind(merge_chunks,
+                                          cells.begin()+bounds[i],
+                                          cells.begin()+bounds[i+width],
+                                          cells.begin()+bounds[hi]));
+      }
+      threads.join_all();
+    }
+  }
+
+  /** Writes the partitions in <code>work</code>, pulling the next one off
+   * the shared index until all have been written.
+   */
+  class PartitionWriter {
+  public:
+    PartitionWriter(std::vector<Partition *> &work, TableIdentifier *tid,
+                    SchemaPtr &schema)
+      : m_work(work), m_tid(tid), m_schema(schema), m_next(0), m_error(0) { }
+
+    void operator()() {
+      Partition *partition;
+      Key key;
+
+      while (true) {
+        {
+          ScopedLock lock(m_mutex);
+          if (m_error || m_next == m_work.size())
+            return;
+          partition = m_work[m_next++];
+        }
+        try {
+          Schema::AccessGroup *ag = partition->ag;
+          PropertiesPtr props = new Properties();
+          props->set("compressor", ag->compressor.size() ?
+                     ag->compressor : m_schema->get_compressor());
+          props->set("blocksize", ag->blocksize);
+          if (ag->replication != -1)
+            props->set("replication", (int32_t)ag->replication);
+          if (ag->bloom_filter.size())
+            Schema::parse_bloom_filter(ag->bloom_filter, props);
+          else
+            Schema::parse_bloom_filter(Config::get_str("Hypertable.RangeServer"
+                ".CellStore.DefaultBloomFilter"), props);
+
+          CellStorePtr cellstore = new CellStoreV6(Global::dfs.get(),
+                                                   m_schema.get());
+          cellstore->create(partition->fname.c_str(),
+                            partition->end - partition->begin, props, m_tid);
+          for (CellVector::iterator iter = partition->begin;
+               iter != partition->end; ++iter) {
+            key.load(*iter);
+            cellstore->add(key, ByteString(iter->ptr + iter->length()));
+          }
+          cellstore->finalize(m_tid);
+        }
+        catch (Exception &e) {
+          HT_ERROR_OUT << "Problem writing " << partition->fname << " - "
+                       << e << HT_END;
+          ScopedLock lock(m_mutex);
+          m_error = e.code();
+        }
+      }
+    }
+
+    int error() { return m_error; }
+
+  private:
+    Mutex m_mutex;
+    std::vector<Partition *> &m_work;
+    TableIdentifier *m_tid;
+    SchemaPtr m_schema;
+    size_t m_next;
+    int m_error;
+  };
+
+  void run_writer(PartitionWriter *writer) {
+    (*writer)();
+  }
+
+} // local namespace
+
+
+int main(int argc, char **argv) {
+  try {
+    init_with_policies<Policies>(argc, argv);
+
+    String table_name = get_str("table");
+    String fname = get_str("filename");
+    String timestamp_column = get_str("timestamp-column");
+    bool escape = !has("no-escape");
+    size_t nthreads = (size_t)get_i32("sort-threads");
+    int timeout = get_i32("DfsBroker.Timeout");
+    uint32_t op_timeout = get_i32("Hypertable.Request.Timeout");
+
+    if (nthreads == 0)
+      nthreads = System::cpu_info().total_cores;
+
+    ClientPtr client = new Hypertable::Client(argv[0]);
+    NamespacePtr ns = client->open_namespace(get_str("namespace"));
+    TablePtr table = ns->open_table(table_name);
+
+    TableIdentifierManaged tid;
+    SchemaPtr schema;
+    table->get(tid, schema);
+    RangeLocatorPtr range_locator = table->get_range_locator();
+
+    ConnectionManagerPtr conn_mgr = new ConnectionManager();
+    DfsBroker::ClientPtr dfs_client = new DfsBroker::Client(conn_mgr, properties);
+    if (!dfs_client->wait_for_connection(timeout)) {
+      cerr << "error: timed out waiting for DFS broker" << endl;
+      exit(1);
+    }
+    Global::dfs = dfs_client.get();
+    Global::memory_tracker = new MemoryTracker(0, 0);
+    Global::toplevel_dir = properties->get_str("Hypertable.Directory");
+
+    RangeServerClient rs_client(Comm::instance(), op_timeout);
+
+    /**
+     * Parse the input, serializing each cell into its access group's list
+     */
+    int64_t revision = get_ts64();
+    std::map<String, AccessGroupCells> ag_cells;
+    CharArena arena;
+    DynamicBuffer buf;
+    std::vector<String> key_columns;
+    LoadDataSourcePtr lds;
+    KeySpec key;
+    uint8_t *value;
+    uint32_t value_len;
+    uint32_t consumed;
+    bool is_delete;
+    LoadDataEscape row_escaper, qualifier_escaper, value_escaper;
+    const char *escaped_buf;
+    size_t escaped_len;
+    String row, qualifier;
+    size_t total_cells = 0;
+
+    lds = LoadDataSourceFactory::create(dfs_client, fname, LOCAL_FILE, "",
+                                        LOCAL_FILE, key_columns,
+                                        timestamp_column, '\t', 0, 0);
+
+    while (lds->next(&key, &value, &value_len, &is_delete, &consumed)) {
+
+      if (is_delete)
+        HT_THROWF(Error::NOT_IMPLEMENTED, "Delete on line %lld not supported "
+                  "by bulk load, use LOAD DATA INFILE instead",
+                  (Lld)lds->get_current_lineno());
+
+      Schema::ColumnFamily *cf = schema->get_column_family(key.column_family);
+      if (cf == 0)
+        HT_THROWF(Error::BAD_KEY, "Unknown column family '%s' on line %lld",
+                  key.column_family, (Lld)lds->get_current_lineno());
+      if (cf->counter)
+        HT_THROWF(Error::NOT_IMPLEMENTED, "Counter column '%s' not supported "
+                  "by bulk load", key.column_family);
+
+      if (escape) {
+        row_escaper.unescape((const char *)key.row, (size_t)key.row_len,
+                             &escaped_buf, &escaped_len);
+        row.assign(escaped_buf, escaped_len);
+        qualifier_escaper.unescape(key.column_qualifier,
+                                   (size_t)key.column_qualifier_len,
+                                   &escaped_buf, &escaped_len);
+        qualifier.assign(escaped_buf, escaped_len);
+        value_escaper.unescape((const char *)value, (size_t)value_len,
+                               &escaped_buf, &escaped_len);
+      }
+      else {
+        row.assign((const char *)key.row, key.row_len);
+        if (key.column_qualifier)
+          qualifier.assign(key.column_qualifier, key.column_qualifier_len);
+        else
+          qualifier.clear();
+        escaped_buf = (const char *)value;
+        escaped_len = value_len;
+      }
+
+      if (row.empty())
+        HT_THROWF(Error::BAD_KEY, "Empty row key on line %lld",
+                  (Lld)lds->get_current_lineno());
+
+      buf.clear();
+      create_key_and_append(buf, FLAG_INSERT, row.c_str(), cf->id,
+                            qualifier.c_str(),
+                            key.timestamp == AUTO_ASSIGN ? revision : key.timestamp,
+                            revision);
+      append_as_byte_string(buf, escaped_buf, escaped_len);
+
+      uint8_t *cell = (uint8_t *)arena.dup(buf.base, buf.fill());
+      AccessGroupCells &agc = ag_cells[cf->ag];
+      if (agc.ag == 0)
+        agc.ag = schema->get_access_group(cf->ag);
+      agc.cells.push_back(SerializedKey(cell));
+      total_cells++;
+    }
+
+    HT_INFOF("Read %llu cells from %s", (Llu)total_cells, fname.c_str());
+
+    /**
+     * Sort each access group and partition it by range
+     */
+    RangeBatchMap batches;
+    Timer timer(op_timeout, true);
+    RangeLocationInfo location;
+    Key cell_key;
+    std::map<String, int> next_id;
+
+    for (std::map<String, AccessGroupCells>::iterator iter = ag_cells.begin();
+         iter != ag_cells.end(); ++iter) {
+      CellVector &cells = iter->second.cells;
+
+      if (iter->second.ag->in_memory)
+        HT_THROWF(Error::NOT_IMPLEMENTED, "In-memory access group '%s' not "
+                  "supported by bulk load", iter->first.c_str());
+
+      parallel_sort(cells, nthreads);
+
+      String staging_dir = format("%s/tables/%s/%s/bulk-%d",
+                                  Global::toplevel_dir.c_str(), tid.id,
+                                  iter->first.c_str(), (int)getpid());
+      Global::dfs->mkdirs(staging_dir);
+
+      CellVector::iterator begin = cells.begin();
+      while (begin != cells.end()) {
+        cell_key.load(*begin);
+        timer.reset(true);
+        range_locator->find_loop(&tid, cell_key.row, &location, timer, false);
+
+        // Advance to the first cell beyond this range's end row
+        CellVector::iterator end = begin;
+        do {
+          ++end;
+          if (end == cells.end())
+            break;
+          cell_key.load(*end);
+        } while (strcmp(cell_key.row, location.end_row.c_str()) <= 0);
+
+        RangeBatch &batch = batches[location.end_row];
+        if (batch.partitions.empty()) {
+          cell_key.load(*begin);
+          batch.row = cell_key.row;
+        }
+        batch.location = location;
+        Partition partition;
+        partition.ag = iter->second.ag;
+        partition.ag_name = iter->first;
+        partition.begin = begin;
+        partition.end = end;
+        partition.fname = format("%s/cs%d", staging_dir.c_str(),
+                                 next_id[iter->first]++);
+        batch.partitions.push_back(partition);
+        begin = end;
+      }
+    }
+
+    /**
+     * Write the CellStores
+     */
+    std::vector<Partition *> work;
+    for (RangeBatchMap::iterator iter = batches.begin();
+         iter != batches.end(); ++iter)
+      foreach_ht (Partition &partition, iter->second.partitions)
+        work.push_back(&partition);
+
+    PartitionWriter writer(work, &tid, schema);
+    {
+      boost::thread_group threads;
+      for (size_t i=0; i<nthreads; i++)
+        threads.create_thread(boost::bind(run_writer, &writer));
+      threads.join_all();
+    }
+    if (writer.error())
+      HT_THROW(writer.error(), "Problem writing CellStores");
+
+    /**
+     * Check that no range has split or moved while the CellStores were
+     * being written before attaching any of them, so a load is either
+     * applied to every range or to none
+     */
+    for (RangeBatchMap::iterator iter = batches.begin();
+         iter != batches.end(); ++iter) {
+      RangeBatch &batch = iter->second;
+      RangeLocationInfo location;
+      timer.reset(true);
+      range_locator->find_loop(&tid, batch.row.c_str(), &location, timer, true);
+      if (location.start_row != batch.location.start_row ||
+          location.end_row != batch.location.end_row ||
+          location.addr != batch.location.addr)
+        HT_THROWF(Error::RANGESERVER_RANGE_NOT_FOUND, "Range %s[%s..%s] "
+                  "changed while loading, nothing attached, re-run the load",
+                  tid.id, batch.location.start_row.c_str(),
+                  batch.location.end_row.c_str());
+    }
+
+    /**
+     * Attach the CellStores to their ranges
+     */
+    int failed = 0;
+    for (RangeBatchMap::iterator iter = batches.begin();
+         iter != batches.end(); ++iter) {
+      RangeBatch &batch = iter->second;
+      RangeSpec range(batch.location.start_row.c_str(),
+                      batch.location.end_row.c_str());
+      std::vector<String> ag_names, files;
+      foreach_ht (Partition &partition, batch.partitions) {
+        ag_names.push_back(partition.ag_name);
+        files.push_back(partition.fname);
+      }
+      try {
+        timer.reset(true);
+        rs_client.attach_cellstores(batch.location.addr, tid, range,
+                                    ag_names, files, timer);
+      }
+      catch (Exception &e) {
+        HT_ERROR_OUT << "Unable to attach CellStores to " << tid.id << "["
+                     << range.start_row << ".." << range.end_row << "] - "
+                     << e << HT_END;
+        failed++;
+      }
+    }
+
+    // Removes the staging directories.  They are left in place if an attach
+    // failed, since a RangeServer that crashed in the middle of one finishes
+    // it from the staged files when it restarts
+    for (std::map<String, AccessGroupCells>::iterator iter = ag_cells.begin();
+         !failed && iter != ag_cells.end(); ++iter) {
+      String staging_dir = format("%s/tables/%s/%s/bulk-%d",
+                                  Global::toplevel_dir.c_str(), tid.id,
+                                  iter->first.c_str(), (int)getpid());
+      try {
+        Global::dfs->rmdir(staging_dir);
+      }
+      catch (Exception &e) {
+        HT_WARN_OUT << "Problem removing staging directory '" << staging_dir
+                    << "' " << e << HT_END;
+      }
+    }
+
+    cout << "Loaded " << total_cells << " cells into " << batches.size()
+         << " ranges";
+    if (failed)
+      cout << " (" << failed << " ranges failed, re-run for their rows; "
+           << "staging directories bulk-" << (int)getpid() << " were kept)";
+    cout << endl;
+
+    _exit(failed ? 1 : 0);
+  }
+  catch (Exception &e) {
+    HT_ERROR_OUT << e << HT_END;
+    _exit(1);
+  }
+}
@@ -22,6 +22,8 @@
 #include <Common/Compat.h>
 
 #include <Hypertable/RangeServer/CellStore.h>
+#include <Hypertable/RangeServer/CellStoreBlockRestarts.h>
+#include <Hypertable/RangeServer/CellStoreColumnarBlock.h>
 #include <Hypertable/RangeServer/CellStoreFactory.h>
 #include <Hypertable/RangeServer/CellStoreTrailerV6.h>
 #include <Hypertable/RangeServer/Config.h>
@@ -114,6 +116,10 @@ namespace {
     { 'I','d','x','F','i','x','-','-','-','-' };
   const char INDEX_VARIABLE_BLOCK_MAGIC[10] =
     { 'I','d','x','V','a','r','-','-','-','-' };
+  const char DICTIONARY_BLOCK_MAGIC[10]     =
+    { 'D','i','c','t','-','-','-','-','-','-' };
+  const char COLUMNAR_DATA_BLOCK_MAGIC[10]  =
+    { 'D','a','t','a','C','o','l','-','-','-' };
 
   void load_file(const String &fname, State &state) {
     int64_t length = Global::dfs->length(fname.c_str());
@@ -139,8 +145,12 @@ namespace {
     remaining = 2;
     version = Serialization::decode_i16(&ptr, &remaining);
 
-    if (version == 6)
-      state.trailer = new CellStoreTrailerV6();
+    if (version >= 6 && version <= 10) {
+      CellStoreTrailerV6 *trailer_v6 = new CellStoreTrailerV6();
+      // Trailer length depends on version
+      trailer_v6->version = version;
+      state.trailer = trailer_v6;
+    }
     else {
       cout << "unsupported CellStore version (" << version << ")" << endl;
       _exit(1);
@@ -152,6 +162,26 @@ namespace {
 
     uint16_t compression_type = boost::any_cast<uint16_t>(state.trailer->get("compression_type"));
     state.compressor = CompressorFactory::create_block_codec((BlockCompressionCodec::Type)compression_type);
+
+    // Load compression dictionary
+    int64_t dictionary_length = boost::any_cast<int64_t>(state.trailer->get("dictionary_length"));
+    if (dictionary_length > 0) {
+      int64_t dictionary_offset = boost::any_cast<int64_t>(state.trailer->get("dictionary_offset"));
+      BlockCompressionCodecPtr codec = CompressorFactory::create_block_codec(BlockCompressionCodec::NONE);
+      BlockCompressionHeader header;
+      DynamicBuffer input_buf(0, false);
+      DynamicBuffer output_buf(0);
+      input_buf.base = state.base + dictionary_offset;
+      input_buf.ptr = input_buf.base + dictionary_length;
+      codec->inflate(input_buf, output_buf, header);
+      if (!header.check_magic(DICTIONARY_BLOCK_MAGIC)) {
+        cout << "corrupt compression dictionary" << endl;
+        _exit(1);
+      }
+      BlockCompressionDictionaryPtr dictionary =
+        new BlockCompressionDictionary(output_buf.base, output_buf.fill());
+      state.compressor->set_dictionary(dictionary);
+    }
     state.key_decompressor = new KeyDecompressorPrefix();
   }
   
@@ -225,6 +255,7 @@ namespace {
     int64_t filter_items_actual = boost::any_cast<int64_t>(state.trailer->get("filter_items_actual"));
     uint8_t bloom_filter_hash_count = boost::any_cast<uint8_t>(state.trailer->get("bloom_filter_hash_count"));
     uint8_t bloom_filter_mode = boost::any_cast<uint8_t>(state.trailer->get("bloom_filter_mode"));
+    uint32_t flags = boost::any_cast<uint32_t>(state.trailer->get("flags"));
 
     if ((BloomFilterMode)bloom_filter_mode == BLOOM_FILTER_DISABLED) {
       state.bloom_filter = 0;
@@ -239,7 +270,8 @@ namespace {
     HT_ASSERT((BloomFilterMode)bloom_filter_mode == BLOOM_FILTER_ROWS);
 
     state.bloom_filter = new BloomFilterWithChecksum(filter_items_actual, filter_items_actual,
-                                                     filter_length, bloom_filter_hash_count);
+                                                     filter_length, bloom_filter_hash_count,
+                                                     (flags & CellStoreTrailerV6::BLOOM_FILTER_BLOCKED) != 0);
     memcpy(state.bloom_filter->base(), state.base+filter_offset, state.bloom_filter->total_size());
     try {
       state.bloom_filter->validate(state.fname);
@@ -257,11 +289,14 @@ namespace {
     int64_t offset = 0;
     int64_t end_offset = boost::any_cast<int64_t>(state.trailer->get("fix_index_offset"));
     uint32_t alignment = boost::any_cast<uint32_t>(state.trailer->get("alignment"));
+    uint32_t flags = boost::any_cast<uint32_t>(state.trailer->get("flags"));
+    CellStoreBlockRestarts restarts;
     const uint8_t *ptr = state.base;
     const uint8_t *end = state.base + end_offset;
     size_t remaining;
     size_t sequence = 0;
     DynamicBuffer expand_buf(0);
+    DynamicBuffer columnar_buf(0);
     DynamicBuffer input_buf(0, false);
 
     while (ptr < end) {
@@ -291,9 +326,21 @@ namespace {
       input_buf.ptr += header.get_data_zlength() + extra;
       state.compressor->inflate(input_buf, expand_buf, header);
 
-      // call functor
-      if (!op(sequence, offset, expand_buf))
-        return false;
+      // call functor on the row oriented form of the block
+      if (header.check_magic(COLUMNAR_DATA_BLOCK_MAGIC)) {
+        CellStoreColumnarBlock::expand(expand_buf, state.key_decompressor,
+                                       columnar_buf);
+        if (!op(sequence, offset, columnar_buf))
+          return false;
+      }
+      else {
+        // strip restart points
+        if (flags & CellStoreTrailerV6::BLOCK_RESTARTS)
+          expand_buf.ptr = (uint8_t *)restarts.load(expand_buf.base,
+                                                    expand_buf.ptr);
+        if (!op(sequence, offset, expand_buf))
+          return false;
+      }
 
       ptr += input_buf.fill();
       sequence++;
@@ -0,0 +1,137 @@
+/** -*- c++ -*-
+ * Copyright (C) 2007-2013 Hypertable, Inc.
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 3 of the
+ * License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+#include "Common/Compat.h"
+#include <cstdlib>
+#include <cstdio>
+#include <iostream>
+#include <map>
+
+#include <boost/thread/thread.hpp>
+
+extern "C" {
+#include <unistd.h>
+}
+
+#include "Common/DynamicBuffer.h"
+#include "Common/Logger.h"
+
+#include "Hypertable/Lib/Key.h"
+
+#include "Hypertable/RangeServer/CellCacheSkipList.h"
+#include "Hypertable/RangeServer/Global.h"
+#include "Hypertable/RangeServer/MemoryTracker.h"
+
+using namespace Hypertable;
+using namespace std;
+
+#define TOTAL_INSERTS 50000
+
+namespace {
+
+  volatile bool writer_done = false;
+
+  struct Reader {
+    Reader(CellCacheSkipList &list) : list(list) { }
+    void operator()() {
+      while (!writer_done) {
+        SerializedKey last;
+        size_t count = 0;
+        for (CellCacheSkipList::iterator iter = list.begin();
+             iter != list.end(); ++iter) {
+          if (count++ && !(last < iter->first)) {
+            cout << "Error: skiplist out of order during concurrent scan"
+                 << endl;
+            _exit(1);
+          }
+          last = iter->first;
+        }
+      }
+    }
+    CellCacheSkipList &list;
+  };
+
+  const uint8_t *make_key(CellCacheArena &arena, const char *row,
+                          int64_t revision) {
+    DynamicBuffer buf;
+    create_key_and_append(buf, FLAG_INSERT, row, 1, "q", revision, revision);
+    return arena.dup(buf.base, buf.fill());
+  }
+
+}
+
+int main(int argc, char **argv) {
+  CellCacheArena arena;
+  typedef std::map<SerializedKey, int64_t> CheckMap;
+  CheckMap check;
+  char row[32];
+
+  Global::memory_tracker = new MemoryTracker(0, 0);
+
+  CellCacheSkipList list(arena);
+
+  HT_ASSERT(list.empty() && list.begin() == list.end());
+
+  Reader reader(list);
+  boost::thread reader_thread(reader);
+
+  srandom(1234);
+
+  for (int64_t i=0; i<TOTAL_INSERTS; i++) {
+    sprintf(row, "%08d", (int)(random() % (TOTAL_INSERTS/2)));
+    SerializedKey key(make_key(arena, row, 1));
+    bool inserted = check.find(key) == check.end();
+    if (list.insert(key) != inserted) {
+      cout << "Error: insert of row " << row << " returned "
+           << !inserted << endl;
+      return 1;
+    }
+    check[key] = i;
+  }
+
+  writer_done = true;
+  reader_thread.join();
+
+  if (list.size() != check.size()) {
+    cout << "Error: skiplist size " << list.size() << " != " << check.size()
+         << endl;
+    return 1;
+  }
+
+  CellCacheSkipList::iterator iter = list.begin();
+  for (CheckMap::iterator citer = check.begin(); citer != check.end();
+       ++citer, ++iter) {
+    HT_ASSERT(iter != list.end());
+    HT_ASSERT(iter->first == citer->first);
+    HT_ASSERT(iter->second == citer->first.length());
+    HT_ASSERT(list.lower_bound(citer->first) == iter);
+  }
+  HT_ASSERT(iter == list.end());
+
+  // lower_bound of a key between two entries
+  SerializedKey probe(make_key(arena, "00000100", 0));
+  HT_ASSERT(list.lower_bound(probe)->first == check.lower_bound(probe)->first);
+
+  list.clear();
+  HT_ASSERT(list.empty() && list.size() == 0);
+
+  return 0;
+}
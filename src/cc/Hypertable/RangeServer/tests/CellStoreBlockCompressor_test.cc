@@ -0,0 +1,164 @@
+/** -*- c++ -*-
+ * Copyright (C) 2007-2013 Hypertable, Inc.
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 3 of the
+ * License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+#include "Common/Compat.h"
+#include <cstring>
+
+#include "Common/DynamicBuffer.h"
+#include "Common/Error.h"
+#include "Common/FailureInducer.h"
+#include "Common/Logger.h"
+#include "Common/String.h"
+
+#include "Hypertable/Lib/BlockCompressionCodecZlib.h"
+#include "Hypertable/Lib/BlockCompressionHeader.h"
+
+#include "Hypertable/RangeServer/CellStoreBlockCompressor.h"
+
+using namespace Hypertable;
+using namespace std;
+
+#define BLOCK_COUNT 200
+
+namespace {
+
+  const char MAGIC[10] = { 'D','a','t','a','-','-','-','-','-','-' };
+
+  /// Blocks of widely varying size, so that workers finish out of order
+  void make_block(DynamicBuffer &block, size_t i) {
+    block.clear();
+    size_t repeat = 1 + (i % 7) * (i % 7) * 200;
+    for (size_t j=0; j<repeat; j++) {
+      String text = format("block %u entry %u;", (unsigned)i, (unsigned)j);
+      block.add(text.c_str(), text.length());
+    }
+  }
+
+  void check_block(BlockCompressionCodecZlib &codec, DynamicBuffer &zblock,
+                   size_t uncompressed_length, size_t i) {
+    DynamicBuffer expected(0), output(0);
+    BlockCompressionHeader header;
+    make_block(expected, i);
+    HT_ASSERT(uncompressed_length == expected.fill());
+    codec.inflate(zblock, output, header);
+    HT_ASSERT(!memcmp(header.get_magic(), MAGIC, sizeof(MAGIC)));
+    HT_ASSERT(output.fill() == expected.fill());
+    HT_ASSERT(!memcmp(output.base, expected.base, expected.fill()));
+  }
+
+  /// Submits BLOCK_COUNT blocks the way CellStoreV6 does and checks that
+  /// they come back in submission order
+  void run(CellStoreBlockCompressor &compressor) {
+    BlockCompressionCodec::Args args;
+    BlockCompressionCodecZlib codec(args);
+    DynamicBuffer block(0), zblock(0);
+    size_t uncompressed_length;
+    size_t collected = 0;
+
+    for (size_t i=0; i<BLOCK_COUNT; i++) {
+      while (compressor.next(zblock, &uncompressed_length, compressor.full()))
+        check_block(codec, zblock, uncompressed_length, collected++);
+      make_block(block, i);
+      compressor.submit(block, MAGIC);
+      HT_ASSERT(block.base == 0);
+    }
+    while (compressor.next(zblock, &uncompressed_length, true))
+      check_block(codec, zblock, uncompressed_length, collected++);
+    HT_ASSERT(collected == BLOCK_COUNT);
+  }
+
+}
+
+
+int main(int argc, char **argv) {
+  BlockCompressionCodec::Args args;
+
+  // In-order output from a pool of workers
+  {
+    CellStoreBlockCompressor compressor(BlockCompressionCodec::ZLIB, args,
+                                        4, 8);
+    HT_ASSERT(compressor.thread_count() == 4);
+    HT_ASSERT(CellStoreBlockCompressor::threads_in_use() == 4);
+    run(compressor);
+  }
+  HT_ASSERT(CellStoreBlockCompressor::threads_in_use() == 0);
+
+  // Concurrent compressors share the process-wide thread limit; one that
+  // gets no thread compresses inline
+  CellStoreBlockCompressor::set_thread_limit(3);
+  {
+    CellStoreBlockCompressor *first =
+      new CellStoreBlockCompressor(BlockCompressionCodec::ZLIB, args, 2, 4);
+    CellStoreBlockCompressor second(BlockCompressionCodec::ZLIB, args, 2, 4);
+    CellStoreBlockCompressor third(BlockCompressionCodec::ZLIB, args, 2, 4);
+    HT_ASSERT(first->thread_count() == 2);
+    HT_ASSERT(second.thread_count() == 1);
+    HT_ASSERT(third.thread_count() == 0);
+    HT_ASSERT(CellStoreBlockCompressor::threads_in_use() == 3);
+    run(*first);
+    run(second);
+    run(third);
+    delete first;
+    HT_ASSERT(CellStoreBlockCompressor::threads_in_use() == 1);
+    CellStoreBlockCompressor fourth(BlockCompressionCodec::ZLIB, args, 4, 4);
+    HT_ASSERT(fourth.thread_count() == 2);
+    run(fourth);
+  }
+  HT_ASSERT(CellStoreBlockCompressor::threads_in_use() == 0);
+
+  // A compression error is reported by next() for the block that failed,
+  // in order, and the blocks around it are unaffected
+  for (size_t threads=0; threads<=1; threads++) {
+    CellStoreBlockCompressor::set_thread_limit(threads);
+    CellStoreBlockCompressor compressor(BlockCompressionCodec::ZLIB, args,
+                                        1, 8);
+    HT_ASSERT(compressor.thread_count() == threads);
+
+    FailureInducer::instance = new FailureInducer();
+    FailureInducer::instance->parse_option("cellstore-block-compress:throw:3");
+
+    BlockCompressionCodecZlib codec(args);
+    DynamicBuffer block(0), zblock(0);
+    size_t uncompressed_length;
+    for (size_t i=0; i<6; i++) {
+      make_block(block, i);
+      compressor.submit(block, MAGIC);
+    }
+    for (size_t i=0; i<6; i++) {
+      bool failed = false;
+      try {
+        HT_ASSERT(compressor.next(zblock, &uncompressed_length, true));
+        check_block(codec, zblock, uncompressed_length, i);
+      }
+      catch (Exception &e) {
+        HT_ASSERT(e.code() == Error::INDUCED_FAILURE);
+        failed = true;
+      }
+      HT_ASSERT(failed == (i == 3));
+    }
+    HT_ASSERT(!compressor.next(zblock, &uncompressed_length, true));
+
+    delete FailureInducer::instance;
+    FailureInducer::instance = 0;
+  }
+
+  return 0;
+}
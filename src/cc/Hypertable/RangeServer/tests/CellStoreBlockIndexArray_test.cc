@@ -0,0 +1,133 @@
+/** -*- c++ -*-
+ * Copyright (C) 2007-2013 Hypertable, Inc.
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 3 of the
+ * License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+#include "Common/Compat.h"
+#include <algorithm>
+#include <cstdlib>
+#include <cstdio>
+#include <iostream>
+#include <vector>
+
+#include "Common/DynamicBuffer.h"
+#include "Common/Logger.h"
+
+#include "Hypertable/Lib/Key.h"
+
+#include "Hypertable/RangeServer/CellStoreBlockIndexArray.h"
+
+using namespace Hypertable;
+using namespace std;
+
+#define TOTAL_KEYS 5000
+#define TOTAL_PROBES 20000
+
+namespace {
+
+  /// Creates a random key; rows share prefixes and vary in length so that
+  /// many comparisons can not be decided by the inline prefix.  Timestamp
+  /// and revision always differ so that all keys have the same control byte
+  /// (SerializedKey only orders such keys consistently)
+  void make_key(DynamicBuffer &buf) {
+    char row[16], qualifier[4];
+    size_t len = random() % 12;
+    for (size_t i=0; i<len; i++)
+      row[i] = (i < 4) ? 'a' + (random() % 2) : 'a' + (random() % 26);
+    row[len] = 0;
+    qualifier[0] = 'a' + (random() % 3);
+    qualifier[1] = 0;
+    create_key_and_append(buf, FLAG_INSERT, row, 1 + (random() % 2),
+                          qualifier, (int64_t)(random() % 4),
+                          (int64_t)(4 + random() % 4));
+  }
+
+  struct LtKey {
+    bool operator()(const SerializedKey &k1, const SerializedKey &k2) const {
+      return k1 < k2;
+    }
+  };
+
+  template <typename OffsetT>
+  void test_lookups(vector<SerializedKey> &keys, DynamicBuffer &probes) {
+    CellStoreBlockIndexArray<OffsetT> index;
+    DynamicBuffer fixed(keys.size() * sizeof(OffsetT));
+    DynamicBuffer variable(probes.fill());
+
+    for (size_t i=0; i<keys.size(); i++) {
+      OffsetT offset = (OffsetT)(i * 100);
+      fixed.add_unchecked(&offset, sizeof(offset));
+      variable.add_unchecked(keys[i].ptr, keys[i].length());
+    }
+    index.load(fixed, variable, keys.size() * 100);
+    HT_ASSERT(index.index_entries() == (int64_t)keys.size());
+
+    SerializedKey probe;
+    const uint8_t *ptr = probes.base;
+    while (ptr < probes.ptr) {
+      probe.ptr = ptr;
+      ptr += probe.length();
+      int64_t lower = (int64_t)(lower_bound(keys.begin(), keys.end(), probe,
+                                            LtKey()) - keys.begin());
+      int64_t upper = (int64_t)(upper_bound(keys.begin(), keys.end(), probe,
+                                            LtKey()) - keys.begin());
+      typename CellStoreBlockIndexArray<OffsetT>::iterator iter;
+      iter = index.lower_bound(probe);
+      if (lower == (int64_t)keys.size())
+        HT_ASSERT(iter == index.end());
+      else
+        HT_ASSERT(iter.value() == lower * 100);
+      iter = index.upper_bound(probe);
+      if (upper == (int64_t)keys.size())
+        HT_ASSERT(iter == index.end());
+      else
+        HT_ASSERT(iter.value() == upper * 100);
+    }
+  }
+
+}
+
+int main(int argc, char **argv) {
+  DynamicBuffer keybuf(TOTAL_KEYS * 64);
+  DynamicBuffer probes(TOTAL_PROBES * 64);
+  vector<SerializedKey> keys;
+  SerializedKey key;
+
+  srandom(1234);
+
+  for (size_t i=0; i<TOTAL_KEYS; i++)
+    make_key(keybuf);
+  for (const uint8_t *ptr = keybuf.base; ptr < keybuf.ptr; ptr += key.length()) {
+    key.ptr = ptr;
+    keys.push_back(key);
+  }
+  sort(keys.begin(), keys.end(), LtKey());
+  keys.erase(unique(keys.begin(), keys.end()), keys.end());
+
+  // Probe with existing keys as well as random ones
+  for (size_t i=0; i<keys.size(); i++)
+    probes.add(keys[i].ptr, keys[i].length());
+  for (size_t i=0; i<TOTAL_PROBES; i++)
+    make_key(probes);
+
+  test_lookups<uint32_t>(keys, probes);
+  test_lookups<int64_t>(keys, probes);
+
+  return 0;
+}
@@ -0,0 +1,172 @@
+/** -*- c++ -*-
+ * Copyright (C) 2007-2013 Hypertable, Inc.
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 3 of the
+ * License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+#include "Common/Compat.h"
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "Common/DynamicBuffer.h"
+#include "Common/Logger.h"
+#include "Common/Serialization.h"
+
+#include "Hypertable/Lib/Key.h"
+
+#include "Hypertable/RangeServer/CellStoreBlockRestarts.h"
+#include "Hypertable/RangeServer/CellStoreColumnarBlock.h"
+#include "Hypertable/RangeServer/KeyCompressorPrefix.h"
+#include "Hypertable/RangeServer/KeyDecompressorPrefix.h"
+
+using namespace Hypertable;
+using namespace std;
+
+#define TOTAL_ENTRIES 5000
+#define RESTART_INTERVAL 16
+
+namespace {
+
+  void make_row(char *row, size_t i) {
+    sprintf(row, "row%06d", (int)i);
+  }
+
+  /// Returns the index of the first entry not less than key by
+  /// decompressing the block from the beginning
+  size_t linear_lower_bound(const uint8_t *base, const uint8_t *end,
+                            SerializedKey key) {
+    KeyDecompressorPrefix key_decompressor;
+    const uint8_t *ptr = base;
+    size_t index = 0;
+    key_decompressor.reset();
+    while (ptr < end) {
+      ptr = key_decompressor.add(ptr);
+      if (!key_decompressor.less_than(key))
+        break;
+      ptr += ByteString(ptr).length();
+      index++;
+    }
+    return index;
+  }
+
+}
+
+int main(int argc, char **argv) {
+  KeyCompressorPrefixPtr key_compressor = new KeyCompressorPrefix();
+  vector<uint32_t> offsets, restart_entries, entry_offsets;
+  DynamicBuffer block, keys, keybuf, columnar, expanded;
+  vector<ValueStreamEncoder *> encoders(256, (ValueStreamEncoder *)0);
+  char row[32];
+  Key key;
+
+  srandom(1234);
+
+  encoders[2] = new ValueStreamEncoder(ValueEncoding::DELTA);
+
+  // Build a block the way CellStoreV6 does, along with the key region of
+  // the same block in columnar form
+  for (size_t i=0; i<TOTAL_ENTRIES; i++) {
+    uint8_t family = 1 + (i % 2);
+    make_row(row, i);
+    keybuf.clear();
+    create_key_and_append(keybuf, FLAG_INSERT, row, family, "q", (int64_t)i,
+                          (int64_t)i);
+    key.load(SerializedKey(keybuf.base));
+    if (i % RESTART_INTERVAL == 0) {
+      key_compressor->reset();
+      offsets.push_back(block.fill());
+      restart_entries.push_back(i);
+    }
+    entry_offsets.push_back(block.fill());
+    key_compressor->add(key);
+    size_t key_len = key_compressor->length();
+    block.ensure(key_len + 9);
+    keys.ensure(key_len + 9);
+    key_compressor->write(block.ptr);
+    block.ptr += key_len;
+    key_compressor->write(keys.ptr);
+    keys.ptr += key_len;
+    uint8_t *value = block.ptr;
+    *block.ptr++ = 8;
+    Serialization::encode_i64(&block.ptr, (uint64_t)i * 7);
+    if (family == 2)
+      encoders[family]->add(ByteString(value));
+    else
+      keys.add_unchecked(value, 9);
+  }
+  size_t entries_length = block.fill();
+  CellStoreBlockRestarts::append(block, offsets);
+
+  CellStoreBlockRestarts restarts;
+  const uint8_t *entries_end = restarts.load(block.base, block.ptr);
+  HT_ASSERT(entries_end == block.base + entries_length);
+
+  HT_ASSERT(restarts.count() == offsets.size());
+  for (size_t i=0; i<offsets.size(); i++)
+    HT_ASSERT(restarts.offset(i) == offsets[i]);
+
+  // Seeking to a restart point and scanning forward finds the same entry
+  // as scanning the whole block
+  KeyDecompressorPrefix key_decompressor;
+  for (size_t n=0; n<2000; n++) {
+    size_t target = random() % (TOTAL_ENTRIES + 3);
+    make_row(row, target);
+    keybuf.clear();
+    create_key_and_append(keybuf, FLAG_INSERT, row, 1 + (random() % 2), "q",
+                          (int64_t)target, (int64_t)target);
+    SerializedKey serkey(keybuf.base);
+
+    size_t expected = linear_lower_bound(block.base, entries_end, serkey);
+
+    const uint8_t *value = restarts.seek(&key_decompressor, serkey);
+    size_t entry = 0;
+    size_t skipped = 0;
+    while (entry + 1 < entry_offsets.size() &&
+           block.base + entry_offsets[entry + 1] < value)
+      entry++;
+    HT_ASSERT(entry % RESTART_INTERVAL == 0);
+    while (key_decompressor.less_than(serkey)) {
+      const uint8_t *ptr = value + ByteString(value).length();
+      if (ptr >= entries_end)
+        break;
+      value = key_decompressor.add(ptr);
+      skipped++;
+    }
+    HT_ASSERT(skipped <= RESTART_INTERVAL);
+    if (expected < TOTAL_ENTRIES) {
+      size_t i = 0;
+      while (i < entry_offsets.size() &&
+             block.base + entry_offsets[i] < value)
+        i++;
+      HT_ASSERT(i == expected + 1);
+    }
+  }
+
+  // Expanding the columnar form of the block recovers its restart points
+  CellStoreBlockRestarts::append(keys, restart_entries);
+  CellStoreColumnarBlock::assemble(keys, encoders, columnar);
+  CellStoreColumnarBlock::expand(columnar, &key_decompressor, expanded,
+                                 false, true);
+  HT_ASSERT(expanded.fill() == block.fill());
+  HT_ASSERT(memcmp(expanded.base, block.base, block.fill()) == 0);
+
+  delete encoders[2];
+
+  return 0;
+}
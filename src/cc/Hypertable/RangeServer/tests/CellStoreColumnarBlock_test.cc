@@ -0,0 +1,197 @@
+/** -*- c++ -*-
+ * Copyright (C) 2007-2013 Hypertable, Inc.
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 3 of the
+ * License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+#include "Common/Compat.h"
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "Common/DynamicBuffer.h"
+#include "Common/Logger.h"
+#include "Common/Serialization.h"
+
+#include "Hypertable/Lib/Key.h"
+
+#include "Hypertable/RangeServer/CellStoreColumnarBlock.h"
+#include "Hypertable/RangeServer/KeyCompressorPrefix.h"
+#include "Hypertable/RangeServer/KeyDecompressorPrefix.h"
+
+using namespace Hypertable;
+using namespace std;
+
+namespace {
+
+  /// Column family codes and their value encodings; family 4 is not
+  /// encoded
+  ValueEncoding::Type encodings[] = { ValueEncoding::NONE,
+    ValueEncoding::DELTA, ValueEncoding::FRAME_OF_REFERENCE,
+    ValueEncoding::RUN_LENGTH, ValueEncoding::NONE };
+
+  void append_fixed(DynamicBuffer &buf, int64_t value) {
+    buf.ensure(9);
+    *buf.ptr++ = 8;
+    Serialization::encode_i64(&buf.ptr, (uint64_t)value);
+  }
+
+  void append_string(DynamicBuffer &buf, const char *str) {
+    size_t len = strlen(str);
+    buf.ensure(5 + len);
+    Serialization::encode_vi32(&buf.ptr, len);
+    buf.add_unchecked(str, len);
+  }
+
+  /// Creates a random value; mostly 8-byte counters with some exceptions
+  void make_value(DynamicBuffer &buf, uint8_t family, int64_t *counter) {
+    if (random() % 16 == 0) {
+      append_string(buf, (random() % 2) ? "=1234" : "");
+      return;
+    }
+    if (encodings[family] == ValueEncoding::RUN_LENGTH) {
+      if (random() % 8 == 0)
+        *counter = random() % 4;
+    }
+    else if (random() % 64 == 0)
+      *counter = (random() % 2) ? INT64_MIN + random() : INT64_MAX - random();
+    else
+      *counter += (int64_t)(random() % 2000) - 500;
+    append_fixed(buf, *counter);
+  }
+
+  /// Builds a block in both the row oriented and the columnar form, then
+  /// checks that expanding the columnar form restores the row oriented one
+  void test_block(size_t entries) {
+    KeyCompressorPrefixPtr key_compressor = new KeyCompressorPrefix();
+    KeyDecompressorPrefix key_decompressor;
+    vector<ValueStreamEncoder *> encoders(256, (ValueStreamEncoder *)0);
+    DynamicBuffer expected, keys, value, columnar, expanded;
+    DynamicBuffer keybuf;
+    int64_t counters[5] = { 0, 0, 0, 0, 0 };
+    char row[16];
+    Key key;
+
+    for (uint8_t family=1; family<5; family++) {
+      if (encodings[family] != ValueEncoding::NONE)
+        encoders[family] = new ValueStreamEncoder(encodings[family]);
+    }
+
+    for (size_t i=0; i<entries; i++) {
+      uint8_t family = 1 + (random() % 4);
+      uint8_t flag = (random() % 32 == 0) ? FLAG_DELETE_CELL : FLAG_INSERT;
+      sprintf(row, "row%06d", (int)(i/4));
+      keybuf.clear();
+      create_key_and_append(keybuf, flag, row, family, "q", (int64_t)i,
+                            (int64_t)i);
+      key.load(SerializedKey(keybuf.base));
+
+      value.clear();
+      if (flag == FLAG_INSERT)
+        make_value(value, family, &counters[family]);
+      else
+        append_string(value, "");
+
+      key_compressor->add(key);
+      size_t key_len = key_compressor->length();
+      expected.ensure(key_len + value.fill());
+      key_compressor->write(expected.ptr);
+      expected.ptr += key_len;
+      expected.add_unchecked(value.base, value.fill());
+
+      keys.ensure(key_len + value.fill());
+      key_compressor->write(keys.ptr);
+      keys.ptr += key_len;
+      if (flag == FLAG_INSERT && encoders[family])
+        encoders[family]->add(ByteString(value.base));
+      else
+        keys.add_unchecked(value.base, value.fill());
+    }
+
+    CellStoreColumnarBlock::assemble(keys, encoders, columnar);
+    for (size_t i=0; i<encoders.size(); i++)
+      HT_ASSERT(encoders[i] == 0 || encoders[i]->count() == 0);
+
+    CellStoreColumnarBlock::expand(columnar, &key_decompressor, expanded);
+    HT_ASSERT(expanded.fill() == expected.fill());
+    HT_ASSERT(memcmp(expanded.base, expected.base, expected.fill()) == 0);
+
+    // Keys-only expansion returns the same keys with empty encoded values
+    CellStoreColumnarBlock::expand(columnar, &key_decompressor, expanded,
+                                   true);
+    const uint8_t *ptr = expanded.base;
+    const uint8_t *expected_ptr = expected.base;
+    KeyDecompressorPrefix expected_decompressor;
+    while (expected_ptr < expected.ptr) {
+      const uint8_t *next = key_decompressor.add(ptr);
+      const uint8_t *expected_next = expected_decompressor.add(expected_ptr);
+      HT_ASSERT(next - ptr == expected_next - expected_ptr);
+      HT_ASSERT(memcmp(ptr, expected_ptr, next - ptr) == 0);
+      ByteString encoded(next), original(expected_next);
+      key_decompressor.load(key);
+      if (key.flag == FLAG_INSERT && encoders[key.column_family_code])
+        HT_ASSERT(encoded.length() == 1);
+      else
+        HT_ASSERT(encoded.length() == original.length());
+      ptr = next + encoded.length();
+      expected_ptr = expected_next + original.length();
+    }
+    HT_ASSERT(ptr == expanded.ptr);
+
+    for (size_t i=0; i<encoders.size(); i++)
+      delete encoders[i];
+  }
+
+}
+
+int main(int argc, char **argv) {
+  size_t entry_counts[] = { 1, 2, 7, 100, 1000, 20000 };
+
+  srandom(1234);
+
+  for (size_t i=0; i<sizeof(entry_counts)/sizeof(size_t); i++)
+    test_block(entry_counts[i]);
+
+  // Streams that hold only fixed-width values need no bitmap, and the
+  // encoded form of a steadily increasing counter should be compact
+  {
+    ValueStreamEncoder encoder(ValueEncoding::DELTA);
+    DynamicBuffer value, stream, decoded;
+    for (int64_t i=0; i<1000; i++) {
+      value.clear();
+      append_fixed(value, 1000000 + 3*i);
+      encoder.add(ByteString(value.base));
+    }
+    HT_ASSERT(encoder.raw_length() == 9000);
+    encoder.encode(stream);
+    HT_ASSERT(stream.fill() < 1100);
+    ValueStreamDecoder decoder;
+    decoder.load(stream.base, stream.fill());
+    for (int64_t i=0; i<1000; i++) {
+      decoded.clear();
+      decoder.next(decoded);
+      const uint8_t *ptr = decoded.base + 1;
+      size_t remaining = 8;
+      HT_ASSERT(decoded.fill() == 9 && decoded.base[0] == 8);
+      HT_ASSERT((int64_t)Serialization::decode_i64(&ptr, &remaining)
+                == 1000000 + 3*i);
+    }
+  }
+
+  return 0;
+}
@@ -0,0 +1,150 @@
+/** -*- c++ -*-
+ * Copyright (C) 2007-2013 Hypertable, Inc.
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 3 of the
+ * License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+#include "Common/Compat.h"
+#include "Common/Error.h"
+#include "Common/Logger.h"
+#include "Common/Serialization.h"
+
+#include "Hypertable/Lib/Schema.h"
+#include "Hypertable/RangeServer/CellStoreTrailerV6.h"
+
+#include <cstring>
+
+using namespace Hypertable;
+using namespace std;
+
+namespace {
+
+  void fill(CellStoreTrailerV6 &trailer, uint16_t version) {
+    trailer.clear();
+    trailer.fix_index_offset = 1000;
+    trailer.var_index_offset = 2000;
+    trailer.filter_offset = 3000;
+    trailer.index_entries = 17;
+    trailer.total_entries = 12345;
+    trailer.blocksize = 65536;
+    trailer.revision = 1357924680;
+    trailer.table_id = 42;
+    trailer.flags = CellStoreTrailerV6::INDEX_64BIT;
+    trailer.compression_ratio = 0.25;
+    trailer.compression_type = 6;
+    trailer.bloom_filter_mode = BLOOM_FILTER_ROWS;
+    trailer.bloom_filter_hash_count = 3;
+    trailer.dictionary_offset = 4000;
+    trailer.dictionary_length = 16384;
+    trailer.version = version;
+  }
+
+  /** Reads a trailer the way CellStoreFactory does, taking the version
+   * from the last two bytes to determine the trailer length.
+   */
+  void read(const uint8_t *end, CellStoreTrailerV6 &trailer) {
+    const uint8_t *ptr = end - 2;
+    size_t remaining = 2;
+    trailer.clear();
+    trailer.version = Serialization::decode_i16(&ptr, &remaining);
+    trailer.deserialize(end - trailer.size());
+  }
+
+  void round_trip(uint16_t version, size_t expected_size) {
+    CellStoreTrailerV6 written, read_back;
+    uint8_t buf[512];
+
+    fill(written, version);
+    HT_ASSERT(written.size() == expected_size);
+
+    // Leading bytes stand in for the end of the last block
+    memset(buf, 0xa5, sizeof(buf));
+    written.serialize(buf + sizeof(buf) - written.size());
+    read(buf + sizeof(buf), read_back);
+
+    HT_ASSERT(read_back.version == version);
+    HT_ASSERT(read_back.size() == expected_size);
+    HT_ASSERT(read_back.trailer_checksum == written.trailer_checksum);
+    HT_ASSERT(read_back.fix_index_offset == 1000);
+    HT_ASSERT(read_back.var_index_offset == 2000);
+    HT_ASSERT(read_back.filter_offset == 3000);
+    HT_ASSERT(read_back.index_entries == 17);
+    HT_ASSERT(read_back.total_entries == 12345);
+    HT_ASSERT(read_back.blocksize == 65536);
+    HT_ASSERT(read_back.revision == 1357924680);
+    HT_ASSERT(read_back.table_id == 42);
+    HT_ASSERT(read_back.flags == CellStoreTrailerV6::INDEX_64BIT);
+    HT_ASSERT(read_back.compression_ratio == 0.25);
+    HT_ASSERT(read_back.compression_type == 6);
+    HT_ASSERT(read_back.bloom_filter_mode == BLOOM_FILTER_ROWS);
+    HT_ASSERT(read_back.bloom_filter_hash_count == 3);
+
+    // The dictionary location is only stored from version 8 on
+    if (version >= 8) {
+      HT_ASSERT(read_back.dictionary_offset == 4000);
+      HT_ASSERT(read_back.dictionary_length == 16384);
+    }
+    else {
+      HT_ASSERT(read_back.dictionary_offset == 0);
+      HT_ASSERT(read_back.dictionary_length == 0);
+    }
+
+    // Any corrupted byte is caught by the trailer checksum
+    for (size_t i=4; i<expected_size; i += 13) {
+      uint8_t *byte = buf + sizeof(buf) - expected_size + i;
+      *byte ^= 0x10;
+      bool mismatch = false;
+      try {
+        read_back.version = version;
+        read_back.deserialize(buf + sizeof(buf) - expected_size);
+      }
+      catch (Exception &e) {
+        HT_ASSERT(e.code() == Error::CHECKSUM_MISMATCH);
+        mismatch = true;
+      }
+      HT_ASSERT(mismatch);
+      *byte ^= 0x10;
+    }
+  }
+
+}
+
+
+int main(int argc, char **argv) {
+
+  round_trip(6, 196);
+  round_trip(7, 196);
+  round_trip(8, 212);
+  round_trip(9, 212);
+  round_trip(10, 212);
+
+  // A version 8 trailer without a dictionary
+  {
+    CellStoreTrailerV6 written, read_back;
+    uint8_t buf[212];
+    fill(written, 8);
+    written.dictionary_offset = 0;
+    written.dictionary_length = 0;
+    written.serialize(buf);
+    read(buf + sizeof(buf), read_back);
+    HT_ASSERT(read_back.version == 8);
+    HT_ASSERT(read_back.dictionary_length == 0);
+  }
+
+  return 0;
+}
@@ -0,0 +1,208 @@
+/** -*- c++ -*-
+ * Copyright (C) 2007-2013 Hypertable, Inc.
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 3 of the
+ * License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+#include "Common/Compat.h"
+#include <iostream>
+#include <vector>
+
+#include "Common/Logger.h"
+
+#include "Hypertable/RangeServer/CompactionPolicy.h"
+
+using namespace Hypertable;
+using namespace std;
+
+#define FLUSH_SIZE 10
+#define TARGET_MIN 100
+#define TARGET_MAX 1000
+#define RUN_LENGTH 5
+#define FLUSHES 2000
+
+namespace {
+
+  struct Amplification {
+    Amplification() : written(0), flushed(0), max_stores(0) { }
+    int64_t written;
+    int64_t flushed;
+    size_t max_stores;
+  };
+
+  /// Flushes fixed size stores into an access group, running each merge
+  /// the policy asks for after every flush
+  Amplification simulate(CompactionPolicy *policy) {
+    vector<int64_t> sizes;
+    Amplification amp;
+    size_t index, length;
+
+    for (size_t i=0; i<FLUSHES; i++) {
+      sizes.push_back(FLUSH_SIZE);
+      amp.flushed += FLUSH_SIZE;
+      amp.written += FLUSH_SIZE;
+      while (policy->find_merge_run(sizes, false,
+                                    (double)amp.written / amp.flushed,
+                                    &index, &length)) {
+        HT_ASSERT(length >= 2 && index + length <= sizes.size());
+        int64_t merged = 0;
+        for (size_t j=index; j<index+length; j++)
+          merged += sizes[j];
+        sizes.erase(sizes.begin()+index, sizes.begin()+index+length);
+        sizes.insert(sizes.begin()+index, merged);
+        amp.written += merged;
+      }
+      if (sizes.size() > amp.max_stores)
+        amp.max_stores = sizes.size();
+    }
+    return amp;
+  }
+
+}
+
+int main(int argc, char **argv) {
+  CompactionPolicyPtr default_policy =
+    new CompactionPolicyDefault(TARGET_MIN, TARGET_MAX, RUN_LENGTH);
+  CompactionPolicyPtr tiered = new CompactionPolicyTiered(TARGET_MIN, 2.0, 4,
+                                                          4.0);
+  CompactionPolicyPtr leveled = new CompactionPolicyLeveled(TARGET_MIN, 10,
+                                                            RUN_LENGTH, 30.0);
+  vector<int64_t> sizes;
+  size_t index, length;
+
+  // Nothing to merge with fewer than two stores
+  sizes.push_back(TARGET_MAX);
+  HT_ASSERT(!default_policy->find_merge_run(sizes, true, 0.0, &index, &length));
+  HT_ASSERT(!tiered->find_merge_run(sizes, true, 0.0, &index, &length));
+  HT_ASSERT(!leveled->find_merge_run(sizes, true, 0.0, &index, &length));
+
+  // Tiered merges four similarly sized stores, leaving the big one alone
+  sizes.clear();
+  sizes.push_back(5000);
+  for (size_t i=0; i<4; i++)
+    sizes.push_back(400 + i*50);
+  HT_ASSERT(tiered->find_merge_run(sizes, false, 0.0, &index, &length));
+  HT_ASSERT(index == 1 && length == 4);
+
+  // Leveled waits for small stores to accumulate, then merges them into
+  // the store they have outgrown
+  sizes.clear();
+  sizes.push_back(5000);
+  sizes.push_back(40);
+  sizes.push_back(10);
+  HT_ASSERT(!leveled->find_merge_run(sizes, false, 0.0, &index, &length));
+  HT_ASSERT(leveled->find_merge_run(sizes, true, 0.0, &index, &length));
+  HT_ASSERT(index == 1 && length == 2);
+  sizes.push_back(100);
+  HT_ASSERT(leveled->find_merge_run(sizes, false, 0.0, &index, &length));
+  HT_ASSERT(index == 1 && length == 3);
+
+  // Below its write amplification limit, tiered also merges short tiers
+  // during the low activity window
+  sizes.clear();
+  sizes.push_back(5000);
+  sizes.push_back(400);
+  sizes.push_back(450);
+  HT_ASSERT(!tiered->find_merge_run(sizes, false, 1.5, &index, &length));
+  HT_ASSERT(!tiered->find_merge_run(sizes, true, 4.0, &index, &length));
+  HT_ASSERT(tiered->find_merge_run(sizes, true, 1.5, &index, &length));
+  HT_ASSERT(index == 1 && length == 2);
+
+  // At its write amplification limit, leveled no longer merges new stores
+  // as soon as they reach the target size, only once enough of them have
+  // accumulated
+  sizes.clear();
+  sizes.push_back(5000);
+  sizes.push_back(40);
+  sizes.push_back(10);
+  sizes.push_back(100);
+  HT_ASSERT(!leveled->find_merge_run(sizes, false, 30.0, &index, &length));
+  HT_ASSERT(leveled->find_merge_run(sizes, true, 30.0, &index, &length));
+  for (size_t i=0; i<RUN_LENGTH-2; i++)
+    sizes.push_back(10);
+  HT_ASSERT(leveled->find_merge_run(sizes, false, 30.0, &index, &length));
+  HT_ASSERT(index == 1 && length == RUN_LENGTH + 1);
+
+  // The partitions of a split major compaction count as one store: a
+  // merge never includes only some of them, and once they have been
+  // written there is nothing left to merge
+  {
+    vector<bool> continues;
+    sizes.clear();
+    for (size_t i=0; i<4; i++) {
+      sizes.push_back(TARGET_MAX);
+      continues.push_back(i > 0);
+    }
+    HT_ASSERT(CompactionPolicy::logical_store_count(continues) == 1);
+    HT_ASSERT(!default_policy->find_grouped_merge_run(sizes, continues, true,
+                                                      0.0, &index, &length));
+    HT_ASSERT(!tiered->find_grouped_merge_run(sizes, continues, true,
+                                              0.0, &index, &length));
+    HT_ASSERT(!leveled->find_grouped_merge_run(sizes, continues, true,
+                                               0.0, &index, &length));
+
+    // Treated independently, the tiered policy would merge them
+    vector<bool> independent(sizes.size(), false);
+    HT_ASSERT(CompactionPolicy::logical_store_count(independent) == 4);
+    HT_ASSERT(tiered->find_grouped_merge_run(sizes, independent, false,
+                                             0.0, &index, &length));
+    HT_ASSERT(index == 0 && length == 4);
+
+    // Flushes after the split compaction are merged with each other and
+    // leave its partitions alone
+    for (size_t i=0; i<=RUN_LENGTH; i++) {
+      sizes.push_back(FLUSH_SIZE);
+      continues.push_back(false);
+    }
+    HT_ASSERT(CompactionPolicy::logical_store_count(continues) ==
+              RUN_LENGTH + 2);
+    HT_ASSERT(leveled->find_grouped_merge_run(sizes, continues, false,
+                                              0.0, &index, &length));
+    HT_ASSERT(index == 4 && length == RUN_LENGTH + 1);
+    HT_ASSERT(default_policy->find_grouped_merge_run(sizes, continues, true,
+                                                     0.0, &index, &length));
+    HT_ASSERT(index == 4 && length == RUN_LENGTH + 1);
+
+    // A group in the middle is covered completely or not at all
+    sizes.insert(sizes.begin(), 40 * TARGET_MAX);
+    continues.insert(continues.begin(), false);
+    for (size_t i=0; i<sizes.size(); i++) {
+      if (!default_policy->find_grouped_merge_run(sizes, continues, i % 2,
+                                                  0.0, &index, &length))
+        continue;
+      HT_ASSERT(index + length == sizes.size() || !continues[index+length]);
+      HT_ASSERT(!continues[index]);
+    }
+  }
+
+  Amplification d = simulate(default_policy.get());
+  Amplification t = simulate(tiered.get());
+  Amplification l = simulate(leveled.get());
+
+  cout << "default: write_amp=" << (double)d.written/d.flushed
+       << " max_stores=" << d.max_stores << endl;
+  cout << "tiered:  write_amp=" << (double)t.written/t.flushed
+       << " max_stores=" << t.max_stores << endl;
+  cout << "leveled: write_amp=" << (double)l.written/l.flushed
+       << " max_stores=" << l.max_stores << endl;
+
+  HT_ASSERT(t.written < l.written);
+  HT_ASSERT(l.max_stores < t.max_stores);
+
+  return 0;
+}
@@ -176,5 +176,88 @@ int main(int argc, char **argv) {
 
   delete cache;
 
+  /**
+   * Verify that with the SLRU policy, blocks that have been accessed more
+   * than once survive a scan over more data than the cache can hold
+   */
+  cache = new FileBlockCache(cache_memory, cache_memory, false, 4,
+                             FileBlockCache::SLRU);
+
+  for (file_offset=0; file_offset<MAX_FILE_OFFSET; file_offset++) {
+    block = new uint8_t [ 1024 ];
+    HT_EXPECT(cache->insert(MAX_FILE_ID, file_offset, block, 1024, true),
+              Error::FAILED_EXPECTATION);
+    cache->checkin(MAX_FILE_ID, file_offset);
+    HT_EXPECT(cache->checkout(MAX_FILE_ID, file_offset, &block, &length),
+              Error::FAILED_EXPECTATION);
+    cache->checkin(MAX_FILE_ID, file_offset);
+  }
+
+  total_alloc = 0;
+  for (file_offset=0; total_alloc < 2*cache_memory; file_offset++) {
+    block = new uint8_t [ TARGET_BUFSIZE ];
+    HT_EXPECT(cache->insert(MAX_FILE_ID+1, file_offset, block, TARGET_BUFSIZE),
+              Error::FAILED_EXPECTATION);
+    total_alloc += TARGET_BUFSIZE;
+  }
+
+  for (file_offset=0; file_offset<MAX_FILE_OFFSET; file_offset++) {
+    if (!cache->contains(MAX_FILE_ID, file_offset)) {
+      HT_ERRORF("SLRU cache evicted protected block (id=%d, offset=%u)",
+                MAX_FILE_ID, file_offset);
+      return 1;
+    }
+  }
+
+  vector<FileBlockCache::ShardStats> shard_stats;
+  uint64_t evictions = 0;
+  cache->get_shard_stats(shard_stats);
+  HT_ASSERT(shard_stats.size() == cache->shard_count());
+  foreach_ht (FileBlockCache::ShardStats &stats, shard_stats)
+    evictions += stats.evictions;
+  HT_ASSERT(evictions > 0);
+
+  delete cache;
+
+  /**
+   * Verify that with the SLRU policy a block larger than the protected
+   * segment's share of a reduced limit can still be checked out a second
+   * time; it is promoted and immediately demoted again
+   */
+  cache = new FileBlockCache(0, FileBlockCache::MIN_SHARD_MEMORY, false, 1,
+                             FileBlockCache::SLRU);
+
+  block = new uint8_t [ TARGET_BUFSIZE ];
+  HT_EXPECT(cache->insert(MAX_FILE_ID, 0, block, TARGET_BUFSIZE, true),
+            Error::FAILED_EXPECTATION);
+  cache->cap_memory_use();
+  HT_ASSERT(cache->get_limit() == TARGET_BUFSIZE);
+
+  for (int i=0; i<3; i++) {
+    uint8_t *checked_out = 0;
+    HT_EXPECT(cache->checkout(MAX_FILE_ID, 0, &checked_out, &length),
+              Error::FAILED_EXPECTATION);
+    HT_ASSERT(checked_out == block);
+    HT_ASSERT(length == TARGET_BUFSIZE);
+  }
+  for (int i=0; i<4; i++)
+    cache->checkin(MAX_FILE_ID, 0);
+  HT_ASSERT(cache->contains(MAX_FILE_ID, 0));
+
+  // The same after lowering the limit with decrease_limit()
+  cache->increase_limit(FileBlockCache::MIN_SHARD_MEMORY);
+  block = new uint8_t [ TARGET_BUFSIZE ];
+  HT_EXPECT(cache->insert(MAX_FILE_ID, 1, block, TARGET_BUFSIZE, true),
+            Error::FAILED_EXPECTATION);
+  cache->decrease_limit(FileBlockCache::MIN_SHARD_MEMORY);
+  HT_ASSERT(cache->get_limit() < 2 * TARGET_BUFSIZE);
+  HT_EXPECT(cache->checkout(MAX_FILE_ID, 1, &block, &length),
+            Error::FAILED_EXPECTATION);
+  HT_ASSERT(length == TARGET_BUFSIZE);
+  cache->checkin(MAX_FILE_ID, 1);
+  cache->checkin(MAX_FILE_ID, 1);
+
+  delete cache;
+
   return 0;
 }
@@ -0,0 +1,322 @@
+/** -*- c++ -*-
+ * Copyright (C) 2007-2013 Hypertable, Inc.
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 3 of the
+ * License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+#include "Common/Compat.h"
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+#include "Common/DynamicBuffer.h"
+#include "Common/Logger.h"
+#include "Common/Serialization.h"
+
+#include "Hypertable/Lib/AggregateMerger.h"
+#include "Hypertable/Lib/Key.h"
+#include "Hypertable/Lib/Schema.h"
+
+#include "Hypertable/RangeServer/MergeScannerAggregate.h"
+
+using namespace Hypertable;
+using namespace std;
+
+namespace {
+
+  const char *schema_str =
+  "<Schema>\n"
+  "  <AccessGroup name=\"default\">\n"
+  "    <ColumnFamily id=\"1\">\n"
+  "      <Name>v</Name>\n"
+  "    </ColumnFamily>\n"
+  "    <ColumnFamily id=\"2\">\n"
+  "      <Name>c</Name>\n"
+  "      <Counter>true</Counter>\n"
+  "    </ColumnFamily>\n"
+  "  </AccessGroup>\n"
+  "</Schema>";
+
+  const char *family_names[] = { "", "v", "c" };
+
+  /// Scanner over serialized key/value pairs in a buffer
+  class BufferScanner : public CellListScanner {
+  public:
+    BufferScanner(DynamicBuffer &buf) : m_buf(buf), m_ptr(buf.base) { }
+    virtual void forward() {
+      Key key;
+      key.load(SerializedKey(m_ptr));
+      ByteString value(m_ptr + key.length);
+      m_ptr += key.length + value.length();
+    }
+    virtual bool get(Key &key, ByteString &value) {
+      if (m_ptr == m_buf.ptr)
+        return false;
+      key.load(SerializedKey(m_ptr));
+      value.ptr = m_ptr + key.length;
+      return true;
+    }
+    virtual uint64_t get_disk_read() { return 0; }
+  private:
+    DynamicBuffer &m_buf;
+    const uint8_t *m_ptr;
+  };
+
+  /// Cells of one range, added in key order
+  class RangeCells {
+  public:
+    RangeCells() : m_buf(0), m_timestamp(1000) { }
+    void add(const char *row, const char *value) {
+      create_key_and_append(m_buf, FLAG_INSERT, row, 1, "q", m_timestamp--,
+                            1);
+      append_as_byte_string(m_buf, value, strlen(value));
+    }
+    void add_counter(const char *row, int64_t count) {
+      uint8_t buf[9];
+      uint8_t *ptr = buf;
+      Serialization::encode_i64(&ptr, count);
+      *ptr = '=';
+      create_key_and_append(m_buf, FLAG_INSERT, row, 2, "q", m_timestamp--,
+                            1);
+      append_as_byte_string(m_buf, buf, 9);
+    }
+    DynamicBuffer &buffer() { return m_buf; }
+  private:
+    DynamicBuffer m_buf;
+    int64_t m_timestamp;
+  };
+
+  /// A partial aggregate as returned to the client
+  struct Partial {
+    String row;
+    String family;
+    String group;
+    String value;
+  };
+
+  /// Runs MergeScannerAggregate over the cells of a range and returns its
+  /// output, with counter values converted to ASCII like FillScanBlock does
+  vector<Partial> aggregate(SchemaPtr &schema, RangeCells &cells,
+                            int32_t function, int32_t group_by,
+                            size_t prefix_length=0) {
+    ScanSpecBuilder ssbuilder;
+    RangeSpec range;
+    vector<Partial> output;
+    Key key;
+    ByteString value;
+
+    range.start_row = "";
+    range.end_row = Key::END_ROW_MARKER;
+    ssbuilder.set_aggregate(function, group_by, prefix_length);
+    ScanContextPtr scan_ctx = new ScanContext(TIMESTAMP_MAX, &ssbuilder.get(),
+                                              &range, schema);
+    MergeScannerAggregate scanner(scan_ctx);
+    scanner.add_scanner(new BufferScanner(cells.buffer()));
+
+    while (scanner.get(key, value)) {
+      Partial partial;
+      const uint8_t *ptr;
+      size_t len = value.decode_length(&ptr);
+      partial.row = key.row;
+      partial.family = family_names[key.column_family_code];
+      partial.group = key.column_qualifier;
+      if (scan_ctx->family_info[key.column_family_code].counter) {
+        HT_ASSERT(len == 9 && ptr[8] == '=');
+        partial.value = format("%lld",
+            (Lld)Serialization::decode_i64(&ptr, &len));
+      }
+      else
+        partial.value = String((const char *)ptr, len);
+      output.push_back(partial);
+      scanner.forward();
+    }
+    return output;
+  }
+
+  void check(const Partial &partial, const char *row, const char *family,
+             const char *group, const char *value) {
+    if (partial.row != row || partial.family != family ||
+        partial.group != group || partial.value != value) {
+      HT_ERRORF("Expected %s %s:%s = %s but got %s %s:%s = %s", row, family,
+                group, value, partial.row.c_str(), partial.family.c_str(),
+                partial.group.c_str(), partial.value.c_str());
+      exit(1);
+    }
+  }
+
+  /// Merges the partials of several ranges, in range order
+  vector<Partial> merge(int32_t function, vector< vector<Partial> > &ranges) {
+    AggregateMerger merger(function);
+    vector<Partial> output;
+    Cell cell;
+
+    for (size_t i=0; i<=ranges.size(); i++) {
+      if (i < ranges.size()) {
+        foreach_ht (Partial &partial, ranges[i]) {
+          Cell input(partial.row.c_str(), partial.family.c_str(),
+                     partial.group.c_str(), 1, 1,
+                     (uint8_t *)partial.value.c_str(), partial.value.length(),
+                     FLAG_INSERT);
+          merger.add(input);
+        }
+      }
+      else
+        merger.finish();
+      while (merger.next(cell)) {
+        Partial partial;
+        HT_ASSERT(!*cell.column_qualifier);
+        partial.row = cell.row_key;
+        partial.family = cell.column_family;
+        partial.value = String((const char *)cell.value, cell.value_len);
+        output.push_back(partial);
+      }
+    }
+    HT_ASSERT(merger.done());
+    return output;
+  }
+
+}
+
+int main(int argc, char **argv) {
+  SchemaPtr schema = Schema::new_instance(schema_str, strlen(schema_str));
+  vector<Partial> out;
+
+  HT_ASSERT(schema->is_valid());
+
+  {
+    // Rows shorter than the prefix form their own group and don't swallow
+    // longer rows that share them as a prefix
+    RangeCells cells;
+    cells.add("a", "1");
+    cells.add("ab", "1");
+    cells.add("abc", "1");
+    cells.add("abcd", "1");
+    cells.add("abce", "1");
+    cells.add("abd", "1");
+    out = aggregate(schema, cells, ScanSpec::AGGREGATE_COUNT,
+                    ScanSpec::GROUP_BY_ROW_PREFIX, 3);
+    HT_ASSERT(out.size() == 4);
+    check(out[0], "a", "v", "a", "1");
+    check(out[1], "ab", "v", "ab", "1");
+    check(out[2], "abce", "v", "abc", "3");
+    check(out[3], "abd", "v", "abd", "1");
+
+    out = aggregate(schema, cells, ScanSpec::AGGREGATE_COUNT,
+                    ScanSpec::GROUP_BY_ROW);
+    HT_ASSERT(out.size() == 6);
+    check(out[2], "abc", "v", "abc", "1");
+
+    out = aggregate(schema, cells, ScanSpec::AGGREGATE_COUNT,
+                    ScanSpec::GROUP_BY_NONE);
+    HT_ASSERT(out.size() == 1);
+    check(out[0], "abd", "v", "", "6");
+  }
+
+  {
+    // Decimal values must be entirely numeric, counters are decoded as
+    // integers; a nine byte decimal value is not mistaken for a counter
+    RangeCells cells;
+    cells.add("r", "-3");
+    cells.add("r", "12abc");
+    cells.add("r", "");
+    cells.add("r", "123456789");
+    cells.add("r", "99999999999999999999");
+    cells.add_counter("r", 40);
+    cells.add_counter("r", 2);
+    out = aggregate(schema, cells, ScanSpec::AGGREGATE_SUM,
+                    ScanSpec::GROUP_BY_ROW);
+    HT_ASSERT(out.size() == 2);
+    check(out[0], "r", "v", "r", "123456786");
+    check(out[1], "r", "c", "r", "42");
+
+    out = aggregate(schema, cells, ScanSpec::AGGREGATE_COUNT,
+                    ScanSpec::GROUP_BY_ROW);
+    HT_ASSERT(out.size() == 2);
+    check(out[0], "r", "v", "r", "5");
+    check(out[1], "r", "c", "r", "2");
+
+    out = aggregate(schema, cells, ScanSpec::AGGREGATE_MIN,
+                    ScanSpec::GROUP_BY_ROW);
+    check(out[0], "r", "v", "r", "-3");
+    check(out[1], "r", "c", "r", "2");
+  }
+
+  {
+    // MIN and MAX skip families without numeric values, SUM reports zero
+    RangeCells cells;
+    cells.add("r1", "x");
+    cells.add("r1", "y");
+    cells.add_counter("r1", 7);
+    cells.add("r2", "5");
+    out = aggregate(schema, cells, ScanSpec::AGGREGATE_MAX,
+                    ScanSpec::GROUP_BY_ROW);
+    HT_ASSERT(out.size() == 2);
+    check(out[0], "r1", "c", "r1", "7");
+    check(out[1], "r2", "v", "r2", "5");
+
+    out = aggregate(schema, cells, ScanSpec::AGGREGATE_MIN,
+                    ScanSpec::GROUP_BY_ROW);
+    HT_ASSERT(out.size() == 2);
+    check(out[0], "r1", "c", "r1", "7");
+
+    out = aggregate(schema, cells, ScanSpec::AGGREGATE_SUM,
+                    ScanSpec::GROUP_BY_ROW);
+    HT_ASSERT(out.size() == 3);
+    check(out[0], "r1", "v", "r1", "0");
+  }
+
+  {
+    // A group that straddles range boundaries arrives as one partial per
+    // range and is merged by the client
+    RangeCells range1, range2, range3;
+    range1.add("aa1", "4");
+    range1.add("bb1", "9");
+    range1.add_counter("bb1", 1);
+    range2.add("bb2", "-2");
+    range3.add("bb3", "6");
+    range3.add_counter("bb3", 5);
+    range3.add("cc1", "3");
+
+    int32_t functions[] = { ScanSpec::AGGREGATE_COUNT,
+                            ScanSpec::AGGREGATE_SUM,
+                            ScanSpec::AGGREGATE_MIN,
+                            ScanSpec::AGGREGATE_MAX };
+    const char *expected_bb_v[] = { "3", "13", "-2", "9" };
+    const char *expected_bb_c[] = { "2", "6", "1", "5" };
+
+    for (size_t i=0; i<4; i++) {
+      vector< vector<Partial> > ranges;
+      ranges.push_back(aggregate(schema, range1, functions[i],
+                                 ScanSpec::GROUP_BY_ROW_PREFIX, 2));
+      ranges.push_back(aggregate(schema, range2, functions[i],
+                                 ScanSpec::GROUP_BY_ROW_PREFIX, 2));
+      ranges.push_back(aggregate(schema, range3, functions[i],
+                                 ScanSpec::GROUP_BY_ROW_PREFIX, 2));
+      out = merge(functions[i], ranges);
+      HT_ASSERT(out.size() == 4);
+      check(out[0], "aa", "v", "", functions[i] == ScanSpec::AGGREGATE_COUNT
+            ? "1" : "4");
+      check(out[1], "bb", "v", "", expected_bb_v[i]);
+      check(out[2], "bb", "c", "", expected_bb_c[i]);
+      check(out[3], "cc", "v", "", functions[i] == ScanSpec::AGGREGATE_COUNT
+            ? "1" : "3");
+    }
+  }
+
+  return 0;
+}
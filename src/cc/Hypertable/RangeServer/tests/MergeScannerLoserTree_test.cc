@@ -0,0 +1,162 @@
+/** -*- c++ -*-
+ * Copyright (C) 2007-2013 Hypertable, Inc.
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 3 of the
+ * License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+#include "Common/Compat.h"
+#include <algorithm>
+#include <cstdlib>
+#include <cstdio>
+#include <iostream>
+#include <vector>
+
+#include "Common/DynamicBuffer.h"
+#include "Common/Logger.h"
+
+#include "Hypertable/Lib/Key.h"
+
+#include "Hypertable/RangeServer/MergeScannerLoserTree.h"
+
+using namespace Hypertable;
+using namespace std;
+
+#define TOTAL_KEYS 20000
+
+namespace {
+
+  /// Scanner over a sorted vector of serialized keys
+  class VectorScanner : public CellListScanner {
+  public:
+    VectorScanner(vector<SerializedKey> &keys) : m_keys(keys), m_index(0) { }
+    virtual void forward() { m_index++; }
+    virtual bool get(Key &key, ByteString &value) {
+      if (m_index == m_keys.size())
+        return false;
+      key.load(m_keys[m_index]);
+      value.ptr = 0;
+      return true;
+    }
+    virtual uint64_t get_disk_read() { return 0; }
+  private:
+    vector<SerializedKey> &m_keys;
+    size_t m_index;
+  };
+
+  /// Creates a random key.  Rows share prefixes and vary in length so that
+  /// both the prefix and the full comparison paths are exercised
+  void make_key(DynamicBuffer &buf) {
+    char row[16], qualifier[4];
+    size_t len = random() % 12;
+    for (size_t i=0; i<len; i++)
+      row[i] = (i < 4) ? 'a' + (random() % 2) : 'a' + (random() % 26);
+    row[len] = 0;
+    qualifier[0] = 'a' + (random() % 3);
+    qualifier[1] = 0;
+    create_key_and_append(buf, FLAG_INSERT, row, 1 + (random() % 2),
+                          qualifier, (int64_t)(random() % 4),
+                          (int64_t)(4 + random() % 4));
+  }
+
+  struct LtKey {
+    bool operator()(const SerializedKey &k1, const SerializedKey &k2) const {
+      return k1 < k2;
+    }
+  };
+
+  /// Merges the sources with the pop/forward/push loop used by MergeScanner
+  /// and returns the keys in the order they came out
+  void merge(vector< vector<SerializedKey> > &sources,
+             vector<SerializedKey> &output, uint64_t *comparisonsp) {
+    MergeScannerLoserTree queue;
+    MergeScannerLoserTree::ScannerState sstate;
+    vector<VectorScanner *> scanners;
+
+    for (size_t i=0; i<sources.size(); i++) {
+      scanners.push_back(new VectorScanner(sources[i]));
+      if (scanners.back()->get(sstate.key, sstate.value)) {
+        sstate.scanner = scanners.back();
+        queue.push(sstate);
+      }
+    }
+
+    while (!queue.empty()) {
+      sstate = queue.top();
+      output.push_back(sstate.key.serial);
+      queue.pop();
+      sstate.scanner->forward();
+      if (sstate.scanner->get(sstate.key, sstate.value))
+        queue.push(sstate);
+    }
+
+    *comparisonsp = queue.comparisons();
+
+    for (size_t i=0; i<scanners.size(); i++)
+      delete scanners[i];
+  }
+
+}
+
+int main(int argc, char **argv) {
+  DynamicBuffer keybuf(TOTAL_KEYS * 64);
+  vector<SerializedKey> keys;
+  SerializedKey key;
+  uint64_t comparisons;
+
+  srandom(1234);
+
+  for (size_t i=0; i<TOTAL_KEYS; i++)
+    make_key(keybuf);
+  for (const uint8_t *ptr = keybuf.base; ptr < keybuf.ptr; ptr += key.length()) {
+    key.ptr = ptr;
+    keys.push_back(key);
+  }
+
+  // Random assignment of keys to sources, for various source counts
+  size_t source_counts[] = { 1, 2, 3, 7, 16, 33 };
+  for (size_t s=0; s<sizeof(source_counts)/sizeof(size_t); s++) {
+    vector< vector<SerializedKey> > sources(source_counts[s]);
+    vector<SerializedKey> output;
+    for (size_t i=0; i<keys.size(); i++)
+      sources[random() % sources.size()].push_back(keys[i]);
+    for (size_t i=0; i<sources.size(); i++)
+      sort(sources[i].begin(), sources[i].end(), LtKey());
+    merge(sources, output, &comparisons);
+    HT_ASSERT(output.size() == keys.size());
+    for (size_t i=1; i<output.size(); i++)
+      HT_ASSERT(!(output[i] < output[i-1]));
+  }
+
+  // Sources holding long runs of consecutive keys should need about one
+  // comparison per key
+  {
+    vector<SerializedKey> sorted_keys(keys);
+    sort(sorted_keys.begin(), sorted_keys.end(), LtKey());
+    vector< vector<SerializedKey> > sources(8);
+    vector<SerializedKey> output;
+    for (size_t i=0; i<sorted_keys.size(); i++)
+      sources[(i / 1000) % sources.size()].push_back(sorted_keys[i]);
+    merge(sources, output, &comparisons);
+    HT_ASSERT(output.size() == sorted_keys.size());
+    for (size_t i=1; i<output.size(); i++)
+      HT_ASSERT(!(output[i] < output[i-1]));
+    HT_ASSERT(comparisons < 2 * sorted_keys.size());
+  }
+
+  return 0;
+}
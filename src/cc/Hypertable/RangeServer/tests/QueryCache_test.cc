@@ -82,7 +82,7 @@ int main(int argc, char **argv) {
     exit(1);
   }
 
-  if (cache->lookup(&key, result, &result_length)) {
+  if (cache->lookup(&key, "/1", row, result, &result_length)) {
     cout << "Error: key should not exist in cache." << endl;
     exit(1);
   }
@@ -108,7 +108,7 @@ int main(int argc, char **argv) {
   for (size_t i=0; i<100; i++) {
     sprintf(keybuf, "%s-%d", row, (int)i);
     md5_csum((unsigned char *)keybuf, strlen(keybuf), (unsigned char *)key.digest);
-    if (!cache->lookup(&key, result, &result_length)) {
+    if (!cache->lookup(&key, "/1", row, result, &result_length)) {
       cout << "Error: key not found." << endl;
       exit(1);
     }
@@ -119,7 +119,7 @@ int main(int argc, char **argv) {
   for (size_t i=0; i<100; i++) {
     sprintf(keybuf, "%s-%d", row, (int)i);
     md5_csum((unsigned char *)keybuf, strlen(keybuf), (unsigned char *)key.digest);
-    if (cache->lookup(&key, result, &result_length)) {
+    if (cache->lookup(&key, "/1", row, result, &result_length)) {
       cout << "Error: key found." << endl;
       exit(1);
     }
@@ -158,12 +158,59 @@ int main(int argc, char **argv) {
 
   for (size_t i=0; i<TRACK_BUFFER_SIZE; i++) {
     if (track_buf[i].row[0] == (char)charno)
-      HT_ASSERT( !cache->lookup(&track_buf[i].key, result, &result_length) );
+      HT_ASSERT( !cache->lookup(&track_buf[i].key, "/1", track_buf[i].row, result, &result_length) );
     else
-      HT_ASSERT( cache->lookup(&track_buf[i].key, result, &result_length) );
+      HT_ASSERT( cache->lookup(&track_buf[i].key, "/1", track_buf[i].row, result, &result_length) );
   }
 
   delete cache;
 
+  /**
+   * Sharded cache with admission control
+   */
+  cache = new QueryCache(MAX_MEMORY, 4, true);
+  HT_ASSERT(cache->shard_count() == 4);
+
+  row[0] = 'a';
+  row[1] = 'a';
+  row[2] = 0;
+  md5_csum((unsigned char *)"aa-admit", 8, (unsigned char *)key.digest);
+
+  // Not admitted until the request has missed twice
+  HT_ASSERT(!cache->lookup(&key, "/1", row, result, &result_length));
+  HT_ASSERT(!cache->insert(&key, "/1", row, result, 1000));
+  HT_ASSERT(cache->available_memory() == MAX_MEMORY);
+  HT_ASSERT(!cache->lookup(&key, "/1", row, result, &result_length));
+  HT_ASSERT(cache->insert(&key, "/1", row, result, 1000));
+  HT_ASSERT(cache->lookup(&key, "/1", row, result, &result_length));
+  HT_ASSERT(result_length == 1000);
+  HT_ASSERT(cache->memory_used() > 1000);
+
+  // Entries of the same row in another table are unaffected by invalidation
+  QueryCache::Key other_key;
+  md5_csum((unsigned char *)"aa-other", 8, (unsigned char *)other_key.digest);
+  HT_ASSERT(!cache->lookup(&other_key, "/2", row, result, &result_length));
+  HT_ASSERT(!cache->lookup(&other_key, "/2", row, result, &result_length));
+  HT_ASSERT(cache->insert(&other_key, "/2", row, result, 500));
+
+  cache->invalidate("/1", row);
+  HT_ASSERT(!cache->lookup(&key, "/1", row, result, &result_length));
+  HT_ASSERT(cache->lookup(&other_key, "/2", row, result, &result_length));
+  HT_ASSERT(result_length == 500);
+
+  // Lookup and hit counts are summed over the shards
+  uint64_t max_memory, available_memory, total_lookups, total_hits;
+  cache->get_stats(&max_memory, &available_memory, &total_lookups,
+                   &total_hits);
+  HT_ASSERT(max_memory == MAX_MEMORY);
+  HT_ASSERT(available_memory == cache->available_memory());
+  HT_ASSERT(total_lookups == 7);
+  HT_ASSERT(total_hits == 2);
+
+  cache->invalidate("/2", row);
+  HT_ASSERT(cache->available_memory() == MAX_MEMORY);
+
+  delete cache;
+
   return 0;
 }
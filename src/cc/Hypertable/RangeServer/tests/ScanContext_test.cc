@@ -0,0 +1,169 @@
+/** -*- c++ -*-
+ * Copyright (C) 2007-2013 Hypertable, Inc.
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 3 of the
+ * License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+#include "Common/Compat.h"
+#include <cstring>
+#include <iostream>
+
+#include "Common/Logger.h"
+
+#include "Hypertable/Lib/Schema.h"
+
+#include "Hypertable/RangeServer/ScanContext.h"
+
+using namespace Hypertable;
+using namespace std;
+
+namespace {
+
+  const char *schema_str =
+  "<Schema>\n"
+  "  <AccessGroup name=\"default\">\n"
+  "    <ColumnFamily id=\"1\">\n"
+  "      <Name>exact</Name>\n"
+  "    </ColumnFamily>\n"
+  "    <ColumnFamily id=\"2\">\n"
+  "      <Name>prefix</Name>\n"
+  "    </ColumnFamily>\n"
+  "    <ColumnFamily id=\"3\">\n"
+  "      <Name>regexp</Name>\n"
+  "    </ColumnFamily>\n"
+  "    <ColumnFamily id=\"4\">\n"
+  "      <Name>regexps</Name>\n"
+  "    </ColumnFamily>\n"
+  "    <ColumnFamily id=\"5\">\n"
+  "      <Name>mixed</Name>\n"
+  "    </ColumnFamily>\n"
+  "    <ColumnFamily id=\"6\">\n"
+  "      <Name>all</Name>\n"
+  "    </ColumnFamily>\n"
+  "  </AccessGroup>\n"
+  "</Schema>";
+
+  bool matches(CellFilterInfo &cfi, const char *qualifier) {
+    return cfi.qualifier_matches(qualifier, strlen(qualifier));
+  }
+
+}
+
+int main(int argc, char **argv) {
+  SchemaPtr schema = Schema::new_instance(schema_str, strlen(schema_str));
+  ScanSpecBuilder ssbuilder;
+  RangeSpec range;
+
+  HT_ASSERT(schema->is_valid());
+
+  range.start_row = "";
+  range.end_row = Key::END_ROW_MARKER;
+
+  // More exact qualifiers than the initial hash table size
+  ssbuilder.add_column("exact:a");
+  ssbuilder.add_column("exact:ab");
+  ssbuilder.add_column("exact:abc");
+  ssbuilder.add_column("exact:b");
+  ssbuilder.add_column("exact:c");
+  ssbuilder.add_column("exact:d");
+  // "pre" covers "prefix", "q" is independent
+  ssbuilder.add_column("prefix:^pre");
+  ssbuilder.add_column("prefix:^prefix");
+  ssbuilder.add_column("prefix:^q");
+  ssbuilder.add_column("regexp:/^a.*z$/");
+  ssbuilder.add_column("regexps:/^a.*z$/");
+  ssbuilder.add_column("regexps:/b[0-9]+/");
+  ssbuilder.add_column("mixed:x");
+  ssbuilder.add_column("mixed:^y");
+  ssbuilder.add_column("mixed:/z$/");
+  ssbuilder.add_column("all");
+
+  ScanContextPtr scan_ctx = new ScanContext(TIMESTAMP_MAX, &ssbuilder.get(),
+                                            &range, schema);
+
+  CellFilterInfo &exact = scan_ctx->family_info[1];
+  HT_ASSERT(exact.has_qualifier_filter());
+  HT_ASSERT(matches(exact, "a"));
+  HT_ASSERT(matches(exact, "ab"));
+  HT_ASSERT(matches(exact, "abc"));
+  HT_ASSERT(matches(exact, "d"));
+  HT_ASSERT(!matches(exact, ""));
+  HT_ASSERT(!matches(exact, "abcd"));
+  HT_ASSERT(!matches(exact, "e"));
+  // length is honoured, the qualifier need not be terminated
+  HT_ASSERT(exact.qualifier_matches("abcd", 2));
+
+  CellFilterInfo &prefix = scan_ctx->family_info[2];
+  HT_ASSERT(matches(prefix, "pre"));
+  HT_ASSERT(matches(prefix, "prefix"));
+  HT_ASSERT(matches(prefix, "prevent"));
+  HT_ASSERT(matches(prefix, "q"));
+  HT_ASSERT(matches(prefix, "quux"));
+  HT_ASSERT(!matches(prefix, "pr"));
+  HT_ASSERT(!matches(prefix, "p"));
+  HT_ASSERT(!matches(prefix, "a"));
+  HT_ASSERT(!matches(prefix, "r"));
+  HT_ASSERT(!matches(prefix, ""));
+
+  CellFilterInfo &regexp = scan_ctx->family_info[3];
+  HT_ASSERT(regexp.has_qualifier_regexp_filter());
+  HT_ASSERT(matches(regexp, "az"));
+  HT_ASSERT(matches(regexp, "abcz"));
+  HT_ASSERT(!matches(regexp, "abc"));
+  HT_ASSERT(!matches(regexp, "baz"));
+
+  // Several regular expressions are matched as a set, unanchored
+  CellFilterInfo &regexps = scan_ctx->family_info[4];
+  HT_ASSERT(matches(regexps, "abcz"));
+  HT_ASSERT(matches(regexps, "b1"));
+  HT_ASSERT(matches(regexps, "xxb42yy"));
+  HT_ASSERT(!matches(regexps, "b"));
+  HT_ASSERT(!matches(regexps, "baz"));
+
+  CellFilterInfo &mixed = scan_ctx->family_info[5];
+  HT_ASSERT(matches(mixed, "x"));
+  HT_ASSERT(matches(mixed, "yes"));
+  HT_ASSERT(matches(mixed, "fizz"));
+  HT_ASSERT(!matches(mixed, "xx"));
+  HT_ASSERT(!matches(mixed, "zap"));
+
+  CellFilterInfo &all = scan_ctx->family_info[6];
+  HT_ASSERT(!all.has_qualifier_filter());
+  HT_ASSERT(matches(all, "anything"));
+  HT_ASSERT(matches(all, ""));
+
+  // Copies carry the compiled filters
+  CellFilterInfo copy(mixed);
+  HT_ASSERT(matches(copy, "x"));
+  HT_ASSERT(matches(copy, "yes"));
+  HT_ASSERT(matches(copy, "fizz"));
+  HT_ASSERT(!matches(copy, "zap"));
+
+  // Filters added directly are matched once compiled
+  CellFilterInfo cfi;
+  cfi.add_qualifier("k", false, false);
+  cfi.add_qualifier("m", false, true);
+  cfi.add_qualifier("[0-9]$", true, false);
+  cfi.compile();
+  HT_ASSERT(matches(cfi, "k"));
+  HT_ASSERT(matches(cfi, "mm"));
+  HT_ASSERT(matches(cfi, "v2"));
+  HT_ASSERT(!matches(cfi, "kk"));
+
+  return 0;
+}
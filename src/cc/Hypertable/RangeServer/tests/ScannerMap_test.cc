@@ -0,0 +1,81 @@
+/** -*- c++ -*-
+ * Copyright (C) 2007-2013 Hypertable, Inc.
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 3 of the
+ * License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+#include "Common/Compat.h"
+#include <iostream>
+
+extern "C" {
+#include <poll.h>
+}
+
+#include "Common/Logger.h"
+
+#include "Hypertable/RangeServer/ScannerMap.h"
+
+using namespace Hypertable;
+using namespace std;
+
+int main(int argc, char **argv) {
+  ScannerMap scanner_map;
+  CellListScannerPtr scanner;
+  RangePtr range;
+  TableIdentifier table("1");
+  TableIdentifierManaged found_table;
+
+  uint32_t id1 = scanner_map.put(scanner, range, &table);
+  uint32_t id2 = scanner_map.put(scanner, range, &table);
+  HT_ASSERT(id1 != id2);
+
+  // Open scanners are not closed, unknown ids are neither open nor closed
+  HT_ASSERT(scanner_map.get(id1, scanner, range, found_table));
+  HT_ASSERT(!scanner_map.is_closed(id1));
+  HT_ASSERT(!scanner_map.is_closed(id2 + 1000));
+
+  // A scanner that returned its last block (or was destroyed) is closed,
+  // later fetches for it find no scanner but can be told apart
+  HT_ASSERT(scanner_map.remove(id1));
+  HT_ASSERT(!scanner_map.get(id1, scanner, range, found_table));
+  HT_ASSERT(scanner_map.is_closed(id1));
+  HT_ASSERT(!scanner_map.is_closed(id2));
+
+  // Removing twice (e.g. destroy after the last block) is harmless
+  HT_ASSERT(!scanner_map.remove(id1));
+  HT_ASSERT(scanner_map.is_closed(id1));
+
+  // Only the most recently closed ids are remembered
+  scanner_map.set_closed_limit(2);
+  HT_ASSERT(scanner_map.remove(id2));
+  uint32_t id3 = scanner_map.put(scanner, range, &table);
+  HT_ASSERT(scanner_map.remove(id3));
+  HT_ASSERT(!scanner_map.is_closed(id1));
+  HT_ASSERT(scanner_map.is_closed(id2));
+  HT_ASSERT(scanner_map.is_closed(id3));
+
+  // Expired scanners are closed as well
+  uint32_t id4 = scanner_map.put(scanner, range, &table);
+  poll(0, 0, 10);
+  scanner_map.purge_expired(1);
+  HT_ASSERT(!scanner_map.get(id4, scanner, range, found_table));
+  HT_ASSERT(scanner_map.is_closed(id4));
+  HT_ASSERT(!scanner_map.is_closed(id2));
+
+  return 0;
+}
@@ -0,0 +1,233 @@
+/** -*- c++ -*-
+ * Copyright (C) 2007-2013 Hypertable, Inc.
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 3 of the
+ * License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+#include "Common/Compat.h"
+#include <iostream>
+#include <map>
+#include <vector>
+
+extern "C" {
+#include <poll.h>
+}
+
+#include <boost/bind.hpp>
+
+#include "Common/Logger.h"
+#include "Common/String.h"
+#include "Common/Thread.h"
+
+#include "Hypertable/Lib/Types.h"
+
+#include "Hypertable/RangeServer/UpdateQualifyQueue.h"
+
+using namespace Hypertable;
+using namespace std;
+
+#define QUEUE_COUNT 4
+#define TABLE_COUNT 40
+#define UPDATE_COUNT 20000
+
+namespace {
+
+  /// Stands in for TableUpdate
+  struct Update {
+    Update(const String &table, int s) : table_name(table), seq(s) {
+      id.id = table_name.c_str();
+    }
+    String table_name;
+    TableIdentifier id;
+    int seq;
+  };
+
+  /// Stands in for RangeServer::UpdateContext
+  struct Context {
+    std::vector<Update *> updates;
+  };
+
+  typedef UpdateQualifyQueue<Context> Queue;
+
+  /// Consumer for one queue, records the updates in the order popped
+  void consume(Queue *queue, std::vector<Update *> *popped) {
+    Context *uc;
+    while ((uc = queue->pop()) != 0) {
+      popped->insert(popped->end(), uc->updates.begin(), uc->updates.end());
+      delete uc;
+    }
+  }
+
+  void produce(Queue *queue, Context *uc, bool *done) {
+    queue->push(uc);
+    *done = true;
+  }
+
+  String table_id(int i) {
+    return format("%d", i + 2);
+  }
+
+}
+
+
+int main(int argc, char **argv) {
+
+  // Every table id always maps to the same queue and the tables are
+  // spread evenly over the queues
+  {
+    size_t per_queue[QUEUE_COUNT] = { 0 };
+    for (int i=0; i<1000; i++) {
+      String id = table_id(i);
+      size_t partition = Queue::partition(id.c_str(), QUEUE_COUNT);
+      HT_ASSERT(partition < QUEUE_COUNT);
+      HT_ASSERT(partition == Queue::partition(id.c_str(), QUEUE_COUNT));
+      per_queue[partition]++;
+    }
+    for (size_t i=0; i<QUEUE_COUNT; i++)
+      HT_ASSERT(per_queue[i] > 150 && per_queue[i] < 350);
+  }
+
+  // Splitting a batch keeps the updates of each table together and in
+  // batch order
+  {
+    std::vector<Update *> batch;
+    for (int i=0; i<100; i++)
+      batch.push_back(new Update(table_id(i % 7), i));
+    std::map<size_t, std::vector<Update *> > partitions;
+    Queue::split(batch, QUEUE_COUNT, partitions);
+    size_t total = 0;
+    for (std::map<size_t, std::vector<Update *> >::iterator iter =
+           partitions.begin(); iter != partitions.end(); ++iter) {
+      for (size_t i=0; i<iter->second.size(); i++) {
+        Update *update = iter->second[i];
+        HT_ASSERT(Queue::partition(update->id.id, QUEUE_COUNT) == iter->first);
+        if (i > 0)
+          HT_ASSERT(iter->second[i-1]->seq < update->seq);
+      }
+      total += iter->second.size();
+    }
+    HT_ASSERT(total == batch.size());
+    foreach_ht (Update *update, batch)
+      delete update;
+  }
+
+  // Updates pushed through bounded queues by one producer reach the
+  // consumers in the order they were submitted, table by table
+  {
+    std::vector<Queue *> queues;
+    std::vector<std::vector<Update *> > popped(QUEUE_COUNT);
+    ThreadGroup consumers;
+    for (size_t i=0; i<QUEUE_COUNT; i++) {
+      queues.push_back(new Queue(8));
+      consumers.create_thread(boost::bind(consume, queues[i], &popped[i]));
+    }
+
+    for (int seq=0; seq<UPDATE_COUNT; ) {
+      std::vector<Update *> batch;
+      for (int i=0; i<10; i++, seq++)
+        batch.push_back(new Update(table_id(random() % TABLE_COUNT), seq));
+      std::map<size_t, std::vector<Update *> > partitions;
+      Queue::split(batch, QUEUE_COUNT, partitions);
+      for (std::map<size_t, std::vector<Update *> >::iterator iter =
+             partitions.begin(); iter != partitions.end(); ++iter) {
+        Context *uc = new Context();
+        uc->updates = iter->second;
+        queues[iter->first]->push(uc);
+        HT_ASSERT(queues[iter->first]->size() <= 8);
+      }
+    }
+
+    while (true) {
+      size_t queued = 0;
+      foreach_ht (Queue *queue, queues)
+        queued += queue->size();
+      if (queued == 0)
+        break;
+      poll(0, 0, 10);
+    }
+    foreach_ht (Queue *queue, queues)
+      queue->shutdown();
+    consumers.join_all();
+
+    std::map<String, int> last_seq;
+    size_t total = 0;
+    for (size_t i=0; i<QUEUE_COUNT; i++) {
+      foreach_ht (Update *update, popped[i]) {
+        HT_ASSERT(Queue::partition(update->id.id, QUEUE_COUNT) == i);
+        std::map<String, int>::iterator iter =
+          last_seq.find(update->table_name);
+        if (iter != last_seq.end())
+          HT_ASSERT(iter->second < update->seq);
+        last_seq[update->table_name] = update->seq;
+        delete update;
+      }
+      total += popped[i].size();
+    }
+    HT_ASSERT(total == UPDATE_COUNT);
+    foreach_ht (Queue *queue, queues)
+      delete queue;
+  }
+
+  // A full queue whose consumer is stalled only blocks its own producer;
+  // the other queues keep moving
+  {
+    Queue stalled(2), moving(2);
+    std::vector<Update *> popped;
+    bool done = false;
+
+    stalled.push(new Context());
+    stalled.push(new Context());
+    Thread producer(boost::bind(produce, &stalled, new Context(), &done));
+    poll(0, 0, 100);
+    HT_ASSERT(!done);
+    HT_ASSERT(stalled.size() == 2);
+
+    Thread consumer(boost::bind(consume, &moving, &popped));
+    for (int i=0; i<100; i++) {
+      Context *uc = new Context();
+      uc->updates.push_back(new Update(table_id(0), i));
+      moving.push(uc);
+    }
+    while (moving.size() > 0)
+      poll(0, 0, 10);
+    HT_ASSERT(!done);
+
+    // Draining the stalled queue lets its producer finish
+    delete stalled.pop();
+    producer.join();
+    HT_ASSERT(done);
+    HT_ASSERT(stalled.size() == 2);
+
+    moving.shutdown();
+    consumer.join();
+    HT_ASSERT(popped.size() == 100);
+    for (int i=0; i<100; i++) {
+      HT_ASSERT(popped[i]->seq == i);
+      delete popped[i];
+    }
+
+    // After shutdown nothing is popped and producers don't wait
+    stalled.shutdown();
+    HT_ASSERT(stalled.pop() == 0);
+    stalled.push(new Context());
+    HT_ASSERT(stalled.size() == 3);
+  }
+
+  cout << "SUCCESS" << endl;
+  return 0;
+}
@@ -361,6 +361,15 @@ typedef list<string> CellAsArray
  */
 typedef binary CellsSerialized
 
+/**
+ * Binary buffer holding a batch of cells stored column by column: row keys,
+ * column families, column qualifiers, timestamps and values each in one
+ * contiguous array with an offset vector, repeated row keys stored once.
+ * See ColumnarCellsFlag.h for the layout and ColumnarCellsReader for a
+ * C++ reader.
+ */
+typedef binary CellsColumnar
+
 /** Specifies a result object for asynchronous requests.
  * TODO: add support for update results
  *
@@ -821,6 +830,12 @@ service ClientService {
   CellsSerialized scanner_get_cells_serialized(1:Scanner scanner) throws (1:ClientException e),
   CellsSerialized next_cells_serialized(1:Scanner scanner) throws (1:ClientException e),
 
+  /**
+   * Alternative interface returning a columnar batch of cells, which can
+   * be consumed without constructing an object per cell
+   */
+  CellsColumnar scanner_get_cells_columnar(1:Scanner scanner) throws (1:ClientException e),
+
   /**
    * Iterate over rows of a scanner
    *
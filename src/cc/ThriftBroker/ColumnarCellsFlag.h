@@ -0,0 +1,61 @@
+/**
+ * Copyright (C) 2007-2013 Hypertable, Inc.
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Hypertable. If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HYPERTABLE_COLUMNARCELLSFLAG_H
+#define HYPERTABLE_COLUMNARCELLSFLAG_H
+
+/*
+ * Columnar cells buffer layout.  All integers are little endian and every
+ * section starts on an 8 byte boundary, so a client can use the arrays in
+ * place.  Strings are stored back to back, each followed by a '\0' that is
+ * not counted in its length; offsets[i+1] - offsets[i] - 1 is the length of
+ * string i.
+ *
+ *   i32 version, u8 flags, u8[3] padding
+ *   i32 cell count (N), i32 row count (R), i32 column family count (F),
+ *   i32 padding
+ *   i32 row offsets[R+1], row key bytes
+ *   i32 row index[N]                          (ROW_DICTIONARY only)
+ *   i32 column family offsets[F+1], column family bytes
+ *   i32 column family index[N]
+ *   i32 column qualifier offsets[N+1], column qualifier bytes
+ *   i64 timestamps[N]
+ *   u8  cell flags[N]
+ *   i32 value offsets[N+1], value bytes
+ *
+ * Without ROW_DICTIONARY, R == N and cell i has row key i.
+ */
+
+namespace Hypertable {
+  namespace ColumnarCellsFlag {
+    enum {
+      EOS            = 0x02,
+      ROW_DICTIONARY = 0x10
+    };
+  }
+
+  namespace ColumnarCellsVersion {
+    enum {
+      CCVERSION      = 0x01,
+      HEADER_LENGTH  = 24
+    };
+  }
+}
+
+#endif // HYPERTABLE_COLUMNARCELLSFLAG_H
@@ -0,0 +1,116 @@
+/**
+ * Copyright (C) 2007-2013 Hypertable, Inc.
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Hypertable. If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "Common/Compat.h"
+#include "Common/Error.h"
+#include "Common/Logger.h"
+#include "Common/Serialization.h"
+
+#include "ColumnarCellsReader.h"
+
+using namespace Hypertable;
+
+namespace {
+  const uint8_t *align(const uint8_t *base, const uint8_t *ptr) {
+    return ptr + ((8 - ((ptr - base) & 7)) & 7);
+  }
+}
+
+
+void ColumnarCellsReader::init(const uint8_t *buf, uint32_t len) {
+  const uint8_t *ptr = buf;
+  size_t remaining = len;
+
+  m_base = buf;
+  m_end = buf + len;
+
+  if (len < ColumnarCellsVersion::HEADER_LENGTH)
+    HT_THROW(Error::SERIALIZATION_INPUT_OVERRUN, "");
+
+  int32_t version = Serialization::decode_i32(&ptr, &remaining);
+  if (version != ColumnarCellsVersion::CCVERSION)
+    HT_THROW(Error::SERIALIZATION_VERSION_MISMATCH, "");
+  m_flag = Serialization::decode_i8(&ptr, &remaining);
+  ptr = align(m_base, ptr);
+  remaining = m_end - ptr;
+  m_count = Serialization::decode_i32(&ptr, &remaining);
+  m_row_count = Serialization::decode_i32(&ptr, &remaining);
+  m_family_count = Serialization::decode_i32(&ptr, &remaining);
+  ptr = align(m_base, ptr);
+
+  if (m_count < 0 || m_row_count < 0 || m_family_count < 0 ||
+      m_row_count > m_count || m_family_count > m_count ||
+      (!(m_flag & ColumnarCellsFlag::ROW_DICTIONARY) &&
+       m_row_count != m_count))
+    HT_THROW(Error::BAD_FORMAT, "Bad columnar cells header");
+
+  ptr = read_strings(ptr, m_row_count, m_rows);
+
+  m_row_index = 0;
+  if (m_flag & ColumnarCellsFlag::ROW_DICTIONARY) {
+    m_row_index = ptr;
+    ptr = read_array(ptr, 4 * (size_t)m_count);
+  }
+
+  ptr = read_strings(ptr, m_family_count, m_families);
+  m_family_index = ptr;
+  ptr = read_array(ptr, 4 * (size_t)m_count);
+
+  ptr = read_strings(ptr, m_count, m_qualifiers);
+
+  m_timestamps = ptr;
+  ptr += 8 * (size_t)m_count;
+  m_cell_flags = ptr;
+  ptr = read_array(ptr, m_count);
+
+  m_values.offsets = ptr;
+  if (ptr + 4 * ((size_t)m_count + 1) > m_end)
+    HT_THROW(Error::SERIALIZATION_INPUT_OVERRUN, "");
+  m_values.data = (const char *)ptr + 4 * ((size_t)m_count + 1);
+  if ((const uint8_t *)m_values.data + load_i32(ptr, m_count) > m_end)
+    HT_THROW(Error::SERIALIZATION_INPUT_OVERRUN, "");
+
+  // row and family indexes must stay inside their string sections
+  for (int32_t i=0; i<m_count; i++) {
+    if ((uint32_t)load_i32(m_family_index, i) >= (uint32_t)m_family_count ||
+        (m_row_index &&
+         (uint32_t)load_i32(m_row_index, i) >= (uint32_t)m_row_count))
+      HT_THROW(Error::BAD_FORMAT, "Bad index in columnar cells buffer");
+  }
+}
+
+
+const uint8_t *
+ColumnarCellsReader::read_strings(const uint8_t *ptr, int32_t count,
+                                  Strings &s) {
+  size_t offsets_length = 4 * ((size_t)count + 1);
+  if (ptr + offsets_length > m_end)
+    HT_THROW(Error::SERIALIZATION_INPUT_OVERRUN, "");
+  s.offsets = ptr;
+  s.data = (const char *)ptr + offsets_length;
+  return read_array((const uint8_t *)s.data, load_i32(ptr, count));
+}
+
+
+const uint8_t *
+ColumnarCellsReader::read_array(const uint8_t *ptr, size_t length) {
+  if (ptr + length > m_end)
+    HT_THROW(Error::SERIALIZATION_INPUT_OVERRUN, "");
+  return align(m_base, ptr + length);
+}
@@ -0,0 +1,154 @@
+/**
+ * Copyright (C) 2007-2013 Hypertable, Inc.
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Hypertable. If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HYPERTABLE_COLUMNARCELLSREADER_H
+#define HYPERTABLE_COLUMNARCELLSREADER_H
+
+#include <cstring>
+
+#include "Common/Serialization.h"
+
+#include "Hypertable/Lib/KeySpec.h"
+#include "Hypertable/Lib/Cell.h"
+
+#include "ColumnarCellsFlag.h"
+
+namespace Hypertable {
+
+  /**
+   * Random access view over a columnar cells buffer produced by
+   * ColumnarCellsWriter.  Nothing is copied or allocated; all returned
+   * pointers point into the buffer, which must outlive the reader.
+   */
+  class ColumnarCellsReader {
+  public:
+
+    ColumnarCellsReader(const void *buf, uint32_t len) {
+      init((const uint8_t *)buf, len);
+    }
+
+    /// Number of cells in the batch
+    int32_t size() { return m_count; }
+
+    /// Number of distinct row keys (equals size() without a dictionary)
+    int32_t row_count() { return m_row_count; }
+
+    /// Index of the row key of cell <code>i</code>
+    int32_t row_index(int32_t i) {
+      return m_row_index ? load_i32(m_row_index, i) : i;
+    }
+
+    const char *row(int32_t i) { return string(m_rows, row_index(i)); }
+    uint32_t row_len(int32_t i) { return length(m_rows, row_index(i)); }
+
+    const char *column_family(int32_t i) {
+      return string(m_families, load_i32(m_family_index, i));
+    }
+
+    const char *column_qualifier(int32_t i) { return string(m_qualifiers, i); }
+    uint32_t column_qualifier_len(int32_t i) {
+      return length(m_qualifiers, i);
+    }
+
+    int64_t timestamp(int32_t i) {
+#if defined(HT_LITTLE_ENDIAN)
+      int64_t ts;
+      memcpy(&ts, m_timestamps + 8*i, 8);
+      return ts;
+#else
+      const uint8_t *ptr = m_timestamps + 8*i;
+      size_t remaining = 8;
+      return Serialization::decode_i64(&ptr, &remaining);
+#endif
+    }
+
+    uint8_t cell_flag(int32_t i) { return m_cell_flags[i]; }
+
+    const void *value(int32_t i) { return string(m_values, i); }
+    const char *value_str(int32_t i) { return string(m_values, i); }
+    uint32_t value_len(int32_t i) { return length(m_values, i); }
+
+    void get(int32_t i, Cell &cell) {
+      cell.row_key = row(i);
+      cell.column_family = column_family(i);
+      cell.column_qualifier = column_qualifier(i);
+      cell.timestamp = timestamp(i);
+      cell.revision = AUTO_ASSIGN;
+      cell.value = (const uint8_t *)value(i);
+      cell.value_len = value_len(i);
+      cell.flag = cell_flag(i);
+      if (cell.flag == FLAG_DELETE_ROW && !*cell.column_family)
+        cell.column_family = 0;
+    }
+
+    bool eos() { return (m_flag & ColumnarCellsFlag::EOS) != 0; }
+
+  private:
+    /// Strings section: <code>count+1</code> offsets then the bytes
+    struct Strings {
+      const uint8_t *offsets;
+      const char *data;
+    };
+
+    static int32_t load_i32(const uint8_t *array, int32_t i) {
+#if defined(HT_LITTLE_ENDIAN)
+      int32_t value;
+      memcpy(&value, array + 4*i, 4);
+      return value;
+#else
+      const uint8_t *ptr = array + 4*i;
+      size_t remaining = 4;
+      return Serialization::decode_i32(&ptr, &remaining);
+#endif
+    }
+
+    static const char *string(const Strings &s, int32_t i) {
+      return s.data + load_i32(s.offsets, i);
+    }
+
+    static uint32_t length(const Strings &s, int32_t i) {
+      return load_i32(s.offsets, i+1) - load_i32(s.offsets, i) - 1;
+    }
+
+    void init(const uint8_t *buf, uint32_t len);
+
+    const uint8_t *read_strings(const uint8_t *ptr, int32_t count,
+                                Strings &s);
+
+    const uint8_t *read_array(const uint8_t *ptr, size_t length);
+
+    const uint8_t *m_base;
+    const uint8_t *m_end;
+    uint8_t m_flag;
+    int32_t m_count;
+    int32_t m_row_count;
+    int32_t m_family_count;
+    Strings m_rows;
+    const uint8_t *m_row_index;
+    Strings m_families;
+    const uint8_t *m_family_index;
+    Strings m_qualifiers;
+    const uint8_t *m_timestamps;
+    const uint8_t *m_cell_flags;
+    Strings m_values;
+  };
+
+}
+
+#endif // HYPERTABLE_COLUMNARCELLSREADER_H
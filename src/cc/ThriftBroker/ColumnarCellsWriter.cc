@@ -0,0 +1,209 @@
+/**
+ * Copyright (C) 2007-2013 Hypertable, Inc.
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Hypertable. If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "Common/Compat.h"
+#include "Common/Error.h"
+#include "Common/Logger.h"
+#include "Common/Serialization.h"
+
+#include "ColumnarCellsWriter.h"
+
+using namespace Hypertable;
+
+namespace {
+
+  /// Worst case padding added by finalize(), one per section
+  const size_t PADDING_SLACK = 8 * 9;
+
+  void pad(DynamicBuffer &buf) {
+    while (buf.fill() & 7)
+      *buf.ptr++ = 0;
+  }
+
+  void encode_i32_array(DynamicBuffer &buf, const std::vector<int32_t> &v) {
+#if defined(HT_LITTLE_ENDIAN)
+    if (!v.empty())
+      buf.add_unchecked(&v[0], v.size() * 4);
+#else
+    for (size_t i=0; i<v.size(); i++)
+      Serialization::encode_i32(&buf.ptr, v[i]);
+#endif
+  }
+
+  void encode_i64_array(DynamicBuffer &buf, const std::vector<int64_t> &v) {
+#if defined(HT_LITTLE_ENDIAN)
+    if (!v.empty())
+      buf.add_unchecked(&v[0], v.size() * 8);
+#else
+    for (size_t i=0; i<v.size(); i++)
+      Serialization::encode_i64(&buf.ptr, v[i]);
+#endif
+  }
+
+}
+
+
+bool ColumnarCellsWriter::add(const char *row, const char *column_family,
+                              const char *column_qualifier, int64_t timestamp,
+                              const void *value, int32_t value_length,
+                              uint8_t cell_flag) {
+  int32_t row_length = strlen(row);
+  int32_t column_family_length = column_family ? strlen(column_family) : 0;
+  int32_t column_qualifier_length =
+    column_qualifier ? strlen(column_qualifier) : 0;
+
+  HT_ASSERT(!m_finalized);
+
+  if (row_length == 0)
+    HT_THROW(Error::INVALID_ARGUMENT,
+             "Attempt to add empty row key to columnar cells buffer");
+
+  if (!value && value_length)
+    value_length = 0;
+
+  bool need_row = true;
+  if (m_row_dictionary && m_count) {
+    size_t last = m_row_offsets.size() - 2;
+    int32_t last_length = m_row_offsets[last+1] - m_row_offsets[last] - 1;
+    need_row = last_length != row_length ||
+      memcmp(m_rows.data() + m_row_offsets[last], row, row_length);
+  }
+
+  // row index, family index, qualifier offset, timestamp, flag, value offset
+  size_t length = 4 + 4 + 4 + 8 + 1 + 4 + column_qualifier_length + 1 +
+    value_length + 1 + column_family_length + 1;
+  if (need_row)
+    length += 4 + row_length + 1;
+
+  if (m_limit > 0 && m_count &&
+      m_length + length + PADDING_SLACK > (size_t)m_limit)
+    return false;
+
+  if (need_row) {
+    m_rows.append(row, row_length + 1);
+    m_row_offsets.push_back(m_rows.size());
+  }
+  if (m_row_dictionary)
+    m_row_index.push_back(m_row_offsets.size() - 2);
+
+  m_family_index.push_back(add_family(column_family, column_family_length));
+
+  if (column_qualifier_length)
+    m_qualifiers.append(column_qualifier, column_qualifier_length);
+  m_qualifiers.append(1, '\0');
+  m_qualifier_offsets.push_back(m_qualifiers.size());
+
+  m_timestamps.push_back(timestamp);
+  m_cell_flags.push_back(cell_flag);
+
+  if (value_length)
+    m_values.append((const char *)value, value_length);
+  m_values.append(1, '\0');
+  m_value_offsets.push_back(m_values.size());
+
+  m_length += length;
+  m_count++;
+  return true;
+}
+
+
+int32_t ColumnarCellsWriter::add_family(const char *column_family,
+                                        int32_t length) {
+  // a scan returns few column families; search back from the newest
+  for (size_t i=m_family_offsets.size()-1; i>0; i--) {
+    int32_t offset = m_family_offsets[i-1];
+    if (m_family_offsets[i] - offset - 1 == length &&
+        !memcmp(m_families.data() + offset, column_family, length))
+      return i - 1;
+  }
+  if (length)
+    m_families.append(column_family, length);
+  m_families.append(1, '\0');
+  m_family_offsets.push_back(m_families.size());
+  return m_family_offsets.size() - 2;
+}
+
+
+void ColumnarCellsWriter::finalize(uint8_t flag) {
+  if (m_row_dictionary)
+    flag |= ColumnarCellsFlag::ROW_DICTIONARY;
+
+  m_buf.clear();
+  // leading offset of each offsets array and the family offsets
+  m_buf.reserve(m_length + PADDING_SLACK + 4 * (m_family_offsets.size() + 3));
+
+  Serialization::encode_i32(&m_buf.ptr, ColumnarCellsVersion::CCVERSION);
+  *m_buf.ptr++ = flag;
+  pad(m_buf);
+  Serialization::encode_i32(&m_buf.ptr, m_count);
+  Serialization::encode_i32(&m_buf.ptr, m_row_offsets.size() - 1);
+  Serialization::encode_i32(&m_buf.ptr, m_family_offsets.size() - 1);
+  pad(m_buf);
+
+  encode_i32_array(m_buf, m_row_offsets);
+  m_buf.add_unchecked(m_rows.data(), m_rows.size());
+  pad(m_buf);
+
+  if (m_row_dictionary) {
+    encode_i32_array(m_buf, m_row_index);
+    pad(m_buf);
+  }
+
+  encode_i32_array(m_buf, m_family_offsets);
+  m_buf.add_unchecked(m_families.data(), m_families.size());
+  pad(m_buf);
+  encode_i32_array(m_buf, m_family_index);
+  pad(m_buf);
+
+  encode_i32_array(m_buf, m_qualifier_offsets);
+  m_buf.add_unchecked(m_qualifiers.data(), m_qualifiers.size());
+  pad(m_buf);
+
+  encode_i64_array(m_buf, m_timestamps);
+
+  if (!m_cell_flags.empty())
+    m_buf.add_unchecked(&m_cell_flags[0], m_cell_flags.size());
+  pad(m_buf);
+
+  encode_i32_array(m_buf, m_value_offsets);
+  m_buf.add_unchecked(m_values.data(), m_values.size());
+
+  HT_ASSERT(m_buf.fill() <= m_buf.size);
+  m_finalized = true;
+}
+
+
+void ColumnarCellsWriter::clear() {
+  m_buf.clear();
+  m_count = 0;
+  m_length = ColumnarCellsVersion::HEADER_LENGTH;
+  m_finalized = false;
+  m_row_offsets.assign(1, 0);
+  m_row_index.clear();
+  m_rows.clear();
+  m_family_offsets.assign(1, 0);
+  m_family_index.clear();
+  m_families.clear();
+  m_qualifier_offsets.assign(1, 0);
+  m_qualifiers.clear();
+  m_timestamps.clear();
+  m_cell_flags.clear();
+  m_value_offsets.assign(1, 0);
+  m_values.clear();
+}
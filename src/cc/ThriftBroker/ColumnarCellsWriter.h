@@ -0,0 +1,112 @@
+/**
+ * Copyright (C) 2007-2013 Hypertable, Inc.
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Hypertable. If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HYPERTABLE_COLUMNARCELLSWRITER_H
+#define HYPERTABLE_COLUMNARCELLSWRITER_H
+
+#include <vector>
+
+#include "Common/DynamicBuffer.h"
+#include "Common/String.h"
+
+#include "Hypertable/Lib/Cell.h"
+#include "Hypertable/Lib/KeySpec.h"
+
+#include "ColumnarCellsFlag.h"
+
+namespace Hypertable {
+
+  /**
+   * Builds a columnar batch of cells (see ColumnarCellsFlag.h for the
+   * layout).  Cells are buffered per column and laid out contiguously by
+   * finalize(), so the batch can only be read after it has been finalized.
+   */
+  class ColumnarCellsWriter {
+  public:
+
+    /**
+     * @param size Soft limit on the encoded batch size; add() refuses cells
+     *        beyond it once the batch is non-empty.  0 means no limit
+     * @param row_dictionary Store each distinct row key once, with a per
+     *        cell index into the row keys
+     */
+    ColumnarCellsWriter(int32_t size, bool row_dictionary = true)
+      : m_limit(size), m_row_dictionary(row_dictionary), m_count(0),
+        m_length(ColumnarCellsVersion::HEADER_LENGTH), m_finalized(false) {
+      clear();
+    }
+
+    bool add(Cell &cell) {
+      return add(cell.row_key, cell.column_family, cell.column_qualifier,
+                 cell.timestamp, cell.value, cell.value_len, cell.flag);
+    }
+
+    bool add(const char *row, const char *column_family,
+             const char *column_qualifier, int64_t timestamp,
+             const void *value, int32_t value_length,
+             uint8_t cell_flag = FLAG_INSERT);
+
+    void finalize(uint8_t flag);
+
+    uint8_t *get_buffer() { return m_buf.base; }
+    int32_t get_buffer_length() { return m_buf.fill(); }
+
+    void get_buffer(const uint8_t **bufp, int32_t *lenp) {
+      if (!m_finalized)
+        finalize(0);
+      *bufp = m_buf.base;
+      *lenp = m_buf.fill();
+    }
+
+    int32_t size() { return m_count; }
+    bool empty() { return m_count == 0; }
+
+    void clear();
+
+  private:
+    int32_t add_family(const char *column_family, int32_t length);
+
+    int32_t m_limit;
+    bool m_row_dictionary;
+    int32_t m_count;
+    size_t m_length;
+    bool m_finalized;
+    DynamicBuffer m_buf;
+
+    std::vector<int32_t> m_row_offsets;
+    std::vector<int32_t> m_row_index;
+    String m_rows;
+
+    std::vector<int32_t> m_family_offsets;
+    std::vector<int32_t> m_family_index;
+    String m_families;
+
+    std::vector<int32_t> m_qualifier_offsets;
+    String m_qualifiers;
+
+    std::vector<int64_t> m_timestamps;
+    std::vector<uint8_t> m_cell_flags;
+
+    std::vector<int32_t> m_value_offsets;
+    String m_values;
+  };
+
+}
+
+#endif // HYPERTABLE_COLUMNARCELLSWRITER_H
@@ -54,10 +54,13 @@ void init_thrift_broker_options() {
     ("pidfile", str(), "File to contain the process id")
     ("log-api", boo()->default_value(false), "Enable or disable API logging")
     ("workers", i32()->default_value(50), "Worker threads")
+    ("nonblocking", boo()->default_value(false), "Use the non-blocking "
+        "server with a fixed pool of worker threads")
     ;
   alias("port", "ThriftBroker.Port");
   alias("log-api", "ThriftBroker.API.Logging");
   alias("workers", "ThriftBroker.Workers");
+  alias("nonblocking", "ThriftBroker.NonBlocking");
   // hidden aliases
   alias("thrift-timeout", "ThriftBroker.Timeout");
 }
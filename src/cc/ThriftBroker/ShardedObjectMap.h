@@ -0,0 +1,106 @@
+/**
+ * Copyright (C) 2007-2013 Hypertable, Inc.
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Hypertable. If not, see <http://www.gnu.org/licenses/>
+ */
+
+#ifndef HYPERTABLE_SHARDEDOBJECTMAP_H
+#define HYPERTABLE_SHARDEDOBJECTMAP_H
+
+#include <unordered_map>
+#include <vector>
+
+#include "Common/Mutex.h"
+
+#include "Hypertable/Lib/ClientObject.h"
+
+namespace Hypertable {
+
+  /** Client object map split into independently locked shards.  All
+   * connections from one remote peer share a ServerHandler, so with a single
+   * map lock every next_cells() call from that host would serialize on it.
+   */
+  class ShardedObjectMap {
+  public:
+    typedef std::unordered_map< ::int64_t, ClientObjectPtr> ObjectMap;
+
+    /**
+     * @param shard_count Number of shards; 0 is treated as 1
+     */
+    ShardedObjectMap(size_t shard_count)
+      : m_shards(shard_count ? shard_count : 1) { }
+
+    ClientObject *get(int64_t id) {
+      Shard &shard = m_shards[shard_index(id)];
+      ScopedLock lock(shard.mutex);
+      ObjectMap::iterator it = shard.map.find(id);
+      return (it != shard.map.end()) ? it->second.get() : 0;
+    }
+
+    /** Inserts <code>co</code> under <code>id</code> unless present.
+     * @return <i>true</i> if inserted, <i>false</i> if id already in use
+     */
+    bool insert(int64_t id, ClientObjectPtr &co) {
+      Shard &shard = m_shards[shard_index(id)];
+      ScopedLock lock(shard.mutex);
+      return shard.map.insert(std::make_pair(id, co)).second;
+    }
+
+    /** Removes <code>id</code>, handing the object back through
+     * <code>item</code> so the caller destroys it outside the shard lock.
+     */
+    bool remove(int64_t id, ClientObjectPtr &item) {
+      Shard &shard = m_shards[shard_index(id)];
+      ScopedLock lock(shard.mutex);
+      ObjectMap::iterator it = shard.map.find(id);
+      if (it == shard.map.end())
+        return false;
+      item = it->second;
+      shard.map.erase(it);
+      return true;
+    }
+
+    size_t size() {
+      size_t total = 0;
+      for (size_t i=0; i<m_shards.size(); i++) {
+        ScopedLock lock(m_shards[i].mutex);
+        total += m_shards[i].map.size();
+      }
+      return total;
+    }
+
+    size_t shard_count() const { return m_shards.size(); }
+
+    /** Returns the shard holding <code>id</code>.
+     */
+    size_t shard_index(int64_t id) const {
+      // object ids are mostly pointers; mix so alignment bits don't matter
+      ::uint64_t h = (::uint64_t)id * 0x9E3779B97F4A7C15ULL;
+      return (h >> 32) % m_shards.size();
+    }
+
+  private:
+    struct Shard {
+      Mutex mutex;
+      ObjectMap map;
+    };
+
+    std::vector<Shard> m_shards;
+  };
+
+}
+
+#endif // HYPERTABLE_SHARDEDOBJECTMAP_H
@@ -18,9 +18,11 @@
  */
 #include <Common/Compat.h>
 
+#include <ThriftBroker/ColumnarCellsWriter.h>
 #include <ThriftBroker/Config.h>
 #include <ThriftBroker/SerializedCellsReader.h>
 #include <ThriftBroker/SerializedCellsWriter.h>
+#include <ThriftBroker/ShardedObjectMap.h>
 #include <ThriftBroker/ThriftHelper.h>
 
 #include <HyperAppHelper/Unique.h>
@@ -38,8 +40,10 @@
 #include <Common/Random.h>
 #include <Common/Time.h>
 
+#include <concurrency/PosixThreadFactory.h>
 #include <concurrency/ThreadManager.h>
 #include <protocol/TBinaryProtocol.h>
+#include <server/TNonblockingServer.h>
 #include <server/TThreadedServer.h>
 #include <transport/TBufferTransports.h>
 #include <transport/TServerSocket.h>
@@ -168,7 +172,6 @@ inline bool operator < (const SharedMutatorMapKey &skey1,
 typedef Meta::list<ThriftBrokerPolicy, DefaultCommPolicy> Policies;
 
 typedef std::map<SharedMutatorMapKey, TableMutator * > SharedMutatorMap;
-typedef std::unordered_map< ::int64_t, ClientObjectPtr> ObjectMap;
 typedef std::vector<ThriftGen::Cell> ThriftCells;
 typedef std::vector<CellAsArray> ThriftCellsAsArrays;
 
@@ -179,6 +182,7 @@ public:
     log_api = Config::get_bool("ThriftBroker.API.Logging");
     next_threshold = Config::get_i32("ThriftBroker.NextThreshold");
     future_capacity = Config::get_i32("ThriftBroker.Future.Capacity");
+    object_map_shards = Config::get_i32("ThriftBroker.ObjectMap.Shards");
   }
   Hypertable::Client *client;
   Mutex shared_mutator_mutex;
@@ -186,6 +190,7 @@ public:
   bool log_api;
   ::uint32_t next_threshold;
   ::uint32_t future_capacity;
+  ::uint32_t object_map_shards;
 };
 
 int64_t
@@ -557,15 +562,16 @@ class ServerHandler : public HqlServiceIf {
 public:
 
   ServerHandler(const String& remote_peer, Context &c)
-    : m_remote_peer(remote_peer), m_context(c) {
+    : m_remote_peer(remote_peer), m_context(c),
+      m_object_map(c.object_map_shards),
+      m_cached_object_map(c.object_map_shards) {
   }
 
   virtual ~ServerHandler() {
-    ScopedLock lock(m_mutex);
-    if (!m_object_map.empty())
+    size_t count = m_object_map.size();
+    if (count)
       HT_WARNF("Destroying ServerHandler for remote peer %s with %d objects in map",
-               m_remote_peer.c_str(),
-               (int)m_object_map.size());
+               m_remote_peer.c_str(), (int)count);
   }
 
   const String& remote_peer() const {
@@ -844,6 +850,36 @@ public:
     scanner_get_cells_serialized(result, scanner_id);
   }
 
+  virtual void scanner_get_cells_columnar(CellsColumnar &result,
+          const Scanner scanner_id) {
+    LOG_API_START("scanner="<< scanner_id);
+
+    try {
+      ColumnarCellsWriter writer(m_context.next_threshold);
+      Hypertable::Cell cell;
+      uint8_t flag = 0;
+
+      TableScanner *scanner = get_scanner(scanner_id);
+
+      while (1) {
+        if (scanner->next(cell)) {
+          if (!writer.add(cell)) {
+            scanner->unget(cell);
+            break;
+          }
+        }
+        else {
+          flag = ColumnarCellsFlag::EOS;
+          break;
+        }
+      }
+
+      writer.finalize(flag);
+      result = String((char *)writer.get_buffer(), writer.get_buffer_length());
+    } RETHROW("scanner="<< scanner_id);
+    LOG_API_FINISH_E("result.size="<< result.size());
+  }
+
   virtual void scanner_get_row(ThriftCells &result, const Scanner scanner_id) {
     LOG_API_START("scanner="<< scanner_id <<" result.size="<< result.size());
     try {
@@ -2151,15 +2187,11 @@ public:
   }
 
   ClientObject *get_object(int64_t id) {
-    ScopedLock lock(m_mutex);
-    ObjectMap::iterator it = m_object_map.find(id);
-    return (it != m_object_map.end()) ? it->second.get() : 0;
+    return m_object_map.get(id);
   }
 
   ClientObject *get_cached_object(int64_t id) {
-    ScopedLock lock(m_mutex);
-    ObjectMap::iterator it = m_cached_object_map.find(id);
-    return (it != m_cached_object_map.end()) ? it->second.get() : 0;
+    return m_cached_object_map.get(id);
   }
 
   Hypertable::Future *get_future(int64_t id) {
@@ -2185,15 +2217,14 @@ public:
 
   int64_t get_cached_object_id(ClientObjectPtr co) {
     int64_t id;
-    ScopedLock lock(m_mutex);
-    while (!m_cached_object_map.insert(make_pair(id = Random::number32(), co)).second || id == 0); // no overwrite
+    while ((id = Random::number32()) == 0 ||
+           !m_cached_object_map.insert(id, co)); // no overwrite
     return id;
   }
 
   int64_t get_object_id(ClientObjectPtr co) {
-    ScopedLock lock(m_mutex);
     int64_t id = reinterpret_cast<int64_t>(co.get());
-    m_object_map.insert(make_pair(id, co)); // no overwrite
+    m_object_map.insert(id, co); // no overwrite
     return id;
   }
 
@@ -2221,34 +2252,14 @@ public:
 
   bool remove_object(int64_t id) {
     // destroy client object unlocked
-    bool removed = false;
     ClientObjectPtr item;
-    {
-      ScopedLock lock(m_mutex);
-      ObjectMap::iterator it = m_object_map.find(id);
-      if (it != m_object_map.end()) {
-        item = (*it).second;
-        m_object_map.erase(it);
-        removed = true;
-      }
-    }
-    return removed;
+    return m_object_map.remove(id, item);
   }
 
   bool remove_cached_object(int64_t id) {
     // destroy client object unlocked
-    bool removed = false;
     ClientObjectPtr item;
-    {
-      ScopedLock lock(m_mutex);
-      ObjectMap::iterator it = m_cached_object_map.find(id);
-      if (it != m_cached_object_map.end()) {
-        item = (*it).second;
-        m_cached_object_map.erase(it);
-        removed = true;
-      }
-    }
-    return removed;
+    return m_cached_object_map.remove(id, item);
   }
 
   void remove_scanner(int64_t id) {
@@ -2361,9 +2372,8 @@ public:
 private:
   String m_remote_peer;
   Context &m_context;
-  Mutex m_mutex;
-  ObjectMap m_object_map;
-  ObjectMap m_cached_object_map;
+  ShardedObjectMap m_object_map;
+  ShardedObjectMap m_cached_object_map;
 };
 
 template <class ResultT, class CellT>
@@ -2470,8 +2480,8 @@ public:
 
   virtual HqlServiceIf* getHandler(const ::apache::thrift::TConnectionInfo& connInfo) {
     typedef ::apache::thrift::transport::TSocket TTransport;
-    String remotePeer =
-      dynamic_cast<TTransport*>(connInfo.transport.get())->getPeerAddress();
+    TTransport *socket = dynamic_cast<TTransport*>(connInfo.transport.get());
+    String remotePeer = socket ? socket->getPeerAddress() : String("unknown");
 
     return ServerHandlerFactory::getHandler(remotePeer);
   }
@@ -2506,6 +2516,26 @@ int main(int argc, char **argv) {
     boost::shared_ptr<HqlServiceIfFactory> hql_service_factory(new ThriftBrokerIfFactory());
     boost::shared_ptr<TProcessorFactory> hql_service_processor_factory(new HqlServiceProcessorFactory(hql_service_factory));
 
+    if (get_bool("ThriftBroker.NonBlocking")) {
+      // A few I/O threads multiplex all connections and hand complete
+      // (framed) requests to a bounded worker pool, instead of dedicating
+      // a thread to every idle application connection
+      int workers = get_i32("workers");
+      boost::shared_ptr<ThreadManager> thread_manager =
+        ThreadManager::newSimpleThreadManager(workers);
+      boost::shared_ptr<PosixThreadFactory> thread_factory(new PosixThreadFactory());
+      thread_manager->threadFactory(thread_factory);
+      thread_manager->start();
+
+      TNonblockingServer server(hql_service_processor_factory, protocolFactory,
+                                port, thread_manager);
+
+      HT_INFOF("Starting the non-blocking server with %d workers...", workers);
+      server.serve();
+      HT_INFO("Exiting.\n");
+      return 0;
+    }
+
     boost::shared_ptr<TServerTransport> serverTransport;
 
     if (has("thrift-timeout")) {
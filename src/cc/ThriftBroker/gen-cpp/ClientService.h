@@ -58,6 +58,7 @@ class ClientServiceIf {
   virtual void next_cells_as_arrays(std::vector<CellAsArray> & _return, const Scanner scanner) = 0;
   virtual void scanner_get_cells_serialized(CellsSerialized& _return, const Scanner scanner) = 0;
   virtual void next_cells_serialized(CellsSerialized& _return, const Scanner scanner) = 0;
+  virtual void scanner_get_cells_columnar(CellsColumnar& _return, const Scanner scanner) = 0;
   virtual void scanner_get_row(std::vector<Cell> & _return, const Scanner scanner) = 0;
   virtual void next_row(std::vector<Cell> & _return, const Scanner scanner) = 0;
   virtual void scanner_get_row_as_arrays(std::vector<CellAsArray> & _return, const Scanner scanner) = 0;
@@ -311,6 +312,9 @@ class ClientServiceNull : virtual public ClientServiceIf {
   void next_cells_serialized(CellsSerialized& /* _return */, const Scanner /* scanner */) {
     return;
   }
+  void scanner_get_cells_columnar(CellsColumnar& /* _return */, const Scanner /* scanner */) {
+    return;
+  }
   void scanner_get_row(std::vector<Cell> & /* _return */, const Scanner /* scanner */) {
     return;
   }
@@ -5679,6 +5683,124 @@ class ClientService_next_cells_serialized_presult {
 
 };
 
+typedef struct _ClientService_scanner_get_cells_columnar_args__isset {
+  _ClientService_scanner_get_cells_columnar_args__isset() : scanner(false) {}
+  bool scanner;
+} _ClientService_scanner_get_cells_columnar_args__isset;
+
+class ClientService_scanner_get_cells_columnar_args {
+ public:
+
+  ClientService_scanner_get_cells_columnar_args() : scanner(0) {
+  }
+
+  virtual ~ClientService_scanner_get_cells_columnar_args() throw() {}
+
+  Scanner scanner;
+
+  _ClientService_scanner_get_cells_columnar_args__isset __isset;
+
+  void __set_scanner(const Scanner val) {
+    scanner = val;
+  }
+
+  bool operator == (const ClientService_scanner_get_cells_columnar_args & rhs) const
+  {
+    if (!(scanner == rhs.scanner))
+      return false;
+    return true;
+  }
+  bool operator != (const ClientService_scanner_get_cells_columnar_args &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const ClientService_scanner_get_cells_columnar_args & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+
+class ClientService_scanner_get_cells_columnar_pargs {
+ public:
+
+
+  virtual ~ClientService_scanner_get_cells_columnar_pargs() throw() {}
+
+  const Scanner* scanner;
+
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _ClientService_scanner_get_cells_columnar_result__isset {
+  _ClientService_scanner_get_cells_columnar_result__isset() : success(false), e(false) {}
+  bool success;
+  bool e;
+} _ClientService_scanner_get_cells_columnar_result__isset;
+
+class ClientService_scanner_get_cells_columnar_result {
+ public:
+
+  ClientService_scanner_get_cells_columnar_result() : success("") {
+  }
+
+  virtual ~ClientService_scanner_get_cells_columnar_result() throw() {}
+
+  CellsColumnar success;
+  ClientException e;
+
+  _ClientService_scanner_get_cells_columnar_result__isset __isset;
+
+  void __set_success(const CellsColumnar& val) {
+    success = val;
+  }
+
+  void __set_e(const ClientException& val) {
+    e = val;
+  }
+
+  bool operator == (const ClientService_scanner_get_cells_columnar_result & rhs) const
+  {
+    if (!(success == rhs.success))
+      return false;
+    if (!(e == rhs.e))
+      return false;
+    return true;
+  }
+  bool operator != (const ClientService_scanner_get_cells_columnar_result &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const ClientService_scanner_get_cells_columnar_result & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _ClientService_scanner_get_cells_columnar_presult__isset {
+  _ClientService_scanner_get_cells_columnar_presult__isset() : success(false), e(false) {}
+  bool success;
+  bool e;
+} _ClientService_scanner_get_cells_columnar_presult__isset;
+
+class ClientService_scanner_get_cells_columnar_presult {
+ public:
+
+
+  virtual ~ClientService_scanner_get_cells_columnar_presult() throw() {}
+
+  CellsColumnar* success;
+  ClientException e;
+
+  _ClientService_scanner_get_cells_columnar_presult__isset __isset;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+
+};
+
 typedef struct _ClientService_scanner_get_row_args__isset {
   _ClientService_scanner_get_row_args__isset() : scanner(false) {}
   bool scanner;
@@ -16100,6 +16222,9 @@ class ClientServiceClient : virtual public ClientServiceIf {
   void next_cells_serialized(CellsSerialized& _return, const Scanner scanner);
   void send_next_cells_serialized(const Scanner scanner);
   void recv_next_cells_serialized(CellsSerialized& _return);
+  void scanner_get_cells_columnar(CellsColumnar& _return, const Scanner scanner);
+  void send_scanner_get_cells_columnar(const Scanner scanner);
+  void recv_scanner_get_cells_columnar(CellsColumnar& _return);
   void scanner_get_row(std::vector<Cell> & _return, const Scanner scanner);
   void send_scanner_get_row(const Scanner scanner);
   void recv_scanner_get_row(std::vector<Cell> & _return);
@@ -16405,6 +16530,7 @@ class ClientServiceProcessor : public ::apache::thrift::TProcessor {
   void process_next_cells_as_arrays(int32_t seqid, apache::thrift::protocol::TProtocol* iprot, apache::thrift::protocol::TProtocol* oprot, void* callContext);
   void process_scanner_get_cells_serialized(int32_t seqid, apache::thrift::protocol::TProtocol* iprot, apache::thrift::protocol::TProtocol* oprot, void* callContext);
   void process_next_cells_serialized(int32_t seqid, apache::thrift::protocol::TProtocol* iprot, apache::thrift::protocol::TProtocol* oprot, void* callContext);
+  void process_scanner_get_cells_columnar(int32_t seqid, apache::thrift::protocol::TProtocol* iprot, apache::thrift::protocol::TProtocol* oprot, void* callContext);
   void process_scanner_get_row(int32_t seqid, apache::thrift::protocol::TProtocol* iprot, apache::thrift::protocol::TProtocol* oprot, void* callContext);
   void process_next_row(int32_t seqid, apache::thrift::protocol::TProtocol* iprot, apache::thrift::protocol::TProtocol* oprot, void* callContext);
   void process_scanner_get_row_as_arrays(int32_t seqid, apache::thrift::protocol::TProtocol* iprot, apache::thrift::protocol::TProtocol* oprot, void* callContext);
@@ -16534,6 +16660,7 @@ class ClientServiceProcessor : public ::apache::thrift::TProcessor {
     processMap_["next_cells_as_arrays"] = &ClientServiceProcessor::process_next_cells_as_arrays;
     processMap_["scanner_get_cells_serialized"] = &ClientServiceProcessor::process_scanner_get_cells_serialized;
     processMap_["next_cells_serialized"] = &ClientServiceProcessor::process_next_cells_serialized;
+    processMap_["scanner_get_cells_columnar"] = &ClientServiceProcessor::process_scanner_get_cells_columnar;
     processMap_["scanner_get_row"] = &ClientServiceProcessor::process_scanner_get_row;
     processMap_["next_row"] = &ClientServiceProcessor::process_next_row;
     processMap_["scanner_get_row_as_arrays"] = &ClientServiceProcessor::process_scanner_get_row_as_arrays;
@@ -17055,6 +17182,18 @@ class ClientServiceMultiface : virtual public ClientServiceIf {
     }
   }
 
+  void scanner_get_cells_columnar(CellsColumnar& _return, const Scanner scanner) {
+    size_t sz = ifaces_.size();
+    for (size_t i = 0; i < sz; ++i) {
+      if (i == sz - 1) {
+        ifaces_[i]->scanner_get_cells_columnar(_return, scanner);
+        return;
+      } else {
+        ifaces_[i]->scanner_get_cells_columnar(_return, scanner);
+      }
+    }
+  }
+
   void scanner_get_row(std::vector<Cell> & _return, const Scanner scanner) {
     size_t sz = ifaces_.size();
     for (size_t i = 0; i < sz; ++i) {
@@ -237,6 +237,11 @@ class ClientServiceHandler : virtual public ClientServiceIf {
     printf("next_cells_serialized\n");
   }
 
+  void scanner_get_cells_columnar(CellsColumnar& _return, const Scanner scanner) {
+    // Your implementation goes here
+    printf("scanner_get_cells_columnar\n");
+  }
+
   void scanner_get_row(std::vector<Cell> & _return, const Scanner scanner) {
     // Your implementation goes here
     printf("scanner_get_row\n");
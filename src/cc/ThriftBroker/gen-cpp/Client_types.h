@@ -64,6 +64,8 @@ typedef std::vector<std::string>  CellAsArray;
 
 typedef std::string CellsSerialized;
 
+typedef std::string CellsColumnar;
+
 typedef struct _RowInterval__isset {
   _RowInterval__isset() : start_row(false), start_inclusive(false), end_row(false), end_inclusive(false) {}
   bool start_row;
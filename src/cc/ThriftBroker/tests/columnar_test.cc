@@ -0,0 +1,170 @@
+/** -*- C++ -*-
+ * Copyright (C) 2007-2013 Hypertable, Inc.
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Hypertable. If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "Common/Compat.h"
+#include "Common/Error.h"
+#include "Common/Logger.h"
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "ThriftBroker/ColumnarCellsReader.h"
+#include "ThriftBroker/ColumnarCellsWriter.h"
+
+using namespace Hypertable;
+using namespace std;
+
+/**
+ * Round trips cells through ColumnarCellsWriter/ColumnarCellsReader, with
+ * and without the row key dictionary.  Does not need a running ThriftBroker.
+ */
+
+namespace {
+
+  struct TestCell {
+    string row;
+    string family;
+    string qualifier;
+    int64_t timestamp;
+    string value;
+    uint8_t flag;
+  };
+
+  void make_cells(vector<TestCell> &cells) {
+    const char *families[] = { "a", "bb", "" };
+    char buf[32];
+    for (int i=0; i<1000; i++) {
+      TestCell tc;
+      sprintf(buf, "row%05d", i/7);
+      tc.row = buf;
+      tc.flag = FLAG_INSERT;
+      tc.family = families[i%2];
+      if (i % 100 == 99) {
+        tc.family = families[2];
+        tc.flag = FLAG_DELETE_ROW;
+      }
+      sprintf(buf, "q%d", i%3);
+      tc.qualifier = (i % 5) ? buf : "";
+      tc.timestamp = 1000000LL * i;
+      tc.value = string(i % 13, 'v');
+      cells.push_back(tc);
+    }
+  }
+
+  void check(ColumnarCellsReader &reader, const vector<TestCell> &cells,
+             size_t start) {
+    Cell cell;
+    for (int32_t i=0; i<reader.size(); i++) {
+      const TestCell &tc = cells[start + i];
+      reader.get(i, cell);
+      HT_ASSERT(tc.row == cell.row_key);
+      HT_ASSERT(reader.row_len(i) == tc.row.length());
+      if (tc.flag == FLAG_DELETE_ROW)
+        HT_ASSERT(cell.column_family == 0);
+      else
+        HT_ASSERT(tc.family == cell.column_family);
+      HT_ASSERT(tc.qualifier == cell.column_qualifier);
+      HT_ASSERT(reader.column_qualifier_len(i) == tc.qualifier.length());
+      HT_ASSERT(tc.timestamp == cell.timestamp);
+      HT_ASSERT(cell.value_len == tc.value.length());
+      HT_ASSERT(!memcmp(cell.value, tc.value.data(), cell.value_len));
+      HT_ASSERT(tc.flag == cell.flag);
+    }
+  }
+
+  void test_round_trip(const vector<TestCell> &cells, bool dictionary,
+                       int32_t limit) {
+    ColumnarCellsWriter writer(limit, dictionary);
+    size_t next = 0;
+    size_t batches = 0;
+
+    while (next < cells.size()) {
+      size_t start = next;
+      writer.clear();
+      while (next < cells.size()) {
+        const TestCell &tc = cells[next];
+        if (!writer.add(tc.row.c_str(), tc.family.c_str(),
+                        tc.qualifier.c_str(), tc.timestamp,
+                        tc.value.data(), tc.value.length(), tc.flag))
+          break;
+        next++;
+      }
+      writer.finalize(next == cells.size() ? ColumnarCellsFlag::EOS : 0);
+      HT_ASSERT(limit == 0 || writer.get_buffer_length() <= limit);
+
+      string buf((char *)writer.get_buffer(), writer.get_buffer_length());
+      ColumnarCellsReader reader(buf.data(), buf.length());
+      HT_ASSERT(reader.size() == (int32_t)(next - start));
+      HT_ASSERT(reader.eos() == (next == cells.size()));
+      if (dictionary)
+        HT_ASSERT(reader.row_count() < reader.size());
+      else
+        HT_ASSERT(reader.row_count() == reader.size());
+      check(reader, cells, start);
+      batches++;
+    }
+    HT_ASSERT(limit == 0 || batches > 1);
+  }
+
+  void test_empty() {
+    ColumnarCellsWriter writer(1024);
+    writer.finalize(ColumnarCellsFlag::EOS);
+    ColumnarCellsReader reader(writer.get_buffer(),
+                               writer.get_buffer_length());
+    HT_ASSERT(reader.size() == 0);
+    HT_ASSERT(reader.eos());
+  }
+
+  void test_truncated(const vector<TestCell> &cells) {
+    ColumnarCellsWriter writer(0);
+    for (size_t i=0; i<10; i++)
+      writer.add(cells[i].row.c_str(), cells[i].family.c_str(),
+                 cells[i].qualifier.c_str(), cells[i].timestamp,
+                 cells[i].value.data(), cells[i].value.length());
+    writer.finalize(ColumnarCellsFlag::EOS);
+    for (int32_t len=0; len<writer.get_buffer_length(); len += 7) {
+      try {
+        ColumnarCellsReader reader(writer.get_buffer(), len);
+        HT_ASSERT(!"truncated buffer accepted");
+      }
+      catch (Exception &e) {
+        HT_ASSERT(e.code() == Error::SERIALIZATION_INPUT_OVERRUN ||
+                  e.code() == Error::BAD_FORMAT);
+      }
+    }
+  }
+
+}
+
+
+int main(int argc, char **argv) {
+  vector<TestCell> cells;
+
+  make_cells(cells);
+
+  test_empty();
+  test_round_trip(cells, true, 0);
+  test_round_trip(cells, false, 0);
+  test_round_trip(cells, true, 4096);
+  test_round_trip(cells, false, 4096);
+  test_truncated(cells);
+
+  return 0;
+}
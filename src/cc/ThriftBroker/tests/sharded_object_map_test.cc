@@ -0,0 +1,181 @@
+/**
+ * Copyright (C) 2007-2013 Hypertable, Inc.
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 3
+ * of the License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Hypertable. If not, see <http://www.gnu.org/licenses/>
+ */
+
+#include "Common/Compat.h"
+#include <iostream>
+#include <vector>
+
+#include <boost/bind.hpp>
+
+#include "Common/Logger.h"
+#include "Common/Thread.h"
+
+#include "ThriftBroker/ShardedObjectMap.h"
+
+using namespace Hypertable;
+using namespace std;
+
+#define SHARD_COUNT 16
+#define THREAD_COUNT 8
+#define OBJECTS_PER_THREAD 5000
+
+namespace {
+
+  /// Counts live objects so leaks and double frees show up
+  class TestObject : public ClientObject {
+  public:
+    TestObject(int64_t i) : id(i) { ++ms_live; }
+    virtual ~TestObject() { --ms_live; }
+    int64_t id;
+    static int ms_live;
+  };
+
+  int TestObject::ms_live = 0;
+
+  int64_t object_id(ClientObject *co) {
+    return dynamic_cast<TestObject *>(co)->id;
+  }
+
+  /// Inserts, looks up and removes ids that only this thread uses
+  void exercise(ShardedObjectMap *map, std::vector<ClientObjectPtr> *objects,
+                bool *ok) {
+    *ok = true;
+    for (size_t i=0; i<objects->size(); i++) {
+      ClientObject *co = (*objects)[i].get();
+      if (!map->insert((int64_t)co, (*objects)[i]) ||
+          map->get((int64_t)co) != co)
+        *ok = false;
+    }
+    for (size_t i=0; i<objects->size(); i+=2) {
+      ClientObjectPtr item;
+      ClientObject *co = (*objects)[i].get();
+      if (!map->remove((int64_t)co, item) || item.get() != co ||
+          map->get((int64_t)co) != 0)
+        *ok = false;
+    }
+  }
+
+}
+
+
+int main(int argc, char **argv) {
+
+  // Ids shaped like the object pointers the broker uses are spread over
+  // all shards, and every id always maps to the same shard
+  {
+    ShardedObjectMap map(SHARD_COUNT);
+    HT_ASSERT(map.shard_count() == SHARD_COUNT);
+    size_t per_shard[SHARD_COUNT] = { 0 };
+    for (int64_t i=0; i<16000; i++) {
+      int64_t id = 0x7f3a10000000LL + i * 64;
+      size_t shard = map.shard_index(id);
+      HT_ASSERT(shard < SHARD_COUNT);
+      HT_ASSERT(shard == map.shard_index(id));
+      per_shard[shard]++;
+    }
+    for (size_t i=0; i<SHARD_COUNT; i++)
+      HT_ASSERT(per_shard[i] > 500 && per_shard[i] < 1500);
+
+    ShardedObjectMap unsharded(0);
+    HT_ASSERT(unsharded.shard_count() == 1);
+    HT_ASSERT(unsharded.shard_index(12345) == 0);
+  }
+
+  // put/get/remove across shards
+  {
+    ShardedObjectMap map(SHARD_COUNT);
+    std::vector<ClientObjectPtr> objects;
+    std::vector<bool> shard_used(SHARD_COUNT, false);
+
+    for (int64_t id=1; id<=1000; id++) {
+      objects.push_back(new TestObject(id));
+      HT_ASSERT(map.insert(id, objects.back()));
+      shard_used[map.shard_index(id)] = true;
+    }
+    for (size_t i=0; i<SHARD_COUNT; i++)
+      HT_ASSERT(shard_used[i]);
+    HT_ASSERT(map.size() == 1000);
+
+    for (int64_t id=1; id<=1000; id++) {
+      ClientObject *co = map.get(id);
+      HT_ASSERT(co == objects[id-1].get());
+      HT_ASSERT(object_id(co) == id);
+    }
+    HT_ASSERT(map.get(0) == 0);
+    HT_ASSERT(map.get(1001) == 0);
+
+    // An id in use is not overwritten
+    ClientObjectPtr other = new TestObject(-1);
+    HT_ASSERT(!map.insert(500, other));
+    HT_ASSERT(object_id(map.get(500)) == 500);
+    HT_ASSERT(map.size() == 1000);
+
+    // Removal hands the object back and leaves the other ids alone
+    for (int64_t id=1; id<=1000; id+=3) {
+      ClientObjectPtr item;
+      HT_ASSERT(map.remove(id, item));
+      HT_ASSERT(item.get() == objects[id-1].get());
+      HT_ASSERT(map.get(id) == 0);
+      ClientObjectPtr again;
+      HT_ASSERT(!map.remove(id, again));
+      HT_ASSERT(!again);
+    }
+    HT_ASSERT(map.size() == 1000 - 334);
+    for (int64_t id=1; id<=1000; id++)
+      HT_ASSERT((map.get(id) == 0) == ((id - 1) % 3 == 0));
+
+    // A removed id can be reused
+    HT_ASSERT(map.insert(1, other));
+    HT_ASSERT(map.get(1) == other.get());
+
+    objects.clear();
+    other = 0;
+  }
+  // The map held the last references
+  HT_ASSERT(TestObject::ms_live == 0);
+
+  // Concurrent users on disjoint ids
+  {
+    ShardedObjectMap map(SHARD_COUNT);
+    std::vector<std::vector<ClientObjectPtr> > objects(THREAD_COUNT);
+    bool ok[THREAD_COUNT];
+    ThreadGroup threads;
+
+    for (size_t t=0; t<THREAD_COUNT; t++) {
+      for (size_t i=0; i<OBJECTS_PER_THREAD; i++)
+        objects[t].push_back(new TestObject(t * OBJECTS_PER_THREAD + i));
+      threads.create_thread(boost::bind(exercise, &map, &objects[t], &ok[t]));
+    }
+    threads.join_all();
+
+    for (size_t t=0; t<THREAD_COUNT; t++) {
+      HT_ASSERT(ok[t]);
+      for (size_t i=0; i<OBJECTS_PER_THREAD; i++) {
+        ClientObject *co = objects[t][i].get();
+        HT_ASSERT(map.get((int64_t)co) == ((i % 2) ? co : 0));
+      }
+    }
+    HT_ASSERT(map.size() == THREAD_COUNT * (OBJECTS_PER_THREAD / 2));
+    objects.clear();
+  }
+  HT_ASSERT(TestObject::ms_live == 0);
+
+  cout << "SUCCESS" << endl;
+  return 0;
+}
@@ -291,6 +291,14 @@ public class ClientService {
 
     public ByteBuffer next_cells_serialized(long scanner) throws ClientException, org.apache.thrift.TException;
 
+    /**
+     * Alternative interface returning a columnar batch of cells, which can
+     * be consumed without constructing an object per cell
+     * 
+     * @param scanner
+     */
+    public ByteBuffer scanner_get_cells_columnar(long scanner) throws ClientException, org.apache.thrift.TException;
+
     /**
      * Iterate over rows of a scanner
      * 
@@ -1080,6 +1088,8 @@ public class ClientService {
 
     public void next_cells_serialized(long scanner, org.apache.thrift.async.AsyncMethodCallback<AsyncClient.next_cells_serialized_call> resultHandler) throws org.apache.thrift.TException;
 
+    public void scanner_get_cells_columnar(long scanner, org.apache.thrift.async.AsyncMethodCallback<AsyncClient.scanner_get_cells_columnar_call> resultHandler) throws org.apache.thrift.TException;
+
     public void scanner_get_row(long scanner, org.apache.thrift.async.AsyncMethodCallback<AsyncClient.scanner_get_row_call> resultHandler) throws org.apache.thrift.TException;
 
     public void next_row(long scanner, org.apache.thrift.async.AsyncMethodCallback<AsyncClient.next_row_call> resultHandler) throws org.apache.thrift.TException;
@@ -2354,6 +2364,32 @@ public class ClientService {
       throw new org.apache.thrift.TApplicationException(org.apache.thrift.TApplicationException.MISSING_RESULT, "next_cells_serialized failed: unknown result");
     }
 
+    public ByteBuffer scanner_get_cells_columnar(long scanner) throws ClientException, org.apache.thrift.TException
+    {
+      send_scanner_get_cells_columnar(scanner);
+      return recv_scanner_get_cells_columnar();
+    }
+
+    public void send_scanner_get_cells_columnar(long scanner) throws org.apache.thrift.TException
+    {
+      scanner_get_cells_columnar_args args = new scanner_get_cells_columnar_args();
+      args.setScanner(scanner);
+      sendBase("scanner_get_cells_columnar", args);
+    }
+
+    public ByteBuffer recv_scanner_get_cells_columnar() throws ClientException, org.apache.thrift.TException
+    {
+      scanner_get_cells_columnar_result result = new scanner_get_cells_columnar_result();
+      receiveBase(result, "scanner_get_cells_columnar");
+      if (result.isSetSuccess()) {
+        return result.success;
+      }
+      if (result.e != null) {
+        throw result.e;
+      }
+      throw new org.apache.thrift.TApplicationException(org.apache.thrift.TApplicationException.MISSING_RESULT, "scanner_get_cells_columnar failed: unknown result");
+    }
+
     public List<Cell> scanner_get_row(long scanner) throws ClientException, org.apache.thrift.TException
     {
       send_scanner_get_row(scanner);
@@ -5944,6 +5980,38 @@ public class ClientService {
       }
     }
 
+    public void scanner_get_cells_columnar(long scanner, org.apache.thrift.async.AsyncMethodCallback<scanner_get_cells_columnar_call> resultHandler) throws org.apache.thrift.TException {
+      checkReady();
+      scanner_get_cells_columnar_call method_call = new scanner_get_cells_columnar_call(scanner, resultHandler, this, ___protocolFactory, ___transport);
+      this.___currentMethod = method_call;
+      ___manager.call(method_call);
+    }
+
+    public static class scanner_get_cells_columnar_call extends org.apache.thrift.async.TAsyncMethodCall {
+      private long scanner;
+      public scanner_get_cells_columnar_call(long scanner, org.apache.thrift.async.AsyncMethodCallback<scanner_get_cells_columnar_call> resultHandler, org.apache.thrift.async.TAsyncClient client, org.apache.thrift.protocol.TProtocolFactory protocolFactory, org.apache.thrift.transport.TNonblockingTransport transport) throws org.apache.thrift.TException {
+        super(client, protocolFactory, transport, resultHandler, false);
+        this.scanner = scanner;
+      }
+
+      public void write_args(org.apache.thrift.protocol.TProtocol prot) throws org.apache.thrift.TException {
+        prot.writeMessageBegin(new org.apache.thrift.protocol.TMessage("scanner_get_cells_columnar", org.apache.thrift.protocol.TMessageType.CALL, 0));
+        scanner_get_cells_columnar_args args = new scanner_get_cells_columnar_args();
+        args.setScanner(scanner);
+        args.write(prot);
+        prot.writeMessageEnd();
+      }
+
+      public ByteBuffer getResult() throws ClientException, org.apache.thrift.TException {
+        if (getState() != org.apache.thrift.async.TAsyncMethodCall.State.RESPONSE_READ) {
+          throw new IllegalStateException("Method call not finished!");
+        }
+        org.apache.thrift.transport.TMemoryInputTransport memoryTransport = new org.apache.thrift.transport.TMemoryInputTransport(getFrameBuffer().array());
+        org.apache.thrift.protocol.TProtocol prot = client.getProtocolFactory().getProtocol(memoryTransport);
+        return (new Client(prot)).recv_scanner_get_cells_columnar();
+      }
+    }
+
     public void scanner_get_row(long scanner, org.apache.thrift.async.AsyncMethodCallback<scanner_get_row_call> resultHandler) throws org.apache.thrift.TException {
       checkReady();
       scanner_get_row_call method_call = new scanner_get_row_call(scanner, resultHandler, this, ___protocolFactory, ___transport);
@@ -8977,6 +9045,7 @@ public class ClientService {
       processMap.put("next_cells_as_arrays", new next_cells_as_arrays());
       processMap.put("scanner_get_cells_serialized", new scanner_get_cells_serialized());
       processMap.put("next_cells_serialized", new next_cells_serialized());
+      processMap.put("scanner_get_cells_columnar", new scanner_get_cells_columnar());
       processMap.put("scanner_get_row", new scanner_get_row());
       processMap.put("next_row", new next_row());
       processMap.put("scanner_get_row_as_arrays", new scanner_get_row_as_arrays());
@@ -9935,6 +10004,26 @@ public class ClientService {
       }
     }
 
+    private static class scanner_get_cells_columnar<I extends Iface> extends org.apache.thrift.ProcessFunction<I, scanner_get_cells_columnar_args> {
+      public scanner_get_cells_columnar() {
+        super("scanner_get_cells_columnar");
+      }
+
+      protected scanner_get_cells_columnar_args getEmptyArgsInstance() {
+        return new scanner_get_cells_columnar_args();
+      }
+
+      protected scanner_get_cells_columnar_result getResult(I iface, scanner_get_cells_columnar_args args) throws org.apache.thrift.TException {
+        scanner_get_cells_columnar_result result = new scanner_get_cells_columnar_result();
+        try {
+          result.success = iface.scanner_get_cells_columnar(args.scanner);
+        } catch (ClientException e) {
+          result.e = e;
+        }
+        return result;
+      }
+    }
+
     private static class scanner_get_row<I extends Iface> extends org.apache.thrift.ProcessFunction<I, scanner_get_row_args> {
       public scanner_get_row() {
         super("scanner_get_row");
@@ -37479,14 +37568,770 @@ public class ClientService {
 
     public void setFieldValue(_Fields field, Object value) {
       switch (field) {
-      case SUCCESS:
-        if (value == null) {
-          unsetSuccess();
-        } else {
-          setSuccess((Long)value);
-        }
-        break;
-
+      case SUCCESS:
+        if (value == null) {
+          unsetSuccess();
+        } else {
+          setSuccess((Long)value);
+        }
+        break;
+
+      case E:
+        if (value == null) {
+          unsetE();
+        } else {
+          setE((ClientException)value);
+        }
+        break;
+
+      }
+    }
+
+    public Object getFieldValue(_Fields field) {
+      switch (field) {
+      case SUCCESS:
+        return Long.valueOf(getSuccess());
+
+      case E:
+        return getE();
+
+      }
+      throw new IllegalStateException();
+    }
+
+    /** Returns true if field corresponding to fieldID is set (has been assigned a value) and false otherwise */
+    public boolean isSet(_Fields field) {
+      if (field == null) {
+        throw new IllegalArgumentException();
+      }
+
+      switch (field) {
+      case SUCCESS:
+        return isSetSuccess();
+      case E:
+        return isSetE();
+      }
+      throw new IllegalStateException();
+    }
+
+    @Override
+    public boolean equals(Object that) {
+      if (that == null)
+        return false;
+      if (that instanceof open_scanner_async_result)
+        return this.equals((open_scanner_async_result)that);
+      return false;
+    }
+
+    public boolean equals(open_scanner_async_result that) {
+      if (that == null)
+        return false;
+
+      boolean this_present_success = true;
+      boolean that_present_success = true;
+      if (this_present_success || that_present_success) {
+        if (!(this_present_success && that_present_success))
+          return false;
+        if (this.success != that.success)
+          return false;
+      }
+
+      boolean this_present_e = true && this.isSetE();
+      boolean that_present_e = true && that.isSetE();
+      if (this_present_e || that_present_e) {
+        if (!(this_present_e && that_present_e))
+          return false;
+        if (!this.e.equals(that.e))
+          return false;
+      }
+
+      return true;
+    }
+
+    @Override
+    public int hashCode() {
+      return 0;
+    }
+
+    public int compareTo(open_scanner_async_result other) {
+      if (!getClass().equals(other.getClass())) {
+        return getClass().getName().compareTo(other.getClass().getName());
+      }
+
+      int lastComparison = 0;
+      open_scanner_async_result typedOther = (open_scanner_async_result)other;
+
+      lastComparison = Boolean.valueOf(isSetSuccess()).compareTo(typedOther.isSetSuccess());
+      if (lastComparison != 0) {
+        return lastComparison;
+      }
+      if (isSetSuccess()) {
+        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.success, typedOther.success);
+        if (lastComparison != 0) {
+          return lastComparison;
+        }
+      }
+      lastComparison = Boolean.valueOf(isSetE()).compareTo(typedOther.isSetE());
+      if (lastComparison != 0) {
+        return lastComparison;
+      }
+      if (isSetE()) {
+        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.e, typedOther.e);
+        if (lastComparison != 0) {
+          return lastComparison;
+        }
+      }
+      return 0;
+    }
+
+    public _Fields fieldForId(int fieldId) {
+      return _Fields.findByThriftId(fieldId);
+    }
+
+    public void read(org.apache.thrift.protocol.TProtocol iprot) throws org.apache.thrift.TException {
+      schemes.get(iprot.getScheme()).getScheme().read(iprot, this);
+    }
+
+    public void write(org.apache.thrift.protocol.TProtocol oprot) throws org.apache.thrift.TException {
+      schemes.get(oprot.getScheme()).getScheme().write(oprot, this);
+      }
+
+    @Override
+    public String toString() {
+      StringBuilder sb = new StringBuilder("open_scanner_async_result(");
+      boolean first = true;
+
+      sb.append("success:");
+      sb.append(this.success);
+      first = false;
+      if (!first) sb.append(", ");
+      sb.append("e:");
+      if (this.e == null) {
+        sb.append("null");
+      } else {
+        sb.append(this.e);
+      }
+      first = false;
+      sb.append(")");
+      return sb.toString();
+    }
+
+    public void validate() throws org.apache.thrift.TException {
+      // check for required fields
+    }
+
+    private void writeObject(java.io.ObjectOutputStream out) throws java.io.IOException {
+      try {
+        write(new org.apache.thrift.protocol.TCompactProtocol(new org.apache.thrift.transport.TIOStreamTransport(out)));
+      } catch (org.apache.thrift.TException te) {
+        throw new java.io.IOException(te);
+      }
+    }
+
+    private void readObject(java.io.ObjectInputStream in) throws java.io.IOException, ClassNotFoundException {
+      try {
+        read(new org.apache.thrift.protocol.TCompactProtocol(new org.apache.thrift.transport.TIOStreamTransport(in)));
+      } catch (org.apache.thrift.TException te) {
+        throw new java.io.IOException(te);
+      }
+    }
+
+    private static class open_scanner_async_resultStandardSchemeFactory implements SchemeFactory {
+      public open_scanner_async_resultStandardScheme getScheme() {
+        return new open_scanner_async_resultStandardScheme();
+      }
+    }
+
+    private static class open_scanner_async_resultStandardScheme extends StandardScheme<open_scanner_async_result> {
+
+      public void read(org.apache.thrift.protocol.TProtocol iprot, open_scanner_async_result struct) throws org.apache.thrift.TException {
+        org.apache.thrift.protocol.TField schemeField;
+        iprot.readStructBegin();
+        while (true)
+        {
+          schemeField = iprot.readFieldBegin();
+          if (schemeField.type == org.apache.thrift.protocol.TType.STOP) { 
+            break;
+          }
+          switch (schemeField.id) {
+            case 0: // SUCCESS
+              if (schemeField.type == org.apache.thrift.protocol.TType.I64) {
+                struct.success = iprot.readI64();
+                struct.setSuccessIsSet(true);
+              } else { 
+                org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
+              }
+              break;
+            case 1: // E
+              if (schemeField.type == org.apache.thrift.protocol.TType.STRUCT) {
+                struct.e = new ClientException();
+                struct.e.read(iprot);
+                struct.setEIsSet(true);
+              } else { 
+                org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
+              }
+              break;
+            default:
+              org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
+          }
+          iprot.readFieldEnd();
+        }
+        iprot.readStructEnd();
+
+        // check for required fields of primitive type, which can't be checked in the validate method
+        struct.validate();
+      }
+
+      public void write(org.apache.thrift.protocol.TProtocol oprot, open_scanner_async_result struct) throws org.apache.thrift.TException {
+        struct.validate();
+
+        oprot.writeStructBegin(STRUCT_DESC);
+        oprot.writeFieldBegin(SUCCESS_FIELD_DESC);
+        oprot.writeI64(struct.success);
+        oprot.writeFieldEnd();
+        if (struct.e != null) {
+          oprot.writeFieldBegin(E_FIELD_DESC);
+          struct.e.write(oprot);
+          oprot.writeFieldEnd();
+        }
+        oprot.writeFieldStop();
+        oprot.writeStructEnd();
+      }
+
+    }
+
+    private static class open_scanner_async_resultTupleSchemeFactory implements SchemeFactory {
+      public open_scanner_async_resultTupleScheme getScheme() {
+        return new open_scanner_async_resultTupleScheme();
+      }
+    }
+
+    private static class open_scanner_async_resultTupleScheme extends TupleScheme<open_scanner_async_result> {
+
+      @Override
+      public void write(org.apache.thrift.protocol.TProtocol prot, open_scanner_async_result struct) throws org.apache.thrift.TException {
+        TTupleProtocol oprot = (TTupleProtocol) prot;
+        BitSet optionals = new BitSet();
+        if (struct.isSetSuccess()) {
+          optionals.set(0);
+        }
+        if (struct.isSetE()) {
+          optionals.set(1);
+        }
+        oprot.writeBitSet(optionals, 2);
+        if (struct.isSetSuccess()) {
+          oprot.writeI64(struct.success);
+        }
+        if (struct.isSetE()) {
+          struct.e.write(oprot);
+        }
+      }
+
+      @Override
+      public void read(org.apache.thrift.protocol.TProtocol prot, open_scanner_async_result struct) throws org.apache.thrift.TException {
+        TTupleProtocol iprot = (TTupleProtocol) prot;
+        BitSet incoming = iprot.readBitSet(2);
+        if (incoming.get(0)) {
+          struct.success = iprot.readI64();
+          struct.setSuccessIsSet(true);
+        }
+        if (incoming.get(1)) {
+          struct.e = new ClientException();
+          struct.e.read(iprot);
+          struct.setEIsSet(true);
+        }
+      }
+    }
+
+  }
+
+  public static class scanner_close_args implements org.apache.thrift.TBase<scanner_close_args, scanner_close_args._Fields>, java.io.Serializable, Cloneable   {
+    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("scanner_close_args");
+
+    private static final org.apache.thrift.protocol.TField SCANNER_FIELD_DESC = new org.apache.thrift.protocol.TField("scanner", org.apache.thrift.protocol.TType.I64, (short)1);
+
+    private static final Map<Class<? extends IScheme>, SchemeFactory> schemes = new HashMap<Class<? extends IScheme>, SchemeFactory>();
+    static {
+      schemes.put(StandardScheme.class, new scanner_close_argsStandardSchemeFactory());
+      schemes.put(TupleScheme.class, new scanner_close_argsTupleSchemeFactory());
+    }
+
+    public long scanner; // required
+
+    /** The set of fields this struct contains, along with convenience methods for finding and manipulating them. */
+    public enum _Fields implements org.apache.thrift.TFieldIdEnum {
+      SCANNER((short)1, "scanner");
+
+      private static final Map<String, _Fields> byName = new HashMap<String, _Fields>();
+
+      static {
+        for (_Fields field : EnumSet.allOf(_Fields.class)) {
+          byName.put(field.getFieldName(), field);
+        }
+      }
+
+      /**
+       * Find the _Fields constant that matches fieldId, or null if its not found.
+       */
+      public static _Fields findByThriftId(int fieldId) {
+        switch(fieldId) {
+          case 1: // SCANNER
+            return SCANNER;
+          default:
+            return null;
+        }
+      }
+
+      /**
+       * Find the _Fields constant that matches fieldId, throwing an exception
+       * if it is not found.
+       */
+      public static _Fields findByThriftIdOrThrow(int fieldId) {
+        _Fields fields = findByThriftId(fieldId);
+        if (fields == null) throw new IllegalArgumentException("Field " + fieldId + " doesn't exist!");
+        return fields;
+      }
+
+      /**
+       * Find the _Fields constant that matches name, or null if its not found.
+       */
+      public static _Fields findByName(String name) {
+        return byName.get(name);
+      }
+
+      private final short _thriftId;
+      private final String _fieldName;
+
+      _Fields(short thriftId, String fieldName) {
+        _thriftId = thriftId;
+        _fieldName = fieldName;
+      }
+
+      public short getThriftFieldId() {
+        return _thriftId;
+      }
+
+      public String getFieldName() {
+        return _fieldName;
+      }
+    }
+
+    // isset id assignments
+    private static final int __SCANNER_ISSET_ID = 0;
+    private BitSet __isset_bit_vector = new BitSet(1);
+    public static final Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> metaDataMap;
+    static {
+      Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> tmpMap = new EnumMap<_Fields, org.apache.thrift.meta_data.FieldMetaData>(_Fields.class);
+      tmpMap.put(_Fields.SCANNER, new org.apache.thrift.meta_data.FieldMetaData("scanner", org.apache.thrift.TFieldRequirementType.DEFAULT, 
+          new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.I64          , "Scanner")));
+      metaDataMap = Collections.unmodifiableMap(tmpMap);
+      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(scanner_close_args.class, metaDataMap);
+    }
+
+    public scanner_close_args() {
+    }
+
+    public scanner_close_args(
+      long scanner)
+    {
+      this();
+      this.scanner = scanner;
+      setScannerIsSet(true);
+    }
+
+    /**
+     * Performs a deep copy on <i>other</i>.
+     */
+    public scanner_close_args(scanner_close_args other) {
+      __isset_bit_vector.clear();
+      __isset_bit_vector.or(other.__isset_bit_vector);
+      this.scanner = other.scanner;
+    }
+
+    public scanner_close_args deepCopy() {
+      return new scanner_close_args(this);
+    }
+
+    @Override
+    public void clear() {
+      setScannerIsSet(false);
+      this.scanner = 0;
+    }
+
+    public long getScanner() {
+      return this.scanner;
+    }
+
+    public scanner_close_args setScanner(long scanner) {
+      this.scanner = scanner;
+      setScannerIsSet(true);
+      return this;
+    }
+
+    public void unsetScanner() {
+      __isset_bit_vector.clear(__SCANNER_ISSET_ID);
+    }
+
+    /** Returns true if field scanner is set (has been assigned a value) and false otherwise */
+    public boolean isSetScanner() {
+      return __isset_bit_vector.get(__SCANNER_ISSET_ID);
+    }
+
+    public void setScannerIsSet(boolean value) {
+      __isset_bit_vector.set(__SCANNER_ISSET_ID, value);
+    }
+
+    public void setFieldValue(_Fields field, Object value) {
+      switch (field) {
+      case SCANNER:
+        if (value == null) {
+          unsetScanner();
+        } else {
+          setScanner((Long)value);
+        }
+        break;
+
+      }
+    }
+
+    public Object getFieldValue(_Fields field) {
+      switch (field) {
+      case SCANNER:
+        return Long.valueOf(getScanner());
+
+      }
+      throw new IllegalStateException();
+    }
+
+    /** Returns true if field corresponding to fieldID is set (has been assigned a value) and false otherwise */
+    public boolean isSet(_Fields field) {
+      if (field == null) {
+        throw new IllegalArgumentException();
+      }
+
+      switch (field) {
+      case SCANNER:
+        return isSetScanner();
+      }
+      throw new IllegalStateException();
+    }
+
+    @Override
+    public boolean equals(Object that) {
+      if (that == null)
+        return false;
+      if (that instanceof scanner_close_args)
+        return this.equals((scanner_close_args)that);
+      return false;
+    }
+
+    public boolean equals(scanner_close_args that) {
+      if (that == null)
+        return false;
+
+      boolean this_present_scanner = true;
+      boolean that_present_scanner = true;
+      if (this_present_scanner || that_present_scanner) {
+        if (!(this_present_scanner && that_present_scanner))
+          return false;
+        if (this.scanner != that.scanner)
+          return false;
+      }
+
+      return true;
+    }
+
+    @Override
+    public int hashCode() {
+      return 0;
+    }
+
+    public int compareTo(scanner_close_args other) {
+      if (!getClass().equals(other.getClass())) {
+        return getClass().getName().compareTo(other.getClass().getName());
+      }
+
+      int lastComparison = 0;
+      scanner_close_args typedOther = (scanner_close_args)other;
+
+      lastComparison = Boolean.valueOf(isSetScanner()).compareTo(typedOther.isSetScanner());
+      if (lastComparison != 0) {
+        return lastComparison;
+      }
+      if (isSetScanner()) {
+        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.scanner, typedOther.scanner);
+        if (lastComparison != 0) {
+          return lastComparison;
+        }
+      }
+      return 0;
+    }
+
+    public _Fields fieldForId(int fieldId) {
+      return _Fields.findByThriftId(fieldId);
+    }
+
+    public void read(org.apache.thrift.protocol.TProtocol iprot) throws org.apache.thrift.TException {
+      schemes.get(iprot.getScheme()).getScheme().read(iprot, this);
+    }
+
+    public void write(org.apache.thrift.protocol.TProtocol oprot) throws org.apache.thrift.TException {
+      schemes.get(oprot.getScheme()).getScheme().write(oprot, this);
+    }
+
+    @Override
+    public String toString() {
+      StringBuilder sb = new StringBuilder("scanner_close_args(");
+      boolean first = true;
+
+      sb.append("scanner:");
+      sb.append(this.scanner);
+      first = false;
+      sb.append(")");
+      return sb.toString();
+    }
+
+    public void validate() throws org.apache.thrift.TException {
+      // check for required fields
+    }
+
+    private void writeObject(java.io.ObjectOutputStream out) throws java.io.IOException {
+      try {
+        write(new org.apache.thrift.protocol.TCompactProtocol(new org.apache.thrift.transport.TIOStreamTransport(out)));
+      } catch (org.apache.thrift.TException te) {
+        throw new java.io.IOException(te);
+      }
+    }
+
+    private void readObject(java.io.ObjectInputStream in) throws java.io.IOException, ClassNotFoundException {
+      try {
+        // it doesn't seem like you should have to do this, but java serialization is wacky, and doesn't call the default constructor.
+        __isset_bit_vector = new BitSet(1);
+        read(new org.apache.thrift.protocol.TCompactProtocol(new org.apache.thrift.transport.TIOStreamTransport(in)));
+      } catch (org.apache.thrift.TException te) {
+        throw new java.io.IOException(te);
+      }
+    }
+
+    private static class scanner_close_argsStandardSchemeFactory implements SchemeFactory {
+      public scanner_close_argsStandardScheme getScheme() {
+        return new scanner_close_argsStandardScheme();
+      }
+    }
+
+    private static class scanner_close_argsStandardScheme extends StandardScheme<scanner_close_args> {
+
+      public void read(org.apache.thrift.protocol.TProtocol iprot, scanner_close_args struct) throws org.apache.thrift.TException {
+        org.apache.thrift.protocol.TField schemeField;
+        iprot.readStructBegin();
+        while (true)
+        {
+          schemeField = iprot.readFieldBegin();
+          if (schemeField.type == org.apache.thrift.protocol.TType.STOP) { 
+            break;
+          }
+          switch (schemeField.id) {
+            case 1: // SCANNER
+              if (schemeField.type == org.apache.thrift.protocol.TType.I64) {
+                struct.scanner = iprot.readI64();
+                struct.setScannerIsSet(true);
+              } else { 
+                org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
+              }
+              break;
+            default:
+              org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
+          }
+          iprot.readFieldEnd();
+        }
+        iprot.readStructEnd();
+
+        // check for required fields of primitive type, which can't be checked in the validate method
+        struct.validate();
+      }
+
+      public void write(org.apache.thrift.protocol.TProtocol oprot, scanner_close_args struct) throws org.apache.thrift.TException {
+        struct.validate();
+
+        oprot.writeStructBegin(STRUCT_DESC);
+        oprot.writeFieldBegin(SCANNER_FIELD_DESC);
+        oprot.writeI64(struct.scanner);
+        oprot.writeFieldEnd();
+        oprot.writeFieldStop();
+        oprot.writeStructEnd();
+      }
+
+    }
+
+    private static class scanner_close_argsTupleSchemeFactory implements SchemeFactory {
+      public scanner_close_argsTupleScheme getScheme() {
+        return new scanner_close_argsTupleScheme();
+      }
+    }
+
+    private static class scanner_close_argsTupleScheme extends TupleScheme<scanner_close_args> {
+
+      @Override
+      public void write(org.apache.thrift.protocol.TProtocol prot, scanner_close_args struct) throws org.apache.thrift.TException {
+        TTupleProtocol oprot = (TTupleProtocol) prot;
+        BitSet optionals = new BitSet();
+        if (struct.isSetScanner()) {
+          optionals.set(0);
+        }
+        oprot.writeBitSet(optionals, 1);
+        if (struct.isSetScanner()) {
+          oprot.writeI64(struct.scanner);
+        }
+      }
+
+      @Override
+      public void read(org.apache.thrift.protocol.TProtocol prot, scanner_close_args struct) throws org.apache.thrift.TException {
+        TTupleProtocol iprot = (TTupleProtocol) prot;
+        BitSet incoming = iprot.readBitSet(1);
+        if (incoming.get(0)) {
+          struct.scanner = iprot.readI64();
+          struct.setScannerIsSet(true);
+        }
+      }
+    }
+
+  }
+
+  public static class scanner_close_result implements org.apache.thrift.TBase<scanner_close_result, scanner_close_result._Fields>, java.io.Serializable, Cloneable   {
+    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("scanner_close_result");
+
+    private static final org.apache.thrift.protocol.TField E_FIELD_DESC = new org.apache.thrift.protocol.TField("e", org.apache.thrift.protocol.TType.STRUCT, (short)1);
+
+    private static final Map<Class<? extends IScheme>, SchemeFactory> schemes = new HashMap<Class<? extends IScheme>, SchemeFactory>();
+    static {
+      schemes.put(StandardScheme.class, new scanner_close_resultStandardSchemeFactory());
+      schemes.put(TupleScheme.class, new scanner_close_resultTupleSchemeFactory());
+    }
+
+    public ClientException e; // required
+
+    /** The set of fields this struct contains, along with convenience methods for finding and manipulating them. */
+    public enum _Fields implements org.apache.thrift.TFieldIdEnum {
+      E((short)1, "e");
+
+      private static final Map<String, _Fields> byName = new HashMap<String, _Fields>();
+
+      static {
+        for (_Fields field : EnumSet.allOf(_Fields.class)) {
+          byName.put(field.getFieldName(), field);
+        }
+      }
+
+      /**
+       * Find the _Fields constant that matches fieldId, or null if its not found.
+       */
+      public static _Fields findByThriftId(int fieldId) {
+        switch(fieldId) {
+          case 1: // E
+            return E;
+          default:
+            return null;
+        }
+      }
+
+      /**
+       * Find the _Fields constant that matches fieldId, throwing an exception
+       * if it is not found.
+       */
+      public static _Fields findByThriftIdOrThrow(int fieldId) {
+        _Fields fields = findByThriftId(fieldId);
+        if (fields == null) throw new IllegalArgumentException("Field " + fieldId + " doesn't exist!");
+        return fields;
+      }
+
+      /**
+       * Find the _Fields constant that matches name, or null if its not found.
+       */
+      public static _Fields findByName(String name) {
+        return byName.get(name);
+      }
+
+      private final short _thriftId;
+      private final String _fieldName;
+
+      _Fields(short thriftId, String fieldName) {
+        _thriftId = thriftId;
+        _fieldName = fieldName;
+      }
+
+      public short getThriftFieldId() {
+        return _thriftId;
+      }
+
+      public String getFieldName() {
+        return _fieldName;
+      }
+    }
+
+    // isset id assignments
+    public static final Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> metaDataMap;
+    static {
+      Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> tmpMap = new EnumMap<_Fields, org.apache.thrift.meta_data.FieldMetaData>(_Fields.class);
+      tmpMap.put(_Fields.E, new org.apache.thrift.meta_data.FieldMetaData("e", org.apache.thrift.TFieldRequirementType.DEFAULT, 
+          new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.STRUCT)));
+      metaDataMap = Collections.unmodifiableMap(tmpMap);
+      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(scanner_close_result.class, metaDataMap);
+    }
+
+    public scanner_close_result() {
+    }
+
+    public scanner_close_result(
+      ClientException e)
+    {
+      this();
+      this.e = e;
+    }
+
+    /**
+     * Performs a deep copy on <i>other</i>.
+     */
+    public scanner_close_result(scanner_close_result other) {
+      if (other.isSetE()) {
+        this.e = new ClientException(other.e);
+      }
+    }
+
+    public scanner_close_result deepCopy() {
+      return new scanner_close_result(this);
+    }
+
+    @Override
+    public void clear() {
+      this.e = null;
+    }
+
+    public ClientException getE() {
+      return this.e;
+    }
+
+    public scanner_close_result setE(ClientException e) {
+      this.e = e;
+      return this;
+    }
+
+    public void unsetE() {
+      this.e = null;
+    }
+
+    /** Returns true if field e is set (has been assigned a value) and false otherwise */
+    public boolean isSetE() {
+      return this.e != null;
+    }
+
+    public void setEIsSet(boolean value) {
+      if (!value) {
+        this.e = null;
+      }
+    }
+
+    public void setFieldValue(_Fields field, Object value) {
+      switch (field) {
       case E:
         if (value == null) {
           unsetE();
@@ -37500,9 +38345,6 @@ public class ClientService {
 
     public Object getFieldValue(_Fields field) {
       switch (field) {
-      case SUCCESS:
-        return Long.valueOf(getSuccess());
-
       case E:
         return getE();
 
@@ -37517,8 +38359,6 @@ public class ClientService {
       }
 
       switch (field) {
-      case SUCCESS:
-        return isSetSuccess();
       case E:
         return isSetE();
       }
@@ -37529,24 +38369,15 @@ public class ClientService {
     public boolean equals(Object that) {
       if (that == null)
         return false;
-      if (that instanceof open_scanner_async_result)
-        return this.equals((open_scanner_async_result)that);
+      if (that instanceof scanner_close_result)
+        return this.equals((scanner_close_result)that);
       return false;
     }
 
-    public boolean equals(open_scanner_async_result that) {
+    public boolean equals(scanner_close_result that) {
       if (that == null)
         return false;
 
-      boolean this_present_success = true;
-      boolean that_present_success = true;
-      if (this_present_success || that_present_success) {
-        if (!(this_present_success && that_present_success))
-          return false;
-        if (this.success != that.success)
-          return false;
-      }
-
       boolean this_present_e = true && this.isSetE();
       boolean that_present_e = true && that.isSetE();
       if (this_present_e || that_present_e) {
@@ -37564,24 +38395,14 @@ public class ClientService {
       return 0;
     }
 
-    public int compareTo(open_scanner_async_result other) {
+    public int compareTo(scanner_close_result other) {
       if (!getClass().equals(other.getClass())) {
         return getClass().getName().compareTo(other.getClass().getName());
       }
 
       int lastComparison = 0;
-      open_scanner_async_result typedOther = (open_scanner_async_result)other;
+      scanner_close_result typedOther = (scanner_close_result)other;
 
-      lastComparison = Boolean.valueOf(isSetSuccess()).compareTo(typedOther.isSetSuccess());
-      if (lastComparison != 0) {
-        return lastComparison;
-      }
-      if (isSetSuccess()) {
-        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.success, typedOther.success);
-        if (lastComparison != 0) {
-          return lastComparison;
-        }
-      }
       lastComparison = Boolean.valueOf(isSetE()).compareTo(typedOther.isSetE());
       if (lastComparison != 0) {
         return lastComparison;
@@ -37609,13 +38430,9 @@ public class ClientService {
 
     @Override
     public String toString() {
-      StringBuilder sb = new StringBuilder("open_scanner_async_result(");
+      StringBuilder sb = new StringBuilder("scanner_close_result(");
       boolean first = true;
 
-      sb.append("success:");
-      sb.append(this.success);
-      first = false;
-      if (!first) sb.append(", ");
       sb.append("e:");
       if (this.e == null) {
         sb.append("null");
@@ -37647,15 +38464,15 @@ public class ClientService {
       }
     }
 
-    private static class open_scanner_async_resultStandardSchemeFactory implements SchemeFactory {
-      public open_scanner_async_resultStandardScheme getScheme() {
-        return new open_scanner_async_resultStandardScheme();
+    private static class scanner_close_resultStandardSchemeFactory implements SchemeFactory {
+      public scanner_close_resultStandardScheme getScheme() {
+        return new scanner_close_resultStandardScheme();
       }
     }
 
-    private static class open_scanner_async_resultStandardScheme extends StandardScheme<open_scanner_async_result> {
+    private static class scanner_close_resultStandardScheme extends StandardScheme<scanner_close_result> {
 
-      public void read(org.apache.thrift.protocol.TProtocol iprot, open_scanner_async_result struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol iprot, scanner_close_result struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TField schemeField;
         iprot.readStructBegin();
         while (true)
@@ -37665,14 +38482,6 @@ public class ClientService {
             break;
           }
           switch (schemeField.id) {
-            case 0: // SUCCESS
-              if (schemeField.type == org.apache.thrift.protocol.TType.I64) {
-                struct.success = iprot.readI64();
-                struct.setSuccessIsSet(true);
-              } else { 
-                org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
-              }
-              break;
             case 1: // E
               if (schemeField.type == org.apache.thrift.protocol.TType.STRUCT) {
                 struct.e = new ClientException();
@@ -37693,13 +38502,10 @@ public class ClientService {
         struct.validate();
       }
 
-      public void write(org.apache.thrift.protocol.TProtocol oprot, open_scanner_async_result struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol oprot, scanner_close_result struct) throws org.apache.thrift.TException {
         struct.validate();
 
         oprot.writeStructBegin(STRUCT_DESC);
-        oprot.writeFieldBegin(SUCCESS_FIELD_DESC);
-        oprot.writeI64(struct.success);
-        oprot.writeFieldEnd();
         if (struct.e != null) {
           oprot.writeFieldBegin(E_FIELD_DESC);
           struct.e.write(oprot);
@@ -37711,42 +38517,32 @@ public class ClientService {
 
     }
 
-    private static class open_scanner_async_resultTupleSchemeFactory implements SchemeFactory {
-      public open_scanner_async_resultTupleScheme getScheme() {
-        return new open_scanner_async_resultTupleScheme();
+    private static class scanner_close_resultTupleSchemeFactory implements SchemeFactory {
+      public scanner_close_resultTupleScheme getScheme() {
+        return new scanner_close_resultTupleScheme();
       }
     }
 
-    private static class open_scanner_async_resultTupleScheme extends TupleScheme<open_scanner_async_result> {
+    private static class scanner_close_resultTupleScheme extends TupleScheme<scanner_close_result> {
 
       @Override
-      public void write(org.apache.thrift.protocol.TProtocol prot, open_scanner_async_result struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol prot, scanner_close_result struct) throws org.apache.thrift.TException {
         TTupleProtocol oprot = (TTupleProtocol) prot;
         BitSet optionals = new BitSet();
-        if (struct.isSetSuccess()) {
-          optionals.set(0);
-        }
         if (struct.isSetE()) {
-          optionals.set(1);
-        }
-        oprot.writeBitSet(optionals, 2);
-        if (struct.isSetSuccess()) {
-          oprot.writeI64(struct.success);
+          optionals.set(0);
         }
+        oprot.writeBitSet(optionals, 1);
         if (struct.isSetE()) {
           struct.e.write(oprot);
         }
       }
 
       @Override
-      public void read(org.apache.thrift.protocol.TProtocol prot, open_scanner_async_result struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol prot, scanner_close_result struct) throws org.apache.thrift.TException {
         TTupleProtocol iprot = (TTupleProtocol) prot;
-        BitSet incoming = iprot.readBitSet(2);
+        BitSet incoming = iprot.readBitSet(1);
         if (incoming.get(0)) {
-          struct.success = iprot.readI64();
-          struct.setSuccessIsSet(true);
-        }
-        if (incoming.get(1)) {
           struct.e = new ClientException();
           struct.e.read(iprot);
           struct.setEIsSet(true);
@@ -37756,15 +38552,15 @@ public class ClientService {
 
   }
 
-  public static class scanner_close_args implements org.apache.thrift.TBase<scanner_close_args, scanner_close_args._Fields>, java.io.Serializable, Cloneable   {
-    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("scanner_close_args");
+  public static class close_scanner_args implements org.apache.thrift.TBase<close_scanner_args, close_scanner_args._Fields>, java.io.Serializable, Cloneable   {
+    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("close_scanner_args");
 
     private static final org.apache.thrift.protocol.TField SCANNER_FIELD_DESC = new org.apache.thrift.protocol.TField("scanner", org.apache.thrift.protocol.TType.I64, (short)1);
 
     private static final Map<Class<? extends IScheme>, SchemeFactory> schemes = new HashMap<Class<? extends IScheme>, SchemeFactory>();
     static {
-      schemes.put(StandardScheme.class, new scanner_close_argsStandardSchemeFactory());
-      schemes.put(TupleScheme.class, new scanner_close_argsTupleSchemeFactory());
+      schemes.put(StandardScheme.class, new close_scanner_argsStandardSchemeFactory());
+      schemes.put(TupleScheme.class, new close_scanner_argsTupleSchemeFactory());
     }
 
     public long scanner; // required
@@ -37836,13 +38632,13 @@ public class ClientService {
       tmpMap.put(_Fields.SCANNER, new org.apache.thrift.meta_data.FieldMetaData("scanner", org.apache.thrift.TFieldRequirementType.DEFAULT, 
           new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.I64          , "Scanner")));
       metaDataMap = Collections.unmodifiableMap(tmpMap);
-      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(scanner_close_args.class, metaDataMap);
+      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(close_scanner_args.class, metaDataMap);
     }
 
-    public scanner_close_args() {
+    public close_scanner_args() {
     }
 
-    public scanner_close_args(
+    public close_scanner_args(
       long scanner)
     {
       this();
@@ -37853,14 +38649,14 @@ public class ClientService {
     /**
      * Performs a deep copy on <i>other</i>.
      */
-    public scanner_close_args(scanner_close_args other) {
+    public close_scanner_args(close_scanner_args other) {
       __isset_bit_vector.clear();
       __isset_bit_vector.or(other.__isset_bit_vector);
       this.scanner = other.scanner;
     }
 
-    public scanner_close_args deepCopy() {
-      return new scanner_close_args(this);
+    public close_scanner_args deepCopy() {
+      return new close_scanner_args(this);
     }
 
     @Override
@@ -37873,7 +38669,7 @@ public class ClientService {
       return this.scanner;
     }
 
-    public scanner_close_args setScanner(long scanner) {
+    public close_scanner_args setScanner(long scanner) {
       this.scanner = scanner;
       setScannerIsSet(true);
       return this;
@@ -37931,12 +38727,12 @@ public class ClientService {
     public boolean equals(Object that) {
       if (that == null)
         return false;
-      if (that instanceof scanner_close_args)
-        return this.equals((scanner_close_args)that);
+      if (that instanceof close_scanner_args)
+        return this.equals((close_scanner_args)that);
       return false;
     }
 
-    public boolean equals(scanner_close_args that) {
+    public boolean equals(close_scanner_args that) {
       if (that == null)
         return false;
 
@@ -37957,13 +38753,13 @@ public class ClientService {
       return 0;
     }
 
-    public int compareTo(scanner_close_args other) {
+    public int compareTo(close_scanner_args other) {
       if (!getClass().equals(other.getClass())) {
         return getClass().getName().compareTo(other.getClass().getName());
       }
 
       int lastComparison = 0;
-      scanner_close_args typedOther = (scanner_close_args)other;
+      close_scanner_args typedOther = (close_scanner_args)other;
 
       lastComparison = Boolean.valueOf(isSetScanner()).compareTo(typedOther.isSetScanner());
       if (lastComparison != 0) {
@@ -37992,7 +38788,7 @@ public class ClientService {
 
     @Override
     public String toString() {
-      StringBuilder sb = new StringBuilder("scanner_close_args(");
+      StringBuilder sb = new StringBuilder("close_scanner_args(");
       boolean first = true;
 
       sb.append("scanner:");
@@ -38024,15 +38820,15 @@ public class ClientService {
       }
     }
 
-    private static class scanner_close_argsStandardSchemeFactory implements SchemeFactory {
-      public scanner_close_argsStandardScheme getScheme() {
-        return new scanner_close_argsStandardScheme();
+    private static class close_scanner_argsStandardSchemeFactory implements SchemeFactory {
+      public close_scanner_argsStandardScheme getScheme() {
+        return new close_scanner_argsStandardScheme();
       }
     }
 
-    private static class scanner_close_argsStandardScheme extends StandardScheme<scanner_close_args> {
+    private static class close_scanner_argsStandardScheme extends StandardScheme<close_scanner_args> {
 
-      public void read(org.apache.thrift.protocol.TProtocol iprot, scanner_close_args struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol iprot, close_scanner_args struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TField schemeField;
         iprot.readStructBegin();
         while (true)
@@ -38061,7 +38857,7 @@ public class ClientService {
         struct.validate();
       }
 
-      public void write(org.apache.thrift.protocol.TProtocol oprot, scanner_close_args struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol oprot, close_scanner_args struct) throws org.apache.thrift.TException {
         struct.validate();
 
         oprot.writeStructBegin(STRUCT_DESC);
@@ -38074,16 +38870,16 @@ public class ClientService {
 
     }
 
-    private static class scanner_close_argsTupleSchemeFactory implements SchemeFactory {
-      public scanner_close_argsTupleScheme getScheme() {
-        return new scanner_close_argsTupleScheme();
+    private static class close_scanner_argsTupleSchemeFactory implements SchemeFactory {
+      public close_scanner_argsTupleScheme getScheme() {
+        return new close_scanner_argsTupleScheme();
       }
     }
 
-    private static class scanner_close_argsTupleScheme extends TupleScheme<scanner_close_args> {
+    private static class close_scanner_argsTupleScheme extends TupleScheme<close_scanner_args> {
 
       @Override
-      public void write(org.apache.thrift.protocol.TProtocol prot, scanner_close_args struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol prot, close_scanner_args struct) throws org.apache.thrift.TException {
         TTupleProtocol oprot = (TTupleProtocol) prot;
         BitSet optionals = new BitSet();
         if (struct.isSetScanner()) {
@@ -38096,7 +38892,7 @@ public class ClientService {
       }
 
       @Override
-      public void read(org.apache.thrift.protocol.TProtocol prot, scanner_close_args struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol prot, close_scanner_args struct) throws org.apache.thrift.TException {
         TTupleProtocol iprot = (TTupleProtocol) prot;
         BitSet incoming = iprot.readBitSet(1);
         if (incoming.get(0)) {
@@ -38108,15 +38904,15 @@ public class ClientService {
 
   }
 
-  public static class scanner_close_result implements org.apache.thrift.TBase<scanner_close_result, scanner_close_result._Fields>, java.io.Serializable, Cloneable   {
-    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("scanner_close_result");
+  public static class close_scanner_result implements org.apache.thrift.TBase<close_scanner_result, close_scanner_result._Fields>, java.io.Serializable, Cloneable   {
+    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("close_scanner_result");
 
     private static final org.apache.thrift.protocol.TField E_FIELD_DESC = new org.apache.thrift.protocol.TField("e", org.apache.thrift.protocol.TType.STRUCT, (short)1);
 
     private static final Map<Class<? extends IScheme>, SchemeFactory> schemes = new HashMap<Class<? extends IScheme>, SchemeFactory>();
     static {
-      schemes.put(StandardScheme.class, new scanner_close_resultStandardSchemeFactory());
-      schemes.put(TupleScheme.class, new scanner_close_resultTupleSchemeFactory());
+      schemes.put(StandardScheme.class, new close_scanner_resultStandardSchemeFactory());
+      schemes.put(TupleScheme.class, new close_scanner_resultTupleSchemeFactory());
     }
 
     public ClientException e; // required
@@ -38186,13 +38982,13 @@ public class ClientService {
       tmpMap.put(_Fields.E, new org.apache.thrift.meta_data.FieldMetaData("e", org.apache.thrift.TFieldRequirementType.DEFAULT, 
           new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.STRUCT)));
       metaDataMap = Collections.unmodifiableMap(tmpMap);
-      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(scanner_close_result.class, metaDataMap);
+      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(close_scanner_result.class, metaDataMap);
     }
 
-    public scanner_close_result() {
+    public close_scanner_result() {
     }
 
-    public scanner_close_result(
+    public close_scanner_result(
       ClientException e)
     {
       this();
@@ -38202,14 +38998,14 @@ public class ClientService {
     /**
      * Performs a deep copy on <i>other</i>.
      */
-    public scanner_close_result(scanner_close_result other) {
+    public close_scanner_result(close_scanner_result other) {
       if (other.isSetE()) {
         this.e = new ClientException(other.e);
       }
     }
 
-    public scanner_close_result deepCopy() {
-      return new scanner_close_result(this);
+    public close_scanner_result deepCopy() {
+      return new close_scanner_result(this);
     }
 
     @Override
@@ -38221,7 +39017,7 @@ public class ClientService {
       return this.e;
     }
 
-    public scanner_close_result setE(ClientException e) {
+    public close_scanner_result setE(ClientException e) {
       this.e = e;
       return this;
     }
@@ -38280,12 +39076,12 @@ public class ClientService {
     public boolean equals(Object that) {
       if (that == null)
         return false;
-      if (that instanceof scanner_close_result)
-        return this.equals((scanner_close_result)that);
+      if (that instanceof close_scanner_result)
+        return this.equals((close_scanner_result)that);
       return false;
     }
 
-    public boolean equals(scanner_close_result that) {
+    public boolean equals(close_scanner_result that) {
       if (that == null)
         return false;
 
@@ -38306,13 +39102,13 @@ public class ClientService {
       return 0;
     }
 
-    public int compareTo(scanner_close_result other) {
+    public int compareTo(close_scanner_result other) {
       if (!getClass().equals(other.getClass())) {
         return getClass().getName().compareTo(other.getClass().getName());
       }
 
       int lastComparison = 0;
-      scanner_close_result typedOther = (scanner_close_result)other;
+      close_scanner_result typedOther = (close_scanner_result)other;
 
       lastComparison = Boolean.valueOf(isSetE()).compareTo(typedOther.isSetE());
       if (lastComparison != 0) {
@@ -38341,7 +39137,7 @@ public class ClientService {
 
     @Override
     public String toString() {
-      StringBuilder sb = new StringBuilder("scanner_close_result(");
+      StringBuilder sb = new StringBuilder("close_scanner_result(");
       boolean first = true;
 
       sb.append("e:");
@@ -38375,15 +39171,15 @@ public class ClientService {
       }
     }
 
-    private static class scanner_close_resultStandardSchemeFactory implements SchemeFactory {
-      public scanner_close_resultStandardScheme getScheme() {
-        return new scanner_close_resultStandardScheme();
+    private static class close_scanner_resultStandardSchemeFactory implements SchemeFactory {
+      public close_scanner_resultStandardScheme getScheme() {
+        return new close_scanner_resultStandardScheme();
       }
     }
 
-    private static class scanner_close_resultStandardScheme extends StandardScheme<scanner_close_result> {
+    private static class close_scanner_resultStandardScheme extends StandardScheme<close_scanner_result> {
 
-      public void read(org.apache.thrift.protocol.TProtocol iprot, scanner_close_result struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol iprot, close_scanner_result struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TField schemeField;
         iprot.readStructBegin();
         while (true)
@@ -38413,7 +39209,7 @@ public class ClientService {
         struct.validate();
       }
 
-      public void write(org.apache.thrift.protocol.TProtocol oprot, scanner_close_result struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol oprot, close_scanner_result struct) throws org.apache.thrift.TException {
         struct.validate();
 
         oprot.writeStructBegin(STRUCT_DESC);
@@ -38428,16 +39224,16 @@ public class ClientService {
 
     }
 
-    private static class scanner_close_resultTupleSchemeFactory implements SchemeFactory {
-      public scanner_close_resultTupleScheme getScheme() {
-        return new scanner_close_resultTupleScheme();
+    private static class close_scanner_resultTupleSchemeFactory implements SchemeFactory {
+      public close_scanner_resultTupleScheme getScheme() {
+        return new close_scanner_resultTupleScheme();
       }
     }
 
-    private static class scanner_close_resultTupleScheme extends TupleScheme<scanner_close_result> {
+    private static class close_scanner_resultTupleScheme extends TupleScheme<close_scanner_result> {
 
       @Override
-      public void write(org.apache.thrift.protocol.TProtocol prot, scanner_close_result struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol prot, close_scanner_result struct) throws org.apache.thrift.TException {
         TTupleProtocol oprot = (TTupleProtocol) prot;
         BitSet optionals = new BitSet();
         if (struct.isSetE()) {
@@ -38450,7 +39246,7 @@ public class ClientService {
       }
 
       @Override
-      public void read(org.apache.thrift.protocol.TProtocol prot, scanner_close_result struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol prot, close_scanner_result struct) throws org.apache.thrift.TException {
         TTupleProtocol iprot = (TTupleProtocol) prot;
         BitSet incoming = iprot.readBitSet(1);
         if (incoming.get(0)) {
@@ -38463,15 +39259,15 @@ public class ClientService {
 
   }
 
-  public static class close_scanner_args implements org.apache.thrift.TBase<close_scanner_args, close_scanner_args._Fields>, java.io.Serializable, Cloneable   {
-    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("close_scanner_args");
+  public static class async_scanner_cancel_args implements org.apache.thrift.TBase<async_scanner_cancel_args, async_scanner_cancel_args._Fields>, java.io.Serializable, Cloneable   {
+    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("async_scanner_cancel_args");
 
     private static final org.apache.thrift.protocol.TField SCANNER_FIELD_DESC = new org.apache.thrift.protocol.TField("scanner", org.apache.thrift.protocol.TType.I64, (short)1);
 
     private static final Map<Class<? extends IScheme>, SchemeFactory> schemes = new HashMap<Class<? extends IScheme>, SchemeFactory>();
     static {
-      schemes.put(StandardScheme.class, new close_scanner_argsStandardSchemeFactory());
-      schemes.put(TupleScheme.class, new close_scanner_argsTupleSchemeFactory());
+      schemes.put(StandardScheme.class, new async_scanner_cancel_argsStandardSchemeFactory());
+      schemes.put(TupleScheme.class, new async_scanner_cancel_argsTupleSchemeFactory());
     }
 
     public long scanner; // required
@@ -38541,15 +39337,15 @@ public class ClientService {
     static {
       Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> tmpMap = new EnumMap<_Fields, org.apache.thrift.meta_data.FieldMetaData>(_Fields.class);
       tmpMap.put(_Fields.SCANNER, new org.apache.thrift.meta_data.FieldMetaData("scanner", org.apache.thrift.TFieldRequirementType.DEFAULT, 
-          new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.I64          , "Scanner")));
+          new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.I64          , "ScannerAsync")));
       metaDataMap = Collections.unmodifiableMap(tmpMap);
-      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(close_scanner_args.class, metaDataMap);
+      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(async_scanner_cancel_args.class, metaDataMap);
     }
 
-    public close_scanner_args() {
+    public async_scanner_cancel_args() {
     }
 
-    public close_scanner_args(
+    public async_scanner_cancel_args(
       long scanner)
     {
       this();
@@ -38560,14 +39356,14 @@ public class ClientService {
     /**
      * Performs a deep copy on <i>other</i>.
      */
-    public close_scanner_args(close_scanner_args other) {
+    public async_scanner_cancel_args(async_scanner_cancel_args other) {
       __isset_bit_vector.clear();
       __isset_bit_vector.or(other.__isset_bit_vector);
       this.scanner = other.scanner;
     }
 
-    public close_scanner_args deepCopy() {
-      return new close_scanner_args(this);
+    public async_scanner_cancel_args deepCopy() {
+      return new async_scanner_cancel_args(this);
     }
 
     @Override
@@ -38580,7 +39376,7 @@ public class ClientService {
       return this.scanner;
     }
 
-    public close_scanner_args setScanner(long scanner) {
+    public async_scanner_cancel_args setScanner(long scanner) {
       this.scanner = scanner;
       setScannerIsSet(true);
       return this;
@@ -38638,12 +39434,12 @@ public class ClientService {
     public boolean equals(Object that) {
       if (that == null)
         return false;
-      if (that instanceof close_scanner_args)
-        return this.equals((close_scanner_args)that);
+      if (that instanceof async_scanner_cancel_args)
+        return this.equals((async_scanner_cancel_args)that);
       return false;
     }
 
-    public boolean equals(close_scanner_args that) {
+    public boolean equals(async_scanner_cancel_args that) {
       if (that == null)
         return false;
 
@@ -38664,13 +39460,13 @@ public class ClientService {
       return 0;
     }
 
-    public int compareTo(close_scanner_args other) {
+    public int compareTo(async_scanner_cancel_args other) {
       if (!getClass().equals(other.getClass())) {
         return getClass().getName().compareTo(other.getClass().getName());
       }
 
       int lastComparison = 0;
-      close_scanner_args typedOther = (close_scanner_args)other;
+      async_scanner_cancel_args typedOther = (async_scanner_cancel_args)other;
 
       lastComparison = Boolean.valueOf(isSetScanner()).compareTo(typedOther.isSetScanner());
       if (lastComparison != 0) {
@@ -38699,7 +39495,7 @@ public class ClientService {
 
     @Override
     public String toString() {
-      StringBuilder sb = new StringBuilder("close_scanner_args(");
+      StringBuilder sb = new StringBuilder("async_scanner_cancel_args(");
       boolean first = true;
 
       sb.append("scanner:");
@@ -38731,15 +39527,15 @@ public class ClientService {
       }
     }
 
-    private static class close_scanner_argsStandardSchemeFactory implements SchemeFactory {
-      public close_scanner_argsStandardScheme getScheme() {
-        return new close_scanner_argsStandardScheme();
+    private static class async_scanner_cancel_argsStandardSchemeFactory implements SchemeFactory {
+      public async_scanner_cancel_argsStandardScheme getScheme() {
+        return new async_scanner_cancel_argsStandardScheme();
       }
     }
 
-    private static class close_scanner_argsStandardScheme extends StandardScheme<close_scanner_args> {
+    private static class async_scanner_cancel_argsStandardScheme extends StandardScheme<async_scanner_cancel_args> {
 
-      public void read(org.apache.thrift.protocol.TProtocol iprot, close_scanner_args struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol iprot, async_scanner_cancel_args struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TField schemeField;
         iprot.readStructBegin();
         while (true)
@@ -38768,7 +39564,7 @@ public class ClientService {
         struct.validate();
       }
 
-      public void write(org.apache.thrift.protocol.TProtocol oprot, close_scanner_args struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol oprot, async_scanner_cancel_args struct) throws org.apache.thrift.TException {
         struct.validate();
 
         oprot.writeStructBegin(STRUCT_DESC);
@@ -38781,16 +39577,16 @@ public class ClientService {
 
     }
 
-    private static class close_scanner_argsTupleSchemeFactory implements SchemeFactory {
-      public close_scanner_argsTupleScheme getScheme() {
-        return new close_scanner_argsTupleScheme();
+    private static class async_scanner_cancel_argsTupleSchemeFactory implements SchemeFactory {
+      public async_scanner_cancel_argsTupleScheme getScheme() {
+        return new async_scanner_cancel_argsTupleScheme();
       }
     }
 
-    private static class close_scanner_argsTupleScheme extends TupleScheme<close_scanner_args> {
+    private static class async_scanner_cancel_argsTupleScheme extends TupleScheme<async_scanner_cancel_args> {
 
       @Override
-      public void write(org.apache.thrift.protocol.TProtocol prot, close_scanner_args struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol prot, async_scanner_cancel_args struct) throws org.apache.thrift.TException {
         TTupleProtocol oprot = (TTupleProtocol) prot;
         BitSet optionals = new BitSet();
         if (struct.isSetScanner()) {
@@ -38803,7 +39599,7 @@ public class ClientService {
       }
 
       @Override
-      public void read(org.apache.thrift.protocol.TProtocol prot, close_scanner_args struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol prot, async_scanner_cancel_args struct) throws org.apache.thrift.TException {
         TTupleProtocol iprot = (TTupleProtocol) prot;
         BitSet incoming = iprot.readBitSet(1);
         if (incoming.get(0)) {
@@ -38815,15 +39611,15 @@ public class ClientService {
 
   }
 
-  public static class close_scanner_result implements org.apache.thrift.TBase<close_scanner_result, close_scanner_result._Fields>, java.io.Serializable, Cloneable   {
-    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("close_scanner_result");
+  public static class async_scanner_cancel_result implements org.apache.thrift.TBase<async_scanner_cancel_result, async_scanner_cancel_result._Fields>, java.io.Serializable, Cloneable   {
+    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("async_scanner_cancel_result");
 
     private static final org.apache.thrift.protocol.TField E_FIELD_DESC = new org.apache.thrift.protocol.TField("e", org.apache.thrift.protocol.TType.STRUCT, (short)1);
 
     private static final Map<Class<? extends IScheme>, SchemeFactory> schemes = new HashMap<Class<? extends IScheme>, SchemeFactory>();
     static {
-      schemes.put(StandardScheme.class, new close_scanner_resultStandardSchemeFactory());
-      schemes.put(TupleScheme.class, new close_scanner_resultTupleSchemeFactory());
+      schemes.put(StandardScheme.class, new async_scanner_cancel_resultStandardSchemeFactory());
+      schemes.put(TupleScheme.class, new async_scanner_cancel_resultTupleSchemeFactory());
     }
 
     public ClientException e; // required
@@ -38893,13 +39689,13 @@ public class ClientService {
       tmpMap.put(_Fields.E, new org.apache.thrift.meta_data.FieldMetaData("e", org.apache.thrift.TFieldRequirementType.DEFAULT, 
           new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.STRUCT)));
       metaDataMap = Collections.unmodifiableMap(tmpMap);
-      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(close_scanner_result.class, metaDataMap);
+      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(async_scanner_cancel_result.class, metaDataMap);
     }
 
-    public close_scanner_result() {
+    public async_scanner_cancel_result() {
     }
 
-    public close_scanner_result(
+    public async_scanner_cancel_result(
       ClientException e)
     {
       this();
@@ -38909,14 +39705,14 @@ public class ClientService {
     /**
      * Performs a deep copy on <i>other</i>.
      */
-    public close_scanner_result(close_scanner_result other) {
+    public async_scanner_cancel_result(async_scanner_cancel_result other) {
       if (other.isSetE()) {
         this.e = new ClientException(other.e);
       }
     }
 
-    public close_scanner_result deepCopy() {
-      return new close_scanner_result(this);
+    public async_scanner_cancel_result deepCopy() {
+      return new async_scanner_cancel_result(this);
     }
 
     @Override
@@ -38928,7 +39724,7 @@ public class ClientService {
       return this.e;
     }
 
-    public close_scanner_result setE(ClientException e) {
+    public async_scanner_cancel_result setE(ClientException e) {
       this.e = e;
       return this;
     }
@@ -38987,12 +39783,12 @@ public class ClientService {
     public boolean equals(Object that) {
       if (that == null)
         return false;
-      if (that instanceof close_scanner_result)
-        return this.equals((close_scanner_result)that);
+      if (that instanceof async_scanner_cancel_result)
+        return this.equals((async_scanner_cancel_result)that);
       return false;
     }
 
-    public boolean equals(close_scanner_result that) {
+    public boolean equals(async_scanner_cancel_result that) {
       if (that == null)
         return false;
 
@@ -39013,13 +39809,13 @@ public class ClientService {
       return 0;
     }
 
-    public int compareTo(close_scanner_result other) {
+    public int compareTo(async_scanner_cancel_result other) {
       if (!getClass().equals(other.getClass())) {
         return getClass().getName().compareTo(other.getClass().getName());
       }
 
       int lastComparison = 0;
-      close_scanner_result typedOther = (close_scanner_result)other;
+      async_scanner_cancel_result typedOther = (async_scanner_cancel_result)other;
 
       lastComparison = Boolean.valueOf(isSetE()).compareTo(typedOther.isSetE());
       if (lastComparison != 0) {
@@ -39048,7 +39844,7 @@ public class ClientService {
 
     @Override
     public String toString() {
-      StringBuilder sb = new StringBuilder("close_scanner_result(");
+      StringBuilder sb = new StringBuilder("async_scanner_cancel_result(");
       boolean first = true;
 
       sb.append("e:");
@@ -39082,15 +39878,15 @@ public class ClientService {
       }
     }
 
-    private static class close_scanner_resultStandardSchemeFactory implements SchemeFactory {
-      public close_scanner_resultStandardScheme getScheme() {
-        return new close_scanner_resultStandardScheme();
+    private static class async_scanner_cancel_resultStandardSchemeFactory implements SchemeFactory {
+      public async_scanner_cancel_resultStandardScheme getScheme() {
+        return new async_scanner_cancel_resultStandardScheme();
       }
     }
 
-    private static class close_scanner_resultStandardScheme extends StandardScheme<close_scanner_result> {
+    private static class async_scanner_cancel_resultStandardScheme extends StandardScheme<async_scanner_cancel_result> {
 
-      public void read(org.apache.thrift.protocol.TProtocol iprot, close_scanner_result struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol iprot, async_scanner_cancel_result struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TField schemeField;
         iprot.readStructBegin();
         while (true)
@@ -39120,7 +39916,7 @@ public class ClientService {
         struct.validate();
       }
 
-      public void write(org.apache.thrift.protocol.TProtocol oprot, close_scanner_result struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol oprot, async_scanner_cancel_result struct) throws org.apache.thrift.TException {
         struct.validate();
 
         oprot.writeStructBegin(STRUCT_DESC);
@@ -39135,16 +39931,16 @@ public class ClientService {
 
     }
 
-    private static class close_scanner_resultTupleSchemeFactory implements SchemeFactory {
-      public close_scanner_resultTupleScheme getScheme() {
-        return new close_scanner_resultTupleScheme();
+    private static class async_scanner_cancel_resultTupleSchemeFactory implements SchemeFactory {
+      public async_scanner_cancel_resultTupleScheme getScheme() {
+        return new async_scanner_cancel_resultTupleScheme();
       }
     }
 
-    private static class close_scanner_resultTupleScheme extends TupleScheme<close_scanner_result> {
+    private static class async_scanner_cancel_resultTupleScheme extends TupleScheme<async_scanner_cancel_result> {
 
       @Override
-      public void write(org.apache.thrift.protocol.TProtocol prot, close_scanner_result struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol prot, async_scanner_cancel_result struct) throws org.apache.thrift.TException {
         TTupleProtocol oprot = (TTupleProtocol) prot;
         BitSet optionals = new BitSet();
         if (struct.isSetE()) {
@@ -39157,7 +39953,7 @@ public class ClientService {
       }
 
       @Override
-      public void read(org.apache.thrift.protocol.TProtocol prot, close_scanner_result struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol prot, async_scanner_cancel_result struct) throws org.apache.thrift.TException {
         TTupleProtocol iprot = (TTupleProtocol) prot;
         BitSet incoming = iprot.readBitSet(1);
         if (incoming.get(0)) {
@@ -39170,15 +39966,15 @@ public class ClientService {
 
   }
 
-  public static class async_scanner_cancel_args implements org.apache.thrift.TBase<async_scanner_cancel_args, async_scanner_cancel_args._Fields>, java.io.Serializable, Cloneable   {
-    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("async_scanner_cancel_args");
+  public static class cancel_scanner_async_args implements org.apache.thrift.TBase<cancel_scanner_async_args, cancel_scanner_async_args._Fields>, java.io.Serializable, Cloneable   {
+    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("cancel_scanner_async_args");
 
     private static final org.apache.thrift.protocol.TField SCANNER_FIELD_DESC = new org.apache.thrift.protocol.TField("scanner", org.apache.thrift.protocol.TType.I64, (short)1);
 
     private static final Map<Class<? extends IScheme>, SchemeFactory> schemes = new HashMap<Class<? extends IScheme>, SchemeFactory>();
     static {
-      schemes.put(StandardScheme.class, new async_scanner_cancel_argsStandardSchemeFactory());
-      schemes.put(TupleScheme.class, new async_scanner_cancel_argsTupleSchemeFactory());
+      schemes.put(StandardScheme.class, new cancel_scanner_async_argsStandardSchemeFactory());
+      schemes.put(TupleScheme.class, new cancel_scanner_async_argsTupleSchemeFactory());
     }
 
     public long scanner; // required
@@ -39250,13 +40046,13 @@ public class ClientService {
       tmpMap.put(_Fields.SCANNER, new org.apache.thrift.meta_data.FieldMetaData("scanner", org.apache.thrift.TFieldRequirementType.DEFAULT, 
           new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.I64          , "ScannerAsync")));
       metaDataMap = Collections.unmodifiableMap(tmpMap);
-      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(async_scanner_cancel_args.class, metaDataMap);
+      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(cancel_scanner_async_args.class, metaDataMap);
     }
 
-    public async_scanner_cancel_args() {
+    public cancel_scanner_async_args() {
     }
 
-    public async_scanner_cancel_args(
+    public cancel_scanner_async_args(
       long scanner)
     {
       this();
@@ -39267,14 +40063,14 @@ public class ClientService {
     /**
      * Performs a deep copy on <i>other</i>.
      */
-    public async_scanner_cancel_args(async_scanner_cancel_args other) {
+    public cancel_scanner_async_args(cancel_scanner_async_args other) {
       __isset_bit_vector.clear();
       __isset_bit_vector.or(other.__isset_bit_vector);
       this.scanner = other.scanner;
     }
 
-    public async_scanner_cancel_args deepCopy() {
-      return new async_scanner_cancel_args(this);
+    public cancel_scanner_async_args deepCopy() {
+      return new cancel_scanner_async_args(this);
     }
 
     @Override
@@ -39287,7 +40083,7 @@ public class ClientService {
       return this.scanner;
     }
 
-    public async_scanner_cancel_args setScanner(long scanner) {
+    public cancel_scanner_async_args setScanner(long scanner) {
       this.scanner = scanner;
       setScannerIsSet(true);
       return this;
@@ -39345,12 +40141,12 @@ public class ClientService {
     public boolean equals(Object that) {
       if (that == null)
         return false;
-      if (that instanceof async_scanner_cancel_args)
-        return this.equals((async_scanner_cancel_args)that);
+      if (that instanceof cancel_scanner_async_args)
+        return this.equals((cancel_scanner_async_args)that);
       return false;
     }
 
-    public boolean equals(async_scanner_cancel_args that) {
+    public boolean equals(cancel_scanner_async_args that) {
       if (that == null)
         return false;
 
@@ -39371,13 +40167,13 @@ public class ClientService {
       return 0;
     }
 
-    public int compareTo(async_scanner_cancel_args other) {
+    public int compareTo(cancel_scanner_async_args other) {
       if (!getClass().equals(other.getClass())) {
         return getClass().getName().compareTo(other.getClass().getName());
       }
 
       int lastComparison = 0;
-      async_scanner_cancel_args typedOther = (async_scanner_cancel_args)other;
+      cancel_scanner_async_args typedOther = (cancel_scanner_async_args)other;
 
       lastComparison = Boolean.valueOf(isSetScanner()).compareTo(typedOther.isSetScanner());
       if (lastComparison != 0) {
@@ -39406,7 +40202,7 @@ public class ClientService {
 
     @Override
     public String toString() {
-      StringBuilder sb = new StringBuilder("async_scanner_cancel_args(");
+      StringBuilder sb = new StringBuilder("cancel_scanner_async_args(");
       boolean first = true;
 
       sb.append("scanner:");
@@ -39438,15 +40234,15 @@ public class ClientService {
       }
     }
 
-    private static class async_scanner_cancel_argsStandardSchemeFactory implements SchemeFactory {
-      public async_scanner_cancel_argsStandardScheme getScheme() {
-        return new async_scanner_cancel_argsStandardScheme();
+    private static class cancel_scanner_async_argsStandardSchemeFactory implements SchemeFactory {
+      public cancel_scanner_async_argsStandardScheme getScheme() {
+        return new cancel_scanner_async_argsStandardScheme();
       }
     }
 
-    private static class async_scanner_cancel_argsStandardScheme extends StandardScheme<async_scanner_cancel_args> {
+    private static class cancel_scanner_async_argsStandardScheme extends StandardScheme<cancel_scanner_async_args> {
 
-      public void read(org.apache.thrift.protocol.TProtocol iprot, async_scanner_cancel_args struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol iprot, cancel_scanner_async_args struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TField schemeField;
         iprot.readStructBegin();
         while (true)
@@ -39475,7 +40271,7 @@ public class ClientService {
         struct.validate();
       }
 
-      public void write(org.apache.thrift.protocol.TProtocol oprot, async_scanner_cancel_args struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol oprot, cancel_scanner_async_args struct) throws org.apache.thrift.TException {
         struct.validate();
 
         oprot.writeStructBegin(STRUCT_DESC);
@@ -39488,16 +40284,16 @@ public class ClientService {
 
     }
 
-    private static class async_scanner_cancel_argsTupleSchemeFactory implements SchemeFactory {
-      public async_scanner_cancel_argsTupleScheme getScheme() {
-        return new async_scanner_cancel_argsTupleScheme();
+    private static class cancel_scanner_async_argsTupleSchemeFactory implements SchemeFactory {
+      public cancel_scanner_async_argsTupleScheme getScheme() {
+        return new cancel_scanner_async_argsTupleScheme();
       }
     }
 
-    private static class async_scanner_cancel_argsTupleScheme extends TupleScheme<async_scanner_cancel_args> {
+    private static class cancel_scanner_async_argsTupleScheme extends TupleScheme<cancel_scanner_async_args> {
 
       @Override
-      public void write(org.apache.thrift.protocol.TProtocol prot, async_scanner_cancel_args struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol prot, cancel_scanner_async_args struct) throws org.apache.thrift.TException {
         TTupleProtocol oprot = (TTupleProtocol) prot;
         BitSet optionals = new BitSet();
         if (struct.isSetScanner()) {
@@ -39510,7 +40306,7 @@ public class ClientService {
       }
 
       @Override
-      public void read(org.apache.thrift.protocol.TProtocol prot, async_scanner_cancel_args struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol prot, cancel_scanner_async_args struct) throws org.apache.thrift.TException {
         TTupleProtocol iprot = (TTupleProtocol) prot;
         BitSet incoming = iprot.readBitSet(1);
         if (incoming.get(0)) {
@@ -39522,15 +40318,15 @@ public class ClientService {
 
   }
 
-  public static class async_scanner_cancel_result implements org.apache.thrift.TBase<async_scanner_cancel_result, async_scanner_cancel_result._Fields>, java.io.Serializable, Cloneable   {
-    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("async_scanner_cancel_result");
+  public static class cancel_scanner_async_result implements org.apache.thrift.TBase<cancel_scanner_async_result, cancel_scanner_async_result._Fields>, java.io.Serializable, Cloneable   {
+    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("cancel_scanner_async_result");
 
     private static final org.apache.thrift.protocol.TField E_FIELD_DESC = new org.apache.thrift.protocol.TField("e", org.apache.thrift.protocol.TType.STRUCT, (short)1);
 
     private static final Map<Class<? extends IScheme>, SchemeFactory> schemes = new HashMap<Class<? extends IScheme>, SchemeFactory>();
     static {
-      schemes.put(StandardScheme.class, new async_scanner_cancel_resultStandardSchemeFactory());
-      schemes.put(TupleScheme.class, new async_scanner_cancel_resultTupleSchemeFactory());
+      schemes.put(StandardScheme.class, new cancel_scanner_async_resultStandardSchemeFactory());
+      schemes.put(TupleScheme.class, new cancel_scanner_async_resultTupleSchemeFactory());
     }
 
     public ClientException e; // required
@@ -39600,13 +40396,13 @@ public class ClientService {
       tmpMap.put(_Fields.E, new org.apache.thrift.meta_data.FieldMetaData("e", org.apache.thrift.TFieldRequirementType.DEFAULT, 
           new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.STRUCT)));
       metaDataMap = Collections.unmodifiableMap(tmpMap);
-      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(async_scanner_cancel_result.class, metaDataMap);
+      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(cancel_scanner_async_result.class, metaDataMap);
     }
 
-    public async_scanner_cancel_result() {
+    public cancel_scanner_async_result() {
     }
 
-    public async_scanner_cancel_result(
+    public cancel_scanner_async_result(
       ClientException e)
     {
       this();
@@ -39616,14 +40412,14 @@ public class ClientService {
     /**
      * Performs a deep copy on <i>other</i>.
      */
-    public async_scanner_cancel_result(async_scanner_cancel_result other) {
+    public cancel_scanner_async_result(cancel_scanner_async_result other) {
       if (other.isSetE()) {
         this.e = new ClientException(other.e);
       }
     }
 
-    public async_scanner_cancel_result deepCopy() {
-      return new async_scanner_cancel_result(this);
+    public cancel_scanner_async_result deepCopy() {
+      return new cancel_scanner_async_result(this);
     }
 
     @Override
@@ -39635,7 +40431,7 @@ public class ClientService {
       return this.e;
     }
 
-    public async_scanner_cancel_result setE(ClientException e) {
+    public cancel_scanner_async_result setE(ClientException e) {
       this.e = e;
       return this;
     }
@@ -39694,12 +40490,12 @@ public class ClientService {
     public boolean equals(Object that) {
       if (that == null)
         return false;
-      if (that instanceof async_scanner_cancel_result)
-        return this.equals((async_scanner_cancel_result)that);
+      if (that instanceof cancel_scanner_async_result)
+        return this.equals((cancel_scanner_async_result)that);
       return false;
     }
 
-    public boolean equals(async_scanner_cancel_result that) {
+    public boolean equals(cancel_scanner_async_result that) {
       if (that == null)
         return false;
 
@@ -39720,13 +40516,13 @@ public class ClientService {
       return 0;
     }
 
-    public int compareTo(async_scanner_cancel_result other) {
+    public int compareTo(cancel_scanner_async_result other) {
       if (!getClass().equals(other.getClass())) {
         return getClass().getName().compareTo(other.getClass().getName());
       }
 
       int lastComparison = 0;
-      async_scanner_cancel_result typedOther = (async_scanner_cancel_result)other;
+      cancel_scanner_async_result typedOther = (cancel_scanner_async_result)other;
 
       lastComparison = Boolean.valueOf(isSetE()).compareTo(typedOther.isSetE());
       if (lastComparison != 0) {
@@ -39755,7 +40551,7 @@ public class ClientService {
 
     @Override
     public String toString() {
-      StringBuilder sb = new StringBuilder("async_scanner_cancel_result(");
+      StringBuilder sb = new StringBuilder("cancel_scanner_async_result(");
       boolean first = true;
 
       sb.append("e:");
@@ -39789,15 +40585,15 @@ public class ClientService {
       }
     }
 
-    private static class async_scanner_cancel_resultStandardSchemeFactory implements SchemeFactory {
-      public async_scanner_cancel_resultStandardScheme getScheme() {
-        return new async_scanner_cancel_resultStandardScheme();
+    private static class cancel_scanner_async_resultStandardSchemeFactory implements SchemeFactory {
+      public cancel_scanner_async_resultStandardScheme getScheme() {
+        return new cancel_scanner_async_resultStandardScheme();
       }
     }
 
-    private static class async_scanner_cancel_resultStandardScheme extends StandardScheme<async_scanner_cancel_result> {
+    private static class cancel_scanner_async_resultStandardScheme extends StandardScheme<cancel_scanner_async_result> {
 
-      public void read(org.apache.thrift.protocol.TProtocol iprot, async_scanner_cancel_result struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol iprot, cancel_scanner_async_result struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TField schemeField;
         iprot.readStructBegin();
         while (true)
@@ -39827,7 +40623,7 @@ public class ClientService {
         struct.validate();
       }
 
-      public void write(org.apache.thrift.protocol.TProtocol oprot, async_scanner_cancel_result struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol oprot, cancel_scanner_async_result struct) throws org.apache.thrift.TException {
         struct.validate();
 
         oprot.writeStructBegin(STRUCT_DESC);
@@ -39842,16 +40638,16 @@ public class ClientService {
 
     }
 
-    private static class async_scanner_cancel_resultTupleSchemeFactory implements SchemeFactory {
-      public async_scanner_cancel_resultTupleScheme getScheme() {
-        return new async_scanner_cancel_resultTupleScheme();
+    private static class cancel_scanner_async_resultTupleSchemeFactory implements SchemeFactory {
+      public cancel_scanner_async_resultTupleScheme getScheme() {
+        return new cancel_scanner_async_resultTupleScheme();
       }
     }
 
-    private static class async_scanner_cancel_resultTupleScheme extends TupleScheme<async_scanner_cancel_result> {
+    private static class cancel_scanner_async_resultTupleScheme extends TupleScheme<cancel_scanner_async_result> {
 
       @Override
-      public void write(org.apache.thrift.protocol.TProtocol prot, async_scanner_cancel_result struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol prot, cancel_scanner_async_result struct) throws org.apache.thrift.TException {
         TTupleProtocol oprot = (TTupleProtocol) prot;
         BitSet optionals = new BitSet();
         if (struct.isSetE()) {
@@ -39864,7 +40660,7 @@ public class ClientService {
       }
 
       @Override
-      public void read(org.apache.thrift.protocol.TProtocol prot, async_scanner_cancel_result struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol prot, cancel_scanner_async_result struct) throws org.apache.thrift.TException {
         TTupleProtocol iprot = (TTupleProtocol) prot;
         BitSet incoming = iprot.readBitSet(1);
         if (incoming.get(0)) {
@@ -39877,15 +40673,15 @@ public class ClientService {
 
   }
 
-  public static class cancel_scanner_async_args implements org.apache.thrift.TBase<cancel_scanner_async_args, cancel_scanner_async_args._Fields>, java.io.Serializable, Cloneable   {
-    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("cancel_scanner_async_args");
+  public static class async_scanner_close_args implements org.apache.thrift.TBase<async_scanner_close_args, async_scanner_close_args._Fields>, java.io.Serializable, Cloneable   {
+    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("async_scanner_close_args");
 
     private static final org.apache.thrift.protocol.TField SCANNER_FIELD_DESC = new org.apache.thrift.protocol.TField("scanner", org.apache.thrift.protocol.TType.I64, (short)1);
 
     private static final Map<Class<? extends IScheme>, SchemeFactory> schemes = new HashMap<Class<? extends IScheme>, SchemeFactory>();
     static {
-      schemes.put(StandardScheme.class, new cancel_scanner_async_argsStandardSchemeFactory());
-      schemes.put(TupleScheme.class, new cancel_scanner_async_argsTupleSchemeFactory());
+      schemes.put(StandardScheme.class, new async_scanner_close_argsStandardSchemeFactory());
+      schemes.put(TupleScheme.class, new async_scanner_close_argsTupleSchemeFactory());
     }
 
     public long scanner; // required
@@ -39957,13 +40753,13 @@ public class ClientService {
       tmpMap.put(_Fields.SCANNER, new org.apache.thrift.meta_data.FieldMetaData("scanner", org.apache.thrift.TFieldRequirementType.DEFAULT, 
           new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.I64          , "ScannerAsync")));
       metaDataMap = Collections.unmodifiableMap(tmpMap);
-      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(cancel_scanner_async_args.class, metaDataMap);
+      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(async_scanner_close_args.class, metaDataMap);
     }
 
-    public cancel_scanner_async_args() {
+    public async_scanner_close_args() {
     }
 
-    public cancel_scanner_async_args(
+    public async_scanner_close_args(
       long scanner)
     {
       this();
@@ -39974,14 +40770,14 @@ public class ClientService {
     /**
      * Performs a deep copy on <i>other</i>.
      */
-    public cancel_scanner_async_args(cancel_scanner_async_args other) {
+    public async_scanner_close_args(async_scanner_close_args other) {
       __isset_bit_vector.clear();
       __isset_bit_vector.or(other.__isset_bit_vector);
       this.scanner = other.scanner;
     }
 
-    public cancel_scanner_async_args deepCopy() {
-      return new cancel_scanner_async_args(this);
+    public async_scanner_close_args deepCopy() {
+      return new async_scanner_close_args(this);
     }
 
     @Override
@@ -39994,7 +40790,7 @@ public class ClientService {
       return this.scanner;
     }
 
-    public cancel_scanner_async_args setScanner(long scanner) {
+    public async_scanner_close_args setScanner(long scanner) {
       this.scanner = scanner;
       setScannerIsSet(true);
       return this;
@@ -40052,12 +40848,12 @@ public class ClientService {
     public boolean equals(Object that) {
       if (that == null)
         return false;
-      if (that instanceof cancel_scanner_async_args)
-        return this.equals((cancel_scanner_async_args)that);
+      if (that instanceof async_scanner_close_args)
+        return this.equals((async_scanner_close_args)that);
       return false;
     }
 
-    public boolean equals(cancel_scanner_async_args that) {
+    public boolean equals(async_scanner_close_args that) {
       if (that == null)
         return false;
 
@@ -40078,13 +40874,13 @@ public class ClientService {
       return 0;
     }
 
-    public int compareTo(cancel_scanner_async_args other) {
+    public int compareTo(async_scanner_close_args other) {
       if (!getClass().equals(other.getClass())) {
         return getClass().getName().compareTo(other.getClass().getName());
       }
 
       int lastComparison = 0;
-      cancel_scanner_async_args typedOther = (cancel_scanner_async_args)other;
+      async_scanner_close_args typedOther = (async_scanner_close_args)other;
 
       lastComparison = Boolean.valueOf(isSetScanner()).compareTo(typedOther.isSetScanner());
       if (lastComparison != 0) {
@@ -40113,7 +40909,7 @@ public class ClientService {
 
     @Override
     public String toString() {
-      StringBuilder sb = new StringBuilder("cancel_scanner_async_args(");
+      StringBuilder sb = new StringBuilder("async_scanner_close_args(");
       boolean first = true;
 
       sb.append("scanner:");
@@ -40145,15 +40941,15 @@ public class ClientService {
       }
     }
 
-    private static class cancel_scanner_async_argsStandardSchemeFactory implements SchemeFactory {
-      public cancel_scanner_async_argsStandardScheme getScheme() {
-        return new cancel_scanner_async_argsStandardScheme();
+    private static class async_scanner_close_argsStandardSchemeFactory implements SchemeFactory {
+      public async_scanner_close_argsStandardScheme getScheme() {
+        return new async_scanner_close_argsStandardScheme();
       }
     }
 
-    private static class cancel_scanner_async_argsStandardScheme extends StandardScheme<cancel_scanner_async_args> {
+    private static class async_scanner_close_argsStandardScheme extends StandardScheme<async_scanner_close_args> {
 
-      public void read(org.apache.thrift.protocol.TProtocol iprot, cancel_scanner_async_args struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol iprot, async_scanner_close_args struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TField schemeField;
         iprot.readStructBegin();
         while (true)
@@ -40182,7 +40978,7 @@ public class ClientService {
         struct.validate();
       }
 
-      public void write(org.apache.thrift.protocol.TProtocol oprot, cancel_scanner_async_args struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol oprot, async_scanner_close_args struct) throws org.apache.thrift.TException {
         struct.validate();
 
         oprot.writeStructBegin(STRUCT_DESC);
@@ -40195,16 +40991,16 @@ public class ClientService {
 
     }
 
-    private static class cancel_scanner_async_argsTupleSchemeFactory implements SchemeFactory {
-      public cancel_scanner_async_argsTupleScheme getScheme() {
-        return new cancel_scanner_async_argsTupleScheme();
+    private static class async_scanner_close_argsTupleSchemeFactory implements SchemeFactory {
+      public async_scanner_close_argsTupleScheme getScheme() {
+        return new async_scanner_close_argsTupleScheme();
       }
     }
 
-    private static class cancel_scanner_async_argsTupleScheme extends TupleScheme<cancel_scanner_async_args> {
+    private static class async_scanner_close_argsTupleScheme extends TupleScheme<async_scanner_close_args> {
 
       @Override
-      public void write(org.apache.thrift.protocol.TProtocol prot, cancel_scanner_async_args struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol prot, async_scanner_close_args struct) throws org.apache.thrift.TException {
         TTupleProtocol oprot = (TTupleProtocol) prot;
         BitSet optionals = new BitSet();
         if (struct.isSetScanner()) {
@@ -40217,7 +41013,7 @@ public class ClientService {
       }
 
       @Override
-      public void read(org.apache.thrift.protocol.TProtocol prot, cancel_scanner_async_args struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol prot, async_scanner_close_args struct) throws org.apache.thrift.TException {
         TTupleProtocol iprot = (TTupleProtocol) prot;
         BitSet incoming = iprot.readBitSet(1);
         if (incoming.get(0)) {
@@ -40229,15 +41025,15 @@ public class ClientService {
 
   }
 
-  public static class cancel_scanner_async_result implements org.apache.thrift.TBase<cancel_scanner_async_result, cancel_scanner_async_result._Fields>, java.io.Serializable, Cloneable   {
-    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("cancel_scanner_async_result");
+  public static class async_scanner_close_result implements org.apache.thrift.TBase<async_scanner_close_result, async_scanner_close_result._Fields>, java.io.Serializable, Cloneable   {
+    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("async_scanner_close_result");
 
     private static final org.apache.thrift.protocol.TField E_FIELD_DESC = new org.apache.thrift.protocol.TField("e", org.apache.thrift.protocol.TType.STRUCT, (short)1);
 
     private static final Map<Class<? extends IScheme>, SchemeFactory> schemes = new HashMap<Class<? extends IScheme>, SchemeFactory>();
     static {
-      schemes.put(StandardScheme.class, new cancel_scanner_async_resultStandardSchemeFactory());
-      schemes.put(TupleScheme.class, new cancel_scanner_async_resultTupleSchemeFactory());
+      schemes.put(StandardScheme.class, new async_scanner_close_resultStandardSchemeFactory());
+      schemes.put(TupleScheme.class, new async_scanner_close_resultTupleSchemeFactory());
     }
 
     public ClientException e; // required
@@ -40307,13 +41103,13 @@ public class ClientService {
       tmpMap.put(_Fields.E, new org.apache.thrift.meta_data.FieldMetaData("e", org.apache.thrift.TFieldRequirementType.DEFAULT, 
           new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.STRUCT)));
       metaDataMap = Collections.unmodifiableMap(tmpMap);
-      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(cancel_scanner_async_result.class, metaDataMap);
+      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(async_scanner_close_result.class, metaDataMap);
     }
 
-    public cancel_scanner_async_result() {
+    public async_scanner_close_result() {
     }
 
-    public cancel_scanner_async_result(
+    public async_scanner_close_result(
       ClientException e)
     {
       this();
@@ -40323,14 +41119,14 @@ public class ClientService {
     /**
      * Performs a deep copy on <i>other</i>.
      */
-    public cancel_scanner_async_result(cancel_scanner_async_result other) {
+    public async_scanner_close_result(async_scanner_close_result other) {
       if (other.isSetE()) {
         this.e = new ClientException(other.e);
       }
     }
 
-    public cancel_scanner_async_result deepCopy() {
-      return new cancel_scanner_async_result(this);
+    public async_scanner_close_result deepCopy() {
+      return new async_scanner_close_result(this);
     }
 
     @Override
@@ -40342,7 +41138,7 @@ public class ClientService {
       return this.e;
     }
 
-    public cancel_scanner_async_result setE(ClientException e) {
+    public async_scanner_close_result setE(ClientException e) {
       this.e = e;
       return this;
     }
@@ -40401,12 +41197,12 @@ public class ClientService {
     public boolean equals(Object that) {
       if (that == null)
         return false;
-      if (that instanceof cancel_scanner_async_result)
-        return this.equals((cancel_scanner_async_result)that);
+      if (that instanceof async_scanner_close_result)
+        return this.equals((async_scanner_close_result)that);
       return false;
     }
 
-    public boolean equals(cancel_scanner_async_result that) {
+    public boolean equals(async_scanner_close_result that) {
       if (that == null)
         return false;
 
@@ -40427,13 +41223,13 @@ public class ClientService {
       return 0;
     }
 
-    public int compareTo(cancel_scanner_async_result other) {
+    public int compareTo(async_scanner_close_result other) {
       if (!getClass().equals(other.getClass())) {
         return getClass().getName().compareTo(other.getClass().getName());
       }
 
       int lastComparison = 0;
-      cancel_scanner_async_result typedOther = (cancel_scanner_async_result)other;
+      async_scanner_close_result typedOther = (async_scanner_close_result)other;
 
       lastComparison = Boolean.valueOf(isSetE()).compareTo(typedOther.isSetE());
       if (lastComparison != 0) {
@@ -40462,7 +41258,7 @@ public class ClientService {
 
     @Override
     public String toString() {
-      StringBuilder sb = new StringBuilder("cancel_scanner_async_result(");
+      StringBuilder sb = new StringBuilder("async_scanner_close_result(");
       boolean first = true;
 
       sb.append("e:");
@@ -40496,15 +41292,15 @@ public class ClientService {
       }
     }
 
-    private static class cancel_scanner_async_resultStandardSchemeFactory implements SchemeFactory {
-      public cancel_scanner_async_resultStandardScheme getScheme() {
-        return new cancel_scanner_async_resultStandardScheme();
+    private static class async_scanner_close_resultStandardSchemeFactory implements SchemeFactory {
+      public async_scanner_close_resultStandardScheme getScheme() {
+        return new async_scanner_close_resultStandardScheme();
       }
     }
 
-    private static class cancel_scanner_async_resultStandardScheme extends StandardScheme<cancel_scanner_async_result> {
+    private static class async_scanner_close_resultStandardScheme extends StandardScheme<async_scanner_close_result> {
 
-      public void read(org.apache.thrift.protocol.TProtocol iprot, cancel_scanner_async_result struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol iprot, async_scanner_close_result struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TField schemeField;
         iprot.readStructBegin();
         while (true)
@@ -40534,7 +41330,7 @@ public class ClientService {
         struct.validate();
       }
 
-      public void write(org.apache.thrift.protocol.TProtocol oprot, cancel_scanner_async_result struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol oprot, async_scanner_close_result struct) throws org.apache.thrift.TException {
         struct.validate();
 
         oprot.writeStructBegin(STRUCT_DESC);
@@ -40549,16 +41345,16 @@ public class ClientService {
 
     }
 
-    private static class cancel_scanner_async_resultTupleSchemeFactory implements SchemeFactory {
-      public cancel_scanner_async_resultTupleScheme getScheme() {
-        return new cancel_scanner_async_resultTupleScheme();
+    private static class async_scanner_close_resultTupleSchemeFactory implements SchemeFactory {
+      public async_scanner_close_resultTupleScheme getScheme() {
+        return new async_scanner_close_resultTupleScheme();
       }
     }
 
-    private static class cancel_scanner_async_resultTupleScheme extends TupleScheme<cancel_scanner_async_result> {
+    private static class async_scanner_close_resultTupleScheme extends TupleScheme<async_scanner_close_result> {
 
       @Override
-      public void write(org.apache.thrift.protocol.TProtocol prot, cancel_scanner_async_result struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol prot, async_scanner_close_result struct) throws org.apache.thrift.TException {
         TTupleProtocol oprot = (TTupleProtocol) prot;
         BitSet optionals = new BitSet();
         if (struct.isSetE()) {
@@ -40571,7 +41367,7 @@ public class ClientService {
       }
 
       @Override
-      public void read(org.apache.thrift.protocol.TProtocol prot, cancel_scanner_async_result struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol prot, async_scanner_close_result struct) throws org.apache.thrift.TException {
         TTupleProtocol iprot = (TTupleProtocol) prot;
         BitSet incoming = iprot.readBitSet(1);
         if (incoming.get(0)) {
@@ -40584,15 +41380,15 @@ public class ClientService {
 
   }
 
-  public static class async_scanner_close_args implements org.apache.thrift.TBase<async_scanner_close_args, async_scanner_close_args._Fields>, java.io.Serializable, Cloneable   {
-    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("async_scanner_close_args");
+  public static class close_scanner_async_args implements org.apache.thrift.TBase<close_scanner_async_args, close_scanner_async_args._Fields>, java.io.Serializable, Cloneable   {
+    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("close_scanner_async_args");
 
     private static final org.apache.thrift.protocol.TField SCANNER_FIELD_DESC = new org.apache.thrift.protocol.TField("scanner", org.apache.thrift.protocol.TType.I64, (short)1);
 
     private static final Map<Class<? extends IScheme>, SchemeFactory> schemes = new HashMap<Class<? extends IScheme>, SchemeFactory>();
     static {
-      schemes.put(StandardScheme.class, new async_scanner_close_argsStandardSchemeFactory());
-      schemes.put(TupleScheme.class, new async_scanner_close_argsTupleSchemeFactory());
+      schemes.put(StandardScheme.class, new close_scanner_async_argsStandardSchemeFactory());
+      schemes.put(TupleScheme.class, new close_scanner_async_argsTupleSchemeFactory());
     }
 
     public long scanner; // required
@@ -40664,13 +41460,13 @@ public class ClientService {
       tmpMap.put(_Fields.SCANNER, new org.apache.thrift.meta_data.FieldMetaData("scanner", org.apache.thrift.TFieldRequirementType.DEFAULT, 
           new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.I64          , "ScannerAsync")));
       metaDataMap = Collections.unmodifiableMap(tmpMap);
-      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(async_scanner_close_args.class, metaDataMap);
+      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(close_scanner_async_args.class, metaDataMap);
     }
 
-    public async_scanner_close_args() {
+    public close_scanner_async_args() {
     }
 
-    public async_scanner_close_args(
+    public close_scanner_async_args(
       long scanner)
     {
       this();
@@ -40681,14 +41477,14 @@ public class ClientService {
     /**
      * Performs a deep copy on <i>other</i>.
      */
-    public async_scanner_close_args(async_scanner_close_args other) {
+    public close_scanner_async_args(close_scanner_async_args other) {
       __isset_bit_vector.clear();
       __isset_bit_vector.or(other.__isset_bit_vector);
       this.scanner = other.scanner;
     }
 
-    public async_scanner_close_args deepCopy() {
-      return new async_scanner_close_args(this);
+    public close_scanner_async_args deepCopy() {
+      return new close_scanner_async_args(this);
     }
 
     @Override
@@ -40701,7 +41497,7 @@ public class ClientService {
       return this.scanner;
     }
 
-    public async_scanner_close_args setScanner(long scanner) {
+    public close_scanner_async_args setScanner(long scanner) {
       this.scanner = scanner;
       setScannerIsSet(true);
       return this;
@@ -40759,12 +41555,12 @@ public class ClientService {
     public boolean equals(Object that) {
       if (that == null)
         return false;
-      if (that instanceof async_scanner_close_args)
-        return this.equals((async_scanner_close_args)that);
+      if (that instanceof close_scanner_async_args)
+        return this.equals((close_scanner_async_args)that);
       return false;
     }
 
-    public boolean equals(async_scanner_close_args that) {
+    public boolean equals(close_scanner_async_args that) {
       if (that == null)
         return false;
 
@@ -40785,13 +41581,13 @@ public class ClientService {
       return 0;
     }
 
-    public int compareTo(async_scanner_close_args other) {
+    public int compareTo(close_scanner_async_args other) {
       if (!getClass().equals(other.getClass())) {
         return getClass().getName().compareTo(other.getClass().getName());
       }
 
       int lastComparison = 0;
-      async_scanner_close_args typedOther = (async_scanner_close_args)other;
+      close_scanner_async_args typedOther = (close_scanner_async_args)other;
 
       lastComparison = Boolean.valueOf(isSetScanner()).compareTo(typedOther.isSetScanner());
       if (lastComparison != 0) {
@@ -40820,7 +41616,7 @@ public class ClientService {
 
     @Override
     public String toString() {
-      StringBuilder sb = new StringBuilder("async_scanner_close_args(");
+      StringBuilder sb = new StringBuilder("close_scanner_async_args(");
       boolean first = true;
 
       sb.append("scanner:");
@@ -40852,15 +41648,15 @@ public class ClientService {
       }
     }
 
-    private static class async_scanner_close_argsStandardSchemeFactory implements SchemeFactory {
-      public async_scanner_close_argsStandardScheme getScheme() {
-        return new async_scanner_close_argsStandardScheme();
+    private static class close_scanner_async_argsStandardSchemeFactory implements SchemeFactory {
+      public close_scanner_async_argsStandardScheme getScheme() {
+        return new close_scanner_async_argsStandardScheme();
       }
     }
 
-    private static class async_scanner_close_argsStandardScheme extends StandardScheme<async_scanner_close_args> {
+    private static class close_scanner_async_argsStandardScheme extends StandardScheme<close_scanner_async_args> {
 
-      public void read(org.apache.thrift.protocol.TProtocol iprot, async_scanner_close_args struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol iprot, close_scanner_async_args struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TField schemeField;
         iprot.readStructBegin();
         while (true)
@@ -40889,7 +41685,7 @@ public class ClientService {
         struct.validate();
       }
 
-      public void write(org.apache.thrift.protocol.TProtocol oprot, async_scanner_close_args struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol oprot, close_scanner_async_args struct) throws org.apache.thrift.TException {
         struct.validate();
 
         oprot.writeStructBegin(STRUCT_DESC);
@@ -40902,16 +41698,16 @@ public class ClientService {
 
     }
 
-    private static class async_scanner_close_argsTupleSchemeFactory implements SchemeFactory {
-      public async_scanner_close_argsTupleScheme getScheme() {
-        return new async_scanner_close_argsTupleScheme();
+    private static class close_scanner_async_argsTupleSchemeFactory implements SchemeFactory {
+      public close_scanner_async_argsTupleScheme getScheme() {
+        return new close_scanner_async_argsTupleScheme();
       }
     }
 
-    private static class async_scanner_close_argsTupleScheme extends TupleScheme<async_scanner_close_args> {
+    private static class close_scanner_async_argsTupleScheme extends TupleScheme<close_scanner_async_args> {
 
       @Override
-      public void write(org.apache.thrift.protocol.TProtocol prot, async_scanner_close_args struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol prot, close_scanner_async_args struct) throws org.apache.thrift.TException {
         TTupleProtocol oprot = (TTupleProtocol) prot;
         BitSet optionals = new BitSet();
         if (struct.isSetScanner()) {
@@ -40924,7 +41720,7 @@ public class ClientService {
       }
 
       @Override
-      public void read(org.apache.thrift.protocol.TProtocol prot, async_scanner_close_args struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol prot, close_scanner_async_args struct) throws org.apache.thrift.TException {
         TTupleProtocol iprot = (TTupleProtocol) prot;
         BitSet incoming = iprot.readBitSet(1);
         if (incoming.get(0)) {
@@ -40936,15 +41732,15 @@ public class ClientService {
 
   }
 
-  public static class async_scanner_close_result implements org.apache.thrift.TBase<async_scanner_close_result, async_scanner_close_result._Fields>, java.io.Serializable, Cloneable   {
-    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("async_scanner_close_result");
+  public static class close_scanner_async_result implements org.apache.thrift.TBase<close_scanner_async_result, close_scanner_async_result._Fields>, java.io.Serializable, Cloneable   {
+    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("close_scanner_async_result");
 
     private static final org.apache.thrift.protocol.TField E_FIELD_DESC = new org.apache.thrift.protocol.TField("e", org.apache.thrift.protocol.TType.STRUCT, (short)1);
 
     private static final Map<Class<? extends IScheme>, SchemeFactory> schemes = new HashMap<Class<? extends IScheme>, SchemeFactory>();
     static {
-      schemes.put(StandardScheme.class, new async_scanner_close_resultStandardSchemeFactory());
-      schemes.put(TupleScheme.class, new async_scanner_close_resultTupleSchemeFactory());
+      schemes.put(StandardScheme.class, new close_scanner_async_resultStandardSchemeFactory());
+      schemes.put(TupleScheme.class, new close_scanner_async_resultTupleSchemeFactory());
     }
 
     public ClientException e; // required
@@ -41014,13 +41810,13 @@ public class ClientService {
       tmpMap.put(_Fields.E, new org.apache.thrift.meta_data.FieldMetaData("e", org.apache.thrift.TFieldRequirementType.DEFAULT, 
           new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.STRUCT)));
       metaDataMap = Collections.unmodifiableMap(tmpMap);
-      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(async_scanner_close_result.class, metaDataMap);
+      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(close_scanner_async_result.class, metaDataMap);
     }
 
-    public async_scanner_close_result() {
+    public close_scanner_async_result() {
     }
 
-    public async_scanner_close_result(
+    public close_scanner_async_result(
       ClientException e)
     {
       this();
@@ -41030,14 +41826,14 @@ public class ClientService {
     /**
      * Performs a deep copy on <i>other</i>.
      */
-    public async_scanner_close_result(async_scanner_close_result other) {
+    public close_scanner_async_result(close_scanner_async_result other) {
       if (other.isSetE()) {
         this.e = new ClientException(other.e);
       }
     }
 
-    public async_scanner_close_result deepCopy() {
-      return new async_scanner_close_result(this);
+    public close_scanner_async_result deepCopy() {
+      return new close_scanner_async_result(this);
     }
 
     @Override
@@ -41049,7 +41845,7 @@ public class ClientService {
       return this.e;
     }
 
-    public async_scanner_close_result setE(ClientException e) {
+    public close_scanner_async_result setE(ClientException e) {
       this.e = e;
       return this;
     }
@@ -41108,12 +41904,12 @@ public class ClientService {
     public boolean equals(Object that) {
       if (that == null)
         return false;
-      if (that instanceof async_scanner_close_result)
-        return this.equals((async_scanner_close_result)that);
+      if (that instanceof close_scanner_async_result)
+        return this.equals((close_scanner_async_result)that);
       return false;
     }
 
-    public boolean equals(async_scanner_close_result that) {
+    public boolean equals(close_scanner_async_result that) {
       if (that == null)
         return false;
 
@@ -41134,13 +41930,13 @@ public class ClientService {
       return 0;
     }
 
-    public int compareTo(async_scanner_close_result other) {
+    public int compareTo(close_scanner_async_result other) {
       if (!getClass().equals(other.getClass())) {
         return getClass().getName().compareTo(other.getClass().getName());
       }
 
       int lastComparison = 0;
-      async_scanner_close_result typedOther = (async_scanner_close_result)other;
+      close_scanner_async_result typedOther = (close_scanner_async_result)other;
 
       lastComparison = Boolean.valueOf(isSetE()).compareTo(typedOther.isSetE());
       if (lastComparison != 0) {
@@ -41169,7 +41965,7 @@ public class ClientService {
 
     @Override
     public String toString() {
-      StringBuilder sb = new StringBuilder("async_scanner_close_result(");
+      StringBuilder sb = new StringBuilder("close_scanner_async_result(");
       boolean first = true;
 
       sb.append("e:");
@@ -41203,15 +41999,15 @@ public class ClientService {
       }
     }
 
-    private static class async_scanner_close_resultStandardSchemeFactory implements SchemeFactory {
-      public async_scanner_close_resultStandardScheme getScheme() {
-        return new async_scanner_close_resultStandardScheme();
+    private static class close_scanner_async_resultStandardSchemeFactory implements SchemeFactory {
+      public close_scanner_async_resultStandardScheme getScheme() {
+        return new close_scanner_async_resultStandardScheme();
       }
     }
 
-    private static class async_scanner_close_resultStandardScheme extends StandardScheme<async_scanner_close_result> {
+    private static class close_scanner_async_resultStandardScheme extends StandardScheme<close_scanner_async_result> {
 
-      public void read(org.apache.thrift.protocol.TProtocol iprot, async_scanner_close_result struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol iprot, close_scanner_async_result struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TField schemeField;
         iprot.readStructBegin();
         while (true)
@@ -41241,7 +42037,7 @@ public class ClientService {
         struct.validate();
       }
 
-      public void write(org.apache.thrift.protocol.TProtocol oprot, async_scanner_close_result struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol oprot, close_scanner_async_result struct) throws org.apache.thrift.TException {
         struct.validate();
 
         oprot.writeStructBegin(STRUCT_DESC);
@@ -41256,16 +42052,16 @@ public class ClientService {
 
     }
 
-    private static class async_scanner_close_resultTupleSchemeFactory implements SchemeFactory {
-      public async_scanner_close_resultTupleScheme getScheme() {
-        return new async_scanner_close_resultTupleScheme();
+    private static class close_scanner_async_resultTupleSchemeFactory implements SchemeFactory {
+      public close_scanner_async_resultTupleScheme getScheme() {
+        return new close_scanner_async_resultTupleScheme();
       }
     }
 
-    private static class async_scanner_close_resultTupleScheme extends TupleScheme<async_scanner_close_result> {
+    private static class close_scanner_async_resultTupleScheme extends TupleScheme<close_scanner_async_result> {
 
       @Override
-      public void write(org.apache.thrift.protocol.TProtocol prot, async_scanner_close_result struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol prot, close_scanner_async_result struct) throws org.apache.thrift.TException {
         TTupleProtocol oprot = (TTupleProtocol) prot;
         BitSet optionals = new BitSet();
         if (struct.isSetE()) {
@@ -41278,7 +42074,7 @@ public class ClientService {
       }
 
       @Override
-      public void read(org.apache.thrift.protocol.TProtocol prot, async_scanner_close_result struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol prot, close_scanner_async_result struct) throws org.apache.thrift.TException {
         TTupleProtocol iprot = (TTupleProtocol) prot;
         BitSet incoming = iprot.readBitSet(1);
         if (incoming.get(0)) {
@@ -41291,15 +42087,15 @@ public class ClientService {
 
   }
 
-  public static class close_scanner_async_args implements org.apache.thrift.TBase<close_scanner_async_args, close_scanner_async_args._Fields>, java.io.Serializable, Cloneable   {
-    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("close_scanner_async_args");
+  public static class scanner_get_cells_args implements org.apache.thrift.TBase<scanner_get_cells_args, scanner_get_cells_args._Fields>, java.io.Serializable, Cloneable   {
+    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("scanner_get_cells_args");
 
     private static final org.apache.thrift.protocol.TField SCANNER_FIELD_DESC = new org.apache.thrift.protocol.TField("scanner", org.apache.thrift.protocol.TType.I64, (short)1);
 
     private static final Map<Class<? extends IScheme>, SchemeFactory> schemes = new HashMap<Class<? extends IScheme>, SchemeFactory>();
     static {
-      schemes.put(StandardScheme.class, new close_scanner_async_argsStandardSchemeFactory());
-      schemes.put(TupleScheme.class, new close_scanner_async_argsTupleSchemeFactory());
+      schemes.put(StandardScheme.class, new scanner_get_cells_argsStandardSchemeFactory());
+      schemes.put(TupleScheme.class, new scanner_get_cells_argsTupleSchemeFactory());
     }
 
     public long scanner; // required
@@ -41369,15 +42165,15 @@ public class ClientService {
     static {
       Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> tmpMap = new EnumMap<_Fields, org.apache.thrift.meta_data.FieldMetaData>(_Fields.class);
       tmpMap.put(_Fields.SCANNER, new org.apache.thrift.meta_data.FieldMetaData("scanner", org.apache.thrift.TFieldRequirementType.DEFAULT, 
-          new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.I64          , "ScannerAsync")));
+          new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.I64          , "Scanner")));
       metaDataMap = Collections.unmodifiableMap(tmpMap);
-      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(close_scanner_async_args.class, metaDataMap);
+      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(scanner_get_cells_args.class, metaDataMap);
     }
 
-    public close_scanner_async_args() {
+    public scanner_get_cells_args() {
     }
 
-    public close_scanner_async_args(
+    public scanner_get_cells_args(
       long scanner)
     {
       this();
@@ -41388,14 +42184,14 @@ public class ClientService {
     /**
      * Performs a deep copy on <i>other</i>.
      */
-    public close_scanner_async_args(close_scanner_async_args other) {
+    public scanner_get_cells_args(scanner_get_cells_args other) {
       __isset_bit_vector.clear();
       __isset_bit_vector.or(other.__isset_bit_vector);
       this.scanner = other.scanner;
     }
 
-    public close_scanner_async_args deepCopy() {
-      return new close_scanner_async_args(this);
+    public scanner_get_cells_args deepCopy() {
+      return new scanner_get_cells_args(this);
     }
 
     @Override
@@ -41408,7 +42204,7 @@ public class ClientService {
       return this.scanner;
     }
 
-    public close_scanner_async_args setScanner(long scanner) {
+    public scanner_get_cells_args setScanner(long scanner) {
       this.scanner = scanner;
       setScannerIsSet(true);
       return this;
@@ -41466,12 +42262,12 @@ public class ClientService {
     public boolean equals(Object that) {
       if (that == null)
         return false;
-      if (that instanceof close_scanner_async_args)
-        return this.equals((close_scanner_async_args)that);
+      if (that instanceof scanner_get_cells_args)
+        return this.equals((scanner_get_cells_args)that);
       return false;
     }
 
-    public boolean equals(close_scanner_async_args that) {
+    public boolean equals(scanner_get_cells_args that) {
       if (that == null)
         return false;
 
@@ -41492,13 +42288,13 @@ public class ClientService {
       return 0;
     }
 
-    public int compareTo(close_scanner_async_args other) {
+    public int compareTo(scanner_get_cells_args other) {
       if (!getClass().equals(other.getClass())) {
         return getClass().getName().compareTo(other.getClass().getName());
       }
 
       int lastComparison = 0;
-      close_scanner_async_args typedOther = (close_scanner_async_args)other;
+      scanner_get_cells_args typedOther = (scanner_get_cells_args)other;
 
       lastComparison = Boolean.valueOf(isSetScanner()).compareTo(typedOther.isSetScanner());
       if (lastComparison != 0) {
@@ -41527,7 +42323,7 @@ public class ClientService {
 
     @Override
     public String toString() {
-      StringBuilder sb = new StringBuilder("close_scanner_async_args(");
+      StringBuilder sb = new StringBuilder("scanner_get_cells_args(");
       boolean first = true;
 
       sb.append("scanner:");
@@ -41559,15 +42355,15 @@ public class ClientService {
       }
     }
 
-    private static class close_scanner_async_argsStandardSchemeFactory implements SchemeFactory {
-      public close_scanner_async_argsStandardScheme getScheme() {
-        return new close_scanner_async_argsStandardScheme();
+    private static class scanner_get_cells_argsStandardSchemeFactory implements SchemeFactory {
+      public scanner_get_cells_argsStandardScheme getScheme() {
+        return new scanner_get_cells_argsStandardScheme();
       }
     }
 
-    private static class close_scanner_async_argsStandardScheme extends StandardScheme<close_scanner_async_args> {
+    private static class scanner_get_cells_argsStandardScheme extends StandardScheme<scanner_get_cells_args> {
 
-      public void read(org.apache.thrift.protocol.TProtocol iprot, close_scanner_async_args struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol iprot, scanner_get_cells_args struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TField schemeField;
         iprot.readStructBegin();
         while (true)
@@ -41596,7 +42392,7 @@ public class ClientService {
         struct.validate();
       }
 
-      public void write(org.apache.thrift.protocol.TProtocol oprot, close_scanner_async_args struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol oprot, scanner_get_cells_args struct) throws org.apache.thrift.TException {
         struct.validate();
 
         oprot.writeStructBegin(STRUCT_DESC);
@@ -41609,16 +42405,16 @@ public class ClientService {
 
     }
 
-    private static class close_scanner_async_argsTupleSchemeFactory implements SchemeFactory {
-      public close_scanner_async_argsTupleScheme getScheme() {
-        return new close_scanner_async_argsTupleScheme();
+    private static class scanner_get_cells_argsTupleSchemeFactory implements SchemeFactory {
+      public scanner_get_cells_argsTupleScheme getScheme() {
+        return new scanner_get_cells_argsTupleScheme();
       }
     }
 
-    private static class close_scanner_async_argsTupleScheme extends TupleScheme<close_scanner_async_args> {
+    private static class scanner_get_cells_argsTupleScheme extends TupleScheme<scanner_get_cells_args> {
 
       @Override
-      public void write(org.apache.thrift.protocol.TProtocol prot, close_scanner_async_args struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol prot, scanner_get_cells_args struct) throws org.apache.thrift.TException {
         TTupleProtocol oprot = (TTupleProtocol) prot;
         BitSet optionals = new BitSet();
         if (struct.isSetScanner()) {
@@ -41631,7 +42427,7 @@ public class ClientService {
       }
 
       @Override
-      public void read(org.apache.thrift.protocol.TProtocol prot, close_scanner_async_args struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol prot, scanner_get_cells_args struct) throws org.apache.thrift.TException {
         TTupleProtocol iprot = (TTupleProtocol) prot;
         BitSet incoming = iprot.readBitSet(1);
         if (incoming.get(0)) {
@@ -41643,21 +42439,24 @@ public class ClientService {
 
   }
 
-  public static class close_scanner_async_result implements org.apache.thrift.TBase<close_scanner_async_result, close_scanner_async_result._Fields>, java.io.Serializable, Cloneable   {
-    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("close_scanner_async_result");
+  public static class scanner_get_cells_result implements org.apache.thrift.TBase<scanner_get_cells_result, scanner_get_cells_result._Fields>, java.io.Serializable, Cloneable   {
+    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("scanner_get_cells_result");
 
+    private static final org.apache.thrift.protocol.TField SUCCESS_FIELD_DESC = new org.apache.thrift.protocol.TField("success", org.apache.thrift.protocol.TType.LIST, (short)0);
     private static final org.apache.thrift.protocol.TField E_FIELD_DESC = new org.apache.thrift.protocol.TField("e", org.apache.thrift.protocol.TType.STRUCT, (short)1);
 
     private static final Map<Class<? extends IScheme>, SchemeFactory> schemes = new HashMap<Class<? extends IScheme>, SchemeFactory>();
     static {
-      schemes.put(StandardScheme.class, new close_scanner_async_resultStandardSchemeFactory());
-      schemes.put(TupleScheme.class, new close_scanner_async_resultTupleSchemeFactory());
+      schemes.put(StandardScheme.class, new scanner_get_cells_resultStandardSchemeFactory());
+      schemes.put(TupleScheme.class, new scanner_get_cells_resultTupleSchemeFactory());
     }
 
+    public List<Cell> success; // required
     public ClientException e; // required
 
     /** The set of fields this struct contains, along with convenience methods for finding and manipulating them. */
     public enum _Fields implements org.apache.thrift.TFieldIdEnum {
+      SUCCESS((short)0, "success"),
       E((short)1, "e");
 
       private static final Map<String, _Fields> byName = new HashMap<String, _Fields>();
@@ -41673,6 +42472,8 @@ public class ClientService {
        */
       public static _Fields findByThriftId(int fieldId) {
         switch(fieldId) {
+          case 0: // SUCCESS
+            return SUCCESS;
           case 1: // E
             return E;
           default:
@@ -41718,45 +42519,97 @@ public class ClientService {
     public static final Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> metaDataMap;
     static {
       Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> tmpMap = new EnumMap<_Fields, org.apache.thrift.meta_data.FieldMetaData>(_Fields.class);
+      tmpMap.put(_Fields.SUCCESS, new org.apache.thrift.meta_data.FieldMetaData("success", org.apache.thrift.TFieldRequirementType.DEFAULT, 
+          new org.apache.thrift.meta_data.ListMetaData(org.apache.thrift.protocol.TType.LIST, 
+              new org.apache.thrift.meta_data.StructMetaData(org.apache.thrift.protocol.TType.STRUCT, Cell.class))));
       tmpMap.put(_Fields.E, new org.apache.thrift.meta_data.FieldMetaData("e", org.apache.thrift.TFieldRequirementType.DEFAULT, 
           new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.STRUCT)));
       metaDataMap = Collections.unmodifiableMap(tmpMap);
-      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(close_scanner_async_result.class, metaDataMap);
+      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(scanner_get_cells_result.class, metaDataMap);
     }
 
-    public close_scanner_async_result() {
+    public scanner_get_cells_result() {
     }
 
-    public close_scanner_async_result(
+    public scanner_get_cells_result(
+      List<Cell> success,
       ClientException e)
     {
       this();
+      this.success = success;
       this.e = e;
     }
 
     /**
      * Performs a deep copy on <i>other</i>.
      */
-    public close_scanner_async_result(close_scanner_async_result other) {
+    public scanner_get_cells_result(scanner_get_cells_result other) {
+      if (other.isSetSuccess()) {
+        List<Cell> __this__success = new ArrayList<Cell>();
+        for (Cell other_element : other.success) {
+          __this__success.add(new Cell(other_element));
+        }
+        this.success = __this__success;
+      }
       if (other.isSetE()) {
         this.e = new ClientException(other.e);
       }
     }
 
-    public close_scanner_async_result deepCopy() {
-      return new close_scanner_async_result(this);
+    public scanner_get_cells_result deepCopy() {
+      return new scanner_get_cells_result(this);
     }
 
     @Override
     public void clear() {
+      this.success = null;
       this.e = null;
     }
 
+    public int getSuccessSize() {
+      return (this.success == null) ? 0 : this.success.size();
+    }
+
+    public java.util.Iterator<Cell> getSuccessIterator() {
+      return (this.success == null) ? null : this.success.iterator();
+    }
+
+    public void addToSuccess(Cell elem) {
+      if (this.success == null) {
+        this.success = new ArrayList<Cell>();
+      }
+      this.success.add(elem);
+    }
+
+    public List<Cell> getSuccess() {
+      return this.success;
+    }
+
+    public scanner_get_cells_result setSuccess(List<Cell> success) {
+      this.success = success;
+      return this;
+    }
+
+    public void unsetSuccess() {
+      this.success = null;
+    }
+
+    /** Returns true if field success is set (has been assigned a value) and false otherwise */
+    public boolean isSetSuccess() {
+      return this.success != null;
+    }
+
+    public void setSuccessIsSet(boolean value) {
+      if (!value) {
+        this.success = null;
+      }
+    }
+
     public ClientException getE() {
       return this.e;
     }
 
-    public close_scanner_async_result setE(ClientException e) {
+    public scanner_get_cells_result setE(ClientException e) {
       this.e = e;
       return this;
     }
@@ -41778,6 +42631,14 @@ public class ClientService {
 
     public void setFieldValue(_Fields field, Object value) {
       switch (field) {
+      case SUCCESS:
+        if (value == null) {
+          unsetSuccess();
+        } else {
+          setSuccess((List<Cell>)value);
+        }
+        break;
+
       case E:
         if (value == null) {
           unsetE();
@@ -41791,6 +42652,9 @@ public class ClientService {
 
     public Object getFieldValue(_Fields field) {
       switch (field) {
+      case SUCCESS:
+        return getSuccess();
+
       case E:
         return getE();
 
@@ -41805,6 +42669,8 @@ public class ClientService {
       }
 
       switch (field) {
+      case SUCCESS:
+        return isSetSuccess();
       case E:
         return isSetE();
       }
@@ -41815,15 +42681,24 @@ public class ClientService {
     public boolean equals(Object that) {
       if (that == null)
         return false;
-      if (that instanceof close_scanner_async_result)
-        return this.equals((close_scanner_async_result)that);
+      if (that instanceof scanner_get_cells_result)
+        return this.equals((scanner_get_cells_result)that);
       return false;
     }
 
-    public boolean equals(close_scanner_async_result that) {
+    public boolean equals(scanner_get_cells_result that) {
       if (that == null)
         return false;
 
+      boolean this_present_success = true && this.isSetSuccess();
+      boolean that_present_success = true && that.isSetSuccess();
+      if (this_present_success || that_present_success) {
+        if (!(this_present_success && that_present_success))
+          return false;
+        if (!this.success.equals(that.success))
+          return false;
+      }
+
       boolean this_present_e = true && this.isSetE();
       boolean that_present_e = true && that.isSetE();
       if (this_present_e || that_present_e) {
@@ -41841,14 +42716,24 @@ public class ClientService {
       return 0;
     }
 
-    public int compareTo(close_scanner_async_result other) {
+    public int compareTo(scanner_get_cells_result other) {
       if (!getClass().equals(other.getClass())) {
         return getClass().getName().compareTo(other.getClass().getName());
       }
 
       int lastComparison = 0;
-      close_scanner_async_result typedOther = (close_scanner_async_result)other;
+      scanner_get_cells_result typedOther = (scanner_get_cells_result)other;
 
+      lastComparison = Boolean.valueOf(isSetSuccess()).compareTo(typedOther.isSetSuccess());
+      if (lastComparison != 0) {
+        return lastComparison;
+      }
+      if (isSetSuccess()) {
+        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.success, typedOther.success);
+        if (lastComparison != 0) {
+          return lastComparison;
+        }
+      }
       lastComparison = Boolean.valueOf(isSetE()).compareTo(typedOther.isSetE());
       if (lastComparison != 0) {
         return lastComparison;
@@ -41876,9 +42761,17 @@ public class ClientService {
 
     @Override
     public String toString() {
-      StringBuilder sb = new StringBuilder("close_scanner_async_result(");
+      StringBuilder sb = new StringBuilder("scanner_get_cells_result(");
       boolean first = true;
 
+      sb.append("success:");
+      if (this.success == null) {
+        sb.append("null");
+      } else {
+        sb.append(this.success);
+      }
+      first = false;
+      if (!first) sb.append(", ");
       sb.append("e:");
       if (this.e == null) {
         sb.append("null");
@@ -41910,15 +42803,15 @@ public class ClientService {
       }
     }
 
-    private static class close_scanner_async_resultStandardSchemeFactory implements SchemeFactory {
-      public close_scanner_async_resultStandardScheme getScheme() {
-        return new close_scanner_async_resultStandardScheme();
+    private static class scanner_get_cells_resultStandardSchemeFactory implements SchemeFactory {
+      public scanner_get_cells_resultStandardScheme getScheme() {
+        return new scanner_get_cells_resultStandardScheme();
       }
     }
 
-    private static class close_scanner_async_resultStandardScheme extends StandardScheme<close_scanner_async_result> {
+    private static class scanner_get_cells_resultStandardScheme extends StandardScheme<scanner_get_cells_result> {
 
-      public void read(org.apache.thrift.protocol.TProtocol iprot, close_scanner_async_result struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol iprot, scanner_get_cells_result struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TField schemeField;
         iprot.readStructBegin();
         while (true)
@@ -41928,6 +42821,25 @@ public class ClientService {
             break;
           }
           switch (schemeField.id) {
+            case 0: // SUCCESS
+              if (schemeField.type == org.apache.thrift.protocol.TType.LIST) {
+                {
+                  org.apache.thrift.protocol.TList _list84 = iprot.readListBegin();
+                  struct.success = new ArrayList<Cell>(_list84.size);
+                  for (int _i85 = 0; _i85 < _list84.size; ++_i85)
+                  {
+                    Cell _elem86; // required
+                    _elem86 = new Cell();
+                    _elem86.read(iprot);
+                    struct.success.add(_elem86);
+                  }
+                  iprot.readListEnd();
+                }
+                struct.setSuccessIsSet(true);
+              } else { 
+                org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
+              }
+              break;
             case 1: // E
               if (schemeField.type == org.apache.thrift.protocol.TType.STRUCT) {
                 struct.e = new ClientException();
@@ -41948,10 +42860,22 @@ public class ClientService {
         struct.validate();
       }
 
-      public void write(org.apache.thrift.protocol.TProtocol oprot, close_scanner_async_result struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol oprot, scanner_get_cells_result struct) throws org.apache.thrift.TException {
         struct.validate();
 
         oprot.writeStructBegin(STRUCT_DESC);
+        if (struct.success != null) {
+          oprot.writeFieldBegin(SUCCESS_FIELD_DESC);
+          {
+            oprot.writeListBegin(new org.apache.thrift.protocol.TList(org.apache.thrift.protocol.TType.STRUCT, struct.success.size()));
+            for (Cell _iter87 : struct.success)
+            {
+              _iter87.write(oprot);
+            }
+            oprot.writeListEnd();
+          }
+          oprot.writeFieldEnd();
+        }
         if (struct.e != null) {
           oprot.writeFieldBegin(E_FIELD_DESC);
           struct.e.write(oprot);
@@ -41963,32 +42887,58 @@ public class ClientService {
 
     }
 
-    private static class close_scanner_async_resultTupleSchemeFactory implements SchemeFactory {
-      public close_scanner_async_resultTupleScheme getScheme() {
-        return new close_scanner_async_resultTupleScheme();
+    private static class scanner_get_cells_resultTupleSchemeFactory implements SchemeFactory {
+      public scanner_get_cells_resultTupleScheme getScheme() {
+        return new scanner_get_cells_resultTupleScheme();
       }
     }
 
-    private static class close_scanner_async_resultTupleScheme extends TupleScheme<close_scanner_async_result> {
+    private static class scanner_get_cells_resultTupleScheme extends TupleScheme<scanner_get_cells_result> {
 
       @Override
-      public void write(org.apache.thrift.protocol.TProtocol prot, close_scanner_async_result struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol prot, scanner_get_cells_result struct) throws org.apache.thrift.TException {
         TTupleProtocol oprot = (TTupleProtocol) prot;
         BitSet optionals = new BitSet();
-        if (struct.isSetE()) {
+        if (struct.isSetSuccess()) {
           optionals.set(0);
         }
-        oprot.writeBitSet(optionals, 1);
+        if (struct.isSetE()) {
+          optionals.set(1);
+        }
+        oprot.writeBitSet(optionals, 2);
+        if (struct.isSetSuccess()) {
+          {
+            oprot.writeI32(struct.success.size());
+            for (Cell _iter88 : struct.success)
+            {
+              _iter88.write(oprot);
+            }
+          }
+        }
         if (struct.isSetE()) {
           struct.e.write(oprot);
         }
       }
 
       @Override
-      public void read(org.apache.thrift.protocol.TProtocol prot, close_scanner_async_result struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol prot, scanner_get_cells_result struct) throws org.apache.thrift.TException {
         TTupleProtocol iprot = (TTupleProtocol) prot;
-        BitSet incoming = iprot.readBitSet(1);
+        BitSet incoming = iprot.readBitSet(2);
         if (incoming.get(0)) {
+          {
+            org.apache.thrift.protocol.TList _list89 = new org.apache.thrift.protocol.TList(org.apache.thrift.protocol.TType.STRUCT, iprot.readI32());
+            struct.success = new ArrayList<Cell>(_list89.size);
+            for (int _i90 = 0; _i90 < _list89.size; ++_i90)
+            {
+              Cell _elem91; // required
+              _elem91 = new Cell();
+              _elem91.read(iprot);
+              struct.success.add(_elem91);
+            }
+          }
+          struct.setSuccessIsSet(true);
+        }
+        if (incoming.get(1)) {
           struct.e = new ClientException();
           struct.e.read(iprot);
           struct.setEIsSet(true);
@@ -41998,15 +42948,15 @@ public class ClientService {
 
   }
 
-  public static class scanner_get_cells_args implements org.apache.thrift.TBase<scanner_get_cells_args, scanner_get_cells_args._Fields>, java.io.Serializable, Cloneable   {
-    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("scanner_get_cells_args");
+  public static class next_cells_args implements org.apache.thrift.TBase<next_cells_args, next_cells_args._Fields>, java.io.Serializable, Cloneable   {
+    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("next_cells_args");
 
     private static final org.apache.thrift.protocol.TField SCANNER_FIELD_DESC = new org.apache.thrift.protocol.TField("scanner", org.apache.thrift.protocol.TType.I64, (short)1);
 
     private static final Map<Class<? extends IScheme>, SchemeFactory> schemes = new HashMap<Class<? extends IScheme>, SchemeFactory>();
     static {
-      schemes.put(StandardScheme.class, new scanner_get_cells_argsStandardSchemeFactory());
-      schemes.put(TupleScheme.class, new scanner_get_cells_argsTupleSchemeFactory());
+      schemes.put(StandardScheme.class, new next_cells_argsStandardSchemeFactory());
+      schemes.put(TupleScheme.class, new next_cells_argsTupleSchemeFactory());
     }
 
     public long scanner; // required
@@ -42078,13 +43028,13 @@ public class ClientService {
       tmpMap.put(_Fields.SCANNER, new org.apache.thrift.meta_data.FieldMetaData("scanner", org.apache.thrift.TFieldRequirementType.DEFAULT, 
           new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.I64          , "Scanner")));
       metaDataMap = Collections.unmodifiableMap(tmpMap);
-      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(scanner_get_cells_args.class, metaDataMap);
+      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(next_cells_args.class, metaDataMap);
     }
 
-    public scanner_get_cells_args() {
+    public next_cells_args() {
     }
 
-    public scanner_get_cells_args(
+    public next_cells_args(
       long scanner)
     {
       this();
@@ -42095,14 +43045,14 @@ public class ClientService {
     /**
      * Performs a deep copy on <i>other</i>.
      */
-    public scanner_get_cells_args(scanner_get_cells_args other) {
+    public next_cells_args(next_cells_args other) {
       __isset_bit_vector.clear();
       __isset_bit_vector.or(other.__isset_bit_vector);
       this.scanner = other.scanner;
     }
 
-    public scanner_get_cells_args deepCopy() {
-      return new scanner_get_cells_args(this);
+    public next_cells_args deepCopy() {
+      return new next_cells_args(this);
     }
 
     @Override
@@ -42115,7 +43065,7 @@ public class ClientService {
       return this.scanner;
     }
 
-    public scanner_get_cells_args setScanner(long scanner) {
+    public next_cells_args setScanner(long scanner) {
       this.scanner = scanner;
       setScannerIsSet(true);
       return this;
@@ -42173,12 +43123,12 @@ public class ClientService {
     public boolean equals(Object that) {
       if (that == null)
         return false;
-      if (that instanceof scanner_get_cells_args)
-        return this.equals((scanner_get_cells_args)that);
+      if (that instanceof next_cells_args)
+        return this.equals((next_cells_args)that);
       return false;
     }
 
-    public boolean equals(scanner_get_cells_args that) {
+    public boolean equals(next_cells_args that) {
       if (that == null)
         return false;
 
@@ -42199,13 +43149,13 @@ public class ClientService {
       return 0;
     }
 
-    public int compareTo(scanner_get_cells_args other) {
+    public int compareTo(next_cells_args other) {
       if (!getClass().equals(other.getClass())) {
         return getClass().getName().compareTo(other.getClass().getName());
       }
 
       int lastComparison = 0;
-      scanner_get_cells_args typedOther = (scanner_get_cells_args)other;
+      next_cells_args typedOther = (next_cells_args)other;
 
       lastComparison = Boolean.valueOf(isSetScanner()).compareTo(typedOther.isSetScanner());
       if (lastComparison != 0) {
@@ -42234,7 +43184,7 @@ public class ClientService {
 
     @Override
     public String toString() {
-      StringBuilder sb = new StringBuilder("scanner_get_cells_args(");
+      StringBuilder sb = new StringBuilder("next_cells_args(");
       boolean first = true;
 
       sb.append("scanner:");
@@ -42266,15 +43216,15 @@ public class ClientService {
       }
     }
 
-    private static class scanner_get_cells_argsStandardSchemeFactory implements SchemeFactory {
-      public scanner_get_cells_argsStandardScheme getScheme() {
-        return new scanner_get_cells_argsStandardScheme();
+    private static class next_cells_argsStandardSchemeFactory implements SchemeFactory {
+      public next_cells_argsStandardScheme getScheme() {
+        return new next_cells_argsStandardScheme();
       }
     }
 
-    private static class scanner_get_cells_argsStandardScheme extends StandardScheme<scanner_get_cells_args> {
+    private static class next_cells_argsStandardScheme extends StandardScheme<next_cells_args> {
 
-      public void read(org.apache.thrift.protocol.TProtocol iprot, scanner_get_cells_args struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol iprot, next_cells_args struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TField schemeField;
         iprot.readStructBegin();
         while (true)
@@ -42303,7 +43253,7 @@ public class ClientService {
         struct.validate();
       }
 
-      public void write(org.apache.thrift.protocol.TProtocol oprot, scanner_get_cells_args struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol oprot, next_cells_args struct) throws org.apache.thrift.TException {
         struct.validate();
 
         oprot.writeStructBegin(STRUCT_DESC);
@@ -42316,16 +43266,16 @@ public class ClientService {
 
     }
 
-    private static class scanner_get_cells_argsTupleSchemeFactory implements SchemeFactory {
-      public scanner_get_cells_argsTupleScheme getScheme() {
-        return new scanner_get_cells_argsTupleScheme();
+    private static class next_cells_argsTupleSchemeFactory implements SchemeFactory {
+      public next_cells_argsTupleScheme getScheme() {
+        return new next_cells_argsTupleScheme();
       }
     }
 
-    private static class scanner_get_cells_argsTupleScheme extends TupleScheme<scanner_get_cells_args> {
+    private static class next_cells_argsTupleScheme extends TupleScheme<next_cells_args> {
 
       @Override
-      public void write(org.apache.thrift.protocol.TProtocol prot, scanner_get_cells_args struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol prot, next_cells_args struct) throws org.apache.thrift.TException {
         TTupleProtocol oprot = (TTupleProtocol) prot;
         BitSet optionals = new BitSet();
         if (struct.isSetScanner()) {
@@ -42338,7 +43288,7 @@ public class ClientService {
       }
 
       @Override
-      public void read(org.apache.thrift.protocol.TProtocol prot, scanner_get_cells_args struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol prot, next_cells_args struct) throws org.apache.thrift.TException {
         TTupleProtocol iprot = (TTupleProtocol) prot;
         BitSet incoming = iprot.readBitSet(1);
         if (incoming.get(0)) {
@@ -42350,16 +43300,16 @@ public class ClientService {
 
   }
 
-  public static class scanner_get_cells_result implements org.apache.thrift.TBase<scanner_get_cells_result, scanner_get_cells_result._Fields>, java.io.Serializable, Cloneable   {
-    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("scanner_get_cells_result");
+  public static class next_cells_result implements org.apache.thrift.TBase<next_cells_result, next_cells_result._Fields>, java.io.Serializable, Cloneable   {
+    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("next_cells_result");
 
     private static final org.apache.thrift.protocol.TField SUCCESS_FIELD_DESC = new org.apache.thrift.protocol.TField("success", org.apache.thrift.protocol.TType.LIST, (short)0);
     private static final org.apache.thrift.protocol.TField E_FIELD_DESC = new org.apache.thrift.protocol.TField("e", org.apache.thrift.protocol.TType.STRUCT, (short)1);
 
     private static final Map<Class<? extends IScheme>, SchemeFactory> schemes = new HashMap<Class<? extends IScheme>, SchemeFactory>();
     static {
-      schemes.put(StandardScheme.class, new scanner_get_cells_resultStandardSchemeFactory());
-      schemes.put(TupleScheme.class, new scanner_get_cells_resultTupleSchemeFactory());
+      schemes.put(StandardScheme.class, new next_cells_resultStandardSchemeFactory());
+      schemes.put(TupleScheme.class, new next_cells_resultTupleSchemeFactory());
     }
 
     public List<Cell> success; // required
@@ -42436,13 +43386,13 @@ public class ClientService {
       tmpMap.put(_Fields.E, new org.apache.thrift.meta_data.FieldMetaData("e", org.apache.thrift.TFieldRequirementType.DEFAULT, 
           new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.STRUCT)));
       metaDataMap = Collections.unmodifiableMap(tmpMap);
-      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(scanner_get_cells_result.class, metaDataMap);
+      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(next_cells_result.class, metaDataMap);
     }
 
-    public scanner_get_cells_result() {
+    public next_cells_result() {
     }
 
-    public scanner_get_cells_result(
+    public next_cells_result(
       List<Cell> success,
       ClientException e)
     {
@@ -42454,7 +43404,7 @@ public class ClientService {
     /**
      * Performs a deep copy on <i>other</i>.
      */
-    public scanner_get_cells_result(scanner_get_cells_result other) {
+    public next_cells_result(next_cells_result other) {
       if (other.isSetSuccess()) {
         List<Cell> __this__success = new ArrayList<Cell>();
         for (Cell other_element : other.success) {
@@ -42467,8 +43417,8 @@ public class ClientService {
       }
     }
 
-    public scanner_get_cells_result deepCopy() {
-      return new scanner_get_cells_result(this);
+    public next_cells_result deepCopy() {
+      return new next_cells_result(this);
     }
 
     @Override
@@ -42496,7 +43446,7 @@ public class ClientService {
       return this.success;
     }
 
-    public scanner_get_cells_result setSuccess(List<Cell> success) {
+    public next_cells_result setSuccess(List<Cell> success) {
       this.success = success;
       return this;
     }
@@ -42520,7 +43470,7 @@ public class ClientService {
       return this.e;
     }
 
-    public scanner_get_cells_result setE(ClientException e) {
+    public next_cells_result setE(ClientException e) {
       this.e = e;
       return this;
     }
@@ -42592,12 +43542,12 @@ public class ClientService {
     public boolean equals(Object that) {
       if (that == null)
         return false;
-      if (that instanceof scanner_get_cells_result)
-        return this.equals((scanner_get_cells_result)that);
+      if (that instanceof next_cells_result)
+        return this.equals((next_cells_result)that);
       return false;
     }
 
-    public boolean equals(scanner_get_cells_result that) {
+    public boolean equals(next_cells_result that) {
       if (that == null)
         return false;
 
@@ -42627,13 +43577,13 @@ public class ClientService {
       return 0;
     }
 
-    public int compareTo(scanner_get_cells_result other) {
+    public int compareTo(next_cells_result other) {
       if (!getClass().equals(other.getClass())) {
         return getClass().getName().compareTo(other.getClass().getName());
       }
 
       int lastComparison = 0;
-      scanner_get_cells_result typedOther = (scanner_get_cells_result)other;
+      next_cells_result typedOther = (next_cells_result)other;
 
       lastComparison = Boolean.valueOf(isSetSuccess()).compareTo(typedOther.isSetSuccess());
       if (lastComparison != 0) {
@@ -42672,7 +43622,7 @@ public class ClientService {
 
     @Override
     public String toString() {
-      StringBuilder sb = new StringBuilder("scanner_get_cells_result(");
+      StringBuilder sb = new StringBuilder("next_cells_result(");
       boolean first = true;
 
       sb.append("success:");
@@ -42714,15 +43664,15 @@ public class ClientService {
       }
     }
 
-    private static class scanner_get_cells_resultStandardSchemeFactory implements SchemeFactory {
-      public scanner_get_cells_resultStandardScheme getScheme() {
-        return new scanner_get_cells_resultStandardScheme();
+    private static class next_cells_resultStandardSchemeFactory implements SchemeFactory {
+      public next_cells_resultStandardScheme getScheme() {
+        return new next_cells_resultStandardScheme();
       }
     }
 
-    private static class scanner_get_cells_resultStandardScheme extends StandardScheme<scanner_get_cells_result> {
+    private static class next_cells_resultStandardScheme extends StandardScheme<next_cells_result> {
 
-      public void read(org.apache.thrift.protocol.TProtocol iprot, scanner_get_cells_result struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol iprot, next_cells_result struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TField schemeField;
         iprot.readStructBegin();
         while (true)
@@ -42735,14 +43685,14 @@ public class ClientService {
             case 0: // SUCCESS
               if (schemeField.type == org.apache.thrift.protocol.TType.LIST) {
                 {
-                  org.apache.thrift.protocol.TList _list84 = iprot.readListBegin();
-                  struct.success = new ArrayList<Cell>(_list84.size);
-                  for (int _i85 = 0; _i85 < _list84.size; ++_i85)
+                  org.apache.thrift.protocol.TList _list92 = iprot.readListBegin();
+                  struct.success = new ArrayList<Cell>(_list92.size);
+                  for (int _i93 = 0; _i93 < _list92.size; ++_i93)
                   {
-                    Cell _elem86; // required
-                    _elem86 = new Cell();
-                    _elem86.read(iprot);
-                    struct.success.add(_elem86);
+                    Cell _elem94; // required
+                    _elem94 = new Cell();
+                    _elem94.read(iprot);
+                    struct.success.add(_elem94);
                   }
                   iprot.readListEnd();
                 }
@@ -42771,7 +43721,7 @@ public class ClientService {
         struct.validate();
       }
 
-      public void write(org.apache.thrift.protocol.TProtocol oprot, scanner_get_cells_result struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol oprot, next_cells_result struct) throws org.apache.thrift.TException {
         struct.validate();
 
         oprot.writeStructBegin(STRUCT_DESC);
@@ -42779,9 +43729,9 @@ public class ClientService {
           oprot.writeFieldBegin(SUCCESS_FIELD_DESC);
           {
             oprot.writeListBegin(new org.apache.thrift.protocol.TList(org.apache.thrift.protocol.TType.STRUCT, struct.success.size()));
-            for (Cell _iter87 : struct.success)
+            for (Cell _iter95 : struct.success)
             {
-              _iter87.write(oprot);
+              _iter95.write(oprot);
             }
             oprot.writeListEnd();
           }
@@ -42798,16 +43748,16 @@ public class ClientService {
 
     }
 
-    private static class scanner_get_cells_resultTupleSchemeFactory implements SchemeFactory {
-      public scanner_get_cells_resultTupleScheme getScheme() {
-        return new scanner_get_cells_resultTupleScheme();
+    private static class next_cells_resultTupleSchemeFactory implements SchemeFactory {
+      public next_cells_resultTupleScheme getScheme() {
+        return new next_cells_resultTupleScheme();
       }
     }
 
-    private static class scanner_get_cells_resultTupleScheme extends TupleScheme<scanner_get_cells_result> {
+    private static class next_cells_resultTupleScheme extends TupleScheme<next_cells_result> {
 
       @Override
-      public void write(org.apache.thrift.protocol.TProtocol prot, scanner_get_cells_result struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol prot, next_cells_result struct) throws org.apache.thrift.TException {
         TTupleProtocol oprot = (TTupleProtocol) prot;
         BitSet optionals = new BitSet();
         if (struct.isSetSuccess()) {
@@ -42820,9 +43770,9 @@ public class ClientService {
         if (struct.isSetSuccess()) {
           {
             oprot.writeI32(struct.success.size());
-            for (Cell _iter88 : struct.success)
+            for (Cell _iter96 : struct.success)
             {
-              _iter88.write(oprot);
+              _iter96.write(oprot);
             }
           }
         }
@@ -42832,19 +43782,19 @@ public class ClientService {
       }
 
       @Override
-      public void read(org.apache.thrift.protocol.TProtocol prot, scanner_get_cells_result struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol prot, next_cells_result struct) throws org.apache.thrift.TException {
         TTupleProtocol iprot = (TTupleProtocol) prot;
         BitSet incoming = iprot.readBitSet(2);
         if (incoming.get(0)) {
           {
-            org.apache.thrift.protocol.TList _list89 = new org.apache.thrift.protocol.TList(org.apache.thrift.protocol.TType.STRUCT, iprot.readI32());
-            struct.success = new ArrayList<Cell>(_list89.size);
-            for (int _i90 = 0; _i90 < _list89.size; ++_i90)
+            org.apache.thrift.protocol.TList _list97 = new org.apache.thrift.protocol.TList(org.apache.thrift.protocol.TType.STRUCT, iprot.readI32());
+            struct.success = new ArrayList<Cell>(_list97.size);
+            for (int _i98 = 0; _i98 < _list97.size; ++_i98)
             {
-              Cell _elem91; // required
-              _elem91 = new Cell();
-              _elem91.read(iprot);
-              struct.success.add(_elem91);
+              Cell _elem99; // required
+              _elem99 = new Cell();
+              _elem99.read(iprot);
+              struct.success.add(_elem99);
             }
           }
           struct.setSuccessIsSet(true);
@@ -42859,15 +43809,15 @@ public class ClientService {
 
   }
 
-  public static class next_cells_args implements org.apache.thrift.TBase<next_cells_args, next_cells_args._Fields>, java.io.Serializable, Cloneable   {
-    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("next_cells_args");
+  public static class scanner_get_cells_as_arrays_args implements org.apache.thrift.TBase<scanner_get_cells_as_arrays_args, scanner_get_cells_as_arrays_args._Fields>, java.io.Serializable, Cloneable   {
+    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("scanner_get_cells_as_arrays_args");
 
     private static final org.apache.thrift.protocol.TField SCANNER_FIELD_DESC = new org.apache.thrift.protocol.TField("scanner", org.apache.thrift.protocol.TType.I64, (short)1);
 
     private static final Map<Class<? extends IScheme>, SchemeFactory> schemes = new HashMap<Class<? extends IScheme>, SchemeFactory>();
     static {
-      schemes.put(StandardScheme.class, new next_cells_argsStandardSchemeFactory());
-      schemes.put(TupleScheme.class, new next_cells_argsTupleSchemeFactory());
+      schemes.put(StandardScheme.class, new scanner_get_cells_as_arrays_argsStandardSchemeFactory());
+      schemes.put(TupleScheme.class, new scanner_get_cells_as_arrays_argsTupleSchemeFactory());
     }
 
     public long scanner; // required
@@ -42939,13 +43889,13 @@ public class ClientService {
       tmpMap.put(_Fields.SCANNER, new org.apache.thrift.meta_data.FieldMetaData("scanner", org.apache.thrift.TFieldRequirementType.DEFAULT, 
           new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.I64          , "Scanner")));
       metaDataMap = Collections.unmodifiableMap(tmpMap);
-      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(next_cells_args.class, metaDataMap);
+      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(scanner_get_cells_as_arrays_args.class, metaDataMap);
     }
 
-    public next_cells_args() {
+    public scanner_get_cells_as_arrays_args() {
     }
 
-    public next_cells_args(
+    public scanner_get_cells_as_arrays_args(
       long scanner)
     {
       this();
@@ -42956,14 +43906,14 @@ public class ClientService {
     /**
      * Performs a deep copy on <i>other</i>.
      */
-    public next_cells_args(next_cells_args other) {
+    public scanner_get_cells_as_arrays_args(scanner_get_cells_as_arrays_args other) {
       __isset_bit_vector.clear();
       __isset_bit_vector.or(other.__isset_bit_vector);
       this.scanner = other.scanner;
     }
 
-    public next_cells_args deepCopy() {
-      return new next_cells_args(this);
+    public scanner_get_cells_as_arrays_args deepCopy() {
+      return new scanner_get_cells_as_arrays_args(this);
     }
 
     @Override
@@ -42976,7 +43926,7 @@ public class ClientService {
       return this.scanner;
     }
 
-    public next_cells_args setScanner(long scanner) {
+    public scanner_get_cells_as_arrays_args setScanner(long scanner) {
       this.scanner = scanner;
       setScannerIsSet(true);
       return this;
@@ -43034,12 +43984,12 @@ public class ClientService {
     public boolean equals(Object that) {
       if (that == null)
         return false;
-      if (that instanceof next_cells_args)
-        return this.equals((next_cells_args)that);
+      if (that instanceof scanner_get_cells_as_arrays_args)
+        return this.equals((scanner_get_cells_as_arrays_args)that);
       return false;
     }
 
-    public boolean equals(next_cells_args that) {
+    public boolean equals(scanner_get_cells_as_arrays_args that) {
       if (that == null)
         return false;
 
@@ -43060,13 +44010,13 @@ public class ClientService {
       return 0;
     }
 
-    public int compareTo(next_cells_args other) {
+    public int compareTo(scanner_get_cells_as_arrays_args other) {
       if (!getClass().equals(other.getClass())) {
         return getClass().getName().compareTo(other.getClass().getName());
       }
 
       int lastComparison = 0;
-      next_cells_args typedOther = (next_cells_args)other;
+      scanner_get_cells_as_arrays_args typedOther = (scanner_get_cells_as_arrays_args)other;
 
       lastComparison = Boolean.valueOf(isSetScanner()).compareTo(typedOther.isSetScanner());
       if (lastComparison != 0) {
@@ -43095,7 +44045,7 @@ public class ClientService {
 
     @Override
     public String toString() {
-      StringBuilder sb = new StringBuilder("next_cells_args(");
+      StringBuilder sb = new StringBuilder("scanner_get_cells_as_arrays_args(");
       boolean first = true;
 
       sb.append("scanner:");
@@ -43127,15 +44077,15 @@ public class ClientService {
       }
     }
 
-    private static class next_cells_argsStandardSchemeFactory implements SchemeFactory {
-      public next_cells_argsStandardScheme getScheme() {
-        return new next_cells_argsStandardScheme();
+    private static class scanner_get_cells_as_arrays_argsStandardSchemeFactory implements SchemeFactory {
+      public scanner_get_cells_as_arrays_argsStandardScheme getScheme() {
+        return new scanner_get_cells_as_arrays_argsStandardScheme();
       }
     }
 
-    private static class next_cells_argsStandardScheme extends StandardScheme<next_cells_args> {
+    private static class scanner_get_cells_as_arrays_argsStandardScheme extends StandardScheme<scanner_get_cells_as_arrays_args> {
 
-      public void read(org.apache.thrift.protocol.TProtocol iprot, next_cells_args struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol iprot, scanner_get_cells_as_arrays_args struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TField schemeField;
         iprot.readStructBegin();
         while (true)
@@ -43164,7 +44114,7 @@ public class ClientService {
         struct.validate();
       }
 
-      public void write(org.apache.thrift.protocol.TProtocol oprot, next_cells_args struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol oprot, scanner_get_cells_as_arrays_args struct) throws org.apache.thrift.TException {
         struct.validate();
 
         oprot.writeStructBegin(STRUCT_DESC);
@@ -43177,16 +44127,16 @@ public class ClientService {
 
     }
 
-    private static class next_cells_argsTupleSchemeFactory implements SchemeFactory {
-      public next_cells_argsTupleScheme getScheme() {
-        return new next_cells_argsTupleScheme();
+    private static class scanner_get_cells_as_arrays_argsTupleSchemeFactory implements SchemeFactory {
+      public scanner_get_cells_as_arrays_argsTupleScheme getScheme() {
+        return new scanner_get_cells_as_arrays_argsTupleScheme();
       }
     }
 
-    private static class next_cells_argsTupleScheme extends TupleScheme<next_cells_args> {
+    private static class scanner_get_cells_as_arrays_argsTupleScheme extends TupleScheme<scanner_get_cells_as_arrays_args> {
 
       @Override
-      public void write(org.apache.thrift.protocol.TProtocol prot, next_cells_args struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol prot, scanner_get_cells_as_arrays_args struct) throws org.apache.thrift.TException {
         TTupleProtocol oprot = (TTupleProtocol) prot;
         BitSet optionals = new BitSet();
         if (struct.isSetScanner()) {
@@ -43199,7 +44149,7 @@ public class ClientService {
       }
 
       @Override
-      public void read(org.apache.thrift.protocol.TProtocol prot, next_cells_args struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol prot, scanner_get_cells_as_arrays_args struct) throws org.apache.thrift.TException {
         TTupleProtocol iprot = (TTupleProtocol) prot;
         BitSet incoming = iprot.readBitSet(1);
         if (incoming.get(0)) {
@@ -43211,19 +44161,19 @@ public class ClientService {
 
   }
 
-  public static class next_cells_result implements org.apache.thrift.TBase<next_cells_result, next_cells_result._Fields>, java.io.Serializable, Cloneable   {
-    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("next_cells_result");
+  public static class scanner_get_cells_as_arrays_result implements org.apache.thrift.TBase<scanner_get_cells_as_arrays_result, scanner_get_cells_as_arrays_result._Fields>, java.io.Serializable, Cloneable   {
+    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("scanner_get_cells_as_arrays_result");
 
     private static final org.apache.thrift.protocol.TField SUCCESS_FIELD_DESC = new org.apache.thrift.protocol.TField("success", org.apache.thrift.protocol.TType.LIST, (short)0);
     private static final org.apache.thrift.protocol.TField E_FIELD_DESC = new org.apache.thrift.protocol.TField("e", org.apache.thrift.protocol.TType.STRUCT, (short)1);
 
     private static final Map<Class<? extends IScheme>, SchemeFactory> schemes = new HashMap<Class<? extends IScheme>, SchemeFactory>();
     static {
-      schemes.put(StandardScheme.class, new next_cells_resultStandardSchemeFactory());
-      schemes.put(TupleScheme.class, new next_cells_resultTupleSchemeFactory());
+      schemes.put(StandardScheme.class, new scanner_get_cells_as_arrays_resultStandardSchemeFactory());
+      schemes.put(TupleScheme.class, new scanner_get_cells_as_arrays_resultTupleSchemeFactory());
     }
 
-    public List<Cell> success; // required
+    public List<List<String>> success; // required
     public ClientException e; // required
 
     /** The set of fields this struct contains, along with convenience methods for finding and manipulating them. */
@@ -43293,18 +44243,18 @@ public class ClientService {
       Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> tmpMap = new EnumMap<_Fields, org.apache.thrift.meta_data.FieldMetaData>(_Fields.class);
       tmpMap.put(_Fields.SUCCESS, new org.apache.thrift.meta_data.FieldMetaData("success", org.apache.thrift.TFieldRequirementType.DEFAULT, 
           new org.apache.thrift.meta_data.ListMetaData(org.apache.thrift.protocol.TType.LIST, 
-              new org.apache.thrift.meta_data.StructMetaData(org.apache.thrift.protocol.TType.STRUCT, Cell.class))));
+              new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.LIST              , "CellAsArray"))));
       tmpMap.put(_Fields.E, new org.apache.thrift.meta_data.FieldMetaData("e", org.apache.thrift.TFieldRequirementType.DEFAULT, 
           new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.STRUCT)));
       metaDataMap = Collections.unmodifiableMap(tmpMap);
-      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(next_cells_result.class, metaDataMap);
+      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(scanner_get_cells_as_arrays_result.class, metaDataMap);
     }
 
-    public next_cells_result() {
+    public scanner_get_cells_as_arrays_result() {
     }
 
-    public next_cells_result(
-      List<Cell> success,
+    public scanner_get_cells_as_arrays_result(
+      List<List<String>> success,
       ClientException e)
     {
       this();
@@ -43315,11 +44265,11 @@ public class ClientService {
     /**
      * Performs a deep copy on <i>other</i>.
      */
-    public next_cells_result(next_cells_result other) {
+    public scanner_get_cells_as_arrays_result(scanner_get_cells_as_arrays_result other) {
       if (other.isSetSuccess()) {
-        List<Cell> __this__success = new ArrayList<Cell>();
-        for (Cell other_element : other.success) {
-          __this__success.add(new Cell(other_element));
+        List<List<String>> __this__success = new ArrayList<List<String>>();
+        for (List<String> other_element : other.success) {
+          __this__success.add(other_element);
         }
         this.success = __this__success;
       }
@@ -43328,8 +44278,8 @@ public class ClientService {
       }
     }
 
-    public next_cells_result deepCopy() {
-      return new next_cells_result(this);
+    public scanner_get_cells_as_arrays_result deepCopy() {
+      return new scanner_get_cells_as_arrays_result(this);
     }
 
     @Override
@@ -43342,22 +44292,22 @@ public class ClientService {
       return (this.success == null) ? 0 : this.success.size();
     }
 
-    public java.util.Iterator<Cell> getSuccessIterator() {
+    public java.util.Iterator<List<String>> getSuccessIterator() {
       return (this.success == null) ? null : this.success.iterator();
     }
 
-    public void addToSuccess(Cell elem) {
+    public void addToSuccess(List<String> elem) {
       if (this.success == null) {
-        this.success = new ArrayList<Cell>();
+        this.success = new ArrayList<List<String>>();
       }
       this.success.add(elem);
     }
 
-    public List<Cell> getSuccess() {
+    public List<List<String>> getSuccess() {
       return this.success;
     }
 
-    public next_cells_result setSuccess(List<Cell> success) {
+    public scanner_get_cells_as_arrays_result setSuccess(List<List<String>> success) {
       this.success = success;
       return this;
     }
@@ -43381,7 +44331,7 @@ public class ClientService {
       return this.e;
     }
 
-    public next_cells_result setE(ClientException e) {
+    public scanner_get_cells_as_arrays_result setE(ClientException e) {
       this.e = e;
       return this;
     }
@@ -43407,7 +44357,7 @@ public class ClientService {
         if (value == null) {
           unsetSuccess();
         } else {
-          setSuccess((List<Cell>)value);
+          setSuccess((List<List<String>>)value);
         }
         break;
 
@@ -43453,12 +44403,12 @@ public class ClientService {
     public boolean equals(Object that) {
       if (that == null)
         return false;
-      if (that instanceof next_cells_result)
-        return this.equals((next_cells_result)that);
+      if (that instanceof scanner_get_cells_as_arrays_result)
+        return this.equals((scanner_get_cells_as_arrays_result)that);
       return false;
     }
 
-    public boolean equals(next_cells_result that) {
+    public boolean equals(scanner_get_cells_as_arrays_result that) {
       if (that == null)
         return false;
 
@@ -43488,13 +44438,13 @@ public class ClientService {
       return 0;
     }
 
-    public int compareTo(next_cells_result other) {
+    public int compareTo(scanner_get_cells_as_arrays_result other) {
       if (!getClass().equals(other.getClass())) {
         return getClass().getName().compareTo(other.getClass().getName());
       }
 
       int lastComparison = 0;
-      next_cells_result typedOther = (next_cells_result)other;
+      scanner_get_cells_as_arrays_result typedOther = (scanner_get_cells_as_arrays_result)other;
 
       lastComparison = Boolean.valueOf(isSetSuccess()).compareTo(typedOther.isSetSuccess());
       if (lastComparison != 0) {
@@ -43533,7 +44483,7 @@ public class ClientService {
 
     @Override
     public String toString() {
-      StringBuilder sb = new StringBuilder("next_cells_result(");
+      StringBuilder sb = new StringBuilder("scanner_get_cells_as_arrays_result(");
       boolean first = true;
 
       sb.append("success:");
@@ -43575,15 +44525,15 @@ public class ClientService {
       }
     }
 
-    private static class next_cells_resultStandardSchemeFactory implements SchemeFactory {
-      public next_cells_resultStandardScheme getScheme() {
-        return new next_cells_resultStandardScheme();
+    private static class scanner_get_cells_as_arrays_resultStandardSchemeFactory implements SchemeFactory {
+      public scanner_get_cells_as_arrays_resultStandardScheme getScheme() {
+        return new scanner_get_cells_as_arrays_resultStandardScheme();
       }
     }
 
-    private static class next_cells_resultStandardScheme extends StandardScheme<next_cells_result> {
+    private static class scanner_get_cells_as_arrays_resultStandardScheme extends StandardScheme<scanner_get_cells_as_arrays_result> {
 
-      public void read(org.apache.thrift.protocol.TProtocol iprot, next_cells_result struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol iprot, scanner_get_cells_as_arrays_result struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TField schemeField;
         iprot.readStructBegin();
         while (true)
@@ -43596,14 +44546,23 @@ public class ClientService {
             case 0: // SUCCESS
               if (schemeField.type == org.apache.thrift.protocol.TType.LIST) {
                 {
-                  org.apache.thrift.protocol.TList _list92 = iprot.readListBegin();
-                  struct.success = new ArrayList<Cell>(_list92.size);
-                  for (int _i93 = 0; _i93 < _list92.size; ++_i93)
+                  org.apache.thrift.protocol.TList _list100 = iprot.readListBegin();
+                  struct.success = new ArrayList<List<String>>(_list100.size);
+                  for (int _i101 = 0; _i101 < _list100.size; ++_i101)
                   {
-                    Cell _elem94; // required
-                    _elem94 = new Cell();
-                    _elem94.read(iprot);
-                    struct.success.add(_elem94);
+                    List<String> _elem102; // required
+                    {
+                      org.apache.thrift.protocol.TList _list103 = iprot.readListBegin();
+                      _elem102 = new ArrayList<String>(_list103.size);
+                      for (int _i104 = 0; _i104 < _list103.size; ++_i104)
+                      {
+                        String _elem105; // required
+                        _elem105 = iprot.readString();
+                        _elem102.add(_elem105);
+                      }
+                      iprot.readListEnd();
+                    }
+                    struct.success.add(_elem102);
                   }
                   iprot.readListEnd();
                 }
@@ -43632,17 +44591,24 @@ public class ClientService {
         struct.validate();
       }
 
-      public void write(org.apache.thrift.protocol.TProtocol oprot, next_cells_result struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol oprot, scanner_get_cells_as_arrays_result struct) throws org.apache.thrift.TException {
         struct.validate();
 
         oprot.writeStructBegin(STRUCT_DESC);
         if (struct.success != null) {
           oprot.writeFieldBegin(SUCCESS_FIELD_DESC);
           {
-            oprot.writeListBegin(new org.apache.thrift.protocol.TList(org.apache.thrift.protocol.TType.STRUCT, struct.success.size()));
-            for (Cell _iter95 : struct.success)
+            oprot.writeListBegin(new org.apache.thrift.protocol.TList(org.apache.thrift.protocol.TType.LIST, struct.success.size()));
+            for (List<String> _iter106 : struct.success)
             {
-              _iter95.write(oprot);
+              {
+                oprot.writeListBegin(new org.apache.thrift.protocol.TList(org.apache.thrift.protocol.TType.STRING, _iter106.size()));
+                for (String _iter107 : _iter106)
+                {
+                  oprot.writeString(_iter107);
+                }
+                oprot.writeListEnd();
+              }
             }
             oprot.writeListEnd();
           }
@@ -43659,16 +44625,16 @@ public class ClientService {
 
     }
 
-    private static class next_cells_resultTupleSchemeFactory implements SchemeFactory {
-      public next_cells_resultTupleScheme getScheme() {
-        return new next_cells_resultTupleScheme();
+    private static class scanner_get_cells_as_arrays_resultTupleSchemeFactory implements SchemeFactory {
+      public scanner_get_cells_as_arrays_resultTupleScheme getScheme() {
+        return new scanner_get_cells_as_arrays_resultTupleScheme();
       }
     }
 
-    private static class next_cells_resultTupleScheme extends TupleScheme<next_cells_result> {
+    private static class scanner_get_cells_as_arrays_resultTupleScheme extends TupleScheme<scanner_get_cells_as_arrays_result> {
 
       @Override
-      public void write(org.apache.thrift.protocol.TProtocol prot, next_cells_result struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol prot, scanner_get_cells_as_arrays_result struct) throws org.apache.thrift.TException {
         TTupleProtocol oprot = (TTupleProtocol) prot;
         BitSet optionals = new BitSet();
         if (struct.isSetSuccess()) {
@@ -43681,9 +44647,15 @@ public class ClientService {
         if (struct.isSetSuccess()) {
           {
             oprot.writeI32(struct.success.size());
-            for (Cell _iter96 : struct.success)
+            for (List<String> _iter108 : struct.success)
             {
-              _iter96.write(oprot);
+              {
+                oprot.writeI32(_iter108.size());
+                for (String _iter109 : _iter108)
+                {
+                  oprot.writeString(_iter109);
+                }
+              }
             }
           }
         }
@@ -43693,19 +44665,27 @@ public class ClientService {
       }
 
       @Override
-      public void read(org.apache.thrift.protocol.TProtocol prot, next_cells_result struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol prot, scanner_get_cells_as_arrays_result struct) throws org.apache.thrift.TException {
         TTupleProtocol iprot = (TTupleProtocol) prot;
         BitSet incoming = iprot.readBitSet(2);
         if (incoming.get(0)) {
           {
-            org.apache.thrift.protocol.TList _list97 = new org.apache.thrift.protocol.TList(org.apache.thrift.protocol.TType.STRUCT, iprot.readI32());
-            struct.success = new ArrayList<Cell>(_list97.size);
-            for (int _i98 = 0; _i98 < _list97.size; ++_i98)
+            org.apache.thrift.protocol.TList _list110 = new org.apache.thrift.protocol.TList(org.apache.thrift.protocol.TType.LIST, iprot.readI32());
+            struct.success = new ArrayList<List<String>>(_list110.size);
+            for (int _i111 = 0; _i111 < _list110.size; ++_i111)
             {
-              Cell _elem99; // required
-              _elem99 = new Cell();
-              _elem99.read(iprot);
-              struct.success.add(_elem99);
+              List<String> _elem112; // required
+              {
+                org.apache.thrift.protocol.TList _list113 = new org.apache.thrift.protocol.TList(org.apache.thrift.protocol.TType.STRING, iprot.readI32());
+                _elem112 = new ArrayList<String>(_list113.size);
+                for (int _i114 = 0; _i114 < _list113.size; ++_i114)
+                {
+                  String _elem115; // required
+                  _elem115 = iprot.readString();
+                  _elem112.add(_elem115);
+                }
+              }
+              struct.success.add(_elem112);
             }
           }
           struct.setSuccessIsSet(true);
@@ -43720,15 +44700,15 @@ public class ClientService {
 
   }
 
-  public static class scanner_get_cells_as_arrays_args implements org.apache.thrift.TBase<scanner_get_cells_as_arrays_args, scanner_get_cells_as_arrays_args._Fields>, java.io.Serializable, Cloneable   {
-    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("scanner_get_cells_as_arrays_args");
+  public static class next_cells_as_arrays_args implements org.apache.thrift.TBase<next_cells_as_arrays_args, next_cells_as_arrays_args._Fields>, java.io.Serializable, Cloneable   {
+    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("next_cells_as_arrays_args");
 
     private static final org.apache.thrift.protocol.TField SCANNER_FIELD_DESC = new org.apache.thrift.protocol.TField("scanner", org.apache.thrift.protocol.TType.I64, (short)1);
 
     private static final Map<Class<? extends IScheme>, SchemeFactory> schemes = new HashMap<Class<? extends IScheme>, SchemeFactory>();
     static {
-      schemes.put(StandardScheme.class, new scanner_get_cells_as_arrays_argsStandardSchemeFactory());
-      schemes.put(TupleScheme.class, new scanner_get_cells_as_arrays_argsTupleSchemeFactory());
+      schemes.put(StandardScheme.class, new next_cells_as_arrays_argsStandardSchemeFactory());
+      schemes.put(TupleScheme.class, new next_cells_as_arrays_argsTupleSchemeFactory());
     }
 
     public long scanner; // required
@@ -43800,13 +44780,13 @@ public class ClientService {
       tmpMap.put(_Fields.SCANNER, new org.apache.thrift.meta_data.FieldMetaData("scanner", org.apache.thrift.TFieldRequirementType.DEFAULT, 
           new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.I64          , "Scanner")));
       metaDataMap = Collections.unmodifiableMap(tmpMap);
-      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(scanner_get_cells_as_arrays_args.class, metaDataMap);
+      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(next_cells_as_arrays_args.class, metaDataMap);
     }
 
-    public scanner_get_cells_as_arrays_args() {
+    public next_cells_as_arrays_args() {
     }
 
-    public scanner_get_cells_as_arrays_args(
+    public next_cells_as_arrays_args(
       long scanner)
     {
       this();
@@ -43817,14 +44797,14 @@ public class ClientService {
     /**
      * Performs a deep copy on <i>other</i>.
      */
-    public scanner_get_cells_as_arrays_args(scanner_get_cells_as_arrays_args other) {
+    public next_cells_as_arrays_args(next_cells_as_arrays_args other) {
       __isset_bit_vector.clear();
       __isset_bit_vector.or(other.__isset_bit_vector);
       this.scanner = other.scanner;
     }
 
-    public scanner_get_cells_as_arrays_args deepCopy() {
-      return new scanner_get_cells_as_arrays_args(this);
+    public next_cells_as_arrays_args deepCopy() {
+      return new next_cells_as_arrays_args(this);
     }
 
     @Override
@@ -43837,7 +44817,7 @@ public class ClientService {
       return this.scanner;
     }
 
-    public scanner_get_cells_as_arrays_args setScanner(long scanner) {
+    public next_cells_as_arrays_args setScanner(long scanner) {
       this.scanner = scanner;
       setScannerIsSet(true);
       return this;
@@ -43895,12 +44875,12 @@ public class ClientService {
     public boolean equals(Object that) {
       if (that == null)
         return false;
-      if (that instanceof scanner_get_cells_as_arrays_args)
-        return this.equals((scanner_get_cells_as_arrays_args)that);
+      if (that instanceof next_cells_as_arrays_args)
+        return this.equals((next_cells_as_arrays_args)that);
       return false;
     }
 
-    public boolean equals(scanner_get_cells_as_arrays_args that) {
+    public boolean equals(next_cells_as_arrays_args that) {
       if (that == null)
         return false;
 
@@ -43921,13 +44901,13 @@ public class ClientService {
       return 0;
     }
 
-    public int compareTo(scanner_get_cells_as_arrays_args other) {
+    public int compareTo(next_cells_as_arrays_args other) {
       if (!getClass().equals(other.getClass())) {
         return getClass().getName().compareTo(other.getClass().getName());
       }
 
       int lastComparison = 0;
-      scanner_get_cells_as_arrays_args typedOther = (scanner_get_cells_as_arrays_args)other;
+      next_cells_as_arrays_args typedOther = (next_cells_as_arrays_args)other;
 
       lastComparison = Boolean.valueOf(isSetScanner()).compareTo(typedOther.isSetScanner());
       if (lastComparison != 0) {
@@ -43956,7 +44936,7 @@ public class ClientService {
 
     @Override
     public String toString() {
-      StringBuilder sb = new StringBuilder("scanner_get_cells_as_arrays_args(");
+      StringBuilder sb = new StringBuilder("next_cells_as_arrays_args(");
       boolean first = true;
 
       sb.append("scanner:");
@@ -43988,15 +44968,15 @@ public class ClientService {
       }
     }
 
-    private static class scanner_get_cells_as_arrays_argsStandardSchemeFactory implements SchemeFactory {
-      public scanner_get_cells_as_arrays_argsStandardScheme getScheme() {
-        return new scanner_get_cells_as_arrays_argsStandardScheme();
+    private static class next_cells_as_arrays_argsStandardSchemeFactory implements SchemeFactory {
+      public next_cells_as_arrays_argsStandardScheme getScheme() {
+        return new next_cells_as_arrays_argsStandardScheme();
       }
     }
 
-    private static class scanner_get_cells_as_arrays_argsStandardScheme extends StandardScheme<scanner_get_cells_as_arrays_args> {
+    private static class next_cells_as_arrays_argsStandardScheme extends StandardScheme<next_cells_as_arrays_args> {
 
-      public void read(org.apache.thrift.protocol.TProtocol iprot, scanner_get_cells_as_arrays_args struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol iprot, next_cells_as_arrays_args struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TField schemeField;
         iprot.readStructBegin();
         while (true)
@@ -44025,7 +45005,7 @@ public class ClientService {
         struct.validate();
       }
 
-      public void write(org.apache.thrift.protocol.TProtocol oprot, scanner_get_cells_as_arrays_args struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol oprot, next_cells_as_arrays_args struct) throws org.apache.thrift.TException {
         struct.validate();
 
         oprot.writeStructBegin(STRUCT_DESC);
@@ -44038,16 +45018,16 @@ public class ClientService {
 
     }
 
-    private static class scanner_get_cells_as_arrays_argsTupleSchemeFactory implements SchemeFactory {
-      public scanner_get_cells_as_arrays_argsTupleScheme getScheme() {
-        return new scanner_get_cells_as_arrays_argsTupleScheme();
+    private static class next_cells_as_arrays_argsTupleSchemeFactory implements SchemeFactory {
+      public next_cells_as_arrays_argsTupleScheme getScheme() {
+        return new next_cells_as_arrays_argsTupleScheme();
       }
     }
 
-    private static class scanner_get_cells_as_arrays_argsTupleScheme extends TupleScheme<scanner_get_cells_as_arrays_args> {
+    private static class next_cells_as_arrays_argsTupleScheme extends TupleScheme<next_cells_as_arrays_args> {
 
       @Override
-      public void write(org.apache.thrift.protocol.TProtocol prot, scanner_get_cells_as_arrays_args struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol prot, next_cells_as_arrays_args struct) throws org.apache.thrift.TException {
         TTupleProtocol oprot = (TTupleProtocol) prot;
         BitSet optionals = new BitSet();
         if (struct.isSetScanner()) {
@@ -44060,7 +45040,7 @@ public class ClientService {
       }
 
       @Override
-      public void read(org.apache.thrift.protocol.TProtocol prot, scanner_get_cells_as_arrays_args struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol prot, next_cells_as_arrays_args struct) throws org.apache.thrift.TException {
         TTupleProtocol iprot = (TTupleProtocol) prot;
         BitSet incoming = iprot.readBitSet(1);
         if (incoming.get(0)) {
@@ -44072,16 +45052,16 @@ public class ClientService {
 
   }
 
-  public static class scanner_get_cells_as_arrays_result implements org.apache.thrift.TBase<scanner_get_cells_as_arrays_result, scanner_get_cells_as_arrays_result._Fields>, java.io.Serializable, Cloneable   {
-    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("scanner_get_cells_as_arrays_result");
+  public static class next_cells_as_arrays_result implements org.apache.thrift.TBase<next_cells_as_arrays_result, next_cells_as_arrays_result._Fields>, java.io.Serializable, Cloneable   {
+    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("next_cells_as_arrays_result");
 
     private static final org.apache.thrift.protocol.TField SUCCESS_FIELD_DESC = new org.apache.thrift.protocol.TField("success", org.apache.thrift.protocol.TType.LIST, (short)0);
     private static final org.apache.thrift.protocol.TField E_FIELD_DESC = new org.apache.thrift.protocol.TField("e", org.apache.thrift.protocol.TType.STRUCT, (short)1);
 
     private static final Map<Class<? extends IScheme>, SchemeFactory> schemes = new HashMap<Class<? extends IScheme>, SchemeFactory>();
     static {
-      schemes.put(StandardScheme.class, new scanner_get_cells_as_arrays_resultStandardSchemeFactory());
-      schemes.put(TupleScheme.class, new scanner_get_cells_as_arrays_resultTupleSchemeFactory());
+      schemes.put(StandardScheme.class, new next_cells_as_arrays_resultStandardSchemeFactory());
+      schemes.put(TupleScheme.class, new next_cells_as_arrays_resultTupleSchemeFactory());
     }
 
     public List<List<String>> success; // required
@@ -44158,13 +45138,13 @@ public class ClientService {
       tmpMap.put(_Fields.E, new org.apache.thrift.meta_data.FieldMetaData("e", org.apache.thrift.TFieldRequirementType.DEFAULT, 
           new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.STRUCT)));
       metaDataMap = Collections.unmodifiableMap(tmpMap);
-      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(scanner_get_cells_as_arrays_result.class, metaDataMap);
+      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(next_cells_as_arrays_result.class, metaDataMap);
     }
 
-    public scanner_get_cells_as_arrays_result() {
+    public next_cells_as_arrays_result() {
     }
 
-    public scanner_get_cells_as_arrays_result(
+    public next_cells_as_arrays_result(
       List<List<String>> success,
       ClientException e)
     {
@@ -44176,7 +45156,7 @@ public class ClientService {
     /**
      * Performs a deep copy on <i>other</i>.
      */
-    public scanner_get_cells_as_arrays_result(scanner_get_cells_as_arrays_result other) {
+    public next_cells_as_arrays_result(next_cells_as_arrays_result other) {
       if (other.isSetSuccess()) {
         List<List<String>> __this__success = new ArrayList<List<String>>();
         for (List<String> other_element : other.success) {
@@ -44189,8 +45169,8 @@ public class ClientService {
       }
     }
 
-    public scanner_get_cells_as_arrays_result deepCopy() {
-      return new scanner_get_cells_as_arrays_result(this);
+    public next_cells_as_arrays_result deepCopy() {
+      return new next_cells_as_arrays_result(this);
     }
 
     @Override
@@ -44218,7 +45198,7 @@ public class ClientService {
       return this.success;
     }
 
-    public scanner_get_cells_as_arrays_result setSuccess(List<List<String>> success) {
+    public next_cells_as_arrays_result setSuccess(List<List<String>> success) {
       this.success = success;
       return this;
     }
@@ -44242,7 +45222,7 @@ public class ClientService {
       return this.e;
     }
 
-    public scanner_get_cells_as_arrays_result setE(ClientException e) {
+    public next_cells_as_arrays_result setE(ClientException e) {
       this.e = e;
       return this;
     }
@@ -44314,12 +45294,12 @@ public class ClientService {
     public boolean equals(Object that) {
       if (that == null)
         return false;
-      if (that instanceof scanner_get_cells_as_arrays_result)
-        return this.equals((scanner_get_cells_as_arrays_result)that);
+      if (that instanceof next_cells_as_arrays_result)
+        return this.equals((next_cells_as_arrays_result)that);
       return false;
     }
 
-    public boolean equals(scanner_get_cells_as_arrays_result that) {
+    public boolean equals(next_cells_as_arrays_result that) {
       if (that == null)
         return false;
 
@@ -44349,13 +45329,13 @@ public class ClientService {
       return 0;
     }
 
-    public int compareTo(scanner_get_cells_as_arrays_result other) {
+    public int compareTo(next_cells_as_arrays_result other) {
       if (!getClass().equals(other.getClass())) {
         return getClass().getName().compareTo(other.getClass().getName());
       }
 
       int lastComparison = 0;
-      scanner_get_cells_as_arrays_result typedOther = (scanner_get_cells_as_arrays_result)other;
+      next_cells_as_arrays_result typedOther = (next_cells_as_arrays_result)other;
 
       lastComparison = Boolean.valueOf(isSetSuccess()).compareTo(typedOther.isSetSuccess());
       if (lastComparison != 0) {
@@ -44394,7 +45374,7 @@ public class ClientService {
 
     @Override
     public String toString() {
-      StringBuilder sb = new StringBuilder("scanner_get_cells_as_arrays_result(");
+      StringBuilder sb = new StringBuilder("next_cells_as_arrays_result(");
       boolean first = true;
 
       sb.append("success:");
@@ -44436,15 +45416,15 @@ public class ClientService {
       }
     }
 
-    private static class scanner_get_cells_as_arrays_resultStandardSchemeFactory implements SchemeFactory {
-      public scanner_get_cells_as_arrays_resultStandardScheme getScheme() {
-        return new scanner_get_cells_as_arrays_resultStandardScheme();
+    private static class next_cells_as_arrays_resultStandardSchemeFactory implements SchemeFactory {
+      public next_cells_as_arrays_resultStandardScheme getScheme() {
+        return new next_cells_as_arrays_resultStandardScheme();
       }
     }
 
-    private static class scanner_get_cells_as_arrays_resultStandardScheme extends StandardScheme<scanner_get_cells_as_arrays_result> {
+    private static class next_cells_as_arrays_resultStandardScheme extends StandardScheme<next_cells_as_arrays_result> {
 
-      public void read(org.apache.thrift.protocol.TProtocol iprot, scanner_get_cells_as_arrays_result struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol iprot, next_cells_as_arrays_result struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TField schemeField;
         iprot.readStructBegin();
         while (true)
@@ -44457,23 +45437,23 @@ public class ClientService {
             case 0: // SUCCESS
               if (schemeField.type == org.apache.thrift.protocol.TType.LIST) {
                 {
-                  org.apache.thrift.protocol.TList _list100 = iprot.readListBegin();
-                  struct.success = new ArrayList<List<String>>(_list100.size);
-                  for (int _i101 = 0; _i101 < _list100.size; ++_i101)
+                  org.apache.thrift.protocol.TList _list116 = iprot.readListBegin();
+                  struct.success = new ArrayList<List<String>>(_list116.size);
+                  for (int _i117 = 0; _i117 < _list116.size; ++_i117)
                   {
-                    List<String> _elem102; // required
+                    List<String> _elem118; // required
                     {
-                      org.apache.thrift.protocol.TList _list103 = iprot.readListBegin();
-                      _elem102 = new ArrayList<String>(_list103.size);
-                      for (int _i104 = 0; _i104 < _list103.size; ++_i104)
+                      org.apache.thrift.protocol.TList _list119 = iprot.readListBegin();
+                      _elem118 = new ArrayList<String>(_list119.size);
+                      for (int _i120 = 0; _i120 < _list119.size; ++_i120)
                       {
-                        String _elem105; // required
-                        _elem105 = iprot.readString();
-                        _elem102.add(_elem105);
+                        String _elem121; // required
+                        _elem121 = iprot.readString();
+                        _elem118.add(_elem121);
                       }
                       iprot.readListEnd();
                     }
-                    struct.success.add(_elem102);
+                    struct.success.add(_elem118);
                   }
                   iprot.readListEnd();
                 }
@@ -44502,7 +45482,7 @@ public class ClientService {
         struct.validate();
       }
 
-      public void write(org.apache.thrift.protocol.TProtocol oprot, scanner_get_cells_as_arrays_result struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol oprot, next_cells_as_arrays_result struct) throws org.apache.thrift.TException {
         struct.validate();
 
         oprot.writeStructBegin(STRUCT_DESC);
@@ -44510,13 +45490,13 @@ public class ClientService {
           oprot.writeFieldBegin(SUCCESS_FIELD_DESC);
           {
             oprot.writeListBegin(new org.apache.thrift.protocol.TList(org.apache.thrift.protocol.TType.LIST, struct.success.size()));
-            for (List<String> _iter106 : struct.success)
+            for (List<String> _iter122 : struct.success)
             {
               {
-                oprot.writeListBegin(new org.apache.thrift.protocol.TList(org.apache.thrift.protocol.TType.STRING, _iter106.size()));
-                for (String _iter107 : _iter106)
+                oprot.writeListBegin(new org.apache.thrift.protocol.TList(org.apache.thrift.protocol.TType.STRING, _iter122.size()));
+                for (String _iter123 : _iter122)
                 {
-                  oprot.writeString(_iter107);
+                  oprot.writeString(_iter123);
                 }
                 oprot.writeListEnd();
               }
@@ -44536,16 +45516,16 @@ public class ClientService {
 
     }
 
-    private static class scanner_get_cells_as_arrays_resultTupleSchemeFactory implements SchemeFactory {
-      public scanner_get_cells_as_arrays_resultTupleScheme getScheme() {
-        return new scanner_get_cells_as_arrays_resultTupleScheme();
+    private static class next_cells_as_arrays_resultTupleSchemeFactory implements SchemeFactory {
+      public next_cells_as_arrays_resultTupleScheme getScheme() {
+        return new next_cells_as_arrays_resultTupleScheme();
       }
     }
 
-    private static class scanner_get_cells_as_arrays_resultTupleScheme extends TupleScheme<scanner_get_cells_as_arrays_result> {
+    private static class next_cells_as_arrays_resultTupleScheme extends TupleScheme<next_cells_as_arrays_result> {
 
       @Override
-      public void write(org.apache.thrift.protocol.TProtocol prot, scanner_get_cells_as_arrays_result struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol prot, next_cells_as_arrays_result struct) throws org.apache.thrift.TException {
         TTupleProtocol oprot = (TTupleProtocol) prot;
         BitSet optionals = new BitSet();
         if (struct.isSetSuccess()) {
@@ -44558,13 +45538,13 @@ public class ClientService {
         if (struct.isSetSuccess()) {
           {
             oprot.writeI32(struct.success.size());
-            for (List<String> _iter108 : struct.success)
+            for (List<String> _iter124 : struct.success)
             {
               {
-                oprot.writeI32(_iter108.size());
-                for (String _iter109 : _iter108)
+                oprot.writeI32(_iter124.size());
+                for (String _iter125 : _iter124)
                 {
-                  oprot.writeString(_iter109);
+                  oprot.writeString(_iter125);
                 }
               }
             }
@@ -44576,27 +45556,27 @@ public class ClientService {
       }
 
       @Override
-      public void read(org.apache.thrift.protocol.TProtocol prot, scanner_get_cells_as_arrays_result struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol prot, next_cells_as_arrays_result struct) throws org.apache.thrift.TException {
         TTupleProtocol iprot = (TTupleProtocol) prot;
         BitSet incoming = iprot.readBitSet(2);
         if (incoming.get(0)) {
           {
-            org.apache.thrift.protocol.TList _list110 = new org.apache.thrift.protocol.TList(org.apache.thrift.protocol.TType.LIST, iprot.readI32());
-            struct.success = new ArrayList<List<String>>(_list110.size);
-            for (int _i111 = 0; _i111 < _list110.size; ++_i111)
+            org.apache.thrift.protocol.TList _list126 = new org.apache.thrift.protocol.TList(org.apache.thrift.protocol.TType.LIST, iprot.readI32());
+            struct.success = new ArrayList<List<String>>(_list126.size);
+            for (int _i127 = 0; _i127 < _list126.size; ++_i127)
             {
-              List<String> _elem112; // required
+              List<String> _elem128; // required
               {
-                org.apache.thrift.protocol.TList _list113 = new org.apache.thrift.protocol.TList(org.apache.thrift.protocol.TType.STRING, iprot.readI32());
-                _elem112 = new ArrayList<String>(_list113.size);
-                for (int _i114 = 0; _i114 < _list113.size; ++_i114)
+                org.apache.thrift.protocol.TList _list129 = new org.apache.thrift.protocol.TList(org.apache.thrift.protocol.TType.STRING, iprot.readI32());
+                _elem128 = new ArrayList<String>(_list129.size);
+                for (int _i130 = 0; _i130 < _list129.size; ++_i130)
                 {
-                  String _elem115; // required
-                  _elem115 = iprot.readString();
-                  _elem112.add(_elem115);
+                  String _elem131; // required
+                  _elem131 = iprot.readString();
+                  _elem128.add(_elem131);
                 }
               }
-              struct.success.add(_elem112);
+              struct.success.add(_elem128);
             }
           }
           struct.setSuccessIsSet(true);
@@ -44611,15 +45591,15 @@ public class ClientService {
 
   }
 
-  public static class next_cells_as_arrays_args implements org.apache.thrift.TBase<next_cells_as_arrays_args, next_cells_as_arrays_args._Fields>, java.io.Serializable, Cloneable   {
-    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("next_cells_as_arrays_args");
+  public static class scanner_get_cells_serialized_args implements org.apache.thrift.TBase<scanner_get_cells_serialized_args, scanner_get_cells_serialized_args._Fields>, java.io.Serializable, Cloneable   {
+    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("scanner_get_cells_serialized_args");
 
     private static final org.apache.thrift.protocol.TField SCANNER_FIELD_DESC = new org.apache.thrift.protocol.TField("scanner", org.apache.thrift.protocol.TType.I64, (short)1);
 
     private static final Map<Class<? extends IScheme>, SchemeFactory> schemes = new HashMap<Class<? extends IScheme>, SchemeFactory>();
     static {
-      schemes.put(StandardScheme.class, new next_cells_as_arrays_argsStandardSchemeFactory());
-      schemes.put(TupleScheme.class, new next_cells_as_arrays_argsTupleSchemeFactory());
+      schemes.put(StandardScheme.class, new scanner_get_cells_serialized_argsStandardSchemeFactory());
+      schemes.put(TupleScheme.class, new scanner_get_cells_serialized_argsTupleSchemeFactory());
     }
 
     public long scanner; // required
@@ -44691,13 +45671,13 @@ public class ClientService {
       tmpMap.put(_Fields.SCANNER, new org.apache.thrift.meta_data.FieldMetaData("scanner", org.apache.thrift.TFieldRequirementType.DEFAULT, 
           new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.I64          , "Scanner")));
       metaDataMap = Collections.unmodifiableMap(tmpMap);
-      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(next_cells_as_arrays_args.class, metaDataMap);
+      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(scanner_get_cells_serialized_args.class, metaDataMap);
     }
 
-    public next_cells_as_arrays_args() {
+    public scanner_get_cells_serialized_args() {
     }
 
-    public next_cells_as_arrays_args(
+    public scanner_get_cells_serialized_args(
       long scanner)
     {
       this();
@@ -44708,14 +45688,14 @@ public class ClientService {
     /**
      * Performs a deep copy on <i>other</i>.
      */
-    public next_cells_as_arrays_args(next_cells_as_arrays_args other) {
+    public scanner_get_cells_serialized_args(scanner_get_cells_serialized_args other) {
       __isset_bit_vector.clear();
       __isset_bit_vector.or(other.__isset_bit_vector);
       this.scanner = other.scanner;
     }
 
-    public next_cells_as_arrays_args deepCopy() {
-      return new next_cells_as_arrays_args(this);
+    public scanner_get_cells_serialized_args deepCopy() {
+      return new scanner_get_cells_serialized_args(this);
     }
 
     @Override
@@ -44728,7 +45708,7 @@ public class ClientService {
       return this.scanner;
     }
 
-    public next_cells_as_arrays_args setScanner(long scanner) {
+    public scanner_get_cells_serialized_args setScanner(long scanner) {
       this.scanner = scanner;
       setScannerIsSet(true);
       return this;
@@ -44786,12 +45766,12 @@ public class ClientService {
     public boolean equals(Object that) {
       if (that == null)
         return false;
-      if (that instanceof next_cells_as_arrays_args)
-        return this.equals((next_cells_as_arrays_args)that);
+      if (that instanceof scanner_get_cells_serialized_args)
+        return this.equals((scanner_get_cells_serialized_args)that);
       return false;
     }
 
-    public boolean equals(next_cells_as_arrays_args that) {
+    public boolean equals(scanner_get_cells_serialized_args that) {
       if (that == null)
         return false;
 
@@ -44812,13 +45792,13 @@ public class ClientService {
       return 0;
     }
 
-    public int compareTo(next_cells_as_arrays_args other) {
+    public int compareTo(scanner_get_cells_serialized_args other) {
       if (!getClass().equals(other.getClass())) {
         return getClass().getName().compareTo(other.getClass().getName());
       }
 
       int lastComparison = 0;
-      next_cells_as_arrays_args typedOther = (next_cells_as_arrays_args)other;
+      scanner_get_cells_serialized_args typedOther = (scanner_get_cells_serialized_args)other;
 
       lastComparison = Boolean.valueOf(isSetScanner()).compareTo(typedOther.isSetScanner());
       if (lastComparison != 0) {
@@ -44847,7 +45827,7 @@ public class ClientService {
 
     @Override
     public String toString() {
-      StringBuilder sb = new StringBuilder("next_cells_as_arrays_args(");
+      StringBuilder sb = new StringBuilder("scanner_get_cells_serialized_args(");
       boolean first = true;
 
       sb.append("scanner:");
@@ -44879,15 +45859,15 @@ public class ClientService {
       }
     }
 
-    private static class next_cells_as_arrays_argsStandardSchemeFactory implements SchemeFactory {
-      public next_cells_as_arrays_argsStandardScheme getScheme() {
-        return new next_cells_as_arrays_argsStandardScheme();
+    private static class scanner_get_cells_serialized_argsStandardSchemeFactory implements SchemeFactory {
+      public scanner_get_cells_serialized_argsStandardScheme getScheme() {
+        return new scanner_get_cells_serialized_argsStandardScheme();
       }
     }
 
-    private static class next_cells_as_arrays_argsStandardScheme extends StandardScheme<next_cells_as_arrays_args> {
+    private static class scanner_get_cells_serialized_argsStandardScheme extends StandardScheme<scanner_get_cells_serialized_args> {
 
-      public void read(org.apache.thrift.protocol.TProtocol iprot, next_cells_as_arrays_args struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol iprot, scanner_get_cells_serialized_args struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TField schemeField;
         iprot.readStructBegin();
         while (true)
@@ -44916,7 +45896,7 @@ public class ClientService {
         struct.validate();
       }
 
-      public void write(org.apache.thrift.protocol.TProtocol oprot, next_cells_as_arrays_args struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol oprot, scanner_get_cells_serialized_args struct) throws org.apache.thrift.TException {
         struct.validate();
 
         oprot.writeStructBegin(STRUCT_DESC);
@@ -44929,16 +45909,16 @@ public class ClientService {
 
     }
 
-    private static class next_cells_as_arrays_argsTupleSchemeFactory implements SchemeFactory {
-      public next_cells_as_arrays_argsTupleScheme getScheme() {
-        return new next_cells_as_arrays_argsTupleScheme();
+    private static class scanner_get_cells_serialized_argsTupleSchemeFactory implements SchemeFactory {
+      public scanner_get_cells_serialized_argsTupleScheme getScheme() {
+        return new scanner_get_cells_serialized_argsTupleScheme();
       }
     }
 
-    private static class next_cells_as_arrays_argsTupleScheme extends TupleScheme<next_cells_as_arrays_args> {
+    private static class scanner_get_cells_serialized_argsTupleScheme extends TupleScheme<scanner_get_cells_serialized_args> {
 
       @Override
-      public void write(org.apache.thrift.protocol.TProtocol prot, next_cells_as_arrays_args struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol prot, scanner_get_cells_serialized_args struct) throws org.apache.thrift.TException {
         TTupleProtocol oprot = (TTupleProtocol) prot;
         BitSet optionals = new BitSet();
         if (struct.isSetScanner()) {
@@ -44951,7 +45931,7 @@ public class ClientService {
       }
 
       @Override
-      public void read(org.apache.thrift.protocol.TProtocol prot, next_cells_as_arrays_args struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol prot, scanner_get_cells_serialized_args struct) throws org.apache.thrift.TException {
         TTupleProtocol iprot = (TTupleProtocol) prot;
         BitSet incoming = iprot.readBitSet(1);
         if (incoming.get(0)) {
@@ -44963,19 +45943,19 @@ public class ClientService {
 
   }
 
-  public static class next_cells_as_arrays_result implements org.apache.thrift.TBase<next_cells_as_arrays_result, next_cells_as_arrays_result._Fields>, java.io.Serializable, Cloneable   {
-    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("next_cells_as_arrays_result");
+  public static class scanner_get_cells_serialized_result implements org.apache.thrift.TBase<scanner_get_cells_serialized_result, scanner_get_cells_serialized_result._Fields>, java.io.Serializable, Cloneable   {
+    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("scanner_get_cells_serialized_result");
 
-    private static final org.apache.thrift.protocol.TField SUCCESS_FIELD_DESC = new org.apache.thrift.protocol.TField("success", org.apache.thrift.protocol.TType.LIST, (short)0);
+    private static final org.apache.thrift.protocol.TField SUCCESS_FIELD_DESC = new org.apache.thrift.protocol.TField("success", org.apache.thrift.protocol.TType.STRING, (short)0);
     private static final org.apache.thrift.protocol.TField E_FIELD_DESC = new org.apache.thrift.protocol.TField("e", org.apache.thrift.protocol.TType.STRUCT, (short)1);
 
     private static final Map<Class<? extends IScheme>, SchemeFactory> schemes = new HashMap<Class<? extends IScheme>, SchemeFactory>();
     static {
-      schemes.put(StandardScheme.class, new next_cells_as_arrays_resultStandardSchemeFactory());
-      schemes.put(TupleScheme.class, new next_cells_as_arrays_resultTupleSchemeFactory());
+      schemes.put(StandardScheme.class, new scanner_get_cells_serialized_resultStandardSchemeFactory());
+      schemes.put(TupleScheme.class, new scanner_get_cells_serialized_resultTupleSchemeFactory());
     }
 
-    public List<List<String>> success; // required
+    public ByteBuffer success; // required
     public ClientException e; // required
 
     /** The set of fields this struct contains, along with convenience methods for finding and manipulating them. */
@@ -45044,19 +46024,18 @@ public class ClientService {
     static {
       Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> tmpMap = new EnumMap<_Fields, org.apache.thrift.meta_data.FieldMetaData>(_Fields.class);
       tmpMap.put(_Fields.SUCCESS, new org.apache.thrift.meta_data.FieldMetaData("success", org.apache.thrift.TFieldRequirementType.DEFAULT, 
-          new org.apache.thrift.meta_data.ListMetaData(org.apache.thrift.protocol.TType.LIST, 
-              new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.LIST              , "CellAsArray"))));
+          new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.STRING          , "CellsSerialized")));
       tmpMap.put(_Fields.E, new org.apache.thrift.meta_data.FieldMetaData("e", org.apache.thrift.TFieldRequirementType.DEFAULT, 
           new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.STRUCT)));
       metaDataMap = Collections.unmodifiableMap(tmpMap);
-      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(next_cells_as_arrays_result.class, metaDataMap);
+      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(scanner_get_cells_serialized_result.class, metaDataMap);
     }
 
-    public next_cells_as_arrays_result() {
+    public scanner_get_cells_serialized_result() {
     }
 
-    public next_cells_as_arrays_result(
-      List<List<String>> success,
+    public scanner_get_cells_serialized_result(
+      ByteBuffer success,
       ClientException e)
     {
       this();
@@ -45067,21 +46046,17 @@ public class ClientService {
     /**
      * Performs a deep copy on <i>other</i>.
      */
-    public next_cells_as_arrays_result(next_cells_as_arrays_result other) {
+    public scanner_get_cells_serialized_result(scanner_get_cells_serialized_result other) {
       if (other.isSetSuccess()) {
-        List<List<String>> __this__success = new ArrayList<List<String>>();
-        for (List<String> other_element : other.success) {
-          __this__success.add(other_element);
-        }
-        this.success = __this__success;
+        this.success = other.success;
       }
       if (other.isSetE()) {
         this.e = new ClientException(other.e);
       }
     }
 
-    public next_cells_as_arrays_result deepCopy() {
-      return new next_cells_as_arrays_result(this);
+    public scanner_get_cells_serialized_result deepCopy() {
+      return new scanner_get_cells_serialized_result(this);
     }
 
     @Override
@@ -45090,26 +46065,21 @@ public class ClientService {
       this.e = null;
     }
 
-    public int getSuccessSize() {
-      return (this.success == null) ? 0 : this.success.size();
-    }
-
-    public java.util.Iterator<List<String>> getSuccessIterator() {
-      return (this.success == null) ? null : this.success.iterator();
+    public byte[] getSuccess() {
+      setSuccess(org.apache.thrift.TBaseHelper.rightSize(success));
+      return success == null ? null : success.array();
     }
 
-    public void addToSuccess(List<String> elem) {
-      if (this.success == null) {
-        this.success = new ArrayList<List<String>>();
-      }
-      this.success.add(elem);
+    public ByteBuffer bufferForSuccess() {
+      return success;
     }
 
-    public List<List<String>> getSuccess() {
-      return this.success;
+    public scanner_get_cells_serialized_result setSuccess(byte[] success) {
+      setSuccess(success == null ? (ByteBuffer)null : ByteBuffer.wrap(success));
+      return this;
     }
 
-    public next_cells_as_arrays_result setSuccess(List<List<String>> success) {
+    public scanner_get_cells_serialized_result setSuccess(ByteBuffer success) {
       this.success = success;
       return this;
     }
@@ -45133,7 +46103,7 @@ public class ClientService {
       return this.e;
     }
 
-    public next_cells_as_arrays_result setE(ClientException e) {
+    public scanner_get_cells_serialized_result setE(ClientException e) {
       this.e = e;
       return this;
     }
@@ -45159,7 +46129,7 @@ public class ClientService {
         if (value == null) {
           unsetSuccess();
         } else {
-          setSuccess((List<List<String>>)value);
+          setSuccess((ByteBuffer)value);
         }
         break;
 
@@ -45205,12 +46175,12 @@ public class ClientService {
     public boolean equals(Object that) {
       if (that == null)
         return false;
-      if (that instanceof next_cells_as_arrays_result)
-        return this.equals((next_cells_as_arrays_result)that);
+      if (that instanceof scanner_get_cells_serialized_result)
+        return this.equals((scanner_get_cells_serialized_result)that);
       return false;
     }
 
-    public boolean equals(next_cells_as_arrays_result that) {
+    public boolean equals(scanner_get_cells_serialized_result that) {
       if (that == null)
         return false;
 
@@ -45240,13 +46210,13 @@ public class ClientService {
       return 0;
     }
 
-    public int compareTo(next_cells_as_arrays_result other) {
+    public int compareTo(scanner_get_cells_serialized_result other) {
       if (!getClass().equals(other.getClass())) {
         return getClass().getName().compareTo(other.getClass().getName());
       }
 
       int lastComparison = 0;
-      next_cells_as_arrays_result typedOther = (next_cells_as_arrays_result)other;
+      scanner_get_cells_serialized_result typedOther = (scanner_get_cells_serialized_result)other;
 
       lastComparison = Boolean.valueOf(isSetSuccess()).compareTo(typedOther.isSetSuccess());
       if (lastComparison != 0) {
@@ -45285,7 +46255,7 @@ public class ClientService {
 
     @Override
     public String toString() {
-      StringBuilder sb = new StringBuilder("next_cells_as_arrays_result(");
+      StringBuilder sb = new StringBuilder("scanner_get_cells_serialized_result(");
       boolean first = true;
 
       sb.append("success:");
@@ -45327,15 +46297,15 @@ public class ClientService {
       }
     }
 
-    private static class next_cells_as_arrays_resultStandardSchemeFactory implements SchemeFactory {
-      public next_cells_as_arrays_resultStandardScheme getScheme() {
-        return new next_cells_as_arrays_resultStandardScheme();
+    private static class scanner_get_cells_serialized_resultStandardSchemeFactory implements SchemeFactory {
+      public scanner_get_cells_serialized_resultStandardScheme getScheme() {
+        return new scanner_get_cells_serialized_resultStandardScheme();
       }
     }
 
-    private static class next_cells_as_arrays_resultStandardScheme extends StandardScheme<next_cells_as_arrays_result> {
+    private static class scanner_get_cells_serialized_resultStandardScheme extends StandardScheme<scanner_get_cells_serialized_result> {
 
-      public void read(org.apache.thrift.protocol.TProtocol iprot, next_cells_as_arrays_result struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol iprot, scanner_get_cells_serialized_result struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TField schemeField;
         iprot.readStructBegin();
         while (true)
@@ -45346,28 +46316,8 @@ public class ClientService {
           }
           switch (schemeField.id) {
             case 0: // SUCCESS
-              if (schemeField.type == org.apache.thrift.protocol.TType.LIST) {
-                {
-                  org.apache.thrift.protocol.TList _list116 = iprot.readListBegin();
-                  struct.success = new ArrayList<List<String>>(_list116.size);
-                  for (int _i117 = 0; _i117 < _list116.size; ++_i117)
-                  {
-                    List<String> _elem118; // required
-                    {
-                      org.apache.thrift.protocol.TList _list119 = iprot.readListBegin();
-                      _elem118 = new ArrayList<String>(_list119.size);
-                      for (int _i120 = 0; _i120 < _list119.size; ++_i120)
-                      {
-                        String _elem121; // required
-                        _elem121 = iprot.readString();
-                        _elem118.add(_elem121);
-                      }
-                      iprot.readListEnd();
-                    }
-                    struct.success.add(_elem118);
-                  }
-                  iprot.readListEnd();
-                }
+              if (schemeField.type == org.apache.thrift.protocol.TType.STRING) {
+                struct.success = iprot.readBinary();
                 struct.setSuccessIsSet(true);
               } else { 
                 org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
@@ -45393,27 +46343,13 @@ public class ClientService {
         struct.validate();
       }
 
-      public void write(org.apache.thrift.protocol.TProtocol oprot, next_cells_as_arrays_result struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol oprot, scanner_get_cells_serialized_result struct) throws org.apache.thrift.TException {
         struct.validate();
 
         oprot.writeStructBegin(STRUCT_DESC);
         if (struct.success != null) {
           oprot.writeFieldBegin(SUCCESS_FIELD_DESC);
-          {
-            oprot.writeListBegin(new org.apache.thrift.protocol.TList(org.apache.thrift.protocol.TType.LIST, struct.success.size()));
-            for (List<String> _iter122 : struct.success)
-            {
-              {
-                oprot.writeListBegin(new org.apache.thrift.protocol.TList(org.apache.thrift.protocol.TType.STRING, _iter122.size()));
-                for (String _iter123 : _iter122)
-                {
-                  oprot.writeString(_iter123);
-                }
-                oprot.writeListEnd();
-              }
-            }
-            oprot.writeListEnd();
-          }
+          oprot.writeBinary(struct.success);
           oprot.writeFieldEnd();
         }
         if (struct.e != null) {
@@ -45427,16 +46363,16 @@ public class ClientService {
 
     }
 
-    private static class next_cells_as_arrays_resultTupleSchemeFactory implements SchemeFactory {
-      public next_cells_as_arrays_resultTupleScheme getScheme() {
-        return new next_cells_as_arrays_resultTupleScheme();
+    private static class scanner_get_cells_serialized_resultTupleSchemeFactory implements SchemeFactory {
+      public scanner_get_cells_serialized_resultTupleScheme getScheme() {
+        return new scanner_get_cells_serialized_resultTupleScheme();
       }
     }
 
-    private static class next_cells_as_arrays_resultTupleScheme extends TupleScheme<next_cells_as_arrays_result> {
+    private static class scanner_get_cells_serialized_resultTupleScheme extends TupleScheme<scanner_get_cells_serialized_result> {
 
       @Override
-      public void write(org.apache.thrift.protocol.TProtocol prot, next_cells_as_arrays_result struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol prot, scanner_get_cells_serialized_result struct) throws org.apache.thrift.TException {
         TTupleProtocol oprot = (TTupleProtocol) prot;
         BitSet optionals = new BitSet();
         if (struct.isSetSuccess()) {
@@ -45447,19 +46383,7 @@ public class ClientService {
         }
         oprot.writeBitSet(optionals, 2);
         if (struct.isSetSuccess()) {
-          {
-            oprot.writeI32(struct.success.size());
-            for (List<String> _iter124 : struct.success)
-            {
-              {
-                oprot.writeI32(_iter124.size());
-                for (String _iter125 : _iter124)
-                {
-                  oprot.writeString(_iter125);
-                }
-              }
-            }
-          }
+          oprot.writeBinary(struct.success);
         }
         if (struct.isSetE()) {
           struct.e.write(oprot);
@@ -45467,29 +46391,11 @@ public class ClientService {
       }
 
       @Override
-      public void read(org.apache.thrift.protocol.TProtocol prot, next_cells_as_arrays_result struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol prot, scanner_get_cells_serialized_result struct) throws org.apache.thrift.TException {
         TTupleProtocol iprot = (TTupleProtocol) prot;
         BitSet incoming = iprot.readBitSet(2);
         if (incoming.get(0)) {
-          {
-            org.apache.thrift.protocol.TList _list126 = new org.apache.thrift.protocol.TList(org.apache.thrift.protocol.TType.LIST, iprot.readI32());
-            struct.success = new ArrayList<List<String>>(_list126.size);
-            for (int _i127 = 0; _i127 < _list126.size; ++_i127)
-            {
-              List<String> _elem128; // required
-              {
-                org.apache.thrift.protocol.TList _list129 = new org.apache.thrift.protocol.TList(org.apache.thrift.protocol.TType.STRING, iprot.readI32());
-                _elem128 = new ArrayList<String>(_list129.size);
-                for (int _i130 = 0; _i130 < _list129.size; ++_i130)
-                {
-                  String _elem131; // required
-                  _elem131 = iprot.readString();
-                  _elem128.add(_elem131);
-                }
-              }
-              struct.success.add(_elem128);
-            }
-          }
+          struct.success = iprot.readBinary();
           struct.setSuccessIsSet(true);
         }
         if (incoming.get(1)) {
@@ -45502,15 +46408,15 @@ public class ClientService {
 
   }
 
-  public static class scanner_get_cells_serialized_args implements org.apache.thrift.TBase<scanner_get_cells_serialized_args, scanner_get_cells_serialized_args._Fields>, java.io.Serializable, Cloneable   {
-    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("scanner_get_cells_serialized_args");
+  public static class next_cells_serialized_args implements org.apache.thrift.TBase<next_cells_serialized_args, next_cells_serialized_args._Fields>, java.io.Serializable, Cloneable   {
+    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("next_cells_serialized_args");
 
     private static final org.apache.thrift.protocol.TField SCANNER_FIELD_DESC = new org.apache.thrift.protocol.TField("scanner", org.apache.thrift.protocol.TType.I64, (short)1);
 
     private static final Map<Class<? extends IScheme>, SchemeFactory> schemes = new HashMap<Class<? extends IScheme>, SchemeFactory>();
     static {
-      schemes.put(StandardScheme.class, new scanner_get_cells_serialized_argsStandardSchemeFactory());
-      schemes.put(TupleScheme.class, new scanner_get_cells_serialized_argsTupleSchemeFactory());
+      schemes.put(StandardScheme.class, new next_cells_serialized_argsStandardSchemeFactory());
+      schemes.put(TupleScheme.class, new next_cells_serialized_argsTupleSchemeFactory());
     }
 
     public long scanner; // required
@@ -45582,13 +46488,13 @@ public class ClientService {
       tmpMap.put(_Fields.SCANNER, new org.apache.thrift.meta_data.FieldMetaData("scanner", org.apache.thrift.TFieldRequirementType.DEFAULT, 
           new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.I64          , "Scanner")));
       metaDataMap = Collections.unmodifiableMap(tmpMap);
-      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(scanner_get_cells_serialized_args.class, metaDataMap);
+      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(next_cells_serialized_args.class, metaDataMap);
     }
 
-    public scanner_get_cells_serialized_args() {
+    public next_cells_serialized_args() {
     }
 
-    public scanner_get_cells_serialized_args(
+    public next_cells_serialized_args(
       long scanner)
     {
       this();
@@ -45599,14 +46505,14 @@ public class ClientService {
     /**
      * Performs a deep copy on <i>other</i>.
      */
-    public scanner_get_cells_serialized_args(scanner_get_cells_serialized_args other) {
+    public next_cells_serialized_args(next_cells_serialized_args other) {
       __isset_bit_vector.clear();
       __isset_bit_vector.or(other.__isset_bit_vector);
       this.scanner = other.scanner;
     }
 
-    public scanner_get_cells_serialized_args deepCopy() {
-      return new scanner_get_cells_serialized_args(this);
+    public next_cells_serialized_args deepCopy() {
+      return new next_cells_serialized_args(this);
     }
 
     @Override
@@ -45619,7 +46525,7 @@ public class ClientService {
       return this.scanner;
     }
 
-    public scanner_get_cells_serialized_args setScanner(long scanner) {
+    public next_cells_serialized_args setScanner(long scanner) {
       this.scanner = scanner;
       setScannerIsSet(true);
       return this;
@@ -45677,12 +46583,12 @@ public class ClientService {
     public boolean equals(Object that) {
       if (that == null)
         return false;
-      if (that instanceof scanner_get_cells_serialized_args)
-        return this.equals((scanner_get_cells_serialized_args)that);
+      if (that instanceof next_cells_serialized_args)
+        return this.equals((next_cells_serialized_args)that);
       return false;
     }
 
-    public boolean equals(scanner_get_cells_serialized_args that) {
+    public boolean equals(next_cells_serialized_args that) {
       if (that == null)
         return false;
 
@@ -45703,13 +46609,13 @@ public class ClientService {
       return 0;
     }
 
-    public int compareTo(scanner_get_cells_serialized_args other) {
+    public int compareTo(next_cells_serialized_args other) {
       if (!getClass().equals(other.getClass())) {
         return getClass().getName().compareTo(other.getClass().getName());
       }
 
       int lastComparison = 0;
-      scanner_get_cells_serialized_args typedOther = (scanner_get_cells_serialized_args)other;
+      next_cells_serialized_args typedOther = (next_cells_serialized_args)other;
 
       lastComparison = Boolean.valueOf(isSetScanner()).compareTo(typedOther.isSetScanner());
       if (lastComparison != 0) {
@@ -45738,7 +46644,7 @@ public class ClientService {
 
     @Override
     public String toString() {
-      StringBuilder sb = new StringBuilder("scanner_get_cells_serialized_args(");
+      StringBuilder sb = new StringBuilder("next_cells_serialized_args(");
       boolean first = true;
 
       sb.append("scanner:");
@@ -45770,15 +46676,15 @@ public class ClientService {
       }
     }
 
-    private static class scanner_get_cells_serialized_argsStandardSchemeFactory implements SchemeFactory {
-      public scanner_get_cells_serialized_argsStandardScheme getScheme() {
-        return new scanner_get_cells_serialized_argsStandardScheme();
+    private static class next_cells_serialized_argsStandardSchemeFactory implements SchemeFactory {
+      public next_cells_serialized_argsStandardScheme getScheme() {
+        return new next_cells_serialized_argsStandardScheme();
       }
     }
 
-    private static class scanner_get_cells_serialized_argsStandardScheme extends StandardScheme<scanner_get_cells_serialized_args> {
+    private static class next_cells_serialized_argsStandardScheme extends StandardScheme<next_cells_serialized_args> {
 
-      public void read(org.apache.thrift.protocol.TProtocol iprot, scanner_get_cells_serialized_args struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol iprot, next_cells_serialized_args struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TField schemeField;
         iprot.readStructBegin();
         while (true)
@@ -45807,7 +46713,7 @@ public class ClientService {
         struct.validate();
       }
 
-      public void write(org.apache.thrift.protocol.TProtocol oprot, scanner_get_cells_serialized_args struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol oprot, next_cells_serialized_args struct) throws org.apache.thrift.TException {
         struct.validate();
 
         oprot.writeStructBegin(STRUCT_DESC);
@@ -45820,16 +46726,16 @@ public class ClientService {
 
     }
 
-    private static class scanner_get_cells_serialized_argsTupleSchemeFactory implements SchemeFactory {
-      public scanner_get_cells_serialized_argsTupleScheme getScheme() {
-        return new scanner_get_cells_serialized_argsTupleScheme();
+    private static class next_cells_serialized_argsTupleSchemeFactory implements SchemeFactory {
+      public next_cells_serialized_argsTupleScheme getScheme() {
+        return new next_cells_serialized_argsTupleScheme();
       }
     }
 
-    private static class scanner_get_cells_serialized_argsTupleScheme extends TupleScheme<scanner_get_cells_serialized_args> {
+    private static class next_cells_serialized_argsTupleScheme extends TupleScheme<next_cells_serialized_args> {
 
       @Override
-      public void write(org.apache.thrift.protocol.TProtocol prot, scanner_get_cells_serialized_args struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol prot, next_cells_serialized_args struct) throws org.apache.thrift.TException {
         TTupleProtocol oprot = (TTupleProtocol) prot;
         BitSet optionals = new BitSet();
         if (struct.isSetScanner()) {
@@ -45842,7 +46748,7 @@ public class ClientService {
       }
 
       @Override
-      public void read(org.apache.thrift.protocol.TProtocol prot, scanner_get_cells_serialized_args struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol prot, next_cells_serialized_args struct) throws org.apache.thrift.TException {
         TTupleProtocol iprot = (TTupleProtocol) prot;
         BitSet incoming = iprot.readBitSet(1);
         if (incoming.get(0)) {
@@ -45854,16 +46760,16 @@ public class ClientService {
 
   }
 
-  public static class scanner_get_cells_serialized_result implements org.apache.thrift.TBase<scanner_get_cells_serialized_result, scanner_get_cells_serialized_result._Fields>, java.io.Serializable, Cloneable   {
-    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("scanner_get_cells_serialized_result");
+  public static class next_cells_serialized_result implements org.apache.thrift.TBase<next_cells_serialized_result, next_cells_serialized_result._Fields>, java.io.Serializable, Cloneable   {
+    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("next_cells_serialized_result");
 
     private static final org.apache.thrift.protocol.TField SUCCESS_FIELD_DESC = new org.apache.thrift.protocol.TField("success", org.apache.thrift.protocol.TType.STRING, (short)0);
     private static final org.apache.thrift.protocol.TField E_FIELD_DESC = new org.apache.thrift.protocol.TField("e", org.apache.thrift.protocol.TType.STRUCT, (short)1);
 
     private static final Map<Class<? extends IScheme>, SchemeFactory> schemes = new HashMap<Class<? extends IScheme>, SchemeFactory>();
     static {
-      schemes.put(StandardScheme.class, new scanner_get_cells_serialized_resultStandardSchemeFactory());
-      schemes.put(TupleScheme.class, new scanner_get_cells_serialized_resultTupleSchemeFactory());
+      schemes.put(StandardScheme.class, new next_cells_serialized_resultStandardSchemeFactory());
+      schemes.put(TupleScheme.class, new next_cells_serialized_resultTupleSchemeFactory());
     }
 
     public ByteBuffer success; // required
@@ -45939,13 +46845,13 @@ public class ClientService {
       tmpMap.put(_Fields.E, new org.apache.thrift.meta_data.FieldMetaData("e", org.apache.thrift.TFieldRequirementType.DEFAULT, 
           new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.STRUCT)));
       metaDataMap = Collections.unmodifiableMap(tmpMap);
-      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(scanner_get_cells_serialized_result.class, metaDataMap);
+      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(next_cells_serialized_result.class, metaDataMap);
     }
 
-    public scanner_get_cells_serialized_result() {
+    public next_cells_serialized_result() {
     }
 
-    public scanner_get_cells_serialized_result(
+    public next_cells_serialized_result(
       ByteBuffer success,
       ClientException e)
     {
@@ -45957,7 +46863,7 @@ public class ClientService {
     /**
      * Performs a deep copy on <i>other</i>.
      */
-    public scanner_get_cells_serialized_result(scanner_get_cells_serialized_result other) {
+    public next_cells_serialized_result(next_cells_serialized_result other) {
       if (other.isSetSuccess()) {
         this.success = other.success;
       }
@@ -45966,8 +46872,8 @@ public class ClientService {
       }
     }
 
-    public scanner_get_cells_serialized_result deepCopy() {
-      return new scanner_get_cells_serialized_result(this);
+    public next_cells_serialized_result deepCopy() {
+      return new next_cells_serialized_result(this);
     }
 
     @Override
@@ -45985,12 +46891,12 @@ public class ClientService {
       return success;
     }
 
-    public scanner_get_cells_serialized_result setSuccess(byte[] success) {
+    public next_cells_serialized_result setSuccess(byte[] success) {
       setSuccess(success == null ? (ByteBuffer)null : ByteBuffer.wrap(success));
       return this;
     }
 
-    public scanner_get_cells_serialized_result setSuccess(ByteBuffer success) {
+    public next_cells_serialized_result setSuccess(ByteBuffer success) {
       this.success = success;
       return this;
     }
@@ -46014,7 +46920,7 @@ public class ClientService {
       return this.e;
     }
 
-    public scanner_get_cells_serialized_result setE(ClientException e) {
+    public next_cells_serialized_result setE(ClientException e) {
       this.e = e;
       return this;
     }
@@ -46086,12 +46992,12 @@ public class ClientService {
     public boolean equals(Object that) {
       if (that == null)
         return false;
-      if (that instanceof scanner_get_cells_serialized_result)
-        return this.equals((scanner_get_cells_serialized_result)that);
+      if (that instanceof next_cells_serialized_result)
+        return this.equals((next_cells_serialized_result)that);
       return false;
     }
 
-    public boolean equals(scanner_get_cells_serialized_result that) {
+    public boolean equals(next_cells_serialized_result that) {
       if (that == null)
         return false;
 
@@ -46121,13 +47027,13 @@ public class ClientService {
       return 0;
     }
 
-    public int compareTo(scanner_get_cells_serialized_result other) {
+    public int compareTo(next_cells_serialized_result other) {
       if (!getClass().equals(other.getClass())) {
         return getClass().getName().compareTo(other.getClass().getName());
       }
 
       int lastComparison = 0;
-      scanner_get_cells_serialized_result typedOther = (scanner_get_cells_serialized_result)other;
+      next_cells_serialized_result typedOther = (next_cells_serialized_result)other;
 
       lastComparison = Boolean.valueOf(isSetSuccess()).compareTo(typedOther.isSetSuccess());
       if (lastComparison != 0) {
@@ -46166,7 +47072,7 @@ public class ClientService {
 
     @Override
     public String toString() {
-      StringBuilder sb = new StringBuilder("scanner_get_cells_serialized_result(");
+      StringBuilder sb = new StringBuilder("next_cells_serialized_result(");
       boolean first = true;
 
       sb.append("success:");
@@ -46208,15 +47114,15 @@ public class ClientService {
       }
     }
 
-    private static class scanner_get_cells_serialized_resultStandardSchemeFactory implements SchemeFactory {
-      public scanner_get_cells_serialized_resultStandardScheme getScheme() {
-        return new scanner_get_cells_serialized_resultStandardScheme();
+    private static class next_cells_serialized_resultStandardSchemeFactory implements SchemeFactory {
+      public next_cells_serialized_resultStandardScheme getScheme() {
+        return new next_cells_serialized_resultStandardScheme();
       }
     }
 
-    private static class scanner_get_cells_serialized_resultStandardScheme extends StandardScheme<scanner_get_cells_serialized_result> {
+    private static class next_cells_serialized_resultStandardScheme extends StandardScheme<next_cells_serialized_result> {
 
-      public void read(org.apache.thrift.protocol.TProtocol iprot, scanner_get_cells_serialized_result struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol iprot, next_cells_serialized_result struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TField schemeField;
         iprot.readStructBegin();
         while (true)
@@ -46254,7 +47160,7 @@ public class ClientService {
         struct.validate();
       }
 
-      public void write(org.apache.thrift.protocol.TProtocol oprot, scanner_get_cells_serialized_result struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol oprot, next_cells_serialized_result struct) throws org.apache.thrift.TException {
         struct.validate();
 
         oprot.writeStructBegin(STRUCT_DESC);
@@ -46274,16 +47180,16 @@ public class ClientService {
 
     }
 
-    private static class scanner_get_cells_serialized_resultTupleSchemeFactory implements SchemeFactory {
-      public scanner_get_cells_serialized_resultTupleScheme getScheme() {
-        return new scanner_get_cells_serialized_resultTupleScheme();
+    private static class next_cells_serialized_resultTupleSchemeFactory implements SchemeFactory {
+      public next_cells_serialized_resultTupleScheme getScheme() {
+        return new next_cells_serialized_resultTupleScheme();
       }
     }
 
-    private static class scanner_get_cells_serialized_resultTupleScheme extends TupleScheme<scanner_get_cells_serialized_result> {
+    private static class next_cells_serialized_resultTupleScheme extends TupleScheme<next_cells_serialized_result> {
 
       @Override
-      public void write(org.apache.thrift.protocol.TProtocol prot, scanner_get_cells_serialized_result struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol prot, next_cells_serialized_result struct) throws org.apache.thrift.TException {
         TTupleProtocol oprot = (TTupleProtocol) prot;
         BitSet optionals = new BitSet();
         if (struct.isSetSuccess()) {
@@ -46302,7 +47208,7 @@ public class ClientService {
       }
 
       @Override
-      public void read(org.apache.thrift.protocol.TProtocol prot, scanner_get_cells_serialized_result struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol prot, next_cells_serialized_result struct) throws org.apache.thrift.TException {
         TTupleProtocol iprot = (TTupleProtocol) prot;
         BitSet incoming = iprot.readBitSet(2);
         if (incoming.get(0)) {
@@ -46319,15 +47225,15 @@ public class ClientService {
 
   }
 
-  public static class next_cells_serialized_args implements org.apache.thrift.TBase<next_cells_serialized_args, next_cells_serialized_args._Fields>, java.io.Serializable, Cloneable   {
-    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("next_cells_serialized_args");
+  public static class scanner_get_cells_columnar_args implements org.apache.thrift.TBase<scanner_get_cells_columnar_args, scanner_get_cells_columnar_args._Fields>, java.io.Serializable, Cloneable   {
+    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("scanner_get_cells_columnar_args");
 
     private static final org.apache.thrift.protocol.TField SCANNER_FIELD_DESC = new org.apache.thrift.protocol.TField("scanner", org.apache.thrift.protocol.TType.I64, (short)1);
 
     private static final Map<Class<? extends IScheme>, SchemeFactory> schemes = new HashMap<Class<? extends IScheme>, SchemeFactory>();
     static {
-      schemes.put(StandardScheme.class, new next_cells_serialized_argsStandardSchemeFactory());
-      schemes.put(TupleScheme.class, new next_cells_serialized_argsTupleSchemeFactory());
+      schemes.put(StandardScheme.class, new scanner_get_cells_columnar_argsStandardSchemeFactory());
+      schemes.put(TupleScheme.class, new scanner_get_cells_columnar_argsTupleSchemeFactory());
     }
 
     public long scanner; // required
@@ -46399,13 +47305,13 @@ public class ClientService {
       tmpMap.put(_Fields.SCANNER, new org.apache.thrift.meta_data.FieldMetaData("scanner", org.apache.thrift.TFieldRequirementType.DEFAULT, 
           new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.I64          , "Scanner")));
       metaDataMap = Collections.unmodifiableMap(tmpMap);
-      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(next_cells_serialized_args.class, metaDataMap);
+      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(scanner_get_cells_columnar_args.class, metaDataMap);
     }
 
-    public next_cells_serialized_args() {
+    public scanner_get_cells_columnar_args() {
     }
 
-    public next_cells_serialized_args(
+    public scanner_get_cells_columnar_args(
       long scanner)
     {
       this();
@@ -46416,14 +47322,14 @@ public class ClientService {
     /**
      * Performs a deep copy on <i>other</i>.
      */
-    public next_cells_serialized_args(next_cells_serialized_args other) {
+    public scanner_get_cells_columnar_args(scanner_get_cells_columnar_args other) {
       __isset_bit_vector.clear();
       __isset_bit_vector.or(other.__isset_bit_vector);
       this.scanner = other.scanner;
     }
 
-    public next_cells_serialized_args deepCopy() {
-      return new next_cells_serialized_args(this);
+    public scanner_get_cells_columnar_args deepCopy() {
+      return new scanner_get_cells_columnar_args(this);
     }
 
     @Override
@@ -46436,7 +47342,7 @@ public class ClientService {
       return this.scanner;
     }
 
-    public next_cells_serialized_args setScanner(long scanner) {
+    public scanner_get_cells_columnar_args setScanner(long scanner) {
       this.scanner = scanner;
       setScannerIsSet(true);
       return this;
@@ -46494,12 +47400,12 @@ public class ClientService {
     public boolean equals(Object that) {
       if (that == null)
         return false;
-      if (that instanceof next_cells_serialized_args)
-        return this.equals((next_cells_serialized_args)that);
+      if (that instanceof scanner_get_cells_columnar_args)
+        return this.equals((scanner_get_cells_columnar_args)that);
       return false;
     }
 
-    public boolean equals(next_cells_serialized_args that) {
+    public boolean equals(scanner_get_cells_columnar_args that) {
       if (that == null)
         return false;
 
@@ -46520,13 +47426,13 @@ public class ClientService {
       return 0;
     }
 
-    public int compareTo(next_cells_serialized_args other) {
+    public int compareTo(scanner_get_cells_columnar_args other) {
       if (!getClass().equals(other.getClass())) {
         return getClass().getName().compareTo(other.getClass().getName());
       }
 
       int lastComparison = 0;
-      next_cells_serialized_args typedOther = (next_cells_serialized_args)other;
+      scanner_get_cells_columnar_args typedOther = (scanner_get_cells_columnar_args)other;
 
       lastComparison = Boolean.valueOf(isSetScanner()).compareTo(typedOther.isSetScanner());
       if (lastComparison != 0) {
@@ -46555,7 +47461,7 @@ public class ClientService {
 
     @Override
     public String toString() {
-      StringBuilder sb = new StringBuilder("next_cells_serialized_args(");
+      StringBuilder sb = new StringBuilder("scanner_get_cells_columnar_args(");
       boolean first = true;
 
       sb.append("scanner:");
@@ -46587,15 +47493,15 @@ public class ClientService {
       }
     }
 
-    private static class next_cells_serialized_argsStandardSchemeFactory implements SchemeFactory {
-      public next_cells_serialized_argsStandardScheme getScheme() {
-        return new next_cells_serialized_argsStandardScheme();
+    private static class scanner_get_cells_columnar_argsStandardSchemeFactory implements SchemeFactory {
+      public scanner_get_cells_columnar_argsStandardScheme getScheme() {
+        return new scanner_get_cells_columnar_argsStandardScheme();
       }
     }
 
-    private static class next_cells_serialized_argsStandardScheme extends StandardScheme<next_cells_serialized_args> {
+    private static class scanner_get_cells_columnar_argsStandardScheme extends StandardScheme<scanner_get_cells_columnar_args> {
 
-      public void read(org.apache.thrift.protocol.TProtocol iprot, next_cells_serialized_args struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol iprot, scanner_get_cells_columnar_args struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TField schemeField;
         iprot.readStructBegin();
         while (true)
@@ -46624,7 +47530,7 @@ public class ClientService {
         struct.validate();
       }
 
-      public void write(org.apache.thrift.protocol.TProtocol oprot, next_cells_serialized_args struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol oprot, scanner_get_cells_columnar_args struct) throws org.apache.thrift.TException {
         struct.validate();
 
         oprot.writeStructBegin(STRUCT_DESC);
@@ -46637,16 +47543,16 @@ public class ClientService {
 
     }
 
-    private static class next_cells_serialized_argsTupleSchemeFactory implements SchemeFactory {
-      public next_cells_serialized_argsTupleScheme getScheme() {
-        return new next_cells_serialized_argsTupleScheme();
+    private static class scanner_get_cells_columnar_argsTupleSchemeFactory implements SchemeFactory {
+      public scanner_get_cells_columnar_argsTupleScheme getScheme() {
+        return new scanner_get_cells_columnar_argsTupleScheme();
       }
     }
 
-    private static class next_cells_serialized_argsTupleScheme extends TupleScheme<next_cells_serialized_args> {
+    private static class scanner_get_cells_columnar_argsTupleScheme extends TupleScheme<scanner_get_cells_columnar_args> {
 
       @Override
-      public void write(org.apache.thrift.protocol.TProtocol prot, next_cells_serialized_args struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol prot, scanner_get_cells_columnar_args struct) throws org.apache.thrift.TException {
         TTupleProtocol oprot = (TTupleProtocol) prot;
         BitSet optionals = new BitSet();
         if (struct.isSetScanner()) {
@@ -46659,7 +47565,7 @@ public class ClientService {
       }
 
       @Override
-      public void read(org.apache.thrift.protocol.TProtocol prot, next_cells_serialized_args struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol prot, scanner_get_cells_columnar_args struct) throws org.apache.thrift.TException {
         TTupleProtocol iprot = (TTupleProtocol) prot;
         BitSet incoming = iprot.readBitSet(1);
         if (incoming.get(0)) {
@@ -46671,16 +47577,16 @@ public class ClientService {
 
   }
 
-  public static class next_cells_serialized_result implements org.apache.thrift.TBase<next_cells_serialized_result, next_cells_serialized_result._Fields>, java.io.Serializable, Cloneable   {
-    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("next_cells_serialized_result");
+  public static class scanner_get_cells_columnar_result implements org.apache.thrift.TBase<scanner_get_cells_columnar_result, scanner_get_cells_columnar_result._Fields>, java.io.Serializable, Cloneable   {
+    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("scanner_get_cells_columnar_result");
 
     private static final org.apache.thrift.protocol.TField SUCCESS_FIELD_DESC = new org.apache.thrift.protocol.TField("success", org.apache.thrift.protocol.TType.STRING, (short)0);
     private static final org.apache.thrift.protocol.TField E_FIELD_DESC = new org.apache.thrift.protocol.TField("e", org.apache.thrift.protocol.TType.STRUCT, (short)1);
 
     private static final Map<Class<? extends IScheme>, SchemeFactory> schemes = new HashMap<Class<? extends IScheme>, SchemeFactory>();
     static {
-      schemes.put(StandardScheme.class, new next_cells_serialized_resultStandardSchemeFactory());
-      schemes.put(TupleScheme.class, new next_cells_serialized_resultTupleSchemeFactory());
+      schemes.put(StandardScheme.class, new scanner_get_cells_columnar_resultStandardSchemeFactory());
+      schemes.put(TupleScheme.class, new scanner_get_cells_columnar_resultTupleSchemeFactory());
     }
 
     public ByteBuffer success; // required
@@ -46752,17 +47658,17 @@ public class ClientService {
     static {
       Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> tmpMap = new EnumMap<_Fields, org.apache.thrift.meta_data.FieldMetaData>(_Fields.class);
       tmpMap.put(_Fields.SUCCESS, new org.apache.thrift.meta_data.FieldMetaData("success", org.apache.thrift.TFieldRequirementType.DEFAULT, 
-          new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.STRING          , "CellsSerialized")));
+          new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.STRING          , "CellsColumnar")));
       tmpMap.put(_Fields.E, new org.apache.thrift.meta_data.FieldMetaData("e", org.apache.thrift.TFieldRequirementType.DEFAULT, 
           new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.STRUCT)));
       metaDataMap = Collections.unmodifiableMap(tmpMap);
-      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(next_cells_serialized_result.class, metaDataMap);
+      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(scanner_get_cells_columnar_result.class, metaDataMap);
     }
 
-    public next_cells_serialized_result() {
+    public scanner_get_cells_columnar_result() {
     }
 
-    public next_cells_serialized_result(
+    public scanner_get_cells_columnar_result(
       ByteBuffer success,
       ClientException e)
     {
@@ -46774,7 +47680,7 @@ public class ClientService {
     /**
      * Performs a deep copy on <i>other</i>.
      */
-    public next_cells_serialized_result(next_cells_serialized_result other) {
+    public scanner_get_cells_columnar_result(scanner_get_cells_columnar_result other) {
       if (other.isSetSuccess()) {
         this.success = other.success;
       }
@@ -46783,8 +47689,8 @@ public class ClientService {
       }
     }
 
-    public next_cells_serialized_result deepCopy() {
-      return new next_cells_serialized_result(this);
+    public scanner_get_cells_columnar_result deepCopy() {
+      return new scanner_get_cells_columnar_result(this);
     }
 
     @Override
@@ -46802,12 +47708,12 @@ public class ClientService {
       return success;
     }
 
-    public next_cells_serialized_result setSuccess(byte[] success) {
+    public scanner_get_cells_columnar_result setSuccess(byte[] success) {
       setSuccess(success == null ? (ByteBuffer)null : ByteBuffer.wrap(success));
       return this;
     }
 
-    public next_cells_serialized_result setSuccess(ByteBuffer success) {
+    public scanner_get_cells_columnar_result setSuccess(ByteBuffer success) {
       this.success = success;
       return this;
     }
@@ -46831,7 +47737,7 @@ public class ClientService {
       return this.e;
     }
 
-    public next_cells_serialized_result setE(ClientException e) {
+    public scanner_get_cells_columnar_result setE(ClientException e) {
       this.e = e;
       return this;
     }
@@ -46903,12 +47809,12 @@ public class ClientService {
     public boolean equals(Object that) {
       if (that == null)
         return false;
-      if (that instanceof next_cells_serialized_result)
-        return this.equals((next_cells_serialized_result)that);
+      if (that instanceof scanner_get_cells_columnar_result)
+        return this.equals((scanner_get_cells_columnar_result)that);
       return false;
     }
 
-    public boolean equals(next_cells_serialized_result that) {
+    public boolean equals(scanner_get_cells_columnar_result that) {
       if (that == null)
         return false;
 
@@ -46938,13 +47844,13 @@ public class ClientService {
       return 0;
     }
 
-    public int compareTo(next_cells_serialized_result other) {
+    public int compareTo(scanner_get_cells_columnar_result other) {
       if (!getClass().equals(other.getClass())) {
         return getClass().getName().compareTo(other.getClass().getName());
       }
 
       int lastComparison = 0;
-      next_cells_serialized_result typedOther = (next_cells_serialized_result)other;
+      scanner_get_cells_columnar_result typedOther = (scanner_get_cells_columnar_result)other;
 
       lastComparison = Boolean.valueOf(isSetSuccess()).compareTo(typedOther.isSetSuccess());
       if (lastComparison != 0) {
@@ -46983,7 +47889,7 @@ public class ClientService {
 
     @Override
     public String toString() {
-      StringBuilder sb = new StringBuilder("next_cells_serialized_result(");
+      StringBuilder sb = new StringBuilder("scanner_get_cells_columnar_result(");
       boolean first = true;
 
       sb.append("success:");
@@ -47025,15 +47931,15 @@ public class ClientService {
       }
     }
 
-    private static class next_cells_serialized_resultStandardSchemeFactory implements SchemeFactory {
-      public next_cells_serialized_resultStandardScheme getScheme() {
-        return new next_cells_serialized_resultStandardScheme();
+    private static class scanner_get_cells_columnar_resultStandardSchemeFactory implements SchemeFactory {
+      public scanner_get_cells_columnar_resultStandardScheme getScheme() {
+        return new scanner_get_cells_columnar_resultStandardScheme();
       }
     }
 
-    private static class next_cells_serialized_resultStandardScheme extends StandardScheme<next_cells_serialized_result> {
+    private static class scanner_get_cells_columnar_resultStandardScheme extends StandardScheme<scanner_get_cells_columnar_result> {
 
-      public void read(org.apache.thrift.protocol.TProtocol iprot, next_cells_serialized_result struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol iprot, scanner_get_cells_columnar_result struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TField schemeField;
         iprot.readStructBegin();
         while (true)
@@ -47071,7 +47977,7 @@ public class ClientService {
         struct.validate();
       }
 
-      public void write(org.apache.thrift.protocol.TProtocol oprot, next_cells_serialized_result struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol oprot, scanner_get_cells_columnar_result struct) throws org.apache.thrift.TException {
         struct.validate();
 
         oprot.writeStructBegin(STRUCT_DESC);
@@ -47091,16 +47997,16 @@ public class ClientService {
 
     }
 
-    private static class next_cells_serialized_resultTupleSchemeFactory implements SchemeFactory {
-      public next_cells_serialized_resultTupleScheme getScheme() {
-        return new next_cells_serialized_resultTupleScheme();
+    private static class scanner_get_cells_columnar_resultTupleSchemeFactory implements SchemeFactory {
+      public scanner_get_cells_columnar_resultTupleScheme getScheme() {
+        return new scanner_get_cells_columnar_resultTupleScheme();
       }
     }
 
-    private static class next_cells_serialized_resultTupleScheme extends TupleScheme<next_cells_serialized_result> {
+    private static class scanner_get_cells_columnar_resultTupleScheme extends TupleScheme<scanner_get_cells_columnar_result> {
 
       @Override
-      public void write(org.apache.thrift.protocol.TProtocol prot, next_cells_serialized_result struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol prot, scanner_get_cells_columnar_result struct) throws org.apache.thrift.TException {
         TTupleProtocol oprot = (TTupleProtocol) prot;
         BitSet optionals = new BitSet();
         if (struct.isSetSuccess()) {
@@ -47119,7 +48025,7 @@ public class ClientService {
       }
 
       @Override
-      public void read(org.apache.thrift.protocol.TProtocol prot, next_cells_serialized_result struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol prot, scanner_get_cells_columnar_result struct) throws org.apache.thrift.TException {
         TTupleProtocol iprot = (TTupleProtocol) prot;
         BitSet incoming = iprot.readBitSet(2);
         if (incoming.get(0)) {
@@ -436,6 +436,16 @@ class Iface(object):
     """
     pass
 
+  def scanner_get_cells_columnar(self, scanner):
+    """
+    Alternative interface returning a columnar batch of cells, which can
+    be consumed without constructing an object per cell
+
+    Parameters:
+     - scanner
+    """
+    pass
+
   def scanner_get_row(self, scanner):
     """
     Iterate over rows of a scanner
@@ -2918,6 +2928,41 @@ class Client(Iface):
       raise result.e
     raise TApplicationException(TApplicationException.MISSING_RESULT, "next_cells_serialized failed: unknown result");
 
+  def scanner_get_cells_columnar(self, scanner):
+    """
+    Alternative interface returning a columnar batch of cells, which can
+    be consumed without constructing an object per cell
+
+    Parameters:
+     - scanner
+    """
+    self.send_scanner_get_cells_columnar(scanner)
+    return self.recv_scanner_get_cells_columnar()
+
+  def send_scanner_get_cells_columnar(self, scanner):
+    self._oprot.writeMessageBegin('scanner_get_cells_columnar', TMessageType.CALL, self._seqid)
+    args = scanner_get_cells_columnar_args()
+    args.scanner = scanner
+    args.write(self._oprot)
+    self._oprot.writeMessageEnd()
+    self._oprot.trans.flush()
+
+  def recv_scanner_get_cells_columnar(self, ):
+    (fname, mtype, rseqid) = self._iprot.readMessageBegin()
+    if mtype == TMessageType.EXCEPTION:
+      x = TApplicationException()
+      x.read(self._iprot)
+      self._iprot.readMessageEnd()
+      raise x
+    result = scanner_get_cells_columnar_result()
+    result.read(self._iprot)
+    self._iprot.readMessageEnd()
+    if result.success is not None:
+      return result.success
+    if result.e is not None:
+      raise result.e
+    raise TApplicationException(TApplicationException.MISSING_RESULT, "scanner_get_cells_columnar failed: unknown result");
+
   def scanner_get_row(self, scanner):
     """
     Iterate over rows of a scanner
@@ -6046,6 +6091,7 @@ class Processor(Iface, TProcessor):
     self._processMap["next_cells_as_arrays"] = Processor.process_next_cells_as_arrays
     self._processMap["scanner_get_cells_serialized"] = Processor.process_scanner_get_cells_serialized
     self._processMap["next_cells_serialized"] = Processor.process_next_cells_serialized
+    self._processMap["scanner_get_cells_columnar"] = Processor.process_scanner_get_cells_columnar
     self._processMap["scanner_get_row"] = Processor.process_scanner_get_row
     self._processMap["next_row"] = Processor.process_next_row
     self._processMap["scanner_get_row_as_arrays"] = Processor.process_scanner_get_row_as_arrays
@@ -6747,6 +6793,20 @@ class Processor(Iface, TProcessor):
     oprot.writeMessageEnd()
     oprot.trans.flush()
 
+  def process_scanner_get_cells_columnar(self, seqid, iprot, oprot):
+    args = scanner_get_cells_columnar_args()
+    args.read(iprot)
+    iprot.readMessageEnd()
+    result = scanner_get_cells_columnar_result()
+    try:
+      result.success = self._handler.scanner_get_cells_columnar(args.scanner)
+    except ClientException, e:
+      result.e = e
+    oprot.writeMessageBegin("scanner_get_cells_columnar", TMessageType.REPLY, seqid)
+    result.write(oprot)
+    oprot.writeMessageEnd()
+    oprot.trans.flush()
+
   def process_scanner_get_row(self, seqid, iprot, oprot):
     args = scanner_get_row_args()
     args.read(iprot)
@@ -13733,6 +13793,138 @@ class next_cells_serialized_result(object):
   def __ne__(self, other):
     return not (self == other)
 
+class scanner_get_cells_columnar_args(object):
+  """
+  Attributes:
+   - scanner
+  """
+
+  thrift_spec = (
+    None, # 0
+    (1, TType.I64, 'scanner', None, None, ), # 1
+  )
+
+  def __init__(self, scanner=None,):
+    self.scanner = scanner
+
+  def read(self, iprot):
+    if iprot.__class__ == TBinaryProtocol.TBinaryProtocolAccelerated and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None and fastbinary is not None:
+      fastbinary.decode_binary(self, iprot.trans, (self.__class__, self.thrift_spec))
+      return
+    iprot.readStructBegin()
+    while True:
+      (fname, ftype, fid) = iprot.readFieldBegin()
+      if ftype == TType.STOP:
+        break
+      if fid == 1:
+        if ftype == TType.I64:
+          self.scanner = iprot.readI64();
+        else:
+          iprot.skip(ftype)
+      else:
+        iprot.skip(ftype)
+      iprot.readFieldEnd()
+    iprot.readStructEnd()
+
+  def write(self, oprot):
+    if oprot.__class__ == TBinaryProtocol.TBinaryProtocolAccelerated and self.thrift_spec is not None and fastbinary is not None:
+      oprot.trans.write(fastbinary.encode_binary(self, (self.__class__, self.thrift_spec)))
+      return
+    oprot.writeStructBegin('scanner_get_cells_columnar_args')
+    if self.scanner is not None:
+      oprot.writeFieldBegin('scanner', TType.I64, 1)
+      oprot.writeI64(self.scanner)
+      oprot.writeFieldEnd()
+    oprot.writeFieldStop()
+    oprot.writeStructEnd()
+
+  def validate(self):
+    return
+
+
+  def __repr__(self):
+    L = ['%s=%r' % (key, value)
+      for key, value in self.__dict__.iteritems()]
+    return '%s(%s)' % (self.__class__.__name__, ', '.join(L))
+
+  def __eq__(self, other):
+    return isinstance(other, self.__class__) and self.__dict__ == other.__dict__
+
+  def __ne__(self, other):
+    return not (self == other)
+
+class scanner_get_cells_columnar_result(object):
+  """
+  Attributes:
+   - success
+   - e
+  """
+
+  thrift_spec = (
+    (0, TType.STRING, 'success', None, None, ), # 0
+    (1, TType.STRUCT, 'e', (ClientException, ClientException.thrift_spec), None, ), # 1
+  )
+
+  def __init__(self, success=None, e=None,):
+    self.success = success
+    self.e = e
+
+  def read(self, iprot):
+    if iprot.__class__ == TBinaryProtocol.TBinaryProtocolAccelerated and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None and fastbinary is not None:
+      fastbinary.decode_binary(self, iprot.trans, (self.__class__, self.thrift_spec))
+      return
+    iprot.readStructBegin()
+    while True:
+      (fname, ftype, fid) = iprot.readFieldBegin()
+      if ftype == TType.STOP:
+        break
+      if fid == 0:
+        if ftype == TType.STRING:
+          self.success = iprot.readString();
+        else:
+          iprot.skip(ftype)
+      elif fid == 1:
+        if ftype == TType.STRUCT:
+          self.e = ClientException()
+          self.e.read(iprot)
+        else:
+          iprot.skip(ftype)
+      else:
+        iprot.skip(ftype)
+      iprot.readFieldEnd()
+    iprot.readStructEnd()
+
+  def write(self, oprot):
+    if oprot.__class__ == TBinaryProtocol.TBinaryProtocolAccelerated and self.thrift_spec is not None and fastbinary is not None:
+      oprot.trans.write(fastbinary.encode_binary(self, (self.__class__, self.thrift_spec)))
+      return
+    oprot.writeStructBegin('scanner_get_cells_columnar_result')
+    if self.success is not None:
+      oprot.writeFieldBegin('success', TType.STRING, 0)
+      oprot.writeString(self.success)
+      oprot.writeFieldEnd()
+    if self.e is not None:
+      oprot.writeFieldBegin('e', TType.STRUCT, 1)
+      self.e.write(oprot)
+      oprot.writeFieldEnd()
+    oprot.writeFieldStop()
+    oprot.writeStructEnd()
+
+  def validate(self):
+    return
+
+
+  def __repr__(self):
+    L = ['%s=%r' % (key, value)
+      for key, value in self.__dict__.iteritems()]
+    return '%s(%s)' % (self.__class__.__name__, ', '.join(L))
+
+  def __eq__(self, other):
+    return isinstance(other, self.__class__) and self.__dict__ == other.__dict__
+
+  def __ne__(self, other):
+    return not (self == other)
+
 class scanner_get_row_args(object):
   """
   Attributes:
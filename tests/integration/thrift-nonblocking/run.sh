@@ -0,0 +1,25 @@
+#!/usr/bin/env bash
+
+set -v
+
+TEST_BIN=./client_test
+HT_HOME=${INSTALL_DIR:-"$HOME/hypertable/current"}
+
+# Serve the Thrift API with TNonblockingServer instead of TThreadedServer
+$HT_HOME/bin/start-test-servers.sh --clean --no-thriftbroker
+$HT_HOME/bin/start-thriftbroker.sh --ThriftBroker.NonBlocking=true
+
+fgrep "Starting the non-blocking server" $HT_HOME/log/ThriftBroker.log
+if [ $? -ne 0 ]; then
+  echo "ThriftBroker did not start in non-blocking mode"
+  $HT_HOME/bin/stop-servers.sh
+  exit 1
+fi
+
+cd ${THRIFT_CPP_TEST_DIR};
+${TEST_BIN}
+status=$?
+
+$HT_HOME/bin/stop-servers.sh
+
+exit $status